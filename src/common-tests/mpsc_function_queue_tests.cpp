@@ -0,0 +1,186 @@
+// SPDX-FileCopyrightText: 2019-2023 Connor McLaughlin <stenzek@gmail.com>
+// SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
+
+#include "common/mpsc_function_queue.h"
+#include "gtest/gtest.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+TEST(MPSCFunctionQueue, EmptyQueue)
+{
+  MPSCFunctionQueue<16> queue;
+  ASSERT_TRUE(queue.IsEmpty());
+  ASSERT_FALSE(queue.RunOne());
+}
+
+TEST(MPSCFunctionQueue, SingleProducerOrdering)
+{
+  MPSCFunctionQueue<16> queue;
+  std::vector<int> values;
+  for (int i = 0; i < 10; i++)
+    queue.Push([&values, i]() { values.push_back(i); });
+
+  ASSERT_FALSE(queue.IsEmpty());
+  while (queue.RunOne())
+    ;
+
+  ASSERT_EQ(values.size(), 10u);
+  for (int i = 0; i < 10; i++)
+    ASSERT_EQ(values[i], i);
+  ASSERT_TRUE(queue.IsEmpty());
+}
+
+TEST(MPSCFunctionQueue, MultiProducerOrderingUnderContention)
+{
+  static constexpr u32 NUM_PRODUCERS = 4;
+  static constexpr u32 PUSHES_PER_PRODUCER = 10000;
+
+  // Small capacity so producers contend on slots and regularly hit the full-queue path.
+  MPSCFunctionQueue<8> queue;
+  std::array<std::vector<u32>, NUM_PRODUCERS> consumed;
+  std::atomic<u32> num_consumed{0};
+
+  std::vector<std::thread> producers;
+  for (u32 p = 0; p < NUM_PRODUCERS; p++)
+  {
+    producers.emplace_back([&queue, &consumed, p]() {
+      for (u32 i = 0; i < PUSHES_PER_PRODUCER; i++)
+        queue.Push([&consumed, p, i]() { consumed[p].push_back(i); });
+    });
+  }
+
+  // Consume on this thread until everything has come through.
+  while (num_consumed.load(std::memory_order_relaxed) < (NUM_PRODUCERS * PUSHES_PER_PRODUCER))
+  {
+    if (queue.RunOne())
+      num_consumed.fetch_add(1, std::memory_order_relaxed);
+    else
+      std::this_thread::yield();
+  }
+
+  for (std::thread& thread : producers)
+    thread.join();
+
+  ASSERT_FALSE(queue.RunOne());
+
+  // Per-producer FIFO order must hold even though producers interleave.
+  for (u32 p = 0; p < NUM_PRODUCERS; p++)
+  {
+    ASSERT_EQ(consumed[p].size(), PUSHES_PER_PRODUCER);
+    for (u32 i = 0; i < PUSHES_PER_PRODUCER; i++)
+      ASSERT_EQ(consumed[p][i], i);
+  }
+}
+
+TEST(MPSCFunctionQueue, InlineStorageConstructionAndDestruction)
+{
+  // Small capture fits the inline storage; track its lifetime through the shared control block.
+  std::shared_ptr<int> token = std::make_shared<int>(42);
+  int result = 0;
+
+  MPSCFunctionQueue<16> queue;
+  queue.Push([token, &result]() { result = *token; });
+  ASSERT_EQ(token.use_count(), 2);
+
+  ASSERT_TRUE(queue.RunOne());
+  ASSERT_EQ(result, 42);
+  ASSERT_EQ(token.use_count(), 1);
+}
+
+TEST(MPSCFunctionQueue, HeapFallbackConstructionAndDestruction)
+{
+  // Capture larger than the inline storage forces the heap path.
+  std::array<u8, 128> big_payload;
+  big_payload.fill(0x5A);
+  std::shared_ptr<int> token = std::make_shared<int>(0);
+  u32 sum = 0;
+
+  MPSCFunctionQueue<16, 64> queue;
+  queue.Push([big_payload, token, &sum]() {
+    for (u8 value : big_payload)
+      sum += value;
+  });
+  static_assert(sizeof(big_payload) > 64);
+  ASSERT_EQ(token.use_count(), 2);
+
+  ASSERT_TRUE(queue.RunOne());
+  ASSERT_EQ(sum, 128u * 0x5Au);
+  ASSERT_EQ(token.use_count(), 1);
+}
+
+TEST(MPSCFunctionQueue, MoveOnlyCallable)
+{
+  std::unique_ptr<int> small_value = std::make_unique<int>(123);
+  auto big_value = std::make_unique<std::array<u8, 128>>();
+  big_value->fill(7);
+
+  int small_result = 0;
+  u32 big_result = 0;
+
+  MPSCFunctionQueue<16, 64> queue;
+  queue.Push([value = std::move(small_value), &small_result]() { small_result = *value; });
+  queue.Push([value = std::move(big_value), &big_result]() { big_result = (*value)[0] + (*value)[127]; });
+
+  ASSERT_TRUE(queue.RunOne());
+  ASSERT_TRUE(queue.RunOne());
+  ASSERT_EQ(small_result, 123);
+  ASSERT_EQ(big_result, 14u);
+}
+
+TEST(MPSCFunctionQueue, ProducerBlocksWhenFull)
+{
+  static constexpr u32 CAPACITY = 4;
+
+  MPSCFunctionQueue<CAPACITY> queue;
+  u32 run_count = 0;
+  for (u32 i = 0; i < CAPACITY; i++)
+    queue.Push([&run_count]() { run_count++; });
+
+  // The next push can't complete until the consumer frees a slot.
+  std::atomic_bool push_completed{false};
+  std::thread producer([&queue, &push_completed, &run_count]() {
+    queue.Push([&run_count]() { run_count++; });
+    push_completed.store(true, std::memory_order_release);
+  });
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  ASSERT_FALSE(push_completed.load(std::memory_order_acquire));
+
+  u32 num_ran = 0;
+  while (num_ran < (CAPACITY + 1))
+  {
+    if (queue.RunOne())
+      num_ran++;
+    else
+      std::this_thread::yield();
+  }
+
+  producer.join();
+  ASSERT_TRUE(push_completed.load(std::memory_order_acquire));
+  ASSERT_EQ(run_count, CAPACITY + 1);
+}
+
+TEST(MPSCFunctionQueue, DestructorDrainsWithoutInvoking)
+{
+  std::shared_ptr<int> small_token = std::make_shared<int>(0);
+  std::shared_ptr<std::array<u8, 128>> big_token = std::make_shared<std::array<u8, 128>>();
+  bool executed = false;
+
+  {
+    MPSCFunctionQueue<16, 64> queue;
+    queue.Push([small_token, &executed]() { executed = true; });
+    queue.Push([big_token, payload = std::array<u8, 128>{}, &executed]() { executed = true; });
+    ASSERT_EQ(small_token.use_count(), 2);
+    ASSERT_EQ(big_token.use_count(), 2);
+  }
+
+  // Both the inline and heap slots must destroy their callables without running them.
+  ASSERT_FALSE(executed);
+  ASSERT_EQ(small_token.use_count(), 1);
+  ASSERT_EQ(big_token.use_count(), 1);
+}
@@ -1528,6 +1528,7 @@ public:
         break;
     }
 
+    m_position += ByteCount - remaining;
     return ByteCount - remaining;
   }
 
@@ -1545,7 +1546,11 @@ public:
 
   bool Write2(const void* pSource, u32 ByteCount, u32* pNumberOfBytesWritten = nullptr) override { return false; }
 
-  bool SeekAbsolute(u64 Offset) override { return false; }
+  // only forward seeks are possible, the decompressed stream can't rewind
+  bool SeekAbsolute(u64 Offset) override
+  {
+    return (Offset >= m_position) ? SeekRelative(static_cast<s64>(Offset - m_position)) : false;
+  }
 
   bool SeekRelative(s64 Offset) override
   {
@@ -1560,6 +1565,7 @@ public:
       const s64 skip = std::min<s64>(m_output_buffer_wpos - m_output_buffer_rpos, remaining);
       remaining -= skip;
       m_output_buffer_rpos += static_cast<u32>(skip);
+      m_position += static_cast<u64>(skip);
       if (remaining == 0)
         return true;
       else if (!Decompress())
@@ -1569,7 +1575,7 @@ public:
 
   bool SeekToEnd() override { return false; }
 
-  u64 GetPosition() const override { return 0; }
+  u64 GetPosition() const override { return m_position; }
 
   u64 GetSize() const override { return 0; }
 
@@ -1638,6 +1644,7 @@ private:
   ByteStream* m_src_stream;
   ZSTD_DStream* m_cstream = nullptr;
   ZSTD_inBuffer m_in_buffer = {};
+  u64 m_position = 0;
   u32 m_output_buffer_rpos = 0;
   u32 m_output_buffer_wpos = 0;
   u32 m_bytes_remaining;
@@ -8,6 +8,16 @@
 #include <cstdio>
 #include <ctime>
 
+static CrashHandler::ContextCallback s_context_callback = nullptr;
+
+// static buffer for the context report, the stack may be exhausted when we get here
+static char s_context_buffer[16384];
+
+void CrashHandler::SetContextCallback(ContextCallback callback)
+{
+  s_context_callback = callback;
+}
+
 #if defined(_WIN32)
 #include "windows_headers.h"
 
@@ -107,6 +117,17 @@ static void WriteMinidumpAndCallstack(PEXCEPTION_POINTERS exi)
     WriteFile(hFile, line, static_cast<DWORD>(std::strlen(line)), &written, nullptr);
   }
 
+  if (s_context_callback && hFile != INVALID_HANDLE_VALUE)
+  {
+    const size_t context_size = s_context_callback(exi ? exi->ExceptionRecord->ExceptionAddress : nullptr,
+                                                   s_context_buffer, sizeof(s_context_buffer));
+    if (context_size > 0)
+    {
+      DWORD written;
+      WriteFile(hFile, s_context_buffer, static_cast<DWORD>(context_size), &written, nullptr);
+    }
+  }
+
   GenerateCrashFilename(filename, std::size(filename), s_write_directory.empty() ? nullptr : s_write_directory.c_str(),
                         L"dmp");
 
@@ -356,6 +377,13 @@ void CrashHandler::CrashSignalHandler(int signal, siginfo_t* siginfo, void* ctx)
 
     FreeBuffer(&buf);
 
+    if (s_context_callback)
+    {
+      const size_t context_size = s_context_callback(exception_pc, s_context_buffer, sizeof(s_context_buffer));
+      if (context_size > 0)
+        write(STDERR_FILENO, s_context_buffer, context_size);
+    }
+
     s_in_signal_handler = false;
   }
 
@@ -5,8 +5,15 @@
 #include <string_view>
 
 namespace CrashHandler {
+/// Appends application-specific context (JIT state, performance counters, recent log output) to
+/// the crash report. Invoked from the crash handler itself, so it must not allocate, lock, or
+/// otherwise assume a healthy process. Writes at most buffer_size bytes into buffer and returns
+/// the number of bytes written. exception_pc may be null when the faulting address is unknown.
+using ContextCallback = size_t (*)(const void* exception_pc, char* buffer, size_t buffer_size);
+
 bool Install();
 void SetWriteDirectory(const std::string_view& dump_directory);
+void SetContextCallback(ContextCallback callback);
 void WriteDumpForCaller();
 void Uninstall();
 } // namespace CrashHandler
@@ -9,10 +9,12 @@
 #include "string_util.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstdlib>
 #include <cstring>
 #include <limits>
 #include <numeric>
+#include <thread>
 
 #ifdef __APPLE__
 #include <mach-o/dyld.h>
@@ -1048,6 +1050,75 @@ bool FileSystem::CopyFilePath(const char* source, const char* destination, bool
 #endif
 }
 
+// Drives a recursive FindFiles() by handing each top-level subdirectory to a worker pool. Results
+// are grouped by subdirectory rather than interleaved depth-first, so callers passing
+// FILESYSTEM_FIND_PARALLEL must not depend on result ordering.
+static bool FindFilesParallel(const char* path, const char* pattern, u32 flags,
+                              FileSystem::FindResultsArray* results)
+{
+  if (!(flags & FILESYSTEM_FIND_KEEP_ARRAY))
+    results->clear();
+
+  const u32 serial_flags = flags & ~(FILESYSTEM_FIND_PARALLEL | FILESYSTEM_FIND_KEEP_ARRAY);
+
+  // files and matching folders in the top-level directory itself
+  const size_t first_result = results->size();
+  FileSystem::FindFiles(path, pattern, (serial_flags & ~FILESYSTEM_FIND_RECURSIVE) | FILESYSTEM_FIND_KEEP_ARRAY,
+                        results);
+
+  // recursion targets; the serial version descends into every directory regardless of pattern
+  FileSystem::FindResultsArray subdirs;
+  FileSystem::FindFiles(path, "*", (flags & FILESYSTEM_FIND_HIDDEN_FILES) | FILESYSTEM_FIND_FOLDERS, &subdirs);
+  if (subdirs.empty())
+    return (results->size() > first_result);
+
+  std::vector<FileSystem::FindResultsArray> subdir_results(subdirs.size());
+  std::atomic<u32> next_subdir{0};
+  const auto worker = [&subdirs, &subdir_results, &next_subdir, pattern, serial_flags]() {
+    u32 index;
+    while ((index = next_subdir.fetch_add(1, std::memory_order_acq_rel)) < static_cast<u32>(subdirs.size()))
+      FileSystem::FindFiles(subdirs[index].FileName.c_str(), pattern, serial_flags, &subdir_results[index]);
+  };
+
+  const u32 num_threads =
+    std::min(static_cast<u32>(subdirs.size()), std::max(std::thread::hardware_concurrency(), 1u));
+  if (num_threads > 1)
+  {
+    std::vector<std::thread> threads;
+    threads.reserve(num_threads);
+    for (u32 i = 0; i < num_threads; i++)
+      threads.emplace_back(worker);
+    for (std::thread& thread : threads)
+      thread.join();
+  }
+  else
+  {
+    worker();
+  }
+
+  size_t total_results = results->size();
+  for (const FileSystem::FindResultsArray& subdir_result : subdir_results)
+    total_results += subdir_result.size();
+  results->reserve(total_results);
+
+  for (size_t i = 0; i < subdirs.size(); i++)
+  {
+    FileSystem::FindResultsArray& subdir_result = subdir_results[i];
+    if (flags & FILESYSTEM_FIND_RELATIVE_PATHS)
+    {
+      // workers return paths relative to their subdirectory, qualify them relative to the origin
+      const std::string_view subdir_name = Path::GetFileName(subdirs[i].FileName);
+      for (FILESYSTEM_FIND_DATA& fd : subdir_result)
+        fd.FileName = fmt::format("{}" FS_OSPATH_SEPARATOR_STR "{}", subdir_name, fd.FileName);
+    }
+
+    results->insert(results->end(), std::make_move_iterator(subdir_result.begin()),
+                    std::make_move_iterator(subdir_result.end()));
+  }
+
+  return (results->size() > first_result);
+}
+
 #ifdef _WIN32
 
 static u32 TranslateWin32Attributes(u32 Win32Attributes)
@@ -1199,6 +1270,10 @@ bool FileSystem::FindFiles(const char* path, const char* pattern, u32 flags, Fin
   if (path[0] == '\0')
     return false;
 
+  // fan recursive queries out to a worker pool when requested
+  if ((flags & FILESYSTEM_FIND_PARALLEL) && (flags & FILESYSTEM_FIND_RECURSIVE))
+    return FindFilesParallel(path, pattern, flags, results);
+
   // clear result array
   if (!(flags & FILESYSTEM_FIND_KEEP_ARRAY))
     results->clear();
@@ -1734,6 +1809,10 @@ bool FileSystem::FindFiles(const char* Path, const char* Pattern, u32 Flags, Fin
   if (Path[0] == '\0')
     return false;
 
+  // fan recursive queries out to a worker pool when requested
+  if ((Flags & FILESYSTEM_FIND_PARALLEL) && (Flags & FILESYSTEM_FIND_RECURSIVE))
+    return FindFilesParallel(Path, Pattern, Flags, pResults);
+
   // clear result array
   if (!(Flags & FILESYSTEM_FIND_KEEP_ARRAY))
     pResults->clear();
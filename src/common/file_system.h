@@ -38,6 +38,11 @@ enum FILESYSTEM_FIND_FLAGS
   FILESYSTEM_FIND_FOLDERS = (1 << 3),
   FILESYSTEM_FIND_FILES = (1 << 4),
   FILESYSTEM_FIND_KEEP_ARRAY = (1 << 5),
+
+  // Enumerates top-level subdirectories of a recursive search on a worker pool. Results are
+  // grouped by subdirectory instead of interleaved depth-first, so only pass this when the
+  // caller does not care about ordering.
+  FILESYSTEM_FIND_PARALLEL = (1 << 6),
 };
 
 struct FILESYSTEM_STAT_DATA
@@ -85,3 +85,27 @@ using PreferUnorderedStringSet = StringSet;
 using PreferUnorderedStringMultiSet = StringMultiSet;
 
 #endif
+
+/// Interns strings into a shared pool, deduplicating the backing storage. Views returned by
+/// Intern() remain valid until the pool is cleared or destroyed, so fields which repeat across
+/// many records (e.g. game metadata) can share one allocation instead of one per record.
+class StringPool
+{
+public:
+  std::string_view Intern(const std::string_view& str)
+  {
+    if (str.empty())
+      return std::string_view();
+
+    const auto iter = m_pool.find(str);
+    if (iter != m_pool.end())
+      return *iter;
+
+    return *m_pool.emplace(str).first;
+  }
+
+  void Clear() { m_pool.clear(); }
+
+private:
+  PreferUnorderedStringSet m_pool;
+};
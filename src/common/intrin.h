@@ -27,6 +27,21 @@
 #include <malloc.h> // alloca
 #endif
 
+/// Hints to the CPU that we're spinning on something, so it can reduce power usage and
+/// give the other hyperthread priority.
+ALWAYS_INLINE static void SpinPause()
+{
+#if defined(CPU_ARCH_SSE)
+  _mm_pause();
+#elif defined(CPU_ARCH_NEON)
+#if defined(_MSC_VER) && !defined(__clang__)
+  __yield();
+#else
+  asm volatile("yield");
+#endif
+#endif
+}
+
 template<typename T>
 ALWAYS_INLINE_RELEASE static void MemsetPtrs(T* ptr, T value, u32 count)
 {
@@ -5,12 +5,18 @@
 #include "assert.h"
 #include "file_system.h"
 #include "small_string.h"
+#include "threading.h"
 #include "timer.h"
 
 #include "fmt/format.h"
 
+#include <atomic>
+#include <condition_variable>
 #include <cstdio>
+#include <cstring>
+#include <memory>
 #include <mutex>
+#include <thread>
 #include <vector>
 
 #if defined(_WIN32)
@@ -30,6 +36,16 @@ struct RegisteredCallback
   Log::CallbackFunctionType Function;
   void* Parameter;
 };
+
+struct AsyncLogEntry
+{
+  const char* channel_name; // always string literals, so storing the pointer is safe
+  const char* function_name;
+  LOGLEVEL level;
+  u32 message_length; // 0xFFFFFFFF when the message spilled to the overflow string
+  char message[448];
+  std::string overflow;
+};
 } // namespace
 
 static void RegisterCallback(CallbackFunctionType callbackFunction, void* pUserParam,
@@ -48,6 +64,9 @@ static void DebugOutputLogCallback(void* pUserParam, const char* channelName, co
                                    std::string_view message);
 static void FileOutputLogCallback(void* pUserParam, const char* channelName, const char* functionName, LOGLEVEL level,
                                   std::string_view message);
+static void EnqueueAsyncLogMessage(const char* channelName, const char* functionName, LOGLEVEL level,
+                                   std::string_view message);
+static void AsyncLogThreadEntryPoint();
 template<typename T>
 static void FormatLogMessageAndPrint(const char* channelName, const char* functionName, LOGLEVEL level,
                                      std::string_view message, bool timestamp, bool ansi_color_code, bool newline,
@@ -74,6 +93,21 @@ static bool s_file_output_enabled = false;
 static bool s_file_output_timestamp = false;
 static bool s_debug_output_enabled = false;
 
+// Deferred output: formatted messages are enqueued into a fixed ring, and a background thread runs
+// the sinks, so callers don't block on console/file I/O. The ring blocks producers when full rather
+// than dropping messages, since captures are no use with holes in them.
+static constexpr u32 ASYNC_LOG_RING_SIZE = 1024;
+static std::unique_ptr<AsyncLogEntry[]> s_async_ring;
+static u32 s_async_ring_write_pos = 0;
+static u32 s_async_ring_read_pos = 0;
+static u32 s_async_ring_count = 0;
+static std::mutex s_async_mutex;
+static std::condition_variable s_async_pending_cv;
+static std::condition_variable s_async_space_cv;
+static std::thread s_async_thread;
+static bool s_async_thread_shutdown = false;
+static std::atomic_bool s_async_output_enabled{false};
+
 #ifdef _WIN32
 static HANDLE s_hConsoleStdIn = NULL;
 static HANDLE s_hConsoleStdOut = NULL;
@@ -445,6 +479,137 @@ void Log::SetFileOutputParams(bool enabled, const char* filename, bool timestamp
   s_file_output_timestamp = timestamps;
 }
 
+bool Log::IsAsyncOutputEnabled()
+{
+  return s_async_output_enabled.load(std::memory_order_relaxed);
+}
+
+void Log::SetAsyncOutputParams(bool enabled)
+{
+  if (s_async_output_enabled.load(std::memory_order_relaxed) == enabled)
+    return;
+
+  if (enabled)
+  {
+    {
+      std::unique_lock lock(s_async_mutex);
+      s_async_ring = std::make_unique<AsyncLogEntry[]>(ASYNC_LOG_RING_SIZE);
+      s_async_ring_write_pos = 0;
+      s_async_ring_read_pos = 0;
+      s_async_ring_count = 0;
+      s_async_thread_shutdown = false;
+    }
+
+    s_async_thread = std::thread(AsyncLogThreadEntryPoint);
+    s_async_output_enabled.store(true, std::memory_order_release);
+  }
+  else
+  {
+    // Route new messages back to the synchronous path, then drain whatever is still queued.
+    s_async_output_enabled.store(false, std::memory_order_release);
+
+    {
+      std::unique_lock lock(s_async_mutex);
+      s_async_thread_shutdown = true;
+    }
+
+    s_async_pending_cv.notify_one();
+    s_async_thread.join();
+
+    std::unique_lock lock(s_async_mutex);
+    s_async_ring.reset();
+  }
+}
+
+void Log::EnqueueAsyncLogMessage(const char* channelName, const char* functionName, LOGLEVEL level,
+                                 std::string_view message)
+{
+  std::unique_lock lock(s_async_mutex);
+  if (!s_async_ring)
+  {
+    // Raced with async output being turned off, write synchronously instead.
+    lock.unlock();
+
+    std::unique_lock cb_lock(s_callback_mutex);
+    if (FilterTest(level, channelName, cb_lock))
+      ExecuteCallbacks(channelName, functionName, level, message, cb_lock);
+
+    return;
+  }
+
+  while (s_async_ring_count == ASYNC_LOG_RING_SIZE)
+    s_async_space_cv.wait(lock);
+
+  AsyncLogEntry& entry = s_async_ring[s_async_ring_write_pos];
+  s_async_ring_write_pos = (s_async_ring_write_pos + 1) % ASYNC_LOG_RING_SIZE;
+  s_async_ring_count++;
+
+  entry.channel_name = channelName;
+  entry.function_name = functionName;
+  entry.level = level;
+  if (message.size() <= std::size(entry.message))
+  {
+    std::memcpy(entry.message, message.data(), message.size());
+    entry.message_length = static_cast<u32>(message.size());
+  }
+  else
+  {
+    entry.overflow.assign(message);
+    entry.message_length = 0xFFFFFFFFu;
+  }
+
+  lock.unlock();
+  s_async_pending_cv.notify_one();
+}
+
+void Log::AsyncLogThreadEntryPoint()
+{
+  Threading::SetNameOfCurrentThread("Log Writer");
+
+  std::string message;
+  std::unique_lock lock(s_async_mutex);
+  for (;;)
+  {
+    if (s_async_ring_count == 0)
+    {
+      if (s_async_thread_shutdown)
+        break;
+
+      s_async_pending_cv.wait(lock);
+      continue;
+    }
+
+    AsyncLogEntry& entry = s_async_ring[s_async_ring_read_pos];
+    const char* channel_name = entry.channel_name;
+    const char* function_name = entry.function_name;
+    const LOGLEVEL level = entry.level;
+    if (entry.message_length == 0xFFFFFFFFu)
+    {
+      message = std::move(entry.overflow);
+      entry.overflow = {};
+    }
+    else
+    {
+      message.assign(entry.message, entry.message_length);
+    }
+
+    s_async_ring_read_pos = (s_async_ring_read_pos + 1) % ASYNC_LOG_RING_SIZE;
+    s_async_ring_count--;
+
+    // Release producers before doing the (slow) sink output.
+    lock.unlock();
+    s_async_space_cv.notify_one();
+
+    {
+      std::unique_lock cb_lock(s_callback_mutex);
+      if (FilterTest(level, channel_name, cb_lock))
+        ExecuteCallbacks(channel_name, function_name, level, message, cb_lock);
+    }
+
+    lock.lock();
+  }
+}
+
 LOGLEVEL Log::GetLogLevel()
 {
   return s_log_level;
@@ -481,6 +646,15 @@ ALWAYS_INLINE_RELEASE bool Log::FilterTest(LOGLEVEL level, const char* channelNa
 
 void Log::Write(const char* channelName, const char* functionName, LOGLEVEL level, std::string_view message)
 {
+  if (s_async_output_enabled.load(std::memory_order_relaxed))
+  {
+    // Channel filtering happens on the writer thread, only the level is checked here.
+    if (level <= s_log_level)
+      EnqueueAsyncLogMessage(channelName, functionName, level, message);
+
+    return;
+  }
+
   std::unique_lock lock(s_callback_mutex);
   if (!FilterTest(level, channelName, lock))
     return;
@@ -498,6 +672,37 @@ void Log::Writef(const char* channelName, const char* functionName, LOGLEVEL lev
 
 void Log::Writev(const char* channelName, const char* functionName, LOGLEVEL level, const char* format, va_list ap)
 {
+  if (s_async_output_enabled.load(std::memory_order_relaxed))
+  {
+    if (level > s_log_level)
+      return;
+
+    // Arguments can reference transient data, so the message has to be formatted before handoff.
+    std::va_list apCopy;
+    va_copy(apCopy, ap);
+
+    char buffer[512];
+    const int len = std::vsnprintf(buffer, countof(buffer), format, apCopy);
+    va_end(apCopy);
+    if (len < 0)
+      return;
+
+    if (static_cast<size_t>(len) < countof(buffer))
+    {
+      EnqueueAsyncLogMessage(channelName, functionName, level, std::string_view(buffer, static_cast<size_t>(len)));
+    }
+    else
+    {
+      char* hbuffer = new char[static_cast<size_t>(len) + 1];
+      const int hlen = std::vsnprintf(hbuffer, static_cast<size_t>(len) + 1, format, ap);
+      if (hlen > 0)
+        EnqueueAsyncLogMessage(channelName, functionName, level, std::string_view(hbuffer, static_cast<size_t>(hlen)));
+      delete[] hbuffer;
+    }
+
+    return;
+  }
+
   std::unique_lock lock(s_callback_mutex);
   if (!FilterTest(level, channelName, lock))
     return;
@@ -532,6 +737,17 @@ void Log::Writev(const char* channelName, const char* functionName, LOGLEVEL lev
 void Log::WriteFmtArgs(const char* channelName, const char* functionName, LOGLEVEL level, fmt::string_view fmt,
                        fmt::format_args args)
 {
+  if (s_async_output_enabled.load(std::memory_order_relaxed))
+  {
+    if (level > s_log_level)
+      return;
+
+    fmt::memory_buffer buffer;
+    fmt::vformat_to(std::back_inserter(buffer), fmt, args);
+    EnqueueAsyncLogMessage(channelName, functionName, level, std::string_view(buffer.data(), buffer.size()));
+    return;
+  }
+
   std::unique_lock lock(s_callback_mutex);
   if (!FilterTest(level, channelName, lock))
     return;
@@ -52,6 +52,10 @@ void SetDebugOutputParams(bool enabled);
 // adds a file output
 void SetFileOutputParams(bool enabled, const char* filename, bool timestamps = true);
 
+// defers sink output (console/file/callbacks) to a background thread, so callers don't block on I/O
+bool IsAsyncOutputEnabled();
+void SetAsyncOutputParams(bool enabled);
+
 // Returns the current global filtering level.
 LOGLEVEL GetLogLevel();
 
@@ -9,12 +9,15 @@
 
 #include "fmt/format.h"
 
+#include <limits>
+
 #if defined(_WIN32)
 #include "windows_headers.h"
 #elif !defined(__ANDROID__)
 #include <cerrno>
 #include <fcntl.h>
 #include <sys/mman.h>
+#include <sys/stat.h>
 #include <unistd.h>
 #endif
 
@@ -59,6 +62,17 @@ void MemMap::DestroySharedMemory(void* ptr)
   CloseHandle(static_cast<HANDLE>(ptr));
 }
 
+void* MemMap::CreateNamedSharedMemory(const char* name, size_t size)
+{
+  // Named mappings are always visible to other processes on Windows for the lifetime of the handle.
+  return CreateSharedMemory(name, size);
+}
+
+void MemMap::DeleteNamedSharedMemory(const char* name)
+{
+  // Nothing to do, the name disappears with the last handle.
+}
+
 void* MemMap::MapSharedMemory(void* handle, size_t offset, void* baseaddr, size_t size, PageProtect mode)
 {
   void* ret = MapViewOfFileEx(static_cast<HANDLE>(handle), FILE_MAP_READ | FILE_MAP_WRITE,
@@ -326,6 +340,32 @@ void MemMap::DestroySharedMemory(void* ptr)
   close(static_cast<int>(reinterpret_cast<intptr_t>(ptr)));
 }
 
+void* MemMap::CreateNamedSharedMemory(const char* name, size_t size)
+{
+  const int fd = shm_open(name, O_CREAT | O_RDWR, 0600);
+  if (fd < 0)
+  {
+    Log_ErrorPrintf("shm_open failed: %d\n", errno);
+    return nullptr;
+  }
+
+  // the name stays linked until DeleteNamedSharedMemory(), so other processes can open it
+  if (ftruncate(fd, static_cast<off_t>(size)) < 0)
+  {
+    Log_ErrorPrintf("ftruncate(%zu) failed: %d\n", size, errno);
+    close(fd);
+    shm_unlink(name);
+    return nullptr;
+  }
+
+  return reinterpret_cast<void*>(static_cast<intptr_t>(fd));
+}
+
+void MemMap::DeleteNamedSharedMemory(const char* name)
+{
+  shm_unlink(name);
+}
+
 void* MemMap::MapSharedMemory(void* handle, size_t offset, void* baseaddr, size_t size, PageProtect mode)
 {
   const int flags = (baseaddr != nullptr) ? (MAP_SHARED | MAP_FIXED) : MAP_SHARED;
@@ -404,6 +444,145 @@ bool SharedMemoryMappingArea::Unmap(void* map_base, size_t map_size)
 
 #endif
 
+#if defined(_WIN32)
+
+void* MemMap::MapFile(const char* path, size_t* out_size)
+{
+  const HANDLE file = CreateFileW(StringUtil::UTF8StringToWideString(path).c_str(), GENERIC_READ, FILE_SHARE_READ,
+                                  nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE)
+  {
+    Log_ErrorPrintf("CreateFileW() failed: %u", GetLastError());
+    return nullptr;
+  }
+
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(file, &size) || size.QuadPart <= 0 ||
+      static_cast<u64>(size.QuadPart) > std::numeric_limits<size_t>::max())
+  {
+    CloseHandle(file);
+    return nullptr;
+  }
+
+  const HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (!mapping)
+  {
+    Log_ErrorPrintf("CreateFileMappingW() failed: %u", GetLastError());
+    CloseHandle(file);
+    return nullptr;
+  }
+
+  void* const baseaddr = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+
+  // the view holds references to both handles
+  CloseHandle(mapping);
+  CloseHandle(file);
+
+  if (!baseaddr)
+  {
+    Log_ErrorPrintf("MapViewOfFile() failed: %u", GetLastError());
+    return nullptr;
+  }
+
+  *out_size = static_cast<size_t>(size.QuadPart);
+  return baseaddr;
+}
+
+void MemMap::UnmapFile(void* baseaddr, size_t size)
+{
+  if (!UnmapViewOfFile(baseaddr))
+    Panic("Failed to unmap file");
+}
+
+void MemMap::PrefetchMappedFile(void* baseaddr, size_t offset, size_t size)
+{
+  WIN32_MEMORY_RANGE_ENTRY range = {static_cast<u8*>(baseaddr) + offset, size};
+  PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+}
+
+#elif !defined(__ANDROID__)
+
+void* MemMap::MapFile(const char* path, size_t* out_size)
+{
+  const int fd = open(path, O_RDONLY);
+  if (fd < 0)
+  {
+    Log_ErrorPrintf("open('%s') failed: %d", path, errno);
+    return nullptr;
+  }
+
+  struct stat sb;
+  if (fstat(fd, &sb) != 0 || sb.st_size <= 0 ||
+      static_cast<u64>(sb.st_size) > std::numeric_limits<size_t>::max())
+  {
+    close(fd);
+    return nullptr;
+  }
+
+  void* const baseaddr = mmap(nullptr, static_cast<size_t>(sb.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+
+  // the mapping holds a reference to the file
+  close(fd);
+
+  if (baseaddr == MAP_FAILED)
+  {
+    Log_ErrorPrintf("mmap('%s', %zd) failed: %d", path, static_cast<ssize_t>(sb.st_size), errno);
+    return nullptr;
+  }
+
+  *out_size = static_cast<size_t>(sb.st_size);
+  return baseaddr;
+}
+
+void MemMap::UnmapFile(void* baseaddr, size_t size)
+{
+  if (munmap(baseaddr, size) != 0)
+    Panic("Failed to unmap file");
+}
+
+void MemMap::PrefetchMappedFile(void* baseaddr, size_t offset, size_t size)
+{
+  madvise(static_cast<u8*>(baseaddr) + offset, size, MADV_WILLNEED);
+}
+
+#else
+
+void* MemMap::MapFile(const char* path, size_t* out_size)
+{
+  return nullptr;
+}
+
+void MemMap::UnmapFile(void* baseaddr, size_t size)
+{
+}
+
+void MemMap::PrefetchMappedFile(void* baseaddr, size_t offset, size_t size)
+{
+}
+
+#endif
+
+bool MemMap::EnableHugePages(void* baseaddr, size_t size)
+{
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+  // Transparent hugepages; honoured for anonymous mappings, and shmem when the kernel's
+  // shmem_enabled is set to advise. Fails harmlessly (e.g. unaligned range, THP disabled).
+  if (madvise(baseaddr, size, MADV_HUGEPAGE) != 0)
+  {
+    Log_DevFmt("madvise(MADV_HUGEPAGE) for {} bytes at {} failed: {}", size, baseaddr, errno);
+    return false;
+  }
+
+  return true;
+#else
+  // Windows large pages need SeLockMemoryPrivilege and MEM_LARGE_PAGES at reservation time, and
+  // Mach superpages can't be combined with the fixed-address remapping fastmem relies on.
+  static_cast<void>(baseaddr);
+  static_cast<void>(size);
+  return false;
+#endif
+}
+
 #if defined(__APPLE__) && defined(__aarch64__)
 
 static thread_local int s_code_write_depth = 0;
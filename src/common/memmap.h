@@ -38,10 +38,29 @@ namespace MemMap {
 std::string GetFileMappingName(const char* prefix);
 void* CreateSharedMemory(const char* name, size_t size);
 void DestroySharedMemory(void* ptr);
+
+/// Variants which keep the name visible so other processes can open the mapping. The name
+/// persists until DeleteNamedSharedMemory() on POSIX; CreateSharedMemory() mappings are removed
+/// from the namespace immediately and are effectively private to this process.
+void* CreateNamedSharedMemory(const char* name, size_t size);
+void DeleteNamedSharedMemory(const char* name);
 void* MapSharedMemory(void* handle, size_t offset, void* baseaddr, size_t size, PageProtect mode);
 void UnmapSharedMemory(void* baseaddr, size_t size);
 bool MemProtect(void* baseaddr, size_t size, PageProtect mode);
 
+/// Maps a file into the address space read-only. Returns null on failure, or when the platform
+/// does not support file mappings.
+void* MapFile(const char* path, size_t* out_size);
+void UnmapFile(void* baseaddr, size_t size);
+
+/// Hints that the specified range of a mapped file will be accessed soon.
+void PrefetchMappedFile(void* baseaddr, size_t offset, size_t size);
+
+/// Best-effort hint that the specified range should be backed by huge pages, to reduce TLB
+/// pressure on hot mappings (guest RAM, JIT code). Returns false when the platform or kernel
+/// configuration cannot honour it; the mapping keeps working with normal pages either way.
+bool EnableHugePages(void* baseaddr, size_t size);
+
 /// JIT write protect for Apple Silicon. Needs to be called prior to writing to any RWX pages.
 #if !defined(__APPLE__) || !defined(__aarch64__)
 // clang-format off
@@ -0,0 +1,80 @@
+// SPDX-FileCopyrightText: 2019-2023 Connor McLaughlin <stenzek@gmail.com>
+// SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
+
+#include "memory_tracker.h"
+#include "log.h"
+
+#include <atomic>
+
+Log_SetChannel(MemoryTracker);
+
+static constexpr const char* s_tag_names[static_cast<u32>(MemoryTracker::Tag::Count)] = {
+  "GPUTexture", // GPUTexture
+  "JITCode",    // JITCode
+  "Rewind",     // Rewind
+};
+
+const char* MemoryTracker::GetTagName(Tag tag)
+{
+  return s_tag_names[static_cast<u32>(tag)];
+}
+
+#ifdef ENABLE_MEMORY_TRACKER
+
+namespace {
+struct TagCounters
+{
+  std::atomic<size_t> live{0};
+  std::atomic<size_t> peak{0};
+};
+} // namespace
+
+static TagCounters s_counters[static_cast<u32>(MemoryTracker::Tag::Count)];
+
+static void UpdatePeak(TagCounters& tc, size_t live)
+{
+  size_t peak = tc.peak.load(std::memory_order_relaxed);
+  while (live > peak && !tc.peak.compare_exchange_weak(peak, live, std::memory_order_relaxed))
+    ;
+}
+
+void MemoryTracker::TrackAllocation(Tag tag, size_t bytes)
+{
+  TagCounters& tc = s_counters[static_cast<u32>(tag)];
+  UpdatePeak(tc, tc.live.fetch_add(bytes, std::memory_order_relaxed) + bytes);
+}
+
+void MemoryTracker::TrackFree(Tag tag, size_t bytes)
+{
+  s_counters[static_cast<u32>(tag)].live.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+void MemoryTracker::SetAllocation(Tag tag, size_t bytes)
+{
+  TagCounters& tc = s_counters[static_cast<u32>(tag)];
+  tc.live.store(bytes, std::memory_order_relaxed);
+  UpdatePeak(tc, bytes);
+}
+
+size_t MemoryTracker::GetLiveBytes(Tag tag)
+{
+  return s_counters[static_cast<u32>(tag)].live.load(std::memory_order_relaxed);
+}
+
+size_t MemoryTracker::GetPeakBytes(Tag tag)
+{
+  return s_counters[static_cast<u32>(tag)].peak.load(std::memory_order_relaxed);
+}
+
+void MemoryTracker::LogStatistics()
+{
+  for (u32 i = 0; i < static_cast<u32>(Tag::Count); i++)
+  {
+    const TagCounters& tc = s_counters[i];
+    Log_InfoPrintf("%-10s: %9.2f MB live, %9.2f MB peak", s_tag_names[i],
+                   static_cast<double>(tc.live.load(std::memory_order_relaxed)) / 1048576.0,
+                   static_cast<double>(tc.peak.load(std::memory_order_relaxed)) / 1048576.0);
+  }
+}
+
+#endif
@@ -0,0 +1,74 @@
+// SPDX-FileCopyrightText: 2019-2023 Connor McLaughlin <stenzek@gmail.com>
+// SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
+
+#pragma once
+
+#include "types.h"
+
+#include <cstddef>
+
+// Tagged accounting of the large session allocations (GPU textures, JIT code, rewind buffers),
+// so memory regressions can be attributed to a subsystem instead of eyeballing RSS. Opt-in via
+// the ENABLE_MEMORY_TRACKER build option; when disabled the instrumentation compiles to nothing.
+namespace MemoryTracker {
+
+enum class Tag : u32
+{
+  GPUTexture,
+  JITCode,
+  Rewind,
+  Count
+};
+
+const char* GetTagName(Tag tag);
+
+#ifdef ENABLE_MEMORY_TRACKER
+
+ALWAYS_INLINE static constexpr bool IsEnabled()
+{
+  return true;
+}
+
+void TrackAllocation(Tag tag, size_t bytes);
+void TrackFree(Tag tag, size_t bytes);
+
+/// Replaces the live byte count for subsystems which account in bulk (e.g. the rewind chain).
+void SetAllocation(Tag tag, size_t bytes);
+
+size_t GetLiveBytes(Tag tag);
+size_t GetPeakBytes(Tag tag);
+
+/// Dumps live/peak for every tag to the log, called once at process shutdown.
+void LogStatistics();
+
+#else
+
+ALWAYS_INLINE static constexpr bool IsEnabled()
+{
+  return false;
+}
+
+ALWAYS_INLINE static void TrackAllocation(Tag, size_t)
+{
+}
+ALWAYS_INLINE static void TrackFree(Tag, size_t)
+{
+}
+ALWAYS_INLINE static void SetAllocation(Tag, size_t)
+{
+}
+ALWAYS_INLINE static size_t GetLiveBytes(Tag)
+{
+  return 0;
+}
+ALWAYS_INLINE static size_t GetPeakBytes(Tag)
+{
+  return 0;
+}
+ALWAYS_INLINE static void LogStatistics()
+{
+}
+
+#endif
+
+} // namespace MemoryTracker
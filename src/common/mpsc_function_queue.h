@@ -0,0 +1,147 @@
+// SPDX-FileCopyrightText: 2019-2023 Connor McLaughlin <stenzek@gmail.com>
+// SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
+
+#pragma once
+#include "align.h"
+#include "assert.h"
+#include "types.h"
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+/// Bounded multi-producer single-consumer queue of type-erased callables, intended for
+/// cross-thread "run on thread X" calls. Producers claim a slot with a single atomic RMW and
+/// construct the callable into fixed inline storage, so posting neither allocates nor takes a
+/// lock; callables larger than the inline storage fall back to a heap allocation. Slot claiming
+/// follows the usual sequence-number bounded queue scheme, the consumer side is unsynchronized
+/// since there is only one of them.
+template<u32 CAPACITY, u32 INLINE_STORAGE_SIZE = 64>
+class MPSCFunctionQueue
+{
+  static_assert(Common::IsPow2(CAPACITY), "Capacity must be a power of two");
+
+public:
+  MPSCFunctionQueue()
+  {
+    for (u32 i = 0; i < CAPACITY; i++)
+      m_slots[i].sequence.store(i, std::memory_order_relaxed);
+  }
+
+  ~MPSCFunctionQueue()
+  {
+    // Anything left in the queue gets destroyed without being invoked.
+    while (PopOne(false))
+      ;
+  }
+
+  MPSCFunctionQueue(const MPSCFunctionQueue&) = delete;
+  MPSCFunctionQueue& operator=(const MPSCFunctionQueue&) = delete;
+
+  /// Safe to call from any thread, but can race a concurrent producer; pair it with a timed
+  /// wait if you need a wakeup guarantee.
+  bool IsEmpty() const
+  {
+    const u32 head = m_head.load(std::memory_order_relaxed);
+    return (m_slots[head & MASK].sequence.load(std::memory_order_acquire) != (head + 1));
+  }
+
+  /// Enqueues a callable. Producers only block (by yielding) if the queue is completely full,
+  /// which means the consumer is more than CAPACITY calls behind.
+  template<typename F>
+  void Push(F&& func)
+  {
+    using FuncType = std::remove_cv_t<std::remove_reference_t<F>>;
+
+    Slot& slot = ClaimSlot();
+    if constexpr (sizeof(FuncType) <= INLINE_STORAGE_SIZE && alignof(FuncType) <= alignof(std::max_align_t))
+    {
+      new (slot.storage) FuncType(std::forward<F>(func));
+      slot.invoke = [](Slot& s, bool execute) {
+        FuncType* f = reinterpret_cast<FuncType*>(s.storage);
+        if (execute)
+          (*f)();
+        f->~FuncType();
+      };
+    }
+    else
+    {
+      new (slot.storage) FuncType*(new FuncType(std::forward<F>(func)));
+      slot.invoke = [](Slot& s, bool execute) {
+        FuncType* f = *reinterpret_cast<FuncType**>(s.storage);
+        if (execute)
+          (*f)();
+        delete f;
+      };
+    }
+
+    slot.sequence.store(slot.claimed_pos + 1, std::memory_order_release);
+  }
+
+  /// Runs the oldest queued callable. Only valid on the consumer thread. Returns false if the
+  /// queue was empty.
+  bool RunOne() { return PopOne(true); }
+
+private:
+  struct Slot
+  {
+    std::atomic<u32> sequence;
+    u32 claimed_pos;
+    void (*invoke)(Slot& slot, bool execute);
+    alignas(std::max_align_t) u8 storage[INLINE_STORAGE_SIZE];
+  };
+
+  static constexpr u32 MASK = CAPACITY - 1;
+
+  Slot& ClaimSlot()
+  {
+    u32 pos = m_tail.load(std::memory_order_relaxed);
+    for (;;)
+    {
+      Slot& slot = m_slots[pos & MASK];
+      const u32 seq = slot.sequence.load(std::memory_order_acquire);
+      const s32 diff = static_cast<s32>(seq - pos);
+      if (diff == 0)
+      {
+        if (m_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+        {
+          slot.claimed_pos = pos;
+          return slot;
+        }
+      }
+      else if (diff < 0)
+      {
+        // Queue is full, wait for the consumer to catch up.
+        std::this_thread::yield();
+        pos = m_tail.load(std::memory_order_relaxed);
+      }
+      else
+      {
+        pos = m_tail.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  bool PopOne(bool execute)
+  {
+    const u32 head = m_head.load(std::memory_order_relaxed);
+    Slot& slot = m_slots[head & MASK];
+    if (slot.sequence.load(std::memory_order_acquire) != (head + 1))
+      return false;
+
+    slot.invoke(slot, execute);
+    slot.sequence.store(head + CAPACITY, std::memory_order_release);
+    m_head.store(head + 1, std::memory_order_relaxed);
+    return true;
+  }
+
+  std::atomic<u32> m_tail{0};
+
+  // Only written by the consumer, atomic so IsEmpty() can be polled from producers.
+  std::atomic<u32> m_head{0};
+
+  Slot m_slots[CAPACITY];
+};
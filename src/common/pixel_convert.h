@@ -0,0 +1,218 @@
+// SPDX-FileCopyrightText: 2019-2023 Connor McLaughlin <stenzek@gmail.com>
+// SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
+
+// Vectorized row converters for the CPU-side pixel format conversions shared by the screenshot,
+// VRAM dump and texture readback paths. All kernels expand 5/6-bit components with the rounded
+// scaling used by VRAMRGBA5551ToRGBA8888 in gpu_types.h ((c * 527 + 23) >> 6 for 5 bits).
+
+#pragma once
+
+#include "intrin.h"
+#include "types.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace PixelConvert {
+
+/// Expands a 5-bit component to 8 bits with rounding. Constants from https://stackoverflow.com/a/9069480
+ALWAYS_INLINE static constexpr u8 Expand5To8(u8 value)
+{
+  return static_cast<u8>(((static_cast<u32>(value) * 527u) + 23u) >> 6);
+}
+
+/// Expands a 6-bit component to 8 bits with rounding.
+ALWAYS_INLINE static constexpr u8 Expand6To8(u8 value)
+{
+  return static_cast<u8>(((static_cast<u32>(value) * 259u) + 33u) >> 6);
+}
+
+namespace detail {
+
+/// Converts a row of 16-bit 5551 pixels to RGBA8888. RED_LOW selects between the VRAM layout
+/// (red in bits 0-4) and the usual texture layout (red in bits 10-14); FORCE_OPAQUE replaces the
+/// alpha bit with 255.
+template<bool RED_LOW, bool FORCE_OPAQUE>
+ALWAYS_INLINE_RELEASE static void Convert5551Row(u32* dst, const u16* src, u32 count)
+{
+  constexpr u32 red_shift = RED_LOW ? 0 : 10;
+  constexpr u32 blue_shift = RED_LOW ? 10 : 0;
+
+  u32 col = 0;
+
+#if defined(CPU_ARCH_SSE)
+  const __m128i mask5 = _mm_set1_epi16(0x1F);
+  const __m128i mul5 = _mm_set1_epi16(527);
+  const __m128i add5 = _mm_set1_epi16(23);
+  for (; (col + 8) <= count; col += 8)
+  {
+    const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&src[col]));
+    const __m128i r5 = _mm_and_si128(_mm_srli_epi16(value, red_shift), mask5);
+    const __m128i g5 = _mm_and_si128(_mm_srli_epi16(value, 5), mask5);
+    const __m128i b5 = _mm_and_si128(_mm_srli_epi16(value, blue_shift), mask5);
+    const __m128i r8 = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(r5, mul5), add5), 6);
+    const __m128i g8 = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(g5, mul5), add5), 6);
+    const __m128i b8 = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(b5, mul5), add5), 6);
+    const __m128i a8 = FORCE_OPAQUE ? _mm_set1_epi16(static_cast<s16>(0xFF00)) :
+                                      _mm_and_si128(_mm_srai_epi16(value, 15), _mm_set1_epi16(static_cast<s16>(0xFF00)));
+    const __m128i rg = _mm_or_si128(r8, _mm_slli_epi16(g8, 8));
+    const __m128i ba = _mm_or_si128(b8, a8);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&dst[col]), _mm_unpacklo_epi16(rg, ba));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&dst[col + 4]), _mm_unpackhi_epi16(rg, ba));
+  }
+#elif defined(CPU_ARCH_NEON)
+  const uint16x8_t mask5 = vdupq_n_u16(0x1F);
+  const uint16x8_t mul5 = vdupq_n_u16(527);
+  const uint16x8_t add5 = vdupq_n_u16(23);
+  for (; (col + 8) <= count; col += 8)
+  {
+    const uint16x8_t value = vld1q_u16(&src[col]);
+    uint16x8_t r5, b5;
+    if constexpr (RED_LOW)
+    {
+      r5 = vandq_u16(value, mask5);
+      b5 = vandq_u16(vshrq_n_u16(value, 10), mask5);
+    }
+    else
+    {
+      r5 = vandq_u16(vshrq_n_u16(value, 10), mask5);
+      b5 = vandq_u16(value, mask5);
+    }
+    const uint16x8_t g5 = vandq_u16(vshrq_n_u16(value, 5), mask5);
+    const uint16x8_t r8 = vshrq_n_u16(vmlaq_u16(add5, r5, mul5), 6);
+    const uint16x8_t g8 = vshrq_n_u16(vmlaq_u16(add5, g5, mul5), 6);
+    const uint16x8_t b8 = vshrq_n_u16(vmlaq_u16(add5, b5, mul5), 6);
+    const uint16x8_t a8 =
+      FORCE_OPAQUE ?
+        vdupq_n_u16(0xFF00) :
+        vandq_u16(vreinterpretq_u16_s16(vshrq_n_s16(vreinterpretq_s16_u16(value), 15)), vdupq_n_u16(0xFF00));
+    const uint16x8_t rg = vorrq_u16(r8, vshlq_n_u16(g8, 8));
+    const uint16x8_t ba = vorrq_u16(b8, a8);
+    const uint16x8x2_t zipped = vzipq_u16(rg, ba);
+    vst1q_u32(&dst[col], vreinterpretq_u32_u16(zipped.val[0]));
+    vst1q_u32(&dst[col + 4], vreinterpretq_u32_u16(zipped.val[1]));
+  }
+#endif
+
+  for (; col < count; col++)
+  {
+    const u16 value = src[col];
+    const u8 r = Expand5To8(static_cast<u8>((value >> red_shift) & 0x1F));
+    const u8 g = Expand5To8(static_cast<u8>((value >> 5) & 0x1F));
+    const u8 b = Expand5To8(static_cast<u8>((value >> blue_shift) & 0x1F));
+    const u8 a = (FORCE_OPAQUE || (value >> 15)) ? 0xFF : 0x00;
+    dst[col] = ZeroExtend32(r) | (ZeroExtend32(g) << 8) | (ZeroExtend32(b) << 16) | (ZeroExtend32(a) << 24);
+  }
+}
+
+} // namespace detail
+
+/// Converts a row of VRAM-layout 5551 pixels (red in bits 0-4) to RGBA8888.
+template<bool FORCE_OPAQUE>
+ALWAYS_INLINE_RELEASE static void VRAM5551RowToRGBA8888(u32* dst, const u16* src, u32 count)
+{
+  detail::Convert5551Row<true, FORCE_OPAQUE>(dst, src, count);
+}
+
+/// Converts a row of texture-layout RGBA5551 pixels (red in bits 10-14) to RGBA8888.
+ALWAYS_INLINE_RELEASE static void RGBA5551RowToRGBA8888(u32* dst, const u16* src, u32 count)
+{
+  detail::Convert5551Row<false, false>(dst, src, count);
+}
+
+/// Converts a row of RGB565 pixels (red in bits 11-15) to opaque RGBA8888.
+ALWAYS_INLINE_RELEASE static void RGB565RowToRGBA8888(u32* dst, const u16* src, u32 count)
+{
+  u32 col = 0;
+
+#if defined(CPU_ARCH_SSE)
+  const __m128i mask5 = _mm_set1_epi16(0x1F);
+  const __m128i mask6 = _mm_set1_epi16(0x3F);
+  const __m128i mul5 = _mm_set1_epi16(527);
+  const __m128i add5 = _mm_set1_epi16(23);
+  const __m128i mul6 = _mm_set1_epi16(259);
+  const __m128i add6 = _mm_set1_epi16(33);
+  const __m128i alpha = _mm_set1_epi16(static_cast<s16>(0xFF00));
+  for (; (col + 8) <= count; col += 8)
+  {
+    const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&src[col]));
+    const __m128i r5 = _mm_and_si128(_mm_srli_epi16(value, 11), mask5);
+    const __m128i g6 = _mm_and_si128(_mm_srli_epi16(value, 5), mask6);
+    const __m128i b5 = _mm_and_si128(value, mask5);
+    const __m128i r8 = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(r5, mul5), add5), 6);
+    const __m128i g8 = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(g6, mul6), add6), 6);
+    const __m128i b8 = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(b5, mul5), add5), 6);
+    const __m128i rg = _mm_or_si128(r8, _mm_slli_epi16(g8, 8));
+    const __m128i ba = _mm_or_si128(b8, alpha);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&dst[col]), _mm_unpacklo_epi16(rg, ba));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&dst[col + 4]), _mm_unpackhi_epi16(rg, ba));
+  }
+#elif defined(CPU_ARCH_NEON)
+  const uint16x8_t mask5 = vdupq_n_u16(0x1F);
+  const uint16x8_t mask6 = vdupq_n_u16(0x3F);
+  const uint16x8_t mul5 = vdupq_n_u16(527);
+  const uint16x8_t add5 = vdupq_n_u16(23);
+  const uint16x8_t mul6 = vdupq_n_u16(259);
+  const uint16x8_t add6 = vdupq_n_u16(33);
+  const uint16x8_t alpha = vdupq_n_u16(0xFF00);
+  for (; (col + 8) <= count; col += 8)
+  {
+    const uint16x8_t value = vld1q_u16(&src[col]);
+    const uint16x8_t r5 = vandq_u16(vshrq_n_u16(value, 11), mask5);
+    const uint16x8_t g6 = vandq_u16(vshrq_n_u16(value, 5), mask6);
+    const uint16x8_t b5 = vandq_u16(value, mask5);
+    const uint16x8_t r8 = vshrq_n_u16(vmlaq_u16(add5, r5, mul5), 6);
+    const uint16x8_t g8 = vshrq_n_u16(vmlaq_u16(add6, g6, mul6), 6);
+    const uint16x8_t b8 = vshrq_n_u16(vmlaq_u16(add5, b5, mul5), 6);
+    const uint16x8_t rg = vorrq_u16(r8, vshlq_n_u16(g8, 8));
+    const uint16x8_t ba = vorrq_u16(b8, alpha);
+    const uint16x8x2_t zipped = vzipq_u16(rg, ba);
+    vst1q_u32(&dst[col], vreinterpretq_u32_u16(zipped.val[0]));
+    vst1q_u32(&dst[col + 4], vreinterpretq_u32_u16(zipped.val[1]));
+  }
+#endif
+
+  for (; col < count; col++)
+  {
+    const u16 value = src[col];
+    const u8 r = Expand5To8(static_cast<u8>((value >> 11) & 0x1F));
+    const u8 g = Expand6To8(static_cast<u8>((value >> 5) & 0x3F));
+    const u8 b = Expand5To8(static_cast<u8>(value & 0x1F));
+    dst[col] = ZeroExtend32(r) | (ZeroExtend32(g) << 8) | (ZeroExtend32(b) << 16) | 0xFF000000u;
+  }
+}
+
+/// Swaps the red and blue channels of a row of 8888 pixels in place, preserving green and alpha.
+ALWAYS_INLINE_RELEASE static void SwapRedBlueRow(u32* pixels, u32 count)
+{
+  u32 col = 0;
+
+#if defined(CPU_ARCH_SSE)
+  const __m128i ga_mask = _mm_set1_epi32(static_cast<s32>(0xFF00FF00u));
+  const __m128i b_mask = _mm_set1_epi32(0x000000FF);
+  const __m128i r_mask = _mm_set1_epi32(0x00FF0000);
+  for (; (col + 4) <= count; col += 4)
+  {
+    const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&pixels[col]));
+    const __m128i swapped = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(value, 16), b_mask),
+                                         _mm_and_si128(_mm_slli_epi32(value, 16), r_mask));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&pixels[col]),
+                     _mm_or_si128(_mm_and_si128(value, ga_mask), swapped));
+  }
+#elif defined(CPU_ARCH_NEON)
+  for (; (col + 16) <= count; col += 16)
+  {
+    uint8x16x4_t value = vld4q_u8(reinterpret_cast<const u8*>(&pixels[col]));
+    std::swap(value.val[0], value.val[2]);
+    vst4q_u8(reinterpret_cast<u8*>(&pixels[col]), value);
+  }
+#endif
+
+  for (; col < count; col++)
+  {
+    const u32 value = pixels[col];
+    pixels[col] = (value & 0xFF00FF00u) | ((value & 0xFFu) << 16) | ((value >> 16) & 0xFFu);
+  }
+}
+
+} // namespace PixelConvert
@@ -199,11 +199,6 @@ void SmallStringBase::prepend(const char* str, u32 length)
   m_buffer[m_length] = 0;
 }
 
-void SmallStringBase::append(char c)
-{
-  append(&c, 1);
-}
-
 void SmallStringBase::append(const SmallStringBase& str)
 {
   append(str.m_buffer, str.m_length);
@@ -48,7 +48,20 @@ public:
   void clear();
 
   // append a single character to this string
-  void append(char c);
+  // inline fast path for the common case where the buffer has room, since this is what
+  // fmt's back_inserter output iterator hits for every character it writes
+  ALWAYS_INLINE void append(char c)
+  {
+    if ((m_length + 1) < m_buffer_size) [[likely]]
+    {
+      m_buffer[m_length++] = c;
+      m_buffer[m_length] = 0;
+    }
+    else
+    {
+      append(&c, 1);
+    }
+  }
 
   // append a string to this string
   void append(const char* appendText);
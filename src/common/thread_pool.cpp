@@ -0,0 +1,226 @@
+// SPDX-FileCopyrightText: 2019-2023 Connor McLaughlin <stenzek@gmail.com>
+// SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
+
+#include "thread_pool.h"
+#include "assert.h"
+
+#include <bit>
+#include <cstdio>
+#include <thread>
+
+thread_local Threading::ThreadPool::Worker* Threading::ThreadPool::s_current_worker = nullptr;
+
+Threading::ThreadPool::ThreadPool(u32 num_workers, bool pin_workers /* = false */)
+{
+  DebugAssert(num_workers > 0);
+
+  m_workers.reserve(num_workers);
+  for (u32 i = 0; i < num_workers; i++)
+  {
+    std::unique_ptr<Worker>& worker = m_workers.emplace_back(std::make_unique<Worker>());
+    worker->pool = this;
+    worker->index = i;
+  }
+
+  // Start the threads only once the vector is fully populated, since workers walk it when stealing.
+  const u32 num_processors = std::max<u32>(std::thread::hardware_concurrency(), 1u);
+  for (u32 i = 0; i < num_workers; i++)
+  {
+    Worker* worker = m_workers[i].get();
+    worker->thread.Start([worker]() { worker->pool->WorkerEntryPoint(worker); });
+    if (pin_workers)
+      worker->thread.SetAffinity(u64(1) << (i % std::min<u32>(num_processors, 64)));
+  }
+}
+
+Threading::ThreadPool::~ThreadPool()
+{
+  // Workers drain all queues before exiting, so anything already queued still runs.
+  {
+    std::unique_lock lock(m_queue_mutex);
+    m_shutdown = true;
+  }
+  m_task_cv.notify_all();
+
+  for (std::unique_ptr<Worker>& worker : m_workers)
+    worker->thread.Join();
+}
+
+Threading::ThreadPool& Threading::ThreadPool::GetInstance()
+{
+  static ThreadPool s_thread_pool(GetDefaultWorkerCount());
+  return s_thread_pool;
+}
+
+u32 Threading::ThreadPool::GetDefaultWorkerCount()
+{
+  // Leave a core for whichever thread is queuing the work, the emulation threads are busy enough.
+  return std::max<u32>(std::thread::hardware_concurrency(), 2u) - 1u;
+}
+
+void Threading::ThreadPool::QueueTask(Task task, Priority priority /* = Priority::Normal */,
+                                      u64 affinity_hint /* = 0 */)
+{
+  Worker* target = nullptr;
+  if (affinity_hint != 0)
+    target = m_workers[static_cast<u32>(std::countr_zero(affinity_hint)) % m_workers.size()].get();
+  else if (s_current_worker && s_current_worker->pool == this)
+    target = s_current_worker;
+
+  if (target)
+  {
+    std::unique_lock lock(target->queue_mutex);
+    target->queue.push_back(std::move(task));
+  }
+  else
+  {
+    std::unique_lock lock(m_queue_mutex);
+    m_global_queues[static_cast<u32>(priority)].push_back(std::move(task));
+  }
+
+  {
+    std::unique_lock lock(m_queue_mutex);
+    m_num_queued++;
+    m_num_pending++;
+  }
+  m_task_cv.notify_one();
+}
+
+void Threading::ThreadPool::WaitForAll()
+{
+  // Waiting from a worker deadlocks the pool, make sure it shows up in release builds too.
+  AssertMsg(!IsCurrentThreadWorker(), "ThreadPool::WaitForAll() called from a pool worker");
+
+  std::unique_lock lock(m_queue_mutex);
+  m_idle_cv.wait(lock, [this]() { return (m_num_pending == 0); });
+}
+
+bool Threading::ThreadPool::IsCurrentThreadWorker() const
+{
+  return (s_current_worker && s_current_worker->pool == this);
+}
+
+Threading::ThreadPool::Task Threading::ThreadPool::GetNextTask(Worker* worker)
+{
+  // Own queue first, newest task first for cache locality.
+  {
+    std::unique_lock lock(worker->queue_mutex);
+    if (!worker->queue.empty())
+    {
+      Task task = std::move(worker->queue.back());
+      worker->queue.pop_back();
+      return task;
+    }
+  }
+
+  // Then the global queues, highest priority first.
+  {
+    std::unique_lock lock(m_queue_mutex);
+    for (u32 i = static_cast<u32>(Priority::Count); i > 0; i--)
+    {
+      std::deque<Task>& queue = m_global_queues[i - 1];
+      if (!queue.empty())
+      {
+        Task task = std::move(queue.front());
+        queue.pop_front();
+        return task;
+      }
+    }
+  }
+
+  // Otherwise steal the oldest task from another worker.
+  const u32 count = static_cast<u32>(m_workers.size());
+  for (u32 i = 1; i < count; i++)
+  {
+    Worker& victim = *m_workers[(worker->index + i) % count];
+    std::unique_lock lock(victim.queue_mutex);
+    if (!victim.queue.empty())
+    {
+      Task task = std::move(victim.queue.front());
+      victim.queue.pop_front();
+      return task;
+    }
+  }
+
+  return {};
+}
+
+void Threading::ThreadPool::WorkerEntryPoint(Worker* worker)
+{
+  char thread_name[32];
+  std::snprintf(thread_name, sizeof(thread_name), "Pool Worker %u", worker->index);
+  SetNameOfCurrentThread(thread_name);
+
+  s_current_worker = worker;
+
+  for (;;)
+  {
+    Task task = GetNextTask(worker);
+    if (task)
+    {
+      {
+        std::unique_lock lock(m_queue_mutex);
+        m_num_queued--;
+      }
+
+      task();
+
+      // Drop any captures before signalling completion, waiters may depend on their destruction.
+      task = {};
+
+      std::unique_lock lock(m_queue_mutex);
+      m_num_pending--;
+      if (m_num_pending == 0)
+        m_idle_cv.notify_all();
+
+      continue;
+    }
+
+    std::unique_lock lock(m_queue_mutex);
+    if (m_shutdown && m_num_queued == 0)
+      break;
+
+    m_task_cv.wait(lock, [this]() { return (m_shutdown || m_num_queued > 0); });
+  }
+}
+
+Threading::TaskGroup::TaskGroup(ThreadPool& pool /* = ThreadPool::GetInstance() */) : m_pool(pool)
+{
+}
+
+Threading::TaskGroup::~TaskGroup()
+{
+  // Tasks reference the group through their completion wrapper, so they must not outlive it.
+  Wait();
+}
+
+void Threading::TaskGroup::QueueTask(ThreadPool::Task task, ThreadPool::Priority priority /* = Priority::Normal */,
+                                     u64 affinity_hint /* = 0 */)
+{
+  {
+    std::unique_lock lock(m_mutex);
+    m_num_pending++;
+  }
+
+  m_pool.QueueTask(
+    [this, task = std::move(task)]() mutable {
+      task();
+
+      // Drop any captures before signalling completion, waiters may depend on their destruction.
+      task = {};
+
+      std::unique_lock lock(m_mutex);
+      m_num_pending--;
+      if (m_num_pending == 0)
+        m_done_cv.notify_all();
+    },
+    priority, affinity_hint);
+}
+
+void Threading::TaskGroup::Wait()
+{
+  AssertMsg(!m_pool.IsCurrentThreadWorker(), "TaskGroup::Wait() called from a pool worker");
+
+  std::unique_lock lock(m_mutex);
+  m_done_cv.wait(lock, [this]() { return (m_num_pending == 0); });
+}
@@ -0,0 +1,115 @@
+// SPDX-FileCopyrightText: 2019-2023 Connor McLaughlin <stenzek@gmail.com>
+// SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
+
+#pragma once
+
+#include "threading.h"
+#include "types.h"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Threading {
+
+// --------------------------------------------------------------------------------------
+//  ThreadPool
+// --------------------------------------------------------------------------------------
+// A shared pool of worker threads for bursty parallel work. Tasks queued from outside the
+// pool land in a global priority queue; tasks queued from within a worker land in that
+// worker's local deque, where idle workers can steal them. This keeps fan-out work
+// balanced without each subsystem spawning its own threads and oversubscribing the host.
+//
+class ThreadPool
+{
+public:
+  enum class Priority : u8
+  {
+    Low,
+    Normal,
+    High,
+    Count
+  };
+
+  using Task = std::function<void()>;
+
+  ThreadPool(u32 num_workers, bool pin_workers = false);
+  ~ThreadPool();
+
+  /// Returns the process-wide pool, created on first use and sized for the host.
+  static ThreadPool& GetInstance();
+
+  /// Returns a reasonable worker count for the host, leaving a core for the caller.
+  static u32 GetDefaultWorkerCount();
+
+  ALWAYS_INLINE u32 GetWorkerCount() const { return static_cast<u32>(m_workers.size()); }
+
+  /// Queues a task for execution. affinity_hint, when non-zero, is a processor mask used to pick a
+  /// preferred worker; it is only a hint, since any idle worker can still steal the task. Priority
+  /// applies to the global queue; tasks routed to a worker's local deque run in LIFO order.
+  void QueueTask(Task task, Priority priority = Priority::Normal, u64 affinity_hint = 0);
+
+  /// Blocks until all queued tasks have finished executing. Must not be called from a worker.
+  /// Prefer TaskGroup for fan-out/join, since this also waits on unrelated subsystems' tasks.
+  void WaitForAll();
+
+  /// Returns true if the calling thread is one of this pool's workers.
+  bool IsCurrentThreadWorker() const;
+
+private:
+  struct Worker
+  {
+    ThreadPool* pool;
+    u32 index;
+    Thread thread;
+    std::mutex queue_mutex;
+    std::deque<Task> queue;
+  };
+
+  void WorkerEntryPoint(Worker* worker);
+  Task GetNextTask(Worker* worker);
+
+  static thread_local Worker* s_current_worker;
+
+  std::vector<std::unique_ptr<Worker>> m_workers;
+  std::deque<Task> m_global_queues[static_cast<u32>(Priority::Count)];
+  std::mutex m_queue_mutex;
+  std::condition_variable m_task_cv;
+  std::condition_variable m_idle_cv;
+  u32 m_num_queued = 0;  // tasks sitting in any queue
+  u32 m_num_pending = 0; // tasks queued or executing
+  bool m_shutdown = false;
+};
+
+// --------------------------------------------------------------------------------------
+//  TaskGroup
+// --------------------------------------------------------------------------------------
+// A waitable batch of tasks on a ThreadPool. Wait() blocks only until the tasks queued
+// through this group have finished, unlike ThreadPool::WaitForAll(), which drains the
+// whole pool including unrelated subsystems' tasks. Reusable once Wait() returns.
+//
+class TaskGroup
+{
+public:
+  explicit TaskGroup(ThreadPool& pool = ThreadPool::GetInstance());
+  ~TaskGroup();
+
+  /// Queues a task as part of this group. Parameters match ThreadPool::QueueTask().
+  void QueueTask(ThreadPool::Task task, ThreadPool::Priority priority = ThreadPool::Priority::Normal,
+                 u64 affinity_hint = 0);
+
+  /// Blocks until all tasks queued through this group have finished executing.
+  /// Must not be called from one of the pool's workers.
+  void Wait();
+
+private:
+  ThreadPool& m_pool;
+  std::mutex m_mutex;
+  std::condition_variable m_done_cv;
+  u32 m_num_pending = 0;
+};
+
+} // namespace Threading
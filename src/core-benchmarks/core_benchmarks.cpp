@@ -0,0 +1,303 @@
+// SPDX-FileCopyrightText: 2019-2023 Connor McLaughlin <stenzek@gmail.com>
+// SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
+
+// Micro-benchmarks for the hot emulation kernels which can be driven through their public
+// interfaces: GTE instruction sequences, the software rasterizer's triangle specializations, and
+// FIFOQueue/StateWrapper throughput. Input data is generated from a fixed-seed PRNG so runs are
+// deterministic and comparable across builds. For whole-system numbers (MDEC, SPU, recompiler),
+// use duckstation-regtest's -benchmark mode instead, since those kernels only run as part of a
+// booted system.
+
+#include "core/achievements.h"
+#include "core/gpu_sw_backend.h"
+#include "core/gpu_types.h"
+#include "core/gte.h"
+#include "core/host.h"
+#include "core/settings.h"
+#include "core/system.h"
+
+#include "util/input_manager.h"
+#include "util/state_wrapper.h"
+
+#include "common/byte_stream.h"
+#include "common/fifo_queue.h"
+#include "common/file_system.h"
+#include "common/log.h"
+#include "common/path.h"
+#include "common/timer.h"
+
+#include "fmt/format.h"
+
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+Log_SetChannel(CoreBenchmarks);
+
+namespace CoreBenchmarks {
+
+static u32 s_rng_state = 0x12345678u;
+
+/// xorshift32; fixed seed so every run sees the same "captured" data.
+static u32 RandomU32()
+{
+  u32 x = s_rng_state;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  s_rng_state = x;
+  return x;
+}
+
+template<typename F>
+static void RunBenchmark(const char* name, u32 iterations, u64 items_per_iteration, const F& func)
+{
+  // one warmup pass so we're not timing cold caches/page faults
+  func();
+
+  Common::Timer timer;
+  for (u32 i = 0; i < iterations; i++)
+    func();
+
+  const double seconds = timer.GetTimeSeconds();
+  const double total_items = static_cast<double>(iterations) * static_cast<double>(items_per_iteration);
+  fmt::print("{:<44} {:>10.3f} ms {:>12.2f} ns/item {:>10.2f} Mitems/s\n", name, seconds * 1000.0,
+             (seconds / total_items) * 1e9, (total_items / seconds) / 1e6);
+  std::fflush(stdout);
+}
+
+static void SetupGTERegisters()
+{
+  GTE::Initialize();
+
+  // identity-ish rotation matrix in 1.3.12 fixed point, plausible translation/projection values
+  GTE::WriteRegister(32, 0x00000FFF); // RT11/RT12
+  GTE::WriteRegister(33, 0x00000000); // RT13/RT21
+  GTE::WriteRegister(34, 0x0FFF0000); // RT22/RT23
+  GTE::WriteRegister(35, 0x00000000); // RT31/RT32
+  GTE::WriteRegister(36, 0x00000FFF); // RT33
+  GTE::WriteRegister(37, 0);          // TRX
+  GTE::WriteRegister(38, 0);          // TRY
+  GTE::WriteRegister(39, 0x00000400); // TRZ
+  GTE::WriteRegister(56, 0);          // OFX
+  GTE::WriteRegister(57, 0);          // OFY
+  GTE::WriteRegister(58, 0x00000100); // H
+  GTE::WriteRegister(59, 0x00000100); // DQA
+  GTE::WriteRegister(60, 0x00000400); // DQB
+  GTE::WriteRegister(61, 0x00000155); // ZSF3
+  GTE::WriteRegister(62, 0x00000100); // ZSF4
+}
+
+static void BenchmarkGTE()
+{
+  static constexpr u32 ITERATIONS = 20000;
+  static constexpr u32 VERTICES_PER_ITERATION = 32;
+
+  SetupGTERegisters();
+
+  // synthetic mesh; one XY/Z pair per vertex, bounded so RTPT doesn't saturate everything
+  std::vector<u32> vertices;
+  vertices.reserve(VERTICES_PER_ITERATION * 2);
+  for (u32 i = 0; i < VERTICES_PER_ITERATION; i++)
+  {
+    vertices.push_back(RandomU32() & 0x03FF03FFu);
+    vertices.push_back((RandomU32() & 0x03FFu) + 0x100u);
+  }
+
+  RunBenchmark("GTE_RTPT_NCLIP_AVSZ3", ITERATIONS, VERTICES_PER_ITERATION, [&vertices]() {
+    for (u32 i = 0; i < VERTICES_PER_ITERATION; i += 3)
+    {
+      for (u32 j = 0; j < 3; j++)
+      {
+        const u32 vi = ((i + j) % VERTICES_PER_ITERATION) * 2;
+        GTE::WriteRegister(j * 2 + 0, vertices[vi]);     // VXYn
+        GTE::WriteRegister(j * 2 + 1, vertices[vi + 1]); // VZn
+      }
+
+      GTE::ExecuteInstruction(0x00280030u); // RTPT sf=1
+      GTE::ExecuteInstruction(0x01400006u); // NCLIP
+      GTE::ExecuteInstruction(0x0158002Du); // AVSZ3
+    }
+  });
+
+  RunBenchmark("GTE_MVMVA", ITERATIONS, VERTICES_PER_ITERATION, [&vertices]() {
+    for (u32 i = 0; i < VERTICES_PER_ITERATION; i++)
+    {
+      GTE::WriteRegister(0, vertices[(i % VERTICES_PER_ITERATION) * 2]);
+      GTE::ExecuteInstruction(0x00480012u); // MVMVA sf=1 rotation*V0+TR
+    }
+  });
+
+  RunBenchmark("GTE_NCDS", ITERATIONS, VERTICES_PER_ITERATION, [&vertices]() {
+    for (u32 i = 0; i < VERTICES_PER_ITERATION; i++)
+    {
+      GTE::WriteRegister(0, vertices[(i % VERTICES_PER_ITERATION) * 2]);
+      GTE::ExecuteInstruction(0x00E30413u); // NCDS
+    }
+  });
+}
+
+static void FillBackendVRAM(GPUBackend* backend)
+{
+  u16* vram = backend->GetVRAM();
+  for (u32 i = 0; i < VRAM_WIDTH * VRAM_HEIGHT; i++)
+    vram[i] = Truncate16(RandomU32());
+}
+
+static void SetBackendDrawingArea(GPUBackend* backend, u32 left, u32 top, u32 right, u32 bottom)
+{
+  GPUBackendSetDrawingAreaCommand* cmd = backend->NewSetDrawingAreaCommand();
+  cmd->params.bits = 0;
+  cmd->new_area.Set(left, top, right, bottom);
+  backend->PushCommand(cmd);
+}
+
+static void DrawBenchmarkTriangle(GPUBackend* backend, bool shading, bool texture, bool raw_texture, bool transparency,
+                                  bool dither)
+{
+  GPUBackendDrawPolygonCommand* cmd = backend->NewDrawPolygonCommand(3);
+  cmd->params.bits = 0;
+  cmd->num_vertices = 3;
+
+  cmd->rc.bits = 0;
+  cmd->rc.primitive = GPUPrimitive::Polygon;
+  cmd->rc.shading_enable = shading;
+  cmd->rc.texture_enable = texture;
+  cmd->rc.raw_texture_enable = raw_texture;
+  cmd->rc.transparency_enable = transparency;
+
+  cmd->draw_mode.bits = 0;
+  cmd->draw_mode.texture_mode = GPUTextureMode::Direct16Bit;
+  cmd->draw_mode.transparency_mode =
+    transparency ? GPUTransparencyMode::HalfBackgroundPlusHalfForeground : GPUTransparencyMode::Disabled;
+  cmd->draw_mode.dither_enable = dither;
+
+  cmd->palette.bits = 0;
+  cmd->window = {0xFFu, 0xFFu, 0u, 0u};
+
+  cmd->vertices[0].Set(32, 16, 0x000000FFu, 0x0000u);
+  cmd->vertices[1].Set(224, 48, 0x0000FF00u, 0x00C0u);
+  cmd->vertices[2].Set(128, 200, 0x00FF0000u, 0xC060u);
+
+  backend->PushCommand(cmd);
+}
+
+static void BenchmarkSWRasterizer()
+{
+  static constexpr u32 ITERATIONS = 2000;
+  static constexpr u32 TRIANGLES_PER_ITERATION = 16;
+
+  // single-threaded submission; the backend's own raster worker threads still participate,
+  // the same as they would in-game.
+  g_settings.gpu_use_thread = false;
+
+  GPU_SW_Backend backend;
+  if (!backend.Initialize(false))
+  {
+    fmt::print("Failed to initialize software backend, skipping rasterizer benchmarks.\n");
+    return;
+  }
+
+  FillBackendVRAM(&backend);
+  SetBackendDrawingArea(&backend, 0, 0, 639, 479);
+
+  struct Variant
+  {
+    const char* name;
+    bool shading, texture, raw_texture, transparency, dither;
+  };
+  static constexpr Variant variants[] = {
+    {"SWRasterizer_Flat", false, false, false, false, false},
+    {"SWRasterizer_Shaded", true, false, false, false, false},
+    {"SWRasterizer_TexturedRaw", false, true, true, false, false},
+    {"SWRasterizer_ShadedTexturedDithered", true, true, false, false, true},
+    {"SWRasterizer_FlatTransparent", false, false, false, true, false},
+  };
+
+  for (const Variant& v : variants)
+  {
+    RunBenchmark(v.name, ITERATIONS, TRIANGLES_PER_ITERATION, [&backend, &v]() {
+      for (u32 i = 0; i < TRIANGLES_PER_ITERATION; i++)
+        DrawBenchmarkTriangle(&backend, v.shading, v.texture, v.raw_texture, v.transparency, v.dither);
+    });
+  }
+
+  backend.Shutdown();
+}
+
+static void BenchmarkFIFOQueue()
+{
+  static constexpr u32 ITERATIONS = 5000;
+  static constexpr u32 CAPACITY = 4096;
+
+  static InlineFIFOQueue<u32, CAPACITY> queue;
+
+  std::vector<u32> data(CAPACITY);
+  for (u32& v : data)
+    v = RandomU32();
+
+  RunBenchmark("FIFOQueue_PushPop", ITERATIONS, CAPACITY, [&data]() {
+    for (u32 i = 0; i < CAPACITY; i++)
+      queue.Push(data[i]);
+    u32 sum = 0;
+    while (!queue.IsEmpty())
+      sum += queue.Pop();
+
+    // keep the loop from being optimized away
+    static volatile u32 s_sink;
+    s_sink = sum;
+  });
+
+  std::vector<u32> out(CAPACITY);
+  RunBenchmark("FIFOQueue_PushRangePopRange", ITERATIONS, CAPACITY, [&data, &out]() {
+    queue.PushRange(data.data(), CAPACITY);
+    queue.PopRange(out.data(), CAPACITY);
+  });
+}
+
+static void BenchmarkStateWrapper()
+{
+  static constexpr u32 ITERATIONS = 2000;
+  static constexpr u32 BUFFER_SIZE = 256 * 1024;
+
+  std::vector<u8> bytes(BUFFER_SIZE);
+  for (u8& v : bytes)
+    v = Truncate8(RandomU32());
+  std::vector<u32> words(BUFFER_SIZE / sizeof(u32));
+  for (u32& v : words)
+    v = RandomU32();
+
+  std::unique_ptr<ByteStream> stream = ByteStream::CreateGrowableMemoryStream(nullptr, BUFFER_SIZE * 2);
+
+  RunBenchmark("StateWrapper_Write", ITERATIONS, BUFFER_SIZE * 2, [&]() {
+    stream->SeekAbsolute(0);
+    StateWrapper sw(stream.get(), StateWrapper::Mode::Write, 1);
+    sw.DoBytes(bytes.data(), bytes.size());
+    sw.DoArray(words.data(), static_cast<u32>(words.size()));
+  });
+
+  RunBenchmark("StateWrapper_Read", ITERATIONS, BUFFER_SIZE * 2, [&]() {
+    stream->SeekAbsolute(0);
+    StateWrapper sw(stream.get(), StateWrapper::Mode::Read, 1);
+    sw.DoBytes(bytes.data(), bytes.size());
+    sw.DoArray(words.data(), static_cast<u32>(words.size()));
+  });
+}
+
+} // namespace CoreBenchmarks
+
+int main(int argc, char* argv[])
+{
+  Log::SetConsoleOutputParams(true);
+  Log::SetLogLevel(LOGLEVEL_ERROR);
+
+  fmt::print("{:<44} {:>13} {:>20} {:>18}\n", "Benchmark", "Total", "Time/Item", "Throughput");
+
+  CoreBenchmarks::BenchmarkGTE();
+  CoreBenchmarks::BenchmarkSWRasterizer();
+  CoreBenchmarks::BenchmarkFIFOQueue();
+  CoreBenchmarks::BenchmarkStateWrapper();
+
+  return 0;
+}
@@ -26,6 +26,7 @@
 #include "common/scoped_guard.h"
 #include "common/small_string.h"
 #include "common/string_util.h"
+#include "common/thread_pool.h"
 
 #include "util/cd_image.h"
 #include "util/http_downloader.h"
@@ -43,11 +44,14 @@
 
 #include <algorithm>
 #include <atomic>
+#include <condition_variable>
 #include <cstdarg>
 #include <cstdlib>
 #include <ctime>
+#include <deque>
 #include <functional>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 Log_SetChannel(Achievements);
@@ -68,6 +72,12 @@ static constexpr const char* LBSUBMIT_SOUND_NAME = "sounds/achievements/lbsubmit
 static constexpr u32 LEADERBOARD_NEARBY_ENTRIES_TO_FETCH = 10;
 static constexpr u32 LEADERBOARD_ALL_FETCH_SIZE = 20;
 
+// Cached media older than the refresh age is still served immediately, but a background
+// re-download is kicked off, and the texture cache invalidated when it lands. The image
+// directory is pruned oldest-first once it grows past the size limit.
+static constexpr s64 IMAGE_CACHE_REFRESH_AGE = 30 * 24 * 60 * 60;
+static constexpr u64 IMAGE_CACHE_SIZE_LIMIT = 64 * 1024 * 1024;
+
 static constexpr float LOGIN_NOTIFICATION_TIME = 5.0f;
 static constexpr float ACHIEVEMENT_SUMMARY_NOTIFICATION_TIME = 5.0f;
 static constexpr float GAME_COMPLETE_NOTIFICATION_TIME = 20.0f;
@@ -114,6 +124,24 @@ struct AchievementProgressIndicator
   Common::Timer show_hide_time;
   bool active;
 };
+
+// Event raised by rc_client during asynchronous frame evaluation, captured for replay on the
+// emulation thread. Achievement/leaderboard pointers are stable while the game is loaded, the
+// tracker/scoreboard/server error payloads are transient and copied.
+struct DeferredClientEvent
+{
+  u32 type;
+  rc_client_achievement_t* achievement;
+  rc_client_leaderboard_t* leaderboard;
+  rc_client_leaderboard_tracker_t tracker;
+  rc_client_leaderboard_scoreboard_t scoreboard;
+  std::vector<rc_client_leaderboard_scoreboard_entry_t> scoreboard_entries;
+  std::deque<std::string> strings;
+  rc_client_server_error_t server_error;
+  bool has_tracker = false;
+  bool has_scoreboard = false;
+  bool has_server_error = false;
+};
 } // namespace
 
 static void ReportError(const std::string_view& sv);
@@ -133,6 +161,8 @@ static void IdentifyGame(const std::string& path, CDImage* image);
 static void BeginLoadGame();
 static void UpdateGameSummary();
 static void DownloadImage(std::string url, std::string cache_filename);
+static bool ShouldRefreshImage(const char* path);
+static void PruneImageCache();
 
 static bool CreateClient(rc_client_t** client, std::unique_ptr<HTTPDownloader>* http);
 static void DestroyClient(rc_client_t** client, std::unique_ptr<HTTPDownloader>* http);
@@ -141,6 +171,13 @@ static uint32_t ClientReadMemory(uint32_t address, uint8_t* buffer, uint32_t num
 static void ClientServerCall(const rc_api_request_t* request, rc_client_server_callback_t callback, void* callback_data,
                              rc_client_t* client);
 
+static bool ReadSnapshotMemory(u32 address, u8* buffer, u32 num_bytes);
+static void WaitForAsyncFrameEvaluation();
+static void QueueAsyncFrameEvaluation();
+static void AsyncFrameEvaluationTask();
+static void DeferClientEvent(const rc_client_event_t* event);
+static void DispatchDeferredClientEvents();
+
 static void ClientEventHandler(const rc_client_event_t* event, rc_client_t* client);
 static void HandleResetEvent(const rc_client_event_t* event);
 static void HandleUnlockEvent(const rc_client_event_t* event);
@@ -212,6 +249,7 @@ static rc_client_async_handle_t* s_load_game_request;
 static rc_client_achievement_list_t* s_achievement_list;
 static rc_client_leaderboard_list_t* s_leaderboard_list;
 static std::vector<std::pair<const void*, std::string>> s_achievement_badge_paths;
+static std::unordered_set<std::string> s_requested_images;
 static const rc_client_leaderboard_t* s_open_leaderboard = nullptr;
 static rc_client_async_handle_t* s_leaderboard_fetch_handle = nullptr;
 static std::vector<rc_client_leaderboard_entry_list_t*> s_leaderboard_entry_lists;
@@ -222,6 +260,16 @@ static bool s_is_showing_all_leaderboard_entries = false;
 static std::vector<LeaderboardTrackerIndicator> s_active_leaderboard_trackers;
 static std::vector<AchievementChallengeIndicator> s_active_challenge_indicators;
 static std::optional<AchievementProgressIndicator> s_active_progress_indicator;
+
+// Asynchronous frame evaluation. The emulation thread snapshots RAM/scratchpad each frame and
+// hands rc_client_do_frame() to the thread pool, so trigger evaluation stops showing in frame
+// time. Events raised during evaluation are deferred and replayed on the emulation thread.
+static std::vector<u8> s_ram_snapshot;
+static std::vector<DeferredClientEvent> s_deferred_events;
+static std::mutex s_frame_eval_mutex;
+static std::condition_variable s_frame_eval_cv;
+static bool s_frame_eval_in_flight = false;
+static bool s_frame_eval_uses_snapshot = false; // guarded by the achievements lock
 } // namespace Achievements
 
 std::unique_lock<std::recursive_mutex> Achievements::GetLock()
@@ -304,6 +352,10 @@ std::string Achievements::GetGameHash(CDImage* image)
 
 void Achievements::DownloadImage(std::string url, std::string cache_filename)
 {
+  // One request per file per session; the stale copy keeps being served until the refresh lands.
+  if (!s_requested_images.emplace(cache_filename).second)
+    return;
+
   auto callback = [cache_filename](s32 status_code, const std::string& content_type,
                                    HTTPDownloader::Request::Data data) {
     if (status_code != HTTPDownloader::HTTP_STATUS_OK)
@@ -321,6 +373,43 @@ void Achievements::DownloadImage(std::string url, std::string cache_filename)
   s_http_downloader->CreateRequest(std::move(url), std::move(callback));
 }
 
+bool Achievements::ShouldRefreshImage(const char* path)
+{
+  FILESYSTEM_STAT_DATA sd;
+  if (!FileSystem::StatFile(path, &sd))
+    return true;
+
+  return ((std::time(nullptr) - sd.ModificationTime) >= IMAGE_CACHE_REFRESH_AGE);
+}
+
+void Achievements::PruneImageCache()
+{
+  FileSystem::FindResultsArray files;
+  if (!FileSystem::FindFiles(s_image_directory.c_str(), "*.png", FILESYSTEM_FIND_FILES, &files))
+    return;
+
+  u64 total_size = 0;
+  for (const FILESYSTEM_FIND_DATA& fd : files)
+    total_size += static_cast<u64>(fd.Size);
+  if (total_size <= IMAGE_CACHE_SIZE_LIMIT)
+    return;
+
+  Log_InfoFmt("Media cache is {} bytes, pruning to {} bytes", total_size, IMAGE_CACHE_SIZE_LIMIT);
+
+  // Drop the least recently refreshed files until we're back under the cap.
+  std::sort(files.begin(), files.end(), [](const FILESYSTEM_FIND_DATA& lhs, const FILESYSTEM_FIND_DATA& rhs) {
+    return lhs.ModificationTime < rhs.ModificationTime;
+  });
+  for (const FILESYSTEM_FIND_DATA& fd : files)
+  {
+    if (total_size <= IMAGE_CACHE_SIZE_LIMIT)
+      break;
+
+    if (FileSystem::DeleteFile(fd.FileName.c_str()))
+      total_size -= static_cast<u64>(fd.Size);
+  }
+}
+
 bool Achievements::IsActive()
 {
 #ifdef ENABLE_RAINTEGRATION
@@ -469,6 +558,9 @@ void Achievements::DestroyClient(rc_client_t** client, std::unique_ptr<HTTPDownl
   *client = nullptr;
 
   http->reset();
+
+  // Allow failed downloads to be retried on the next login.
+  s_requested_images.clear();
 }
 
 void Achievements::UpdateSettings(const Settings& old_config)
@@ -581,6 +673,8 @@ void Achievements::EnsureCacheDirectoriesExist()
   {
     ReportFmtError("Failed to create cache directory '{}'", s_image_directory);
   }
+
+  PruneImageCache();
 }
 
 void Achievements::ClientMessageCallback(const char* message, const rc_client_t* client)
@@ -588,8 +682,34 @@ void Achievements::ClientMessageCallback(const char* message, const rc_client_t*
   Log_DevPrint(message);
 }
 
+bool Achievements::ReadSnapshotMemory(u32 address, u8* buffer, u32 num_bytes)
+{
+  const u32 phys = address & CPU::PHYSICAL_MEMORY_ADDRESS_MASK;
+  if (phys < Bus::RAM_MIRROR_END)
+  {
+    const u32 offset = phys & Bus::g_ram_mask;
+    if ((offset + num_bytes) > Bus::g_ram_size)
+      return false;
+
+    std::memcpy(buffer, &s_ram_snapshot[offset], num_bytes);
+    return true;
+  }
+  else if (phys >= CPU::SCRATCHPAD_ADDR && (phys + num_bytes) <= (CPU::SCRATCHPAD_ADDR + CPU::SCRATCHPAD_SIZE))
+  {
+    std::memcpy(buffer, &s_ram_snapshot[Bus::g_ram_size + (phys - CPU::SCRATCHPAD_ADDR)], num_bytes);
+    return true;
+  }
+
+  return false;
+}
+
 uint32_t Achievements::ClientReadMemory(uint32_t address, uint8_t* buffer, uint32_t num_bytes, rc_client_t* client)
 {
+  // Asynchronous evaluation reads from the RAM snapshot taken at the end of the frame, the
+  // emulation thread has moved on by the time the worker gets here.
+  if (s_frame_eval_uses_snapshot)
+    return ReadSnapshotMemory(address, buffer, num_bytes) ? num_bytes : 0;
+
   switch (num_bytes)
   {
     case 1:
@@ -681,16 +801,136 @@ void Achievements::FrameUpdate()
   }
 #endif
 
+  // Finish the previous frame's evaluation before taking the lock, the worker needs it.
+  WaitForAsyncFrameEvaluation();
+
   auto lock = GetLock();
 
   s_http_downloader->PollRequests();
-  rc_client_do_frame(s_client);
+  DispatchDeferredClientEvents();
+
+  // Only sets with something to evaluate are worth the snapshot, otherwise do_frame() is just
+  // servicing scheduled callbacks and can run inline.
+  if (s_has_achievements || s_has_leaderboards || s_has_rich_presence)
+    QueueAsyncFrameEvaluation();
+  else
+    rc_client_do_frame(s_client);
 
   UpdateRichPresence(lock);
 }
 
+void Achievements::WaitForAsyncFrameEvaluation()
+{
+  std::unique_lock lock(s_frame_eval_mutex);
+  s_frame_eval_cv.wait(lock, []() { return !s_frame_eval_in_flight; });
+}
+
+void Achievements::QueueAsyncFrameEvaluation()
+{
+  const u32 snapshot_size = Bus::g_ram_size + CPU::SCRATCHPAD_SIZE;
+  if (s_ram_snapshot.size() != snapshot_size)
+    s_ram_snapshot.resize(snapshot_size);
+  std::memcpy(s_ram_snapshot.data(), Bus::g_ram, Bus::g_ram_size);
+  std::memcpy(&s_ram_snapshot[Bus::g_ram_size], CPU::g_state.scratchpad.data(), CPU::SCRATCHPAD_SIZE);
+
+  {
+    std::unique_lock lock(s_frame_eval_mutex);
+    s_frame_eval_in_flight = true;
+  }
+
+  Threading::ThreadPool::GetInstance().QueueTask(&Achievements::AsyncFrameEvaluationTask,
+                                                 Threading::ThreadPool::Priority::High);
+}
+
+void Achievements::AsyncFrameEvaluationTask()
+{
+  {
+    const auto lock = GetLock();
+
+    // The client can be torn down between queueing and running, in which case there is nothing
+    // left to evaluate.
+    if (s_client)
+    {
+      s_frame_eval_uses_snapshot = true;
+      rc_client_do_frame(s_client);
+      s_frame_eval_uses_snapshot = false;
+    }
+  }
+
+  {
+    std::unique_lock lock(s_frame_eval_mutex);
+    s_frame_eval_in_flight = false;
+  }
+  s_frame_eval_cv.notify_all();
+}
+
+void Achievements::DeferClientEvent(const rc_client_event_t* event)
+{
+  DeferredClientEvent& deferred = s_deferred_events.emplace_back();
+  deferred.type = event->type;
+  deferred.achievement = event->achievement;
+  deferred.leaderboard = event->leaderboard;
+
+  if (event->leaderboard_tracker)
+  {
+    deferred.tracker = *event->leaderboard_tracker;
+    deferred.has_tracker = true;
+  }
+
+  if (event->leaderboard_scoreboard)
+  {
+    deferred.scoreboard = *event->leaderboard_scoreboard;
+    deferred.scoreboard_entries.assign(event->leaderboard_scoreboard->top_entries,
+                                       event->leaderboard_scoreboard->top_entries +
+                                         event->leaderboard_scoreboard->num_top_entries);
+    for (rc_client_leaderboard_scoreboard_entry_t& entry : deferred.scoreboard_entries)
+      entry.username = deferred.strings.emplace_back(entry.username ? entry.username : "").c_str();
+    deferred.scoreboard.top_entries = deferred.scoreboard_entries.data();
+    deferred.has_scoreboard = true;
+  }
+
+  if (event->server_error)
+  {
+    deferred.server_error = *event->server_error;
+    if (event->server_error->error_message)
+      deferred.server_error.error_message = deferred.strings.emplace_back(event->server_error->error_message).c_str();
+    if (event->server_error->api)
+      deferred.server_error.api = deferred.strings.emplace_back(event->server_error->api).c_str();
+    deferred.has_server_error = true;
+  }
+}
+
+void Achievements::DispatchDeferredClientEvents()
+{
+  for (DeferredClientEvent& deferred : s_deferred_events)
+  {
+    rc_client_event_t event = {};
+    event.type = deferred.type;
+    event.achievement = deferred.achievement;
+    event.leaderboard = deferred.leaderboard;
+    if (deferred.has_tracker)
+      event.leaderboard_tracker = &deferred.tracker;
+    if (deferred.has_scoreboard)
+      event.leaderboard_scoreboard = &deferred.scoreboard;
+    if (deferred.has_server_error)
+      event.server_error = &deferred.server_error;
+
+    ClientEventHandler(&event, s_client);
+  }
+  s_deferred_events.clear();
+}
+
 void Achievements::ClientEventHandler(const rc_client_event_t* event, rc_client_t* client)
 {
+  // Events raised during asynchronous evaluation are replayed on the emulation thread at the
+  // start of the next frame, several handlers reach back into System/Host and expect to run
+  // there.
+  if (s_frame_eval_uses_snapshot)
+  {
+    DeferClientEvent(event);
+    return;
+  }
+
   switch (event->type)
   {
     case RC_CLIENT_EVENT_RESET:
@@ -941,7 +1181,7 @@ void Achievements::ClientLoadGameCallback(int result, const char* error_message,
   if (const std::string_view badge_name = info->badge_name; !badge_name.empty())
   {
     s_game_icon = Path::Combine(s_image_directory, fmt::format("game_{}.png", info->id));
-    if (!FileSystem::FileExists(s_game_icon.c_str()))
+    if (ShouldRefreshImage(s_game_icon.c_str()))
     {
       char buf[512];
       if (int err = rc_client_game_get_image_url(info, buf, std::size(buf)); err == RC_OK)
@@ -972,6 +1212,9 @@ void Achievements::ClearGameInfo()
   }
   rc_client_unload_game(s_client);
 
+  // Deferred events hold pointers into the unloaded game data.
+  s_deferred_events.clear();
+
   s_active_leaderboard_trackers = {};
   s_active_challenge_indicators = {};
   s_active_progress_indicator.reset();
@@ -1545,7 +1788,7 @@ std::string Achievements::GetAchievementBadgePath(const rc_client_achievement_t*
   path = Path::Combine(s_image_directory, TinyString::from_fmt("achievement_{}_{}_{}.png", s_game_id, achievement->id,
                                                                s_achievement_state_strings[state]));
 
-  if (download_if_missing && !FileSystem::FileExists(path.c_str()))
+  if (download_if_missing && ShouldRefreshImage(path.c_str()))
   {
     char buf[512];
     const int res = rc_client_achievement_get_image_url(achievement, state, buf, std::size(buf));
@@ -1573,7 +1816,7 @@ std::string Achievements::GetLeaderboardUserBadgePath(const rc_client_leaderboar
   // TODO: maybe we should just cache these in memory...
   std::string path = GetUserBadgePath(entry->user);
 
-  if (!FileSystem::FileExists(path.c_str()))
+  if (ShouldRefreshImage(path.c_str()))
   {
     char buf[512];
     const int res = rc_client_leaderboard_entry_get_user_image_url(entry, buf, std::size(buf));
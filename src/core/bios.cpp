@@ -11,8 +11,26 @@
 #include "host.h"
 #include "settings.h"
 #include <cerrno>
+#include <map>
+#include <mutex>
 Log_SetChannel(BIOS);
 
+namespace BIOS {
+namespace {
+struct CachedImage
+{
+  Image data;
+  std::time_t modification_time;
+};
+} // namespace
+} // namespace BIOS
+
+// Per-process image cache. Deployments that restart the same game continuously boot hundreds of
+// times a day, and re-reading (and, during auto-detection, re-scanning) the BIOS directory sits
+// on the boot critical path. Guarded because the settings UI loads images off the CPU thread.
+static std::mutex s_image_cache_mutex;
+static std::map<std::string, BIOS::CachedImage> s_image_cache;
+
 static constexpr BIOS::Hash MakeHashFromString(const char str[])
 {
   BIOS::Hash h{};
@@ -106,6 +124,17 @@ BIOS::Hash BIOS::GetImageHash(const BIOS::Image& image)
 
 std::optional<BIOS::Image> BIOS::LoadImageFromFile(const char* filename)
 {
+  // Serve repeat loads from the cache, as long as the file hasn't been replaced on disk.
+  FILESYSTEM_STAT_DATA sd;
+  const bool have_stat = FileSystem::StatFile(filename, &sd);
+  if (have_stat)
+  {
+    std::unique_lock lock(s_image_cache_mutex);
+    const auto it = s_image_cache.find(filename);
+    if (it != s_image_cache.end() && it->second.modification_time == sd.ModificationTime)
+      return it->second.data;
+  }
+
   Image ret(BIOS_SIZE);
   auto fp = FileSystem::OpenManagedCFile(filename, "rb");
   if (!fp)
@@ -134,6 +163,13 @@ std::optional<BIOS::Image> BIOS::LoadImageFromFile(const char* filename)
   Log_DevPrint(
     fmt::format("Hash for BIOS '{}': {}", FileSystem::GetDisplayNameFromPath(filename), GetImageHash(ret).ToString())
       .c_str());
+
+  if (have_stat)
+  {
+    std::unique_lock lock(s_image_cache_mutex);
+    s_image_cache[filename] = CachedImage{ret, sd.ModificationTime};
+  }
+
   return ret;
 }
 
@@ -106,6 +106,7 @@ union MEMCTRL
 static void* s_shmem_handle = nullptr;
 
 std::bitset<RAM_8MB_CODE_PAGE_COUNT> g_ram_code_bits{};
+std::bitset<RAM_8MB_CODE_PAGE_COUNT> g_ram_dirty_bits{};
 u8* g_ram = nullptr;
 u8* g_unprotected_ram = nullptr;
 u32 g_ram_size = 0;
@@ -134,6 +135,8 @@ static SharedMemoryMappingArea s_fastmem_arena;
 static std::vector<std::pair<u8*, size_t>> s_fastmem_ram_views;
 #endif
 
+static bool s_snapshot_tracking_active = false;
+
 static u8** s_fastmem_lut = nullptr;
 
 static void SetRAMSize(bool enable_8mb_ram);
@@ -144,6 +147,7 @@ static void RecalculateMemoryTimings();
 static u8* GetLUTFastmemPointer(u32 address, u8* ram_ptr);
 
 static void SetRAMPageWritable(u32 page_index, bool writable);
+static void SetAllRAMPagesWritable(bool writable);
 
 static void SetHandlers();
 
@@ -195,6 +199,15 @@ bool Bus::AllocateMemory()
 
   Log_VerboseFmt("RAM is mapped at {}.", static_cast<void*>(g_ram));
 
+  // Read from the base settings because the settings struct hasn't been loaded at this point.
+  if (Host::GetBaseBoolSettingValue("Main", "EnableHugePages", false))
+  {
+    if (MemMap::EnableHugePages(g_ram, MemoryMap::RAM_SIZE))
+      Log_InfoPrint("Huge pages enabled for RAM.");
+
+    MemMap::EnableHugePages(g_unprotected_ram, MemoryMap::RAM_SIZE);
+  }
+
   g_bios = static_cast<u8*>(MemMap::MapSharedMemory(s_shmem_handle, MemoryMap::BIOS_OFFSET, nullptr,
                                                     MemoryMap::BIOS_SIZE, PageProtect::ReadWrite));
   if (!g_bios)
@@ -365,7 +378,7 @@ void Bus::AddTTYString(const std::string_view& str)
     AddTTYCharacter(ch);
 }
 
-bool Bus::DoState(StateWrapper& sw)
+bool Bus::DoState(StateWrapper& sw, bool skip_ram /* = false */)
 {
   u32 ram_size = g_ram_size;
   sw.DoEx(&ram_size, 52, static_cast<u32>(RAM_2MB_SIZE));
@@ -382,7 +395,8 @@ bool Bus::DoState(StateWrapper& sw)
   sw.Do(&g_bios_access_time);
   sw.Do(&g_cdrom_access_time);
   sw.Do(&g_spu_access_time);
-  sw.DoBytes(g_ram, g_ram_size);
+  if (!skip_ram)
+    sw.DoBytes(g_ram, g_ram_size);
 
   if (sw.GetVersion() < 58)
   {
@@ -522,14 +536,15 @@ void Bus::UpdateFastmemViews(CPUFastmemMode mode)
       s_fastmem_ram_views.emplace_back(map_address, g_ram_size);
     };
 
-    // KUSEG - cached
-    MapRAM(0x00000000);
-
-    // KSEG0 - cached
-    MapRAM(0x80000000);
-
-    // KSEG1 - uncached
-    MapRAM(0xA0000000);
+    // Map RAM and all of its mirrors in each segment as aliased views of the same shared
+    // memory, so mirrored accesses take the direct path as well. With 2MB of RAM that is
+    // four views per segment; with the 8MB dev-console option a single view covers the
+    // whole mirror region.
+    for (u32 segment_base : {UINT32_C(0x00000000), UINT32_C(0x80000000), UINT32_C(0xA0000000)})
+    {
+      for (u32 mirror_offset = 0; mirror_offset < RAM_MIRROR_END; mirror_offset += g_ram_size)
+        MapRAM(segment_base + mirror_offset);
+    }
 
     return;
   }
@@ -574,6 +589,19 @@ void Bus::UpdateFastmemViews(CPUFastmemMode mode)
   MapRAM(0xA0200000);
   MapRAM(0xA0400000);
   MapRAM(0xA0600000);
+
+  // Scratchpad gets a direct view as well; the backing storage is padded out to a full LUT page, so
+  // stray accesses to the rest of the 4K region land in the padding rather than faulting into other
+  // state. The isolated-cache LUT keeps the slow path, same as RAM.
+  static_assert(static_cast<u32>(CPU::SCRATCHPAD_PAGE_SIZE) == static_cast<u32>(FASTMEM_LUT_PAGE_SIZE));
+  auto MapScratchpad = [](u32 base_address) {
+    s_fastmem_lut[base_address >> FASTMEM_LUT_PAGE_SHIFT] =
+      GetLUTFastmemPointer(base_address, CPU::g_state.scratchpad.data());
+  };
+
+  MapScratchpad(CPU::SCRATCHPAD_ADDR);
+  MapScratchpad(UINT32_C(0x80000000) | CPU::SCRATCHPAD_ADDR);
+  MapScratchpad(UINT32_C(0xA0000000) | CPU::SCRATCHPAD_ADDR);
 }
 
 bool Bus::CanUseFastmemForAddress(VirtualMemoryAddress address)
@@ -585,14 +613,14 @@ bool Bus::CanUseFastmemForAddress(VirtualMemoryAddress address)
 #ifdef ENABLE_MMAP_FASTMEM
     case CPUFastmemMode::MMap:
     {
-      // Currently since we don't map the mirrors, don't use fastmem for them.
-      // This is because the swapping of page code bits for SMC is too expensive.
-      return (paddr < g_ram_size);
+      // All RAM mirrors are mapped as aliased views, and SMC protection covers the page
+      // in every view, so the whole mirror region can go through fastmem.
+      return (paddr < RAM_MIRROR_END);
     }
 #endif
 
     case CPUFastmemMode::LUT:
-      return (paddr < RAM_MIRROR_END);
+      return (paddr < RAM_MIRROR_END || (paddr & ~MEMORY_LUT_PAGE_MASK) == CPU::SCRATCHPAD_ADDR);
 
     case CPUFastmemMode::Disabled:
     default:
@@ -656,28 +684,108 @@ void Bus::SetRAMPageWritable(u32 page_index, bool writable)
 #endif
 }
 
-void Bus::ClearRAMCodePageFlags()
+void Bus::SetAllRAMPagesWritable(bool writable)
 {
-  g_ram_code_bits.reset();
+  const PageProtect protect = writable ? PageProtect::ReadWrite : PageProtect::ReadOnly;
 
-  if (!MemMap::MemProtect(g_ram, RAM_8MB_SIZE, PageProtect::ReadWrite))
-    Log_ErrorPrint("Failed to restore RAM protection to read-write.");
+  if (!MemMap::MemProtect(g_ram, RAM_8MB_SIZE, protect))
+    Log_ErrorPrintf("Failed to set RAM protection to %s.", writable ? "read-write" : "read-only");
 
 #ifdef ENABLE_MMAP_FASTMEM
   if (s_fastmem_mode == CPUFastmemMode::MMap)
   {
-    // unprotect fastmem pages
     for (const auto& it : s_fastmem_ram_views)
     {
-      if (!MemMap::MemProtect(it.first, it.second, PageProtect::ReadWrite))
+      if (!MemMap::MemProtect(it.first, it.second, protect))
       {
-        Log_ErrorPrintf("Failed to unprotect code pages for fastmem view @ %p", it.first);
+        Log_ErrorPrintf("Failed to %s fastmem view @ %p", writable ? "unprotect" : "protect", it.first);
       }
     }
   }
 #endif
 }
 
+void Bus::ClearRAMCodePageFlags()
+{
+  g_ram_code_bits.reset();
+
+  SetAllRAMPagesWritable(true);
+
+  // pages which snapshot tracking still considers clean have to stay protected
+  if (s_snapshot_tracking_active)
+  {
+    SetAllRAMPagesWritable(false);
+    const u32 num_pages = g_ram_size / HOST_PAGE_SIZE;
+    for (u32 i = 0; i < num_pages; i++)
+    {
+      if (g_ram_dirty_bits[i])
+        SetRAMPageWritable(i, true);
+    }
+  }
+}
+
+void Bus::StartSnapshotDirtyTracking()
+{
+  s_snapshot_tracking_active = true;
+  g_ram_dirty_bits.reset();
+  SetAllRAMPagesWritable(false);
+}
+
+void Bus::StopSnapshotDirtyTracking()
+{
+  if (!s_snapshot_tracking_active)
+    return;
+
+  s_snapshot_tracking_active = false;
+  g_ram_dirty_bits.reset();
+
+  // restore read-write, leaving code pages protected
+  SetAllRAMPagesWritable(true);
+  const u32 num_pages = g_ram_size / HOST_PAGE_SIZE;
+  for (u32 i = 0; i < num_pages; i++)
+  {
+    if (g_ram_code_bits[i])
+      SetRAMPageWritable(i, false);
+  }
+}
+
+bool Bus::IsSnapshotDirtyTrackingActive()
+{
+  return s_snapshot_tracking_active;
+}
+
+void Bus::GetAndClearSnapshotDirtyPages(std::vector<u32>* out_pages)
+{
+  const u32 num_pages = g_ram_size / HOST_PAGE_SIZE;
+  for (u32 i = 0; i < num_pages; i++)
+  {
+    if (!g_ram_dirty_bits[i])
+      continue;
+
+    g_ram_dirty_bits[i] = false;
+    out_pages->push_back(i);
+
+    // code pages are already write-protected
+    if (!g_ram_code_bits[i])
+      SetRAMPageWritable(i, false);
+  }
+}
+
+bool Bus::HandleSnapshotWriteFault(u32 page_index)
+{
+  if (!s_snapshot_tracking_active)
+    return false;
+
+  g_ram_dirty_bits[page_index] = true;
+
+  // code pages still need invalidating, which unprotects them; let the caller handle it
+  if (g_ram_code_bits[page_index])
+    return false;
+
+  SetRAMPageWritable(page_index, true);
+  return true;
+}
+
 bool Bus::IsCodePageAddress(PhysicalMemoryAddress address)
 {
   return IsRAMAddress(address) ? g_ram_code_bits[(address & g_ram_mask) / HOST_PAGE_SIZE] : false;
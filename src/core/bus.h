@@ -112,7 +112,7 @@ void ReleaseMemory();
 bool Initialize();
 void Shutdown();
 void Reset();
-bool DoState(StateWrapper& sw);
+bool DoState(StateWrapper& sw, bool skip_ram = false);
 
 using MemoryReadHandler = u32 (*)(VirtualMemoryAddress address);
 using MemoryWriteHandler = void (*)(VirtualMemoryAddress, u32);
@@ -134,6 +134,7 @@ bool CanUseFastmemForAddress(VirtualMemoryAddress address);
 void SetExpansionROM(std::vector<u8> data);
 
 extern std::bitset<RAM_8MB_CODE_PAGE_COUNT> g_ram_code_bits;
+extern std::bitset<RAM_8MB_CODE_PAGE_COUNT> g_ram_dirty_bits;
 extern u8* g_ram;             // 2MB-8MB RAM
 extern u8* g_unprotected_ram; // RAM without page protection, use for debugger access.
 extern u32 g_ram_size;        // Active size of RAM.
@@ -175,6 +176,25 @@ bool IsCodePageAddress(PhysicalMemoryAddress address);
 /// Returns true if the range specified overlaps with a code page.
 bool HasCodePagesInRange(PhysicalMemoryAddress start_address, u32 size);
 
+/// Dirty-page tracking for runahead memory snapshots. While active, RAM pages are write-protected
+/// and the first write to each page since the last snapshot is recorded in g_ram_dirty_bits.
+void StartSnapshotDirtyTracking();
+void StopSnapshotDirtyTracking();
+bool IsSnapshotDirtyTrackingActive();
+
+/// Appends pages dirtied since the last call to out_pages, and re-protects them.
+void GetAndClearSnapshotDirtyPages(std::vector<u32>* out_pages);
+
+/// Called from the page fault handler on protected RAM writes. Returns true if the fault was due
+/// to snapshot tracking alone; code pages still need invalidating by the caller.
+bool HandleSnapshotWriteFault(u32 page_index);
+
+/// Flags a RAM page as dirty for writes which bypass page protection (debugger/cheats).
+ALWAYS_INLINE static void AddSnapshotDirtyPage(u32 page_index)
+{
+  g_ram_dirty_bits[page_index] = true;
+}
+
 /// Returns the number of cycles stolen by DMA RAM access.
 ALWAYS_INLINE TickCount GetDMARAMTickCount(u32 word_count)
 {
@@ -24,11 +24,15 @@
 #include "common/heap_array.h"
 #include "common/intrin.h"
 #include "common/log.h"
+#include "common/progress_callback.h"
+#include "common/threading.h"
 
 #include "imgui.h"
 
+#include <cinttypes>
 #include <cmath>
 #include <map>
+#include <thread>
 #include <vector>
 
 Log_SetChannel(CDROM);
@@ -243,6 +247,8 @@ static void UpdateStatusRegister();
 static void UpdateInterruptRequest();
 static bool HasPendingDiscEvent();
 
+static void StopPrecacheThread();
+
 static TickCount GetAckDelayForCommand(Command command);
 static TickCount GetTicksForSpinUp();
 static TickCount GetTicksForIDRead();
@@ -373,6 +379,9 @@ static std::array<SectorBuffer, NUM_SECTOR_BUFFERS> s_sector_buffers;
 
 static CDROMAsyncReader s_reader;
 
+// background precache worker, joined before the media can go away
+static std::thread s_precache_thread;
+
 // two 16-bit samples packed in 32-bits
 static HeapFIFOQueue<u32, AUDIO_FIFO_SIZE> s_audio_fifo;
 
@@ -459,6 +468,7 @@ void CDROM::Shutdown()
   s_async_interrupt_event.reset();
   s_command_second_response_event.reset();
   s_command_event.reset();
+  StopPrecacheThread();
   s_reader.StopThread();
   s_reader.RemoveMedia();
 }
@@ -765,6 +775,7 @@ std::unique_ptr<CDImage> CDROM::RemoveMedia(bool for_disc_swap)
     stop_ticks += System::ScaleTicksToOverclock(System::MASTER_CLOCK * 2);
 
   Log_InfoPrintf("Removing CD...");
+  StopPrecacheThread();
   std::unique_ptr<CDImage> image = s_reader.RemoveMedia();
 
   if (s_show_current_file)
@@ -811,6 +822,40 @@ bool CDROM::PrecacheMedia()
     return false;
   }
 
+  // Size cap for low-memory devices - skipping the precache beats getting OOM-killed mid-game.
+  if (g_settings.cdrom_precache_size_limit_mb > 0)
+  {
+    const u64 limit = static_cast<u64>(g_settings.cdrom_precache_size_limit_mb) * 1048576;
+    const s64 file_size = FileSystem::GetPathFileSize(s_reader.GetMediaFileName().c_str());
+    const u64 estimated_size =
+      (file_size > 0) ? static_cast<u64>(file_size) :
+                        (static_cast<u64>(s_reader.GetMedia()->GetLBACount()) * CDImage::RAW_SECTOR_SIZE);
+    if (estimated_size > limit)
+    {
+      Log_WarningPrintf("Skipping preload of CD image: estimated size %" PRIu64 "MB exceeds limit of %uMB",
+                        estimated_size / 1048576, g_settings.cdrom_precache_size_limit_mb);
+      return false;
+    }
+  }
+
+  if (g_settings.cdrom_precache_in_background)
+  {
+    // Only the image's native precache is safe to run concurrently with sector reads; the
+    // memory-image fallback swaps the media out, which has to happen on the CPU thread.
+    StopPrecacheThread();
+    s_precache_thread = std::thread([]() {
+      Threading::SetNameOfCurrentThread("CD Precache");
+      const CDImage::PrecacheResult res = s_reader.GetMedia()->Precache(ProgressCallback::NullProgressCallback);
+      if (res == CDImage::PrecacheResult::Success)
+        Log_InfoPrintf("Background CD image precache complete");
+      else if (res == CDImage::PrecacheResult::Unsupported)
+        Log_WarningPrintf("Background precache not supported for this image format, skipping");
+      else
+        Log_ErrorPrintf("Background CD image precache failed");
+    });
+    return true;
+  }
+
   HostInterfaceProgressCallback callback;
   if (!s_reader.Precache(&callback))
   {
@@ -821,6 +866,12 @@ bool CDROM::PrecacheMedia()
   return true;
 }
 
+void CDROM::StopPrecacheThread()
+{
+  if (s_precache_thread.joinable())
+    s_precache_thread.join();
+}
+
 TinyString CDROM::LBAToMSFString(CDImage::LBA lba)
 {
   const auto pos = CDImage::Position::FromLBA(lba);
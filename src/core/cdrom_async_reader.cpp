@@ -19,8 +19,12 @@ void CDROMAsyncReader::StartThread(u32 readahead_count)
   if (IsUsingThread())
     StopThread();
 
-  m_buffers.clear();
-  m_buffers.resize(readahead_count);
+  m_readahead_count = readahead_count;
+  for (ReadaheadStream& stream : m_streams)
+  {
+    stream.buffers.clear();
+    stream.buffers.resize(readahead_count);
+  }
   EmptyBuffers();
 
   m_shutdown_flag.store(false);
@@ -41,7 +45,8 @@ void CDROMAsyncReader::StopThread()
 
   m_read_thread.join();
   EmptyBuffers();
-  m_buffers.clear();
+  for (ReadaheadStream& stream : m_streams)
+    stream.buffers.clear();
 }
 
 void CDROMAsyncReader::SetMedia(std::unique_ptr<CDImage> media)
@@ -107,35 +112,87 @@ void CDROMAsyncReader::QueueReadSector(CDImage::LBA lba)
     return;
   }
 
-  const u32 buffer_count = m_buffer_count.load();
+  ReadaheadStream& active = m_streams[m_active_stream.load()];
+  const u32 buffer_count = active.count.load();
   if (buffer_count > 0)
   {
     // don't re-read the same sector if it was the last one we read
     // the CDC code does this when seeking->reading
-    const u32 buffer_front = m_buffer_front.load();
-    if (m_buffers[buffer_front].lba == lba)
+    u32 buffer_index = active.front.load();
+    if (active.buffers[buffer_index].lba == lba)
     {
       Log_DebugPrintf("Skipping re-reading same sector %u", lba);
       return;
     }
 
-    // did we readahead to the correct sector?
-    const u32 next_buffer = (buffer_front + 1) % static_cast<u32>(m_buffers.size());
-    if (m_buffer_count > 1 && m_buffers[next_buffer].lba == lba)
+    // did we readahead to the correct sector? scan the whole buffered window, so a short forward
+    // seek lands on the in-flight sector instead of flushing everything behind it
+    for (u32 depth = 1; depth < buffer_count; depth++)
     {
-      // great, don't need a seek, but still kick the thread to start reading ahead again
-      Log_DebugPrintf("Readahead buffer hit for sector %u", lba);
-      m_buffer_front.store(next_buffer);
-      m_buffer_count.fetch_sub(1);
-      m_can_readahead.store(true);
-      m_do_read_cv.notify_one();
+      buffer_index = (buffer_index + 1) % static_cast<u32>(active.buffers.size());
+      if (active.buffers[buffer_index].lba != lba)
+        continue;
+
+      // great, don't need a seek. batch the refill wakeups: only kick the thread once the window
+      // has drained to half, so sequential streaming costs one wakeup per batch of sectors
+      // instead of one per sector
+      Log_DebugPrintf("Readahead buffer hit for sector %u at depth %u", lba, depth);
+      active.front.store(buffer_index);
+      active.count.fetch_sub(depth);
+      if (active.count.load() <= (m_readahead_count / 2))
+      {
+        m_can_readahead.store(true);
+        m_do_read_cv.notify_one();
+      }
       return;
     }
   }
 
-  // we need to toss away our readahead and start fresh
-  Log_DebugPrintf("Readahead buffer miss, queueing seek to %u", lba);
   std::unique_lock<std::mutex> lock(m_mutex);
+
+  // check the other windows; a hit here means the game is ping-ponging between two disc regions
+  // (e.g. XA audio and level data), so switch streams and keep both windows alive
+  for (u32 stream_index = 0; stream_index < NUM_READAHEAD_STREAMS; stream_index++)
+  {
+    ReadaheadStream& stream = m_streams[stream_index];
+    if (&stream == &active || stream.count.load() == 0)
+      continue;
+
+    u32 buffer_index = stream.front.load();
+    const u32 stream_count = stream.count.load();
+    for (u32 depth = 0; depth < stream_count; depth++)
+    {
+      if (stream.buffers[buffer_index].lba == lba)
+      {
+        Log_DebugPrintf("Switching readahead stream for buffered sector %u at depth %u", lba, depth);
+        stream.front.store(buffer_index);
+        stream.count.fetch_sub(depth);
+        stream.last_use = ++m_use_counter;
+        m_active_stream.store(stream_index);
+        if (stream.count.load() <= (m_readahead_count / 2))
+        {
+          m_can_readahead.store(true);
+          m_do_read_cv.notify_one();
+        }
+        return;
+      }
+
+      buffer_index = (buffer_index + 1) % static_cast<u32>(stream.buffers.size());
+    }
+  }
+
+  // we need to toss a window and start fresh; recycle the least-recently-used stream so the
+  // other region's readahead survives the seek
+  u32 recycle_index = 0;
+  for (u32 stream_index = 1; stream_index < NUM_READAHEAD_STREAMS; stream_index++)
+  {
+    if (m_streams[stream_index].last_use < m_streams[recycle_index].last_use)
+      recycle_index = stream_index;
+  }
+
+  Log_DebugPrintf("Readahead buffer miss, queueing seek to %u", lba);
+  m_streams[recycle_index].last_use = ++m_use_counter;
+  m_active_stream.store(recycle_index);
   m_next_position_set.store(true);
   m_next_position = lba;
   m_do_read_cv.notify_one();
@@ -183,10 +240,10 @@ bool CDROMAsyncReader::InternalReadSectorUncached(CDImage::LBA lba, CDImage::Sub
 bool CDROMAsyncReader::WaitForReadToComplete()
 {
   // Safe without locking with memory_order_seq_cst.
-  if (!m_next_position_set.load() && m_buffer_count.load() > 0)
+  if (!m_next_position_set.load() && GetActiveStream().count.load() > 0)
   {
-    Log_TracePrintf("Returning sector %u", m_buffers[m_buffer_front.load()].lba);
-    return m_buffers[m_buffer_front.load()].result;
+    Log_TracePrintf("Returning sector %u", GetActiveStream().PeekFront().lba);
+    return GetActiveStream().PeekFront().result;
   }
 
   Common::Timer wait_timer;
@@ -194,20 +251,20 @@ bool CDROMAsyncReader::WaitForReadToComplete()
 
   std::unique_lock<std::mutex> lock(m_mutex);
   m_notify_read_complete_cv.wait(
-    lock, [this]() { return (m_buffer_count.load() > 0 || m_seek_error.load()) && !m_next_position_set.load(); });
+    lock, [this]() { return (GetActiveStream().count.load() > 0 || m_seek_error.load()) && !m_next_position_set.load(); });
   if (m_seek_error.load())
   {
     m_seek_error.store(false);
     return false;
   }
 
-  const u32 front = m_buffer_front.load();
+  const BufferSlot& front = GetActiveStream().PeekFront();
   const double wait_time = wait_timer.GetTimeMilliseconds();
   if (wait_time > 1.0f)
-    Log_WarningPrintf("Had to wait %.2f msec for LBA %u", wait_time, m_buffers[front].lba);
+    Log_WarningPrintf("Had to wait %.2f msec for LBA %u", wait_time, front.lba);
 
-  Log_TracePrintf("Returning sector %u after waiting", m_buffers[front].lba);
-  return m_buffers[front].result;
+  Log_TracePrintf("Returning sector %u after waiting", front.lba);
+  return front.result;
 }
 
 void CDROMAsyncReader::WaitForIdle()
@@ -221,26 +278,45 @@ void CDROMAsyncReader::WaitForIdle()
 
 void CDROMAsyncReader::EmptyBuffers()
 {
-  m_buffer_front.store(0);
-  m_buffer_back.store(0);
-  m_buffer_count.store(0);
+  for (ReadaheadStream& stream : m_streams)
+    EmptyStream(stream);
+  m_active_stream.store(0);
 }
 
-bool CDROMAsyncReader::ReadSectorIntoBuffer(std::unique_lock<std::mutex>& lock)
+void CDROMAsyncReader::EmptyStream(ReadaheadStream& stream)
+{
+  stream.front.store(0);
+  stream.back.store(0);
+  stream.count.store(0);
+  stream.resume_valid = false;
+}
+
+bool CDROMAsyncReader::ReadSectorIntoBuffer(ReadaheadStream& stream, std::unique_lock<std::mutex>& lock)
 {
   Common::Timer timer;
 
-  const u32 slot = m_buffer_back.load();
-  m_buffer_back.store((slot + 1) % static_cast<u32>(m_buffers.size()));
+  const u32 slot = stream.back.load();
+  stream.back.store((slot + 1) % static_cast<u32>(stream.buffers.size()));
 
-  BufferSlot& buffer = m_buffers[slot];
-  buffer.lba = m_media->GetPositionOnDisc();
+  BufferSlot& buffer = stream.buffers[slot];
   m_is_reading.store(true);
   lock.unlock();
 
+  // the media position follows whichever stream read last, so re-seek when resuming this one
+  bool result = true;
+  if (stream.resume_valid && m_media->GetPositionOnDisc() != stream.resume_lba)
+  {
+    Log_TracePrintf("Resuming readahead stream at LBA %u", stream.resume_lba);
+    result = m_media->Seek(stream.resume_lba);
+    if (!result)
+      Log_ErrorPrintf("Seek to LBA %u to resume readahead failed", stream.resume_lba);
+  }
+
+  buffer.lba = m_media->GetPositionOnDisc();
+
   Log_TracePrintf("Reading LBA %u...", buffer.lba);
 
-  buffer.result = m_media->ReadRawSector(buffer.data.data(), &buffer.subq);
+  buffer.result = result && m_media->ReadRawSector(buffer.data.data(), &buffer.subq);
   if (buffer.result)
   {
     const double read_time = timer.GetTimeMilliseconds();
@@ -253,17 +329,21 @@ bool CDROMAsyncReader::ReadSectorIntoBuffer(std::unique_lock<std::mutex>& lock)
   }
 
   lock.lock();
+  stream.resume_lba = m_media->GetPositionOnDisc();
+  stream.resume_valid = true;
   m_is_reading.store(false);
-  m_buffer_count.fetch_add(1);
+  stream.count.fetch_add(1);
   m_notify_read_complete_cv.notify_all();
-  return true;
+  return buffer.result;
 }
 
 void CDROMAsyncReader::ReadSectorNonThreaded(CDImage::LBA lba)
 {
   Common::Timer timer;
 
-  m_buffers.resize(1);
+  ReadaheadStream& stream = m_streams.front();
+  stream.buffers.resize(1);
+  m_readahead_count = 1;
   m_seek_error.store(false);
   EmptyBuffers();
 
@@ -274,7 +354,7 @@ void CDROMAsyncReader::ReadSectorNonThreaded(CDImage::LBA lba)
     return;
   }
 
-  BufferSlot& buffer = m_buffers.front();
+  BufferSlot& buffer = stream.buffers.front();
   buffer.lba = m_media->GetPositionOnDisc();
 
   Log_TracePrintf("Reading LBA %u...", buffer.lba);
@@ -291,7 +371,7 @@ void CDROMAsyncReader::ReadSectorNonThreaded(CDImage::LBA lba)
     Log_ErrorPrintf("Read of LBA %u failed", buffer.lba);
   }
 
-  m_buffer_count.fetch_add(1);
+  stream.count.fetch_add(1);
 }
 
 void CDROMAsyncReader::CancelReadahead()
@@ -323,9 +403,9 @@ void CDROMAsyncReader::WorkerThreadEntryPoint()
     {
       if (m_next_position_set.load())
       {
-        // discard buffers, we're seeking to a new location
+        // discard the recycled window (only!), we're seeking to a new location
         const CDImage::LBA seek_location = m_next_position.load();
-        EmptyBuffers();
+        EmptyStream(GetActiveStream());
         m_next_position_set.store(false);
         m_seek_error.store(false);
         m_is_reading.store(true);
@@ -359,9 +439,10 @@ void CDROMAsyncReader::WorkerThreadEntryPoint()
       if (!m_can_readahead.load())
         break;
 
-      // readahead time! read as many sectors as we have space for
-      Log_DebugPrintf("Reading ahead %u sectors...", static_cast<u32>(m_buffers.size()) - m_buffer_count.load());
-      while (m_buffer_count.load() < static_cast<u32>(m_buffers.size()))
+      // readahead time! read as many sectors as we have space for. the active stream is re-fetched
+      // every iteration, since a stream switch can come in while a sector read is in progress
+      Log_DebugPrintf("Reading ahead %u sectors...", m_readahead_count - GetActiveStream().count.load());
+      for (;;)
       {
         if (m_next_position_set.load())
         {
@@ -369,8 +450,12 @@ void CDROMAsyncReader::WorkerThreadEntryPoint()
           break;
         }
 
+        ReadaheadStream& stream = GetActiveStream();
+        if (stream.count.load() >= static_cast<u32>(stream.buffers.size()))
+          break;
+
         // stop reading if we hit the end or get an error
-        if (!ReadSectorIntoBuffer(lock))
+        if (!ReadSectorIntoBuffer(stream, lock))
           break;
       }
 
@@ -27,12 +27,12 @@ public:
   CDROMAsyncReader();
   ~CDROMAsyncReader();
 
-  CDImage::LBA GetLastReadSector() const { return m_buffers[m_buffer_front.load()].lba; }
-  const SectorBuffer& GetSectorBuffer() const { return m_buffers[m_buffer_front.load()].data; }
-  const CDImage::SubChannelQ& GetSectorSubQ() const { return m_buffers[m_buffer_front.load()].subq; }
-  u32 GetBufferedSectorCount() const { return m_buffer_count.load(); }
-  bool HasBufferedSectors() const { return (m_buffer_count.load() > 0); }
-  u32 GetReadaheadCount() const { return static_cast<u32>(m_buffers.size()); }
+  CDImage::LBA GetLastReadSector() const { return GetActiveStream().PeekFront().lba; }
+  const SectorBuffer& GetSectorBuffer() const { return GetActiveStream().PeekFront().data; }
+  const CDImage::SubChannelQ& GetSectorSubQ() const { return GetActiveStream().PeekFront().subq; }
+  u32 GetBufferedSectorCount() const { return GetActiveStream().count.load(); }
+  bool HasBufferedSectors() const { return (GetActiveStream().count.load() > 0); }
+  u32 GetReadaheadCount() const { return m_readahead_count; }
 
   bool HasMedia() const { return static_cast<bool>(m_media); }
   const CDImage* GetMedia() const { return m_media.get(); }
@@ -58,8 +58,37 @@ public:
   bool ReadSectorUncached(CDImage::LBA lba, CDImage::SubChannelQ* subq, SectorBuffer* data);
 
 private:
+  enum : u32
+  {
+    // Two independent readahead windows; games which interleave XA audio streaming with data reads
+    // ping-pong between two disc regions, and a single window gets flushed on every switch.
+    NUM_READAHEAD_STREAMS = 2
+  };
+
+  struct ReadaheadStream
+  {
+    std::vector<BufferSlot> buffers;
+    std::atomic<u32> front{0};
+    std::atomic<u32> back{0};
+    std::atomic<u32> count{0};
+
+    // Position the worker continues reading from, valid after the first read. Only touched by the
+    // worker thread, under the mutex or while m_is_reading is set.
+    CDImage::LBA resume_lba = 0;
+    bool resume_valid = false;
+
+    // Bumped on every use, so misses recycle the least-recently-used stream.
+    u64 last_use = 0;
+
+    const BufferSlot& PeekFront() const { return buffers[front.load()]; }
+  };
+
+  ReadaheadStream& GetActiveStream() { return m_streams[m_active_stream.load()]; }
+  const ReadaheadStream& GetActiveStream() const { return m_streams[m_active_stream.load()]; }
+
   void EmptyBuffers();
-  bool ReadSectorIntoBuffer(std::unique_lock<std::mutex>& lock);
+  void EmptyStream(ReadaheadStream& stream);
+  bool ReadSectorIntoBuffer(ReadaheadStream& stream, std::unique_lock<std::mutex>& lock);
   void ReadSectorNonThreaded(CDImage::LBA lba);
   bool InternalReadSectorUncached(CDImage::LBA lba, CDImage::SubChannelQ* subq, SectorBuffer* data);
   void CancelReadahead();
@@ -81,8 +110,8 @@ private:
   std::atomic_bool m_can_readahead{false};
   std::atomic_bool m_seek_error{false};
 
-  std::vector<BufferSlot> m_buffers;
-  std::atomic<u32> m_buffer_front{0};
-  std::atomic<u32> m_buffer_back{0};
-  std::atomic<u32> m_buffer_count{0};
+  std::array<ReadaheadStream, NUM_READAHEAD_STREAMS> m_streams;
+  std::atomic<u32> m_active_stream{0};
+  u32 m_readahead_count = 0;
+  u64 m_use_counter = 0;
 };
@@ -202,6 +202,8 @@ bool CheatList::LoadFromPCSXRFile(const char* filename)
 
 bool CheatList::LoadFromPCSXRString(const std::string& str)
 {
+  InvalidateCompiledProgram();
+
   std::istringstream iss(str);
 
   std::string line;
@@ -326,6 +328,8 @@ bool CheatList::LoadFromLibretroFile(const char* filename)
 
 bool CheatList::LoadFromLibretroString(const std::string& str)
 {
+  InvalidateCompiledProgram();
+
   std::istringstream iss(str);
   std::string line;
   KeyValuePairVector kvp;
@@ -420,6 +424,8 @@ bool CheatList::LoadFromLibretroString(const std::string& str)
 
 bool CheatList::LoadFromEPSXeString(const std::string& str)
 {
+  InvalidateCompiledProgram();
+
   std::istringstream iss(str);
 
   std::string line;
@@ -556,15 +562,307 @@ void CheatList::Apply()
   if (!m_master_enable)
     return;
 
-  for (const CheatCode& code : m_codes)
+  if (m_compiled_program_dirty)
+    CompileProgram();
+
+  // Compiled codes are a straight walk over preresolved memory operations; only codes with
+  // conditionals or other per-frame state fall back to re-interpreting the instruction stream.
+  for (const CompiledCode& cc : m_compiled_codes)
+  {
+    if (cc.num_ops == 0)
+    {
+      m_codes[cc.code_index].Apply();
+      continue;
+    }
+
+    const u32 end_op = cc.first_op + cc.num_ops;
+    for (u32 i = cc.first_op; i < end_op; i++)
+    {
+      const CompiledOp& op = m_compiled_ops[i];
+      switch (op.size)
+      {
+        case MemoryAccessSize::Byte:
+          ApplyCompiledOp<u8>(op);
+          break;
+
+        case MemoryAccessSize::HalfWord:
+          ApplyCompiledOp<u16>(op);
+          break;
+
+        case MemoryAccessSize::Word:
+        default:
+          ApplyCompiledOp<u32>(op);
+          break;
+      }
+    }
+  }
+}
+
+template<typename T>
+void CheatList::ApplyCompiledOp(const CompiledOp& op)
+{
+  switch (op.type)
+  {
+    case CompiledOp::Type::Write:
+      DoMemoryWrite<T>(op.address, static_cast<T>(op.value));
+      break;
+
+    case CompiledOp::Type::BitSet:
+      DoMemoryWrite<T>(op.address, static_cast<T>(DoMemoryRead<T>(op.address) | static_cast<T>(op.value)));
+      break;
+
+    case CompiledOp::Type::BitClear:
+      DoMemoryWrite<T>(op.address, static_cast<T>(DoMemoryRead<T>(op.address) & ~static_cast<T>(op.value)));
+      break;
+
+    case CompiledOp::Type::Add:
+      DoMemoryWrite<T>(op.address, static_cast<T>(DoMemoryRead<T>(op.address) + static_cast<T>(op.value)));
+      break;
+
+    case CompiledOp::Type::Subtract:
+      DoMemoryWrite<T>(op.address, static_cast<T>(DoMemoryRead<T>(op.address) - static_cast<T>(op.value)));
+      break;
+
+    default:
+      break;
+  }
+}
+
+void CheatList::CompileProgram()
+{
+  m_compiled_ops.clear();
+  m_compiled_codes.clear();
+
+  for (u32 i = 0; i < static_cast<u32>(m_codes.size()); i++)
+  {
+    const CheatCode& cc = m_codes[i];
+    if (!cc.enabled)
+      continue;
+
+    const u32 first_op = static_cast<u32>(m_compiled_ops.size());
+    if (CompileCode(cc, &m_compiled_ops))
+    {
+      const u32 num_ops = static_cast<u32>(m_compiled_ops.size()) - first_op;
+      if (num_ops > 0)
+        m_compiled_codes.push_back({i, first_op, num_ops});
+    }
+    else
+    {
+      m_compiled_codes.push_back({i, 0, 0});
+    }
+  }
+
+  m_compiled_program_dirty = false;
+}
+
+bool CheatList::CompileCode(const CheatCode& code, std::vector<CompiledOp>* ops)
+{
+  const size_t start_size = ops->size();
+  const u32 count = static_cast<u32>(code.instructions.size());
+  for (u32 index = 0; index < count;)
   {
-    if (code.enabled)
-      code.Apply();
+    const CheatCode::Instruction& inst = code.instructions[index];
+    switch (inst.code)
+    {
+      case CheatCode::InstructionCode::Nop:
+        index++;
+        break;
+
+      case CheatCode::InstructionCode::ConstantWrite8:
+        ops->push_back({CompiledOp::Type::Write, MemoryAccessSize::Byte, inst.address, ZeroExtend32(inst.value8.GetValue())});
+        index++;
+        break;
+
+      case CheatCode::InstructionCode::ConstantWrite16:
+        ops->push_back({CompiledOp::Type::Write, MemoryAccessSize::HalfWord, inst.address, ZeroExtend32(inst.value16.GetValue())});
+        index++;
+        break;
+
+      case CheatCode::InstructionCode::ExtConstantWrite32:
+        ops->push_back({CompiledOp::Type::Write, MemoryAccessSize::Word, inst.address, inst.value32});
+        index++;
+        break;
+
+      case CheatCode::InstructionCode::ScratchpadWrite16:
+        ops->push_back({CompiledOp::Type::Write, MemoryAccessSize::HalfWord,
+                        CPU::SCRATCHPAD_ADDR | (inst.address & CPU::SCRATCHPAD_OFFSET_MASK),
+                        ZeroExtend32(inst.value16.GetValue())});
+        index++;
+        break;
+
+      case CheatCode::InstructionCode::ExtScratchpadWrite32:
+        ops->push_back({CompiledOp::Type::Write, MemoryAccessSize::Word,
+                        CPU::SCRATCHPAD_ADDR | (inst.address & CPU::SCRATCHPAD_OFFSET_MASK), inst.value32});
+        index++;
+        break;
+
+      case CheatCode::InstructionCode::ExtConstantBitSet8:
+        ops->push_back({CompiledOp::Type::BitSet, MemoryAccessSize::Byte, inst.address, ZeroExtend32(inst.value8.GetValue())});
+        index++;
+        break;
+
+      case CheatCode::InstructionCode::ExtConstantBitSet16:
+        ops->push_back({CompiledOp::Type::BitSet, MemoryAccessSize::HalfWord, inst.address, ZeroExtend32(inst.value16.GetValue())});
+        index++;
+        break;
+
+      case CheatCode::InstructionCode::ExtConstantBitSet32:
+        ops->push_back({CompiledOp::Type::BitSet, MemoryAccessSize::Word, inst.address, inst.value32});
+        index++;
+        break;
+
+      case CheatCode::InstructionCode::ExtConstantBitClear8:
+        ops->push_back({CompiledOp::Type::BitClear, MemoryAccessSize::Byte, inst.address, ZeroExtend32(inst.value8.GetValue())});
+        index++;
+        break;
+
+      case CheatCode::InstructionCode::ExtConstantBitClear16:
+        ops->push_back({CompiledOp::Type::BitClear, MemoryAccessSize::HalfWord, inst.address, ZeroExtend32(inst.value16.GetValue())});
+        index++;
+        break;
+
+      case CheatCode::InstructionCode::ExtConstantBitClear32:
+        ops->push_back({CompiledOp::Type::BitClear, MemoryAccessSize::Word, inst.address, inst.value32});
+        index++;
+        break;
+
+      case CheatCode::InstructionCode::Increment8:
+        ops->push_back({CompiledOp::Type::Add, MemoryAccessSize::Byte, inst.address, ZeroExtend32(inst.value8.GetValue())});
+        index++;
+        break;
+
+      case CheatCode::InstructionCode::Decrement8:
+        ops->push_back({CompiledOp::Type::Subtract, MemoryAccessSize::Byte, inst.address, ZeroExtend32(inst.value8.GetValue())});
+        index++;
+        break;
+
+      case CheatCode::InstructionCode::Increment16:
+        ops->push_back({CompiledOp::Type::Add, MemoryAccessSize::HalfWord, inst.address, ZeroExtend32(inst.value16.GetValue())});
+        index++;
+        break;
+
+      case CheatCode::InstructionCode::Decrement16:
+        ops->push_back({CompiledOp::Type::Subtract, MemoryAccessSize::HalfWord, inst.address, ZeroExtend32(inst.value16.GetValue())});
+        index++;
+        break;
+
+      case CheatCode::InstructionCode::ExtIncrement32:
+        ops->push_back({CompiledOp::Type::Add, MemoryAccessSize::Word, inst.address, inst.value32});
+        index++;
+        break;
+
+      case CheatCode::InstructionCode::ExtDecrement32:
+        ops->push_back({CompiledOp::Type::Subtract, MemoryAccessSize::Word, inst.address, inst.value32});
+        index++;
+        break;
+
+      case CheatCode::InstructionCode::Slide:
+      {
+        if ((index + 1) >= count)
+        {
+          ops->resize(start_size);
+          return false;
+        }
+
+        const u32 slide_count = (inst.first >> 8) & 0xFFu;
+        const u32 address_increment = inst.first & 0xFFu;
+        const u16 value_increment = Truncate16(inst.second);
+        const CheatCode::Instruction& inst2 = code.instructions[index + 1];
+        const CheatCode::InstructionCode write_type = inst2.code;
+        u32 address = inst2.address;
+        u16 value = inst2.value16;
+
+        if (write_type != CheatCode::InstructionCode::ConstantWrite8 &&
+            write_type != CheatCode::InstructionCode::ConstantWrite16)
+        {
+          ops->resize(start_size);
+          return false;
+        }
+
+        const MemoryAccessSize size =
+          (write_type == CheatCode::InstructionCode::ConstantWrite8) ? MemoryAccessSize::Byte :
+                                                                       MemoryAccessSize::HalfWord;
+        for (u32 i = 0; i < slide_count; i++)
+        {
+          const u32 write_value = (size == MemoryAccessSize::Byte) ? ZeroExtend32(Truncate8(value)) : ZeroExtend32(value);
+          ops->push_back({CompiledOp::Type::Write, size, address, write_value});
+          address += address_increment;
+          value += value_increment;
+        }
+
+        index += 2;
+      }
+      break;
+
+      case CheatCode::InstructionCode::ExtImprovedSlide:
+      {
+        if ((index + 1) >= count)
+        {
+          ops->resize(start_size);
+          return false;
+        }
+
+        const u32 slide_count = inst.first & 0xFFFFu;
+        const u32 address_change = (inst.second >> 16) & 0xFFFFu;
+        const u32 value_change = ZeroExtend32(Truncate16(inst.second));
+        const bool address_change_negative = (inst.first >> 20) & 0x1u;
+        const bool value_change_negative = (inst.first >> 16) & 0x1u;
+        const CheatCode::Instruction& inst2 = code.instructions[index + 1];
+        const CheatCode::InstructionCode write_type = inst2.code;
+        u32 address = inst2.address;
+        u32 value = inst2.value32;
+
+        MemoryAccessSize size;
+        if (write_type == CheatCode::InstructionCode::ConstantWrite8)
+          size = MemoryAccessSize::Byte;
+        else if (write_type == CheatCode::InstructionCode::ConstantWrite16)
+          size = MemoryAccessSize::HalfWord;
+        else if (write_type == CheatCode::InstructionCode::ExtConstantWrite32)
+          size = MemoryAccessSize::Word;
+        else
+        {
+          ops->resize(start_size);
+          return false;
+        }
+
+        for (u32 i = 0; i < slide_count; i++)
+        {
+          u32 write_value = value;
+          if (size == MemoryAccessSize::Byte)
+            write_value = ZeroExtend32(Truncate8(value));
+          else if (size == MemoryAccessSize::HalfWord)
+            write_value = ZeroExtend32(Truncate16(value));
+          ops->push_back({CompiledOp::Type::Write, size, address, write_value});
+
+          if (address_change_negative)
+            address -= address_change;
+          else
+            address += address_change;
+          if (value_change_negative)
+            value -= value_change;
+          else
+            value += value_change;
+        }
+
+        index += 2;
+      }
+      break;
+
+      default:
+      {
+        // Conditionals, delays, button tests, copies, etc. have to be evaluated every frame.
+        ops->resize(start_size);
+        return false;
+      }
+    }
   }
+
+  return true;
 }
 
 void CheatList::AddCode(CheatCode cc)
 {
+  InvalidateCompiledProgram();
   m_codes.push_back(std::move(cc));
 }
 
@@ -573,6 +871,8 @@ void CheatList::SetCode(u32 index, CheatCode cc)
   if (index > m_codes.size())
     return;
 
+  InvalidateCompiledProgram();
+
   if (index == m_codes.size())
   {
     m_codes.push_back(std::move(cc));
@@ -584,6 +884,7 @@ void CheatList::SetCode(u32 index, CheatCode cc)
 
 void CheatList::RemoveCode(u32 i)
 {
+  InvalidateCompiledProgram();
   m_codes.erase(m_codes.begin() + i);
 }
 
@@ -689,6 +990,8 @@ bool CheatList::SaveToPCSXRFile(const char* filename)
 
 bool CheatList::LoadFromPackage(const std::string& serial)
 {
+  InvalidateCompiledProgram();
+
   const std::optional<std::string> db_string(Host::ReadResourceFileToString("chtdb.txt"));
   if (!db_string.has_value())
     return false;
@@ -831,6 +1134,7 @@ void CheatList::SetCodeEnabled(u32 index, bool state)
     return;
 
   m_codes[index].enabled = state;
+  InvalidateCompiledProgram();
   if (!state)
     m_codes[index].ApplyOnDisable();
 }
@@ -2815,6 +3119,169 @@ std::optional<CheatCode::Activation> CheatCode::ParseActivationName(const char*
   return std::nullopt;
 }
 
+/// Returns a pointer into the RAM backing store for scan addresses which hit main RAM (including
+/// mirrors), otherwise null. Scratchpad and BIOS reads go through the slow path.
+static const u8* GetScanMemoryPointer(PhysicalMemoryAddress address, u32 size)
+{
+  const PhysicalMemoryAddress phys = address & CPU::PHYSICAL_MEMORY_ADDRESS_MASK;
+  if (phys >= Bus::RAM_MIRROR_END || ((phys & Bus::g_ram_mask) + size) > Bus::g_ram_size)
+    return nullptr;
+
+  return &Bus::g_ram[phys & Bus::g_ram_mask];
+}
+
+template<typename T, typename FilterFunctor>
+static void DirectRAMScanKernel(const u8* ram, u32 length, PhysicalMemoryAddress base_address, bool is_signed,
+                                MemoryScan::ResultVector* results, const FilterFunctor& filter)
+{
+  for (u32 offset = 0; (offset + static_cast<u32>(sizeof(T))) <= length; offset += static_cast<u32>(sizeof(T)))
+  {
+    T bvalue;
+    std::memcpy(&bvalue, &ram[offset], sizeof(bvalue));
+    const u32 value = is_signed ? SignExtend32(bvalue) : ZeroExtend32(bvalue);
+    if (!filter(value))
+      continue;
+
+    MemoryScan::Result res;
+    res.address = base_address + offset;
+    res.value = value;
+    res.last_value = value;
+    res.value_changed = false;
+    results->push_back(res);
+  }
+}
+
+template<typename T>
+static void DirectRAMScan(const u8* ram, u32 length, PhysicalMemoryAddress base_address, bool is_signed,
+                          MemoryScan::Operator op, u32 comp_value, MemoryScan::ResultVector* results)
+{
+  // The comparison is hoisted out of the loop, leaving a sequential load/compare kernel per
+  // operator which the compiler can vectorize.
+  switch (op)
+  {
+    case MemoryScan::Operator::Equal:
+    {
+      DirectRAMScanKernel<T>(ram, length, base_address, is_signed, results,
+                             [comp_value](u32 value) { return (value == comp_value); });
+    }
+    break;
+
+    case MemoryScan::Operator::NotEqual:
+    {
+      DirectRAMScanKernel<T>(ram, length, base_address, is_signed, results,
+                             [comp_value](u32 value) { return (value != comp_value); });
+    }
+    break;
+
+    case MemoryScan::Operator::GreaterThan:
+    {
+      if (is_signed)
+      {
+        DirectRAMScanKernel<T>(ram, length, base_address, is_signed, results, [comp_value](u32 value) {
+          return (static_cast<s32>(value) > static_cast<s32>(comp_value));
+        });
+      }
+      else
+      {
+        DirectRAMScanKernel<T>(ram, length, base_address, is_signed, results,
+                               [comp_value](u32 value) { return (value > comp_value); });
+      }
+    }
+    break;
+
+    case MemoryScan::Operator::GreaterEqual:
+    {
+      if (is_signed)
+      {
+        DirectRAMScanKernel<T>(ram, length, base_address, is_signed, results, [comp_value](u32 value) {
+          return (static_cast<s32>(value) >= static_cast<s32>(comp_value));
+        });
+      }
+      else
+      {
+        DirectRAMScanKernel<T>(ram, length, base_address, is_signed, results,
+                               [comp_value](u32 value) { return (value >= comp_value); });
+      }
+    }
+    break;
+
+    case MemoryScan::Operator::LessThan:
+    {
+      if (is_signed)
+      {
+        DirectRAMScanKernel<T>(ram, length, base_address, is_signed, results, [comp_value](u32 value) {
+          return (static_cast<s32>(value) < static_cast<s32>(comp_value));
+        });
+      }
+      else
+      {
+        DirectRAMScanKernel<T>(ram, length, base_address, is_signed, results,
+                               [comp_value](u32 value) { return (value < comp_value); });
+      }
+    }
+    break;
+
+    case MemoryScan::Operator::LessEqual:
+    {
+      if (is_signed)
+      {
+        DirectRAMScanKernel<T>(ram, length, base_address, is_signed, results, [comp_value](u32 value) {
+          return (static_cast<s32>(value) <= static_cast<s32>(comp_value));
+        });
+      }
+      else
+      {
+        DirectRAMScanKernel<T>(ram, length, base_address, is_signed, results,
+                               [comp_value](u32 value) { return (value <= comp_value); });
+      }
+    }
+    break;
+
+    case MemoryScan::Operator::Any:
+    {
+      DirectRAMScanKernel<T>(ram, length, base_address, is_signed, results, [](u32) { return true; });
+    }
+    break;
+
+    default:
+    {
+      // Last-value operators degenerate to self-comparisons on an initial scan; they're rare
+      // enough that the generic filter is fine.
+      DirectRAMScanKernel<T>(ram, length, base_address, is_signed, results,
+                             [op, comp_value, is_signed](u32 value) {
+                               MemoryScan::Result res;
+                               res.address = 0;
+                               res.value = value;
+                               res.last_value = value;
+                               res.value_changed = false;
+                               return res.Filter(op, comp_value, is_signed);
+                             });
+    }
+    break;
+  }
+}
+
+/// Scans [start, end) directly off the RAM backing store when the whole range maps contiguously
+/// into it, avoiding a full address translation per access. Returns false to use the slow path.
+template<typename T>
+static bool TryDirectRAMScan(PhysicalMemoryAddress start, PhysicalMemoryAddress end, bool is_signed,
+                             MemoryScan::Operator op, u32 comp_value, MemoryScan::ResultVector* results)
+{
+  if (start >= end)
+    return false;
+
+  const PhysicalMemoryAddress start_phys = start & CPU::PHYSICAL_MEMORY_ADDRESS_MASK;
+  const u32 length = end - start;
+  if (start_phys >= Bus::RAM_MIRROR_END || (start_phys + length) > Bus::RAM_MIRROR_END ||
+      ((start_phys & Bus::g_ram_mask) + length) > Bus::g_ram_size)
+  {
+    return false;
+  }
+
+  DirectRAMScan<T>(&Bus::g_ram[start_phys & Bus::g_ram_mask], length, start, is_signed, op, comp_value, results);
+  return true;
+}
+
 MemoryScan::MemoryScan() = default;
 
 MemoryScan::~MemoryScan() = default;
@@ -2849,6 +3316,9 @@ void MemoryScan::Search()
 
 void MemoryScan::SearchBytes()
 {
+  if (TryDirectRAMScan<u8>(m_start_address, m_end_address, m_signed, m_operator, m_value, &m_results))
+    return;
+
   for (PhysicalMemoryAddress address = m_start_address; address < m_end_address; address++)
   {
     if (!IsValidScanAddress(address))
@@ -2869,6 +3339,9 @@ void MemoryScan::SearchBytes()
 
 void MemoryScan::SearchHalfwords()
 {
+  if (TryDirectRAMScan<u16>(m_start_address, m_end_address, m_signed, m_operator, m_value, &m_results))
+    return;
+
   for (PhysicalMemoryAddress address = m_start_address; address < m_end_address; address += 2)
   {
     if (!IsValidScanAddress(address))
@@ -2889,6 +3362,9 @@ void MemoryScan::SearchHalfwords()
 
 void MemoryScan::SearchWords()
 {
+  if (TryDirectRAMScan<u32>(m_start_address, m_end_address, m_signed, m_operator, m_value, &m_results))
+    return;
+
   for (PhysicalMemoryAddress address = m_start_address; address < m_end_address; address += 4)
   {
     if (!IsValidScanAddress(address))
@@ -3053,6 +3529,41 @@ void MemoryScan::Result::UpdateValue(MemoryAccessSize size, bool is_signed)
 {
   const u32 old_value = value;
 
+  // Results overwhelmingly point at main RAM, so refreshing them (which happens for the whole
+  // result set on every re-filter) reads the backing store directly where possible.
+  if (const u8* ram = GetScanMemoryPointer(address, (size == MemoryAccessSize::Byte)  ? 1 :
+                                                    (size == MemoryAccessSize::HalfWord) ? 2 :
+                                                                                           4))
+  {
+    switch (size)
+    {
+      case MemoryAccessSize::Byte:
+      {
+        const u8 bvalue = *ram;
+        value = is_signed ? SignExtend32(bvalue) : ZeroExtend32(bvalue);
+      }
+      break;
+
+      case MemoryAccessSize::HalfWord:
+      {
+        u16 bvalue;
+        std::memcpy(&bvalue, ram, sizeof(bvalue));
+        value = is_signed ? SignExtend32(bvalue) : ZeroExtend32(bvalue);
+      }
+      break;
+
+      case MemoryAccessSize::Word:
+      default:
+      {
+        std::memcpy(&value, ram, sizeof(value));
+      }
+      break;
+    }
+
+    value_changed = (value != old_value);
+    return;
+  }
+
   switch (size)
   {
     case MemoryAccessSize::Byte:
@@ -151,7 +151,12 @@ public:
   ~CheatList();
 
   ALWAYS_INLINE const CheatCode& GetCode(u32 i) const { return m_codes[i]; }
-  ALWAYS_INLINE CheatCode& GetCode(u32 i) { return m_codes[i]; }
+  ALWAYS_INLINE CheatCode& GetCode(u32 i)
+  {
+    // The caller can modify the code through this reference, so the compiled program has to be rebuilt.
+    InvalidateCompiledProgram();
+    return m_codes[i];
+  }
   ALWAYS_INLINE u32 GetCodeCount() const { return static_cast<u32>(m_codes.size()); }
   ALWAYS_INLINE bool IsCodeEnabled(u32 index) const { return m_codes[index].enabled; }
 
@@ -195,7 +200,43 @@ public:
   void MergeList(const CheatList& cl);
 
 private:
+  /// A single precompiled memory operation with a fully-resolved address, produced by flattening
+  /// the simple (unconditional) instructions of a code, including unrolling slide instructions.
+  struct CompiledOp
+  {
+    enum class Type : u8
+    {
+      Write,
+      BitSet,
+      BitClear,
+      Add,
+      Subtract
+    };
+
+    Type type;
+    MemoryAccessSize size;
+    u32 address;
+    u32 value;
+  };
+
+  struct CompiledCode
+  {
+    u32 code_index;
+    u32 first_op;
+    u32 num_ops; // zero if the code could not be compiled, and must be interpreted instead
+  };
+
+  ALWAYS_INLINE void InvalidateCompiledProgram() { m_compiled_program_dirty = true; }
+  void CompileProgram();
+  static bool CompileCode(const CheatCode& code, std::vector<CompiledOp>* ops);
+
+  template<typename T>
+  static void ApplyCompiledOp(const CompiledOp& op);
+
   std::vector<CheatCode> m_codes;
+  std::vector<CompiledOp> m_compiled_ops;
+  std::vector<CompiledCode> m_compiled_codes;
+  bool m_compiled_program_dirty = true;
   bool m_master_enable = true;
 };
 
@@ -7,14 +7,24 @@
 #include "cpu_core_private.h"
 #include "cpu_disasm.h"
 #include "cpu_recompiler_types.h"
+#include "host.h"
+#include "imgui.h"
 #include "settings.h"
 #include "system.h"
 #include "timing_event.h"
 
+#include "util/imgui_manager.h"
+
 #include "common/assert.h"
+#include "common/byte_stream.h"
 #include "common/intrin.h"
 #include "common/log.h"
 #include "common/memmap.h"
+#include "common/path.h"
+#include "common/threading.h"
+#include "common/timer.h"
+
+#include "fmt/format.h"
 
 Log_SetChannel(CPU::CodeCache);
 
@@ -26,6 +36,11 @@ Log_SetChannel(CPU::CodeCache);
 #include "cpu_newrec_compiler.h"
 #endif
 
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
 #include <unordered_set>
 #include <zlib.h>
 
@@ -45,6 +60,15 @@ static constexpr u32 RECOMPILE_FRAMES_FOR_INTERPRETER_FALLBACK = 15;
 static constexpr u32 INVALIDATE_COUNT_FOR_MANUAL_PROTECTION = 4;
 static constexpr u32 INVALIDATE_FRAMES_FOR_MANUAL_PROTECTION = 20;
 
+// Cap trace length so a pathological chain of unconditional branches can't delay event handling.
+static constexpr u32 MAX_TRACE_INSTRUCTIONS = 128;
+
+// New blocks start out in a cold tier where the cached interpreter runs the already-decoded
+// instructions, and only get handed to the recompiler once they've executed this many times.
+// One-shot blocks (init code, self-modifying sound drivers that invalidate straight away) never
+// pay for a full compile, which bounds the compile time spent per frame during block storms.
+static constexpr u32 COLD_TIER_EXECUTIONS_BEFORE_COMPILE = 8;
+
 static CodeLUT DecodeCodeLUTPointer(u32 slot, CodeLUT ptr);
 static CodeLUT EncodeCodeLUTPointer(u32 slot, CodeLUT ptr);
 static CodeLUT OffsetCodeLUTPointer(CodeLUT fake_ptr, u32 pc);
@@ -63,6 +87,8 @@ static bool RevalidateBlock(Block* block);
 PageProtectionMode GetProtectionModeForPC(u32 pc);
 PageProtectionMode GetProtectionModeForBlock(const Block* block);
 static bool ReadBlockInstructions(u32 start_pc, BlockInstructionList* instructions, BlockMetadata* metadata);
+static bool IsIdleLoopBodyInstruction(Instruction instruction, u64* read_mask, u64* write_mask);
+static bool IsIdleLoop(u32 start_pc, const BlockInstructionList& instructions);
 static void FillBlockRegInfo(Block* block);
 static void CopyRegInfo(InstructionInfo* dst, const InstructionInfo* src);
 static void SetRegAccess(InstructionInfo* inst, Reg reg, bool write);
@@ -85,6 +111,12 @@ static std::unique_ptr<Block*[]> s_lut_block_pointers;
 static PageProtectionArray s_page_protection = {};
 static std::vector<Block*> s_blocks;
 
+// telemetry for the debug window, reset on system initialization
+static u32 s_total_blocks_compiled = 0;
+static u32 s_total_blocks_invalidated = 0;
+static u32 s_total_block_links_patched = 0;
+static u32 s_total_fastmem_exceptions = 0;
+
 // for compiling - reuse to avoid allocations
 static BlockInstructionList s_block_instructions;
 
@@ -96,6 +128,18 @@ static void UnlinkBlockExits(Block* block);
 static void ClearASMFunctions();
 static void CompileASMFunctions();
 static bool CompileBlock(Block* block);
+static void StartCompileThread();
+static void StopCompileThread();
+static void CompileThreadEntryPoint();
+static void QueueBlockForAsyncCompilation(Block* block);
+static void RemoveBlockFromAsyncQueues(Block* block);
+static void InterpretCachedBlockForCurrentSettings(const Block* block);
+static void ExecuteColdBlock(Block* block);
+static void PromoteBlockToRecompiler(Block* block);
+
+static std::string GetWarmBlockCacheFilename(const std::string& serial);
+static void SaveWarmBlockList();
+static void LoadWarmBlockList();
 static Common::PageFaultHandler::HandlerResult HandleFastmemException(void* exception_pc, void* fault_address,
                                                                       bool is_write);
 static void BackpatchLoadStore(void* host_pc, const LoadstoreBackpatchInfo& info);
@@ -104,6 +148,56 @@ static BlockLinkMap s_block_links;
 static std::unordered_map<const void*, LoadstoreBackpatchInfo> s_fastmem_backpatch_info;
 static std::unordered_set<u32> s_fastmem_faulting_pcs;
 
+// Fastmem faults are also counted against the code page the faulting instruction lives in. Once a
+// page crosses the threshold, any new blocks compiled from it use slow-path accesses up front,
+// which stops streamed overlays from churning through the fault/backpatch/refault cycle every time
+// fresh code lands in the same pages.
+static constexpr u16 FASTMEM_FAULTING_PAGE_DEMOTE_THRESHOLD = 16;
+static std::unordered_map<u32, u16> s_fastmem_faulting_page_counts;
+
+// Async compilation. Blocks are executed by the interpreter until the worker thread has emitted
+// the host code, at which point the CPU thread publishes it to the fast map. The mutex guards the
+// queues, the code buffer, and any in-flight compilation on the worker thread.
+static std::thread s_compile_thread;
+static std::mutex s_compile_mutex;
+static std::condition_variable s_compile_queue_cv;
+static std::deque<Block*> s_compile_queue;
+static std::vector<Block*> s_async_compiled_blocks;
+static bool s_compile_thread_running = false;
+static bool s_compile_thread_shutdown = false;
+
+// Periodic re-layout of heavily-linked blocks, re-emitting them back-to-back so the dispatcher's
+// working set stays dense in the code buffer instead of scattered in first-compile order. Skipped
+// once the buffer starts filling up, since the abandoned copies only get reclaimed by a full reset.
+static constexpr u32 RELAYOUT_INTERVAL_FRAMES = 60 * 60;
+static constexpr u32 RELAYOUT_MAX_BLOCKS = 64;
+static constexpr u32 RELAYOUT_MIN_BLOCKS = 8;
+static constexpr u32 RELAYOUT_MIN_INCOMING_LINKS = 2;
+static constexpr float RELAYOUT_MAX_BUFFER_USED_PCT = 75.0f;
+static u32 s_relayout_frame_counter = 0;
+
+// Persistent block metadata cache, saved per-serial next to the other caches. On the next boot of
+// the same game the hot block set gets precompiled in batches instead of lazily on first execution.
+static constexpr u32 WARM_BLOCK_CACHE_SIGNATURE = 0x4B424344; // 'DCBK'
+static constexpr u32 WARM_BLOCK_CACHE_VERSION = 1;
+static constexpr u32 WARM_BLOCK_CACHE_MAX_ENTRIES = 65536;
+static constexpr u32 WARM_BLOCKS_PER_FRAME = 64;
+
+struct WarmBlockEntry
+{
+  u32 pc;
+  u32 size;
+  u32 crc;
+};
+
+static std::string s_warm_block_serial;
+static std::vector<WarmBlockEntry> s_warm_blocks;
+static u32 s_warm_block_cursor = 0;
+static u32 s_warm_block_pass = 0;
+
+// Give up on entries which haven't matched RAM contents after this many passes over the list.
+static constexpr u32 WARM_BLOCK_CACHE_MAX_PASSES = 4;
+
 NORETURN_FUNCTION_POINTER void (*g_enter_recompiler)();
 const void* g_compile_or_revalidate_block;
 const void* g_check_events_and_dispatch;
@@ -177,6 +271,10 @@ void CPU::CodeCache::ProcessStartup()
   {
     Panic("Failed to initialize code space");
   }
+
+  // Read from the base settings because the settings struct hasn't been loaded at this point.
+  if (Host::GetBaseBoolSettingValue("Main", "EnableHugePages", false))
+    MemMap::EnableHugePages(s_code_buffer.GetCodePointer(), s_code_buffer.GetTotalSize());
 #endif
 
   if (!Common::PageFaultHandler::InstallHandler(ExceptionHandler))
@@ -198,12 +296,18 @@ void CPU::CodeCache::Initialize()
 {
   Assert(s_blocks.empty());
 
+  s_total_blocks_compiled = 0;
+  s_total_blocks_invalidated = 0;
+  s_total_block_links_patched = 0;
+  s_total_fastmem_exceptions = 0;
+
 #ifdef ENABLE_RECOMPILER_SUPPORT
   if (IsUsingAnyRecompiler())
   {
     s_code_buffer.Reset();
     CompileASMFunctions();
     ResetCodeLUT();
+    StartCompileThread();
   }
 #endif
 
@@ -213,6 +317,13 @@ void CPU::CodeCache::Initialize()
 
 void CPU::CodeCache::Shutdown()
 {
+#ifdef ENABLE_RECOMPILER_SUPPORT
+  StopCompileThread();
+  SaveWarmBlockList();
+  s_warm_block_serial = {};
+  s_warm_blocks = {};
+#endif
+
   ClearBlocks();
 
 #ifdef ENABLE_RECOMPILER_SUPPORT
@@ -225,6 +336,11 @@ void CPU::CodeCache::Shutdown()
 
 void CPU::CodeCache::Reset()
 {
+#ifdef ENABLE_RECOMPILER_SUPPORT
+  // Anything queued or compiled-but-unpublished points into the code buffer we're about to reset.
+  StopCompileThread();
+#endif
+
   ClearBlocks();
 
 #ifdef ENABLE_RECOMPILER_SUPPORT
@@ -234,6 +350,7 @@ void CPU::CodeCache::Reset()
     s_code_buffer.Reset();
     CompileASMFunctions();
     ResetCodeLUT();
+    StartCompileThread();
   }
 #endif
 }
@@ -250,6 +367,216 @@ void CPU::CodeCache::Execute()
 #endif
 }
 
+void CPU::CodeCache::ProcessAsyncCompilationResults()
+{
+#ifdef ENABLE_RECOMPILER_SUPPORT
+  if (!s_compile_thread_running)
+    return;
+
+  std::unique_lock lock(s_compile_mutex);
+  if (s_async_compiled_blocks.empty())
+    return;
+
+  MemMap::BeginCodeWrite();
+
+  for (Block* block : s_async_compiled_blocks)
+  {
+    // May have been invalidated between compilation and publishing.
+    if (block->state != BlockState::Valid || !block->host_code)
+      continue;
+
+    SetCodeLUT(block->pc, block->host_code);
+    BacklinkBlocks(block->pc, block->host_code);
+  }
+  s_async_compiled_blocks.clear();
+
+  MemMap::EndCodeWrite();
+#endif
+}
+
+void CPU::CodeCache::RelayoutHotBlocks()
+{
+#ifdef ENABLE_RECOMPILER_SUPPORT
+  if (!IsUsingAnyRecompiler() || s_blocks.empty())
+    return;
+
+  if ((++s_relayout_frame_counter) < RELAYOUT_INTERVAL_FRAMES)
+    return;
+  s_relayout_frame_counter = 0;
+
+  if (s_code_buffer.GetUsedPct() >= RELAYOUT_MAX_BUFFER_USED_PCT)
+    return;
+
+  // The worker shares the code buffer, so hold the queue lock for the whole pass - compilation
+  // can't be allowed to interleave with the relinking below.
+  std::unique_lock<std::mutex> lock(s_compile_mutex, std::defer_lock);
+  if (s_compile_thread_running)
+    lock.lock();
+
+  // Release builds carry no per-block execution counters, and instrumenting every block entry
+  // would cost more than the locality buys back, so incoming link count serves as the hotness
+  // proxy: blocks that many compiled branch sites target are the hubs of the current working set.
+  std::vector<std::pair<u32, Block*>> candidates;
+  for (Block* block : s_blocks)
+  {
+    if (block->state != BlockState::Valid || !block->host_code || block->size == 0)
+      continue;
+
+    const u32 incoming_links = static_cast<u32>(s_block_links.count(block->pc));
+    if (incoming_links >= RELAYOUT_MIN_INCOMING_LINKS)
+      candidates.emplace_back(incoming_links, block);
+  }
+  if (candidates.size() < RELAYOUT_MIN_BLOCKS)
+    return;
+
+  // Hottest blocks first, then guest order within the set, so guest-sequential code also ends up
+  // host-sequential.
+  const size_t count = std::min<size_t>(candidates.size(), RELAYOUT_MAX_BLOCKS);
+  std::partial_sort(candidates.begin(), candidates.begin() + count, candidates.end(),
+                    [](const auto& lhs, const auto& rhs) { return lhs.first > rhs.first; });
+  candidates.resize(count);
+  std::sort(candidates.begin(), candidates.end(),
+            [](const auto& lhs, const auto& rhs) { return lhs.second->pc < rhs.second->pc; });
+
+  Log_DevFmt("Re-laying out {} hot blocks ({:.1f}% code buffer used)", candidates.size(), s_code_buffer.GetUsedPct());
+
+  MemMap::BeginCodeWrite();
+
+  for (const auto& [incoming_links, block] : candidates)
+  {
+    if (!s_compile_thread_running &&
+        (s_code_buffer.GetFreeCodeSpace() < (block->size * Recompiler::MAX_NEAR_HOST_BYTES_PER_INSTRUCTION) ||
+         s_code_buffer.GetFreeFarCodeSpace() < (block->size * Recompiler::MAX_FAR_HOST_BYTES_PER_INSTRUCTION)))
+    {
+      break;
+    }
+
+    // Same sequence as an invalidation recompile: detach the old copy, cover the block with the
+    // interpreter, and let the compiler re-emit it at the current (contiguous) free pointer.
+    UnlinkBlockExits(block);
+    block->host_code = nullptr;
+    SetCodeLUT(block->pc, g_interpret_block);
+    BacklinkBlocks(block->pc, g_interpret_block);
+
+    if (s_compile_thread_running)
+    {
+      // The worker drains the queue in order, producing the same contiguous layout.
+      s_compile_queue.push_back(block);
+      continue;
+    }
+
+    if (CompileBlock(block))
+    {
+      SetCodeLUT(block->pc, block->host_code);
+      BacklinkBlocks(block->pc, block->host_code);
+    }
+    else
+    {
+      Log_ErrorFmt("Failed to re-layout block at 0x{:08X}, falling back to interpreter", block->pc);
+    }
+  }
+
+  MemMap::EndCodeWrite();
+
+  if (lock.owns_lock())
+    s_compile_queue_cv.notify_one();
+#endif
+}
+
+void CPU::CodeCache::GameSerialChanged(const std::string& serial)
+{
+#ifdef ENABLE_RECOMPILER_SUPPORT
+  SaveWarmBlockList();
+
+  s_warm_block_serial = serial;
+  s_warm_blocks = {};
+  s_warm_block_cursor = 0;
+  s_warm_block_pass = 0;
+
+  if (!serial.empty() && IsUsingAnyRecompiler())
+    LoadWarmBlockList();
+#endif
+}
+
+void CPU::CodeCache::PrecompileWarmBlocks()
+{
+#ifdef ENABLE_RECOMPILER_SUPPORT
+  if (s_warm_blocks.empty() || !IsUsingAnyRecompiler())
+    return;
+
+  u32 remaining = WARM_BLOCKS_PER_FRAME;
+  while (remaining > 0 && !s_warm_blocks.empty())
+  {
+    if (s_warm_block_cursor >= s_warm_blocks.size())
+    {
+      // Completed a pass over the list. Anything which still hasn't matched RAM after a few passes
+      // is presumably from a part of the game which isn't getting loaded this session.
+      std::erase_if(s_warm_blocks, [](const WarmBlockEntry& entry) { return (entry.pc == 0); });
+      s_warm_block_cursor = 0;
+      if ((++s_warm_block_pass) >= WARM_BLOCK_CACHE_MAX_PASSES)
+      {
+        s_warm_blocks = {};
+        break;
+      }
+
+      continue;
+    }
+
+    WarmBlockEntry& entry = s_warm_blocks[s_warm_block_cursor++];
+    remaining--;
+
+    if (entry.pc == 0 || LookupBlock(entry.pc))
+    {
+      entry.pc = 0;
+      continue;
+    }
+
+    // Only compile it if the code it was compiled from last session has actually been loaded.
+    u32 crc = static_cast<u32>(crc32(0, nullptr, 0));
+    u32 pc = entry.pc;
+    bool valid = true;
+    for (u32 i = 0; i < entry.size; i++, pc += sizeof(Instruction))
+    {
+      u32 bits;
+      if (!SafeReadInstruction(pc, &bits))
+      {
+        valid = false;
+        break;
+      }
+
+      crc = static_cast<u32>(crc32(crc, reinterpret_cast<const Bytef*>(&bits), sizeof(bits)));
+    }
+    if (!valid)
+    {
+      entry.pc = 0;
+      continue;
+    }
+
+    // Not loaded yet? Try again on a later pass.
+    if (crc != entry.crc)
+      continue;
+
+    const u32 compile_pc = entry.pc;
+    entry.pc = 0;
+
+    // Warm blocks already proved themselves hot last session, so they skip the cold tier. Don't
+    // go through CompileOrRevalidateBlock() here - that would interpret the block, and we're not
+    // inside the execution loop.
+    MemMap::BeginCodeWrite();
+    BlockMetadata metadata = {};
+    Block* block = nullptr;
+    if (ReadBlockInstructions(compile_pc, &s_block_instructions, &metadata))
+      block = CreateBlock(compile_pc, s_block_instructions, metadata);
+    MemMap::EndCodeWrite();
+    if (block && block->size > 0)
+    {
+      block->execute_count = COLD_TIER_EXECUTIONS_BEFORE_COMPILE;
+      PromoteBlockToRecompiler(block);
+    }
+  }
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // MARK: - Block Management
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -410,6 +737,102 @@ CPU::CodeCache::Block* CPU::CodeCache::LookupBlock(u32 pc)
   return s_block_lut[table][idx];
 }
 
+u32 CPU::CodeCache::GetTotalBlocksCompiled()
+{
+  return s_total_blocks_compiled;
+}
+
+bool CPU::CodeCache::GetBlockInfoForHostAddress(const void* host_address, u32* out_guest_pc, u32* out_guest_size)
+{
+#ifdef ENABLE_RECOMPILER_SUPPORT
+  if (!s_code_buffer.IsValid() || host_address < s_code_buffer.GetCodePointer() ||
+      host_address >= (s_code_buffer.GetCodePointer() + s_code_buffer.GetTotalSize()))
+  {
+    return false;
+  }
+
+  // Blocks don't track their host code size, but they're emitted sequentially, so the owner is
+  // the one with the highest start address at or below the faulting address.
+  const Block* best = nullptr;
+  for (const Block* block : s_blocks)
+  {
+    if (!block->host_code || block->host_code > host_address)
+      continue;
+    if (!best || block->host_code > best->host_code)
+      best = block;
+  }
+  if (!best)
+    return false;
+
+  *out_guest_pc = best->pc;
+  *out_guest_size = best->size;
+  return true;
+#else
+  return false;
+#endif
+}
+
+void CPU::CodeCache::DrawDebugStateWindow()
+{
+  const float framebuffer_scale = Host::GetOSDScale();
+
+  ImGui::SetNextWindowSize(ImVec2(420.0f * framebuffer_scale, 250.0f * framebuffer_scale), ImGuiCond_FirstUseEver);
+  if (!ImGui::Begin("Code Cache State", nullptr))
+  {
+    ImGui::End();
+    return;
+  }
+
+  // Sample the counters once a second so the rates are readable.
+  static Common::Timer::Value s_last_sample_time = 0;
+  static u32 s_last_compiled, s_last_invalidated, s_last_links_patched, s_last_fastmem_exceptions;
+  static float s_compile_rate, s_invalidate_rate, s_link_rate, s_fastmem_exception_rate;
+  const Common::Timer::Value now = Common::Timer::GetCurrentValue();
+  const double sample_delta = Common::Timer::ConvertValueToSeconds(now - s_last_sample_time);
+  if (sample_delta >= 1.0)
+  {
+    if (s_last_sample_time != 0)
+    {
+      s_compile_rate = static_cast<float>((s_total_blocks_compiled - s_last_compiled) / sample_delta);
+      s_invalidate_rate = static_cast<float>((s_total_blocks_invalidated - s_last_invalidated) / sample_delta);
+      s_link_rate = static_cast<float>((s_total_block_links_patched - s_last_links_patched) / sample_delta);
+      s_fastmem_exception_rate =
+        static_cast<float>((s_total_fastmem_exceptions - s_last_fastmem_exceptions) / sample_delta);
+    }
+
+    s_last_compiled = s_total_blocks_compiled;
+    s_last_invalidated = s_total_blocks_invalidated;
+    s_last_links_patched = s_total_block_links_patched;
+    s_last_fastmem_exceptions = s_total_fastmem_exceptions;
+    s_last_sample_time = now;
+  }
+
+  ImGui::Text("Execution Mode: %s%s", Settings::GetCPUExecutionModeDisplayName(g_settings.cpu_execution_mode),
+              IsUsingFastmem() ? " (Fastmem)" : "");
+  ImGui::Text("Blocks: %zu resident", s_blocks.size());
+  ImGui::Text("Compiles: %u total, %.0f/sec", s_total_blocks_compiled, s_compile_rate);
+  ImGui::Text("Invalidations: %u total, %.0f/sec", s_total_blocks_invalidated, s_invalidate_rate);
+
+#ifdef ENABLE_RECOMPILER_SUPPORT
+  ImGui::Text("Links Patched: %u total, %.0f/sec (%zu active)", s_total_block_links_patched, s_link_rate,
+              s_block_links.size());
+  ImGui::Text("Fastmem Faults: %u total, %.0f/sec", s_total_fastmem_exceptions, s_fastmem_exception_rate);
+
+  if (IsUsingAnyRecompiler() && s_code_buffer.IsValid())
+  {
+    ImGui::NewLine();
+    ImGui::Text("Code Buffer: %.1f%% used (%.2f MB free)", s_code_buffer.GetUsedPct(),
+                static_cast<double>(s_code_buffer.GetFreeCodeSpace()) / 1048576.0);
+    ImGui::ProgressBar(s_code_buffer.GetUsedPct() / 100.0f, ImVec2(-1.0f, 0.0f));
+    ImGui::Text("Far Code Buffer: %.1f%% used (%.2f MB free)", s_code_buffer.GetFarUsedPct(),
+                static_cast<double>(s_code_buffer.GetFreeFarCodeSpace()) / 1048576.0);
+    ImGui::ProgressBar(s_code_buffer.GetFarUsedPct() / 100.0f, ImVec2(-1.0f, 0.0f));
+  }
+#endif
+
+  ImGui::End();
+}
+
 CPU::CodeCache::Block* CPU::CodeCache::CreateBlock(u32 pc, const BlockInstructionList& instructions,
                                                    const BlockMetadata& metadata)
 {
@@ -442,6 +865,10 @@ CPU::CodeCache::Block* CPU::CodeCache::CreateBlock(u32 pc, const BlockInstructio
       Assert(it != s_blocks.end());
       s_blocks.erase(it);
 
+#ifdef ENABLE_RECOMPILER_SUPPORT
+      RemoveBlockFromAsyncQueues(block);
+#endif
+
       block->~Block();
       std::free(block);
       block = nullptr;
@@ -457,6 +884,8 @@ CPU::CodeCache::Block* CPU::CodeCache::CreateBlock(u32 pc, const BlockInstructio
     s_blocks.push_back(block);
   }
 
+  s_total_blocks_compiled++;
+
   block->pc = pc;
   block->size = size;
   block->host_code = nullptr;
@@ -469,6 +898,7 @@ CPU::CodeCache::Block* CPU::CodeCache::CreateBlock(u32 pc, const BlockInstructio
   block->icache_line_count = metadata.icache_line_count;
   block->compile_frame = recompile_frame;
   block->compile_count = recompile_count + 1;
+  block->execute_count = 0;
 
   // copy instructions/info
   {
@@ -507,8 +937,9 @@ CPU::CodeCache::Block* CPU::CodeCache::CreateBlock(u32 pc, const BlockInstructio
     return block;
   }
 
-  // Old rec doesn't use backprop info, don't waste time filling it.
-  if (g_settings.cpu_execution_mode == CPUExecutionMode::NewRec)
+  // Both recompilers consume the backprop info: newrec for allocation/renaming, old rec for
+  // choosing eviction candidates. The cached interpreter has no use for it.
+  if (IsUsingAnyRecompiler())
     FillBlockRegInfo(block);
 
   // add it to the tracking list for its page
@@ -519,6 +950,24 @@ CPU::CodeCache::Block* CPU::CodeCache::CreateBlock(u32 pc, const BlockInstructio
 
 bool CPU::CodeCache::IsBlockCodeCurrent(const Block* block)
 {
+  // traces aren't contiguous in memory, compare instruction-by-instruction instead
+  if (block->HasFlag(BlockFlags::IsTrace)) [[unlikely]]
+  {
+    const Instruction* icode = block->Instructions();
+    const InstructionInfo* iinfo = block->InstructionsInfo();
+    for (u32 i = 0; i < block->size; i++, icode++, iinfo++)
+    {
+      // anything outside of RAM (i.e. BIOS) can't change
+      if (!AddressInRAM(iinfo->pc))
+        continue;
+
+      if (std::memcmp(&Bus::g_ram[VirtualAddressToPhysical(iinfo->pc)], &icode->bits, sizeof(Instruction)) != 0)
+        return false;
+    }
+
+    return true;
+  }
+
   // blocks shouldn't be wrapping..
   const PhysicalMemoryAddress phys_addr = VirtualAddressToPhysical(block->pc);
   DebugAssert((phys_addr + (sizeof(Instruction) * block->size)) <= Bus::g_ram_size);
@@ -670,7 +1119,15 @@ CPU::CodeCache::PageProtectionMode CPU::CodeCache::GetProtectionModeForBlock(con
 
 void CPU::CodeCache::InvalidateBlock(Block* block, BlockState new_state)
 {
+  if (block->state == BlockState::Valid)
+    s_total_blocks_invalidated++;
+
 #ifdef ENABLE_RECOMPILER_SUPPORT
+  // Hold the compile lock so the worker can't be mid-compile of this block while we flip the state.
+  std::unique_lock<std::mutex> lock;
+  if (s_compile_thread_running)
+    lock = std::unique_lock(s_compile_mutex);
+
   if (block->state == BlockState::Valid)
   {
     SetCodeLUT(block->pc, g_compile_or_revalidate_block);
@@ -708,6 +1165,7 @@ void CPU::CodeCache::ClearBlocks()
 #ifdef ENABLE_RECOMPILER_SUPPORT
   s_fastmem_backpatch_info.clear();
   s_fastmem_faulting_pcs.clear();
+  s_fastmem_faulting_page_counts.clear();
   s_block_links.clear();
 #endif
 
@@ -731,6 +1189,12 @@ Common::PageFaultHandler::HandlerResult CPU::CodeCache::ExceptionHandler(void* e
     DebugAssert(is_write);
     const u32 guest_address = static_cast<u32>(static_cast<const u8*>(fault_address) - Bus::g_ram);
     const u32 page_index = Bus::GetRAMCodePageIndex(guest_address);
+    if (Bus::HandleSnapshotWriteFault(page_index))
+    {
+      // non-code page that was only protected for snapshot dirty tracking, retry the write
+      return Common::PageFaultHandler::HandlerResult::ContinueExecution;
+    }
+
     Log_DevFmt("Page fault on protected RAM @ 0x{:08X} (page #{}), invalidating code cache.", guest_address,
                page_index);
     InvalidateBlocksWithPageIndex(page_index);
@@ -777,6 +1241,15 @@ template<PGXPMode pgxp_mode>
 #endif
       // Manually done because we don't want to compile blocks without a LUT.
       const u32 pc = g_state.pc;
+
+      // HLE for the kernel's A0 memory functions, when enabled.
+      if ((pc & PHYSICAL_MEMORY_ADDRESS_MASK) == 0xA0 && g_settings.bios_hle_memory_functions &&
+          TryKernelFunctionHLE()) [[unlikely]]
+      {
+        CHECK_DOWNCOUNT();
+        continue;
+      }
+
       const u32 table = pc >> LUT_TABLE_SHIFT;
       Block* block;
       if (s_block_lut[table])
@@ -821,9 +1294,21 @@ template<PGXPMode pgxp_mode>
 
       // Handle self-looping blocks
       if (g_state.pc == block->pc)
+      {
+        // Idle loop which is still spinning: burn the rest of the slice, the next event is what
+        // changes whatever it's polling.
+        if (block->HasFlag(BlockFlags::IsIdleLoop)) [[unlikely]]
+        {
+          g_state.pending_ticks = std::max(g_state.pending_ticks, g_state.downcount);
+          break;
+        }
+
         goto reexecute_block;
+      }
       else
+      {
         continue;
+      }
 
     interpret_block:
       InterpretUncachedBlock<pgxp_mode>();
@@ -886,6 +1371,12 @@ bool CPU::CodeCache::ReadBlockInstructions(u32 start_pc, BlockInstructionList* i
   bool is_branch_delay_slot = false;
   bool is_load_delay_slot = false;
 
+  // Superblocks only make sense for the cached interpreter, the recompilers stop emitting at the
+  // first branch anyway, and would charge fetch ticks for a tail which never executes.
+  const bool follow_unconditional_branches =
+    (g_settings.cpu_cached_interpreter_superblocks &&
+     g_settings.cpu_execution_mode == CPUExecutionMode::CachedInterpreter);
+
 #if 0
   if (pc == 0x0005aa90)
     __debugbreak();
@@ -984,7 +1475,30 @@ bool CPU::CodeCache::ReadBlockInstructions(u32 start_pc, BlockInstructionList* i
     // if we're in a branch delay slot, the block is now done
     // except if this is a branch in a branch delay slot, then we grab the one after that, and so on...
     if (is_branch_delay_slot && !info.is_branch_instruction)
+    {
+      // Trace formation: follow forward unconditional direct branches instead of ending the block.
+      // Since the branch always executes, the whole trace executes, and tick accounting stays exact.
+      // The page check above still breaks the trace if it would leave the starting page, so page
+      // protection behaves the same as for basic blocks. Forward-only targets guarantee termination.
+      if (follow_unconditional_branches && instructions->size() < MAX_TRACE_INSTRUCTIONS)
+      {
+        const BlockInstructionInfoPair& branch = (*instructions)[instructions->size() - 2];
+        if (branch.second.is_unconditional_branch_instruction && branch.second.is_direct_branch_instruction)
+        {
+          const u32 target = GetDirectBranchTarget(branch.first, branch.second.pc);
+          if (target > info.pc)
+          {
+            metadata->flags |= BlockFlags::IsTrace;
+            is_branch_delay_slot = false;
+            is_load_delay_slot = info.has_load_delay;
+            pc = target;
+            continue;
+          }
+        }
+      }
+
       break;
+    }
 
     // if this is a branch, we grab the next instruction (delay slot), and then exit
     is_branch_delay_slot = info.is_branch_instruction;
@@ -1005,6 +1519,12 @@ bool CPU::CodeCache::ReadBlockInstructions(u32 start_pc, BlockInstructionList* i
 
   instructions->back().second.is_last_instruction = true;
 
+  if (g_settings.cpu_idle_loop_detection && IsIdleLoop(start_pc, *instructions))
+  {
+    Log_DevFmt("Detected idle loop at 0x{:08X}", start_pc);
+    metadata->flags |= BlockFlags::IsIdleLoop;
+  }
+
 #ifdef _DEBUG
   SmallString disasm;
   Log_DebugPrintf("Block at 0x%08X", start_pc);
@@ -1019,6 +1539,200 @@ bool CPU::CodeCache::ReadBlockInstructions(u32 start_pc, BlockInstructionList* i
   return true;
 }
 
+bool CPU::CodeCache::IsIdleLoopBodyInstruction(Instruction instruction, u64* read_mask, u64* write_mask)
+{
+  // Whitelist of instructions which are idempotent given the same memory state: plain ALU ops,
+  // mult/div, loads, and the branch forms IsIdleLoop() accepts as the terminator. Stores,
+  // coprocessor accesses and anything which links are all excluded, since re-running the loop
+  // after skipping time forward must be equivalent to having spun on it. Also reports which
+  // registers the instruction reads and writes, so the caller can reject loop-carried state;
+  // bits 0-31 are the GPRs, 32/33 are hi/lo, and $zero is dropped since it can't carry anything.
+  static constexpr u64 HI_MASK = (u64(1) << 32);
+  static constexpr u64 LO_MASK = (u64(1) << 33);
+  const auto reg_mask = [](Reg reg) -> u64 {
+    return (reg == Reg::zero) ? 0 : (u64(1) << static_cast<u8>(reg));
+  };
+
+  *read_mask = 0;
+  *write_mask = 0;
+
+  switch (instruction.op)
+  {
+    case InstructionOp::funct:
+    {
+      switch (instruction.r.funct)
+      {
+        case InstructionFunct::sll:
+        case InstructionFunct::srl:
+        case InstructionFunct::sra:
+          *read_mask = reg_mask(instruction.r.rt);
+          *write_mask = reg_mask(instruction.r.rd);
+          return true;
+
+        case InstructionFunct::sllv:
+        case InstructionFunct::srlv:
+        case InstructionFunct::srav:
+        case InstructionFunct::add:
+        case InstructionFunct::addu:
+        case InstructionFunct::sub:
+        case InstructionFunct::subu:
+        case InstructionFunct::and_:
+        case InstructionFunct::or_:
+        case InstructionFunct::xor_:
+        case InstructionFunct::nor:
+        case InstructionFunct::slt:
+        case InstructionFunct::sltu:
+          *read_mask = reg_mask(instruction.r.rs) | reg_mask(instruction.r.rt);
+          *write_mask = reg_mask(instruction.r.rd);
+          return true;
+
+        case InstructionFunct::mfhi:
+          *read_mask = HI_MASK;
+          *write_mask = reg_mask(instruction.r.rd);
+          return true;
+
+        case InstructionFunct::mflo:
+          *read_mask = LO_MASK;
+          *write_mask = reg_mask(instruction.r.rd);
+          return true;
+
+        case InstructionFunct::mthi:
+          *read_mask = reg_mask(instruction.r.rs);
+          *write_mask = HI_MASK;
+          return true;
+
+        case InstructionFunct::mtlo:
+          *read_mask = reg_mask(instruction.r.rs);
+          *write_mask = LO_MASK;
+          return true;
+
+        case InstructionFunct::mult:
+        case InstructionFunct::multu:
+        case InstructionFunct::div:
+        case InstructionFunct::divu:
+          *read_mask = reg_mask(instruction.r.rs) | reg_mask(instruction.r.rt);
+          *write_mask = HI_MASK | LO_MASK;
+          return true;
+
+        default:
+          return false;
+      }
+    }
+
+    case InstructionOp::addi:
+    case InstructionOp::addiu:
+    case InstructionOp::slti:
+    case InstructionOp::sltiu:
+    case InstructionOp::andi:
+    case InstructionOp::ori:
+    case InstructionOp::xori:
+    case InstructionOp::lb:
+    case InstructionOp::lh:
+    case InstructionOp::lw:
+    case InstructionOp::lbu:
+    case InstructionOp::lhu:
+      *read_mask = reg_mask(instruction.i.rs);
+      *write_mask = reg_mask(instruction.i.rt);
+      return true;
+
+    case InstructionOp::lui:
+      *write_mask = reg_mask(instruction.i.rt);
+      return true;
+
+    case InstructionOp::lwl:
+    case InstructionOp::lwr:
+      // Merges the loaded bytes with the existing register contents.
+      *read_mask = reg_mask(instruction.i.rs) | reg_mask(instruction.i.rt);
+      *write_mask = reg_mask(instruction.i.rt);
+      return true;
+
+    case InstructionOp::j:
+      return true;
+
+    case InstructionOp::beq:
+    case InstructionOp::bne:
+      *read_mask = reg_mask(instruction.i.rs) | reg_mask(instruction.i.rt);
+      return true;
+
+    case InstructionOp::blez:
+    case InstructionOp::bgtz:
+    case InstructionOp::b:
+      // bltzal/bgezal also write ra, but IsIdleLoop() rejects those before getting here.
+      *read_mask = reg_mask(instruction.i.rs);
+      return true;
+
+    default:
+      return false;
+  }
+}
+
+bool CPU::CodeCache::IsIdleLoop(u32 start_pc, const BlockInstructionList& instructions)
+{
+  // Needs at least a branch and its delay slot.
+  if (instructions.size() < 2)
+    return false;
+
+  // The terminating branch must be a non-linking direct branch back to the start of the block.
+  const BlockInstructionInfoPair& branch = instructions[instructions.size() - 2];
+  if (!branch.second.is_branch_instruction || !branch.second.is_direct_branch_instruction ||
+      GetDirectBranchTarget(branch.first, branch.second.pc) != start_pc)
+  {
+    return false;
+  }
+
+  switch (branch.first.op)
+  {
+    case InstructionOp::j:
+    case InstructionOp::beq:
+    case InstructionOp::bne:
+    case InstructionOp::blez:
+    case InstructionOp::bgtz:
+      break;
+
+    case InstructionOp::b:
+    {
+      // bltzal/bgezal write ra, which isn't idempotent.
+      if ((static_cast<u8>(branch.first.i.rt.GetValue()) & u8(0x1E)) == u8(0x10))
+        return false;
+    }
+    break;
+
+    default:
+      return false;
+  }
+
+  // Body (including the delay slot) must be free of side effects, and nothing may carry state
+  // between iterations. Otherwise cycle-counted delay loops (addiu s0, s0, -1; bnez s0, loop)
+  // would be classified as idle, and skipping time forward would change how many iterations
+  // they run for. First work out which registers the loop writes at all.
+  u64 written_mask = 0;
+  for (size_t i = 0; i < instructions.size(); i++)
+  {
+    u64 read_mask, write_mask;
+    if (!IsIdleLoopBodyInstruction(instructions[i].first, &read_mask, &write_mask))
+      return false;
+
+    written_mask |= write_mask;
+  }
+
+  // Then walk in program order: a register read is only acceptable if the loop never writes it
+  // (invariant), or it was already re-derived this iteration from loads/immediates/invariants.
+  // Registers written in the delay slot reach the next iteration's reads, which the first pass
+  // already accounts for.
+  u64 fresh_mask = 0;
+  for (size_t i = 0; i < instructions.size(); i++)
+  {
+    u64 read_mask, write_mask;
+    IsIdleLoopBodyInstruction(instructions[i].first, &read_mask, &write_mask);
+    if ((read_mask & written_mask & ~fresh_mask) != 0)
+      return false;
+
+    fresh_mask |= write_mask;
+  }
+
+  return true;
+}
+
 void CPU::CodeCache::CopyRegInfo(InstructionInfo* dst, const InstructionInfo* src)
 {
   std::memcpy(dst->reg_flags, src->reg_flags, sizeof(dst->reg_flags));
@@ -1292,19 +2006,48 @@ void CPU::CodeCache::CompileOrRevalidateBlock(u32 start_pc)
 {
   // TODO: this doesn't currently handle when the cache overflows...
   DebugAssert(IsUsingAnyRecompiler());
+
+  // Publish anything the worker finished first, it might include this block.
+  ProcessAsyncCompilationResults();
+
+  // While the kernel HLE fast path is enabled, calls through the A0 dispatch vector can be
+  // serviced natively without running the dispatcher at all. The vector is pinned to the cold
+  // tier (see ExecuteColdBlock()), so every call keeps funnelling through here.
+  if (g_settings.bios_hle_memory_functions && (start_pc & PHYSICAL_MEMORY_ADDRESS_MASK) == 0xA0 &&
+      TryKernelFunctionHLE()) [[unlikely]]
+  {
+    return;
+  }
+
   MemMap::BeginCodeWrite();
 
   Block* block = LookupBlock(start_pc);
   if (block)
   {
-    // we should only be here if the block got invalidated
-    DebugAssert(block->state != BlockState::Valid);
+    // still-valid blocks land here while they're in the cold tier, since the LUT keeps pointing at
+    // us until they've executed enough times to be worth compiling
+    if (block->state == BlockState::Valid)
+    {
+      DebugAssert(!block->host_code);
+      MemMap::EndCodeWrite();
+      ExecuteColdBlock(block);
+      return;
+    }
+
     if (RevalidateBlock(block))
     {
-      DebugAssert(block->host_code);
-      SetCodeLUT(start_pc, block->host_code);
-      BacklinkBlocks(start_pc, block->host_code);
+      if (block->host_code)
+      {
+        SetCodeLUT(start_pc, block->host_code);
+        BacklinkBlocks(start_pc, block->host_code);
+        MemMap::EndCodeWrite();
+        return;
+      }
+
+      // Got invalidated before it was compiled - resume the cold tier. If it was already sitting
+      // in the worker's queue, the duplicate entry gets skipped once host_code is set.
       MemMap::EndCodeWrite();
+      ExecuteColdBlock(block);
       return;
     }
 
@@ -1322,28 +2065,100 @@ void CPU::CodeCache::CompileOrRevalidateBlock(u32 start_pc)
     return;
   }
 
+  if ((block = CreateBlock(start_pc, s_block_instructions, metadata)) == nullptr || block->size == 0)
+  {
+    Log_ErrorFmt("Failed to compile block at 0x{:08X}, falling back to uncached interpreter", start_pc);
+    SetCodeLUT(start_pc, g_interpret_block);
+    BacklinkBlocks(start_pc, g_interpret_block);
+    MemMap::EndCodeWrite();
+    return;
+  }
+
+  // New blocks start in the cold tier, ExecuteColdBlock() hands them to the recompiler once
+  // they've proven themselves.
+  MemMap::EndCodeWrite();
+  ExecuteColdBlock(block);
+}
+
+void CPU::CodeCache::InterpretCachedBlockForCurrentSettings(const Block* block)
+{
+  if (g_settings.gpu_pgxp_enable)
+  {
+    if (g_settings.gpu_pgxp_cpu)
+      InterpretCachedBlock<PGXPMode::CPU>(block);
+    else
+      InterpretCachedBlock<PGXPMode::Memory>(block);
+  }
+  else
+  {
+    InterpretCachedBlock<PGXPMode::Disabled>(block);
+  }
+}
+
+void CPU::CodeCache::ExecuteColdBlock(Block* block)
+{
+  if (block->execute_count < COLD_TIER_EXECUTIONS_BEFORE_COMPILE)
+  {
+    block->execute_count++;
+
+    if (g_settings.cpu_recompiler_icache)
+      CheckAndUpdateICacheTags(block->icache_line_count, block->uncached_fetch_ticks);
+
+    InterpretCachedBlockForCurrentSettings(block);
+    return;
+  }
+
+  // Kernel call vectors never get promoted while the HLE fast path is active, otherwise the LUT
+  // would point at compiled code and CompileOrRevalidateBlock() would stop seeing the calls.
+  if (g_settings.bios_hle_memory_functions && (block->pc & PHYSICAL_MEMORY_ADDRESS_MASK) == 0xA0) [[unlikely]]
+  {
+    if (g_settings.cpu_recompiler_icache)
+      CheckAndUpdateICacheTags(block->icache_line_count, block->uncached_fetch_ticks);
+
+    InterpretCachedBlockForCurrentSettings(block);
+    return;
+  }
+
+  // Crossed the threshold, it's worth the recompiler's time now.
+  PromoteBlockToRecompiler(block);
+}
+
+void CPU::CodeCache::PromoteBlockToRecompiler(Block* block)
+{
+  MemMap::BeginCodeWrite();
+
   // Ensure we're not going to run out of space while compiling this block.
   // We could definitely do better here... TODO: far code is no longer needed for newrec
-  const u32 block_size = static_cast<u32>(s_block_instructions.size());
-  if (s_code_buffer.GetFreeCodeSpace() < (block_size * Recompiler::MAX_NEAR_HOST_BYTES_PER_INSTRUCTION) ||
-      s_code_buffer.GetFreeFarCodeSpace() < (block_size * Recompiler::MAX_FAR_HOST_BYTES_PER_INSTRUCTION))
+  if (s_code_buffer.GetFreeCodeSpace() < (block->size * Recompiler::MAX_NEAR_HOST_BYTES_PER_INSTRUCTION) ||
+      s_code_buffer.GetFreeFarCodeSpace() < (block->size * Recompiler::MAX_FAR_HOST_BYTES_PER_INSTRUCTION))
   {
-    Log_ErrorFmt("Out of code space while compiling {:08X}. Resetting code cache.", start_pc);
+    Log_ErrorFmt("Out of code space while compiling {:08X}. Resetting code cache.", block->pc);
     CodeCache::Reset();
+    MemMap::EndCodeWrite();
+    return;
   }
 
-  if ((block = CreateBlock(start_pc, s_block_instructions, metadata)) == nullptr || block->size == 0 ||
-      !CompileBlock(block))
+  if (s_compile_thread_running)
   {
-    Log_ErrorFmt("Failed to compile block at 0x{:08X}, falling back to uncached interpreter", start_pc);
-    SetCodeLUT(start_pc, g_interpret_block);
-    BacklinkBlocks(start_pc, g_interpret_block);
+    // Interpreter covers the block until the worker publishes the compiled version.
+    SetCodeLUT(block->pc, g_interpret_block);
+    BacklinkBlocks(block->pc, g_interpret_block);
+    QueueBlockForAsyncCompilation(block);
+    MemMap::EndCodeWrite();
+    return;
+  }
+
+  if (!CompileBlock(block))
+  {
+    Log_ErrorFmt("Failed to compile block at 0x{:08X}, falling back to uncached interpreter", block->pc);
+    SetCodeLUT(block->pc, g_interpret_block);
+    BacklinkBlocks(block->pc, g_interpret_block);
     MemMap::EndCodeWrite();
     return;
   }
 
-  SetCodeLUT(start_pc, block->host_code);
-  BacklinkBlocks(start_pc, block->host_code);
+  SetCodeLUT(block->pc, block->host_code);
+  BacklinkBlocks(block->pc, block->host_code);
   MemMap::EndCodeWrite();
 }
 
@@ -1371,7 +2186,9 @@ const void* CPU::CodeCache::CreateBlockLink(Block* block, void* code, u32 newpc)
     const Block* next_block = LookupBlock(newpc);
     if (next_block)
     {
-      dst = (next_block->state == BlockState::Valid) ?
+      // cold-tier blocks are valid but don't have host code yet, keep them going through the
+      // compiler stub so their execution count still advances
+      dst = (next_block->state == BlockState::Valid && next_block->host_code) ?
               next_block->host_code :
               ((next_block->state == BlockState::FallbackToInterpreter) ? g_interpret_block :
                                                                           g_compile_or_revalidate_block);
@@ -1392,6 +2209,17 @@ const void* CPU::CodeCache::CreateBlockLink(Block* block, void* code, u32 newpc)
   return dst;
 }
 
+bool CPU::CodeCache::CanElideBlockLinkEventTest(const Block* from_block, u32 newpc)
+{
+  // With the CPU overclocked, each frame dispatches proportionally more blocks, and the per-block
+  // downcount test becomes a measurable slice of dispatch time. Forward links can skip it safely:
+  // every elided edge jumps to a strictly higher PC, so any loop must take a backward or indirect
+  // exit, which still performs the test. Events and interrupts are then serviced at most one
+  // forward chain late, well within the timing slop overclocking already introduces. At stock
+  // clocks the exact per-block test is kept.
+  return g_settings.cpu_overclock_active && newpc > from_block->pc;
+}
+
 void CPU::CodeCache::BacklinkBlocks(u32 pc, const void* dst)
 {
   if (!g_settings.cpu_recompiler_block_linking)
@@ -1403,6 +2231,7 @@ void CPU::CodeCache::BacklinkBlocks(u32 pc, const void* dst)
     Log_DebugPrintf("Backlinking %p with dst pc %08X to %p%s", it->second, pc, dst,
                     (dst == g_compile_or_revalidate_block) ? "[compiler]" : "");
     EmitJump(it->second, dst, true);
+    s_total_block_links_patched++;
   }
 }
 
@@ -1581,6 +2410,12 @@ Common::PageFaultHandler::HandlerResult CPU::CodeCache::HandleFastmemException(v
 
     guest_address = static_cast<PhysicalMemoryAddress>(
       static_cast<ptrdiff_t>(static_cast<u8*>(fault_address) - static_cast<u8*>(g_state.fastmem_base)));
+
+    // RAM mirrors are mapped as aliased views, fold them down to the first mapping so code
+    // page lookups and write faults resolve to the correct page.
+    const PhysicalMemoryAddress phys_address = guest_address & PHYSICAL_MEMORY_ADDRESS_MASK;
+    if (phys_address < Bus::RAM_MIRROR_END)
+      guest_address = (guest_address & ~PHYSICAL_MEMORY_ADDRESS_MASK) | (phys_address & Bus::g_ram_mask);
   }
   else
 #endif
@@ -1589,6 +2424,15 @@ Common::PageFaultHandler::HandlerResult CPU::CodeCache::HandleFastmemException(v
     guest_address = std::numeric_limits<PhysicalMemoryAddress>::max();
   }
 
+#ifdef ENABLE_MMAP_FASTMEM
+  if (is_write && !g_state.cop0_regs.sr.Isc && g_settings.cpu_fastmem_mode == CPUFastmemMode::MMap &&
+      AddressInRAM(guest_address) && Bus::HandleSnapshotWriteFault(Bus::GetRAMCodePageIndex(guest_address)))
+  {
+    // non-code page that was only protected for snapshot dirty tracking, retry the write
+    return Common::PageFaultHandler::HandlerResult::ContinueExecution;
+  }
+#endif
+
   Log_DevFmt("Page fault handler invoked at PC={} Address={} {}, fastmem offset {:08X}", exception_pc, fault_address,
              is_write ? "(write)" : "(read)", guest_address);
 
@@ -1599,6 +2443,8 @@ Common::PageFaultHandler::HandlerResult CPU::CodeCache::HandleFastmemException(v
     return Common::PageFaultHandler::HandlerResult::ExecuteNextHandler;
   }
 
+  s_total_fastmem_exceptions++;
+
   // if we're writing to ram, let it go through a few times, and use manual block protection to sort it out
   // TODO: path for manual protection to return back to read-only pages
   LoadstoreBackpatchInfo& info = iter->second;
@@ -1639,6 +2485,8 @@ Common::PageFaultHandler::HandlerResult CPU::CodeCache::HandleFastmemException(v
 
   // and store the pc in the faulting list, so that we don't emit another fastmem loadstore
   s_fastmem_faulting_pcs.insert(info.guest_pc);
+  if (AddressInRAM(info.guest_pc))
+    s_fastmem_faulting_page_counts[Bus::GetRAMCodePageIndex(info.guest_pc)]++;
   s_fastmem_backpatch_info.erase(iter);
   return Common::PageFaultHandler::HandlerResult::ContinueExecution;
 }
@@ -1648,6 +2496,15 @@ bool CPU::CodeCache::HasPreviouslyFaultedOnPC(u32 guest_pc)
   return (s_fastmem_faulting_pcs.find(guest_pc) != s_fastmem_faulting_pcs.end());
 }
 
+bool CPU::CodeCache::HasPreviouslyFaultedOnPage(u32 guest_pc)
+{
+  if (!AddressInRAM(guest_pc))
+    return false;
+
+  const auto iter = s_fastmem_faulting_page_counts.find(Bus::GetRAMCodePageIndex(guest_pc));
+  return (iter != s_fastmem_faulting_page_counts.end() && iter->second >= FASTMEM_FAULTING_PAGE_DEMOTE_THRESHOLD);
+}
+
 void CPU::CodeCache::BackpatchLoadStore(void* host_pc, const LoadstoreBackpatchInfo& info)
 {
 #ifdef ENABLE_RECOMPILER
@@ -1660,4 +2517,181 @@ void CPU::CodeCache::BackpatchLoadStore(void* host_pc, const LoadstoreBackpatchI
 #endif
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// MARK: - Asynchronous Compilation
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void CPU::CodeCache::StartCompileThread()
+{
+  if (s_compile_thread_running || !g_settings.cpu_recompiler_async_compile)
+    return;
+
+  s_compile_thread_shutdown = false;
+  s_compile_thread_running = true;
+  s_compile_thread = std::thread(&CompileThreadEntryPoint);
+}
+
+void CPU::CodeCache::StopCompileThread()
+{
+  if (!s_compile_thread_running)
+    return;
+
+  {
+    std::unique_lock lock(s_compile_mutex);
+    s_compile_thread_shutdown = true;
+    s_compile_queue_cv.notify_one();
+  }
+
+  s_compile_thread.join();
+  s_compile_thread_running = false;
+  s_compile_queue.clear();
+  s_async_compiled_blocks.clear();
+}
+
+void CPU::CodeCache::QueueBlockForAsyncCompilation(Block* block)
+{
+  DebugAssert(s_compile_thread_running);
+
+  std::unique_lock lock(s_compile_mutex);
+  s_compile_queue.push_back(block);
+  s_compile_queue_cv.notify_one();
+}
+
+void CPU::CodeCache::RemoveBlockFromAsyncQueues(Block* block)
+{
+  if (!s_compile_thread_running)
+    return;
+
+  std::unique_lock lock(s_compile_mutex);
+  std::erase(s_compile_queue, block);
+  std::erase(s_async_compiled_blocks, block);
+}
+
+void CPU::CodeCache::CompileThreadEntryPoint()
+{
+  Threading::SetNameOfCurrentThread("CPU Block Compiler");
+
+  std::unique_lock lock(s_compile_mutex);
+  while (!s_compile_thread_shutdown)
+  {
+    if (s_compile_queue.empty())
+    {
+      s_compile_queue_cv.wait(lock);
+      continue;
+    }
+
+    Block* block = s_compile_queue.front();
+    s_compile_queue.pop_front();
+
+    // Might have been invalidated, or already compiled via a revalidate, while it sat in the queue.
+    if (block->state != BlockState::Valid || block->host_code)
+      continue;
+
+    MemMap::BeginCodeWrite();
+    const bool okay = CompileBlock(block);
+    MemMap::EndCodeWrite();
+
+    // Publishing happens on the CPU thread, all we do here is hand the block back.
+    if (okay)
+      s_async_compiled_blocks.push_back(block);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// MARK: - Persistent Block Cache
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::string CPU::CodeCache::GetWarmBlockCacheFilename(const std::string& serial)
+{
+  return Path::Combine(EmuFolders::Cache, fmt::format("{}_blocks.bin", serial));
+}
+
+void CPU::CodeCache::SaveWarmBlockList()
+{
+  if (s_warm_block_serial.empty() || s_blocks.empty() || !IsUsingAnyRecompiler())
+    return;
+
+  std::unique_ptr<ByteStream> stream(
+    ByteStream::OpenFile(GetWarmBlockCacheFilename(s_warm_block_serial).c_str(),
+                         BYTESTREAM_OPEN_CREATE | BYTESTREAM_OPEN_WRITE | BYTESTREAM_OPEN_TRUNCATE |
+                           BYTESTREAM_OPEN_STREAMED | BYTESTREAM_OPEN_ATOMIC_UPDATE));
+  if (!stream)
+  {
+    Log_ErrorFmt("Failed to open block cache for '{}' for writing", s_warm_block_serial);
+    return;
+  }
+
+  u32 count = 0;
+  for (const Block* block : s_blocks)
+  {
+    if (block->size == 0 || block->state == BlockState::FallbackToInterpreter)
+      continue;
+
+    count++;
+  }
+  count = std::min(count, WARM_BLOCK_CACHE_MAX_ENTRIES);
+
+  bool result = stream->WriteU32(WARM_BLOCK_CACHE_SIGNATURE);
+  result = result && stream->WriteU32(WARM_BLOCK_CACHE_VERSION);
+  result = result && stream->WriteU32(count);
+
+  u32 written = 0;
+  for (const Block* block : s_blocks)
+  {
+    if (!result || written == count)
+      break;
+
+    if (block->size == 0 || block->state == BlockState::FallbackToInterpreter)
+      continue;
+
+    const u32 crc = static_cast<u32>(
+      crc32(crc32(0, nullptr, 0), reinterpret_cast<const Bytef*>(block->Instructions()), block->size * sizeof(Instruction)));
+    result = result && stream->WriteU32(block->pc);
+    result = result && stream->WriteU32(block->size);
+    result = result && stream->WriteU32(crc);
+    written++;
+  }
+
+  if (!result || !stream->Commit())
+  {
+    Log_ErrorFmt("Failed to write block cache for '{}'", s_warm_block_serial);
+    stream->Discard();
+    return;
+  }
+
+  Log_InfoFmt("Saved {} blocks to cache for '{}'", written, s_warm_block_serial);
+}
+
+void CPU::CodeCache::LoadWarmBlockList()
+{
+  std::unique_ptr<ByteStream> stream(ByteStream::OpenFile(GetWarmBlockCacheFilename(s_warm_block_serial).c_str(),
+                                                          BYTESTREAM_OPEN_READ | BYTESTREAM_OPEN_STREAMED));
+  if (!stream)
+    return;
+
+  u32 signature, version, count;
+  if (!stream->ReadU32(&signature) || !stream->ReadU32(&version) || !stream->ReadU32(&count) ||
+      signature != WARM_BLOCK_CACHE_SIGNATURE || version != WARM_BLOCK_CACHE_VERSION ||
+      count > WARM_BLOCK_CACHE_MAX_ENTRIES)
+  {
+    Log_WarningFmt("Block cache for '{}' is corrupted or out of date", s_warm_block_serial);
+    return;
+  }
+
+  s_warm_blocks.reserve(count);
+  for (u32 i = 0; i < count; i++)
+  {
+    WarmBlockEntry entry;
+    if (!stream->ReadU32(&entry.pc) || !stream->ReadU32(&entry.size) || !stream->ReadU32(&entry.crc))
+    {
+      s_warm_blocks = {};
+      return;
+    }
+
+    s_warm_blocks.push_back(entry);
+  }
+
+  Log_InfoFmt("Loaded {} blocks from cache for '{}'", count, s_warm_block_serial);
+}
+
 #endif // ENABLE_RECOMPILER_SUPPORT
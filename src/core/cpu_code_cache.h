@@ -6,6 +6,8 @@
 #include "bus.h"
 #include "cpu_types.h"
 
+#include <string>
+
 namespace CPU::CodeCache {
 
 /// Returns true if any recompiler is in use.
@@ -29,6 +31,19 @@ void Shutdown();
 /// Runs the system.
 [[noreturn]] void Execute();
 
+/// Publishes any blocks which have been compiled by the background compilation thread.
+void ProcessAsyncCompilationResults();
+
+/// Switches the persistent block cache over to a new game, saving the previous game's block list.
+void GameSerialChanged(const std::string& serial);
+
+/// Compiles a batch of blocks from the persistent block cache. Called once per frame.
+void PrecompileWarmBlocks();
+
+/// Periodically recompiles heavily-linked blocks back-to-back to keep the dispatcher's working
+/// set dense in the code buffer. Called once per frame.
+void RelayoutHotBlocks();
+
 /// Flushes the code cache, forcing all blocks to be recompiled.
 void Reset();
 
@@ -38,4 +53,14 @@ void InvalidateBlocksWithPageIndex(u32 page_index);
 /// Invalidates all blocks in the cache.
 void InvalidateAllRAMBlocks();
 
+/// Returns the number of blocks compiled (including recompiles) since the system was initialized.
+u32 GetTotalBlocksCompiled();
+
+/// Maps a host code address back to the guest block it was compiled from, for crash reporting.
+/// Returns false if the address does not lie within the recompiler's code buffer.
+bool GetBlockInfoForHostAddress(const void* host_address, u32* out_guest_pc, u32* out_guest_size);
+
+/// Draws the compilation/invalidation/fault telemetry debug window.
+void DrawDebugStateWindow();
+
 } // namespace CPU::CodeCache
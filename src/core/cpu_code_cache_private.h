@@ -36,7 +36,9 @@ enum : u32
 
 using CodeLUT = const void**;
 using CodeLUTArray = std::array<CodeLUT, LUT_TABLE_COUNT>;
-using BlockLinkMap = std::unordered_multimap<u32, void*>; // TODO: try ordered?
+// Ordered by target PC, so that backlinking after compilation touches a contiguous range of nodes,
+// and invalidation storms don't walk a hash table that's mostly dead entries.
+using BlockLinkMap = std::multimap<u32, void*>;
 
 enum RegInfoFlags : u8
 {
@@ -100,6 +102,8 @@ enum class BlockFlags : u8
   ContainsLoadStoreInstructions = (1 << 0),
   SpansPages = (1 << 1),
   BranchDelaySpansPages = (1 << 2),
+  IsTrace = (1 << 3),
+  IsIdleLoop = (1 << 4),
 };
 IMPLEMENT_ENUM_CLASS_BITWISE_OPERATORS(BlockFlags);
 
@@ -145,6 +149,9 @@ struct alignas(16) Block
   u32 compile_frame;
   u8 compile_count;
 
+  // executions spent in the cold (cached interpreter) tier before promotion to the recompiler
+  u8 execute_count;
+
   // followed by Instruction * size, InstructionRegInfo * size
   ALWAYS_INLINE const Instruction* Instructions() const { return reinterpret_cast<const Instruction*>(this + 1); }
   ALWAYS_INLINE Instruction* Instructions() { return reinterpret_cast<Instruction*>(this + 1); }
@@ -251,12 +258,14 @@ const void* GetInterpretUncachedBlockFunction();
 void CompileOrRevalidateBlock(u32 start_pc);
 void DiscardAndRecompileBlock(u32 start_pc);
 const void* CreateBlockLink(Block* from_block, void* code, u32 newpc);
+bool CanElideBlockLinkEventTest(const Block* from_block, u32 newpc);
 
 void AddLoadStoreInfo(void* code_address, u32 code_size, u32 guest_pc, const void* thunk_address);
 void AddLoadStoreInfo(void* code_address, u32 code_size, u32 guest_pc, u32 guest_block, TickCount cycles,
                       u32 gpr_bitmask, u8 address_register, u8 data_register, MemoryAccessSize size, bool is_signed,
                       bool is_load);
 bool HasPreviouslyFaultedOnPC(u32 guest_pc);
+bool HasPreviouslyFaultedOnPage(u32 guest_pc);
 
 u32 EmitASMFunctions(void* code, u32 code_size);
 u32 EmitJump(void* code, const void* dst, bool flush_icache);
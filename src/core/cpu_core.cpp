@@ -11,9 +11,11 @@
 #include "cpu_core_private.h"
 #include "cpu_disasm.h"
 #include "cpu_recompiler_thunks.h"
+#include "gpu.h"
 #include "gte.h"
 #include "host.h"
 #include "pcdrv.h"
+#include "performance_profiler.h"
 #include "cpu_pgxp.h"
 #include "settings.h"
 #include "system.h"
@@ -45,6 +47,9 @@ static void Cop0ExecutionBreakpointCheck();
 template<MemoryAccessType type>
 static void Cop0DataBreakpointCheck(VirtualMemoryAddress address);
 static bool BreakpointCheck();
+static void UpdateMemoryWatchpointBounds();
+static void MemoryWatchpointCheck(MemoryAccessType type, MemoryAccessSize size, VirtualMemoryAddress address,
+                                  u32 value);
 
 #ifdef _DEBUG
 static void TracePrintInstruction();
@@ -57,6 +62,8 @@ static void LogInstruction(u32 bits, u32 pc, Registers* regs);
 static void HandleWriteSyscall();
 static void HandlePutcSyscall();
 static void HandlePutsSyscall();
+static bool IsKernelHLEWritableRange(VirtualMemoryAddress addr, u32 size);
+static bool IsKernelHLEReadableRange(VirtualMemoryAddress addr, u32 size);
 static void ExecuteDebug();
 
 template<PGXPMode pgxp_mode, bool debug>
@@ -93,6 +100,15 @@ static constexpr u32 INVALID_BREAKPOINT_PC = UINT32_C(0xFFFFFFFF);
 static std::vector<Breakpoint> s_breakpoints;
 static u32 s_breakpoint_counter = 1;
 static u32 s_last_breakpoint_check_pc = INVALID_BREAKPOINT_PC;
+
+static std::vector<MemoryWatchpoint> s_memory_watchpoints;
+static u32 s_memory_watchpoint_counter = 1;
+
+// Physical address range covered by enabled watchpoints, used as a cheap reject before scanning the
+// list. min > max when the list is empty or everything is disabled.
+static u32 s_memory_watchpoint_min_address = 0xFFFFFFFFu;
+static u32 s_memory_watchpoint_max_address = 0;
+
 static bool s_single_step = false;
 static bool s_single_step_done = false;
 } // namespace CPU
@@ -164,6 +180,7 @@ void CPU::Initialize()
 void CPU::Shutdown()
 {
   ClearBreakpoints();
+  ClearMemoryWatchpoints();
   StopTrace();
 }
 
@@ -245,7 +262,7 @@ bool CPU::DoState(StateWrapper& sw)
   }
 
   sw.Do(&g_state.cache_control.bits);
-  sw.DoBytes(g_state.scratchpad.data(), g_state.scratchpad.size());
+  sw.DoBytes(g_state.scratchpad.data(), SCRATCHPAD_SIZE);
 
   if (!GTE::DoState(sw))
     return false;
@@ -747,6 +764,159 @@ void CPU::HandleB0Syscall()
     HandlePutsSyscall();
 }
 
+// Approximate cost of the kernel routines serviced by TryKernelFunctionHLE(). The real
+// implementations are bytewise loops running from cached kernel code, so the bulk of the cost
+// scales with the length; the constant covers the A0 trampoline, table dispatch and return.
+enum : TickCount
+{
+  KERNEL_HLE_CALL_OVERHEAD_TICKS = 60,
+  KERNEL_HLE_MEMCPY_TICKS_PER_BYTE = 10,
+  KERNEL_HLE_MEMSET_TICKS_PER_BYTE = 7,
+  KERNEL_HLE_STRCMP_TICKS_PER_BYTE = 14,
+};
+
+// Anything larger than this is almost certainly garbage arguments; the emulated routine deals
+// with those, keeping event timing closer to hardware in the degenerate case.
+static constexpr u32 KERNEL_HLE_MAX_SIZE = 0x200000;
+
+bool CPU::IsKernelHLEWritableRange(VirtualMemoryAddress addr, u32 size)
+{
+  // If both endpoints land in RAM (or both in the scratchpad) and the range doesn't cross a
+  // segment boundary, everything in between is plain memory and SafeWriteMemoryByte() cannot
+  // fail partway through.
+  const VirtualMemoryAddress last = addr + (size - 1);
+  const u32 segment = addr >> 29;
+  if ((last >> 29) != segment || (segment != 0x00 && segment != 0x04 && segment != 0x05))
+    return false;
+
+  if (segment != 0x05 && (addr & SCRATCHPAD_ADDR_MASK) == SCRATCHPAD_ADDR)
+    return ((last & SCRATCHPAD_ADDR_MASK) == SCRATCHPAD_ADDR);
+
+  return ((addr & PHYSICAL_MEMORY_ADDRESS_MASK) < Bus::RAM_MIRROR_END &&
+          (last & PHYSICAL_MEMORY_ADDRESS_MASK) < Bus::RAM_MIRROR_END);
+}
+
+bool CPU::IsKernelHLEReadableRange(VirtualMemoryAddress addr, u32 size)
+{
+  if (IsKernelHLEWritableRange(addr, size))
+    return true;
+
+  // Otherwise only the BIOS ROM is safely readable.
+  const VirtualMemoryAddress last = addr + (size - 1);
+  const u32 segment = addr >> 29;
+  if ((last >> 29) != segment || (segment != 0x00 && segment != 0x04 && segment != 0x05))
+    return false;
+
+  const PhysicalMemoryAddress first_phys = addr & PHYSICAL_MEMORY_ADDRESS_MASK;
+  const PhysicalMemoryAddress last_phys = last & PHYSICAL_MEMORY_ADDRESS_MASK;
+  return (first_phys >= Bus::BIOS_BASE && last_phys < (Bus::BIOS_BASE + Bus::BIOS_SIZE));
+}
+
+bool CPU::TryKernelFunctionHLE()
+{
+  // Mirrors the kernel's A0 dispatch: function number in t1, arguments in a0-a2, result in v0,
+  // return address in ra. Only the plain cases are serviced here - anything unusual (zero/huge
+  // lengths, ranges outside RAM/scratchpad/BIOS) declines by returning false, in which case the
+  // caller simply executes the real routine. The serviced call is atomic with respect to
+  // interrupts, unlike the emulated loop; that's part of the speed hack's accuracy tradeoff.
+  auto& regs = g_state.regs;
+
+  TickCount ticks;
+  switch (regs.t1)
+  {
+    case 0x17: // strcmp(str1, str2)
+    {
+      u32 lhs_addr = regs.a0;
+      u32 rhs_addr = regs.a1;
+      u32 compared = 0;
+      u8 lhs, rhs;
+      for (;;)
+      {
+        if (!SafeReadMemoryByte(lhs_addr, &lhs) || !SafeReadMemoryByte(rhs_addr, &rhs) ||
+            (++compared) > KERNEL_HLE_MAX_SIZE) [[unlikely]]
+        {
+          return false;
+        }
+
+        if (lhs != rhs || lhs == 0)
+          break;
+
+        lhs_addr++;
+        rhs_addr++;
+      }
+
+      regs.v0 = static_cast<u32>(static_cast<s32>(ZeroExtend32(lhs)) - static_cast<s32>(ZeroExtend32(rhs)));
+      ticks = KERNEL_HLE_CALL_OVERHEAD_TICKS + static_cast<TickCount>(compared) * KERNEL_HLE_STRCMP_TICKS_PER_BYTE;
+    }
+    break;
+
+    case 0x28: // bzero(dst, len)
+    {
+      const u32 dst = regs.a0;
+      const u32 len = regs.a1;
+      if (dst == 0 || len == 0 || len > KERNEL_HLE_MAX_SIZE || static_cast<s32>(len) < 0 ||
+          !IsKernelHLEWritableRange(dst, len))
+      {
+        return false;
+      }
+
+      for (u32 i = 0; i < len; i++)
+        SafeWriteMemoryByte(dst + i, 0);
+
+      regs.v0 = dst;
+      ticks = KERNEL_HLE_CALL_OVERHEAD_TICKS + static_cast<TickCount>(len) * KERNEL_HLE_MEMSET_TICKS_PER_BYTE;
+    }
+    break;
+
+    case 0x2A: // memcpy(dst, src, len)
+    {
+      const u32 dst = regs.a0;
+      const u32 src = regs.a1;
+      const u32 len = regs.a2;
+      if (dst == 0 || len == 0 || len > KERNEL_HLE_MAX_SIZE || !IsKernelHLEWritableRange(dst, len) ||
+          !IsKernelHLEReadableRange(src, len))
+      {
+        return false;
+      }
+
+      // Copy forwards bytewise like the kernel does, which matters when the ranges overlap.
+      for (u32 i = 0; i < len; i++)
+      {
+        u8 value;
+        SafeReadMemoryByte(src + i, &value);
+        SafeWriteMemoryByte(dst + i, value);
+      }
+
+      regs.v0 = dst;
+      ticks = KERNEL_HLE_CALL_OVERHEAD_TICKS + static_cast<TickCount>(len) * KERNEL_HLE_MEMCPY_TICKS_PER_BYTE;
+    }
+    break;
+
+    case 0x2B: // memset(dst, fill, len)
+    {
+      const u32 dst = regs.a0;
+      const u8 fill = Truncate8(regs.a1);
+      const u32 len = regs.a2;
+      if (dst == 0 || len == 0 || len > KERNEL_HLE_MAX_SIZE || !IsKernelHLEWritableRange(dst, len))
+        return false;
+
+      for (u32 i = 0; i < len; i++)
+        SafeWriteMemoryByte(dst + i, fill);
+
+      regs.v0 = dst;
+      ticks = KERNEL_HLE_CALL_OVERHEAD_TICKS + static_cast<TickCount>(len) * KERNEL_HLE_MEMSET_TICKS_PER_BYTE;
+    }
+    break;
+
+    default:
+      return false;
+  }
+
+  g_state.pending_ticks += ticks;
+  SetPC(regs.ra);
+  return true;
+}
+
 const std::array<CPU::DebuggerRegisterListEntry, CPU::NUM_DEBUGGER_REGISTER_LIST_ENTRIES>
   CPU::g_debugger_register_list = {{{"zero", &CPU::g_state.regs.zero},
                                     {"at", &CPU::g_state.regs.at},
@@ -889,8 +1059,29 @@ void CPU::DisassembleAndPrint(u32 addr, u32 instructions_before /* = 0 */, u32 i
   }
 }
 
+// Threaded dispatch for the main interpreter opcode switch. The computed goto replaces the switch's
+// bounds check with a single indirect branch, which matters on the platforms where the interpreter
+// is the only available backend (no JIT entitlement). MSVC keeps the plain switch.
+#if defined(__GNUC__) || defined(__clang__)
+#define CPU_INTERPRETER_COMPUTED_GOTO 1
+#endif
+
+#ifdef CPU_INTERPRETER_COMPUTED_GOTO
+#define OP_CASE(name) op_##name:
+#define OP_DEFAULT() op_illegal:
+#define OP_END() return
+#else
+#define OP_CASE(name) case InstructionOp::name:
+#define OP_DEFAULT() default:
+#define OP_END() break
+#endif
+
 template<PGXPMode pgxp_mode, bool debug>
-ALWAYS_INLINE_RELEASE void CPU::ExecuteInstruction()
+#ifndef CPU_INTERPRETER_COMPUTED_GOTO
+// Can't force inlining in the computed-goto configuration - taking label addresses prevents it.
+ALWAYS_INLINE_RELEASE
+#endif
+void CPU::ExecuteInstruction()
 {
 restart_instruction:
   const Instruction inst = g_state.current_instruction;
@@ -912,9 +1103,25 @@ restart_instruction:
   if (inst.bits == 0)
     return;
 
+#ifdef CPU_INTERPRETER_COMPUTED_GOTO
+  // One entry per 6-bit primary opcode, with the reserved encodings pointing at the illegal
+  // instruction handler. The field is 6 bits wide, so the table can't be overrun.
+  static const void* const op_targets[64] = {
+    &&op_funct, &&op_b,       &&op_j,       &&op_jal,     &&op_beq,     &&op_bne,     &&op_blez,    &&op_bgtz,
+    &&op_addi,  &&op_addiu,   &&op_slti,    &&op_sltiu,   &&op_andi,    &&op_ori,     &&op_xori,    &&op_lui,
+    &&op_cop0,  &&op_cop1,    &&op_cop2,    &&op_cop3,    &&op_illegal, &&op_illegal, &&op_illegal, &&op_illegal,
+    &&op_illegal, &&op_illegal, &&op_illegal, &&op_illegal, &&op_illegal, &&op_illegal, &&op_illegal, &&op_illegal,
+    &&op_lb,    &&op_lh,      &&op_lwl,     &&op_lw,      &&op_lbu,     &&op_lhu,     &&op_lwr,     &&op_illegal,
+    &&op_sb,    &&op_sh,      &&op_swl,     &&op_sw,      &&op_illegal, &&op_illegal, &&op_swr,     &&op_illegal,
+    &&op_lwc0,  &&op_lwc1,    &&op_lwc2,    &&op_lwc3,    &&op_illegal, &&op_illegal, &&op_illegal, &&op_illegal,
+    &&op_swc0,  &&op_swc1,    &&op_swc2,    &&op_swc3,    &&op_illegal, &&op_illegal, &&op_illegal, &&op_illegal};
+
+  goto* op_targets[static_cast<size_t>(inst.op.GetValue())];
+#else
   switch (inst.op)
+#endif
   {
-    case InstructionOp::funct:
+    OP_CASE(funct)
     {
       switch (inst.r.funct)
       {
@@ -1271,9 +1478,9 @@ restart_instruction:
         }
       }
     }
-    break;
+    OP_END();
 
-    case InstructionOp::lui:
+    OP_CASE(lui)
     {
       const u32 value = inst.i.imm_zext32() << 16;
       WriteReg(inst.i.rt, value);
@@ -1281,9 +1488,9 @@ restart_instruction:
       if constexpr (pgxp_mode >= PGXPMode::CPU)
         PGXP::CPU_LUI(inst.bits);
     }
-    break;
+    OP_END();
 
-    case InstructionOp::andi:
+    OP_CASE(andi)
     {
       const u32 new_value = ReadReg(inst.i.rs) & inst.i.imm_zext32();
 
@@ -1292,9 +1499,9 @@ restart_instruction:
 
       WriteReg(inst.i.rt, new_value);
     }
-    break;
+    OP_END();
 
-    case InstructionOp::ori:
+    OP_CASE(ori)
     {
       const u32 new_value = ReadReg(inst.i.rs) | inst.i.imm_zext32();
 
@@ -1303,9 +1510,9 @@ restart_instruction:
 
       WriteReg(inst.i.rt, new_value);
     }
-    break;
+    OP_END();
 
-    case InstructionOp::xori:
+    OP_CASE(xori)
     {
       const u32 new_value = ReadReg(inst.i.rs) ^ inst.i.imm_zext32();
 
@@ -1314,9 +1521,9 @@ restart_instruction:
 
       WriteReg(inst.i.rt, new_value);
     }
-    break;
+    OP_END();
 
-    case InstructionOp::addi:
+    OP_CASE(addi)
     {
       const u32 old_value = ReadReg(inst.i.rs);
       const u32 add_value = inst.i.imm_sext32();
@@ -1340,9 +1547,9 @@ restart_instruction:
 
       WriteReg(inst.i.rt, new_value);
     }
-    break;
+    OP_END();
 
-    case InstructionOp::addiu:
+    OP_CASE(addiu)
     {
       const u32 old_value = ReadReg(inst.i.rs);
       const u32 add_value = inst.i.imm_sext32();
@@ -1361,9 +1568,9 @@ restart_instruction:
 
       WriteReg(inst.i.rt, new_value);
     }
-    break;
+    OP_END();
 
-    case InstructionOp::slti:
+    OP_CASE(slti)
     {
       const u32 result = BoolToUInt32(static_cast<s32>(ReadReg(inst.i.rs)) < static_cast<s32>(inst.i.imm_sext32()));
 
@@ -1372,9 +1579,9 @@ restart_instruction:
 
       WriteReg(inst.i.rt, result);
     }
-    break;
+    OP_END();
 
-    case InstructionOp::sltiu:
+    OP_CASE(sltiu)
     {
       const u32 result = BoolToUInt32(ReadReg(inst.i.rs) < inst.i.imm_sext32());
 
@@ -1383,9 +1590,9 @@ restart_instruction:
 
       WriteReg(inst.i.rt, result);
     }
-    break;
+    OP_END();
 
-    case InstructionOp::lb:
+    OP_CASE(lb)
     {
       const VirtualMemoryAddress addr = ReadReg(inst.i.rs) + inst.i.imm_sext32();
       if constexpr (debug)
@@ -1402,9 +1609,9 @@ restart_instruction:
       if constexpr (pgxp_mode >= PGXPMode::Memory)
         PGXP::CPU_LBx(inst.bits, addr, sxvalue);
     }
-    break;
+    OP_END();
 
-    case InstructionOp::lh:
+    OP_CASE(lh)
     {
       const VirtualMemoryAddress addr = ReadReg(inst.i.rs) + inst.i.imm_sext32();
       if constexpr (debug)
@@ -1420,9 +1627,9 @@ restart_instruction:
       if constexpr (pgxp_mode >= PGXPMode::Memory)
         PGXP::CPU_LH(inst.bits, addr, sxvalue);
     }
-    break;
+    OP_END();
 
-    case InstructionOp::lw:
+    OP_CASE(lw)
     {
       const VirtualMemoryAddress addr = ReadReg(inst.i.rs) + inst.i.imm_sext32();
       if constexpr (debug)
@@ -1437,9 +1644,9 @@ restart_instruction:
       if constexpr (pgxp_mode >= PGXPMode::Memory)
         PGXP::CPU_LW(inst.bits, addr, value);
     }
-    break;
+    OP_END();
 
-    case InstructionOp::lbu:
+    OP_CASE(lbu)
     {
       const VirtualMemoryAddress addr = ReadReg(inst.i.rs) + inst.i.imm_sext32();
       if constexpr (debug)
@@ -1455,9 +1662,9 @@ restart_instruction:
       if constexpr (pgxp_mode >= PGXPMode::Memory)
         PGXP::CPU_LBx(inst.bits, addr, zxvalue);
     }
-    break;
+    OP_END();
 
-    case InstructionOp::lhu:
+    OP_CASE(lhu)
     {
       const VirtualMemoryAddress addr = ReadReg(inst.i.rs) + inst.i.imm_sext32();
       if constexpr (debug)
@@ -1473,10 +1680,10 @@ restart_instruction:
       if constexpr (pgxp_mode >= PGXPMode::Memory)
         PGXP::CPU_LHU(inst.bits, addr, zxvalue);
     }
-    break;
+    OP_END();
 
-    case InstructionOp::lwl:
-    case InstructionOp::lwr:
+    OP_CASE(lwl)
+    OP_CASE(lwr)
     {
       const VirtualMemoryAddress addr = ReadReg(inst.i.rs) + inst.i.imm_sext32();
       const VirtualMemoryAddress aligned_addr = addr & ~UINT32_C(3);
@@ -1507,9 +1714,9 @@ restart_instruction:
       if constexpr (pgxp_mode >= PGXPMode::Memory)
         PGXP::CPU_LW(inst.bits, addr, new_value);
     }
-    break;
+    OP_END();
 
-    case InstructionOp::sb:
+    OP_CASE(sb)
     {
       const VirtualMemoryAddress addr = ReadReg(inst.i.rs) + inst.i.imm_sext32();
       if constexpr (debug)
@@ -1521,9 +1728,9 @@ restart_instruction:
       if constexpr (pgxp_mode >= PGXPMode::Memory)
         PGXP::CPU_SB(inst.bits, addr, value);
     }
-    break;
+    OP_END();
 
-    case InstructionOp::sh:
+    OP_CASE(sh)
     {
       const VirtualMemoryAddress addr = ReadReg(inst.i.rs) + inst.i.imm_sext32();
       if constexpr (debug)
@@ -1535,9 +1742,9 @@ restart_instruction:
       if constexpr (pgxp_mode >= PGXPMode::Memory)
         PGXP::CPU_SH(inst.bits, addr, value);
     }
-    break;
+    OP_END();
 
-    case InstructionOp::sw:
+    OP_CASE(sw)
     {
       const VirtualMemoryAddress addr = ReadReg(inst.i.rs) + inst.i.imm_sext32();
       if constexpr (debug)
@@ -1549,10 +1756,10 @@ restart_instruction:
       if constexpr (pgxp_mode >= PGXPMode::Memory)
         PGXP::CPU_SW(inst.bits, addr, value);
     }
-    break;
+    OP_END();
 
-    case InstructionOp::swl:
-    case InstructionOp::swr:
+    OP_CASE(swl)
+    OP_CASE(swr)
     {
       const VirtualMemoryAddress addr = ReadReg(inst.i.rs) + inst.i.imm_sext32();
       const VirtualMemoryAddress aligned_addr = addr & ~UINT32_C(3);
@@ -1582,24 +1789,24 @@ restart_instruction:
       if constexpr (pgxp_mode >= PGXPMode::Memory)
         PGXP::CPU_SW(inst.bits, aligned_addr, new_value);
     }
-    break;
+    OP_END();
 
-    case InstructionOp::j:
+    OP_CASE(j)
     {
       g_state.next_instruction_is_branch_delay_slot = true;
       Branch((g_state.pc & UINT32_C(0xF0000000)) | (inst.j.target << 2));
     }
-    break;
+    OP_END();
 
-    case InstructionOp::jal:
+    OP_CASE(jal)
     {
       WriteReg(Reg::ra, g_state.npc);
       g_state.next_instruction_is_branch_delay_slot = true;
       Branch((g_state.pc & UINT32_C(0xF0000000)) | (inst.j.target << 2));
     }
-    break;
+    OP_END();
 
-    case InstructionOp::beq:
+    OP_CASE(beq)
     {
       // We're still flagged as a branch delay slot even if the branch isn't taken.
       g_state.next_instruction_is_branch_delay_slot = true;
@@ -1607,36 +1814,36 @@ restart_instruction:
       if (branch)
         Branch(g_state.pc + (inst.i.imm_sext32() << 2));
     }
-    break;
+    OP_END();
 
-    case InstructionOp::bne:
+    OP_CASE(bne)
     {
       g_state.next_instruction_is_branch_delay_slot = true;
       const bool branch = (ReadReg(inst.i.rs) != ReadReg(inst.i.rt));
       if (branch)
         Branch(g_state.pc + (inst.i.imm_sext32() << 2));
     }
-    break;
+    OP_END();
 
-    case InstructionOp::bgtz:
+    OP_CASE(bgtz)
     {
       g_state.next_instruction_is_branch_delay_slot = true;
       const bool branch = (static_cast<s32>(ReadReg(inst.i.rs)) > 0);
       if (branch)
         Branch(g_state.pc + (inst.i.imm_sext32() << 2));
     }
-    break;
+    OP_END();
 
-    case InstructionOp::blez:
+    OP_CASE(blez)
     {
       g_state.next_instruction_is_branch_delay_slot = true;
       const bool branch = (static_cast<s32>(ReadReg(inst.i.rs)) <= 0);
       if (branch)
         Branch(g_state.pc + (inst.i.imm_sext32() << 2));
     }
-    break;
+    OP_END();
 
-    case InstructionOp::b:
+    OP_CASE(b)
     {
       g_state.next_instruction_is_branch_delay_slot = true;
       const u8 rt = static_cast<u8>(inst.i.rt.GetValue());
@@ -1653,9 +1860,9 @@ restart_instruction:
       if (branch)
         Branch(g_state.pc + (inst.i.imm_sext32() << 2));
     }
-    break;
+    OP_END();
 
-    case InstructionOp::cop0:
+    OP_CASE(cop0)
     {
       if (InUserMode() && !g_state.cop0_regs.sr.CU0)
       {
@@ -1719,9 +1926,9 @@ restart_instruction:
         }
       }
     }
-    break;
+    OP_END();
 
-    case InstructionOp::cop2:
+    OP_CASE(cop2)
     {
       if (!g_state.cop0_regs.sr.CE2)
       {
@@ -1787,9 +1994,9 @@ restart_instruction:
         GTE::ExecuteInstruction(inst.bits);
       }
     }
-    break;
+    OP_END();
 
-    case InstructionOp::lwc2:
+    OP_CASE(lwc2)
     {
       if (!g_state.cop0_regs.sr.CE2)
       {
@@ -1809,9 +2016,9 @@ restart_instruction:
       if constexpr (pgxp_mode >= PGXPMode::Memory)
         PGXP::CPU_LWC2(inst.bits, addr, value);
     }
-    break;
+    OP_END();
 
-    case InstructionOp::swc2:
+    OP_CASE(swc2)
     {
       if (!g_state.cop0_regs.sr.CE2)
       {
@@ -1829,23 +2036,23 @@ restart_instruction:
       if constexpr (pgxp_mode >= PGXPMode::Memory)
         PGXP::CPU_SWC2(inst.bits, addr, value);
     }
-    break;
+    OP_END();
 
       // swc0/lwc0/cop1/cop3 are essentially no-ops
-    case InstructionOp::cop1:
-    case InstructionOp::cop3:
-    case InstructionOp::lwc0:
-    case InstructionOp::lwc1:
-    case InstructionOp::lwc3:
-    case InstructionOp::swc0:
-    case InstructionOp::swc1:
-    case InstructionOp::swc3:
+    OP_CASE(cop1)
+    OP_CASE(cop3)
+    OP_CASE(lwc0)
+    OP_CASE(lwc1)
+    OP_CASE(lwc3)
+    OP_CASE(swc0)
+    OP_CASE(swc1)
+    OP_CASE(swc3)
     {
     }
-    break;
+    OP_END();
 
       // everything else is reserved/invalid
-    default:
+    OP_DEFAULT()
     {
       u32 ram_value;
       if (SafeReadInstruction(g_state.current_instruction_pc, &ram_value) &&
@@ -1859,10 +2066,14 @@ restart_instruction:
 
       RaiseException(Exception::RI);
     }
-    break;
+    OP_END();
   }
 }
 
+#undef OP_CASE
+#undef OP_DEFAULT
+#undef OP_END
+
 void CPU::DispatchInterrupt()
 {
   // If the instruction we're about to execute is a GTE instruction, delay dispatching the interrupt until the next
@@ -2006,6 +2217,90 @@ void CPU::ClearBreakpoints()
   UpdateDebugDispatcherFlag();
 }
 
+void CPU::UpdateMemoryWatchpointBounds()
+{
+  const bool had_watchpoints = (s_memory_watchpoint_min_address <= s_memory_watchpoint_max_address);
+
+  s_memory_watchpoint_min_address = 0xFFFFFFFFu;
+  s_memory_watchpoint_max_address = 0;
+  for (const MemoryWatchpoint& wp : s_memory_watchpoints)
+  {
+    if (!wp.enabled)
+      continue;
+
+    const u32 start = wp.address & PHYSICAL_MEMORY_ADDRESS_MASK;
+    s_memory_watchpoint_min_address = std::min(s_memory_watchpoint_min_address, start);
+    s_memory_watchpoint_max_address = std::max(s_memory_watchpoint_max_address, start + (wp.size - 1));
+  }
+
+  // Fastmem-compiled code accesses RAM directly without going through the handlers, so everything
+  // has to be recompiled without it when the first watchpoint appears, and again when the last one
+  // goes away. Blocks compiled while the list is non-empty fall back to the slowmem handlers.
+  const bool has_watchpoints = (s_memory_watchpoint_min_address <= s_memory_watchpoint_max_address);
+  if (had_watchpoints != has_watchpoints && System::IsValid())
+    CodeCache::Reset();
+}
+
+bool CPU::HasAnyMemoryWatchpoints()
+{
+  return !s_memory_watchpoints.empty();
+}
+
+bool CPU::HasMemoryWatchpointAtAddress(VirtualMemoryAddress address)
+{
+  for (const MemoryWatchpoint& wp : s_memory_watchpoints)
+  {
+    if (wp.address == address)
+      return true;
+  }
+
+  return false;
+}
+
+CPU::MemoryWatchpointList CPU::GetMemoryWatchpointList()
+{
+  return s_memory_watchpoints;
+}
+
+bool CPU::AddMemoryWatchpoint(VirtualMemoryAddress address, u32 size, MemoryWatchpointType type, bool enabled)
+{
+  if (size == 0 || HasMemoryWatchpointAtAddress(address))
+    return false;
+
+  Log_InfoPrintf("Adding %u-byte memory watchpoint at %08X", size, address);
+
+  MemoryWatchpoint wp{address, size, type, s_memory_watchpoint_counter++, 0, enabled};
+  s_memory_watchpoints.push_back(std::move(wp));
+  UpdateMemoryWatchpointBounds();
+
+  Host::ReportFormattedDebuggerMessage(TRANSLATE("DebuggerMessage", "Added memory watchpoint at 0x%08X."), address);
+  return true;
+}
+
+bool CPU::RemoveMemoryWatchpoint(VirtualMemoryAddress address)
+{
+  auto it = std::find_if(s_memory_watchpoints.begin(), s_memory_watchpoints.end(),
+                         [address](const MemoryWatchpoint& wp) { return wp.address == address; });
+  if (it == s_memory_watchpoints.end())
+    return false;
+
+  Host::ReportFormattedDebuggerMessage(TRANSLATE("DebuggerMessage", "Removed memory watchpoint at 0x%08X."), address);
+
+  s_memory_watchpoints.erase(it);
+  UpdateMemoryWatchpointBounds();
+  return true;
+}
+
+void CPU::ClearMemoryWatchpoints()
+{
+  if (s_memory_watchpoints.empty())
+    return;
+
+  s_memory_watchpoints.clear();
+  s_memory_watchpoint_counter = 1;
+  UpdateMemoryWatchpointBounds();
+}
+
 bool CPU::AddStepOverBreakpoint()
 {
   u32 bp_pc = g_state.pc;
@@ -2226,6 +2521,8 @@ void CPU::ExecuteDebug()
 
 void CPU::Execute()
 {
+  PerformanceProfiler::Scope profiler_scope(PerformanceProfiler::Event::CPUExecute);
+
   const CPUExecutionMode exec_mode = g_settings.cpu_execution_mode;
   const bool use_debug_dispatcher = g_state.use_debug_dispatcher;
   if (fastjmp_set(&s_jmp_buf) != 0)
@@ -2787,6 +3084,7 @@ ALWAYS_INLINE bool CPU::DoSafeMemoryAccess(VirtualMemoryAddress address, u32& va
         if (g_unprotected_ram[offset] != Truncate8(value))
         {
           g_unprotected_ram[offset] = Truncate8(value);
+          Bus::AddSnapshotDirtyPage(page_index);
           if (g_ram_code_bits[page_index])
             CPU::CodeCache::InvalidateBlocksWithPageIndex(page_index);
         }
@@ -2799,6 +3097,7 @@ ALWAYS_INLINE bool CPU::DoSafeMemoryAccess(VirtualMemoryAddress address, u32& va
         if (old_value != new_value)
         {
           std::memcpy(&g_unprotected_ram[offset], &new_value, sizeof(u16));
+          Bus::AddSnapshotDirtyPage(page_index);
           if (g_ram_code_bits[page_index])
             CPU::CodeCache::InvalidateBlocksWithPageIndex(page_index);
         }
@@ -2810,6 +3109,7 @@ ALWAYS_INLINE bool CPU::DoSafeMemoryAccess(VirtualMemoryAddress address, u32& va
         if (old_value != value)
         {
           std::memcpy(&g_unprotected_ram[offset], &value, sizeof(u32));
+          Bus::AddSnapshotDirtyPage(page_index);
           if (g_ram_code_bits[page_index])
             CPU::CodeCache::InvalidateBlocksWithPageIndex(page_index);
         }
@@ -2934,6 +3234,74 @@ bool CPU::SafeWriteMemoryWord(VirtualMemoryAddress addr, u32 value)
          SafeWriteMemoryHalfWord(addr + 2, Truncate16(value >> 16));
 }
 
+bool CPU::SafeReadMemoryBytes(VirtualMemoryAddress addr, void* data, u32 length)
+{
+  u8* ptr = static_cast<u8*>(data);
+
+  if ((addr & 3) == 0 && (length & 3) == 0)
+  {
+    while (length > 0)
+    {
+      u32 value;
+      if (!SafeReadMemoryWord(addr, &value))
+        return false;
+
+      std::memcpy(ptr, &value, sizeof(value));
+      ptr += sizeof(value);
+      addr += sizeof(value);
+      length -= sizeof(value);
+    }
+
+    return true;
+  }
+
+  while (length > 0)
+  {
+    if (!SafeReadMemoryByte(addr, ptr))
+      return false;
+
+    ptr++;
+    addr++;
+    length--;
+  }
+
+  return true;
+}
+
+bool CPU::SafeWriteMemoryBytes(VirtualMemoryAddress addr, const void* data, u32 length)
+{
+  const u8* ptr = static_cast<const u8*>(data);
+
+  if ((addr & 3) == 0 && (length & 3) == 0)
+  {
+    while (length > 0)
+    {
+      u32 value;
+      std::memcpy(&value, ptr, sizeof(value));
+      if (!SafeWriteMemoryWord(addr, value))
+        return false;
+
+      ptr += sizeof(value);
+      addr += sizeof(value);
+      length -= sizeof(value);
+    }
+
+    return true;
+  }
+
+  while (length > 0)
+  {
+    if (!SafeWriteMemoryByte(addr, *ptr))
+      return false;
+
+    ptr++;
+    addr++;
+    length--;
+  }
+
+  return true;
+}
+
 void* CPU::GetDirectReadMemoryPointer(VirtualMemoryAddress address, MemoryAccessSize size, TickCount* read_ticks)
 {
   using namespace Bus;
@@ -3012,50 +3380,48 @@ ALWAYS_INLINE_RELEASE bool CPU::DoAlignmentCheck(VirtualMemoryAddress address)
   return false;
 }
 
-#if 0
-static void MemoryBreakpoint(MemoryAccessType type, MemoryAccessSize size, VirtualMemoryAddress addr, u32 value)
+void CPU::MemoryWatchpointCheck(MemoryAccessType type, MemoryAccessSize size, VirtualMemoryAddress address, u32 value)
 {
-  static constexpr const char* sizes[3] = { "byte", "halfword", "word" };
-  static constexpr const char* types[2] = { "read", "write" };
+  static constexpr const char* sizes[3] = {"byte", "halfword", "word"};
+  static constexpr const char* types[2] = {"read", "write"};
 
-  const u32 cycle = TimingEvents::GetGlobalTickCounter() + CPU::g_state.pending_ticks;
-  if (cycle == 3301006373)
-    __debugbreak();
+  const u32 start = address & PHYSICAL_MEMORY_ADDRESS_MASK;
+  const u32 end = start + ((1u << static_cast<u32>(size)) - 1u);
+  if (end < s_memory_watchpoint_min_address || start > s_memory_watchpoint_max_address)
+    return;
 
-#if 0
-  static std::FILE* fp = nullptr;
-  if (!fp)
-    fp = std::fopen("D:\\memory.txt", "wb");
-  if (fp)
+  for (MemoryWatchpoint& wp : s_memory_watchpoints)
   {
-    std::fprintf(fp, "%u %s %s %08X %08X\n", cycle, types[static_cast<u32>(type)], sizes[static_cast<u32>(size)], addr, value);
-    std::fflush(fp);
-  }
-#endif
+    if (!wp.enabled || (wp.type == MemoryWatchpointType::Read && type != MemoryAccessType::Read) ||
+        (wp.type == MemoryWatchpointType::Write && type != MemoryAccessType::Write))
+    {
+      continue;
+    }
 
-#if 0
-  if (type == MemoryAccessType::Read && addr == 0x1F000084)
-    __debugbreak();
-#endif
-#if 0
-  if (type == MemoryAccessType::Write && addr == 0x000000B0 /*&& value == 0x3C080000*/)
-    __debugbreak();
-#endif
+    const u32 wp_start = wp.address & PHYSICAL_MEMORY_ADDRESS_MASK;
+    if (end < wp_start || start > (wp_start + (wp.size - 1)))
+      continue;
 
-#if 0 // TODO: MEMBP
-  if (type == MemoryAccessType::Write && address == 0x80113028)
-  {
-    if ((TimingEvents::GetGlobalTickCounter() + CPU::g_state.pending_ticks) == 5051485)
-      __debugbreak();
+    wp.hit_count++;
+    Host::ReportFormattedDebuggerMessage(
+      TRANSLATE("DebuggerMessage", "Hit memory watchpoint %u: %s %s at 0x%08X (value 0x%08X, PC 0x%08X)."), wp.number,
+      types[static_cast<u32>(type)], sizes[static_cast<u32>(size)], address, value, g_state.current_instruction_pc);
 
-    Log_WarningPrintf("VAL %08X @ %u", value, (TimingEvents::GetGlobalTickCounter() + CPU::g_state.pending_ticks));
+    // We can be deep inside a recompiled block here (via the slowmem handlers), so unlike execution
+    // breakpoints we can't unwind out of the dispatcher. Request a pause instead; execution stops at
+    // the next safe point.
+    System::PauseSystem(true);
   }
-#endif
 }
-#define MEMORY_BREAKPOINT(type, size, addr, value) MemoryBreakpoint((type), (size), (addr), (value))
-#else
-#define MEMORY_BREAKPOINT(type, size, addr, value)
-#endif
+
+// Cheap enough to leave compiled in: fastmem covers RAM when no watchpoints exist, so the handlers
+// only see I/O accesses, and the empty check costs a single load.
+#define MEMORY_BREAKPOINT(type, size, addr, value)                                                                     \
+  do                                                                                                                   \
+  {                                                                                                                    \
+    if (!s_memory_watchpoints.empty()) [[unlikely]]                                                                    \
+      MemoryWatchpointCheck((type), (size), (addr), (value));                                                          \
+  } while (0)
 
 bool CPU::ReadMemoryByte(VirtualMemoryAddress addr, u8* value)
 {
@@ -3282,6 +3648,16 @@ u32 CPU::Recompiler::Thunks::UncheckedReadMemoryWord(u32 address)
   return value;
 }
 
+u32 CPU::Recompiler::Thunks::ReadGPUSTAT()
+{
+  // The address was resolved at compile time, so the handler table dispatch and register decode
+  // can be skipped. Timing matches Bus::HWHandlers::GPURead().
+  g_state.pending_ticks += 2;
+  const u32 value = g_gpu->ReadStatusRegister();
+  MEMORY_BREAKPOINT(MemoryAccessType::Read, MemoryAccessSize::Word, Bus::GPU_BASE | 0x04u, value);
+  return value;
+}
+
 void CPU::Recompiler::Thunks::UncheckedWriteMemoryByte(u32 address, u32 value)
 {
   MEMORY_BREAKPOINT(MemoryAccessType::Write, MemoryAccessSize::Byte, address, value);
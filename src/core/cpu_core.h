@@ -25,6 +25,8 @@ enum : PhysicalMemoryAddress
   SCRATCHPAD_ADDR_MASK = UINT32_C(0x7FFFFC00),
   SCRATCHPAD_OFFSET_MASK = UINT32_C(0x000003FF),
   SCRATCHPAD_SIZE = UINT32_C(0x00000400),
+  SCRATCHPAD_PAGE_SIZE = UINT32_C(0x00001000), // backing storage, for mapping into the fastmem LUT
+
   ICACHE_SIZE = UINT32_C(0x00001000),
   ICACHE_SLOTS = ICACHE_SIZE / sizeof(u32),
   ICACHE_LINE_SIZE = 16,
@@ -105,7 +107,10 @@ struct State
   std::array<u32, ICACHE_LINES> icache_tags = {};
   std::array<u8, ICACHE_SIZE> icache_data = {};
 
-  std::array<u8, SCRATCHPAD_SIZE> scratchpad = {};
+  // Sized to a full fastmem LUT page so it can be pointed at directly; out-of-range accesses within
+  // the page land in the padding instead of the rest of the state. Only the first SCRATCHPAD_SIZE
+  // bytes are real, and only those are saved to state.
+  std::array<u8, SCRATCHPAD_PAGE_SIZE> scratchpad = {};
 
   PGXP_value pgxp_gpr[32];
   PGXP_value pgxp_hi;
@@ -171,9 +176,11 @@ bool SafeReadMemoryByte(VirtualMemoryAddress addr, u8* value);
 bool SafeReadMemoryHalfWord(VirtualMemoryAddress addr, u16* value);
 bool SafeReadMemoryWord(VirtualMemoryAddress addr, u32* value);
 bool SafeReadMemoryCString(VirtualMemoryAddress addr, std::string* value, u32 max_length = 1024);
+bool SafeReadMemoryBytes(VirtualMemoryAddress addr, void* data, u32 length);
 bool SafeWriteMemoryByte(VirtualMemoryAddress addr, u8 value);
 bool SafeWriteMemoryHalfWord(VirtualMemoryAddress addr, u16 value);
 bool SafeWriteMemoryWord(VirtualMemoryAddress addr, u32 value);
+bool SafeWriteMemoryBytes(VirtualMemoryAddress addr, const void* data, u32 length);
 
 // External IRQs
 void SetExternalInterrupt(u8 bit);
@@ -217,6 +224,35 @@ void ClearBreakpoints();
 bool AddStepOverBreakpoint();
 bool AddStepOutBreakpoint(u32 max_instructions_to_search = 1000);
 
+enum class MemoryWatchpointType : u8
+{
+  Read,
+  Write,
+  ReadWrite,
+};
+
+struct MemoryWatchpoint
+{
+  VirtualMemoryAddress address;
+  u32 size;
+  MemoryWatchpointType type;
+  u32 number;
+  u32 hit_count;
+  bool enabled;
+};
+
+using MemoryWatchpointList = std::vector<MemoryWatchpoint>;
+
+// Memory watchpoints. Unlike execution breakpoints, these do not force the debug dispatcher; the
+// recompilers keep running and only drop fastmem, so accesses are filtered in the memory handlers.
+// Addresses are matched physically, and a watchpoint may cover a range of bytes.
+bool HasAnyMemoryWatchpoints();
+bool HasMemoryWatchpointAtAddress(VirtualMemoryAddress address);
+MemoryWatchpointList GetMemoryWatchpointList();
+bool AddMemoryWatchpoint(VirtualMemoryAddress address, u32 size, MemoryWatchpointType type, bool enabled = true);
+bool RemoveMemoryWatchpoint(VirtualMemoryAddress address);
+void ClearMemoryWatchpoints();
+
 extern bool TRACE_EXECUTION;
 
 // Debug register introspection
@@ -110,6 +110,16 @@ bool SafeReadInstruction(VirtualMemoryAddress addr, u32* value);
 void* GetDirectReadMemoryPointer(VirtualMemoryAddress address, MemoryAccessSize size, TickCount* read_ticks);
 void* GetDirectWriteMemoryPointer(VirtualMemoryAddress address, MemoryAccessSize size);
 
+/// Returns true if a word load from the given address reads GPUSTAT. Games poll the status register
+/// in tight loops, so the recompilers dispatch constant-address loads of it straight to
+/// Recompiler::Thunks::ReadGPUSTAT(), skipping the handler tables and register decode.
+ALWAYS_INLINE static bool IsGPUSTATLoadAddress(VirtualMemoryAddress address)
+{
+  const u32 seg = (address >> 29);
+  return ((seg == 0u || seg == 4u || seg == 5u) &&
+          VirtualAddressToPhysical(address) == (Bus::GPU_BASE | 0x04u));
+}
+
 ALWAYS_INLINE static void AddGTETicks(TickCount ticks)
 {
   g_state.gte_completion_tick = g_state.pending_ticks + ticks + 1;
@@ -125,4 +135,9 @@ ALWAYS_INLINE static void StallUntilGTEComplete()
 void HandleA0Syscall();
 void HandleB0Syscall();
 
+// Optional HLE for the kernel's A0 memory functions (memcpy/memset/bzero/strcmp). Expects to be
+// called with the PC sitting on the A0 dispatch vector; returns true if the call was serviced
+// natively, with v0/ra/pending_ticks updated, or false if the emulated routine should run.
+bool TryKernelFunctionHLE();
+
 } // namespace CPU
\ No newline at end of file
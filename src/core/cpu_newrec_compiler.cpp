@@ -1606,7 +1606,9 @@ void CPU::NewRec::Compiler::CompileLoadStoreTemplate(void (Compiler::*func)(Comp
   std::optional<VirtualMemoryAddress> addr;
   std::optional<VirtualMemoryAddress> spec_addr;
   bool use_fastmem = CodeCache::IsUsingFastmem() && !g_settings.cpu_recompiler_memory_exceptions &&
-                     !SpecIsCacheIsolated() && !CodeCache::HasPreviouslyFaultedOnPC(m_current_instruction_pc);
+                     !SpecIsCacheIsolated() && !HasAnyMemoryWatchpoints() &&
+                     !CodeCache::HasPreviouslyFaultedOnPC(m_current_instruction_pc) &&
+                     !CodeCache::HasPreviouslyFaultedOnPage(m_current_instruction_pc);
   if (HasConstantReg(rs))
   {
     addr = GetConstantRegU32(rs) + inst->i.imm_sext32();
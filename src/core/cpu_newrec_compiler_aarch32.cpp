@@ -368,6 +368,9 @@ void CPU::NewRec::AArch32Compiler::EndBlock(const std::optional<u32>& newpc, boo
   }
   m_dirty_pc = false;
 
+  if (do_event_test && newpc.has_value() && CodeCache::CanElideBlockLinkEventTest(m_block, newpc.value()))
+    do_event_test = false;
+
   // flush regs
   Flush(FLUSH_END_BLOCK);
   EndAndLinkBlock(newpc, do_event_test, false);
@@ -439,7 +442,18 @@ void CPU::NewRec::AArch32Compiler::EndAndLinkBlock(const std::optional<u32>& new
     {
       // Special case: ourselves! No need to backlink then.
       Log_DebugPrintf("Linking block at %08X to self", m_block->pc);
-      armEmitJmp(armAsm, armAsm->GetBuffer()->GetStartAddress<const void*>(), true);
+      if (m_block->HasFlag(CodeCache::BlockFlags::IsIdleLoop))
+      {
+        // Idle loop taking its back edge: burn the rest of the slice and run events instead of
+        // spinning until the downcount test fires.
+        armAsm->ldr(RARG1, PTR(&g_state.downcount));
+        armAsm->str(RARG1, PTR(&g_state.pending_ticks));
+        armEmitJmp(armAsm, CodeCache::g_run_events_and_dispatch, true);
+      }
+      else
+      {
+        armEmitJmp(armAsm, armAsm->GetBuffer()->GetStartAddress<const void*>(), true);
+      }
     }
     else
     {
@@ -1547,6 +1561,24 @@ void CPU::NewRec::AArch32Compiler::GenerateStore(const vixl::aarch32::Register&
 void CPU::NewRec::AArch32Compiler::Compile_lxx(CompileFlags cf, MemoryAccessSize size, bool sign, bool use_fastmem,
                                                const std::optional<VirtualMemoryAddress>& address)
 {
+  if (address.has_value() && size == MemoryAccessSize::Word && !g_settings.gpu_pgxp_enable &&
+      IsGPUSTATLoadAddress(address.value()))
+  {
+    // Hottest MMIO read in most titles; the dedicated thunk takes no arguments and skips the
+    // handler table dispatch entirely.
+    FlushForLoadStore(address, false, false);
+    EmitCall(reinterpret_cast<const void*>(&Recompiler::Thunks::ReadGPUSTAT));
+    if (cf.MipsT() != Reg::zero)
+    {
+      const Register data = Register(AllocateHostReg(
+        GetFlagsForNewLoadDelayedReg(), EMULATE_LOAD_DELAYS ? HR_TYPE_NEXT_LOAD_DELAY_VALUE : HR_TYPE_CPU_REG,
+        cf.MipsT()));
+      armAsm->mov(data, RRET);
+    }
+
+    return;
+  }
+
   const std::optional<Register> addr_reg = g_settings.gpu_pgxp_enable ?
                                              std::optional<Register>(Register(AllocateTempHostReg(HR_CALLEE_SAVED))) :
                                              std::optional<Register>();
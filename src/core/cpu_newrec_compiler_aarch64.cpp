@@ -340,6 +340,9 @@ void CPU::NewRec::AArch64Compiler::EndBlock(const std::optional<u32>& newpc, boo
   }
   m_dirty_pc = false;
 
+  if (do_event_test && newpc.has_value() && CodeCache::CanElideBlockLinkEventTest(m_block, newpc.value()))
+    do_event_test = false;
+
   // flush regs
   Flush(FLUSH_END_BLOCK);
   EndAndLinkBlock(newpc, do_event_test, false);
@@ -411,7 +414,18 @@ void CPU::NewRec::AArch64Compiler::EndAndLinkBlock(const std::optional<u32>& new
     {
       // Special case: ourselves! No need to backlink then.
       Log_DebugPrintf("Linking block at %08X to self", m_block->pc);
-      armEmitJmp(armAsm, armAsm->GetBuffer()->GetStartAddress<const void*>(), true);
+      if (m_block->HasFlag(CodeCache::BlockFlags::IsIdleLoop))
+      {
+        // Idle loop taking its back edge: burn the rest of the slice and run events instead of
+        // spinning until the downcount test fires.
+        armAsm->ldr(RWARG1, PTR(&g_state.downcount));
+        armAsm->str(RWARG1, PTR(&g_state.pending_ticks));
+        armEmitJmp(armAsm, CodeCache::g_run_events_and_dispatch, true);
+      }
+      else
+      {
+        armEmitJmp(armAsm, armAsm->GetBuffer()->GetStartAddress<const void*>(), true);
+      }
     }
     else
     {
@@ -1525,6 +1539,24 @@ void CPU::NewRec::AArch64Compiler::GenerateStore(const vixl::aarch64::WRegister&
 void CPU::NewRec::AArch64Compiler::Compile_lxx(CompileFlags cf, MemoryAccessSize size, bool sign, bool use_fastmem,
                                                const std::optional<VirtualMemoryAddress>& address)
 {
+  if (address.has_value() && size == MemoryAccessSize::Word && !g_settings.gpu_pgxp_enable &&
+      IsGPUSTATLoadAddress(address.value()))
+  {
+    // Hottest MMIO read in most titles; the dedicated thunk takes no arguments and skips the
+    // handler table dispatch entirely.
+    FlushForLoadStore(address, false, false);
+    EmitCall(reinterpret_cast<const void*>(&Recompiler::Thunks::ReadGPUSTAT));
+    if (cf.MipsT() != Reg::zero)
+    {
+      const WRegister data = WRegister(AllocateHostReg(
+        GetFlagsForNewLoadDelayedReg(), EMULATE_LOAD_DELAYS ? HR_TYPE_NEXT_LOAD_DELAY_VALUE : HR_TYPE_CPU_REG,
+        cf.MipsT()));
+      armAsm->mov(data, RWRET);
+    }
+
+    return;
+  }
+
   const std::optional<WRegister> addr_reg =
     g_settings.gpu_pgxp_enable ? std::optional<WRegister>(WRegister(AllocateTempHostReg(HR_CALLEE_SAVED))) :
                                  std::optional<WRegister>();
@@ -2105,6 +2137,41 @@ void CPU::NewRec::AArch64Compiler::Compile_cop2(CompileFlags cf)
   TickCount func_ticks;
   GTE::InstructionImpl func = GTE::GetInstructionImpl(inst->bits, &func_ticks);
 
+  // NCLIP runs once per polygon, and the flush/call/ret round-trip costs more than the op itself,
+  // so emit the cross product inline. Everything else still goes through the C implementation.
+  if (GTE::Instruction{inst->bits}.command == 0x06 && !(g_settings.gpu_pgxp_enable && g_settings.gpu_pgxp_culling))
+  {
+    // MAC0 = SX0*(SY1-SY2) + SX1*(SY2-SY0) + SX2*(SY0-SY1)
+    armAsm->ldrsh(RXARG1, PTR(&g_state.gte_regs.SXY0[1]));
+    armAsm->ldrsh(RXARG2, PTR(&g_state.gte_regs.SXY1[1]));
+    armAsm->ldrsh(RXARG3, PTR(&g_state.gte_regs.SXY2[1]));
+    armAsm->sub(RXSCRATCH, RXARG2, RXARG3); // SY1-SY2
+    armAsm->sub(RXARG3, RXARG3, RXARG1);    // SY2-SY0
+    armAsm->sub(RXARG1, RXARG1, RXARG2);    // SY0-SY1
+    armAsm->ldrsh(RXARG2, PTR(&g_state.gte_regs.SXY0[0]));
+    armAsm->mul(RXSCRATCH, RXSCRATCH, RXARG2);
+    armAsm->ldrsh(RXARG2, PTR(&g_state.gte_regs.SXY1[0]));
+    armAsm->madd(RXSCRATCH, RXARG3, RXARG2, RXSCRATCH);
+    armAsm->ldrsh(RXARG2, PTR(&g_state.gte_regs.SXY2[0]));
+    armAsm->madd(RXSCRATCH, RXARG1, RXARG2, RXSCRATCH);
+
+    // FLAG is all zeros unless the sum exceeds 32 bits, in which case the MAC0 and error bits set.
+    Label no_overflow;
+    armAsm->mov(RWARG2, wzr);
+    armAsm->cmp(RXSCRATCH, Operand(RWSCRATCH, SXTW));
+    armAsm->b(&no_overflow, eq);
+    EmitMov(RWARG2, 0x80010000u); // error | mac0_overflow
+    EmitMov(RWARG3, 0x80008000u); // error | mac0_underflow
+    armAsm->cmp(RXSCRATCH, 0);
+    armAsm->csel(RWARG2, RWARG3, RWARG2, lt);
+    armAsm->bind(&no_overflow);
+    armAsm->str(RWARG2, PTR(&g_state.gte_regs.FLAG.bits));
+    armAsm->str(RWSCRATCH, PTR(&g_state.gte_regs.MAC0));
+
+    AddGTETicks(func_ticks);
+    return;
+  }
+
   Flush(FLUSH_FOR_C_CALL);
   EmitMov(RWARG1, inst->bits & GTE::Instruction::REQUIRED_BITS_MASK);
   EmitCall(reinterpret_cast<const void*>(func));
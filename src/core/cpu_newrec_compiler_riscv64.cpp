@@ -587,6 +587,9 @@ void CPU::NewRec::RISCV64Compiler::EndBlock(const std::optional<u32>& newpc, boo
   }
   m_dirty_pc = false;
 
+  if (do_event_test && newpc.has_value() && CodeCache::CanElideBlockLinkEventTest(m_block, newpc.value()))
+    do_event_test = false;
+
   // flush regs
   Flush(FLUSH_END_BLOCK);
   EndAndLinkBlock(newpc, do_event_test, false);
@@ -665,7 +668,18 @@ void CPU::NewRec::RISCV64Compiler::EndAndLinkBlock(const std::optional<u32>& new
     {
       // Special case: ourselves! No need to backlink then.
       Log_DebugPrintf("Linking block at %08X to self", m_block->pc);
-      rvEmitJmp(rvAsm, rvAsm->GetBufferPointer(0));
+      if (m_block->HasFlag(CodeCache::BlockFlags::IsIdleLoop))
+      {
+        // Idle loop taking its back edge: burn the rest of the slice and run events instead of
+        // spinning until the downcount test fires.
+        rvAsm->LW(RARG1, PTR(&g_state.downcount));
+        rvAsm->SW(RARG1, PTR(&g_state.pending_ticks));
+        rvEmitJmp(rvAsm, CodeCache::g_run_events_and_dispatch);
+      }
+      else
+      {
+        rvEmitJmp(rvAsm, rvAsm->GetBufferPointer(0));
+      }
     }
     else
     {
@@ -1832,6 +1846,24 @@ void CPU::NewRec::RISCV64Compiler::GenerateStore(const biscuit::GPR& addr_reg, c
 void CPU::NewRec::RISCV64Compiler::Compile_lxx(CompileFlags cf, MemoryAccessSize size, bool sign, bool use_fastmem,
                                                const std::optional<VirtualMemoryAddress>& address)
 {
+  if (address.has_value() && size == MemoryAccessSize::Word && !g_settings.gpu_pgxp_enable &&
+      IsGPUSTATLoadAddress(address.value()))
+  {
+    // Hottest MMIO read in most titles; the dedicated thunk takes no arguments and skips the
+    // handler table dispatch entirely.
+    FlushForLoadStore(address, false, false);
+    EmitCall(reinterpret_cast<const void*>(&Recompiler::Thunks::ReadGPUSTAT));
+    if (cf.MipsT() != Reg::zero)
+    {
+      const GPR data = GPR(AllocateHostReg(
+        HR_MODE_WRITE, EMULATE_LOAD_DELAYS ? HR_TYPE_NEXT_LOAD_DELAY_VALUE : HR_TYPE_CPU_REG, cf.MipsT()));
+      if (data.Index() != RRET.Index())
+        rvAsm->MV(data, RRET);
+    }
+
+    return;
+  }
+
   FlushForLoadStore(address, false, use_fastmem);
   const GPR addr = ComputeLoadStoreAddressArg(cf, address);
   GenerateLoad(addr, size, sign, use_fastmem, [this, cf]() {
@@ -230,6 +230,9 @@ void CPU::NewRec::X64Compiler::EndBlock(const std::optional<u32>& newpc, bool do
   }
   m_dirty_pc = false;
 
+  if (do_event_test && newpc.has_value() && CodeCache::CanElideBlockLinkEventTest(m_block, newpc.value()))
+    do_event_test = false;
+
   // flush regs
   Flush(FLUSH_END_BLOCK);
   EndAndLinkBlock(newpc, do_event_test, false);
@@ -313,7 +316,18 @@ void CPU::NewRec::X64Compiler::EndAndLinkBlock(const std::optional<u32>& newpc,
     {
       // Special case: ourselves! No need to backlink then.
       Log_DebugPrintf("Linking block at %08X to self", m_block->pc);
-      cg->jmp(cg->getCode());
+      if (m_block->HasFlag(CodeCache::BlockFlags::IsIdleLoop))
+      {
+        // Idle loop taking its back edge: burn the rest of the slice and run events instead of
+        // spinning until the downcount test fires.
+        cg->mov(RWARG1, cg->dword[PTR(&g_state.downcount)]);
+        cg->mov(cg->dword[PTR(&g_state.pending_ticks)], RWARG1);
+        cg->jmp(CodeCache::g_run_events_and_dispatch);
+      }
+      else
+      {
+        cg->jmp(cg->getCode());
+      }
     }
     else
     {
@@ -1485,6 +1499,24 @@ void CPU::NewRec::X64Compiler::GenerateStore(const Xbyak::Reg32& addr_reg, const
 void CPU::NewRec::X64Compiler::Compile_lxx(CompileFlags cf, MemoryAccessSize size, bool sign, bool use_fastmem,
                                            const std::optional<VirtualMemoryAddress>& address)
 {
+  if (address.has_value() && size == MemoryAccessSize::Word && !g_settings.gpu_pgxp_enable &&
+      IsGPUSTATLoadAddress(address.value()))
+  {
+    // Hottest MMIO read in most titles; the dedicated thunk takes no arguments and skips the
+    // handler table dispatch entirely.
+    FlushForLoadStore(address, false, false);
+    cg->call(reinterpret_cast<const void*>(&Recompiler::Thunks::ReadGPUSTAT));
+    if (cf.MipsT() != Reg::zero)
+    {
+      const Reg32 data = Reg32(AllocateHostReg(GetFlagsForNewLoadDelayedReg(),
+                                               EMULATE_LOAD_DELAYS ? HR_TYPE_NEXT_LOAD_DELAY_VALUE : HR_TYPE_CPU_REG,
+                                               cf.MipsT()));
+      cg->mov(data, RWRET);
+    }
+
+    return;
+  }
+
   const std::optional<Reg32> addr_reg = g_settings.gpu_pgxp_enable ?
                                           std::optional<Reg32>(Reg32(AllocateTempHostReg(HR_CALLEE_SAVED))) :
                                           std::optional<Reg32>();
@@ -2099,6 +2131,45 @@ void CPU::NewRec::X64Compiler::Compile_cop2(CompileFlags cf)
   TickCount func_ticks;
   GTE::InstructionImpl func = GTE::GetInstructionImpl(inst->bits, &func_ticks);
 
+  // NCLIP runs once per polygon, and the flush/call/ret round-trip costs more than the op itself,
+  // so emit the cross product inline. Everything else still goes through the C implementation.
+  if (GTE::Instruction{inst->bits}.command == 0x06 && !(g_settings.gpu_pgxp_enable && g_settings.gpu_pgxp_culling))
+  {
+    // MAC0 = SX0*(SY1-SY2) + SX1*(SY2-SY0) + SX2*(SY0-SY1)
+    cg->movsx(RXARG1, cg->word[PTR(&g_state.gte_regs.SXY0[1])]);
+    cg->movsx(RXARG2, cg->word[PTR(&g_state.gte_regs.SXY1[1])]);
+    cg->movsx(RXARG3, cg->word[PTR(&g_state.gte_regs.SXY2[1])]);
+    cg->mov(RXRET, RXARG2);
+    cg->sub(RXRET, RXARG3);  // SY1-SY2
+    cg->sub(RXARG3, RXARG1); // SY2-SY0
+    cg->sub(RXARG1, RXARG2); // SY0-SY1
+    cg->movsx(RXARG2, cg->word[PTR(&g_state.gte_regs.SXY0[0])]);
+    cg->imul(RXRET, RXARG2);
+    cg->movsx(RXARG2, cg->word[PTR(&g_state.gte_regs.SXY1[0])]);
+    cg->imul(RXARG3, RXARG2);
+    cg->add(RXRET, RXARG3);
+    cg->movsx(RXARG2, cg->word[PTR(&g_state.gte_regs.SXY2[0])]);
+    cg->imul(RXARG1, RXARG2);
+    cg->add(RXRET, RXARG1);
+
+    // FLAG is all zeros unless the sum exceeds 32 bits, in which case the MAC0 and error bits set.
+    Xbyak::Label no_overflow;
+    cg->xor_(RWARG2, RWARG2);
+    cg->movsxd(RXARG1, RWRET);
+    cg->cmp(RXARG1, RXRET);
+    cg->je(no_overflow);
+    cg->mov(RWARG2, 0x80010000u); // error | mac0_overflow
+    cg->mov(RWARG3, 0x80008000u); // error | mac0_underflow
+    cg->test(RXRET, RXRET);
+    cg->cmovs(RWARG2, RWARG3);
+    cg->L(no_overflow);
+    cg->mov(cg->dword[PTR(&g_state.gte_regs.FLAG.bits)], RWARG2);
+    cg->mov(cg->dword[PTR(&g_state.gte_regs.MAC0)], RWRET);
+
+    AddGTETicks(func_ticks);
+    return;
+  }
+
   Flush(FLUSH_FOR_C_CALL);
   cg->mov(RWARG1, inst->bits & GTE::Instruction::REQUIRED_BITS_MASK);
   cg->call(reinterpret_cast<const void*>(func));
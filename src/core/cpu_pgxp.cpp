@@ -22,6 +22,8 @@ enum : u32
   VERTEX_CACHE_WIDTH = 0x800 * 2,
   VERTEX_CACHE_HEIGHT = 0x800 * 2,
   VERTEX_CACHE_SIZE = VERTEX_CACHE_WIDTH * VERTEX_CACHE_HEIGHT,
+  VERTEX_CACHE_TILE_SHIFT = 3,
+  VERTEX_CACHE_TILE_SIZE = 1 << VERTEX_CACHE_TILE_SHIFT,
   PGXP_MEM_SIZE = (static_cast<u32>(Bus::RAM_8MB_SIZE) + static_cast<u32>(CPU::SCRATCHPAD_SIZE)) / 4,
   PGXP_MEM_SCRATCH_OFFSET = Bus::RAM_8MB_SIZE / 4
 };
@@ -53,6 +55,7 @@ union psx_value
 };
 } // namespace
 
+static u32 GetVertexCacheIndex(s16 sx, s16 sy);
 static void CacheVertex(s16 sx, s16 sy, const PGXP_value& vertex);
 static PGXP_value* GetCachedVertex(short sx, short sy);
 
@@ -207,14 +210,16 @@ ALWAYS_INLINE_RELEASE double CPU::PGXP::f16Overflow(double in)
 
 ALWAYS_INLINE_RELEASE CPU::PGXP_value* CPU::PGXP::GetPtr(u32 addr)
 {
-  if ((addr & SCRATCHPAD_ADDR_MASK) == SCRATCHPAD_ADDR)
-    return &s_mem[PGXP_MEM_SCRATCH_OFFSET + ((addr & SCRATCHPAD_OFFSET_MASK) >> 2)];
-
+  // Test RAM first: it covers almost every tracked access, and the scratchpad doesn't overlap the
+  // mirror range. Untracked addresses (hardware registers, BIOS) fall through both compares.
   const u32 paddr = (addr & PHYSICAL_MEMORY_ADDRESS_MASK);
   if (paddr < Bus::RAM_MIRROR_END)
     return &s_mem[(paddr & Bus::g_ram_mask) >> 2];
-  else
-    return nullptr;
+
+  if ((addr & SCRATCHPAD_ADDR_MASK) == SCRATCHPAD_ADDR)
+    return &s_mem[PGXP_MEM_SCRATCH_OFFSET + ((addr & SCRATCHPAD_OFFSET_MASK) >> 2)];
+
+  return nullptr;
 }
 
 ALWAYS_INLINE_RELEASE void CPU::PGXP::ValidateAndCopyMem(PGXP_value* dest, u32 addr, u32 value)
@@ -434,12 +439,24 @@ void CPU::PGXP::CPU_SWC2(u32 instr, u32 addr, u32 rtVal)
   WriteMem(&g_state.pgxp_gte[rt(instr)], addr);
 }
 
+ALWAYS_INLINE_RELEASE u32 CPU::PGXP::GetVertexCacheIndex(s16 sx, s16 sy)
+{
+  // Tiled layout: neighbouring screen coordinates land in the same 8x8 tile instead of rows
+  // ~80KB apart, so the lookups polygon vertices perform stay within a few cache lines.
+  const u32 x = static_cast<u32>(sx + 0x800);
+  const u32 y = static_cast<u32>(sy + 0x800);
+  return ((((y >> VERTEX_CACHE_TILE_SHIFT) * (VERTEX_CACHE_WIDTH >> VERTEX_CACHE_TILE_SHIFT) +
+            (x >> VERTEX_CACHE_TILE_SHIFT))
+           << (VERTEX_CACHE_TILE_SHIFT * 2)) |
+          ((y & (VERTEX_CACHE_TILE_SIZE - 1)) << VERTEX_CACHE_TILE_SHIFT) | (x & (VERTEX_CACHE_TILE_SIZE - 1)));
+}
+
 ALWAYS_INLINE_RELEASE void CPU::PGXP::CacheVertex(s16 sx, s16 sy, const PGXP_value& vertex)
 {
   if (sx >= -0x800 && sx <= 0x7ff && sy >= -0x800 && sy <= 0x7ff)
   {
     // Write vertex into cache
-    s_vertex_cache[(sy + 0x800) * VERTEX_CACHE_WIDTH + (sx + 0x800)] = vertex;
+    s_vertex_cache[GetVertexCacheIndex(sx, sy)] = vertex;
   }
 }
 
@@ -448,7 +465,7 @@ ALWAYS_INLINE_RELEASE CPU::PGXP_value* CPU::PGXP::GetCachedVertex(short sx, shor
   if (sx >= -0x800 && sx <= 0x7ff && sy >= -0x800 && sy <= 0x7ff)
   {
     // Return pointer to cache entry
-    return &s_vertex_cache[(sy + 0x800) * VERTEX_CACHE_WIDTH + (sx + 0x800)];
+    return &s_vertex_cache[GetVertexCacheIndex(sx, sy)];
   }
 
   return nullptr;
@@ -528,33 +545,54 @@ bool CPU::PGXP::GetPreciseVertex(u32 addr, u32 value, int x, int y, int xOffs, i
 void CPU::PGXP::CPU_LW(u32 instr, u32 addr, u32 rtVal)
 {
   // Rt = Mem[Rs + Im]
+  // In vertex-only mode, only the GTE <-> memory path (LWC2/SWC2/MTC2/MFC2) carries precision;
+  // plain GPR loads and stores are left untracked. Stale table entries are harmless because every
+  // consumer revalidates against the current integer value.
+  if (g_settings.UsingPGXPVertexOnlyMode())
+    return;
+
   ValidateAndCopyMem(&g_state.pgxp_gpr[rt(instr)], addr, rtVal);
 }
 
 void CPU::PGXP::CPU_LBx(u32 instr, u32 addr, u32 rtVal)
 {
+  if (g_settings.UsingPGXPVertexOnlyMode())
+    return;
+
   g_state.pgxp_gpr[rt(instr)] = PGXP_value_invalid;
 }
 
 void CPU::PGXP::CPU_LH(u32 instr, u32 addr, u32 rtVal)
 {
   // Rt = Mem[Rs + Im] (sign extended)
+  if (g_settings.UsingPGXPVertexOnlyMode())
+    return;
+
   ValidateAndCopyMem16(&g_state.pgxp_gpr[rt(instr)], addr, rtVal, true);
 }
 
 void CPU::PGXP::CPU_LHU(u32 instr, u32 addr, u32 rtVal)
 {
   // Rt = Mem[Rs + Im] (zero extended)
+  if (g_settings.UsingPGXPVertexOnlyMode())
+    return;
+
   ValidateAndCopyMem16(&g_state.pgxp_gpr[rt(instr)], addr, rtVal, false);
 }
 
 void CPU::PGXP::CPU_SB(u32 instr, u32 addr, u32 rtVal)
 {
+  if (g_settings.UsingPGXPVertexOnlyMode())
+    return;
+
   WriteMem(&PGXP_value_invalid, addr);
 }
 
 void CPU::PGXP::CPU_SH(u32 instr, u32 addr, u32 rtVal)
 {
+  if (g_settings.UsingPGXPVertexOnlyMode())
+    return;
+
   PGXP_value* val = &g_state.pgxp_gpr[rt(instr)];
   Validate(val, rtVal);
   WriteMem16(val, addr);
@@ -563,6 +601,9 @@ void CPU::PGXP::CPU_SH(u32 instr, u32 addr, u32 rtVal)
 void CPU::PGXP::CPU_SW(u32 instr, u32 addr, u32 rtVal)
 {
   // Mem[Rs + Im] = Rt
+  if (g_settings.UsingPGXPVertexOnlyMode())
+    return;
+
   PGXP_value* val = &g_state.pgxp_gpr[rt(instr)];
   Validate(val, rtVal);
   WriteMem(val, addr);
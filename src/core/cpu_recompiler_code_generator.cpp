@@ -2375,8 +2375,11 @@ bool CodeGenerator::Compile_Branch(Instruction instruction, const CodeCache::Ins
         m_register_cache.PushState();
         {
           WriteNewPC(branch_target, false);
-          EmitConditionalBranch(Condition::GreaterEqual, false, pending_ticks.GetHostRegister(), downcount,
-                                &return_to_dispatcher);
+          if (!CodeCache::CanElideBlockLinkEventTest(m_block, static_cast<u32>(branch_target.constant_value)))
+          {
+            EmitConditionalBranch(Condition::GreaterEqual, false, pending_ticks.GetHostRegister(), downcount,
+                                  &return_to_dispatcher);
+          }
 
           // we're committed at this point :D
           EmitEndBlock(true, nullptr);
@@ -2411,12 +2414,14 @@ bool CodeGenerator::Compile_Branch(Instruction instruction, const CodeCache::Ins
         WriteNewPC(branch_target, true);
       }
 
-      EmitConditionalBranch(Condition::GreaterEqual, false, pending_ticks.GetHostRegister(), downcount,
-                            &return_to_dispatcher);
+      const Value& jump_target = (condition != Condition::Always) ? constant_next_pc : branch_target;
+      if (!CodeCache::CanElideBlockLinkEventTest(m_block, static_cast<u32>(jump_target.constant_value)))
+      {
+        EmitConditionalBranch(Condition::GreaterEqual, false, pending_ticks.GetHostRegister(), downcount,
+                              &return_to_dispatcher);
+      }
 
       EmitEndBlock(true, nullptr);
-
-      const Value& jump_target = (condition != Condition::Always) ? constant_next_pc : branch_target;
       DebugAssert(jump_target.IsConstant());
       if (static_cast<u32>(jump_target.constant_value) == m_block->pc)
       {
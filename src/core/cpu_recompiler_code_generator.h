@@ -59,6 +59,12 @@ public:
 
   const void* CompileBlock(CodeCache::Block* block, u32* out_host_code_size, u32* out_host_far_code_size);
 
+  /// Backprop register info for the instruction currently being compiled, or null outside of instruction compilation.
+  ALWAYS_INLINE const CodeCache::InstructionInfo* GetCurrentInstructionInfo() const
+  {
+    return m_current_instruction.info;
+  }
+
   //////////////////////////////////////////////////////////////////////////
   // Code Generation
   //////////////////////////////////////////////////////////////////////////
@@ -32,7 +32,7 @@ void CodeGenerator::EmitStoreInterpreterLoadDelay(Reg reg, const Value& value)
 Value CodeGenerator::EmitLoadGuestMemory(Instruction instruction, const CodeCache::InstructionInfo& info,
                                          const Value& address, const SpeculativeValue& address_spec, RegSize size)
 {
-  if (address.IsConstant() && !SpeculativeIsCacheIsolated())
+  if (address.IsConstant() && !SpeculativeIsCacheIsolated() && !HasAnyMemoryWatchpoints())
   {
     TickCount read_ticks;
     void* ptr = GetDirectReadMemoryPointer(
@@ -59,12 +59,24 @@ Value CodeGenerator::EmitLoadGuestMemory(Instruction instruction, const CodeCach
       m_delayed_cycles_add += read_ticks;
       return result;
     }
+
+    if (size == RegSize_32 && IsGPUSTATLoadAddress(static_cast<u32>(address.constant_value)))
+    {
+      // Hottest MMIO read in most titles; the dedicated thunk takes no arguments and never
+      // faults, so the generic slowmem path can be skipped entirely.
+      Value result = m_register_cache.AllocateScratch(RegSize_32);
+      AddPendingCycles(true);
+      m_register_cache.FlushCallerSavedGuestRegisters(true, true);
+      EmitFunctionCall(&result, &Thunks::ReadGPUSTAT);
+      return result;
+    }
   }
 
   Value result = m_register_cache.AllocateScratch(HostPointerSize);
 
   const bool use_fastmem = !g_settings.cpu_recompiler_memory_exceptions &&
-    (address_spec ? Bus::CanUseFastmemForAddress(*address_spec) : true) && !SpeculativeIsCacheIsolated();
+    (address_spec ? Bus::CanUseFastmemForAddress(*address_spec) : true) && !SpeculativeIsCacheIsolated() &&
+    !HasAnyMemoryWatchpoints();
   if (address_spec)
   {
     if (!use_fastmem)
@@ -120,7 +132,7 @@ void CodeGenerator::EmitStoreGuestMemory(Instruction instruction, const CodeCach
                                          const Value& address, const SpeculativeValue& address_spec, RegSize size,
                                          const Value& value)
 {
-  if (address.IsConstant() && !SpeculativeIsCacheIsolated())
+  if (address.IsConstant() && !SpeculativeIsCacheIsolated() && !HasAnyMemoryWatchpoints())
   {
     void* ptr = GetDirectWriteMemoryPointer(
       static_cast<u32>(address.constant_value),
@@ -138,7 +150,8 @@ void CodeGenerator::EmitStoreGuestMemory(Instruction instruction, const CodeCach
   }
 
   const bool use_fastmem = !g_settings.cpu_recompiler_memory_exceptions &&
-    (address_spec ? Bus::CanUseFastmemForAddress(*address_spec) : true) && !SpeculativeIsCacheIsolated();
+    (address_spec ? Bus::CanUseFastmemForAddress(*address_spec) : true) && !SpeculativeIsCacheIsolated() &&
+    !HasAnyMemoryWatchpoints();
   if (address_spec)
   {
     if (!use_fastmem)
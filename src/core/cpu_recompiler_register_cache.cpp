@@ -863,8 +863,27 @@ bool RegisterCache::EvictOneGuestRegister()
   if (m_state.guest_reg_order_count == 0)
     return false;
 
-  // evict the register used the longest time ago
-  Reg evict_reg = m_state.guest_reg_order[m_state.guest_reg_order_count - 1];
+  // prefer evicting a register with no further uses in this block; the backprop flags from
+  // FillBlockRegInfo() tell us which cached values are already dead at the current instruction
+  Reg evict_reg = Reg::count;
+  const CodeCache::InstructionInfo* const iinfo = m_code_generator.GetCurrentInstructionInfo();
+  if (iinfo)
+  {
+    for (u32 i = m_state.guest_reg_order_count; i > 0; i--)
+    {
+      const Reg reg = m_state.guest_reg_order[i - 1];
+      if (!iinfo->UsedTest(reg))
+      {
+        evict_reg = reg;
+        break;
+      }
+    }
+  }
+
+  // otherwise evict the register used the longest time ago
+  if (evict_reg == Reg::count)
+    evict_reg = m_state.guest_reg_order[m_state.guest_reg_order_count - 1];
+
   Log_ProfilePrintf("Evicting guest register %s", GetRegName(evict_reg));
   FlushGuestRegister(evict_reg, true, true);
 
@@ -31,4 +31,8 @@ void UncheckedWriteMemoryByte(u32 address, u32 value);
 void UncheckedWriteMemoryHalfWord(u32 address, u32 value);
 void UncheckedWriteMemoryWord(u32 address, u32 value);
 
+// Dedicated fast path for constant-address GPUSTAT loads. Never faults, so it is safe in both
+// checked and unchecked configurations.
+u32 ReadGPUSTAT();
+
 } // namespace CPU::Recompiler::Thunks
@@ -12,6 +12,7 @@
 #include "interrupt_controller.h"
 #include "mdec.h"
 #include "pad.h"
+#include "performance_profiler.h"
 #include "spu.h"
 #include "system.h"
 
@@ -470,6 +471,8 @@ TickCount DMA::GetTransferHaltTicks()
 
 bool DMA::TransferChannel(Channel channel)
 {
+  PerformanceProfiler::Scope profiler_scope(PerformanceProfiler::Event::DMATransfer);
+
   ChannelState& cs = s_state[static_cast<u32>(channel)];
   const u32 mask = GetAddressMask();
 
@@ -690,13 +693,21 @@ TickCount DMA::TransferMemoryToDevice(Channel channel, u32 address, u32 incremen
     {
       if (g_gpu->BeginDMAWrite())
       {
-        u8* ram_pointer = Bus::g_ram;
-        for (u32 i = 0; i < word_count; i++)
+        if (static_cast<s32>(increment) > 0 && ((address + (increment * word_count)) & mask) > address)
+        {
+          // Forward transfer which doesn't wrap, feed the FIFO directly from RAM.
+          g_gpu->DMAWrite(src_pointer, word_count, address, increment);
+        }
+        else
         {
-          u32 value;
-          std::memcpy(&value, &ram_pointer[address], sizeof(u32));
-          g_gpu->DMAWrite(address, value);
-          address = (address + increment) & mask;
+          u8* ram_pointer = Bus::g_ram;
+          for (u32 i = 0; i < word_count; i++)
+          {
+            u32 value;
+            std::memcpy(&value, &ram_pointer[address], sizeof(u32));
+            g_gpu->DMAWrite(address, value);
+            address = (address + increment) & mask;
+          }
         }
         g_gpu->EndDMAWrite();
       }
@@ -463,6 +463,7 @@ static void SwitchToGameList();
 static void PopulateGameListEntryList();
 static GPUTexture* GetTextureForGameListEntryType(GameList::EntryType type);
 static GPUTexture* GetGameListCover(const GameList::Entry* entry);
+static ImGuiFullscreen::AtlasImage GetGameListCoverAtlasImage(const GameList::Entry* entry);
 static GPUTexture* GetCoverForCurrentGame();
 
 // Lazily populated cover images.
@@ -573,6 +574,7 @@ bool FullscreenUI::Initialize()
     return false;
 
   ImGuiFullscreen::SetTheme(Host::GetBaseBoolSettingValue("Main", "UseLightFullscreenUITheme", false));
+  ImGuiFullscreen::SetTextureThumbnailCacheDirectory(Path::Combine(EmuFolders::Cache, "covers"));
   ImGuiFullscreen::UpdateLayoutScale();
 
   if (!ImGuiManager::AddFullscreenFontsIfMissing() || !ImGuiFullscreen::Initialize("images/placeholder.png") ||
@@ -841,15 +843,27 @@ void FullscreenUI::ReturnToMainWindow()
 
 bool FullscreenUI::LoadResources()
 {
-  s_app_icon_texture = LoadTexture("images/duck.png");
+  // Batch the load so the image decodes run in parallel on the thread pool.
+  std::vector<std::string_view> paths = {"images/duck.png", "fullscreenui/media-cdrom.png",
+                                         "fullscreenui/applications-system.png", "fullscreenui/multimedia-player.png",
+                                         "fullscreenui/address-book-new.png"};
 
-  s_fallback_disc_texture = LoadTexture("fullscreenui/media-cdrom.png");
-  s_fallback_exe_texture = LoadTexture("fullscreenui/applications-system.png");
-  s_fallback_psf_texture = LoadTexture("fullscreenui/multimedia-player.png");
-  s_fallback_playlist_texture = LoadTexture("fullscreenui/address-book-new.png");
+  std::array<TinyString, static_cast<u32>(GameDatabase::CompatibilityRating::Count)> star_paths;
+  for (u32 i = 0; i < static_cast<u32>(GameDatabase::CompatibilityRating::Count); i++)
+  {
+    star_paths[i] = TinyString::from_fmt("fullscreenui/star-{}.png", i);
+    paths.push_back(star_paths[i].view());
+  }
 
+  std::vector<std::shared_ptr<GPUTexture>> textures = ImGuiFullscreen::LoadTextures(paths);
+  DebugAssert(textures.size() == paths.size());
+  s_app_icon_texture = std::move(textures[0]);
+  s_fallback_disc_texture = std::move(textures[1]);
+  s_fallback_exe_texture = std::move(textures[2]);
+  s_fallback_psf_texture = std::move(textures[3]);
+  s_fallback_playlist_texture = std::move(textures[4]);
   for (u32 i = 0; i < static_cast<u32>(GameDatabase::CompatibilityRating::Count); i++)
-    s_game_compatibility_textures[i] = LoadTexture(TinyString::from_fmt("fullscreenui/star-{}.png", i).c_str());
+    s_game_compatibility_textures[i] = std::move(textures[5 + i]);
 
   return true;
 }
@@ -4077,6 +4091,10 @@ void FullscreenUI::DrawDisplaySettingsPage()
   DrawToggleSetting(bsi, FSUI_CSTR("CPU Mode"),
                     FSUI_CSTR("Uses PGXP for all instructions, not just memory operations."), "GPU", "PGXPCPU", false,
                     pgxp_enabled);
+  DrawToggleSetting(bsi, FSUI_CSTR("Vertex-Only Mode"),
+                    FSUI_CSTR("Tracks precision only on the GTE-to-memory path, reducing the PGXP overhead. Precision "
+                              "is lost when geometry is copied through CPU registers."),
+                    "GPU", "PGXPVertexOnly", false, pgxp_enabled);
 
   MenuHeading(FSUI_CSTR("Texture Replacements"));
 
@@ -5806,7 +5824,7 @@ void FullscreenUI::DrawGameList(const ImVec2& heading_size)
       if (!visible)
         continue;
 
-      GPUTexture* cover_texture = GetGameListCover(entry);
+      const ImGuiFullscreen::AtlasImage cover_image = GetGameListCoverAtlasImage(entry);
 
       if (entry->serial.empty())
         summary.fmt("{} - ", Settings::GetDiscRegionDisplayName(entry->region));
@@ -5815,12 +5833,10 @@ void FullscreenUI::DrawGameList(const ImVec2& heading_size)
 
       summary.append(Path::GetFileName(entry->path));
 
-      const ImRect image_rect(
-        CenterImage(ImRect(bb.Min, bb.Min + image_size), ImVec2(static_cast<float>(cover_texture->GetWidth()),
-                                                                static_cast<float>(cover_texture->GetHeight()))));
+      const ImRect image_rect(CenterImage(ImRect(bb.Min, bb.Min + image_size), cover_image.GetSize()));
 
-      ImGui::GetWindowDrawList()->AddImage(cover_texture, image_rect.Min, image_rect.Max, ImVec2(0.0f, 0.0f),
-                                           ImVec2(1.0f, 1.0f), IM_COL32(255, 255, 255, 255));
+      ImGui::GetWindowDrawList()->AddImage(cover_image.texture, image_rect.Min, image_rect.Max, cover_image.uv0,
+                                           cover_image.uv1, IM_COL32(255, 255, 255, 255));
 
       const float midpoint = bb.Min.y + g_large_font->FontSize + LayoutScale(4.0f);
       const float text_start_x = bb.Min.x + image_size.x + LayoutScale(15.0f);
@@ -6039,13 +6055,11 @@ void FullscreenUI::DrawGameGrid(const ImVec2& heading_size)
       bb.Min += style.FramePadding;
       bb.Max -= style.FramePadding;
 
-      GPUTexture* const cover_texture = GetGameListCover(entry);
-      const ImRect image_rect(
-        CenterImage(ImRect(bb.Min, bb.Min + image_size), ImVec2(static_cast<float>(cover_texture->GetWidth()),
-                                                                static_cast<float>(cover_texture->GetHeight()))));
+      const ImGuiFullscreen::AtlasImage cover_image = GetGameListCoverAtlasImage(entry);
+      const ImRect image_rect(CenterImage(ImRect(bb.Min, bb.Min + image_size), cover_image.GetSize()));
 
-      ImGui::GetWindowDrawList()->AddImage(cover_texture, image_rect.Min, image_rect.Max, ImVec2(0.0f, 0.0f),
-                                           ImVec2(1.0f, 1.0f), IM_COL32(255, 255, 255, 255));
+      ImGui::GetWindowDrawList()->AddImage(cover_image.texture, image_rect.Min, image_rect.Max, cover_image.uv0,
+                                           cover_image.uv1, IM_COL32(255, 255, 255, 255));
 
       const ImRect title_bb(ImVec2(bb.Min.x, bb.Min.y + image_height + title_spacing), bb.Max);
       const std::string_view title(
@@ -6392,6 +6406,27 @@ GPUTexture* FullscreenUI::GetGameListCover(const GameList::Entry* entry)
   return tex ? tex : GetTextureForGameListEntryType(entry->type);
 }
 
+ImGuiFullscreen::AtlasImage FullscreenUI::GetGameListCoverAtlasImage(const GameList::Entry* entry)
+{
+  auto cover_it = s_cover_image_map.find(entry->path);
+  if (cover_it == s_cover_image_map.end())
+  {
+    std::string cover_path(GameList::GetCoverImagePathForEntry(entry));
+    cover_it = s_cover_image_map.emplace(entry->path, std::move(cover_path)).first;
+  }
+
+  if (!cover_it->second.empty())
+    return ImGuiFullscreen::GetCachedAtlasImageAsync(cover_it->second);
+
+  // no cover, draw the type icon at full UVs
+  GPUTexture* const tex = GetTextureForGameListEntryType(entry->type);
+  ImGuiFullscreen::AtlasImage ret;
+  ret.texture = tex;
+  ret.width = static_cast<u16>(tex->GetWidth());
+  ret.height = static_cast<u16>(tex->GetHeight());
+  return ret;
+}
+
 GPUTexture* FullscreenUI::GetTextureForGameListEntryType(GameList::EntryType type)
 {
   switch (type)
@@ -10,8 +10,10 @@
 
 #include "common/assert.h"
 #include "common/byte_stream.h"
+#include "common/file_system.h"
 #include "common/heterogeneous_containers.h"
 #include "common/log.h"
+#include "common/memmap.h"
 #include "common/path.h"
 #include "common/string_util.h"
 #include "common/timer.h"
@@ -45,6 +47,7 @@ static const Entry* GetEntryForId(const std::string_view& code);
 
 static bool LoadFromCache();
 static bool SaveToCache();
+static void UnloadCacheStorage();
 
 static bool LoadGameDBJson();
 static bool ParseJsonEntry(Entry* entry, const rapidjson::Value& value);
@@ -80,6 +83,17 @@ static bool s_track_hashes_loaded = false;
 
 static std::vector<GameDatabase::Entry> s_entries;
 static PreferUnorderedStringMap<u32> s_code_lookup;
+static PreferUnorderedStringMap<u32> s_serial_lookup;
+
+// backing storage for the interned metadata views in Entry (JSON load path only)
+static StringPool s_string_pool;
+
+// Backing storage for the entry views when loaded from the cache. The mapping is read-only and
+// file-backed, so the OS shares its physical pages between every process that has the database
+// loaded; the heap buffer is only used when the platform cannot map files.
+static void* s_cache_mapping = nullptr;
+static size_t s_cache_mapping_size = 0;
+static std::vector<u8> s_cache_data;
 
 static TrackHashesMap s_track_hashes_map;
 } // namespace GameDatabase
@@ -95,13 +109,21 @@ void GameDatabase::EnsureLoaded()
 
   if (!LoadFromCache())
   {
+    // entries may hold views into a partially-parsed cache, drop them before the storage
     s_entries = {};
     s_code_lookup = {};
+    s_string_pool.Clear();
+    UnloadCacheStorage();
 
     LoadGameDBJson();
     SaveToCache();
   }
 
+  // index serials so per-serial lookups don't have to walk every entry
+  s_serial_lookup.reserve(s_entries.size());
+  for (u32 i = 0; i < static_cast<u32>(s_entries.size()); i++)
+    s_serial_lookup.emplace(s_entries[i].serial, i);
+
   Log_InfoPrintf("Database load took %.2f ms", timer.GetTimeMilliseconds());
 }
 
@@ -109,9 +131,23 @@ void GameDatabase::Unload()
 {
   s_entries = {};
   s_code_lookup = {};
+  s_serial_lookup = {};
+  s_string_pool.Clear();
+  UnloadCacheStorage();
   s_loaded = false;
 }
 
+void GameDatabase::UnloadCacheStorage()
+{
+  if (s_cache_mapping)
+  {
+    MemMap::UnmapFile(s_cache_mapping, s_cache_mapping_size);
+    s_cache_mapping = nullptr;
+    s_cache_mapping_size = 0;
+  }
+  s_cache_data = {};
+}
+
 const GameDatabase::Entry* GameDatabase::GetEntryForId(const std::string_view& code)
 {
   if (code.empty())
@@ -189,13 +225,8 @@ const GameDatabase::Entry* GameDatabase::GetEntryForSerial(const std::string_vie
 
 GameDatabase::Entry* GameDatabase::GetMutableEntry(const std::string_view& serial)
 {
-  for (Entry& entry : s_entries)
-  {
-    if (entry.serial == serial)
-      return &entry;
-  }
-
-  return nullptr;
+  auto iter = s_serial_lookup.find(serial);
+  return (iter != s_serial_lookup.end()) ? &s_entries[iter->second] : nullptr;
 }
 
 const char* GameDatabase::GetTraitName(Trait trait)
@@ -570,22 +601,107 @@ static std::string GetCacheFile()
   return Path::Combine(EmuFolders::Cache, "gamedb.cache");
 }
 
+namespace {
+// Zero-copy reader over the mapped cache file. Strings come back as views into the mapping,
+// which stays alive until Unload(), so nothing per-entry touches the heap.
+class CacheReader
+{
+public:
+  CacheReader(const u8* data, size_t size) : m_pos(data), m_end(data + size) {}
+
+  template<typename T>
+  bool Read(T* dest)
+  {
+    if (static_cast<size_t>(m_end - m_pos) < sizeof(T)) [[unlikely]]
+      return false;
+
+    std::memcpy(dest, m_pos, sizeof(T));
+    m_pos += sizeof(T);
+    return true;
+  }
+
+  bool ReadBytes(void* dest, size_t size)
+  {
+    if (static_cast<size_t>(m_end - m_pos) < size) [[unlikely]]
+      return false;
+
+    std::memcpy(dest, m_pos, size);
+    m_pos += size;
+    return true;
+  }
+
+  bool ReadStringView(std::string_view* dest)
+  {
+    u32 size;
+    if (!Read(&size) || static_cast<size_t>(m_end - m_pos) < size) [[unlikely]]
+      return false;
+
+    *dest = std::string_view(reinterpret_cast<const char*>(m_pos), size);
+    m_pos += size;
+    return true;
+  }
+
+  template<typename T>
+  bool ReadOptional(std::optional<T>* dest)
+  {
+    bool has_value;
+    if (!Read(&has_value))
+      return false;
+
+    if (!has_value)
+      return true;
+
+    T value;
+    if (!Read(&value))
+      return false;
+
+    *dest = value;
+    return true;
+  }
+
+private:
+  const u8* m_pos;
+  const u8* m_end;
+};
+} // namespace
+
 bool GameDatabase::LoadFromCache()
 {
-  std::unique_ptr<ByteStream> stream(
-    ByteStream::OpenFile(GetCacheFile().c_str(), BYTESTREAM_OPEN_READ | BYTESTREAM_OPEN_STREAMED));
-  if (!stream)
+  // Map the cache rather than reading it; the pages are shared between every process with the
+  // database loaded, and the entry strings point straight into them.
+  const std::string cache_file = GetCacheFile();
+  s_cache_mapping = MemMap::MapFile(cache_file.c_str(), &s_cache_mapping_size);
+  const u8* data;
+  size_t data_size;
+  if (s_cache_mapping)
   {
-    Log_DevPrintf("Cache does not exist, loading full database.");
-    return false;
+    MemMap::PrefetchMappedFile(s_cache_mapping, 0, s_cache_mapping_size);
+    data = static_cast<const u8*>(s_cache_mapping);
+    data_size = s_cache_mapping_size;
+  }
+  else
+  {
+    // No file mapping support (or no cache yet), fall back to one contiguous read.
+    std::optional<std::vector<u8>> file_data = FileSystem::ReadBinaryFile(cache_file.c_str());
+    if (!file_data.has_value())
+    {
+      Log_DevPrintf("Cache does not exist, loading full database.");
+      return false;
+    }
+
+    s_cache_data = std::move(file_data.value());
+    data = s_cache_data.data();
+    data_size = s_cache_data.size();
   }
 
+  CacheReader reader(data, data_size);
+
   const u64 gamedb_ts = Host::GetResourceFileTimestamp("gamedb.json").value_or(0);
 
   u32 signature, version, num_entries, num_codes;
   u64 file_gamedb_ts;
-  if (!stream->ReadU32(&signature) || !stream->ReadU32(&version) || !stream->ReadU64(&file_gamedb_ts) ||
-      !stream->ReadU32(&num_entries) || !stream->ReadU32(&num_codes) || signature != GAME_DATABASE_CACHE_SIGNATURE ||
+  if (!reader.Read(&signature) || !reader.Read(&version) || !reader.Read(&file_gamedb_ts) ||
+      !reader.Read(&num_entries) || !reader.Read(&num_codes) || signature != GAME_DATABASE_CACHE_SIGNATURE ||
       version != GAME_DATABASE_CACHE_VERSION)
   {
     Log_DevPrintf("Cache header is corrupted or version mismatch.");
@@ -609,25 +725,20 @@ bool GameDatabase::LoadFromCache()
     u8 compatibility;
     u32 num_disc_set_serials;
 
-    if (!stream->ReadSizePrefixedString(&entry.serial) || !stream->ReadSizePrefixedString(&entry.title) ||
-        !stream->ReadSizePrefixedString(&entry.genre) || !stream->ReadSizePrefixedString(&entry.developer) ||
-        !stream->ReadSizePrefixedString(&entry.publisher) || !stream->ReadU64(&entry.release_date) ||
-        !stream->ReadU8(&entry.min_players) || !stream->ReadU8(&entry.max_players) ||
-        !stream->ReadU8(&entry.min_blocks) || !stream->ReadU8(&entry.max_blocks) ||
-        !stream->ReadU16(&entry.supported_controllers) || !stream->ReadU8(&compatibility) ||
-        compatibility >= static_cast<u8>(GameDatabase::CompatibilityRating::Count) ||
-        !stream->Read2(bits.data(), num_bytes) ||
-        !ReadOptionalFromStream(stream.get(), &entry.display_active_start_offset) ||
-        !ReadOptionalFromStream(stream.get(), &entry.display_active_end_offset) ||
-        !ReadOptionalFromStream(stream.get(), &entry.display_line_start_offset) ||
-        !ReadOptionalFromStream(stream.get(), &entry.display_line_end_offset) ||
-        !ReadOptionalFromStream(stream.get(), &entry.dma_max_slice_ticks) ||
-        !ReadOptionalFromStream(stream.get(), &entry.dma_halt_ticks) ||
-        !ReadOptionalFromStream(stream.get(), &entry.gpu_fifo_size) ||
-        !ReadOptionalFromStream(stream.get(), &entry.gpu_max_run_ahead) ||
-        !ReadOptionalFromStream(stream.get(), &entry.gpu_pgxp_tolerance) ||
-        !ReadOptionalFromStream(stream.get(), &entry.gpu_pgxp_depth_threshold) ||
-        !stream->ReadSizePrefixedString(&entry.disc_set_name) || !stream->ReadU32(&num_disc_set_serials))
+    if (!reader.ReadStringView(&entry.serial) || !reader.ReadStringView(&entry.title) ||
+        !reader.ReadStringView(&entry.genre) || !reader.ReadStringView(&entry.developer) ||
+        !reader.ReadStringView(&entry.publisher) || !reader.Read(&entry.release_date) ||
+        !reader.Read(&entry.min_players) || !reader.Read(&entry.max_players) || !reader.Read(&entry.min_blocks) ||
+        !reader.Read(&entry.max_blocks) || !reader.Read(&entry.supported_controllers) ||
+        !reader.Read(&compatibility) || compatibility >= static_cast<u8>(GameDatabase::CompatibilityRating::Count) ||
+        !reader.ReadBytes(bits.data(), num_bytes) || !reader.ReadOptional(&entry.display_active_start_offset) ||
+        !reader.ReadOptional(&entry.display_active_end_offset) ||
+        !reader.ReadOptional(&entry.display_line_start_offset) ||
+        !reader.ReadOptional(&entry.display_line_end_offset) || !reader.ReadOptional(&entry.dma_max_slice_ticks) ||
+        !reader.ReadOptional(&entry.dma_halt_ticks) || !reader.ReadOptional(&entry.gpu_fifo_size) ||
+        !reader.ReadOptional(&entry.gpu_max_run_ahead) || !reader.ReadOptional(&entry.gpu_pgxp_tolerance) ||
+        !reader.ReadOptional(&entry.gpu_pgxp_depth_threshold) || !reader.ReadStringView(&entry.disc_set_name) ||
+        !reader.Read(&num_disc_set_serials))
     {
       Log_DevPrintf("Cache entry is corrupted.");
       return false;
@@ -638,7 +749,7 @@ bool GameDatabase::LoadFromCache()
       entry.disc_set_serials.reserve(num_disc_set_serials);
       for (u32 j = 0; j < num_disc_set_serials; j++)
       {
-        if (!stream->ReadSizePrefixedString(&entry.disc_set_serials.emplace_back()))
+        if (!reader.ReadStringView(&entry.disc_set_serials.emplace_back()))
         {
           Log_DevPrintf("Cache entry is corrupted.");
           return false;
@@ -657,16 +768,15 @@ bool GameDatabase::LoadFromCache()
 
   for (u32 i = 0; i < num_codes; i++)
   {
-    std::string code;
+    std::string_view code;
     u32 index;
-    if (!stream->ReadSizePrefixedString(&code) || !stream->ReadU32(&index) ||
-        index >= static_cast<u32>(s_entries.size()))
+    if (!reader.ReadStringView(&code) || !reader.Read(&index) || index >= static_cast<u32>(s_entries.size()))
     {
       Log_DevPrintf("Cache code entry is corrupted.");
       return false;
     }
 
-    s_code_lookup.emplace(std::move(code), index);
+    s_code_lookup.emplace(code, index);
   }
 
   return true;
@@ -728,7 +838,7 @@ bool GameDatabase::SaveToCache()
 
     result = result && stream->WriteSizePrefixedString(entry.disc_set_name);
     result = result && stream->WriteU32(static_cast<u32>(entry.disc_set_serials.size()));
-    for (const std::string& serial : entry.disc_set_serials)
+    for (const std::string_view& serial : entry.disc_set_serials)
       result = result && stream->WriteSizePrefixedString(serial);
   }
 
@@ -882,16 +992,23 @@ bool GameDatabase::ParseJsonEntry(Entry* entry, const rapidjson::Value& value)
     return false;
   }
 
-  if (!GetStringFromObject(value, "serial", &entry->serial) || !GetStringFromObject(value, "name", &entry->title) ||
-      entry->serial.empty())
+  std::string serial, title;
+  if (!GetStringFromObject(value, "serial", &serial) || !GetStringFromObject(value, "name", &title) || serial.empty())
   {
     Log_ErrorPrintf("Missing serial or title for entry");
     return false;
   }
 
-  GetStringFromObject(value, "genre", &entry->genre);
-  GetStringFromObject(value, "developer", &entry->developer);
-  GetStringFromObject(value, "publisher", &entry->publisher);
+  entry->serial = s_string_pool.Intern(serial);
+  entry->title = s_string_pool.Intern(title);
+
+  std::string genre, developer, publisher;
+  GetStringFromObject(value, "genre", &genre);
+  GetStringFromObject(value, "developer", &developer);
+  GetStringFromObject(value, "publisher", &publisher);
+  entry->genre = s_string_pool.Intern(genre);
+  entry->developer = s_string_pool.Intern(developer);
+  entry->publisher = s_string_pool.Intern(publisher);
 
   GetUIntFromObject(value, "minPlayers", &entry->min_players);
   GetUIntFromObject(value, "maxPlayers", &entry->max_players);
@@ -1003,7 +1120,9 @@ bool GameDatabase::ParseJsonEntry(Entry* entry, const rapidjson::Value& value)
     }
   }
 
-  GetStringFromObject(value, "discSetName", &entry->disc_set_name);
+  std::string disc_set_name;
+  GetStringFromObject(value, "discSetName", &disc_set_name);
+  entry->disc_set_name = s_string_pool.Intern(disc_set_name);
   const auto disc_set_serials = value.FindMember("discSetSerials");
   if (disc_set_serials != value.MemberEnd())
   {
@@ -1011,11 +1130,12 @@ bool GameDatabase::ParseJsonEntry(Entry* entry, const rapidjson::Value& value)
     {
       const auto disc_set_serials_array = disc_set_serials->value.GetArray();
       entry->disc_set_serials.reserve(disc_set_serials_array.Size());
-      for (const rapidjson::Value& serial : disc_set_serials_array)
+      for (const rapidjson::Value& disc_serial : disc_set_serials_array)
       {
-        if (serial.IsString())
+        if (disc_serial.IsString())
         {
-          entry->disc_set_serials.emplace_back(serial.GetString(), serial.GetStringLength());
+          entry->disc_set_serials.emplace_back(
+            s_string_pool.Intern(std::string_view(disc_serial.GetString(), disc_serial.GetStringLength())));
         }
         else
         {
@@ -55,12 +55,16 @@ enum class Trait : u32
 
 struct Entry
 {
-  // TODO: Make string_view.
-  std::string serial;
-  std::string title;
-  std::string genre;
-  std::string developer;
-  std::string publisher;
+  // All strings are views into the memory-mapped cache file (whose read-only pages the OS shares
+  // between every process mapping it), or into the intern pool when loaded from JSON. Valid
+  // until Unload().
+  std::string_view serial;
+  std::string_view title;
+
+  // Interned in a shared pool, since these repeat across most of the database.
+  std::string_view genre;
+  std::string_view developer;
+  std::string_view publisher;
   u64 release_date;
   u8 min_players;
   u8 max_players;
@@ -81,8 +85,8 @@ struct Entry
   std::optional<float> gpu_pgxp_tolerance;
   std::optional<float> gpu_pgxp_depth_threshold;
 
-  std::string disc_set_name;
-  std::vector<std::string> disc_set_serials;
+  std::string_view disc_set_name;
+  std::vector<std::string_view> disc_set_serials;
 
   ALWAYS_INLINE bool HasTrait(Trait trait) const { return traits[static_cast<int>(trait)]; }
 
@@ -22,9 +22,12 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cctype>
+#include <chrono>
 #include <ctime>
 #include <string_view>
+#include <thread>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
@@ -394,11 +397,16 @@ static std::string GameList::GetCacheFilename()
 void GameList::LoadCache()
 {
   std::string filename(GetCacheFilename());
-  std::unique_ptr<ByteStream> stream =
-    ByteStream::OpenFile(filename.c_str(), BYTESTREAM_OPEN_READ | BYTESTREAM_OPEN_STREAMED);
-  if (!stream)
+
+  // Deserializing field-by-field through a file stream costs a read call per field, which adds up
+  // to hundreds of milliseconds on large libraries. Pull the whole cache into memory in one read
+  // and parse it from there instead.
+  const std::optional<std::vector<u8>> data = FileSystem::ReadBinaryFile(filename.c_str());
+  if (!data.has_value())
     return;
 
+  std::unique_ptr<ReadOnlyMemoryByteStream> stream =
+    ByteStream::CreateReadOnlyMemoryStream(data->data(), static_cast<u32>(data->size()));
   if (!LoadEntriesFromCache(stream.get()))
   {
     Log_WarningPrintf("Deleting corrupted cache file '%s'", filename.c_str());
@@ -488,7 +496,8 @@ void GameList::ScanDirectory(const char* path, bool recursive, bool only_cache,
 
   FileSystem::FindResultsArray files;
   FileSystem::FindFiles(path, "*",
-                        recursive ? (FILESYSTEM_FIND_FILES | FILESYSTEM_FIND_HIDDEN_FILES | FILESYSTEM_FIND_RECURSIVE) :
+                        recursive ? (FILESYSTEM_FIND_FILES | FILESYSTEM_FIND_HIDDEN_FILES | FILESYSTEM_FIND_RECURSIVE |
+                                     FILESYSTEM_FIND_PARALLEL) :
                                     (FILESYSTEM_FIND_FILES | FILESYSTEM_FIND_HIDDEN_FILES),
                         &files);
   if (files.empty())
@@ -498,6 +507,9 @@ void GameList::ScanDirectory(const char* path, bool recursive, bool only_cache,
   progress->SetProgressRange(static_cast<u32>(files.size()));
   progress->SetProgressValue(0);
 
+  // First pass satisfies as much as possible from the cache, and collects the files which need a
+  // full identify. That part is dominated by hashing the image, so it gets spread over a pool.
+  std::vector<std::pair<std::string, std::time_t>> files_to_scan;
   u32 files_scanned = 0;
   for (FILESYSTEM_FIND_DATA& ffd : files)
   {
@@ -513,12 +525,78 @@ void GameList::ScanDirectory(const char* path, bool recursive, bool only_cache,
     if (GetEntryForPath(ffd.FileName.c_str()) ||
         AddFileFromCache(ffd.FileName, ffd.ModificationTime, played_time_map) || only_cache)
     {
+      progress->SetProgressValue(files_scanned);
       continue;
     }
 
-    progress->SetFormattedStatusText("Scanning '%s'...", FileSystem::GetDisplayNameFromPath(ffd.FileName).c_str());
-    ScanFile(std::move(ffd.FileName), ffd.ModificationTime, lock, played_time_map);
+    files_to_scan.emplace_back(std::move(ffd.FileName), ffd.ModificationTime);
+  }
+
+  if (files_to_scan.empty())
+  {
     progress->SetProgressValue(files_scanned);
+    progress->PopState();
+    return;
+  }
+
+  const u32 num_threads =
+    std::min(std::max(std::thread::hardware_concurrency(), 1u), static_cast<u32>(files_to_scan.size()));
+  if (num_threads == 1)
+  {
+    for (auto& [file_path, file_timestamp] : files_to_scan)
+    {
+      if (progress->IsCancelled())
+        break;
+
+      progress->SetFormattedStatusText("Scanning '%s'...", FileSystem::GetDisplayNameFromPath(file_path).c_str());
+
+      std::unique_lock lock(s_mutex);
+      ScanFile(std::move(file_path), file_timestamp, lock, played_time_map);
+      progress->SetProgressValue(++files_scanned);
+    }
+  }
+  else
+  {
+    progress->SetFormattedStatusText("Scanning %u files...", static_cast<u32>(files_to_scan.size()));
+
+    // Workers pull per-file jobs off a shared index; the progress callback is only touched from
+    // this thread, cancellation is forwarded through an atomic the workers poll.
+    std::atomic<u32> next_file{0};
+    std::atomic<u32> files_completed{0};
+    std::atomic<bool> cancelled{false};
+    std::vector<std::thread> workers;
+    workers.reserve(num_threads);
+    for (u32 i = 0; i < num_threads; i++)
+    {
+      workers.emplace_back([&files_to_scan, &played_time_map, &next_file, &files_completed, &cancelled]() {
+        for (;;)
+        {
+          const u32 index = next_file.fetch_add(1, std::memory_order_acq_rel);
+          if (index >= static_cast<u32>(files_to_scan.size()) || cancelled.load(std::memory_order_acquire))
+            break;
+
+          auto& [file_path, file_timestamp] = files_to_scan[index];
+          std::unique_lock lock(s_mutex);
+          ScanFile(std::move(file_path), file_timestamp, lock, played_time_map);
+          files_completed.fetch_add(1, std::memory_order_acq_rel);
+        }
+      });
+    }
+
+    while (files_completed.load(std::memory_order_acquire) < static_cast<u32>(files_to_scan.size()) &&
+           !cancelled.load(std::memory_order_relaxed))
+    {
+      if (progress->IsCancelled())
+        cancelled.store(true, std::memory_order_release);
+
+      progress->SetProgressValue(files_scanned + files_completed.load(std::memory_order_acquire));
+      std::this_thread::sleep_for(std::chrono::milliseconds(25));
+    }
+
+    for (std::thread& thread : workers)
+      thread.join();
+
+    files_scanned += files_completed.load(std::memory_order_acquire);
   }
 
   progress->SetProgressValue(files_scanned);
@@ -557,12 +635,6 @@ bool GameList::ScanFile(std::string path, std::time_t timestamp, std::unique_loc
   entry.path = std::move(path);
   entry.last_modified_time = timestamp;
 
-  if (s_cache_write_stream || OpenCacheForWriting())
-  {
-    if (!WriteEntryToCache(&entry))
-      Log_WarningPrintf("Failed to write entry '%s' to cache", entry.path.c_str());
-  }
-
   auto iter = played_time_map.find(entry.serial);
   if (iter != played_time_map.end())
   {
@@ -571,6 +643,14 @@ bool GameList::ScanFile(std::string path, std::time_t timestamp, std::unique_loc
   }
 
   lock.lock();
+
+  // the cache stream is shared between scan workers, so it's only written under the lock
+  if (s_cache_write_stream || OpenCacheForWriting())
+  {
+    if (!WriteEntryToCache(&entry))
+      Log_WarningPrintf("Failed to write entry '%s' to cache", entry.path.c_str());
+  }
+
   s_entries.push_back(std::move(entry));
   return true;
 }
@@ -1069,12 +1149,12 @@ TinyString GameList::FormatTimespan(std::time_t timespan, bool long_format)
 }
 
 std::vector<std::pair<std::string, const GameList::Entry*>>
-GameList::GetMatchingEntriesForSerial(const std::span<const std::string> serials)
+GameList::GetMatchingEntriesForSerial(const std::span<const std::string_view> serials)
 {
   std::vector<std::pair<std::string, const GameList::Entry*>> ret;
   ret.reserve(serials.size());
 
-  for (const std::string& serial : serials)
+  for (const std::string_view& serial : serials)
   {
     const Entry* matching_entry = nullptr;
     bool has_multiple_entries = false;
@@ -1112,6 +1192,8 @@ GameList::GetMatchingEntriesForSerial(const std::span<const std::string> serials
   return ret;
 }
 
+static constexpr u32 MAX_PARALLEL_COVER_DOWNLOADS = 16;
+
 bool GameList::DownloadCovers(const std::vector<std::string>& url_templates, bool use_serial,
                               ProgressCallback* progress, std::function<void(const Entry*, std::string)> save_callback)
 {
@@ -1175,6 +1257,9 @@ bool GameList::DownloadCovers(const std::vector<std::string>& url_templates, boo
     return false;
   }
 
+  downloader->SetMaxActiveRequests(MAX_PARALLEL_COVER_DOWNLOADS);
+  downloader->SetCacheDirectory(Path::Combine(EmuFolders::Cache, "covers"));
+
   progress->SetCancellable(true);
   progress->SetProgressRange(static_cast<u32>(download_urls.size()));
 
@@ -1196,11 +1281,12 @@ bool GameList::DownloadCovers(const std::vector<std::string>& url_templates, boo
       progress->SetFormattedStatusText("Downloading cover for %s...", entry->title.c_str());
     }
 
-    // we could actually do a few in parallel here...
     std::string filename(HTTPDownloader::URLDecode(url));
     downloader->CreateRequest(
-      std::move(url), [use_serial, &save_callback, entry_path = std::move(entry_path), filename = std::move(filename)](
-                        s32 status_code, const std::string& content_type, HTTPDownloader::Request::Data data) {
+      std::move(url), [use_serial, &save_callback, progress, entry_path = std::move(entry_path),
+                       filename = std::move(filename)](s32 status_code, const std::string& content_type,
+                                                       HTTPDownloader::Request::Data data) {
+        progress->IncrementProgressValue();
         if (status_code != HTTPDownloader::HTTP_STATUS_OK || data.empty())
           return;
 
@@ -1231,9 +1317,11 @@ bool GameList::DownloadCovers(const std::vector<std::string>& url_templates, boo
         if (FileSystem::WriteBinaryFile(write_path.c_str(), data.data(), data.size()) && save_callback)
           save_callback(entry, std::move(write_path));
       });
-    downloader->WaitForAllRequests();
-    progress->IncrementProgressValue();
+
+    // Pump periodically so transfers overlap with queueing instead of all starting at the end.
+    downloader->PollRequests();
   }
 
+  downloader->WaitForAllRequests();
   return true;
 }
@@ -11,18 +11,28 @@
 #include "common/small_string.h"
 #include "common/string_util.h"
 
+#include "fmt/format.h"
+
 #include <functional>
 #include <iomanip>
 #include <map>
 #include <optional>
 #include <sstream>
 #include <string>
+#include <vector>
 
 Log_SetChannel(GDBProtocol);
 
 namespace GDBProtocol
 {
 
+/// Advertised to the client via qSupported; large packets let memory dumps travel in a handful of
+/// round trips instead of serializing a few words per 'm' packet.
+static constexpr u32 MAX_PACKET_SIZE = 65536;
+
+static bool s_no_ack_mode = false;
+static bool s_non_stop_mode = false;
+
 static u8* GetMemoryPointer(PhysicalMemoryAddress address, u32 length)
 {
   auto region = Bus::GetMemoryRegionForAddress(address);
@@ -70,6 +80,40 @@ static std::string SerializePacket(const std::string_view& in)
   return ss.str();
 }
 
+/// Escapes binary reply data; '$', '#', '}' and '*' (run-length marker) travel as '}' (c ^ 0x20).
+static std::string EncodeBinary(const u8* data, u32 length)
+{
+  std::string ret;
+  ret.reserve(length);
+  for (u32 i = 0; i < length; i++) {
+    const char c = static_cast<char>(data[i]);
+    if (c == '$' || c == '#' || c == '*' || c == '}') {
+      ret.push_back('}');
+      ret.push_back(c ^ 0x20);
+    }
+    else {
+      ret.push_back(c);
+    }
+  }
+  return ret;
+}
+
+/// Undoes '}' escaping in binary payload data.
+static std::vector<u8> DecodeBinary(const std::string_view& in)
+{
+  std::vector<u8> ret;
+  ret.reserve(in.size());
+  for (size_t i = 0; i < in.size(); i++) {
+    if (in[i] == '}' && (i + 1) < in.size()) {
+      ret.push_back(static_cast<u8>(in[++i] ^ 0x20));
+    }
+    else {
+      ret.push_back(static_cast<u8>(in[i]));
+    }
+  }
+  return ret;
+}
+
 /// List of GDB remote protocol registers for MIPS III (excluding FP).
 static const std::array<u32*, 38> REGISTERS {
   &CPU::g_state.regs.r[0],
@@ -119,6 +163,11 @@ constexpr int NUM_GDB_REGISTERS = 73;
 /// Get stop reason.
 static std::optional<std::string> Cmd$_questionMark(const std::string_view& data)
 {
+  // In non-stop mode the reply lists stopped threads, or OK if everything is running.
+  if (s_non_stop_mode) {
+    return { System::IsPaused() ? "S05" : "OK" };
+  }
+
   return { "S02" };
 }
 
@@ -214,6 +263,69 @@ static std::optional<std::string> Cmd$M(const std::string_view& data)
   return { "E00" };
 }
 
+/// Get memory (binary). Halves the wire size of large dumps compared to 'm'.
+static std::optional<std::string> Cmd$x(const std::string_view& data)
+{
+  std::stringstream ss{std::string{data}};
+  std::string dataAddress, dataLength;
+
+  std::getline(ss, dataAddress, ',');
+  std::getline(ss, dataLength, '\0');
+
+  auto address = StringUtil::FromChars<VirtualMemoryAddress>(dataAddress, 16);
+  auto length = StringUtil::FromChars<u32>(dataLength, 16);
+
+  if (address && length) {
+    // 'x0,0' is the client's probe for binary read support.
+    if (*length == 0) {
+      return { "OK" };
+    }
+
+    PhysicalMemoryAddress phys_addr = *address & CPU::PHYSICAL_MEMORY_ADDRESS_MASK;
+
+    u8* ptr_data = GetMemoryPointer(phys_addr, *length);
+    if (ptr_data) {
+      return { "b" + EncodeBinary(ptr_data, *length) };
+    }
+  }
+  return { "E00" };
+}
+
+/// Set memory (binary).
+static std::optional<std::string> Cmd$X(const std::string_view& data)
+{
+  // The payload is binary and may contain ',' or ':', so only split on the first ':'.
+  const std::string_view::size_type colon_pos = data.find(':');
+  if (colon_pos == std::string_view::npos) {
+    return { "E00" };
+  }
+
+  std::stringstream ss{std::string{data.substr(0, colon_pos)}};
+  std::string dataAddress, dataLength;
+
+  std::getline(ss, dataAddress, ',');
+  std::getline(ss, dataLength, '\0');
+
+  auto address = StringUtil::FromChars<VirtualMemoryAddress>(dataAddress, 16);
+  auto length = StringUtil::FromChars<u32>(dataLength, 16);
+  std::vector<u8> payload = DecodeBinary(data.substr(colon_pos + 1));
+
+  if (address && length && (payload.size() == *length)) {
+    // Zero-length write is the client's probe for 'X' support.
+    if (*length == 0) {
+      return { "OK" };
+    }
+
+    u8* ptr_data = GetMemoryPointer(*address & CPU::PHYSICAL_MEMORY_ADDRESS_MASK, *length);
+    if (ptr_data) {
+      memcpy(ptr_data, payload.data(), *length);
+      return { "OK" };
+    }
+  }
+
+  return { "E00" };
+}
+
 /// Remove hardware breakpoint.
 static std::optional<std::string> Cmd$z1(const std::string_view& data)
 {
@@ -247,7 +359,54 @@ static std::optional<std::string> Cmd$vMustReplyEmpty(const std::string_view& da
 
 static std::optional<std::string> Cmd$qSupported(const std::string_view& data)
 {
-  return { "" };
+  return { fmt::format("PacketSize={:x};QStartNoAckMode+;QNonStop+;binary-upload+", MAX_PACKET_SIZE) };
+}
+
+/// Disable per-packet '+'/'-' acknowledgements, saving a round trip per packet on reliable
+/// transports. Takes effect after the acknowledgement of this packet.
+static std::optional<std::string> Cmd$QStartNoAckMode(const std::string_view& data)
+{
+  s_no_ack_mode = true;
+  return { "OK" };
+}
+
+/// Enable/disable non-stop mode; the emulator keeps running while the client inspects it.
+static std::optional<std::string> Cmd$QNonStop(const std::string_view& data)
+{
+  if (data == "1") {
+    s_non_stop_mode = true;
+  }
+  else if (data == "0") {
+    s_non_stop_mode = false;
+  }
+  else {
+    return { "E00" };
+  }
+
+  return { "OK" };
+}
+
+static std::optional<std::string> Cmd$vContQuery(const std::string_view& data)
+{
+  return { "vCont;c;t" };
+}
+
+/// Resume/suspend. The host connection has already forwarded the request to the emulation thread;
+/// in non-stop mode the reply is immediate, in all-stop mode the stop reply is generated when the
+/// system actually pauses.
+static std::optional<std::string> Cmd$vCont(const std::string_view& data)
+{
+  if (s_non_stop_mode) {
+    return { "OK" };
+  }
+
+  return std::nullopt;
+}
+
+/// End of the stopped-thread list following a %Stop notification.
+static std::optional<std::string> Cmd$vStopped(const std::string_view& data)
+{
+  return { "OK" };
 }
 
 /// List of all GDB remote protocol packets supported by us.
@@ -258,17 +417,26 @@ static const std::map<const char*, std::function<std::optional<std::string>(cons
   { "G", Cmd$G },
   { "m", Cmd$m },
   { "M", Cmd$M },
+  { "x", Cmd$x },
+  { "X", Cmd$X },
   { "z0,", Cmd$z1 },
   { "Z0,", Cmd$Z1 },
   { "z1,", Cmd$z1 },
   { "Z1,", Cmd$Z1 },
+  { "vCont?", Cmd$vContQuery },
+  { "vCont;", Cmd$vCont },
+  { "vStopped", Cmd$vStopped },
   { "vMustReplyEmpty", Cmd$vMustReplyEmpty },
   { "qSupported", Cmd$qSupported },
+  { "QStartNoAckMode", Cmd$QStartNoAckMode },
+  { "QNonStop:", Cmd$QNonStop },
 };
 
 bool IsPacketInterrupt(const std::string_view& data)
 {
-  return (data.size() >= 1) && (data[data.size()-1] == '\003');
+  // A 0x03 byte inside a binary 'X' payload is not an interrupt; real interrupts arrive outside
+  // of a packet.
+  return (data.size() >= 1) && (data[0] != '$') && (data[data.size()-1] == '\003');
 }
 
 bool IsPacketContinue(const std::string_view& data)
@@ -276,6 +444,16 @@ bool IsPacketContinue(const std::string_view& data)
   return (data.size() >= 5) && (data.substr(data.size()-5) == "$c#63");
 }
 
+bool IsPacketVContResume(const std::string_view& data)
+{
+  return data.find("$vCont;c") != std::string_view::npos;
+}
+
+bool IsPacketVContSuspend(const std::string_view& data)
+{
+  return data.find("$vCont;t") != std::string_view::npos;
+}
+
 bool IsPacketComplete(const std::string_view& data)
 {
   return ((data.size() == 1) && (data[0] == '\003')) ||
@@ -284,6 +462,9 @@ bool IsPacketComplete(const std::string_view& data)
 
 std::string ProcessPacket(const std::string_view& data)
 {
+  // The reply to the packet which enabled no-ack mode is still acknowledged.
+  const bool send_ack = !s_no_ack_mode;
+
   std::string_view trimmedData = data;
 
   // Eat ACKs.
@@ -298,7 +479,7 @@ std::string ProcessPacket(const std::string_view& data)
   auto packet = DeserializePacket(trimmedData);
   if (!packet) {
     Log_ErrorPrintf("Malformed packet '%*s'", static_cast<int>(trimmedData.size()), trimmedData.data());
-    return "-";
+    return send_ack ? "-" : "";
   }
 
   std::optional<std::string> reply = { "" };
@@ -319,7 +500,33 @@ std::string ProcessPacket(const std::string_view& data)
   if (!processed) {
     Log_WarningPrintf("Failed to process packet '%*s'", static_cast<int>(trimmedData.size()), trimmedData.data());
   }
-  return reply ? "+"+SerializePacket(*reply) : "+";
+
+  const std::string ack = send_ack ? "+" : "";
+  return reply ? ack+SerializePacket(*reply) : ack;
+}
+
+bool IsNoAckMode()
+{
+  return s_no_ack_mode;
+}
+
+bool IsNonStopMode()
+{
+  return s_non_stop_mode;
+}
+
+std::string CreateStopNotification()
+{
+  static constexpr std::string_view payload = "Stop:S05";
+  std::stringstream ss;
+  ss << '%' << payload << '#' << TinyString::from_fmt("{:02x}", ComputeChecksum(payload));
+  return ss.str();
+}
+
+void Reset()
+{
+  s_no_ack_mode = false;
+  s_non_stop_mode = false;
 }
 
 } // namespace GDBProtocol
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
 
 #pragma once
+#include <string>
 #include <string_view>
 
 namespace GDBProtocol
@@ -10,7 +11,24 @@ namespace GDBProtocol
   bool IsPacketInterrupt(const std::string_view& data);
   bool IsPacketContinue(const std::string_view& data);
 
+  /// vCont resume/suspend requests touch the emulation thread, so the host connection handles
+  /// them before passing the packet to ProcessPacket() for the reply.
+  bool IsPacketVContResume(const std::string_view& data);
+  bool IsPacketVContSuspend(const std::string_view& data);
+
   bool IsPacketComplete(const std::string_view& data);
   std::string ProcessPacket(const std::string_view& data);
 
+  /// Returns true once the client has negotiated QStartNoAckMode; '+'/'-' acks are omitted.
+  bool IsNoAckMode();
+
+  /// Returns true while the client has non-stop mode enabled (QNonStop:1).
+  bool IsNonStopMode();
+
+  /// Builds an asynchronous %Stop notification for non-stop clients.
+  std::string CreateStopNotification();
+
+  /// Resets per-connection negotiated state (ack/non-stop modes).
+  void Reset();
+
 } // namespace GDBProtocol
@@ -11,6 +11,7 @@
 #include "system.h"
 #include "timers.h"
 
+#include "util/avi_writer.h"
 #include "util/gpu_device.h"
 #include "util/imgui_manager.h"
 #include "util/postprocessing.h"
@@ -21,12 +22,20 @@
 #include "common/file_system.h"
 #include "common/heap_array.h"
 #include "common/log.h"
+#include "common/pixel_convert.h"
 #include "common/string_util.h"
+#include "common/thread_pool.h"
+#include "common/threading.h"
 
 #include "stb_image_resize.h"
 #include "stb_image_write.h"
+#include "xxhash.h"
 
+#include <atomic>
 #include <cmath>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
 #include <thread>
 
 Log_SetChannel(GPU);
@@ -35,12 +44,54 @@ std::unique_ptr<GPU> g_gpu;
 
 const GPU::GP0CommandHandlerTable GPU::s_GP0_command_handler_table = GPU::GenerateGP0CommandHandlerTable();
 
+struct GPU::VideoCaptureState
+{
+  enum : u32
+  {
+    // Bound on frames buffered between readback and encode; the producer blocks when full
+    // rather than ballooning memory when the encoder falls behind.
+    MAX_QUEUED_FRAMES = 8
+  };
+
+  struct PendingFrame
+  {
+    std::vector<u32> data;
+    u32 stride;
+    GPUTexture::Format format;
+  };
+
+  AVIWriter writer;
+  u32 width = 0;
+  u32 height = 0;
+  bool flip_y = false;
+
+  std::thread encoder_thread;
+  std::mutex mutex;
+  std::condition_variable producer_cv;
+  std::condition_variable consumer_cv;
+  std::deque<PendingFrame> frame_queue;
+  std::atomic_bool encoder_error{false};
+  bool shutting_down = false;
+};
+
 GPU::GPU() = default;
 
 GPU::~GPU()
 {
+  StopTraceRecording();
+  StopVideoCapture();
+
   if (g_gpu_device)
+  {
+    ProcessQueuedCaptures(true);
+    for (CaptureSlot& slot : m_capture_ring)
+    {
+      if (slot.texture)
+        g_gpu_device->RecycleTexture(std::move(slot.texture));
+    }
+
     g_gpu_device->SetGPUTimingEnabled(false);
+  }
 }
 
 bool GPU::Initialize()
@@ -66,7 +117,8 @@ bool GPU::Initialize()
     return false;
   }
 
-  g_gpu_device->SetGPUTimingEnabled(g_settings.display_show_gpu);
+  g_gpu_device->SetGPUTimingEnabled(g_settings.display_show_gpu ||
+                                  (g_settings.gpu_dynamic_resolution_scale && !g_settings.IsUsingSoftwareRenderer()));
 
   return true;
 }
@@ -87,13 +139,17 @@ void GPU::UpdateSettings(const Settings& old_settings)
   // Crop mode calls this, so recalculate the display area
   UpdateCRTCDisplayParameters();
 
+  // Alignment/scaling settings feed into the draw rect as well.
+  m_screen_mapping_window_width = -1;
+
   if (g_settings.display_scaling != old_settings.display_scaling)
   {
     if (!CompileDisplayPipeline())
       Panic("Failed to compile display pipeline on settings change.");
   }
 
-  g_gpu_device->SetGPUTimingEnabled(g_settings.display_show_gpu);
+  g_gpu_device->SetGPUTimingEnabled(g_settings.display_show_gpu ||
+                                  (g_settings.gpu_dynamic_resolution_scale && !g_settings.IsUsingSoftwareRenderer()));
 }
 
 void GPU::CPUClockChanged()
@@ -105,6 +161,10 @@ void GPU::UpdateResolutionScale()
 {
 }
 
+void GPU::UpdateDynamicResolutionScale(float average_gpu_time)
+{
+}
+
 std::tuple<u32, u32> GPU::GetEffectiveDisplayResolution(bool scaled /* = true */)
 {
   return std::tie(m_crtc_state.display_vram_width, m_crtc_state.display_vram_height);
@@ -180,7 +240,7 @@ void GPU::SoftReset()
   UpdateGPUIdle();
 }
 
-bool GPU::DoState(StateWrapper& sw, GPUTexture** host_texture, bool update_display)
+bool GPU::DoState(StateWrapper& sw, GPUTexture** host_texture, u64* host_texture_id, bool update_display)
 {
   FlushRender();
 
@@ -403,16 +463,7 @@ u32 GPU::ReadRegister(u32 offset)
       return ReadGPUREAD();
 
     case 0x04:
-    {
-      // code can be dependent on the odd/even bit, so update the GPU state when reading.
-      // we can mitigate this slightly by only updating when the raster is actually hitting a new line
-      if (IsCRTCScanlinePending())
-        SynchronizeCRTC();
-      if (IsCommandCompletionPending())
-        m_command_tick_event->InvokeEarly();
-
-      return m_GPUSTAT.bits;
-    }
+      return ReadStatusRegister();
 
     default:
       Log_ErrorPrintf("Unhandled register read: %02X", offset);
@@ -420,17 +471,33 @@ u32 GPU::ReadRegister(u32 offset)
   }
 }
 
+u32 GPU::ReadStatusRegister()
+{
+  // code can be dependent on the odd/even bit, so update the GPU state when reading.
+  // we can mitigate this slightly by only updating when the raster is actually hitting a new line
+  if (IsCRTCScanlinePending())
+    SynchronizeCRTC();
+  if (IsCommandCompletionPending())
+    m_command_tick_event->InvokeEarly();
+
+  return m_GPUSTAT.bits;
+}
+
 void GPU::WriteRegister(u32 offset, u32 value)
 {
   switch (offset)
   {
     case 0x00:
+      if (m_trace_file) [[unlikely]]
+        TraceGP0Words(&value, 1);
       m_fifo.Push(value);
       ExecuteCommands();
       UpdateCommandTickEvent();
       return;
 
     case 0x04:
+      if (m_trace_file) [[unlikely]]
+        TraceGP1(value);
       WriteGP1(value);
       return;
 
@@ -453,6 +520,31 @@ void GPU::DMARead(u32* words, u32 word_count)
     words[i] = ReadGPUREAD();
 }
 
+void GPU::DMAWrite(const u32* words, u32 word_count, u32 address, u32 address_increment)
+{
+  if (m_trace_file) [[unlikely]]
+    TraceGP0Words(words, word_count);
+
+  // Consumes directly from the host-addressable RAM range, filling the FIFO's contiguous spans in
+  // one pass instead of paying the wrap check and masked re-read on every word.
+  while (word_count > 0)
+  {
+    u64* out = m_fifo.GetWritePointer();
+    const u32 block_size = std::min(word_count, m_fifo.GetContiguousSpace());
+    DebugAssert(block_size > 0);
+    for (u32 i = 0; i < block_size; i++)
+    {
+      u32 value;
+      std::memcpy(&value, words++, sizeof(value));
+      out[i] = (ZeroExtend64(address) << 32) | ZeroExtend64(value);
+      address += address_increment;
+    }
+
+    m_fifo.AdvanceTail(block_size);
+    word_count -= block_size;
+  }
+}
+
 void GPU::EndDMAWrite()
 {
   m_fifo_pushed = true;
@@ -936,9 +1028,13 @@ void GPU::CRTCTickEvent(TickCount ticks)
         // flush any pending draws and "scan out" the image
         // TODO: move present in here I guess
         FlushRender();
-        UpdateDisplay();
+        if (!System::WillSkipPresentingCurrentFrame())
+          UpdateDisplay();
         TimingEvents::SetFrameDone();
 
+        if (m_trace_file) [[unlikely]]
+          TraceVSync();
+
         // switch fields early. this is needed so we draw to the correct one.
         if (m_GPUSTAT.InInterleaved480iMode())
           m_crtc_state.interlaced_display_field = m_crtc_state.interlaced_field ^ 1u;
@@ -1013,8 +1109,16 @@ void GPU::UpdateCommandTickEvent()
 void GPU::ConvertScreenCoordinatesToDisplayCoordinates(float window_x, float window_y, float* display_x,
                                                        float* display_y) const
 {
-  const Common::Rectangle<s32> draw_rc =
-    CalculateDrawRect(g_gpu_device->GetWindowWidth(), g_gpu_device->GetWindowHeight());
+  const s32 window_width = g_gpu_device->GetWindowWidth();
+  const s32 window_height = g_gpu_device->GetWindowHeight();
+  if (window_width != m_screen_mapping_window_width || window_height != m_screen_mapping_window_height)
+  {
+    m_screen_mapping_rect = CalculateDrawRect(window_width, window_height);
+    m_screen_mapping_window_width = window_width;
+    m_screen_mapping_window_height = window_height;
+  }
+
+  const Common::Rectangle<s32>& draw_rc = m_screen_mapping_rect;
 
   // convert coordinates to active display region, then to full display region
   const float scaled_display_x = (window_x - static_cast<float>(draw_rc.left)) / static_cast<float>(draw_rc.GetWidth());
@@ -1651,6 +1755,14 @@ void GPU::SetDisplayTextureRect(s32 view_x, s32 view_y, s32 view_width, s32 view
 void GPU::SetDisplayParameters(s32 display_width, s32 display_height, s32 active_left, s32 active_top, s32 active_width,
                                s32 active_height, float display_aspect_ratio)
 {
+  if (m_display_width == display_width && m_display_height == display_height &&
+      m_display_active_left == active_left && m_display_active_top == active_top &&
+      m_display_active_width == active_width && m_display_active_height == active_height &&
+      m_display_aspect_ratio == display_aspect_ratio)
+  {
+    return;
+  }
+
   m_display_width = display_width;
   m_display_height = display_height;
   m_display_active_left = active_left;
@@ -1658,6 +1770,7 @@ void GPU::SetDisplayParameters(s32 display_width, s32 display_height, s32 active
   m_display_active_width = active_width;
   m_display_active_height = active_height;
   m_display_aspect_ratio = display_aspect_ratio;
+  m_screen_mapping_window_width = -1;
 }
 
 bool GPU::PresentDisplay()
@@ -1675,6 +1788,8 @@ bool GPU::RenderDisplay(GPUTexture* target, const Common::Rectangle<s32>& draw_r
   GL_SCOPE_FMT("RenderDisplay: {}x{} at {},{}", draw_rect.left, draw_rect.top, draw_rect.GetWidth(),
                draw_rect.GetHeight());
 
+  g_gpu_device->SetGPUTimingStage(GPUDevice::GPUTimingStage::Present);
+
   if (m_display_texture)
     m_display_texture->MakeReadyForSampling();
 
@@ -1969,12 +2084,9 @@ static bool CompressAndWriteTextureToFile(u32 width, u32 height, std::string fil
   return true;
 }
 
-bool GPU::WriteDisplayTextureToFile(std::string filename, bool full_resolution /* = true */,
-                                    bool apply_aspect_ratio /* = true */, bool compress_on_thread /* = false */)
+bool GPU::CalculateDisplayTextureSaveSize(bool full_resolution, bool apply_aspect_ratio, s32* out_resize_width,
+                                          s32* out_resize_height) const
 {
-  if (!m_display_texture)
-    return false;
-
   s32 resize_width = 0;
   s32 resize_height = std::abs(m_display_texture_view_height);
   if (apply_aspect_ratio)
@@ -2006,6 +2118,21 @@ bool GPU::WriteDisplayTextureToFile(std::string filename, bool full_resolution /
   if (resize_width <= 0 || resize_height <= 0)
     return false;
 
+  *out_resize_width = resize_width;
+  *out_resize_height = resize_height;
+  return true;
+}
+
+bool GPU::WriteDisplayTextureToFile(std::string filename, bool full_resolution /* = true */,
+                                    bool apply_aspect_ratio /* = true */, bool compress_on_thread /* = false */)
+{
+  if (!m_display_texture)
+    return false;
+
+  s32 resize_width, resize_height;
+  if (!CalculateDisplayTextureSaveSize(full_resolution, apply_aspect_ratio, &resize_width, &resize_height))
+    return false;
+
   const u32 read_x = static_cast<u32>(m_display_texture_view_x);
   const u32 read_y = static_cast<u32>(m_display_texture_view_y);
   const u32 read_width = static_cast<u32>(m_display_texture_view_width);
@@ -2048,6 +2175,302 @@ bool GPU::WriteDisplayTextureToFile(std::string filename, bool full_resolution /
   return true;
 }
 
+GPU::CaptureSlot* GPU::AcquireCaptureSlot()
+{
+  if (!m_display_texture)
+    return nullptr;
+
+  const u32 width = static_cast<u32>(m_display_texture_view_width);
+  const u32 height = static_cast<u32>(m_display_texture_view_height);
+  if (width == 0 || height == 0)
+    return nullptr;
+
+  CaptureSlot& slot = m_capture_ring[m_capture_ring_write_pos];
+  if (slot.pending)
+  {
+    // The ring wrapped before the readback became due, i.e. the consumer isn't keeping up. Drain
+    // the oldest slot now; this is the stalling path the depth of the ring exists to avoid.
+    DownloadAndWriteCaptureSlot(slot);
+  }
+
+  if (slot.texture && (slot.texture->GetWidth() != width || slot.texture->GetHeight() != height ||
+                       slot.texture->GetFormat() != m_display_texture->GetFormat()))
+  {
+    g_gpu_device->RecycleTexture(std::move(slot.texture));
+  }
+  if (!slot.texture)
+  {
+    slot.texture = g_gpu_device->FetchTexture(width, height, 1, 1, 1, GPUTexture::Type::RenderTarget,
+                                              m_display_texture->GetFormat());
+    if (!slot.texture)
+      return nullptr;
+  }
+
+  g_gpu_device->CopyTextureRegion(slot.texture.get(), 0, 0, 0, 0, m_display_texture,
+                                  static_cast<u32>(m_display_texture_view_x),
+                                  static_cast<u32>(m_display_texture_view_y), 0, 0, width, height);
+
+  slot.capture_frame = m_capture_frame_counter;
+  slot.pending = true;
+  m_capture_ring_write_pos = (m_capture_ring_write_pos + 1) % CAPTURE_RING_SIZE;
+  return &slot;
+}
+
+bool GPU::QueueDisplayCapture(std::string filename)
+{
+  s32 resize_width, resize_height;
+  if (!CalculateDisplayTextureSaveSize(true, true, &resize_width, &resize_height))
+    return false;
+
+  CaptureSlot* slot = AcquireCaptureSlot();
+  if (!slot)
+    return false;
+
+  slot->filename = std::move(filename);
+  slot->resize_width = resize_width;
+  slot->resize_height = resize_height;
+  slot->video_frame = false;
+  return true;
+}
+
+void GPU::ProcessQueuedCaptures(bool flush_all /* = false */)
+{
+  m_capture_frame_counter++;
+
+  if (m_video_capture)
+    QueueVideoCaptureFrame();
+
+  // Drain due slots oldest-first so video frames reach the encoder in presentation order.
+  for (;;)
+  {
+    CaptureSlot* oldest = nullptr;
+    for (CaptureSlot& slot : m_capture_ring)
+    {
+      if (slot.pending && (!oldest || slot.capture_frame < oldest->capture_frame))
+        oldest = &slot;
+    }
+    if (!oldest || (!flush_all && (m_capture_frame_counter - oldest->capture_frame) < CAPTURE_RING_SIZE))
+      break;
+
+    DownloadAndWriteCaptureSlot(*oldest);
+  }
+}
+
+bool GPU::DownloadAndWriteCaptureSlot(CaptureSlot& slot)
+{
+  slot.pending = false;
+
+  const u32 width = slot.texture->GetWidth();
+  const u32 height = slot.texture->GetHeight();
+  std::vector<u32> texture_data(width * height);
+  const u32 texture_data_stride = Common::AlignUpPow2(GPUTexture::GetPixelSize(slot.texture->GetFormat()) * width, 4);
+  if (!g_gpu_device->DownloadTexture(slot.texture.get(), 0, 0, width, height, texture_data.data(),
+                                     texture_data_stride))
+  {
+    Log_ErrorFmt("Failed to download queued capture for '{}'", slot.filename);
+    return false;
+  }
+
+  if (slot.video_frame)
+  {
+    slot.video_frame = false;
+    if (!m_video_capture)
+      return false;
+
+    VideoCaptureState& state = *m_video_capture;
+    std::unique_lock lock(state.mutex);
+    state.producer_cv.wait(lock, [&state]() {
+      return (state.frame_queue.size() < VideoCaptureState::MAX_QUEUED_FRAMES || state.encoder_error.load());
+    });
+    if (state.encoder_error.load())
+      return false;
+
+    state.frame_queue.push_back(
+      VideoCaptureState::PendingFrame{std::move(texture_data), texture_data_stride, slot.texture->GetFormat()});
+    state.consumer_cv.notify_one();
+    return true;
+  }
+
+  auto fp = FileSystem::OpenManagedCFile(slot.filename.c_str(), "wb");
+  if (!fp)
+  {
+    Log_ErrorFmt("Can't open file '{}': errno {}", slot.filename, errno);
+    return false;
+  }
+
+  // Shared pointers only because Task must be copyable; nothing else holds them.
+  const auto shared_fp = std::make_shared<FileSystem::ManagedCFilePtr>(std::move(fp));
+  const auto shared_data = std::make_shared<std::vector<u32>>(std::move(texture_data));
+  Threading::ThreadPool::GetInstance().QueueTask(
+    [width, height, filename = std::move(slot.filename), shared_fp, shared_data, texture_data_stride,
+     resize_width = slot.resize_width, resize_height = slot.resize_height,
+     flip_y = g_gpu_device->UsesLowerLeftOrigin(), format = slot.texture->GetFormat()]() mutable {
+      CompressAndWriteTextureToFile(width, height, std::move(filename), std::move(*shared_fp), true, flip_y,
+                                    static_cast<u32>(resize_width), static_cast<u32>(resize_height),
+                                    std::move(*shared_data), texture_data_stride, format);
+    },
+    Threading::ThreadPool::Priority::Low);
+  return true;
+}
+
+bool GPU::StartVideoCapture(std::string filename)
+{
+  if (m_video_capture)
+    StopVideoCapture();
+
+  if (!m_display_texture || m_display_texture_view_width <= 0 || m_display_texture_view_height <= 0)
+  {
+    Log_ErrorPrint("No display texture, cannot start video capture.");
+    return false;
+  }
+
+  std::unique_ptr<VideoCaptureState> state = std::make_unique<VideoCaptureState>();
+  state->width = static_cast<u32>(m_display_texture_view_width);
+  state->height = static_cast<u32>(m_display_texture_view_height);
+  state->flip_y = g_gpu_device->UsesLowerLeftOrigin();
+
+  const float frame_rate = ComputeVerticalFrequency();
+  if (!state->writer.Open(filename.c_str(), state->width, state->height, frame_rate))
+  {
+    Log_ErrorFmt("Failed to open video capture file '{}'", filename);
+    return false;
+  }
+
+  m_video_capture = std::move(state);
+  m_video_capture->encoder_thread = std::thread(&GPU::VideoCaptureEncoderThread, this);
+  Log_InfoFmt("Started video capture to '{}' ({}x{} @ {:.3f}hz)", filename, m_video_capture->width,
+              m_video_capture->height, frame_rate);
+  return true;
+}
+
+void GPU::StopVideoCapture()
+{
+  if (!m_video_capture)
+    return;
+
+  // Flush video frames still waiting on their deferred readback, so the tail of the capture
+  // isn't dropped. Any queued image captures keep their usual latency.
+  if (g_gpu_device)
+  {
+    for (;;)
+    {
+      CaptureSlot* oldest = nullptr;
+      for (CaptureSlot& slot : m_capture_ring)
+      {
+        if (slot.pending && slot.video_frame && (!oldest || slot.capture_frame < oldest->capture_frame))
+          oldest = &slot;
+      }
+      if (!oldest)
+        break;
+
+      DownloadAndWriteCaptureSlot(*oldest);
+    }
+  }
+
+  VideoCaptureState& state = *m_video_capture;
+  {
+    std::unique_lock lock(state.mutex);
+    state.shutting_down = true;
+    state.consumer_cv.notify_one();
+  }
+  state.encoder_thread.join();
+
+  const u32 num_frames = state.writer.GetNumFrames();
+  state.writer.Close();
+  m_video_capture.reset();
+  Log_InfoFmt("Video capture finished with {} frames", num_frames);
+}
+
+bool GPU::QueueVideoCaptureFrame()
+{
+  VideoCaptureState& state = *m_video_capture;
+  if (state.encoder_error.load())
+  {
+    Log_ErrorPrint("Stopping video capture due to encoder error.");
+    StopVideoCapture();
+    return false;
+  }
+
+  if (!m_display_texture)
+    return false;
+
+  const u32 width = static_cast<u32>(m_display_texture_view_width);
+  const u32 height = static_cast<u32>(m_display_texture_view_height);
+  if (width != state.width || height != state.height)
+  {
+    Log_WarningFmt("Display size changed from {}x{} to {}x{}, stopping video capture.", state.width, state.height,
+                   width, height);
+    StopVideoCapture();
+    return false;
+  }
+
+  CaptureSlot* slot = AcquireCaptureSlot();
+  if (!slot)
+    return false;
+
+  slot->filename = {};
+  slot->resize_width = 0;
+  slot->resize_height = 0;
+  slot->video_frame = true;
+  return true;
+}
+
+void GPU::VideoCaptureEncoderThread()
+{
+  Threading::SetNameOfCurrentThread("GPU Video Capture");
+
+  VideoCaptureState& state = *m_video_capture;
+  const auto jpeg_write_func = [](void* context, void* data, int size) {
+    std::vector<u8>& buffer = *static_cast<std::vector<u8>*>(context);
+    buffer.insert(buffer.end(), static_cast<const u8*>(data), static_cast<const u8*>(data) + size);
+  };
+  std::vector<u8> jpeg_data;
+
+  std::unique_lock lock(state.mutex);
+  for (;;)
+  {
+    state.consumer_cv.wait(lock, [&state]() { return (!state.frame_queue.empty() || state.shutting_down); });
+    if (state.frame_queue.empty())
+    {
+      if (state.shutting_down)
+        break;
+
+      continue;
+    }
+
+    VideoCaptureState::PendingFrame frame = std::move(state.frame_queue.front());
+    state.frame_queue.pop_front();
+    state.producer_cv.notify_one();
+    lock.unlock();
+
+    u32 stride = frame.stride;
+    if (!GPUTexture::ConvertTextureDataToRGBA8(state.width, state.height, frame.data, stride, frame.format))
+    {
+      state.encoder_error.store(true);
+    }
+    else
+    {
+      if (state.flip_y)
+        GPUTexture::FlipTextureDataRGBA8(state.width, state.height, frame.data, stride);
+
+      jpeg_data.clear();
+      if (!stbi_write_jpg_to_func(jpeg_write_func, &jpeg_data, static_cast<int>(state.width),
+                                  static_cast<int>(state.height), 4, frame.data.data(), 85) ||
+          !state.writer.WriteFrame(jpeg_data.data(), static_cast<u32>(jpeg_data.size())))
+      {
+        Log_ErrorPrint("Failed to encode/write video frame.");
+        state.encoder_error.store(true);
+      }
+    }
+
+    lock.lock();
+
+    // Don't leave the producer blocked on a queue that will never drain.
+    if (state.encoder_error.load())
+      state.producer_cv.notify_one();
+  }
+}
+
 bool GPU::RenderScreenshotToBuffer(u32 width, u32 height, const Common::Rectangle<s32>& draw_rect, bool postfx,
                                    std::vector<u32>* out_pixels, u32* out_stride, GPUTexture::Format* out_format)
 {
@@ -2162,6 +2585,13 @@ bool GPU::RenderScreenshotToFile(std::string filename, bool internal_resolution
   return true;
 }
 
+u64 GPU::HashVRAM()
+{
+  FlushRender();
+  ReadVRAM(0, 0, VRAM_WIDTH, VRAM_HEIGHT);
+  return XXH3_64bits(m_vram_ptr, VRAM_WIDTH * VRAM_HEIGHT * sizeof(u16));
+}
+
 bool GPU::DumpVRAMToFile(const char* filename)
 {
   ReadVRAM(0, 0, VRAM_WIDTH, VRAM_HEIGHT);
@@ -2197,16 +2627,12 @@ bool GPU::DumpVRAMToFile(const char* filename, u32 width, u32 height, u32 stride
   u32* ptr_out = rgba8_buf.get();
   for (u32 row = 0; row < height; row++)
   {
-    const char* row_ptr_in = ptr_in;
-
-    for (u32 col = 0; col < width; col++)
-    {
-      u16 src_col;
-      std::memcpy(&src_col, row_ptr_in, sizeof(u16));
-      row_ptr_in += sizeof(u16);
-      *(ptr_out++) = VRAMRGBA5551ToRGBA8888(remove_alpha ? (src_col | u16(0x8000)) : src_col);
-    }
+    if (remove_alpha)
+      PixelConvert::VRAM5551RowToRGBA8888<true>(ptr_out, reinterpret_cast<const u16*>(ptr_in), width);
+    else
+      PixelConvert::VRAM5551RowToRGBA8888<false>(ptr_out, reinterpret_cast<const u16*>(ptr_in), width);
 
+    ptr_out += width;
     ptr_in += stride;
   }
 
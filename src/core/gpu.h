@@ -14,6 +14,7 @@
 
 #include <algorithm>
 #include <array>
+#include <cstdio>
 #include <deque>
 #include <memory>
 #include <string>
@@ -91,7 +92,7 @@ public:
 
   virtual bool Initialize();
   virtual void Reset(bool clear_vram);
-  virtual bool DoState(StateWrapper& sw, GPUTexture** save_to_texture, bool update_display);
+  virtual bool DoState(StateWrapper& sw, GPUTexture** save_to_texture, u64* save_to_texture_id, bool update_display);
 
   // Graphics API state reset/restore - call when drawing the UI etc.
   // TODO: replace with "invalidate cached state"
@@ -106,14 +107,20 @@ public:
   u32 ReadRegister(u32 offset);
   void WriteRegister(u32 offset, u32 value);
 
+  // GPUSTAT read without the register decode, called directly for constant-address loads.
+  u32 ReadStatusRegister();
+
   // DMA access
   void DMARead(u32* words, u32 word_count);
 
   ALWAYS_INLINE bool BeginDMAWrite() const { return (m_GPUSTAT.dma_direction == DMADirection::CPUtoGP0); }
   ALWAYS_INLINE void DMAWrite(u32 address, u32 value)
   {
+    if (m_trace_file) [[unlikely]]
+      TraceGP0Words(&value, 1);
     m_fifo.Push((ZeroExtend64(address) << 32) | ZeroExtend64(value));
   }
+  void DMAWrite(const u32* words, u32 word_count, u32 address, u32 address_increment);
   void EndDMAWrite();
 
   /// Returns true if no data is being sent from VRAM to the DAC or that no portion of VRAM would be visible on screen.
@@ -156,6 +163,10 @@ public:
   /// Updates the resolution scale when it's set to automatic.
   virtual void UpdateResolutionScale();
 
+  /// Adjusts the internal resolution in response to measured GPU frame time when dynamic
+  /// resolution scaling is enabled. Called once per performance counter update period.
+  virtual void UpdateDynamicResolutionScale(float average_gpu_time);
+
   /// Returns the effective display resolution of the GPU.
   virtual std::tuple<u32, u32> GetEffectiveDisplayResolution(bool scaled = true);
 
@@ -181,6 +192,15 @@ public:
   // Dumps raw VRAM to a file.
   bool DumpVRAMToFile(const char* filename);
 
+  // Hashes the current VRAM contents, syncing the shadow copy first. Used for verification runs.
+  u64 HashVRAM();
+
+  // GP0/GP1 command trace recording and replay for renderer benchmarking (gpu_trace.cpp).
+  bool StartTraceRecording(const char* filename);
+  void StopTraceRecording();
+  ALWAYS_INLINE bool IsTraceRecording() const { return (m_trace_file != nullptr); }
+  bool ReplayTrace(const char* filename, std::vector<float>* frame_times_ms);
+
   // Ensures all buffered vertices are drawn.
   virtual void FlushRender();
 
@@ -197,6 +217,25 @@ public:
   bool WriteDisplayTextureToFile(std::string filename, bool full_resolution = true, bool apply_aspect_ratio = true,
                                  bool compress_on_thread = false);
 
+  /// Queues an asynchronous capture of the current display texture for continuous dumping. The
+  /// GPU-side copy into a ring slot is enqueued immediately; the readback runs CAPTURE_RING_SIZE
+  /// presented frames later, when the GPU has long finished with the slot, so it doesn't drain
+  /// the pipeline the way WriteDisplayTextureToFile() does. Compression and writing happen on
+  /// the thread pool.
+  bool QueueDisplayCapture(std::string filename);
+
+  /// Reads back and writes out any capture slots whose deferred readback is due. Called once per
+  /// presented frame; flushes everything when flush_all is set (capture end/shutdown).
+  void ProcessQueuedCaptures(bool flush_all = false);
+
+  /// Starts dumping every presented frame to an MJPEG AVI file. Frames travel through the same
+  /// deferred-readback ring as QueueDisplayCapture(), so the render thread never drains the
+  /// pipeline; JPEG compression and container writing happen on a dedicated encoder thread.
+  /// Dimensions are fixed at the values of the first frame; capture stops if they change.
+  bool StartVideoCapture(std::string filename);
+  void StopVideoCapture();
+  ALWAYS_INLINE bool IsVideoCaptureActive() const { return static_cast<bool>(m_video_capture); }
+
   /// Renders the display, optionally with postprocessing to the specified image.
   bool RenderScreenshotToBuffer(u32 width, u32 height, const Common::Rectangle<s32>& draw_rect, bool postfx,
                                 std::vector<u32>* out_pixels, u32* out_stride, GPUTexture::Format* out_format);
@@ -300,6 +339,11 @@ protected:
   void ExecuteCommands();
   void HandleGetGPUInfoCommand(u32 value);
 
+  // Trace recording (gpu_trace.cpp).
+  void TraceGP0Words(const u32* words, u32 word_count);
+  void TraceGP1(u32 value);
+  void TraceVSync();
+
   // Rendering in the backend
   virtual void ReadVRAM(u32 x, u32 y, u32 width, u32 height);
   virtual void FillVRAM(u32 x, u32 y, u32 width, u32 height, u32 color);
@@ -356,6 +400,9 @@ protected:
   // Pointer to VRAM, used for reads/writes. In the hardware backends, this is the shadow buffer.
   u16* m_vram_ptr = nullptr;
 
+  // Active trace recording, if any (gpu_trace.cpp).
+  std::FILE* m_trace_file = nullptr;
+
   union GPUSTAT
   {
     u32 bits;
@@ -594,6 +641,12 @@ protected:
   s32 m_display_active_height = 0;
   float m_display_aspect_ratio = 1.0f;
 
+  // Cached screen-space draw rect for lightgun position mapping, recomputed only when the
+  // window size or display parameters change instead of on every controller read.
+  mutable Common::Rectangle<s32> m_screen_mapping_rect;
+  mutable s32 m_screen_mapping_window_width = -1;
+  mutable s32 m_screen_mapping_window_height = -1;
+
   std::unique_ptr<GPUPipeline> m_display_pipeline;
   GPUTexture* m_display_texture = nullptr;
   s32 m_display_texture_view_x = 0;
@@ -601,6 +654,43 @@ protected:
   s32 m_display_texture_view_width = 0;
   s32 m_display_texture_view_height = 0;
 
+  // Deferred display capture ring, see QueueDisplayCapture().
+  enum : u32
+  {
+    CAPTURE_RING_SIZE = 3
+  };
+  struct CaptureSlot
+  {
+    std::unique_ptr<GPUTexture> texture;
+    std::string filename;
+    s32 resize_width = 0;
+    s32 resize_height = 0;
+    u64 capture_frame = 0;
+    bool pending = false;
+    bool video_frame = false;
+  };
+
+  // Everything the encoder thread touches lives here, defined in gpu.cpp.
+  struct VideoCaptureState;
+
+  /// Computes the dimensions the saved image should be resized to, matching the on-screen
+  /// scaling/aspect correction. Shared between the blocking and deferred capture paths.
+  bool CalculateDisplayTextureSaveSize(bool full_resolution, bool apply_aspect_ratio, s32* out_resize_width,
+                                       s32* out_resize_height) const;
+  bool DownloadAndWriteCaptureSlot(CaptureSlot& slot);
+
+  /// Copies the current display texture into the next ring slot and marks it pending.
+  CaptureSlot* AcquireCaptureSlot();
+
+  /// Enqueues the current display texture into the capture ring as a video frame.
+  bool QueueVideoCaptureFrame();
+  void VideoCaptureEncoderThread();
+
+  std::array<CaptureSlot, CAPTURE_RING_SIZE> m_capture_ring;
+  u64 m_capture_frame_counter = 0;
+  u32 m_capture_ring_write_pos = 0;
+  std::unique_ptr<VideoCaptureState> m_video_capture;
+
   struct Stats
   {
     u32 num_vram_reads;
@@ -618,6 +708,8 @@ private:
 
   using GP0CommandHandler = bool (GPU::*)();
   using GP0CommandHandlerTable = std::array<GP0CommandHandler, 256>;
+  template <u32 command>
+  static constexpr GP0CommandHandler GetRenderCommandHandler();
   static GP0CommandHandlerTable GenerateGP0CommandHandlerTable();
 
   // Rendering commands, returns false if not enough data is provided
@@ -631,9 +723,15 @@ private:
   bool HandleSetDrawingAreaBottomRightCommand();
   bool HandleSetDrawingOffsetCommand();
   bool HandleSetMaskBitCommand();
+  // The render handlers are specialized on the static bits of the command word, so the FIFO size
+  // checks and attribute decoding constant-fold into straight-line code per opcode.
+  template <bool shaded, bool textured, bool quad>
   bool HandleRenderPolygonCommand();
+  template <bool textured, bool variable_size>
   bool HandleRenderRectangleCommand();
+  template <bool shaded>
   bool HandleRenderLineCommand();
+  template <bool shaded>
   bool HandleRenderPolyLineCommand();
   bool HandleFillRectangleCommand();
   bool HandleCopyRectangleCPUToVRAMCommand();
@@ -165,6 +165,14 @@ void GPUBackend::PushCommand(GPUBackendCommand* cmd)
 
 void GPUBackend::WakeGPUThread()
 {
+  // Cheap check before taking the mutex. During draw-heavy sections the GPU thread is rarely
+  // sleeping, and PushCommand() calls this every time the pending size crosses the threshold, so
+  // acquiring the lock each time just serializes the two threads. The sleeping flag is only set
+  // under the mutex, and the wait predicate re-checks the pending size, so a stale false here
+  // cannot lose a wakeup.
+  if (!m_gpu_thread_sleeping.load())
+    return;
+
   std::unique_lock<std::mutex> lock(m_sync_mutex);
   if (!m_gpu_thread_sleeping.load())
     return;
@@ -6,8 +6,12 @@
 #include "common/string_util.h"
 #include "gpu.h"
 #include "interrupt_controller.h"
+#include "performance_profiler.h"
 #include "system.h"
 #include "texture_replacements.h"
+
+#include <utility>
+
 Log_SetChannel(GPU);
 
 #define CHECK_COMMAND_SIZE(num_words)                                                                                  \
@@ -27,6 +31,8 @@ static constexpr u32 ReplaceZero(u32 value, u32 value_for_zero)
 
 void GPU::ExecuteCommands()
 {
+  PerformanceProfiler::Scope profiler_scope(PerformanceProfiler::Event::GPUCommands);
+
   m_syncing = true;
 
   for (;;)
@@ -121,6 +127,37 @@ void GPU::EndCommand()
   m_command_total_words = 0;
 }
 
+// Selects the render handler specialization for a command byte at compile time. The bit layout
+// mirrors GPURenderCommand, which can't be used here since BitField reads through an inactive
+// union member.
+template <u32 command>
+constexpr GPU::GP0CommandHandler GPU::GetRenderCommandHandler()
+{
+  constexpr GPUPrimitive primitive = static_cast<GPUPrimitive>((command >> 5) & 3u);
+  constexpr bool shaded = ((command >> 4) & 1u) != 0u;
+  constexpr bool textured = ((command >> 2) & 1u) != 0u;
+  if constexpr (primitive == GPUPrimitive::Polygon)
+  {
+    return &GPU::HandleRenderPolygonCommand<shaded, textured, ((command >> 3) & 1u) != 0u>;
+  }
+  else if constexpr (primitive == GPUPrimitive::Line)
+  {
+    if constexpr (((command >> 3) & 1u) != 0u)
+      return &GPU::HandleRenderPolyLineCommand<shaded>;
+    else
+      return &GPU::HandleRenderLineCommand<shaded>;
+  }
+  else if constexpr (primitive == GPUPrimitive::Rectangle)
+  {
+    return &GPU::HandleRenderRectangleCommand<textured, (static_cast<GPUDrawRectangleSize>((command >> 3) & 3u) ==
+                                                         GPUDrawRectangleSize::Variable)>;
+  }
+  else
+  {
+    return &GPU::HandleUnknownGP0Command;
+  }
+}
+
 GPU::GP0CommandHandlerTable GPU::GenerateGP0CommandHandlerTable()
 {
   GP0CommandHandlerTable table = {};
@@ -133,25 +170,9 @@ GPU::GP0CommandHandlerTable GPU::GenerateGP0CommandHandlerTable()
   for (u32 i = 0x04; i <= 0x1E; i++)
     table[i] = &GPU::HandleNOPCommand;
   table[0x1F] = &GPU::HandleInterruptRequestCommand;
-  for (u32 i = 0x20; i <= 0x7F; i++)
-  {
-    const GPURenderCommand rc{i << 24};
-    switch (rc.primitive)
-    {
-      case GPUPrimitive::Polygon:
-        table[i] = &GPU::HandleRenderPolygonCommand;
-        break;
-      case GPUPrimitive::Line:
-        table[i] = rc.polyline ? &GPU::HandleRenderPolyLineCommand : &GPU::HandleRenderLineCommand;
-        break;
-      case GPUPrimitive::Rectangle:
-        table[i] = &GPU::HandleRenderRectangleCommand;
-        break;
-      default:
-        table[i] = &GPU::HandleUnknownGP0Command;
-        break;
-    }
-  }
+  [&table]<u32... commands>(std::integer_sequence<u32, commands...>) {
+    ((table[0x20 + commands] = GetRenderCommandHandler<0x20 + commands>()), ...);
+  }(std::make_integer_sequence<u32, 0x60>());
   table[0xE0] = &GPU::HandleNOPCommand;
   table[0xE1] = &GPU::HandleSetDrawModeCommand;
   table[0xE2] = &GPU::HandleSetTextureWindowCommand;
@@ -318,14 +339,15 @@ bool GPU::HandleSetMaskBitCommand()
   return true;
 }
 
+template <bool shaded, bool textured, bool quad>
 bool GPU::HandleRenderPolygonCommand()
 {
   const GPURenderCommand rc{FifoPeek(0)};
 
   // shaded vertices use the colour from the first word for the first vertex
-  const u32 words_per_vertex = 1 + BoolToUInt32(rc.texture_enable) + BoolToUInt32(rc.shading_enable);
-  const u32 num_vertices = rc.quad_polygon ? 4 : 3;
-  const u32 total_words = words_per_vertex * num_vertices + BoolToUInt32(!rc.shading_enable);
+  constexpr u32 words_per_vertex = 1 + BoolToUInt32(textured) + BoolToUInt32(shaded);
+  constexpr u32 num_vertices = quad ? 4 : 3;
+  constexpr u32 total_words = words_per_vertex * num_vertices + BoolToUInt32(!shaded);
   CHECK_COMMAND_SIZE(total_words);
 
   if (IsInterlacedRenderingEnabled() && IsCRTCScanlinePending())
@@ -333,20 +355,19 @@ bool GPU::HandleRenderPolygonCommand()
 
   // setup time
   static constexpr u16 s_setup_time[2][2][2] = {{{46, 226}, {334, 496}}, {{82, 262}, {370, 532}}};
-  const TickCount setup_ticks = static_cast<TickCount>(ZeroExtend32(
-    s_setup_time[BoolToUInt8(rc.quad_polygon)][BoolToUInt8(rc.shading_enable)][BoolToUInt8(rc.texture_enable)]));
+  constexpr TickCount setup_ticks = static_cast<TickCount>(
+    ZeroExtend32(s_setup_time[BoolToUInt8(quad)][BoolToUInt8(shaded)][BoolToUInt8(textured)]));
   AddCommandTicks(setup_ticks);
 
   Log_TracePrintf("Render %s %s %s %s polygon (%u verts, %u words per vert), %d setup ticks",
-                  rc.quad_polygon ? "four-point" : "three-point",
-                  rc.transparency_enable ? "semi-transparent" : "opaque",
-                  rc.texture_enable ? "textured" : "non-textured", rc.shading_enable ? "shaded" : "monochrome",
+                  quad ? "four-point" : "three-point", rc.transparency_enable ? "semi-transparent" : "opaque",
+                  textured ? "textured" : "non-textured", shaded ? "shaded" : "monochrome",
                   ZeroExtend32(num_vertices), ZeroExtend32(words_per_vertex), setup_ticks);
 
   // set draw state up
-  if (rc.texture_enable)
+  if constexpr (textured)
   {
-    const u16 texpage_attribute = Truncate16((rc.shading_enable ? FifoPeek(5) : FifoPeek(4)) >> 16);
+    const u16 texpage_attribute = Truncate16((shaded ? FifoPeek(5) : FifoPeek(4)) >> 16);
     SetDrawMode((texpage_attribute & GPUDrawModeReg::POLYGON_TEXPAGE_MASK) |
                 (m_draw_mode.mode_reg.bits & ~GPUDrawModeReg::POLYGON_TEXPAGE_MASK));
     SetTexturePalette(Truncate16(FifoPeek(2) >> 16));
@@ -362,27 +383,26 @@ bool GPU::HandleRenderPolygonCommand()
   return true;
 }
 
+template <bool textured, bool variable_size>
 bool GPU::HandleRenderRectangleCommand()
 {
   const GPURenderCommand rc{FifoPeek(0)};
-  const u32 total_words =
-    2 + BoolToUInt32(rc.texture_enable) + BoolToUInt32(rc.rectangle_size == GPUDrawRectangleSize::Variable);
+  constexpr u32 total_words = 2 + BoolToUInt32(textured) + BoolToUInt32(variable_size);
 
   CHECK_COMMAND_SIZE(total_words);
 
   if (IsInterlacedRenderingEnabled() && IsCRTCScanlinePending())
     SynchronizeCRTC();
 
-  if (rc.texture_enable)
+  if constexpr (textured)
     SetTexturePalette(Truncate16(FifoPeek(2) >> 16));
 
-  const TickCount setup_ticks = 16;
+  constexpr TickCount setup_ticks = 16;
   AddCommandTicks(setup_ticks);
 
   Log_TracePrintf("Render %s %s %s rectangle (%u words), %d setup ticks",
-                  rc.transparency_enable ? "semi-transparent" : "opaque",
-                  rc.texture_enable ? "textured" : "non-textured", rc.shading_enable ? "shaded" : "monochrome",
-                  total_words, setup_ticks);
+                  rc.transparency_enable ? "semi-transparent" : "opaque", textured ? "textured" : "non-textured",
+                  rc.shading_enable ? "shaded" : "monochrome", total_words, setup_ticks);
 
   m_stats.num_vertices++;
   m_stats.num_polygons++;
@@ -394,17 +414,18 @@ bool GPU::HandleRenderRectangleCommand()
   return true;
 }
 
+template <bool shaded>
 bool GPU::HandleRenderLineCommand()
 {
   const GPURenderCommand rc{FifoPeek(0)};
-  const u32 total_words = rc.shading_enable ? 4 : 3;
+  constexpr u32 total_words = shaded ? 4 : 3;
   CHECK_COMMAND_SIZE(total_words);
 
   if (IsInterlacedRenderingEnabled() && IsCRTCScanlinePending())
     SynchronizeCRTC();
 
   Log_TracePrintf("Render %s %s line (%u total words)", rc.transparency_enable ? "semi-transparent" : "opaque",
-                  rc.shading_enable ? "shaded" : "monochrome", total_words);
+                  shaded ? "shaded" : "monochrome", total_words);
 
   m_stats.num_vertices += 2;
   m_stats.num_polygons++;
@@ -416,26 +437,27 @@ bool GPU::HandleRenderLineCommand()
   return true;
 }
 
+template <bool shaded>
 bool GPU::HandleRenderPolyLineCommand()
 {
   // always read the first two vertices, we test for the terminator after that
   const GPURenderCommand rc{FifoPeek(0)};
-  const u32 min_words = rc.shading_enable ? 3 : 4;
+  constexpr u32 min_words = shaded ? 3 : 4;
   CHECK_COMMAND_SIZE(min_words);
 
   if (IsInterlacedRenderingEnabled() && IsCRTCScanlinePending())
     SynchronizeCRTC();
 
-  const TickCount setup_ticks = 16;
+  constexpr TickCount setup_ticks = 16;
   AddCommandTicks(setup_ticks);
 
   Log_TracePrintf("Render %s %s poly-line, %d setup ticks", rc.transparency_enable ? "semi-transparent" : "opaque",
-                  rc.shading_enable ? "shaded" : "monochrome", setup_ticks);
+                  shaded ? "shaded" : "monochrome", setup_ticks);
 
   m_render_command.bits = rc.bits;
   m_fifo.RemoveOne();
 
-  const u32 words_to_pop = min_words - 1;
+  constexpr u32 words_to_pop = min_words - 1;
   // m_blit_buffer.resize(words_to_pop);
   // FifoPopRange(m_blit_buffer.data(), words_to_pop);
   m_blit_buffer.reserve(words_to_pop);
@@ -18,12 +18,16 @@
 #include "common/log.h"
 #include "common/scoped_guard.h"
 #include "common/string_util.h"
+#include "common/threading.h"
 
 #include "IconsFontAwesome5.h"
 #include "imgui.h"
 
+#include <atomic>
+#include <chrono>
 #include <cmath>
 #include <sstream>
+#include <thread>
 #include <tuple>
 
 Log_SetChannel(GPU_HW);
@@ -139,6 +143,8 @@ GPU_HW::GPU_HW() : GPU()
 
 GPU_HW::~GPU_HW()
 {
+  FinishBackgroundPipelineCompile(true);
+
   if (m_sw_renderer)
   {
     m_sw_renderer->Shutdown();
@@ -217,6 +223,7 @@ bool GPU_HW::Initialize()
   m_clamp_uvs = ShouldClampUVs();
   m_compute_uv_range = m_clamp_uvs;
   m_chroma_smoothing = g_settings.gpu_24bit_chroma_smoothing;
+  m_motion_adaptive_deinterlacing = g_settings.gpu_motion_adaptive_deinterlacing;
   m_downsample_mode = GetDownsampleMode(m_resolution_scale);
   m_wireframe_mode = g_settings.gpu_wireframe_mode;
   m_disable_color_perspective = features.noperspective_interpolation && ShouldDisableColorPerspective();
@@ -262,9 +269,9 @@ void GPU_HW::Reset(bool clear_vram)
     ClearFramebuffer();
 }
 
-bool GPU_HW::DoState(StateWrapper& sw, GPUTexture** host_texture, bool update_display)
+bool GPU_HW::DoState(StateWrapper& sw, GPUTexture** host_texture, u64* host_texture_id, bool update_display)
 {
-  if (!GPU::DoState(sw, host_texture, update_display))
+  if (!GPU::DoState(sw, host_texture, host_texture_id, update_display))
     return false;
 
   if (host_texture)
@@ -280,26 +287,80 @@ bool GPU_HW::DoState(StateWrapper& sw, GPUTexture** host_texture, bool update_di
 
       g_gpu_device->CopyTextureRegion(m_vram_texture.get(), 0, 0, 0, 0, tex, 0, 0, 0, 0, tex->GetWidth(),
                                       tex->GetHeight());
+
+      // Snapshots saved after this point can only chain off the state we just restored, so any
+      // deltas accumulated against the previous timeline are no longer meaningful.
+      m_vram_snapshot_history.clear();
+      m_vram_snapshot_lineage_id = host_texture_id ? *host_texture_id : 0;
+      m_vram_snapshot_dirty_rect.SetInvalid();
     }
     else
     {
-      if (!tex || tex->GetWidth() != m_vram_texture->GetWidth() || tex->GetHeight() != m_vram_texture->GetHeight() ||
-          tex->GetSamples() != m_vram_texture->GetSamples())
+      // VRAM modified since the last snapshot was taken, including any batch still being tracked.
+      Common::Rectangle<u32> delta_rect = m_vram_snapshot_dirty_rect;
+      if (m_vram_dirty_rect.Valid())
+        delta_rect.Include(m_vram_dirty_rect);
+
+      const u64 old_id = host_texture_id ? *host_texture_id : 0;
+      const bool tex_usable =
+        (tex && tex->GetWidth() == m_vram_texture->GetWidth() && tex->GetHeight() == m_vram_texture->GetHeight() &&
+         tex->GetSamples() == m_vram_texture->GetSamples());
+
+      // A recycled snapshot texture whose contents are still in our history only needs the area
+      // modified since it was written, not the full VRAM texture. The history must reach back far
+      // enough to cover every snapshot taken after it.
+      if (tex_usable && old_id != 0 && old_id <= m_vram_snapshot_lineage_id &&
+          (old_id == m_vram_snapshot_lineage_id ||
+           (!m_vram_snapshot_history.empty() && m_vram_snapshot_history.front().first <= (old_id + 1))))
       {
-        delete tex;
-
-        tex =
-          g_gpu_device
-            ->FetchTexture(m_vram_texture->GetWidth(), m_vram_texture->GetHeight(), 1, 1, m_vram_texture->GetSamples(),
-                           GPUTexture::Type::RenderTarget, GPUTexture::Format::RGBA8, nullptr, 0)
-            .release();
-        *host_texture = tex;
-        if (!tex)
-          return false;
+        Common::Rectangle<u32> copy_rect = delta_rect;
+        for (const auto& [id, rect] : m_vram_snapshot_history)
+        {
+          if (id > old_id && rect.Valid())
+            copy_rect.Include(rect);
+        }
+
+        if (copy_rect.Valid())
+        {
+          const Common::Rectangle<u32> scaled_rect =
+            copy_rect.Clamped(0, 0, VRAM_WIDTH, VRAM_HEIGHT) * m_resolution_scale;
+          g_gpu_device->CopyTextureRegion(tex, scaled_rect.left, scaled_rect.top, 0, 0, m_vram_texture.get(),
+                                          scaled_rect.left, scaled_rect.top, 0, 0, scaled_rect.GetWidth(),
+                                          scaled_rect.GetHeight());
+        }
       }
+      else
+      {
+        if (!tex_usable)
+        {
+          delete tex;
+
+          tex = g_gpu_device
+                  ->FetchTexture(m_vram_texture->GetWidth(), m_vram_texture->GetHeight(), 1, 1,
+                                 m_vram_texture->GetSamples(), GPUTexture::Type::RenderTarget,
+                                 GPUTexture::Format::RGBA8, nullptr, 0)
+                  .release();
+          *host_texture = tex;
+          if (!tex)
+            return false;
+        }
 
-      g_gpu_device->CopyTextureRegion(tex, 0, 0, 0, 0, m_vram_texture.get(), 0, 0, 0, 0, tex->GetWidth(),
-                                      tex->GetHeight());
+        g_gpu_device->CopyTextureRegion(tex, 0, 0, 0, 0, m_vram_texture.get(), 0, 0, 0, 0, tex->GetWidth(),
+                                        tex->GetHeight());
+      }
+
+      if (host_texture_id)
+      {
+        static constexpr size_t MAX_SNAPSHOT_HISTORY_SIZE = 512;
+
+        const u64 new_id = m_vram_snapshot_next_id++;
+        m_vram_snapshot_history.emplace_back(new_id, delta_rect);
+        while (m_vram_snapshot_history.size() > MAX_SNAPSHOT_HISTORY_SIZE)
+          m_vram_snapshot_history.pop_front();
+        m_vram_snapshot_lineage_id = new_id;
+        m_vram_snapshot_dirty_rect.SetInvalid();
+        *host_texture_id = new_id;
+      }
     }
   }
 
@@ -327,6 +388,14 @@ void GPU_HW::UpdateSettings(const Settings& old_settings)
 {
   GPU::UpdateSettings(old_settings);
 
+  // Turning dynamic scaling off, or changing the configured scale, discards any active cap.
+  if (!g_settings.gpu_dynamic_resolution_scale ||
+      g_settings.gpu_resolution_scale != old_settings.gpu_resolution_scale)
+  {
+    m_dynamic_resolution_scale = 0;
+    m_dynamic_resolution_trend = 0;
+  }
+
   const GPUDevice::Features features = g_gpu_device->GetFeatures();
 
   const u32 resolution_scale = CalculateResolutionScale();
@@ -338,21 +407,39 @@ void GPU_HW::UpdateSettings(const Settings& old_settings)
   const bool clamp_uvs = ShouldClampUVs();
   const bool disable_color_perspective = features.noperspective_interpolation && ShouldDisableColorPerspective();
 
-  // TODO: Use old_settings
+  const bool downsample_changed =
+    (m_downsample_mode != downsample_mode || (m_downsample_mode == GPUDownsampleMode::Box &&
+                                              g_settings.gpu_downsample_scale != old_settings.gpu_downsample_scale));
   const bool framebuffer_changed =
-    (m_resolution_scale != resolution_scale || m_multisamples != multisamples || m_downsample_mode != downsample_mode ||
-     (m_downsample_mode == GPUDownsampleMode::Box &&
-      g_settings.gpu_downsample_scale != old_settings.gpu_downsample_scale));
-  const bool shaders_changed =
-    (m_resolution_scale != resolution_scale || m_multisamples != multisamples ||
-     m_true_color != g_settings.gpu_true_color || m_per_sample_shading != per_sample_shading ||
-     m_scaled_dithering != g_settings.gpu_scaled_dithering || m_texture_filtering != g_settings.gpu_texture_filter ||
-     m_clamp_uvs != clamp_uvs || m_chroma_smoothing != g_settings.gpu_24bit_chroma_smoothing ||
-     m_downsample_mode != downsample_mode ||
-     (m_downsample_mode == GPUDownsampleMode::Box &&
-      g_settings.gpu_downsample_scale != old_settings.gpu_downsample_scale) ||
-     m_wireframe_mode != wireframe_mode || m_pgxp_depth_buffer != g_settings.UsingPGXPDepthBuffer() ||
-     m_disable_color_perspective != disable_color_perspective);
+    (m_resolution_scale != resolution_scale || m_multisamples != multisamples || downsample_changed);
+
+  // Map each change to the pipeline groups whose generated shaders or fixed state consume it.
+  // Resolution scale/multisampling are baked into every shader, so they dirty everything.
+  u32 dirty_pipeline_groups = 0;
+  if (m_resolution_scale != resolution_scale || m_multisamples != multisamples ||
+      m_per_sample_shading != per_sample_shading)
+  {
+    dirty_pipeline_groups = PIPELINE_GROUP_ALL;
+  }
+  else
+  {
+    if (m_true_color != g_settings.gpu_true_color || m_scaled_dithering != g_settings.gpu_scaled_dithering ||
+        m_texture_filtering != g_settings.gpu_texture_filter || m_clamp_uvs != clamp_uvs ||
+        m_pgxp_depth_buffer != g_settings.UsingPGXPDepthBuffer() ||
+        m_disable_color_perspective != disable_color_perspective || m_wireframe_mode != wireframe_mode)
+    {
+      dirty_pipeline_groups |= PIPELINE_GROUP_BATCH;
+    }
+    if (m_pgxp_depth_buffer != g_settings.UsingPGXPDepthBuffer())
+      dirty_pipeline_groups |= PIPELINE_GROUP_VRAM_OPS;
+    if (m_chroma_smoothing != g_settings.gpu_24bit_chroma_smoothing ||
+        m_motion_adaptive_deinterlacing != g_settings.gpu_motion_adaptive_deinterlacing)
+    {
+      dirty_pipeline_groups |= PIPELINE_GROUP_DISPLAY;
+    }
+    if (downsample_changed)
+      dirty_pipeline_groups |= PIPELINE_GROUP_DOWNSAMPLE;
+  }
 
   if (m_resolution_scale != resolution_scale)
   {
@@ -400,6 +487,7 @@ void GPU_HW::UpdateSettings(const Settings& old_settings)
   m_clamp_uvs = clamp_uvs;
   m_compute_uv_range = m_clamp_uvs;
   m_chroma_smoothing = g_settings.gpu_24bit_chroma_smoothing;
+  m_motion_adaptive_deinterlacing = g_settings.gpu_motion_adaptive_deinterlacing;
   m_downsample_mode = downsample_mode;
   m_wireframe_mode = wireframe_mode;
   m_disable_color_perspective = disable_color_perspective;
@@ -418,11 +506,25 @@ void GPU_HW::UpdateSettings(const Settings& old_settings)
 
   PrintSettingsToLog();
 
-  if (shaders_changed)
+  if (dirty_pipeline_groups != 0)
   {
-    DestroyPipelines();
-    if (!CompilePipelines())
-      Panic("Failed to recompile pipelnes.");
+    // If an earlier settings change is still compiling, wait for it to land first.
+    FinishBackgroundPipelineCompile(true);
+
+    if (framebuffer_changed)
+    {
+      DestroyPipelines();
+      if (!CompilePipelines())
+        Panic("Failed to recompile pipelnes.");
+    }
+    else
+    {
+      // The current pipelines are still compatible with the framebuffer, so only rebuild the
+      // groups whose inputs changed, with batch replacements compiling in the background while
+      // the old set keeps drawing instead of stalling the frame.
+      if (!CompilePipelines(dirty_pipeline_groups, (dirty_pipeline_groups & PIPELINE_GROUP_BATCH) != 0))
+        Panic("Failed to recompile pipelnes.");
+    }
   }
 
   if (framebuffer_changed)
@@ -530,6 +632,10 @@ u32 GPU_HW::CalculateResolutionScale() const
     scale = static_cast<u32>(std::clamp<s32>(preferred_scale, 1, max_resolution_scale));
   }
 
+  // Dynamic resolution scaling caps the configured/automatic scale, it never raises it.
+  if (g_settings.gpu_dynamic_resolution_scale && m_dynamic_resolution_scale != 0)
+    scale = std::min(scale, m_dynamic_resolution_scale);
+
   if (g_settings.gpu_downsample_mode == GPUDownsampleMode::Adaptive && scale > 1 && !Common::IsPow2(scale))
   {
     const u32 new_scale = Common::PreviousPow2(scale);
@@ -559,6 +665,58 @@ void GPU_HW::UpdateResolutionScale()
     UpdateSettings(g_settings);
 }
 
+void GPU_HW::UpdateDynamicResolutionScale(float average_gpu_time)
+{
+  // Zero means no timing data yet, or the device doesn't support timestamp queries.
+  if (average_gpu_time <= 0.0f)
+    return;
+
+  const u32 current_scale = m_resolution_scale;
+  const float target_time = 1000.0f / ComputeVerticalFrequency();
+
+  // Leave headroom under the frame budget: drop when we're close to missing presents, and only
+  // climb when the predicted cost at the next scale (roughly quadratic in scale) still fits
+  // comfortably, otherwise we'd immediately bounce back down.
+  const float downscale_threshold = target_time * 0.9f;
+  const float upscale_threshold = target_time * 0.7f;
+  const float predicted_upscale_time = average_gpu_time *
+                                       (static_cast<float>((current_scale + 1) * (current_scale + 1)) /
+                                        static_cast<float>(current_scale * current_scale));
+
+  if (average_gpu_time >= downscale_threshold)
+    m_dynamic_resolution_trend = std::max(m_dynamic_resolution_trend, 0) + 1;
+  else if (predicted_upscale_time <= upscale_threshold)
+    m_dynamic_resolution_trend = std::min(m_dynamic_resolution_trend, 0) - 1;
+  else
+    m_dynamic_resolution_trend = 0;
+
+  // Changing scale recreates the VRAM framebuffer and recompiles pipelines, so require several
+  // consecutive update periods before moving, and be slower to climb than to drop.
+  u32 new_scale = current_scale;
+  if (m_dynamic_resolution_trend >= 2 && current_scale > 1)
+    new_scale = current_scale - 1;
+  else if (m_dynamic_resolution_trend <= -5)
+    new_scale = current_scale + 1;
+
+  if (new_scale == current_scale)
+    return;
+
+  m_dynamic_resolution_trend = 0;
+  m_dynamic_resolution_scale = new_scale;
+  if (CalculateResolutionScale() == m_resolution_scale)
+  {
+    // The cap stopped being the limiting factor, i.e. we're back at the configured scale.
+    if (new_scale > current_scale)
+      m_dynamic_resolution_scale = 0;
+
+    return;
+  }
+
+  Log_InfoFmt("Dynamic resolution scale: {:.2f}ms GPU time vs {:.2f}ms budget, changing from {}x to {}x",
+              average_gpu_time, target_time, current_scale, new_scale);
+  UpdateSettings(g_settings);
+}
+
 GPUDownsampleMode GPU_HW::GetDownsampleMode(u32 resolution_scale) const
 {
   return (resolution_scale == 1) ? GPUDownsampleMode::Disabled : g_settings.gpu_downsample_mode;
@@ -574,15 +732,57 @@ bool GPU_HW::IsUsingDownsampling() const
   return (m_downsample_mode != GPUDownsampleMode::Disabled && !m_GPUSTAT.display_area_color_depth_24);
 }
 
+void GPU_HW::AccumulateStreamBufferStats()
+{
+  // Keep a few seconds of history so a single bad frame doesn't get lost in the noise, but the
+  // log line still correlates with what the user was doing at the time.
+  constexpr u32 LOG_INTERVAL_FRAMES = 300;
+
+  const GPUDevice::StreamBufferStats stats = GPUDevice::GetAndResetStreamBufferStats();
+  m_stream_buffer_stats.buffer_stalls += stats.buffer_stalls;
+  m_stream_buffer_stats.buffer_wraps += stats.buffer_wraps;
+  m_stream_buffer_stats.bytes_streamed += stats.bytes_streamed;
+  if (++m_stream_buffer_stats_frames < LOG_INTERVAL_FRAMES)
+    return;
+
+  if (m_stream_buffer_stats.buffer_stalls > 0)
+  {
+    Log_PerfFmt("{} stream buffer stall(s) over the last {} frames ({} wraps, {:.1f} MB streamed) - "
+                "streaming buffers are undersized for this workload",
+                m_stream_buffer_stats.buffer_stalls, m_stream_buffer_stats_frames, m_stream_buffer_stats.buffer_wraps,
+                static_cast<double>(m_stream_buffer_stats.bytes_streamed) / 1048576.0);
+  }
+
+  m_stream_buffer_stats = {};
+  m_stream_buffer_stats_frames = 0;
+}
+
 void GPU_HW::SetFullVRAMDirtyRectangle()
 {
   m_vram_dirty_rect.Set(0, 0, VRAM_WIDTH, VRAM_HEIGHT);
+  m_vram_dirty_bitmap.SetAll();
+  m_vram_shadow_dirty_rect.Set(0, 0, VRAM_WIDTH, VRAM_HEIGHT);
+  m_vram_draw_dirty_rect.Set(0, 0, VRAM_WIDTH, VRAM_HEIGHT);
+  m_vram_snapshot_dirty_rect.Set(0, 0, VRAM_WIDTH, VRAM_HEIGHT);
+  m_downsample_dirty_rect.Set(0, 0, VRAM_WIDTH, VRAM_HEIGHT);
   m_draw_mode.SetTexturePageChanged();
 }
 
 void GPU_HW::ClearVRAMDirtyRectangle()
 {
+  // Everything that modifies VRAM passes through m_vram_dirty_rect, so fold it into the snapshot
+  // tracker before resetting - it still needs copying out if a snapshot is taken later. The
+  // shadow only goes stale where the GPU rendered, since CPU uploads are mirrored into it.
+  if (m_vram_dirty_rect.Valid())
+  {
+    m_vram_snapshot_dirty_rect.Include(m_vram_dirty_rect);
+    m_downsample_dirty_rect.Include(m_vram_dirty_rect);
+  }
+  if (m_vram_draw_dirty_rect.Valid())
+    m_vram_shadow_dirty_rect.Include(m_vram_draw_dirty_rect);
   m_vram_dirty_rect.SetInvalid();
+  m_vram_dirty_bitmap.Clear();
+  m_vram_draw_dirty_rect.SetInvalid();
 }
 
 std::tuple<u32, u32> GPU_HW::GetEffectiveDisplayResolution(bool scaled /* = true */)
@@ -679,23 +879,54 @@ void GPU_HW::DestroyBuffers()
   ClearDisplayTexture();
 
   m_vram_upload_buffer.reset();
+  m_downsample_display_texture = nullptr;
   g_gpu_device->RecycleTexture(std::move(m_downsample_texture));
   g_gpu_device->RecycleTexture(std::move(m_vram_read_texture));
   g_gpu_device->RecycleTexture(std::move(m_vram_depth_texture));
   g_gpu_device->RecycleTexture(std::move(m_vram_texture));
   g_gpu_device->RecycleTexture(std::move(m_vram_readback_texture));
   g_gpu_device->RecycleTexture(std::move(m_display_private_texture));
+  g_gpu_device->RecycleTexture(std::move(m_deinterlace_texture));
+  g_gpu_device->RecycleTexture(std::move(m_deinterlace_history_texture));
+}
+
+void GPU_HW::BatchPipelineCompile::StartThreads(u32 num_threads)
+{
+  DebugAssert(threads.empty());
+  threads.reserve(num_threads);
+  for (u32 i = 0; i < num_threads; i++)
+  {
+    threads.emplace_back([this]() {
+      Threading::SetNameOfCurrentThread("Pipeline Compiler");
+      for (;;)
+      {
+        const size_t index = next_index.fetch_add(1);
+        if (index >= work.size() || failed.load())
+          break;
+
+        auto& [config, pipeline] = work[index];
+        if (!(*pipeline = g_gpu_device->CreatePipeline(config)))
+          failed.store(true);
+
+        num_completed.fetch_add(1);
+      }
+    });
+  }
 }
 
-bool GPU_HW::CompilePipelines()
+bool GPU_HW::CompilePipelines(u32 groups /* = PIPELINE_GROUP_ALL */, bool background_batch_compile /* = false */)
 {
   const GPUDevice::Features features = g_gpu_device->GetFeatures();
   GPU_HW_ShaderGen shadergen(g_gpu_device->GetRenderAPI(), m_resolution_scale, m_multisamples, m_per_sample_shading,
                              m_true_color, m_scaled_dithering, m_texture_filtering, m_clamp_uvs, m_pgxp_depth_buffer,
                              m_disable_color_perspective, m_supports_dual_source_blend, m_supports_framebuffer_fetch);
 
-  ShaderCompileProgressTracker progress("Compiling Pipelines", 2 + (4 * 5 * 9 * 2 * 2) + (3 * 4 * 5 * 9 * 2 * 2) + 1 +
-                                                                 2 + (2 * 2) + 2 + 1 + 1 + (2 * 3) + 1);
+  const u32 progress_total =
+    ((groups & PIPELINE_GROUP_BATCH) ? (2 + (4 * 5 * 9 * 2 * 2) + (3 * 4 * 5 * 9 * 2 * 2)) : 0) +
+    ((groups & (PIPELINE_GROUP_VRAM_OPS | PIPELINE_GROUP_DISPLAY | PIPELINE_GROUP_DOWNSAMPLE)) ? 1 : 0) +
+    ((groups & PIPELINE_GROUP_VRAM_OPS) ? ((2 * 2) + 2 + 2 + 1 + 1) : 0) +
+    ((groups & PIPELINE_GROUP_DISPLAY) ? (2 * 3) : 0) + 1;
+  ShaderCompileProgressTracker progress("Compiling Pipelines", progress_total);
 
   // vertex shaders - [textured]
   // fragment shaders - [render_mode][texture_mode][dithering][interlacing]
@@ -707,57 +938,60 @@ bool GPU_HW::CompilePipelines()
     batch_fragment_shaders.enumerate(destroy_shader);
   });
 
-  for (u8 textured = 0; textured < 2; textured++)
+  if (groups & PIPELINE_GROUP_BATCH)
   {
-    const std::string vs = shadergen.GenerateBatchVertexShader(ConvertToBoolUnchecked(textured));
-    if (!(batch_vertex_shaders[textured] = g_gpu_device->CreateShader(GPUShaderStage::Vertex, vs)))
-      return false;
+    for (u8 textured = 0; textured < 2; textured++)
+    {
+      const std::string vs = shadergen.GenerateBatchVertexShader(ConvertToBoolUnchecked(textured));
+      if (!(batch_vertex_shaders[textured] = g_gpu_device->CreateShader(GPUShaderStage::Vertex, vs)))
+        return false;
 
-    progress.Increment();
-  }
+      progress.Increment();
+    }
 
-  for (u8 render_mode = 0; render_mode < 4; render_mode++)
-  {
-    for (u8 transparency_mode = 0; transparency_mode < 5; transparency_mode++)
+    for (u8 render_mode = 0; render_mode < 4; render_mode++)
     {
-      if (m_supports_framebuffer_fetch)
+      for (u8 transparency_mode = 0; transparency_mode < 5; transparency_mode++)
       {
-        // Don't need multipass shaders.
-        if (render_mode != static_cast<u8>(BatchRenderMode::TransparencyDisabled) &&
-            render_mode != static_cast<u8>(BatchRenderMode::TransparentAndOpaque))
+        if (m_supports_framebuffer_fetch)
         {
-          progress.Increment(2 * 2 * 9);
-          continue;
+          // Don't need multipass shaders.
+          if (render_mode != static_cast<u8>(BatchRenderMode::TransparencyDisabled) &&
+              render_mode != static_cast<u8>(BatchRenderMode::TransparentAndOpaque))
+          {
+            progress.Increment(2 * 2 * 9);
+            continue;
+          }
         }
-      }
-      else
-      {
-        // Can't generate shader blending.
-        if (transparency_mode != static_cast<u8>(GPUTransparencyMode::Disabled))
+        else
         {
-          progress.Increment(2 * 2 * 9);
-          continue;
+          // Can't generate shader blending.
+          if (transparency_mode != static_cast<u8>(GPUTransparencyMode::Disabled))
+          {
+            progress.Increment(2 * 2 * 9);
+            continue;
+          }
         }
-      }
 
-      for (u8 texture_mode = 0; texture_mode < 9; texture_mode++)
-      {
-        for (u8 dithering = 0; dithering < 2; dithering++)
+        for (u8 texture_mode = 0; texture_mode < 9; texture_mode++)
         {
-          for (u8 interlacing = 0; interlacing < 2; interlacing++)
+          for (u8 dithering = 0; dithering < 2; dithering++)
           {
-            const std::string fs = shadergen.GenerateBatchFragmentShader(
-              static_cast<BatchRenderMode>(render_mode), static_cast<GPUTransparencyMode>(transparency_mode),
-              static_cast<GPUTextureMode>(texture_mode), ConvertToBoolUnchecked(dithering),
-              ConvertToBoolUnchecked(interlacing));
-
-            if (!(batch_fragment_shaders[render_mode][transparency_mode][texture_mode][dithering][interlacing] =
-                    g_gpu_device->CreateShader(GPUShaderStage::Fragment, fs)))
+            for (u8 interlacing = 0; interlacing < 2; interlacing++)
             {
-              return false;
-            }
+              const std::string fs = shadergen.GenerateBatchFragmentShader(
+                static_cast<BatchRenderMode>(render_mode), static_cast<GPUTransparencyMode>(transparency_mode),
+                static_cast<GPUTextureMode>(texture_mode), ConvertToBoolUnchecked(dithering),
+                ConvertToBoolUnchecked(interlacing));
 
-            progress.Increment();
+              if (!(batch_fragment_shaders[render_mode][transparency_mode][texture_mode][dithering][interlacing] =
+                      g_gpu_device->CreateShader(GPUShaderStage::Fragment, fs)))
+              {
+                return false;
+              }
+
+              progress.Increment();
+            }
           }
         }
       }
@@ -790,153 +1024,233 @@ bool GPU_HW::CompilePipelines()
   plconfig.per_sample_shading = m_per_sample_shading;
   plconfig.geometry_shader = nullptr;
 
-  // [depth_test][render_mode][texture_mode][transparency_mode][dithering][interlacing]
-  for (u8 depth_test = 0; depth_test < 3; depth_test++)
+  if (groups & PIPELINE_GROUP_BATCH)
   {
-    for (u8 render_mode = 0; render_mode < 4; render_mode++)
+    // The batch pipeline matrix dominates compile time, so on backends where pipeline creation is
+    // thread-safe, defer the configs and fan them out across worker threads below. On a settings
+    // change the workers can also run in the background while the old pipelines keep drawing.
+    const bool parallel_compile = features.parallel_pipeline_compilation;
+    const bool background_compile = parallel_compile && background_batch_compile;
+    std::unique_ptr<BatchPipelineCompile> blocking_compile;
+    BatchPipelineCompile* batch_compile = nullptr;
+    if (background_compile)
+    {
+      DebugAssert(!m_background_pipeline_compile);
+      batch_compile = (m_background_pipeline_compile = std::make_unique<BatchPipelineCompile>()).get();
+    }
+    else if (parallel_compile)
     {
-      if (m_supports_framebuffer_fetch)
+      batch_compile = (blocking_compile = std::make_unique<BatchPipelineCompile>()).get();
+    }
+    if (batch_compile)
+      batch_compile->work.reserve(3 * 4 * 9 * 5 * 2 * 2);
+
+    // [depth_test][render_mode][texture_mode][transparency_mode][dithering][interlacing]
+    for (u8 depth_test = 0; depth_test < 3; depth_test++)
+    {
+      for (u8 render_mode = 0; render_mode < 4; render_mode++)
       {
-        // Don't need multipass shaders.
-        if (render_mode != static_cast<u8>(BatchRenderMode::TransparencyDisabled) &&
-            render_mode != static_cast<u8>(BatchRenderMode::TransparentAndOpaque))
+        if (m_supports_framebuffer_fetch)
         {
-          progress.Increment(2 * 2 * 9 * 5);
-          continue;
+          // Don't need multipass shaders.
+          if (render_mode != static_cast<u8>(BatchRenderMode::TransparencyDisabled) &&
+              render_mode != static_cast<u8>(BatchRenderMode::TransparentAndOpaque))
+          {
+            progress.Increment(2 * 2 * 9 * 5);
+            continue;
+          }
         }
-      }
 
-      for (u8 transparency_mode = 0; transparency_mode < 5; transparency_mode++)
-      {
-        for (u8 texture_mode = 0; texture_mode < 9; texture_mode++)
+        for (u8 transparency_mode = 0; transparency_mode < 5; transparency_mode++)
         {
-          for (u8 dithering = 0; dithering < 2; dithering++)
+          for (u8 texture_mode = 0; texture_mode < 9; texture_mode++)
           {
-            for (u8 interlacing = 0; interlacing < 2; interlacing++)
+            for (u8 dithering = 0; dithering < 2; dithering++)
             {
-              static constexpr std::array<GPUPipeline::DepthFunc, 3> depth_test_values = {
-                GPUPipeline::DepthFunc::Always, GPUPipeline::DepthFunc::GreaterEqual,
-                GPUPipeline::DepthFunc::LessEqual};
-              const bool textured = (static_cast<GPUTextureMode>(texture_mode) != GPUTextureMode::Disabled);
-              const bool use_shader_blending =
-                (textured && NeedsShaderBlending(static_cast<GPUTransparencyMode>(transparency_mode)));
-
-              plconfig.input_layout.vertex_attributes =
-                textured ?
-                  (m_clamp_uvs ? std::span<const GPUPipeline::VertexAttribute>(
-                                   vertex_attributes, NUM_BATCH_TEXTURED_LIMITS_VERTEX_ATTRIBUTES) :
-                                 std::span<const GPUPipeline::VertexAttribute>(vertex_attributes,
-                                                                               NUM_BATCH_TEXTURED_VERTEX_ATTRIBUTES)) :
-                  std::span<const GPUPipeline::VertexAttribute>(vertex_attributes, NUM_BATCH_VERTEX_ATTRIBUTES);
-
-              plconfig.vertex_shader = batch_vertex_shaders[BoolToUInt8(textured)].get();
-              plconfig.fragment_shader =
-                batch_fragment_shaders[render_mode]
-                                      [use_shader_blending ? transparency_mode :
-                                                             static_cast<u8>(GPUTransparencyMode::Disabled)]
-                                      [texture_mode][dithering][interlacing]
-                                        .get();
-
-              plconfig.depth.depth_test = depth_test_values[depth_test];
-              plconfig.depth.depth_write = !m_pgxp_depth_buffer || depth_test != 0;
-              plconfig.blend = GPUPipeline::BlendState::GetNoBlendingState();
-
-              if (!use_shader_blending &&
-                  ((static_cast<GPUTransparencyMode>(transparency_mode) != GPUTransparencyMode::Disabled &&
-                    (static_cast<BatchRenderMode>(render_mode) != BatchRenderMode::TransparencyDisabled &&
-                     static_cast<BatchRenderMode>(render_mode) != BatchRenderMode::OnlyOpaque)) ||
-                   (textured && IsBlendedTextureFiltering(m_texture_filtering))))
+              for (u8 interlacing = 0; interlacing < 2; interlacing++)
               {
-                plconfig.blend.enable = true;
-                plconfig.blend.src_alpha_blend = GPUPipeline::BlendFunc::One;
-                plconfig.blend.dst_alpha_blend = GPUPipeline::BlendFunc::Zero;
-                plconfig.blend.alpha_blend_op = GPUPipeline::BlendOp::Add;
-
-                if (m_supports_dual_source_blend)
-                {
-                  plconfig.blend.src_blend = GPUPipeline::BlendFunc::One;
-                  plconfig.blend.dst_blend = GPUPipeline::BlendFunc::SrcAlpha1;
-                  plconfig.blend.blend_op =
-                    (static_cast<GPUTransparencyMode>(transparency_mode) ==
-                       GPUTransparencyMode::BackgroundMinusForeground &&
-                     static_cast<BatchRenderMode>(render_mode) != BatchRenderMode::TransparencyDisabled &&
-                     static_cast<BatchRenderMode>(render_mode) != BatchRenderMode::OnlyOpaque) ?
-                      GPUPipeline::BlendOp::ReverseSubtract :
-                      GPUPipeline::BlendOp::Add;
-                }
-                else
+                static constexpr std::array<GPUPipeline::DepthFunc, 3> depth_test_values = {
+                  GPUPipeline::DepthFunc::Always, GPUPipeline::DepthFunc::GreaterEqual,
+                  GPUPipeline::DepthFunc::LessEqual};
+                const bool textured = (static_cast<GPUTextureMode>(texture_mode) != GPUTextureMode::Disabled);
+                const bool use_shader_blending =
+                  (textured && NeedsShaderBlending(static_cast<GPUTransparencyMode>(transparency_mode)));
+
+                plconfig.input_layout.vertex_attributes =
+                  textured ?
+                    (m_clamp_uvs ? std::span<const GPUPipeline::VertexAttribute>(
+                                     vertex_attributes, NUM_BATCH_TEXTURED_LIMITS_VERTEX_ATTRIBUTES) :
+                                   std::span<const GPUPipeline::VertexAttribute>(vertex_attributes,
+                                                                                 NUM_BATCH_TEXTURED_VERTEX_ATTRIBUTES)) :
+                    std::span<const GPUPipeline::VertexAttribute>(vertex_attributes, NUM_BATCH_VERTEX_ATTRIBUTES);
+
+                plconfig.vertex_shader = batch_vertex_shaders[BoolToUInt8(textured)].get();
+                plconfig.fragment_shader =
+                  batch_fragment_shaders[render_mode]
+                                        [use_shader_blending ? transparency_mode :
+                                                               static_cast<u8>(GPUTransparencyMode::Disabled)]
+                                        [texture_mode][dithering][interlacing]
+                                          .get();
+
+                plconfig.depth.depth_test = depth_test_values[depth_test];
+                plconfig.depth.depth_write = !m_pgxp_depth_buffer || depth_test != 0;
+                plconfig.blend = GPUPipeline::BlendState::GetNoBlendingState();
+
+                if (!use_shader_blending &&
+                    ((static_cast<GPUTransparencyMode>(transparency_mode) != GPUTransparencyMode::Disabled &&
+                      (static_cast<BatchRenderMode>(render_mode) != BatchRenderMode::TransparencyDisabled &&
+                       static_cast<BatchRenderMode>(render_mode) != BatchRenderMode::OnlyOpaque)) ||
+                     (textured && IsBlendedTextureFiltering(m_texture_filtering))))
                 {
-                  // TODO: This isn't entirely accurate, 127.5 versus 128.
-                  // But if we use fbfetch on Mali, it doesn't matter.
-                  plconfig.blend.src_blend = GPUPipeline::BlendFunc::One;
-                  plconfig.blend.dst_blend = GPUPipeline::BlendFunc::One;
-                  if (static_cast<GPUTransparencyMode>(transparency_mode) ==
-                      GPUTransparencyMode::HalfBackgroundPlusHalfForeground)
+                  plconfig.blend.enable = true;
+                  plconfig.blend.src_alpha_blend = GPUPipeline::BlendFunc::One;
+                  plconfig.blend.dst_alpha_blend = GPUPipeline::BlendFunc::Zero;
+                  plconfig.blend.alpha_blend_op = GPUPipeline::BlendOp::Add;
+
+                  if (m_supports_dual_source_blend)
+                  {
+                    plconfig.blend.src_blend = GPUPipeline::BlendFunc::One;
+                    plconfig.blend.dst_blend = GPUPipeline::BlendFunc::SrcAlpha1;
+                    plconfig.blend.blend_op =
+                      (static_cast<GPUTransparencyMode>(transparency_mode) ==
+                         GPUTransparencyMode::BackgroundMinusForeground &&
+                       static_cast<BatchRenderMode>(render_mode) != BatchRenderMode::TransparencyDisabled &&
+                       static_cast<BatchRenderMode>(render_mode) != BatchRenderMode::OnlyOpaque) ?
+                        GPUPipeline::BlendOp::ReverseSubtract :
+                        GPUPipeline::BlendOp::Add;
+                  }
+                  else
                   {
-                    plconfig.blend.dst_blend = GPUPipeline::BlendFunc::ConstantColor;
-                    plconfig.blend.dst_alpha_blend = GPUPipeline::BlendFunc::ConstantColor;
-                    plconfig.blend.constant = 0x00808080u;
+                    // TODO: This isn't entirely accurate, 127.5 versus 128.
+                    // But if we use fbfetch on Mali, it doesn't matter.
+                    plconfig.blend.src_blend = GPUPipeline::BlendFunc::One;
+                    plconfig.blend.dst_blend = GPUPipeline::BlendFunc::One;
+                    if (static_cast<GPUTransparencyMode>(transparency_mode) ==
+                        GPUTransparencyMode::HalfBackgroundPlusHalfForeground)
+                    {
+                      plconfig.blend.dst_blend = GPUPipeline::BlendFunc::ConstantColor;
+                      plconfig.blend.dst_alpha_blend = GPUPipeline::BlendFunc::ConstantColor;
+                      plconfig.blend.constant = 0x00808080u;
+                    }
+
+                    plconfig.blend.blend_op =
+                      (static_cast<GPUTransparencyMode>(transparency_mode) ==
+                         GPUTransparencyMode::BackgroundMinusForeground &&
+                       static_cast<BatchRenderMode>(render_mode) != BatchRenderMode::TransparencyDisabled &&
+                       static_cast<BatchRenderMode>(render_mode) != BatchRenderMode::OnlyOpaque) ?
+                        GPUPipeline::BlendOp::ReverseSubtract :
+                        GPUPipeline::BlendOp::Add;
                   }
+                }
 
-                  plconfig.blend.blend_op =
-                    (static_cast<GPUTransparencyMode>(transparency_mode) ==
-                       GPUTransparencyMode::BackgroundMinusForeground &&
-                     static_cast<BatchRenderMode>(render_mode) != BatchRenderMode::TransparencyDisabled &&
-                     static_cast<BatchRenderMode>(render_mode) != BatchRenderMode::OnlyOpaque) ?
-                      GPUPipeline::BlendOp::ReverseSubtract :
-                      GPUPipeline::BlendOp::Add;
+                std::unique_ptr<GPUPipeline>& pipeline =
+                  (background_compile ? batch_compile->pipelines :
+                                        m_batch_pipelines)[depth_test][render_mode][texture_mode][transparency_mode]
+                                                          [dithering][interlacing];
+                if (batch_compile)
+                {
+                  batch_compile->work.emplace_back(plconfig, &pipeline);
+                  continue;
                 }
-              }
 
-              if (!(m_batch_pipelines[depth_test][render_mode][texture_mode][transparency_mode][dithering]
-                                     [interlacing] = g_gpu_device->CreatePipeline(plconfig)))
-              {
-                return false;
-              }
+                if (!(pipeline = g_gpu_device->CreatePipeline(plconfig)))
+                  return false;
 
-              progress.Increment();
+                progress.Increment();
+              }
             }
           }
         }
       }
     }
-  }
 
-  if (m_wireframe_mode != GPUWireframeMode::Disabled)
-  {
-    std::unique_ptr<GPUShader> gs =
-      g_gpu_device->CreateShader(GPUShaderStage::Geometry, shadergen.GenerateWireframeGeometryShader());
-    std::unique_ptr<GPUShader> fs =
-      g_gpu_device->CreateShader(GPUShaderStage::Fragment, shadergen.GenerateWireframeFragmentShader());
-    if (!gs || !fs)
-      return false;
+    if (batch_compile)
+    {
+      // Leave some cores for emulation when compiling behind gameplay.
+      const u32 num_threads =
+        std::min(std::max(std::thread::hardware_concurrency() / (background_compile ? 2 : 1), 1u),
+                 static_cast<u32>(batch_compile->work.size()));
+      batch_compile->StartThreads(num_threads);
 
-    GL_OBJECT_NAME(gs, "Batch Wireframe Geometry Shader");
-    GL_OBJECT_NAME(fs, "Batch Wireframe Fragment Shader");
-
-    plconfig.input_layout.vertex_attributes =
-      std::span<const GPUPipeline::VertexAttribute>(vertex_attributes, NUM_BATCH_VERTEX_ATTRIBUTES);
-    plconfig.blend = (m_wireframe_mode == GPUWireframeMode::OverlayWireframe) ?
-                       GPUPipeline::BlendState::GetAlphaBlendingState() :
-                       GPUPipeline::BlendState::GetNoBlendingState();
-    plconfig.blend.write_mask = 0x7;
-    plconfig.depth = GPUPipeline::DepthState::GetNoTestsState();
-    plconfig.vertex_shader = batch_vertex_shaders[0].get();
-    plconfig.geometry_shader = gs.get();
-    plconfig.fragment_shader = fs.get();
-
-    if (!(m_wireframe_pipeline = g_gpu_device->CreatePipeline(plconfig)))
-      return false;
+      if (!background_compile)
+      {
+        // The GPU thread blocks here until the workers are finished, so nothing else can touch the
+        // device while they run. The shaders referenced by the configs outlive the workers as well,
+        // since the shader guard doesn't run until after the wireframe pipeline below.
+        size_t last_completed = 0;
+        for (;;)
+        {
+          const size_t completed = batch_compile->num_completed.load();
+          if (completed > last_completed)
+          {
+            progress.Increment(static_cast<u32>(completed - last_completed));
+            last_completed = completed;
+          }
+
+          if (completed >= batch_compile->work.size() || batch_compile->failed.load())
+            break;
+
+          std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
 
-    GL_OBJECT_NAME(m_wireframe_pipeline, "Batch Wireframe Pipeline");
+        for (std::thread& thread : batch_compile->threads)
+          thread.join();
 
-    plconfig.vertex_shader = nullptr;
-    plconfig.geometry_shader = nullptr;
-    plconfig.fragment_shader = nullptr;
+        if (batch_compile->failed.load())
+          return false;
+      }
+    }
+
+    if (m_wireframe_mode != GPUWireframeMode::Disabled)
+    {
+      std::unique_ptr<GPUShader> gs =
+        g_gpu_device->CreateShader(GPUShaderStage::Geometry, shadergen.GenerateWireframeGeometryShader());
+      std::unique_ptr<GPUShader> fs =
+        g_gpu_device->CreateShader(GPUShaderStage::Fragment, shadergen.GenerateWireframeFragmentShader());
+      if (!gs || !fs)
+        return false;
+
+      GL_OBJECT_NAME(gs, "Batch Wireframe Geometry Shader");
+      GL_OBJECT_NAME(fs, "Batch Wireframe Fragment Shader");
+
+      plconfig.input_layout.vertex_attributes =
+        std::span<const GPUPipeline::VertexAttribute>(vertex_attributes, NUM_BATCH_VERTEX_ATTRIBUTES);
+      plconfig.blend = (m_wireframe_mode == GPUWireframeMode::OverlayWireframe) ?
+                         GPUPipeline::BlendState::GetAlphaBlendingState() :
+                         GPUPipeline::BlendState::GetNoBlendingState();
+      plconfig.blend.write_mask = 0x7;
+      plconfig.depth = GPUPipeline::DepthState::GetNoTestsState();
+      plconfig.vertex_shader = batch_vertex_shaders[0].get();
+      plconfig.geometry_shader = gs.get();
+      plconfig.fragment_shader = fs.get();
+
+      if (!(m_wireframe_pipeline = g_gpu_device->CreatePipeline(plconfig)))
+        return false;
+
+      GL_OBJECT_NAME(m_wireframe_pipeline, "Batch Wireframe Pipeline");
+
+      plconfig.vertex_shader = nullptr;
+      plconfig.geometry_shader = nullptr;
+      plconfig.fragment_shader = nullptr;
+    }
+
+    if (background_compile)
+    {
+      // The workers are still referencing the batch shaders, keep them alive until the threads are
+      // joined in FinishBackgroundPipelineCompile().
+      batch_compile->vertex_shaders = std::move(batch_vertex_shaders);
+      batch_compile->fragment_shaders = std::move(batch_fragment_shaders);
+    }
   }
 
   batch_shader_guard.Run();
 
+  if (!(groups & (PIPELINE_GROUP_VRAM_OPS | PIPELINE_GROUP_DISPLAY | PIPELINE_GROUP_DOWNSAMPLE)))
+  {
+    progress.Increment();
+    return true;
+  }
+
   std::unique_ptr<GPUShader> fullscreen_quad_vertex_shader =
     g_gpu_device->CreateShader(GPUShaderStage::Vertex, shadergen.GenerateScreenQuadVertexShader());
   if (!fullscreen_quad_vertex_shader)
@@ -952,95 +1266,98 @@ bool GPU_HW::CompilePipelines()
   plconfig.blend = GPUPipeline::BlendState::GetNoBlendingState();
   plconfig.vertex_shader = fullscreen_quad_vertex_shader.get();
 
-  // VRAM fill
-  for (u8 wrapped = 0; wrapped < 2; wrapped++)
+  if (groups & PIPELINE_GROUP_VRAM_OPS)
   {
-    for (u8 interlaced = 0; interlaced < 2; interlaced++)
+    // VRAM fill
+    for (u8 wrapped = 0; wrapped < 2; wrapped++)
     {
-      std::unique_ptr<GPUShader> fs = g_gpu_device->CreateShader(
-        GPUShaderStage::Fragment,
-        shadergen.GenerateVRAMFillFragmentShader(ConvertToBoolUnchecked(wrapped), ConvertToBoolUnchecked(interlaced)));
-      if (!fs)
-        return false;
+      for (u8 interlaced = 0; interlaced < 2; interlaced++)
+      {
+        std::unique_ptr<GPUShader> fs = g_gpu_device->CreateShader(
+          GPUShaderStage::Fragment,
+          shadergen.GenerateVRAMFillFragmentShader(ConvertToBoolUnchecked(wrapped), ConvertToBoolUnchecked(interlaced)));
+        if (!fs)
+          return false;
 
-      plconfig.fragment_shader = fs.get();
-      plconfig.depth = GPUPipeline::DepthState::GetAlwaysWriteState();
+        plconfig.fragment_shader = fs.get();
+        plconfig.depth = GPUPipeline::DepthState::GetAlwaysWriteState();
 
-      if (!(m_vram_fill_pipelines[wrapped][interlaced] = g_gpu_device->CreatePipeline(plconfig)))
-        return false;
+        if (!(m_vram_fill_pipelines[wrapped][interlaced] = g_gpu_device->CreatePipeline(plconfig)))
+          return false;
 
-      progress.Increment();
+        progress.Increment();
+      }
     }
-  }
 
-  // VRAM copy
-  {
-    std::unique_ptr<GPUShader> fs =
-      g_gpu_device->CreateShader(GPUShaderStage::Fragment, shadergen.GenerateVRAMCopyFragmentShader());
-    if (!fs)
-      return false;
-
-    plconfig.fragment_shader = fs.get();
-    for (u8 depth_test = 0; depth_test < 2; depth_test++)
+    // VRAM copy
     {
-      plconfig.depth.depth_write = true;
-      plconfig.depth.depth_test =
-        (depth_test != 0) ? GPUPipeline::DepthFunc::GreaterEqual : GPUPipeline::DepthFunc::Always;
-
-      if (!(m_vram_copy_pipelines[depth_test] = g_gpu_device->CreatePipeline(plconfig)))
+      std::unique_ptr<GPUShader> fs =
+        g_gpu_device->CreateShader(GPUShaderStage::Fragment, shadergen.GenerateVRAMCopyFragmentShader());
+      if (!fs)
         return false;
 
-      GL_OBJECT_NAME_FMT(m_vram_copy_pipelines[depth_test], "VRAM Write Pipeline, depth={}", depth_test);
+      plconfig.fragment_shader = fs.get();
+      for (u8 depth_test = 0; depth_test < 2; depth_test++)
+      {
+        plconfig.depth.depth_write = true;
+        plconfig.depth.depth_test =
+          (depth_test != 0) ? GPUPipeline::DepthFunc::GreaterEqual : GPUPipeline::DepthFunc::Always;
 
-      progress.Increment();
-    }
-  }
+        if (!(m_vram_copy_pipelines[depth_test] = g_gpu_device->CreatePipeline(plconfig)))
+          return false;
 
-  // VRAM write
-  {
-    const bool use_ssbo = features.texture_buffers_emulated_with_ssbo;
-    std::unique_ptr<GPUShader> fs =
-      g_gpu_device->CreateShader(GPUShaderStage::Fragment, shadergen.GenerateVRAMWriteFragmentShader(use_ssbo));
-    if (!fs)
-      return false;
+        GL_OBJECT_NAME_FMT(m_vram_copy_pipelines[depth_test], "VRAM Write Pipeline, depth={}", depth_test);
 
-    plconfig.layout = GPUPipeline::Layout::SingleTextureBufferAndPushConstants;
-    plconfig.fragment_shader = fs.get();
-    for (u8 depth_test = 0; depth_test < 2; depth_test++)
-    {
-      plconfig.depth.depth_write = true;
-      plconfig.depth.depth_test =
-        (depth_test != 0) ? GPUPipeline::DepthFunc::GreaterEqual : GPUPipeline::DepthFunc::Always;
+        progress.Increment();
+      }
+    }
 
-      if (!(m_vram_write_pipelines[depth_test] = g_gpu_device->CreatePipeline(plconfig)))
+    // VRAM write
+    {
+      const bool use_ssbo = features.texture_buffers_emulated_with_ssbo;
+      std::unique_ptr<GPUShader> fs =
+        g_gpu_device->CreateShader(GPUShaderStage::Fragment, shadergen.GenerateVRAMWriteFragmentShader(use_ssbo));
+      if (!fs)
         return false;
 
-      GL_OBJECT_NAME_FMT(m_vram_write_pipelines[depth_test], "VRAM Write Pipeline, depth={}", depth_test);
+      plconfig.layout = GPUPipeline::Layout::SingleTextureBufferAndPushConstants;
+      plconfig.fragment_shader = fs.get();
+      for (u8 depth_test = 0; depth_test < 2; depth_test++)
+      {
+        plconfig.depth.depth_write = true;
+        plconfig.depth.depth_test =
+          (depth_test != 0) ? GPUPipeline::DepthFunc::GreaterEqual : GPUPipeline::DepthFunc::Always;
 
-      progress.Increment();
+        if (!(m_vram_write_pipelines[depth_test] = g_gpu_device->CreatePipeline(plconfig)))
+          return false;
+
+        GL_OBJECT_NAME_FMT(m_vram_write_pipelines[depth_test], "VRAM Write Pipeline, depth={}", depth_test);
+
+        progress.Increment();
+      }
     }
-  }
 
-  plconfig.layout = GPUPipeline::Layout::SingleTextureAndPushConstants;
+    plconfig.layout = GPUPipeline::Layout::SingleTextureAndPushConstants;
 
-  // VRAM update depth
-  {
-    std::unique_ptr<GPUShader> fs =
-      g_gpu_device->CreateShader(GPUShaderStage::Fragment, shadergen.GenerateVRAMUpdateDepthFragmentShader());
-    if (!fs)
-      return false;
+    // VRAM update depth
+    {
+      std::unique_ptr<GPUShader> fs =
+        g_gpu_device->CreateShader(GPUShaderStage::Fragment, shadergen.GenerateVRAMUpdateDepthFragmentShader());
+      if (!fs)
+        return false;
 
-    plconfig.fragment_shader = fs.get();
-    plconfig.SetTargetFormats(GPUTexture::Format::Unknown, VRAM_DS_FORMAT);
-    plconfig.depth = GPUPipeline::DepthState::GetAlwaysWriteState();
-    plconfig.blend.write_mask = 0;
+      plconfig.fragment_shader = fs.get();
+      plconfig.SetTargetFormats(GPUTexture::Format::Unknown, VRAM_DS_FORMAT);
+      plconfig.depth = GPUPipeline::DepthState::GetAlwaysWriteState();
+      plconfig.blend.write_mask = 0;
 
-    if (!(m_vram_update_depth_pipeline = g_gpu_device->CreatePipeline(plconfig)))
-      return false;
+      if (!(m_vram_update_depth_pipeline = g_gpu_device->CreatePipeline(plconfig)))
+        return false;
 
-    GL_OBJECT_NAME(m_vram_update_depth_pipeline, "VRAM Update Depth Pipeline");
+      GL_OBJECT_NAME(m_vram_update_depth_pipeline, "VRAM Update Depth Pipeline");
 
-    progress.Increment();
+      progress.Increment();
+    }
   }
 
   plconfig.SetTargetFormats(VRAM_RT_FORMAT);
@@ -1049,130 +1366,154 @@ bool GPU_HW::CompilePipelines()
   plconfig.samples = 1;
   plconfig.per_sample_shading = false;
 
-  // VRAM read
+  if (groups & PIPELINE_GROUP_VRAM_OPS)
   {
-    std::unique_ptr<GPUShader> fs =
-      g_gpu_device->CreateShader(GPUShaderStage::Fragment, shadergen.GenerateVRAMReadFragmentShader());
-    if (!fs)
-      return false;
+    // VRAM read
+    {
+      std::unique_ptr<GPUShader> fs =
+        g_gpu_device->CreateShader(GPUShaderStage::Fragment, shadergen.GenerateVRAMReadFragmentShader());
+      if (!fs)
+        return false;
 
-    plconfig.fragment_shader = fs.get();
+      plconfig.fragment_shader = fs.get();
 
-    if (!(m_vram_readback_pipeline = g_gpu_device->CreatePipeline(plconfig)))
-      return false;
+      if (!(m_vram_readback_pipeline = g_gpu_device->CreatePipeline(plconfig)))
+        return false;
 
-    GL_OBJECT_NAME(m_vram_readback_pipeline, "VRAM Read Pipeline");
-    progress.Increment();
+      GL_OBJECT_NAME(m_vram_readback_pipeline, "VRAM Read Pipeline");
+      progress.Increment();
+    }
   }
 
-  // Display
+  if (groups & PIPELINE_GROUP_DISPLAY)
   {
-    for (u8 depth_24 = 0; depth_24 < 2; depth_24++)
+    // Display
     {
-      for (u8 interlace_mode = 0; interlace_mode < 3; interlace_mode++)
+      for (u8 depth_24 = 0; depth_24 < 2; depth_24++)
       {
-        std::unique_ptr<GPUShader> fs = g_gpu_device->CreateShader(
-          GPUShaderStage::Fragment,
-          shadergen.GenerateDisplayFragmentShader(
-            ConvertToBoolUnchecked(depth_24), static_cast<InterlacedRenderMode>(interlace_mode), m_chroma_smoothing));
-        if (!fs)
-          return false;
+        for (u8 interlace_mode = 0; interlace_mode < 3; interlace_mode++)
+        {
+          std::unique_ptr<GPUShader> fs = g_gpu_device->CreateShader(
+            GPUShaderStage::Fragment,
+            shadergen.GenerateDisplayFragmentShader(
+              ConvertToBoolUnchecked(depth_24), static_cast<InterlacedRenderMode>(interlace_mode), m_chroma_smoothing));
+          if (!fs)
+            return false;
 
-        plconfig.fragment_shader = fs.get();
+          plconfig.fragment_shader = fs.get();
 
-        if (!(m_display_pipelines[depth_24][interlace_mode] = g_gpu_device->CreatePipeline(plconfig)))
-          return false;
+          if (!(m_display_pipelines[depth_24][interlace_mode] = g_gpu_device->CreatePipeline(plconfig)))
+            return false;
 
-        progress.Increment();
+          progress.Increment();
+        }
       }
     }
-  }
 
-  {
-    std::unique_ptr<GPUShader> fs =
-      g_gpu_device->CreateShader(GPUShaderStage::Fragment, shadergen.GenerateCopyFragmentShader());
-    if (!fs)
-      return false;
+    {
+      std::unique_ptr<GPUShader> fs =
+        g_gpu_device->CreateShader(GPUShaderStage::Fragment, shadergen.GenerateCopyFragmentShader());
+      if (!fs)
+        return false;
 
-    plconfig.fragment_shader = fs.get();
-    if (!(m_copy_pipeline = g_gpu_device->CreatePipeline(plconfig)))
-      return false;
+      plconfig.fragment_shader = fs.get();
+      if (!(m_copy_pipeline = g_gpu_device->CreatePipeline(plconfig)))
+        return false;
+    }
+
+    m_deinterlace_pipeline.reset();
+    if (m_motion_adaptive_deinterlacing)
+    {
+      std::unique_ptr<GPUShader> fs =
+        g_gpu_device->CreateShader(GPUShaderStage::Fragment, shadergen.GenerateMotionAdaptiveDeinterlaceFragmentShader());
+      if (!fs)
+        return false;
+
+      plconfig.fragment_shader = fs.get();
+      if (!(m_deinterlace_pipeline = g_gpu_device->CreatePipeline(plconfig)))
+        return false;
+
+      GL_OBJECT_NAME(m_deinterlace_pipeline, "Motion Adaptive Deinterlace Pipeline");
+    }
   }
 
-  if (m_downsample_mode == GPUDownsampleMode::Adaptive)
+  if (groups & PIPELINE_GROUP_DOWNSAMPLE)
   {
-    std::unique_ptr<GPUShader> vs =
-      g_gpu_device->CreateShader(GPUShaderStage::Vertex, shadergen.GenerateAdaptiveDownsampleVertexShader());
-    std::unique_ptr<GPUShader> fs =
-      g_gpu_device->CreateShader(GPUShaderStage::Fragment, shadergen.GenerateAdaptiveDownsampleMipFragmentShader(true));
-    if (!vs || !fs)
-      return false;
-    GL_OBJECT_NAME(fs, "Downsample Vertex Shader");
-    GL_OBJECT_NAME(fs, "Downsample First Pass Fragment Shader");
-    plconfig.vertex_shader = vs.get();
-    plconfig.fragment_shader = fs.get();
-    if (!(m_downsample_first_pass_pipeline = g_gpu_device->CreatePipeline(plconfig)))
-      return false;
-    GL_OBJECT_NAME(m_downsample_first_pass_pipeline, "Downsample First Pass Pipeline");
+    if (m_downsample_mode == GPUDownsampleMode::Adaptive)
+    {
+      std::unique_ptr<GPUShader> vs =
+        g_gpu_device->CreateShader(GPUShaderStage::Vertex, shadergen.GenerateAdaptiveDownsampleVertexShader());
+      std::unique_ptr<GPUShader> fs =
+        g_gpu_device->CreateShader(GPUShaderStage::Fragment, shadergen.GenerateAdaptiveDownsampleMipFragmentShader(true));
+      if (!vs || !fs)
+        return false;
+      GL_OBJECT_NAME(fs, "Downsample Vertex Shader");
+      GL_OBJECT_NAME(fs, "Downsample First Pass Fragment Shader");
+      plconfig.vertex_shader = vs.get();
+      plconfig.fragment_shader = fs.get();
+      if (!(m_downsample_first_pass_pipeline = g_gpu_device->CreatePipeline(plconfig)))
+        return false;
+      GL_OBJECT_NAME(m_downsample_first_pass_pipeline, "Downsample First Pass Pipeline");
 
-    fs = g_gpu_device->CreateShader(GPUShaderStage::Fragment,
-                                    shadergen.GenerateAdaptiveDownsampleMipFragmentShader(false));
-    if (!fs)
-      return false;
-    GL_OBJECT_NAME(fs, "Downsample Mid Pass Fragment Shader");
-    plconfig.fragment_shader = fs.get();
-    if (!(m_downsample_mid_pass_pipeline = g_gpu_device->CreatePipeline(plconfig)))
-      return false;
-    GL_OBJECT_NAME(m_downsample_mid_pass_pipeline, "Downsample Mid Pass Pipeline");
+      fs = g_gpu_device->CreateShader(GPUShaderStage::Fragment,
+                                      shadergen.GenerateAdaptiveDownsampleMipFragmentShader(false));
+      if (!fs)
+        return false;
+      GL_OBJECT_NAME(fs, "Downsample Mid Pass Fragment Shader");
+      plconfig.fragment_shader = fs.get();
+      if (!(m_downsample_mid_pass_pipeline = g_gpu_device->CreatePipeline(plconfig)))
+        return false;
+      GL_OBJECT_NAME(m_downsample_mid_pass_pipeline, "Downsample Mid Pass Pipeline");
 
-    fs = g_gpu_device->CreateShader(GPUShaderStage::Fragment, shadergen.GenerateAdaptiveDownsampleBlurFragmentShader());
-    if (!fs)
-      return false;
-    GL_OBJECT_NAME(fs, "Downsample Blur Pass Fragment Shader");
-    plconfig.fragment_shader = fs.get();
-    plconfig.SetTargetFormats(GPUTexture::Format::R8);
-    if (!(m_downsample_blur_pass_pipeline = g_gpu_device->CreatePipeline(plconfig)))
-      return false;
-    GL_OBJECT_NAME(m_downsample_blur_pass_pipeline, "Downsample Blur Pass Pipeline");
+      fs = g_gpu_device->CreateShader(GPUShaderStage::Fragment, shadergen.GenerateAdaptiveDownsampleBlurFragmentShader());
+      if (!fs)
+        return false;
+      GL_OBJECT_NAME(fs, "Downsample Blur Pass Fragment Shader");
+      plconfig.fragment_shader = fs.get();
+      plconfig.SetTargetFormats(GPUTexture::Format::R8);
+      if (!(m_downsample_blur_pass_pipeline = g_gpu_device->CreatePipeline(plconfig)))
+        return false;
+      GL_OBJECT_NAME(m_downsample_blur_pass_pipeline, "Downsample Blur Pass Pipeline");
 
-    fs = g_gpu_device->CreateShader(GPUShaderStage::Fragment,
-                                    shadergen.GenerateAdaptiveDownsampleCompositeFragmentShader());
-    if (!fs)
-      return false;
-    GL_OBJECT_NAME(fs, "Downsample Composite Pass Fragment Shader");
-    plconfig.layout = GPUPipeline::Layout::MultiTextureAndPushConstants;
-    plconfig.fragment_shader = fs.get();
-    plconfig.SetTargetFormats(VRAM_RT_FORMAT);
-    if (!(m_downsample_composite_pass_pipeline = g_gpu_device->CreatePipeline(plconfig)))
-      return false;
-    GL_OBJECT_NAME(m_downsample_composite_pass_pipeline, "Downsample Blur Pass Pipeline");
+      fs = g_gpu_device->CreateShader(GPUShaderStage::Fragment,
+                                      shadergen.GenerateAdaptiveDownsampleCompositeFragmentShader());
+      if (!fs)
+        return false;
+      GL_OBJECT_NAME(fs, "Downsample Composite Pass Fragment Shader");
+      plconfig.layout = GPUPipeline::Layout::MultiTextureAndPushConstants;
+      plconfig.fragment_shader = fs.get();
+      plconfig.SetTargetFormats(VRAM_RT_FORMAT);
+      if (!(m_downsample_composite_pass_pipeline = g_gpu_device->CreatePipeline(plconfig)))
+        return false;
+      GL_OBJECT_NAME(m_downsample_composite_pass_pipeline, "Downsample Blur Pass Pipeline");
 
-    GPUSampler::Config config = GPUSampler::GetLinearConfig();
-    config.min_lod = 0;
-    config.max_lod = GPUSampler::Config::LOD_MAX;
-    if (!(m_downsample_lod_sampler = g_gpu_device->CreateSampler(config)))
-      return false;
-    GL_OBJECT_NAME(m_downsample_lod_sampler, "Downsample LOD Sampler");
-    config.mip_filter = GPUSampler::Filter::Linear;
-    if (!(m_downsample_composite_sampler = g_gpu_device->CreateSampler(config)))
-      return false;
-    GL_OBJECT_NAME(m_downsample_composite_sampler, "Downsample Trilinear Sampler");
-  }
-  else if (m_downsample_mode == GPUDownsampleMode::Box)
-  {
-    std::unique_ptr<GPUShader> fs = g_gpu_device->CreateShader(
-      GPUShaderStage::Fragment, shadergen.GenerateBoxSampleDownsampleFragmentShader(
-                                  m_resolution_scale / GetBoxDownsampleScale(m_resolution_scale)));
-    if (!fs)
-      return false;
+      GPUSampler::Config config = GPUSampler::GetLinearConfig();
+      config.min_lod = 0;
+      config.max_lod = GPUSampler::Config::LOD_MAX;
+      if (!(m_downsample_lod_sampler = g_gpu_device->CreateSampler(config)))
+        return false;
+      GL_OBJECT_NAME(m_downsample_lod_sampler, "Downsample LOD Sampler");
+      config.mip_filter = GPUSampler::Filter::Linear;
+      if (!(m_downsample_composite_sampler = g_gpu_device->CreateSampler(config)))
+        return false;
+      GL_OBJECT_NAME(m_downsample_composite_sampler, "Downsample Trilinear Sampler");
+    }
+    else if (m_downsample_mode == GPUDownsampleMode::Box)
+    {
+      std::unique_ptr<GPUShader> fs = g_gpu_device->CreateShader(
+        GPUShaderStage::Fragment, shadergen.GenerateBoxSampleDownsampleFragmentShader(
+                                    m_resolution_scale / GetBoxDownsampleScale(m_resolution_scale)));
+      if (!fs)
+        return false;
 
-    GL_OBJECT_NAME(fs, "Downsample First Pass Fragment Shader");
-    plconfig.fragment_shader = fs.get();
+      GL_OBJECT_NAME(fs, "Downsample First Pass Fragment Shader");
+      plconfig.fragment_shader = fs.get();
 
-    if (!(m_downsample_first_pass_pipeline = g_gpu_device->CreatePipeline(plconfig)))
-      return false;
+      if (!(m_downsample_first_pass_pipeline = g_gpu_device->CreatePipeline(plconfig)))
+        return false;
 
-    GL_OBJECT_NAME(m_downsample_first_pass_pipeline, "Downsample First Pass Pipeline");
+      GL_OBJECT_NAME(m_downsample_first_pass_pipeline, "Downsample First Pass Pipeline");
+    }
   }
 
   progress.Increment();
@@ -1182,8 +1523,33 @@ bool GPU_HW::CompilePipelines()
   return true;
 }
 
+void GPU_HW::FinishBackgroundPipelineCompile(bool wait)
+{
+  if (!m_background_pipeline_compile || (!wait && !m_background_pipeline_compile->IsDone()))
+    return;
+
+  for (std::thread& thread : m_background_pipeline_compile->threads)
+    thread.join();
+
+  if (m_background_pipeline_compile->failed.load())
+  {
+    // Keep drawing with the old set. It covers the same permutations, just generated with the old
+    // settings, so everything still renders.
+    Log_ErrorPrintf("Background pipeline compile failed, keeping previous pipelines.");
+  }
+  else
+  {
+    m_batch_pipelines = std::move(m_background_pipeline_compile->pipelines);
+  }
+
+  m_background_pipeline_compile.reset();
+}
+
 void GPU_HW::DestroyPipelines()
 {
+  // Join any background compile first, otherwise the workers would write to freed pipelines.
+  FinishBackgroundPipelineCompile(true);
+
   static constexpr auto destroy = [](std::unique_ptr<GPUPipeline>& p) { p.reset(); };
 
   m_wireframe_pipeline.reset();
@@ -1222,6 +1588,8 @@ void GPU_HW::UpdateVRAMReadTexture()
 {
   GL_SCOPE("UpdateVRAMReadTexture()");
 
+  g_gpu_device->SetGPUTimingStage(GPUDevice::GPUTimingStage::VRAMUpdate);
+
   if (m_texpage_dirty)
     GL_INS("Texpage is no longer dirty");
   m_texpage_dirty = false;
@@ -1676,6 +2044,8 @@ void GPU_HW::LoadVertices()
           static_cast<u32>(std::clamp<s32>(max_y, m_drawing_area.top, m_drawing_area.bottom)) + 1u;
 
         m_vram_dirty_rect.Include(clip_left, clip_right, clip_top, clip_bottom);
+        m_vram_dirty_bitmap.Include(clip_left, clip_right, clip_top, clip_bottom);
+        m_vram_draw_dirty_rect.Include(clip_left, clip_right, clip_top, clip_bottom);
         AddDrawTriangleTicks(native_vertex_positions[0][0], native_vertex_positions[0][1],
                              native_vertex_positions[1][0], native_vertex_positions[1][1],
                              native_vertex_positions[2][0], native_vertex_positions[2][1], rc.shading_enable,
@@ -1710,6 +2080,8 @@ void GPU_HW::LoadVertices()
             static_cast<u32>(std::clamp<s32>(max_y_123, m_drawing_area.top, m_drawing_area.bottom)) + 1u;
 
           m_vram_dirty_rect.Include(clip_left, clip_right, clip_top, clip_bottom);
+          m_vram_dirty_bitmap.Include(clip_left, clip_right, clip_top, clip_bottom);
+          m_vram_draw_dirty_rect.Include(clip_left, clip_right, clip_top, clip_bottom);
           AddDrawTriangleTicks(native_vertex_positions[2][0], native_vertex_positions[2][1],
                                native_vertex_positions[1][0], native_vertex_positions[1][1],
                                native_vertex_positions[3][0], native_vertex_positions[3][1], rc.shading_enable,
@@ -1808,13 +2180,21 @@ void GPU_HW::LoadVertices()
 
           CheckForTexPageOverlap(texpage, tex_left, tex_top, tex_right - 1, tex_bottom - 1);
 
-          AddNewVertex(quad_start_x, quad_start_y, depth, 1.0f, color, texpage, tex_left, tex_top, uv_limits);
-          AddNewVertex(quad_end_x, quad_start_y, depth, 1.0f, color, texpage, tex_right, tex_top, uv_limits);
-          AddNewVertex(quad_start_x, quad_end_y, depth, 1.0f, color, texpage, tex_left, tex_bottom, uv_limits);
+          // Build the four corners once and copy them out in triangle order - two of the six
+          // vertices are repeats, and the 32-byte struct copies vectorize nicely.
+          std::array<BatchVertex, 4> corners;
+          corners[0].Set(quad_start_x, quad_start_y, depth, 1.0f, color, texpage, tex_left, tex_top, uv_limits);
+          corners[1].Set(quad_end_x, quad_start_y, depth, 1.0f, color, texpage, tex_right, tex_top, uv_limits);
+          corners[2].Set(quad_start_x, quad_end_y, depth, 1.0f, color, texpage, tex_left, tex_bottom, uv_limits);
+          corners[3].Set(quad_end_x, quad_end_y, depth, 1.0f, color, texpage, tex_right, tex_bottom, uv_limits);
+
+          AddVertex(corners[0]);
+          AddVertex(corners[1]);
+          AddVertex(corners[2]);
 
-          AddNewVertex(quad_start_x, quad_end_y, depth, 1.0f, color, texpage, tex_left, tex_bottom, uv_limits);
-          AddNewVertex(quad_end_x, quad_start_y, depth, 1.0f, color, texpage, tex_right, tex_top, uv_limits);
-          AddNewVertex(quad_end_x, quad_end_y, depth, 1.0f, color, texpage, tex_right, tex_bottom, uv_limits);
+          AddVertex(corners[2]);
+          AddVertex(corners[1]);
+          AddVertex(corners[3]);
 
           x_offset += quad_width;
           tex_left = 0;
@@ -1832,6 +2212,8 @@ void GPU_HW::LoadVertices()
         static_cast<u32>(std::clamp<s32>(pos_y + rectangle_height, m_drawing_area.top, m_drawing_area.bottom)) + 1u;
 
       m_vram_dirty_rect.Include(clip_left, clip_right, clip_top, clip_bottom);
+      m_vram_dirty_bitmap.Include(clip_left, clip_right, clip_top, clip_bottom);
+      m_vram_draw_dirty_rect.Include(clip_left, clip_right, clip_top, clip_bottom);
       AddDrawRectangleTicks(clip_right - clip_left, clip_bottom - clip_top, rc.texture_enable, rc.transparency_enable);
 
       if (m_sw_renderer)
@@ -1895,6 +2277,8 @@ void GPU_HW::LoadVertices()
           static_cast<u32>(std::clamp<s32>(max_y, m_drawing_area.top, m_drawing_area.bottom)) + 1u;
 
         m_vram_dirty_rect.Include(clip_left, clip_right, clip_top, clip_bottom);
+        m_vram_dirty_bitmap.Include(clip_left, clip_right, clip_top, clip_bottom);
+        m_vram_draw_dirty_rect.Include(clip_left, clip_right, clip_top, clip_bottom);
         AddDrawLineTicks(clip_right - clip_left, clip_bottom - clip_top, rc.shading_enable);
 
         // TODO: Should we do a PGXP lookup here? Most lines are 2D.
@@ -1962,6 +2346,8 @@ void GPU_HW::LoadVertices()
               static_cast<u32>(std::clamp<s32>(max_y, m_drawing_area.top, m_drawing_area.bottom)) + 1u;
 
             m_vram_dirty_rect.Include(clip_left, clip_right, clip_top, clip_bottom);
+            m_vram_dirty_bitmap.Include(clip_left, clip_right, clip_top, clip_bottom);
+            m_vram_draw_dirty_rect.Include(clip_left, clip_right, clip_top, clip_bottom);
             AddDrawLineTicks(clip_right - clip_left, clip_bottom - clip_top, rc.shading_enable);
 
             // TODO: Should we do a PGXP lookup here? Most lines are 2D.
@@ -1992,40 +2378,34 @@ void GPU_HW::LoadVertices()
 bool GPU_HW::BlitVRAMReplacementTexture(const TextureReplacementTexture* tex, u32 dst_x, u32 dst_y, u32 width,
                                         u32 height)
 {
-  if (!m_vram_replacement_texture || m_vram_replacement_texture->GetWidth() < tex->GetWidth() ||
-      m_vram_replacement_texture->GetHeight() < tex->GetHeight())
+  // Fetch a pooled texture per upload rather than updating a single texture in place. Updating a
+  // texture that was already sampled this frame breaks the render pass and re-transitions the
+  // image for every write, which games streaming replacements hit constantly; pooled textures go
+  // through the batched pre-frame upload path instead.
+  std::unique_ptr<GPUTexture> replacement_texture =
+    g_gpu_device->FetchTexture(tex->GetWidth(), tex->GetHeight(), 1, 1, 1, GPUTexture::Type::Texture,
+                               GPUTexture::Format::RGBA8, tex->GetPixels(), tex->GetPitch());
+  if (!replacement_texture)
   {
-    g_gpu_device->RecycleTexture(std::move(m_vram_replacement_texture));
-
-    if (!(m_vram_replacement_texture =
-            g_gpu_device->FetchTexture(tex->GetWidth(), tex->GetHeight(), 1, 1, 1, GPUTexture::Type::DynamicTexture,
-                                       GPUTexture::Format::RGBA8, tex->GetPixels(), tex->GetPitch())))
-    {
-      return false;
-    }
-  }
-  else
-  {
-    if (!m_vram_replacement_texture->Update(0, 0, width, height, tex->GetPixels(), tex->GetPitch()))
-    {
-      Log_ErrorFmt("Update {}x{} texture failed.", width, height);
-      return false;
-    }
+    Log_ErrorFmt("Failed to get {}x{} texture for replacement", tex->GetWidth(), tex->GetHeight());
+    return false;
   }
 
   g_gpu_device->SetRenderTarget(m_vram_texture.get(), m_vram_depth_texture.get()); // TODO: needed?
-  g_gpu_device->SetTextureSampler(0, m_vram_replacement_texture.get(), g_gpu_device->GetLinearSampler());
+  g_gpu_device->SetTextureSampler(0, replacement_texture.get(), g_gpu_device->GetLinearSampler());
   g_gpu_device->SetPipeline(m_copy_pipeline.get());
   g_gpu_device->SetViewportAndScissor(dst_x, dst_y, width, height);
   g_gpu_device->Draw(3, 0);
 
   RestoreDeviceContext();
+  g_gpu_device->RecycleTexture(std::move(replacement_texture));
   return true;
 }
 
 void GPU_HW::IncludeVRAMDirtyRectangle(const Common::Rectangle<u32>& rect)
 {
   m_vram_dirty_rect.Include(rect);
+  m_vram_dirty_bitmap.Include(rect);
 
   // the vram area can include the texture page, but the game can leave it as-is. in this case, set it as dirty so the
   // shadow texture is updated
@@ -2064,7 +2444,7 @@ ALWAYS_INLINE_RELEASE void GPU_HW::CheckForTexPageOverlap(u32 texpage, u32 min_u
     m_current_uv_range.Include(vram_min_u, vram_max_u, vram_min_v, vram_max_v);
 
     DebugAssert(m_vram_dirty_rect.Valid());
-    if (m_current_uv_range.Intersects(m_vram_dirty_rect))
+    if (m_current_uv_range.Intersects(m_vram_dirty_rect) && m_vram_dirty_bitmap.Intersects(m_current_uv_range))
     {
       GL_INS_FMT("Updating VRAM cache due to UV {{{},{} => {},{}}} intersection with dirty {{{},{} => {},{}}}",
                  m_current_uv_range.left, m_current_uv_range.top, m_current_uv_range.right, m_current_uv_range.bottom,
@@ -2263,8 +2643,10 @@ void GPU_HW::FillVRAM(u32 x, u32 y, u32 width, u32 height, u32 color)
     m_sw_renderer->PushCommand(cmd);
   }
 
-  IncludeVRAMDirtyRectangle(
-    Common::Rectangle<u32>::FromExtents(x, y, width, height).Clamped(0, 0, VRAM_WIDTH, VRAM_HEIGHT));
+  const Common::Rectangle<u32> fill_rect =
+    Common::Rectangle<u32>::FromExtents(x, y, width, height).Clamped(0, 0, VRAM_WIDTH, VRAM_HEIGHT);
+  IncludeVRAMDirtyRectangle(fill_rect);
+  m_vram_draw_dirty_rect.Include(fill_rect);
 
   const bool is_oversized = (((x + width) > VRAM_WIDTH || (y + height) > VRAM_HEIGHT));
   g_gpu_device->SetPipeline(
@@ -2311,6 +2693,18 @@ void GPU_HW::ReadVRAM(u32 x, u32 y, u32 width, u32 height)
 
   // Get bounds with wrap-around handled.
   const Common::Rectangle<u32> copy_rect = GetVRAMTransferBounds(x, y, width, height);
+
+  // If nothing has rendered into this region since the last download, the shadow copy is still
+  // current and the whole GPU round trip can be skipped. CPU uploads are mirrored into the shadow
+  // by UpdateVRAM, so only drawn regions count. Full-VRAM reads (savestates, rewind) benefit the
+  // most when little has been drawn.
+  if (!(m_vram_draw_dirty_rect.Valid() && copy_rect.Intersects(m_vram_draw_dirty_rect)) &&
+      !(m_vram_shadow_dirty_rect.Valid() && copy_rect.Intersects(m_vram_shadow_dirty_rect)))
+  {
+    GL_POP();
+    return;
+  }
+
   const u32 encoded_width = (copy_rect.GetWidth() + 1) / 2;
   const u32 encoded_height = copy_rect.GetHeight();
 
@@ -2330,6 +2724,16 @@ void GPU_HW::ReadVRAM(u32 x, u32 y, u32 width, u32 height)
                                 reinterpret_cast<u32*>(&m_vram_shadow[copy_rect.top * VRAM_WIDTH + copy_rect.left]),
                                 VRAM_WIDTH * sizeof(u16));
 
+  // The downloaded region is current again. The tracker is a single bounding box, so it can only
+  // be reset when the read covers it entirely; m_vram_dirty_rect has to stick around for the read
+  // texture, but it gets folded back in the next time it is cleared.
+  if (m_vram_shadow_dirty_rect.Valid() && copy_rect.left <= m_vram_shadow_dirty_rect.left &&
+      copy_rect.top <= m_vram_shadow_dirty_rect.top && copy_rect.right >= m_vram_shadow_dirty_rect.right &&
+      copy_rect.bottom >= m_vram_shadow_dirty_rect.bottom)
+  {
+    m_vram_shadow_dirty_rect.SetInvalid();
+  }
+
   RestoreDeviceContext();
 }
 
@@ -2337,6 +2741,39 @@ void GPU_HW::UpdateVRAM(u32 x, u32 y, u32 width, u32 height, const void* data, b
 {
   GL_SCOPE_FMT("UpdateVRAM({},{} => {},{} ({}x{})", x, y, x + width, y + height, width, height);
 
+  // Mask-free, non-wrapping uploads get mirrored into the shadow copy, which lets a later upload
+  // of identical data skip the GPU entirely - games commonly re-upload unchanged texture data
+  // every frame. The shadow is only trustworthy where the GPU hasn't rendered since the last
+  // download, which is what the draw/shadow dirty rectangles track. Re-uploads of the shadow
+  // itself (buffer recreation) are excluded.
+  const bool mirror_to_shadow = (!set_mask && !check_mask && (x + width) <= VRAM_WIDTH &&
+                                 (y + height) <= VRAM_HEIGHT && data != static_cast<const void*>(m_vram_ptr));
+  if (mirror_to_shadow)
+  {
+    const Common::Rectangle<u32> write_rect = Common::Rectangle<u32>::FromExtents(x, y, width, height);
+    if (!(m_vram_draw_dirty_rect.Valid() && write_rect.Intersects(m_vram_draw_dirty_rect)) &&
+        !(m_vram_shadow_dirty_rect.Valid() && write_rect.Intersects(m_vram_shadow_dirty_rect)))
+    {
+      const u16* src_ptr = static_cast<const u16*>(data);
+      const u16* shadow_ptr = &m_vram_shadow[y * VRAM_WIDTH + x];
+      u32 row = 0;
+      for (; row < height && std::memcmp(shadow_ptr, src_ptr, width * sizeof(u16)) == 0; row++)
+      {
+        src_ptr += width;
+        shadow_ptr += VRAM_WIDTH;
+      }
+      if (row == height)
+      {
+        GL_INS("Skipping upload of identical data");
+        return;
+      }
+    }
+
+    GPU::UpdateVRAM(x, y, width, height, data, set_mask, check_mask);
+  }
+
+  g_gpu_device->SetGPUTimingStage(GPUDevice::GPUTimingStage::VRAMUpdate);
+
   if (m_sw_renderer)
   {
     const u32 num_words = width * height;
@@ -2356,6 +2793,10 @@ void GPU_HW::UpdateVRAM(u32 x, u32 y, u32 width, u32 height, const void* data, b
   DebugAssert(bounds.right <= VRAM_WIDTH && bounds.bottom <= VRAM_HEIGHT);
   IncludeVRAMDirtyRectangle(bounds);
 
+  // Masked/wrapped uploads aren't mirrored, so the shadow goes stale for the region.
+  if (!mirror_to_shadow)
+    m_vram_draw_dirty_rect.Include(bounds);
+
   if (check_mask)
   {
     // set new vertex counter since we want this to take into consideration previous masked pixels
@@ -2371,6 +2812,11 @@ void GPU_HW::UpdateVRAM(u32 x, u32 y, u32 width, u32 height, const void* data, b
     }
   }
 
+  // Map() returns persistently-mapped, host-visible memory in every backend (device-local too on
+  // UMA hardware), so this is the only CPU-side copy of the pixel data; the draw below expands it
+  // into the VRAM texture on the GPU. The blit buffer the data arrives in can't be elided, since
+  // it's what gets serialized to savestates for in-progress transfers, and it feeds the software
+  // renderer, texture replacements, and VRAM write dumping.
   const u32 num_pixels = width * height;
   void* map = m_vram_upload_buffer->Map(num_pixels);
   const u32 map_index = m_vram_upload_buffer->GetCurrentPosition();
@@ -2427,13 +2873,19 @@ void GPU_HW::CopyVRAM(u32 src_x, u32 src_y, u32 dst_x, u32 dst_y, u32 width, u32
      ((src_y % VRAM_HEIGHT) + height) > VRAM_HEIGHT || ((dst_x % VRAM_WIDTH) + width) > VRAM_WIDTH ||
      ((dst_y % VRAM_HEIGHT) + height) > VRAM_HEIGHT);
 
-  if (use_shader || IsUsingMultisampling())
+  // Prefer the draw-based copy whenever the read texture is already current for the source, even
+  // when a plain texture copy would be legal. The draw executes inside the current render pass,
+  // while CopyTextureRegion always interrupts it, and render pass restarts are expensive on tiled
+  // GPUs.
+  const Common::Rectangle<u32> src_bounds = GetVRAMTransferBounds(src_x, src_y, width, height);
+  const bool src_dirty = m_vram_dirty_rect.Intersects(src_bounds) && m_vram_dirty_bitmap.Intersects(src_bounds);
+  if (use_shader || IsUsingMultisampling() || !src_dirty)
   {
-    const Common::Rectangle<u32> src_bounds = GetVRAMTransferBounds(src_x, src_y, width, height);
     const Common::Rectangle<u32> dst_bounds = GetVRAMTransferBounds(dst_x, dst_y, width, height);
-    if (m_vram_dirty_rect.Intersects(src_bounds))
+    if (src_dirty)
       UpdateVRAMReadTexture();
     IncludeVRAMDirtyRectangle(dst_bounds);
+    m_vram_draw_dirty_rect.Include(dst_bounds);
 
     struct VRAMCopyUBOData
     {
@@ -2481,12 +2933,15 @@ void GPU_HW::CopyVRAM(u32 src_x, u32 src_y, u32 dst_x, u32 dst_y, u32 width, u32
   if (!g_gpu_device->GetFeatures().texture_copy_to_self || overlaps_with_self)
   {
     src_tex = m_vram_read_texture.get();
-    if (m_vram_dirty_rect.Intersects(Common::Rectangle<u32>::FromExtents(src_x, src_y, width, height)))
+    const Common::Rectangle<u32> copy_src_rect = Common::Rectangle<u32>::FromExtents(src_x, src_y, width, height);
+    if (m_vram_dirty_rect.Intersects(copy_src_rect) && m_vram_dirty_bitmap.Intersects(copy_src_rect))
       UpdateVRAMReadTexture();
   }
 
-  IncludeVRAMDirtyRectangle(
-    Common::Rectangle<u32>::FromExtents(dst_x, dst_y, width, height).Clamped(0, 0, VRAM_WIDTH, VRAM_HEIGHT));
+  const Common::Rectangle<u32> copy_dst_rect =
+    Common::Rectangle<u32>::FromExtents(dst_x, dst_y, width, height).Clamped(0, 0, VRAM_WIDTH, VRAM_HEIGHT);
+  IncludeVRAMDirtyRectangle(copy_dst_rect);
+  m_vram_draw_dirty_rect.Include(copy_dst_rect);
 
   if (m_GPUSTAT.check_mask_before_draw)
   {
@@ -2530,7 +2985,8 @@ void GPU_HW::DispatchRenderCommand()
 #endif
 
       if (m_vram_dirty_rect.Valid() && m_draw_mode.mode_reg.IsUsingPalette() &&
-          m_draw_mode.GetTexturePaletteRectangle().Intersects(m_vram_dirty_rect))
+          m_draw_mode.GetTexturePaletteRectangle().Intersects(m_vram_dirty_rect) &&
+          m_vram_dirty_bitmap.Intersects(m_draw_mode.GetTexturePaletteRectangle()))
       {
         GL_INS("Palette in VRAM dirty area, flushing cache");
         if (!IsFlushed())
@@ -2539,7 +2995,8 @@ void GPU_HW::DispatchRenderCommand()
         UpdateVRAMReadTexture();
       }
 
-      if (m_vram_dirty_rect.Valid() && m_draw_mode.mode_reg.GetTexturePageRectangle().Intersects(m_vram_dirty_rect))
+      if (m_vram_dirty_rect.Valid() && m_draw_mode.mode_reg.GetTexturePageRectangle().Intersects(m_vram_dirty_rect) &&
+          m_vram_dirty_bitmap.Intersects(m_draw_mode.mode_reg.GetTexturePageRectangle()))
       {
         GL_INS("Texpage is in dirty area, checking UV ranges");
         m_compute_uv_range = true;
@@ -2665,6 +3122,8 @@ void GPU_HW::FlushRender()
   if (vertex_count == 0)
     return;
 
+  g_gpu_device->SetGPUTimingStage(GPUDevice::GPUTimingStage::Draw);
+
 #ifdef _DEBUG
   GL_SCOPE_FMT("Hardware Draw {}", ++s_draw_number);
 #endif
@@ -2703,6 +3162,11 @@ void GPU_HW::UpdateDisplay()
 {
   FlushRender();
 
+  // Frame boundary, safe point to swap in freshly-compiled pipelines.
+  FinishBackgroundPipelineCompile(false);
+
+  AccumulateStreamBufferStats();
+
   if (g_settings.debugging.show_vram)
   {
     if (IsUsingMultisampling())
@@ -2793,22 +3257,119 @@ void GPU_HW::UpdateDisplay()
       g_gpu_device->SetViewportAndScissor(0, 0, scaled_display_width, scaled_display_height);
       g_gpu_device->Draw(3, 0);
 
+      GPUTexture* display_source = m_display_private_texture.get();
+      if (m_motion_adaptive_deinterlacing && interlaced != InterlacedRenderMode::None &&
+          ApplyMotionAdaptiveDeinterlace(scaled_display_width, scaled_display_height, reinterpret_field_offset))
+      {
+        display_source = m_deinterlace_texture.get();
+      }
+
       if (IsUsingDownsampling())
-        DownsampleFramebuffer(m_display_private_texture.get(), 0, 0, scaled_display_width, scaled_display_height);
+        DownsampleFramebuffer(display_source, 0, 0, scaled_display_width, scaled_display_height);
       else
-        SetDisplayTexture(m_display_private_texture.get(), 0, 0, scaled_display_width, scaled_display_height);
+        SetDisplayTexture(display_source, 0, 0, scaled_display_width, scaled_display_height);
 
       RestoreDeviceContext();
     }
   }
 }
 
+bool GPU_HW::ApplyMotionAdaptiveDeinterlace(u32 width, u32 height, u32 field_offset)
+{
+  if (!m_deinterlace_pipeline)
+    return false;
+
+  if (!m_deinterlace_texture || m_deinterlace_texture->GetWidth() != width ||
+      m_deinterlace_texture->GetHeight() != height)
+  {
+    g_gpu_device->RecycleTexture(std::move(m_deinterlace_texture));
+    g_gpu_device->RecycleTexture(std::move(m_deinterlace_history_texture));
+    m_deinterlace_texture =
+      g_gpu_device->FetchTexture(width, height, 1, 1, 1, GPUTexture::Type::RenderTarget, VRAM_RT_FORMAT);
+    m_deinterlace_history_texture =
+      g_gpu_device->FetchTexture(width, height, 1, 1, 1, GPUTexture::Type::RenderTarget, VRAM_RT_FORMAT);
+    if (!m_deinterlace_texture || !m_deinterlace_history_texture)
+    {
+      Log_ErrorFmt("Failed to create {}x{} deinterlace textures", width, height);
+      g_gpu_device->RecycleTexture(std::move(m_deinterlace_texture));
+      g_gpu_device->RecycleTexture(std::move(m_deinterlace_history_texture));
+      return false;
+    }
+
+    GL_OBJECT_NAME(m_deinterlace_texture, "Deinterlace Texture");
+    GL_OBJECT_NAME(m_deinterlace_history_texture, "Deinterlace History Texture");
+
+    // no motion reference on the first frame after a resize, seed it with the current composite
+    g_gpu_device->CopyTextureRegion(m_deinterlace_history_texture.get(), 0, 0, 0, 0, m_display_private_texture.get(),
+                                    0, 0, 0, 0, width, height);
+  }
+
+  GL_SCOPE("MotionAdaptiveDeinterlace");
+
+  g_gpu_device->InvalidateRenderTarget(m_deinterlace_texture.get());
+  g_gpu_device->SetRenderTarget(m_deinterlace_texture.get());
+  g_gpu_device->SetPipeline(m_deinterlace_pipeline.get());
+  g_gpu_device->SetTextureSampler(0, m_display_private_texture.get(), g_gpu_device->GetNearestSampler());
+  g_gpu_device->SetTextureSampler(1, m_deinterlace_history_texture.get(), g_gpu_device->GetNearestSampler());
+
+  const u32 uniforms[4] = {field_offset, height, 0u, 0u};
+  g_gpu_device->PushUniformBuffer(uniforms, sizeof(uniforms));
+
+  g_gpu_device->SetViewportAndScissor(0, 0, width, height);
+  g_gpu_device->Draw(3, 0);
+
+  // keep this frame's composite around as the next frame's motion reference
+  g_gpu_device->CopyTextureRegion(m_deinterlace_history_texture.get(), 0, 0, 0, 0, m_display_private_texture.get(), 0,
+                                  0, 0, 0, width, height);
+  return true;
+}
+
 void GPU_HW::DownsampleFramebuffer(GPUTexture* source, u32 left, u32 top, u32 width, u32 height)
 {
+  // Re-displaying an unchanged source region (static menus) reuses the previous resolve instead
+  // of re-running the whole mip/box chain every presented frame. Only the direct-from-VRAM path
+  // is versioned; the private display texture is re-rendered every UpdateDisplay anyway.
+  const bool cacheable = (source == m_vram_texture.get());
+  if (cacheable)
+  {
+    Common::Rectangle<u32> changed_rect = m_downsample_dirty_rect;
+    if (m_vram_dirty_rect.Valid())
+      changed_rect.Include(m_vram_dirty_rect);
+
+    if (m_downsample_display_texture && left == m_downsample_source_left && top == m_downsample_source_top &&
+        width == m_downsample_source_width && height == m_downsample_source_height &&
+        !(changed_rect.Valid() && (changed_rect * m_resolution_scale)
+                                    .Intersects(Common::Rectangle<u32>::FromExtents(left, top, width, height))))
+    {
+      GL_INS("Reusing cached downsample resolve");
+      SetDisplayTexture(m_downsample_display_texture, m_downsample_display_view_x, m_downsample_display_view_y,
+                        m_downsample_display_view_width, m_downsample_display_view_height);
+      return;
+    }
+  }
+
   if (m_downsample_mode == GPUDownsampleMode::Adaptive)
     DownsampleFramebufferAdaptive(source, left, top, width, height);
   else
     DownsampleFramebufferBoxFilter(source, left, top, width, height);
+
+  if (cacheable)
+  {
+    m_downsample_dirty_rect.SetInvalid();
+    m_downsample_display_texture = m_display_texture;
+    m_downsample_source_left = left;
+    m_downsample_source_top = top;
+    m_downsample_source_width = width;
+    m_downsample_source_height = height;
+    m_downsample_display_view_x = m_display_texture_view_x;
+    m_downsample_display_view_y = m_display_texture_view_y;
+    m_downsample_display_view_width = m_display_texture_view_width;
+    m_downsample_display_view_height = m_display_texture_view_height;
+  }
+  else
+  {
+    m_downsample_display_texture = nullptr;
+  }
 }
 
 void GPU_HW::DownsampleFramebufferAdaptive(GPUTexture* source, u32 left, u32 top, u32 width, u32 height)
@@ -11,8 +11,13 @@
 #include "common/dimensional_array.h"
 #include "common/heap_array.h"
 
+#include <array>
+#include <atomic>
+#include <deque>
+#include <memory>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -47,12 +52,13 @@ public:
 
   bool Initialize() override;
   void Reset(bool clear_vram) override;
-  bool DoState(StateWrapper& sw, GPUTexture** host_texture, bool update_display) override;
+  bool DoState(StateWrapper& sw, GPUTexture** host_texture, u64* host_texture_id, bool update_display) override;
 
   void RestoreDeviceContext() override;
 
   void UpdateSettings(const Settings& old_settings) override;
   void UpdateResolutionScale() override final;
+  void UpdateDynamicResolutionScale(float average_gpu_time) override final;
   std::tuple<u32, u32> GetEffectiveDisplayResolution(bool scaled = true) override final;
   std::tuple<u32, u32> GetFullDisplayResolution(bool scaled = true) override final;
 
@@ -117,13 +123,50 @@ private:
     u32 num_uniform_buffer_updates;
   };
 
+  struct BatchPipelineCompile
+  {
+    // Staging copy of m_batch_pipelines, swapped in at the next display update when compiling in
+    // the background. Unused for blocking compiles, which write to m_batch_pipelines directly.
+    DimensionalArray<std::unique_ptr<GPUPipeline>, 2, 2, 5, 9, 4, 3> pipelines{};
+
+    // Shaders are moved here for background compiles, since the workers outlive CompilePipelines().
+    DimensionalArray<std::unique_ptr<GPUShader>, 2> vertex_shaders{};
+    DimensionalArray<std::unique_ptr<GPUShader>, 2, 2, 9, 5, 4> fragment_shaders{};
+
+    std::vector<std::pair<GPUPipeline::GraphicsConfig, std::unique_ptr<GPUPipeline>*>> work;
+    std::vector<std::thread> threads;
+    std::atomic_size_t next_index{0};
+    std::atomic_size_t num_completed{0};
+    std::atomic_bool failed{false};
+
+    void StartThreads(u32 num_threads);
+    bool IsDone() const { return (num_completed.load() >= work.size() || failed.load()); }
+  };
+
   bool CreateBuffers();
   void ClearFramebuffer();
   void DestroyBuffers();
 
-  bool CompilePipelines();
+  /// Pipelines grouped by the settings they depend on, so a runtime toggle only rebuilds the
+  /// affected subset. Resolution scale/multisampling feed every generated shader, so changing
+  /// those dirties all groups.
+  enum PipelineGroup : u32
+  {
+    PIPELINE_GROUP_BATCH = (1u << 0),      // batch draw and wireframe pipelines
+    PIPELINE_GROUP_VRAM_OPS = (1u << 1),   // VRAM fill/copy/write/read/depth pipelines
+    PIPELINE_GROUP_DISPLAY = (1u << 2),    // display and copy pipelines
+    PIPELINE_GROUP_DOWNSAMPLE = (1u << 3), // downsample pipelines and samplers
+    PIPELINE_GROUP_ALL =
+      PIPELINE_GROUP_BATCH | PIPELINE_GROUP_VRAM_OPS | PIPELINE_GROUP_DISPLAY | PIPELINE_GROUP_DOWNSAMPLE,
+  };
+
+  bool CompilePipelines(u32 groups = PIPELINE_GROUP_ALL, bool background_batch_compile = false);
   void DestroyPipelines();
 
+  /// Joins the background batch pipeline compile and swaps in the new pipelines. If wait is false
+  /// and the workers are still running, the old pipelines stay active and nothing happens.
+  void FinishBackgroundPipelineCompile(bool wait);
+
   void LoadVertices();
 
   void AddVertex(const BatchVertex& v);
@@ -148,6 +191,10 @@ private:
   bool IsUsingMultisampling() const;
   bool IsUsingDownsampling() const;
 
+  /// Drains the device's streaming-buffer counters and periodically logs them, so undersized
+  /// buffers at high resolution scales show up in the log instead of as unexplained frame time.
+  void AccumulateStreamBufferStats();
+
   void SetFullVRAMDirtyRectangle();
   void ClearVRAMDirtyRectangle();
   void IncludeVRAMDirtyRectangle(const Common::Rectangle<u32>& rect);
@@ -202,6 +249,11 @@ private:
   /// Returns the number of mipmap levels used for adaptive smoothing.
   u32 GetAdaptiveDownsamplingMipLevels() const;
 
+  /// Replaces stale field lines in the woven display texture with a vertical interpolation when
+  /// the surrounding lines moved between the last two composites. Returns false when the pass
+  /// could not run (pipeline/texture allocation failure), leaving the weave output in place.
+  bool ApplyMotionAdaptiveDeinterlace(u32 width, u32 height, u32 field_offset);
+
   void DownsampleFramebuffer(GPUTexture* source, u32 left, u32 top, u32 width, u32 height);
   void DownsampleFramebufferAdaptive(GPUTexture* source, u32 left, u32 top, u32 width, u32 height);
   void DownsampleFramebufferBoxFilter(GPUTexture* source, u32 left, u32 top, u32 width, u32 height);
@@ -210,7 +262,6 @@ private:
   std::unique_ptr<GPUTexture> m_vram_depth_texture;
   std::unique_ptr<GPUTexture> m_vram_read_texture;
   std::unique_ptr<GPUTexture> m_vram_readback_texture;
-  std::unique_ptr<GPUTexture> m_vram_replacement_texture;
   std::unique_ptr<GPUTexture> m_display_private_texture; // TODO: Move to base.
 
   std::unique_ptr<GPUTextureBuffer> m_vram_upload_buffer;
@@ -230,6 +281,11 @@ private:
   u32 m_resolution_scale = 1;
   u32 m_multisamples = 1;
 
+  /// Upper bound applied by dynamic resolution scaling, 0 when no cap is active. The trend
+  /// counter tracks consecutive over/under-budget update periods for hysteresis.
+  u32 m_dynamic_resolution_scale = 0;
+  s32 m_dynamic_resolution_trend = 0;
+
   union
   {
     BitField<u8, bool, 0, 1> m_supports_dual_source_blend;
@@ -238,6 +294,7 @@ private:
     BitField<u8, bool, 3, 1> m_scaled_dithering;
     BitField<u8, bool, 4, 1> m_chroma_smoothing;
     BitField<u8, bool, 5, 1> m_disable_color_perspective;
+    BitField<u8, bool, 6, 1> m_motion_adaptive_deinterlacing;
 
     u8 bits = 0;
   };
@@ -257,14 +314,96 @@ private:
   bool m_batch_ubo_dirty = true;
   BatchUBOData m_batch_ubo_data = {};
 
+  // Accumulated streaming-buffer telemetry (see AccumulateStreamBufferStats()).
+  GPUDevice::StreamBufferStats m_stream_buffer_stats = {};
+  u32 m_stream_buffer_stats_frames = 0;
+
+  // Tile-granular refinement of m_vram_dirty_rect (32x32 pixel tiles, one u32 column mask per
+  // row). The bounding rectangle remains authoritative for what gets copied out (read texture,
+  // snapshots), but intersection tests against it degenerate once writes land in opposite
+  // corners of VRAM - everything in between reads as dirty. The bitmap answers whether a sampled
+  // region truly overlaps a written one, so sprite-heavy titles that interleave uploads and
+  // draws don't break the batch on every upload.
+  struct VRAMDirtyBitmap
+  {
+    static constexpr u32 TILE_SHIFT = 5;
+    static constexpr u32 NUM_COLUMNS = VRAM_WIDTH >> TILE_SHIFT;
+    static constexpr u32 NUM_ROWS = VRAM_HEIGHT >> TILE_SHIFT;
+
+    std::array<u32, NUM_ROWS> rows = {};
+
+    ALWAYS_INLINE void Clear() { rows.fill(0u); }
+    ALWAYS_INLINE void SetAll() { rows.fill(0xFFFFFFFFu); }
+
+    // Coordinates follow Common::Rectangle - right/bottom exclusive. Out-of-range coordinates
+    // (e.g. UV ranges for pages hanging off the right edge of VRAM) are clamped to the last tile.
+    ALWAYS_INLINE static u32 GetColumnMask(u32 left, u32 right)
+    {
+      const u32 first_column = std::min(left >> TILE_SHIFT, NUM_COLUMNS - 1);
+      const u32 last_column = std::min((right - 1) >> TILE_SHIFT, NUM_COLUMNS - 1);
+      return (0xFFFFFFFFu >> (31 - last_column)) & (0xFFFFFFFFu << first_column);
+    }
+
+    void Include(u32 left, u32 right, u32 top, u32 bottom)
+    {
+      const u32 mask = GetColumnMask(left, right);
+      const u32 first_row = std::min(top >> TILE_SHIFT, NUM_ROWS - 1);
+      const u32 last_row = std::min((bottom - 1) >> TILE_SHIFT, NUM_ROWS - 1);
+      for (u32 i = first_row; i <= last_row; i++)
+        rows[i] |= mask;
+    }
+
+    ALWAYS_INLINE void Include(const Common::Rectangle<u32>& rect)
+    {
+      Include(rect.left, rect.right, rect.top, rect.bottom);
+    }
+
+    bool Intersects(const Common::Rectangle<u32>& rect) const
+    {
+      if (!rect.Valid())
+        return false;
+
+      const u32 mask = GetColumnMask(rect.left, rect.right);
+      const u32 first_row = std::min(rect.top >> TILE_SHIFT, NUM_ROWS - 1);
+      const u32 last_row = std::min((rect.bottom - 1) >> TILE_SHIFT, NUM_ROWS - 1);
+      for (u32 i = first_row; i <= last_row; i++)
+      {
+        if (rows[i] & mask)
+          return true;
+      }
+
+      return false;
+    }
+  };
+
   // Bounding box of VRAM area that the GPU has drawn into.
   Common::Rectangle<u32> m_vram_dirty_rect;
+  VRAMDirtyBitmap m_vram_dirty_bitmap;
+
+  // Bounding box of VRAM that has changed since it was last downloaded into m_vram_shadow.
+  Common::Rectangle<u32> m_vram_shadow_dirty_rect;
+
+  // Subset of m_vram_dirty_rect covering only GPU-side modifications (draws/fills/copies). CPU
+  // uploads are mirrored into m_vram_shadow, so they don't invalidate it.
+  Common::Rectangle<u32> m_vram_draw_dirty_rect;
+
+  // Bounding box of VRAM that has changed since the last snapshot copy (rewind/runahead).
+  Common::Rectangle<u32> m_vram_snapshot_dirty_rect;
   Common::Rectangle<u32> m_current_uv_range;
 
+  // Per-snapshot dirty regions, keyed by snapshot id, so a recycled snapshot texture only needs
+  // the area modified since it was last written instead of a full VRAM copy.
+  std::deque<std::pair<u64, Common::Rectangle<u32>>> m_vram_snapshot_history;
+  u64 m_vram_snapshot_next_id = 1;
+  u64 m_vram_snapshot_lineage_id = 0;
+
   // [depth_test][render_mode][texture_mode][transparency_mode][dithering][interlacing]
   DimensionalArray<std::unique_ptr<GPUPipeline>, 2, 2, 5, 9, 4, 3> m_batch_pipelines{};
   std::unique_ptr<GPUPipeline> m_wireframe_pipeline;
 
+  // Set while a settings change has batch pipelines compiling in the background.
+  std::unique_ptr<BatchPipelineCompile> m_background_pipeline_compile;
+
   // [wrapped][interlaced]
   DimensionalArray<std::unique_ptr<GPUPipeline>, 2, 2> m_vram_fill_pipelines{};
 
@@ -281,6 +420,10 @@ private:
   // TODO: get rid of this, and use image blits instead where supported
   std::unique_ptr<GPUPipeline> m_copy_pipeline;
 
+  std::unique_ptr<GPUPipeline> m_deinterlace_pipeline;
+  std::unique_ptr<GPUTexture> m_deinterlace_texture;
+  std::unique_ptr<GPUTexture> m_deinterlace_history_texture;
+
   std::unique_ptr<GPUTexture> m_downsample_texture;
   std::unique_ptr<GPUPipeline> m_downsample_first_pass_pipeline;
   std::unique_ptr<GPUPipeline> m_downsample_mid_pass_pipeline;
@@ -290,6 +433,19 @@ private:
   std::unique_ptr<GPUSampler> m_downsample_composite_sampler;
   u32 m_downsample_scale_or_levels = 0;
 
+  // Cached downsample output, so re-displaying an unchanged source region (static menus) skips
+  // the resolve chain. The dirty rect accumulates VRAM changes since the last resolve.
+  Common::Rectangle<u32> m_downsample_dirty_rect;
+  GPUTexture* m_downsample_display_texture = nullptr;
+  u32 m_downsample_source_left = 0;
+  u32 m_downsample_source_top = 0;
+  u32 m_downsample_source_width = 0;
+  u32 m_downsample_source_height = 0;
+  s32 m_downsample_display_view_x = 0;
+  s32 m_downsample_display_view_y = 0;
+  s32 m_downsample_display_view_width = 0;
+  s32 m_downsample_display_view_height = 0;
+
   // Statistics
   RendererStats m_renderer_stats = {};
   RendererStats m_last_renderer_stats = {};
@@ -1122,6 +1122,46 @@ float3 SampleVRAM24Smoothed(uint2 icoords)
   return ss.str();
 }
 
+std::string GPU_HW_ShaderGen::GenerateMotionAdaptiveDeinterlaceFragmentShader()
+{
+  std::stringstream ss;
+  WriteHeader(ss);
+  WriteCommonFunctions(ss);
+  DeclareUniformBuffer(ss, {"uint u_field_offset", "uint u_height", "uint2 u_pad"}, true);
+  DeclareTexture(ss, "samp0", 0, false);
+  DeclareTexture(ss, "samp1", 1, false);
+
+  ss << "CONSTANT float MOTION_THRESHOLD = 10.0 / 255.0;\n";
+
+  DeclareFragmentEntryPoint(ss, 0, 1, {}, true, 1);
+  ss << R"(
+{
+  int2 icoords = int2(v_pos.xy);
+  float4 woven = LOAD_TEXTURE(samp0, icoords, 0);
+  if ((uint(icoords.y) & 1u) == u_field_offset)
+  {
+    // line belongs to the field scanned out this frame
+    o_col0 = woven;
+  }
+  else
+  {
+    // stale line carried over from the previous field: keep the weave when the surrounding lines
+    // are unchanged between the last two composites, interpolate vertically (bob) when they moved
+    int2 above = int2(icoords.x, max(icoords.y - 1, 0));
+    int2 below = int2(icoords.x, min(icoords.y + 1, int(u_height) - 1));
+    float3 ca = LOAD_TEXTURE(samp0, above, 0).rgb;
+    float3 cb = LOAD_TEXTURE(samp0, below, 0).rgb;
+    float3 pa = LOAD_TEXTURE(samp1, above, 0).rgb;
+    float3 pb = LOAD_TEXTURE(samp1, below, 0).rgb;
+    float motion = dot(abs(ca - pa) + abs(cb - pb), float3(1.0 / 6.0, 1.0 / 6.0, 1.0 / 6.0));
+    o_col0 = (motion > MOTION_THRESHOLD) ? float4((ca + cb) * 0.5, 1.0) : woven;
+  }
+}
+)";
+
+  return ss.str();
+}
+
 std::string GPU_HW_ShaderGen::GenerateWireframeGeometryShader()
 {
   std::stringstream ss;
@@ -17,6 +17,7 @@ public:
   std::string GenerateBatchVertexShader(bool textured);
   std::string GenerateBatchFragmentShader(GPU_HW::BatchRenderMode render_mode, GPUTransparencyMode transparency,
                                           GPUTextureMode texture_mode, bool dithering, bool interlacing);
+  std::string GenerateMotionAdaptiveDeinterlaceFragmentShader();
   std::string GenerateDisplayFragmentShader(bool depth_24bit, GPU_HW::InterlacedRenderMode interlace_mode,
                                             bool smooth_chroma);
   std::string GenerateWireframeGeometryShader();
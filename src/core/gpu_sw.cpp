@@ -74,10 +74,10 @@ bool GPU_SW::Initialize()
   return true;
 }
 
-bool GPU_SW::DoState(StateWrapper& sw, GPUTexture** host_texture, bool update_display)
+bool GPU_SW::DoState(StateWrapper& sw, GPUTexture** host_texture, u64* host_texture_id, bool update_display)
 {
   // ignore the host texture for software mode, since we want to save vram here
-  return GPU::DoState(sw, nullptr, update_display);
+  return GPU::DoState(sw, nullptr, nullptr, update_display);
 }
 
 void GPU_SW::Reset(bool clear_vram)
@@ -231,14 +231,99 @@ ALWAYS_INLINE void CopyOutRow16<GPUTexture::Format::RGB565, u16>(const u16* src_
 template<>
 ALWAYS_INLINE void CopyOutRow16<GPUTexture::Format::RGBA8, u32>(const u16* src_ptr, u32* dst_ptr, u32 width)
 {
-  for (u32 col = 0; col < width; col++)
+  u32 col = 0;
+
+#if defined(CPU_ARCH_SSE)
+  const u32 aligned_width = Common::AlignDownPow2(width, 8);
+  const __m128i single_mask = _mm_set1_epi16(0x1F);
+  for (; col < aligned_width; col += 8)
+  {
+    const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src_ptr));
+    src_ptr += 8;
+    const __m128i r = _mm_slli_epi16(_mm_and_si128(value, single_mask), 3);
+    const __m128i g = _mm_slli_epi16(_mm_and_si128(_mm_srli_epi16(value, 5), single_mask), 3);
+    const __m128i b = _mm_slli_epi16(_mm_and_si128(_mm_srli_epi16(value, 10), single_mask), 3);
+    const __m128i a = _mm_and_si128(_mm_srai_epi16(value, 15), _mm_set1_epi16(static_cast<s16>(static_cast<u16>(0xFF00))));
+
+    // Assemble (r,g) and (b,a) byte pairs in 16-bit lanes, then interleave to RGBA bytes.
+    const __m128i rg = _mm_or_si128(r, _mm_slli_epi16(g, 8));
+    const __m128i ba = _mm_or_si128(b, a);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst_ptr), _mm_unpacklo_epi16(rg, ba));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst_ptr + 4), _mm_unpackhi_epi16(rg, ba));
+    dst_ptr += 8;
+  }
+#elif defined(CPU_ARCH_NEON)
+  const u32 aligned_width = Common::AlignDownPow2(width, 8);
+  const uint16x8_t single_mask = vdupq_n_u16(0x1F);
+  for (; col < aligned_width; col += 8)
+  {
+    const uint16x8_t value = vld1q_u16(src_ptr);
+    src_ptr += 8;
+    const uint16x8_t r = vshlq_n_u16(vandq_u16(value, single_mask), 3);
+    const uint16x8_t g = vshlq_n_u16(vandq_u16(vshrq_n_u16(value, 5), single_mask), 3);
+    const uint16x8_t b = vshlq_n_u16(vandq_u16(vshrq_n_u16(value, 10), single_mask), 3);
+    const uint16x8_t a =
+      vandq_u16(vreinterpretq_u16_s16(vshrq_n_s16(vreinterpretq_s16_u16(value), 15)), vdupq_n_u16(0xFF00));
+
+    // Assemble (r,g) and (b,a) byte pairs in 16-bit lanes, then interleave to RGBA bytes.
+    const uint16x8_t rg = vorrq_u16(r, vshlq_n_u16(g, 8));
+    const uint16x8_t ba = vorrq_u16(b, a);
+    const uint16x8x2_t interleaved = vzipq_u16(rg, ba);
+    vst1q_u32(dst_ptr, vreinterpretq_u32_u16(interleaved.val[0]));
+    vst1q_u32(dst_ptr + 4, vreinterpretq_u32_u16(interleaved.val[1]));
+    dst_ptr += 8;
+  }
+#endif
+
+  for (; col < width; col++)
     *(dst_ptr++) = VRAM16ToOutput<GPUTexture::Format::RGBA8, u32>(*(src_ptr++));
 }
 
 template<>
 ALWAYS_INLINE void CopyOutRow16<GPUTexture::Format::BGRA8, u32>(const u16* src_ptr, u32* dst_ptr, u32 width)
 {
-  for (u32 col = 0; col < width; col++)
+  u32 col = 0;
+
+#if defined(CPU_ARCH_SSE)
+  const u32 aligned_width = Common::AlignDownPow2(width, 8);
+  const __m128i single_mask = _mm_set1_epi16(0x1F);
+  for (; col < aligned_width; col += 8)
+  {
+    const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src_ptr));
+    src_ptr += 8;
+    const __m128i r = _mm_slli_epi16(_mm_and_si128(value, single_mask), 3);
+    const __m128i g = _mm_slli_epi16(_mm_and_si128(_mm_srli_epi16(value, 5), single_mask), 3);
+    const __m128i b = _mm_slli_epi16(_mm_and_si128(_mm_srli_epi16(value, 10), single_mask), 3);
+
+    // Assemble (b,g) and (r,0xFF) byte pairs in 16-bit lanes, then interleave to BGRA bytes.
+    const __m128i bg = _mm_or_si128(b, _mm_slli_epi16(g, 8));
+    const __m128i ra = _mm_or_si128(r, _mm_set1_epi16(static_cast<s16>(static_cast<u16>(0xFF00))));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst_ptr), _mm_unpacklo_epi16(bg, ra));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst_ptr + 4), _mm_unpackhi_epi16(bg, ra));
+    dst_ptr += 8;
+  }
+#elif defined(CPU_ARCH_NEON)
+  const u32 aligned_width = Common::AlignDownPow2(width, 8);
+  const uint16x8_t single_mask = vdupq_n_u16(0x1F);
+  for (; col < aligned_width; col += 8)
+  {
+    const uint16x8_t value = vld1q_u16(src_ptr);
+    src_ptr += 8;
+    const uint16x8_t r = vshlq_n_u16(vandq_u16(value, single_mask), 3);
+    const uint16x8_t g = vshlq_n_u16(vandq_u16(vshrq_n_u16(value, 5), single_mask), 3);
+    const uint16x8_t b = vshlq_n_u16(vandq_u16(vshrq_n_u16(value, 10), single_mask), 3);
+
+    // Assemble (b,g) and (r,0xFF) byte pairs in 16-bit lanes, then interleave to BGRA bytes.
+    const uint16x8_t bg = vorrq_u16(b, vshlq_n_u16(g, 8));
+    const uint16x8_t ra = vorrq_u16(r, vdupq_n_u16(0xFF00));
+    const uint16x8x2_t interleaved = vzipq_u16(bg, ra);
+    vst1q_u32(dst_ptr, vreinterpretq_u32_u16(interleaved.val[0]));
+    vst1q_u32(dst_ptr + 4, vreinterpretq_u32_u16(interleaved.val[1]));
+    dst_ptr += 8;
+  }
+#endif
+
+  for (; col < width; col++)
     *(dst_ptr++) = VRAM16ToOutput<GPUTexture::Format::BGRA8, u32>(*(src_ptr++));
 }
 
@@ -327,6 +412,28 @@ void GPU_SW::CopyOut15Bit(GPUTexture::Format display_format, u32 src_x, u32 src_
   }
 }
 
+#if defined(CPU_ARCH_SSE)
+
+/// Expands the low 12 bytes (four packed RGB888 pixels) to four 32-bit lanes of R|G<<8|B<<16.
+ALWAYS_INLINE static __m128i UnpackRGB24ToRGBX32(const __m128i value)
+{
+  return _mm_or_si128(
+    _mm_or_si128(_mm_and_si128(value, _mm_set_epi32(0, 0, 0, 0x00FFFFFF)),
+                 _mm_and_si128(_mm_slli_si128(value, 1), _mm_set_epi32(0, 0, 0x00FFFFFF, 0))),
+    _mm_or_si128(_mm_and_si128(_mm_slli_si128(value, 2), _mm_set_epi32(0, 0x00FFFFFF, 0, 0)),
+                 _mm_and_si128(_mm_slli_si128(value, 3), _mm_set_epi32(0x00FFFFFF, 0, 0, 0))));
+}
+
+/// Swaps the first and third byte of each 32-bit lane, clearing the fourth.
+ALWAYS_INLINE static __m128i SwapRGBX32RedBlue(const __m128i value)
+{
+  return _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_slli_epi32(value, 16), _mm_set1_epi32(0x00FF0000)),
+                                   _mm_and_si128(value, _mm_set1_epi32(0x0000FF00))),
+                      _mm_and_si128(_mm_srli_epi32(value, 16), _mm_set1_epi32(0x000000FF)));
+}
+
+#endif
+
 template<GPUTexture::Format display_format>
 void GPU_SW::CopyOut24Bit(u32 src_x, u32 src_y, u32 skip_x, u32 width, u32 height, u32 field, bool interlaced,
                           bool interleaved)
@@ -360,7 +467,35 @@ void GPU_SW::CopyOut24Bit(u32 src_x, u32 src_y, u32 skip_x, u32 width, u32 heigh
       {
         const u8* src_row_ptr = src_ptr;
         u8* dst_row_ptr = reinterpret_cast<u8*>(dst_ptr);
-        for (u32 col = 0; col < width; col++)
+        u32 col = 0;
+
+#if defined(CPU_ARCH_SSE)
+        // Two overlapping 16-byte loads cover 8 pixels (24 bytes) without reading past the row.
+        const u32 aligned_width = Common::AlignDownPow2(width, 8);
+        const __m128i alpha = _mm_set1_epi32(static_cast<s32>(0xFF000000u));
+        for (; col < aligned_width; col += 8)
+        {
+          const __m128i v0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src_row_ptr));
+          const __m128i v1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src_row_ptr + 8));
+          src_row_ptr += 24;
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(dst_row_ptr), _mm_or_si128(UnpackRGB24ToRGBX32(v0), alpha));
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(dst_row_ptr + 16),
+                           _mm_or_si128(UnpackRGB24ToRGBX32(_mm_srli_si128(v1, 4)), alpha));
+          dst_row_ptr += 32;
+        }
+#elif defined(CPU_ARCH_NEON)
+        const u32 aligned_width = Common::AlignDownPow2(width, 16);
+        for (; col < aligned_width; col += 16)
+        {
+          const uint8x16x3_t rgb = vld3q_u8(src_row_ptr);
+          src_row_ptr += 48;
+          const uint8x16x4_t rgba = {rgb.val[0], rgb.val[1], rgb.val[2], vdupq_n_u8(0xFF)};
+          vst4q_u8(dst_row_ptr, rgba);
+          dst_row_ptr += 64;
+        }
+#endif
+
+        for (; col < width; col++)
         {
           *(dst_row_ptr++) = *(src_row_ptr++);
           *(dst_row_ptr++) = *(src_row_ptr++);
@@ -372,7 +507,36 @@ void GPU_SW::CopyOut24Bit(u32 src_x, u32 src_y, u32 skip_x, u32 width, u32 heigh
       {
         const u8* src_row_ptr = src_ptr;
         u8* dst_row_ptr = reinterpret_cast<u8*>(dst_ptr);
-        for (u32 col = 0; col < width; col++)
+        u32 col = 0;
+
+#if defined(CPU_ARCH_SSE)
+        // Two overlapping 16-byte loads cover 8 pixels (24 bytes) without reading past the row.
+        const u32 aligned_width = Common::AlignDownPow2(width, 8);
+        const __m128i alpha = _mm_set1_epi32(static_cast<s32>(0xFF000000u));
+        for (; col < aligned_width; col += 8)
+        {
+          const __m128i v0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src_row_ptr));
+          const __m128i v1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src_row_ptr + 8));
+          src_row_ptr += 24;
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(dst_row_ptr),
+                           _mm_or_si128(SwapRGBX32RedBlue(UnpackRGB24ToRGBX32(v0)), alpha));
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(dst_row_ptr + 16),
+                           _mm_or_si128(SwapRGBX32RedBlue(UnpackRGB24ToRGBX32(_mm_srli_si128(v1, 4))), alpha));
+          dst_row_ptr += 32;
+        }
+#elif defined(CPU_ARCH_NEON)
+        const u32 aligned_width = Common::AlignDownPow2(width, 16);
+        for (; col < aligned_width; col += 16)
+        {
+          const uint8x16x3_t rgb = vld3q_u8(src_row_ptr);
+          src_row_ptr += 48;
+          const uint8x16x4_t bgra = {rgb.val[2], rgb.val[1], rgb.val[0], vdupq_n_u8(0xFF)};
+          vst4q_u8(dst_row_ptr, bgra);
+          dst_row_ptr += 64;
+        }
+#endif
+
+        for (; col < width; col++)
         {
           *(dst_row_ptr++) = src_row_ptr[2];
           *(dst_row_ptr++) = src_row_ptr[1];
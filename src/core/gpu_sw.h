@@ -31,7 +31,7 @@ public:
   bool IsHardwareRenderer() const override;
 
   bool Initialize() override;
-  bool DoState(StateWrapper& sw, GPUTexture** host_texture, bool update_display) override;
+  bool DoState(StateWrapper& sw, GPUTexture** host_texture, u64* host_texture_id, bool update_display) override;
   void Reset(bool clear_vram) override;
   void UpdateSettings(const Settings& old_settings) override;
 
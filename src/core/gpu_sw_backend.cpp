@@ -2,23 +2,184 @@
 // SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
 
 #include "gpu_sw_backend.h"
+#include "settings.h"
 #include "system.h"
 
 #include "util/gpu_device.h"
 
+#include "common/intrin.h"
+#include "common/threading.h"
+
 #include <algorithm>
 
+// Rows outside this range are skipped by the scanline loops. The defaults cover all of VRAM, so
+// serial draws behave as before; rasterizer threads narrow it to their band for the duration of a
+// job, which keeps writes from concurrent threads on disjoint rows.
+static thread_local s32 s_raster_band_top = 0;
+static thread_local s32 s_raster_band_bottom = static_cast<s32>(VRAM_HEIGHT - 1);
+
 GPU_SW_Backend::GPU_SW_Backend() : GPUBackend()
 {
   m_vram.fill(0);
   m_vram_ptr = m_vram.data();
 }
 
-GPU_SW_Backend::~GPU_SW_Backend() = default;
+GPU_SW_Backend::~GPU_SW_Backend()
+{
+  StopRasterThreads();
+}
 
 bool GPU_SW_Backend::Initialize(bool force_thread)
 {
-  return GPUBackend::Initialize(force_thread);
+  if (!GPUBackend::Initialize(force_thread))
+    return false;
+
+  StartRasterThreads();
+  return true;
+}
+
+void GPU_SW_Backend::StartRasterThreads()
+{
+  if (!m_raster_threads.empty())
+    return;
+
+  // Leave a couple of cores for the CPU and GPU threads.
+  const u32 cpu_count = std::thread::hardware_concurrency();
+  const u32 num_threads = std::min<u32>((cpu_count >= 3) ? (cpu_count - 2) : 0, MAX_RASTER_THREADS);
+  if (num_threads == 0)
+    return;
+
+  m_raster_threads.reserve(num_threads);
+  for (u32 i = 0; i < num_threads; i++)
+    m_raster_threads.emplace_back(&GPU_SW_Backend::RasterThreadEntryPoint, this, i);
+}
+
+void GPU_SW_Backend::StopRasterThreads()
+{
+  if (m_raster_threads.empty())
+    return;
+
+  {
+    std::unique_lock lock(m_raster_mutex);
+    m_raster_shutdown = true;
+    m_raster_start_cv.notify_all();
+  }
+
+  for (std::thread& thread : m_raster_threads)
+    thread.join();
+  m_raster_threads.clear();
+  m_raster_shutdown = false;
+}
+
+void GPU_SW_Backend::RasterThreadEntryPoint(u32 index)
+{
+  Threading::SetNameOfCurrentThread("SW Rasterizer");
+
+  u32 last_generation = 0;
+  for (;;)
+  {
+    RasterJob job;
+    {
+      std::unique_lock lock(m_raster_mutex);
+      m_raster_start_cv.wait(
+        lock, [this, last_generation]() { return (m_raster_shutdown || m_raster_generation != last_generation); });
+      if (m_raster_shutdown)
+        break;
+
+      last_generation = m_raster_generation;
+      job = m_raster_job;
+      s_raster_band_top = m_raster_job_min_y + static_cast<s32>(index) * m_raster_job_band_height;
+      s_raster_band_bottom = std::min(s_raster_band_top + m_raster_job_band_height - 1, m_raster_job_max_y);
+    }
+
+    if (s_raster_band_top <= s_raster_band_bottom)
+      ExecuteRasterJob(job);
+
+    {
+      std::unique_lock lock(m_raster_mutex);
+      if ((--m_raster_pending) == 0)
+        m_raster_done_cv.notify_one();
+    }
+  }
+}
+
+void GPU_SW_Backend::ExecuteRasterJob(const RasterJob& job)
+{
+  if (job.is_triangle)
+    (this->*job.triangle.func)(job.triangle.cmd, job.triangle.v0, job.triangle.v1, job.triangle.v2);
+  else
+    (this->*job.rectangle.func)(job.rectangle.cmd);
+}
+
+// A parallel draw is only safe when no band reads rows another band is writing. Writes are
+// disjoint by construction, but texture and CLUT fetches read arbitrary VRAM rows, so draws whose
+// texture source overlaps the destination rows (framebuffer-feedback quads, blur effects) have to
+// take the serial path to keep the top-down span ordering, and with it deterministic output.
+static bool TextureReadsOverlapRows(const GPUBackendDrawCommand* cmd, s32 min_y, s32 max_y)
+{
+  if (!GPURenderCommand{cmd->rc.bits}.texture_enable)
+    return false;
+
+  // The window clamps texcoords to [or_y, and_y | or_y] within the page, so the fetch can't wrap.
+  const s32 page_base_y = static_cast<s32>(cmd->draw_mode.GetTexturePageBaseY());
+  const s32 tex_min_y = page_base_y + static_cast<s32>(cmd->window.or_y);
+  const s32 tex_max_y = page_base_y + static_cast<s32>(cmd->window.and_y | cmd->window.or_y);
+  if (tex_min_y <= max_y && tex_max_y >= min_y)
+    return true;
+
+  if (cmd->draw_mode.IsUsingPalette())
+  {
+    const s32 clut_y = static_cast<s32>(cmd->palette.GetYBase());
+    if (clut_y >= min_y && clut_y <= max_y)
+      return true;
+  }
+
+  return false;
+}
+
+bool GPU_SW_Backend::DispatchParallelDraw(const RasterJob& job, s32 min_y, s32 max_y)
+{
+  min_y = std::max(min_y, static_cast<s32>(m_drawing_area.top));
+  max_y = std::min(max_y, static_cast<s32>(m_drawing_area.bottom));
+  if (!g_settings.gpu_sw_parallel_rasterization || m_raster_threads.empty() ||
+      (max_y - min_y + 1) < static_cast<s32>(MIN_PARALLEL_DRAW_HEIGHT))
+  {
+    return false;
+  }
+
+  const GPUBackendDrawCommand* cmd = job.is_triangle ? static_cast<const GPUBackendDrawCommand*>(job.triangle.cmd) :
+                                                       static_cast<const GPUBackendDrawCommand*>(job.rectangle.cmd);
+  if (TextureReadsOverlapRows(cmd, min_y, max_y))
+    return false;
+
+  const u32 num_participants = static_cast<u32>(m_raster_threads.size()) + 1;
+  const s32 band_height = (max_y - min_y + static_cast<s32>(num_participants)) / static_cast<s32>(num_participants);
+
+  {
+    std::unique_lock lock(m_raster_mutex);
+    m_raster_job = job;
+    m_raster_job_min_y = min_y;
+    m_raster_job_max_y = max_y;
+    m_raster_job_band_height = band_height;
+    m_raster_pending = static_cast<u32>(m_raster_threads.size());
+    m_raster_generation++;
+    m_raster_start_cv.notify_all();
+  }
+
+  // This thread takes the last band, then waits for the workers to finish theirs.
+  s_raster_band_top = min_y + static_cast<s32>(m_raster_threads.size()) * band_height;
+  s_raster_band_bottom = max_y;
+  if (s_raster_band_top <= s_raster_band_bottom)
+    ExecuteRasterJob(job);
+  s_raster_band_top = 0;
+  s_raster_band_bottom = static_cast<s32>(VRAM_HEIGHT - 1);
+
+  {
+    std::unique_lock lock(m_raster_mutex);
+    m_raster_done_cv.wait(lock, [this]() { return (m_raster_pending == 0); });
+  }
+
+  return true;
 }
 
 void GPU_SW_Backend::Reset(bool clear_vram)
@@ -37,9 +198,29 @@ void GPU_SW_Backend::DrawPolygon(const GPUBackendDrawPolygonCommand* cmd)
   const DrawTriangleFunction DrawFunction = GetDrawTriangleFunction(
     rc.shading_enable, rc.texture_enable, rc.raw_texture_enable, rc.transparency_enable, dithering_enable);
 
-  (this->*DrawFunction)(cmd, &cmd->vertices[0], &cmd->vertices[1], &cmd->vertices[2]);
+  RasterJob job;
+  job.is_triangle = true;
+  job.triangle.func = DrawFunction;
+  job.triangle.cmd = cmd;
+  job.triangle.v0 = &cmd->vertices[0];
+  job.triangle.v1 = &cmd->vertices[1];
+  job.triangle.v2 = &cmd->vertices[2];
+  if (!DispatchParallelDraw(job, std::min({job.triangle.v0->y, job.triangle.v1->y, job.triangle.v2->y}),
+                            std::max({job.triangle.v0->y, job.triangle.v1->y, job.triangle.v2->y})))
+  {
+    (this->*DrawFunction)(cmd, &cmd->vertices[0], &cmd->vertices[1], &cmd->vertices[2]);
+  }
+
   if (rc.quad_polygon)
-    (this->*DrawFunction)(cmd, &cmd->vertices[2], &cmd->vertices[1], &cmd->vertices[3]);
+  {
+    job.triangle.v0 = &cmd->vertices[2];
+    job.triangle.v2 = &cmd->vertices[3];
+    if (!DispatchParallelDraw(job, std::min({job.triangle.v0->y, job.triangle.v1->y, job.triangle.v2->y}),
+                              std::max({job.triangle.v0->y, job.triangle.v1->y, job.triangle.v2->y})))
+    {
+      (this->*DrawFunction)(cmd, &cmd->vertices[2], &cmd->vertices[1], &cmd->vertices[3]);
+    }
+  }
 }
 
 void GPU_SW_Backend::DrawRectangle(const GPUBackendDrawRectangleCommand* cmd)
@@ -49,7 +230,12 @@ void GPU_SW_Backend::DrawRectangle(const GPUBackendDrawRectangleCommand* cmd)
   const DrawRectangleFunction DrawFunction =
     GetDrawRectangleFunction(rc.texture_enable, rc.raw_texture_enable, rc.transparency_enable);
 
-  (this->*DrawFunction)(cmd);
+  RasterJob job;
+  job.is_triangle = false;
+  job.rectangle.func = DrawFunction;
+  job.rectangle.cmd = cmd;
+  if (!DispatchParallelDraw(job, cmd->y, cmd->y + static_cast<s32>(cmd->height) - 1))
+    (this->*DrawFunction)(cmd);
 }
 
 void GPU_SW_Backend::DrawLine(const GPUBackendDrawLineCommand* cmd)
@@ -235,6 +421,7 @@ void GPU_SW_Backend::DrawRectangle(const GPUBackendDrawRectangleCommand* cmd)
   {
     const s32 y = origin_y + static_cast<s32>(offset_y);
     if (y < static_cast<s32>(m_drawing_area.top) || y > static_cast<s32>(m_drawing_area.bottom) ||
+        y < s_raster_band_top || y > s_raster_band_bottom ||
         (cmd->params.interlaced_rendering && cmd->params.active_line_lsb == (Truncate8(static_cast<u32>(y)) & 1u)))
     {
       continue;
@@ -367,6 +554,9 @@ template<bool shading_enable, bool texture_enable, bool raw_texture_enable, bool
 void GPU_SW_Backend::DrawSpan(const GPUBackendDrawPolygonCommand* cmd, s32 y, s32 x_start, s32 x_bound, i_group ig,
                               const i_deltas& idl)
 {
+  if (y < s_raster_band_top || y > s_raster_band_bottom)
+    return;
+
   if (cmd->params.interlaced_rendering && cmd->params.active_line_lsb == (Truncate8(static_cast<u32>(y)) & 1u))
     return;
 
@@ -391,6 +581,130 @@ void GPU_SW_Backend::DrawSpan(const GPUBackendDrawPolygonCommand* cmd, s32 y, s3
   AddIDeltas_DX<shading_enable, texture_enable>(ig, idl, x_ig_adjust);
   AddIDeltas_DY<shading_enable, texture_enable>(ig, idl, y);
 
+#if defined(CPU_ARCH_SSE) || defined(CPU_ARCH_NEON)
+  // Untextured spans with no mask test write every pixel unconditionally from the interpolators,
+  // so they can be emitted eight at a time, including the dither offset/shift/clamp. Textured
+  // spans stay per-pixel below; the palette lookups and transparent-texel skips don't vectorize
+  // on SSE2-class hardware.
+  if constexpr (!texture_enable && !transparency_enable)
+  {
+    if (w >= 8 && cmd->params.GetMaskAND() == 0)
+    {
+      const u32 dr_dx = shading_enable ? idl.dr_dx : 0;
+      const u32 dg_dx = shading_enable ? idl.dg_dx : 0;
+      const u32 db_dx = shading_enable ? idl.db_dx : 0;
+      const u32 dither_row = dithering_enable ? (static_cast<u32>(y) & 3u) : 2u;
+
+      // The dither column repeats with the loop stride, so the offsets are loop-invariant.
+      alignas(16) s16 dither_values[8];
+      for (u32 i = 0; i < 8; i++)
+      {
+        dither_values[i] =
+          static_cast<s16>(DITHER_MATRIX[dither_row][dithering_enable ? ((static_cast<u32>(x) + i) & 3u) : 3u]);
+      }
+
+      alignas(16) u32 lane_values[12];
+      for (u32 i = 0; i < 4; i++)
+      {
+        lane_values[i + 0] = ig.r + dr_dx * i;
+        lane_values[i + 4] = ig.g + dg_dx * i;
+        lane_values[i + 8] = ig.b + db_dx * i;
+      }
+
+      u16* row_ptr = GetPixelPtr(static_cast<u32>(x), static_cast<u32>(y));
+      const u32 initial_w = static_cast<u32>(w);
+
+#ifdef CPU_ARCH_SSE
+      const __m128i r_step = _mm_set1_epi32(static_cast<s32>(dr_dx * 4));
+      const __m128i g_step = _mm_set1_epi32(static_cast<s32>(dg_dx * 4));
+      const __m128i b_step = _mm_set1_epi32(static_cast<s32>(db_dx * 4));
+      __m128i r_lo = _mm_load_si128(reinterpret_cast<const __m128i*>(&lane_values[0]));
+      __m128i g_lo = _mm_load_si128(reinterpret_cast<const __m128i*>(&lane_values[4]));
+      __m128i b_lo = _mm_load_si128(reinterpret_cast<const __m128i*>(&lane_values[8]));
+      const __m128i dither = _mm_load_si128(reinterpret_cast<const __m128i*>(dither_values));
+      const __m128i max_value = _mm_set1_epi16(31);
+      const __m128i mask_or = _mm_set1_epi16(static_cast<s16>(cmd->params.GetMaskOR()));
+
+      while (w >= 8)
+      {
+        const __m128i r_hi = _mm_add_epi32(r_lo, r_step);
+        const __m128i g_hi = _mm_add_epi32(g_lo, g_step);
+        const __m128i b_hi = _mm_add_epi32(b_lo, b_step);
+
+        __m128i r = _mm_packs_epi32(_mm_srli_epi32(r_lo, COORD_FBS + COORD_POST_PADDING),
+                                    _mm_srli_epi32(r_hi, COORD_FBS + COORD_POST_PADDING));
+        __m128i g = _mm_packs_epi32(_mm_srli_epi32(g_lo, COORD_FBS + COORD_POST_PADDING),
+                                    _mm_srli_epi32(g_hi, COORD_FBS + COORD_POST_PADDING));
+        __m128i b = _mm_packs_epi32(_mm_srli_epi32(b_lo, COORD_FBS + COORD_POST_PADDING),
+                                    _mm_srli_epi32(b_hi, COORD_FBS + COORD_POST_PADDING));
+
+        r = _mm_min_epi16(_mm_max_epi16(_mm_srai_epi16(_mm_add_epi16(r, dither), 3), _mm_setzero_si128()), max_value);
+        g = _mm_min_epi16(_mm_max_epi16(_mm_srai_epi16(_mm_add_epi16(g, dither), 3), _mm_setzero_si128()), max_value);
+        b = _mm_min_epi16(_mm_max_epi16(_mm_srai_epi16(_mm_add_epi16(b, dither), 3), _mm_setzero_si128()), max_value);
+
+        const __m128i pixels =
+          _mm_or_si128(_mm_or_si128(r, _mm_slli_epi16(g, 5)), _mm_or_si128(_mm_slli_epi16(b, 10), mask_or));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(row_ptr), pixels);
+
+        r_lo = _mm_add_epi32(r_hi, r_step);
+        g_lo = _mm_add_epi32(g_hi, g_step);
+        b_lo = _mm_add_epi32(b_hi, b_step);
+        row_ptr += 8;
+        x += 8;
+        w -= 8;
+      }
+#else // CPU_ARCH_NEON
+      const uint32x4_t r_step = vdupq_n_u32(dr_dx * 4);
+      const uint32x4_t g_step = vdupq_n_u32(dg_dx * 4);
+      const uint32x4_t b_step = vdupq_n_u32(db_dx * 4);
+      uint32x4_t r_lo = vld1q_u32(&lane_values[0]);
+      uint32x4_t g_lo = vld1q_u32(&lane_values[4]);
+      uint32x4_t b_lo = vld1q_u32(&lane_values[8]);
+      const int16x8_t dither = vld1q_s16(dither_values);
+      const int16x8_t max_value = vdupq_n_s16(31);
+      const uint16x8_t mask_or = vdupq_n_u16(cmd->params.GetMaskOR());
+
+      while (w >= 8)
+      {
+        const uint32x4_t r_hi = vaddq_u32(r_lo, r_step);
+        const uint32x4_t g_hi = vaddq_u32(g_lo, g_step);
+        const uint32x4_t b_hi = vaddq_u32(b_lo, b_step);
+
+        int16x8_t r = vreinterpretq_s16_u16(vcombine_u16(vmovn_u32(vshrq_n_u32(r_lo, COORD_FBS + COORD_POST_PADDING)),
+                                                         vmovn_u32(vshrq_n_u32(r_hi, COORD_FBS + COORD_POST_PADDING))));
+        int16x8_t g = vreinterpretq_s16_u16(vcombine_u16(vmovn_u32(vshrq_n_u32(g_lo, COORD_FBS + COORD_POST_PADDING)),
+                                                         vmovn_u32(vshrq_n_u32(g_hi, COORD_FBS + COORD_POST_PADDING))));
+        int16x8_t b = vreinterpretq_s16_u16(vcombine_u16(vmovn_u32(vshrq_n_u32(b_lo, COORD_FBS + COORD_POST_PADDING)),
+                                                         vmovn_u32(vshrq_n_u32(b_hi, COORD_FBS + COORD_POST_PADDING))));
+
+        r = vminq_s16(vmaxq_s16(vshrq_n_s16(vaddq_s16(r, dither), 3), vdupq_n_s16(0)), max_value);
+        g = vminq_s16(vmaxq_s16(vshrq_n_s16(vaddq_s16(g, dither), 3), vdupq_n_s16(0)), max_value);
+        b = vminq_s16(vmaxq_s16(vshrq_n_s16(vaddq_s16(b, dither), 3), vdupq_n_s16(0)), max_value);
+
+        const uint16x8_t pixels =
+          vorrq_u16(vorrq_u16(vreinterpretq_u16_s16(r), vshlq_n_u16(vreinterpretq_u16_s16(g), 5)),
+                    vorrq_u16(vshlq_n_u16(vreinterpretq_u16_s16(b), 10), mask_or));
+        vst1q_u16(row_ptr, pixels);
+
+        r_lo = vaddq_u32(r_hi, r_step);
+        g_lo = vaddq_u32(g_hi, g_step);
+        b_lo = vaddq_u32(b_hi, b_step);
+        row_ptr += 8;
+        x += 8;
+        w -= 8;
+      }
+#endif
+
+      if (w <= 0)
+        return;
+
+      // Step the scalar interpolators over the pixels the vector loop emitted, and let the
+      // per-pixel loop below handle the tail.
+      AddIDeltas_DX<shading_enable, texture_enable>(ig, idl, initial_w - static_cast<u32>(w));
+    }
+  }
+#endif
+
   do
   {
     const u32 r = ig.r >> (COORD_FBS + COORD_POST_PADDING);
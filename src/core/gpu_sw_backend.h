@@ -4,7 +4,10 @@
 #pragma once
 #include "gpu_backend.h"
 #include <array>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 class GPU_SW_Backend final : public GPUBackend
@@ -166,5 +169,60 @@ protected:
                                                     const GPUBackendDrawLineCommand::Vertex* p1);
   DrawLineFunction GetDrawLineFunction(bool shading_enable, bool transparency_enable, bool dithering_enable);
 
+  //////////////////////////////////////////////////////////////////////////
+  // Parallel rasterization
+  //////////////////////////////////////////////////////////////////////////
+  enum : u32
+  {
+    MAX_RASTER_THREADS = 7,
+
+    // Draws spanning fewer rows than this aren't worth the fork/join overhead.
+    MIN_PARALLEL_DRAW_HEIGHT = 64,
+  };
+
+  struct RasterJob
+  {
+    union
+    {
+      struct
+      {
+        DrawTriangleFunction func;
+        const GPUBackendDrawPolygonCommand* cmd;
+        const GPUBackendDrawPolygonCommand::Vertex* v0;
+        const GPUBackendDrawPolygonCommand::Vertex* v1;
+        const GPUBackendDrawPolygonCommand::Vertex* v2;
+      } triangle;
+      struct
+      {
+        DrawRectangleFunction func;
+        const GPUBackendDrawRectangleCommand* cmd;
+      } rectangle;
+    };
+    bool is_triangle;
+  };
+
+  void StartRasterThreads();
+  void StopRasterThreads();
+  void RasterThreadEntryPoint(u32 index);
+  void ExecuteRasterJob(const RasterJob& job);
+
+  /// Fans a draw covering rows [min_y, max_y] out across the rasterizer threads, each rasterizing
+  /// a disjoint horizontal band of VRAM rows, and joins before returning so command ordering is
+  /// preserved. Returns false if the draw is too small for parallelism to pay off. Note that a
+  /// draw which textures from the rows it is rendering to can observe other bands mid-draw.
+  bool DispatchParallelDraw(const RasterJob& job, s32 min_y, s32 max_y);
+
+  std::vector<std::thread> m_raster_threads;
+  std::mutex m_raster_mutex;
+  std::condition_variable m_raster_start_cv;
+  std::condition_variable m_raster_done_cv;
+  RasterJob m_raster_job = {};
+  s32 m_raster_job_min_y = 0;
+  s32 m_raster_job_max_y = 0;
+  s32 m_raster_job_band_height = 0;
+  u32 m_raster_generation = 0;
+  u32 m_raster_pending = 0;
+  bool m_raster_shutdown = false;
+
   std::array<u16, VRAM_WIDTH * VRAM_HEIGHT> m_vram;
 };
@@ -0,0 +1,250 @@
+// SPDX-FileCopyrightText: 2019-2023 Connor McLaughlin <stenzek@gmail.com>
+// SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
+
+#include "gpu.h"
+#include "system.h"
+
+#include "common/assert.h"
+#include "common/file_system.h"
+#include "common/log.h"
+#include "common/timer.h"
+
+#include <algorithm>
+#include <vector>
+
+Log_SetChannel(GPU);
+
+// Trace files are a compact binary stream of everything the GPU was fed: a header, a raw VRAM
+// snapshot taken when recording started, then a sequence of packets. Each packet is a u32 header
+// with the type in the low two bits and the payload word count in the remaining bits, followed by
+// the payload words. Replaying a trace pushes the packets back through the same DMA/GP1 paths the
+// game used, so a trace recorded on any renderer can be replayed against any other.
+
+namespace {
+enum : u32
+{
+  TRACE_MAGIC = 0x54475344, // 'DSGT'
+  TRACE_VERSION = 1,
+
+  PACKET_TYPE_GP0 = 0,
+  PACKET_TYPE_GP1 = 1,
+  PACKET_TYPE_VSYNC = 2,
+  PACKET_TYPE_MASK = 3,
+  PACKET_COUNT_SHIFT = 2,
+};
+
+struct TraceHeader
+{
+  u32 magic;
+  u32 version;
+};
+} // namespace
+
+bool GPU::StartTraceRecording(const char* filename)
+{
+  StopTraceRecording();
+
+  std::FILE* fp = FileSystem::OpenCFile(filename, "wb");
+  if (!fp)
+  {
+    Log_ErrorFmt("Failed to open '{}' for trace recording.", filename);
+    return false;
+  }
+
+  // Snapshot VRAM so the replay starts from identical state. ReadVRAM() syncs the shadow copy
+  // when a hardware renderer is active.
+  FlushRender();
+  ReadVRAM(0, 0, VRAM_WIDTH, VRAM_HEIGHT);
+
+  const TraceHeader header = {TRACE_MAGIC, TRACE_VERSION};
+  if (std::fwrite(&header, sizeof(header), 1, fp) != 1 ||
+      std::fwrite(m_vram_ptr, VRAM_WIDTH * VRAM_HEIGHT * sizeof(u16), 1, fp) != 1)
+  {
+    Log_ErrorFmt("Failed to write trace header to '{}'.", filename);
+    std::fclose(fp);
+    return false;
+  }
+
+  Log_InfoFmt("Recording GPU trace to '{}'.", filename);
+  m_trace_file = fp;
+  return true;
+}
+
+void GPU::StopTraceRecording()
+{
+  if (!m_trace_file)
+    return;
+
+  std::fclose(m_trace_file);
+  m_trace_file = nullptr;
+  Log_InfoPrint("Stopped GPU trace recording.");
+}
+
+void GPU::TraceGP0Words(const u32* words, u32 word_count)
+{
+  if (word_count == 0)
+    return;
+
+  const u32 hdr = (word_count << PACKET_COUNT_SHIFT) | PACKET_TYPE_GP0;
+  if (std::fwrite(&hdr, sizeof(hdr), 1, m_trace_file) != 1 ||
+      std::fwrite(words, sizeof(u32) * word_count, 1, m_trace_file) != 1)
+  {
+    Log_ErrorPrint("Failed to write to GPU trace file, stopping recording.");
+    StopTraceRecording();
+  }
+}
+
+void GPU::TraceGP1(u32 value)
+{
+  const u32 packet[2] = {(1u << PACKET_COUNT_SHIFT) | PACKET_TYPE_GP1, value};
+  if (std::fwrite(packet, sizeof(packet), 1, m_trace_file) != 1)
+  {
+    Log_ErrorPrint("Failed to write to GPU trace file, stopping recording.");
+    StopTraceRecording();
+  }
+}
+
+void GPU::TraceVSync()
+{
+  const u32 hdr = PACKET_TYPE_VSYNC;
+  if (std::fwrite(&hdr, sizeof(hdr), 1, m_trace_file) != 1)
+  {
+    Log_ErrorPrint("Failed to write to GPU trace file, stopping recording.");
+    StopTraceRecording();
+  }
+}
+
+bool GPU::ReplayTrace(const char* filename, std::vector<float>* frame_times_ms)
+{
+  Assert(!m_trace_file);
+
+  auto fp = FileSystem::OpenManagedCFile(filename, "rb");
+  if (!fp)
+  {
+    Log_ErrorFmt("Failed to open trace file '{}'.", filename);
+    return false;
+  }
+
+  TraceHeader header;
+  if (std::fread(&header, sizeof(header), 1, fp.get()) != 1 || header.magic != TRACE_MAGIC ||
+      header.version != TRACE_VERSION)
+  {
+    Log_ErrorFmt("'{}' is not a valid GPU trace file.", filename);
+    return false;
+  }
+
+  std::vector<u16> vram(VRAM_WIDTH * VRAM_HEIGHT);
+  if (std::fread(vram.data(), vram.size() * sizeof(u16), 1, fp.get()) != 1)
+  {
+    Log_ErrorFmt("Failed to read VRAM snapshot from '{}'.", filename);
+    return false;
+  }
+
+  // Reset the GPU and upload the snapshot through the same CPU->VRAM copy command a game would
+  // use, so the replay works against any backend without renderer-specific upload paths.
+  WriteGP1(0);
+
+  std::vector<u32> words;
+  words.reserve((VRAM_WIDTH * VRAM_HEIGHT) / 2 + 3);
+  words.push_back(0xA0u << 24);
+  words.push_back(0);
+  words.push_back((VRAM_HEIGHT << 16) | VRAM_WIDTH);
+  const u32* vram_words = reinterpret_cast<const u32*>(vram.data());
+  words.insert(words.end(), vram_words, vram_words + ((VRAM_WIDTH * VRAM_HEIGHT) / 2));
+
+  const auto feed_gp0 = [this, filename](const u32* data, u32 count) {
+    u32 pos = 0;
+    while (pos < count)
+    {
+      const u32 chunk = std::min(count - pos, static_cast<u32>(m_fifo.GetSpace()));
+      if (chunk > 0)
+      {
+        DMAWrite(&data[pos], chunk, 0, 0);
+        EndDMAWrite();
+        pos += chunk;
+      }
+
+      // Traces can contain VRAM->CPU reads, and nothing consumes GPUREAD during replay, so drain
+      // it here to unblock the command processor.
+      while (m_blitter_state == BlitterState::ReadingVRAM)
+        ReadGPUREAD();
+
+      if (chunk == 0 && m_blitter_state != BlitterState::ReadingVRAM)
+      {
+        Log_ErrorFmt("GPU FIFO stalled during replay of '{}'.", filename);
+        return false;
+      }
+    }
+
+    return true;
+  };
+
+  if (!feed_gp0(words.data(), static_cast<u32>(words.size())))
+    return false;
+
+  Log_InfoFmt("Replaying GPU trace from '{}'...", filename);
+
+  Common::Timer frame_timer;
+  u32 num_frames = 0;
+  for (;;)
+  {
+    u32 hdr;
+    if (std::fread(&hdr, sizeof(hdr), 1, fp.get()) != 1)
+      break;
+
+    switch (hdr & PACKET_TYPE_MASK)
+    {
+      case PACKET_TYPE_GP0:
+      {
+        const u32 count = hdr >> PACKET_COUNT_SHIFT;
+        words.resize(count);
+        if (count == 0 || std::fread(words.data(), sizeof(u32) * count, 1, fp.get()) != 1)
+        {
+          Log_ErrorFmt("Truncated GP0 packet in '{}'.", filename);
+          return false;
+        }
+
+        if (!feed_gp0(words.data(), count))
+          return false;
+      }
+      break;
+
+      case PACKET_TYPE_GP1:
+      {
+        u32 value;
+        if (std::fread(&value, sizeof(value), 1, fp.get()) != 1)
+        {
+          Log_ErrorFmt("Truncated GP1 packet in '{}'.", filename);
+          return false;
+        }
+
+        WriteGP1(value);
+      }
+      break;
+
+      case PACKET_TYPE_VSYNC:
+      {
+        FlushRender();
+        UpdateDisplay();
+
+        // The CPU never runs during replay, so command ticks would otherwise pile up forever.
+        m_pending_command_ticks = 0;
+        UpdateCommandTickEvent();
+
+        num_frames++;
+        if (frame_times_ms)
+          frame_times_ms->push_back(static_cast<float>(frame_timer.GetTimeMillisecondsAndReset()));
+      }
+      break;
+
+      default:
+      {
+        Log_ErrorFmt("Corrupted packet header 0x{:08X} in '{}'.", hdr, filename);
+        return false;
+      }
+    }
+  }
+
+  Log_InfoFmt("Replayed {} frames from '{}'.", num_frames, filename);
+  return true;
+}
@@ -144,6 +144,23 @@ ALWAYS_INLINE static void TruncateAndSetMACAndIR(s64 value, u8 shift, bool lm)
   TruncateAndSetIR<index>(value32, lm);
 }
 
+template<u32 index>
+ALWAYS_INLINE static void TruncateAndSetMACAndIRNoOverflow(s64 value, u8 shift, bool lm)
+{
+  // Variant for callers which can prove the value fits in the 44-bit MAC range, where the overflow
+  // check would only add a branch that never fires.
+
+  // shift should be done before storing to avoid losing precision
+  value >>= shift;
+
+  // set MAC
+  const s32 value32 = static_cast<s32>(value);
+  REGS.dr32[24 + index] = value32;
+
+  // set IR
+  TruncateAndSetIR<index>(value32, lm);
+}
+
 template<u32 index>
 ALWAYS_INLINE static u32 TruncateRGB(s32 value)
 {
@@ -520,15 +537,19 @@ ALWAYS_INLINE u32 GTE::UNRDivide(u32 lhs, u32 rhs)
 
 void GTE::MulMatVec(const s16* M_, const s16 Vx, const s16 Vy, const s16 Vz, u8 shift, bool lm)
 {
+  // Without a translation term, each row sums to at most 3 * 0x8000 * 0x8000 = 3*2^30, which can
+  // never reach the 44-bit MAC limit. The intermediate sign extension and overflow checks are
+  // provably no-ops here, so the three dot products reduce to independent mul/add chains which the
+  // compiler is free to vectorize. Only the IR saturation can actually fire.
 #define M(i, j) M_[((i)*3) + (j)]
-#define dot3(i)                                                                                                        \
-  TruncateAndSetMACAndIR<i + 1>(SignExtendMACResult<i + 1>((s64(M(i, 0)) * s64(Vx)) + (s64(M(i, 1)) * s64(Vy))) +      \
-                                  (s64(M(i, 2)) * s64(Vz)),                                                            \
-                                shift, lm)
+#define dot3(i) ((s64(M(i, 0)) * s64(Vx)) + (s64(M(i, 1)) * s64(Vy)) + (s64(M(i, 2)) * s64(Vz)))
 
-  dot3(0);
-  dot3(1);
-  dot3(2);
+  const s64 x = dot3(0);
+  const s64 y = dot3(1);
+  const s64 z = dot3(2);
+  TruncateAndSetMACAndIRNoOverflow<1>(x, shift, lm);
+  TruncateAndSetMACAndIRNoOverflow<2>(y, shift, lm);
+  TruncateAndSetMACAndIRNoOverflow<3>(z, shift, lm);
 
 #undef dot3
 #undef M
@@ -8,6 +8,7 @@
 #include "gpu.h"
 #include "host.h"
 #include "imgui_overlays.h"
+#include "performance_profiler.h"
 #include "cpu_pgxp.h"
 #include "settings.h"
 #include "spu.h"
@@ -191,6 +192,23 @@ DEFINE_HOTKEY("Screenshot", TRANSLATE_NOOP("Hotkeys", "General"), TRANSLATE_NOOP
                   System::SaveScreenshot();
               })
 
+DEFINE_HOTKEY("ToggleVideoCapture", TRANSLATE_NOOP("Hotkeys", "General"),
+              TRANSLATE_NOOP("Hotkeys", "Toggle Video Capture"), [](s32 pressed) {
+                if (!pressed && System::IsValid())
+                {
+                  if (System::IsCapturingVideo())
+                    System::StopCapturingVideo();
+                  else
+                    System::StartCapturingVideo();
+                }
+              })
+
+DEFINE_HOTKEY("ToggleProfilerTrace", TRANSLATE_NOOP("Hotkeys", "General"),
+              TRANSLATE_NOOP("Hotkeys", "Toggle Profiler Trace Recording"), [](s32 pressed) {
+                if (!pressed && System::IsValid())
+                  PerformanceProfiler::ToggleTrace();
+              })
+
 #ifndef __ANDROID__
 DEFINE_HOTKEY("OpenAchievements", TRANSLATE_NOOP("Hotkeys", "General"),
               TRANSLATE_NOOP("Hotkeys", "Open Achievement List"), [](s32 pressed) {
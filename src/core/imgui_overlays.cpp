@@ -4,11 +4,13 @@
 #include "imgui_overlays.h"
 #include "cdrom.h"
 #include "controller.h"
+#include "cpu_code_cache.h"
 #include "dma.h"
 #include "fullscreen_ui.h"
 #include "gpu.h"
 #include "host.h"
 #include "mdec.h"
+#include "performance_profiler.h"
 #include "resources.h"
 #include "settings.h"
 #include "spu.h"
@@ -25,6 +27,7 @@
 #include "common/file_system.h"
 #include "common/intrin.h"
 #include "common/log.h"
+#include "common/memory_tracker.h"
 #include "common/string_util.h"
 #include "common/timer.h"
 
@@ -49,6 +52,7 @@ static void FormatProcessorStat(SmallStringBase& text, double usage, double time
 static void DrawPerformanceOverlay();
 static void DrawEnhancementsOverlay();
 static void DrawInputsOverlay();
+static void DrawMemoryStateWindow();
 } // namespace ImGuiManager
 
 namespace SaveStateSelectorUI {
@@ -222,9 +226,58 @@ void ImGuiManager::RenderDebugWindows()
       MDEC::DrawDebugStateWindow();
     if (g_settings.debugging.show_dma_state)
       DMA::DrawDebugStateWindow();
+    if (g_settings.debugging.show_code_cache_state)
+      CPU::CodeCache::DrawDebugStateWindow();
+    if (g_settings.debugging.show_memory_state)
+      DrawMemoryStateWindow();
   }
 }
 
+void ImGuiManager::DrawMemoryStateWindow()
+{
+  const float framebuffer_scale = Host::GetOSDScale();
+
+  ImGui::SetNextWindowSize(ImVec2(300.0f * framebuffer_scale, 100.0f * framebuffer_scale), ImGuiCond_FirstUseEver);
+  if (!ImGui::Begin("Memory Usage", nullptr))
+  {
+    ImGui::End();
+    return;
+  }
+
+  if constexpr (!MemoryTracker::IsEnabled())
+  {
+    ImGui::TextUnformatted("This build was created without ENABLE_MEMORY_TRACKER.");
+    ImGui::End();
+    return;
+  }
+
+  ImGui::Columns(3);
+  ImGui::SetColumnWidth(0, 120.0f * framebuffer_scale);
+  ImGui::SetColumnWidth(1, 90.0f * framebuffer_scale);
+  ImGui::SetColumnWidth(2, 90.0f * framebuffer_scale);
+
+  ImGui::TextUnformatted("Subsystem");
+  ImGui::NextColumn();
+  ImGui::TextUnformatted("Live");
+  ImGui::NextColumn();
+  ImGui::TextUnformatted("Peak");
+  ImGui::NextColumn();
+
+  for (u32 i = 0; i < static_cast<u32>(MemoryTracker::Tag::Count); i++)
+  {
+    const MemoryTracker::Tag tag = static_cast<MemoryTracker::Tag>(i);
+    ImGui::TextUnformatted(MemoryTracker::GetTagName(tag));
+    ImGui::NextColumn();
+    ImGui::Text("%.2f MB", static_cast<double>(MemoryTracker::GetLiveBytes(tag)) / 1048576.0);
+    ImGui::NextColumn();
+    ImGui::Text("%.2f MB", static_cast<double>(MemoryTracker::GetPeakBytes(tag)) / 1048576.0);
+    ImGui::NextColumn();
+  }
+
+  ImGui::Columns(1);
+  ImGui::End();
+}
+
 void ImGuiManager::RenderTextOverlays()
 {
   const System::State state = System::GetState();
@@ -264,7 +317,7 @@ void ImGuiManager::FormatProcessorStat(SmallStringBase& text, double usage, doub
 void ImGuiManager::DrawPerformanceOverlay()
 {
   if (!(g_settings.display_show_fps || g_settings.display_show_speed || g_settings.display_show_resolution ||
-        g_settings.display_show_cpu ||
+        g_settings.display_show_cpu || g_settings.display_show_profiler ||
         (g_settings.display_show_status_indicators &&
          (System::IsPaused() || System::IsFastForwardEnabled() || System::IsTurboEnabled()))))
   {
@@ -280,6 +333,9 @@ void ImGuiManager::DrawPerformanceOverlay()
   float position_y = margin;
 
   ImDrawList* dl = ImGui::GetBackgroundDrawList();
+
+  // Deliberately stack-backed: this runs every frame, and none of the lines below should ever be
+  // long enough to spill to the heap. Keep it that way instead of reaching for std::string.
   SmallString text;
   ImVec2 text_size;
   bool first = true;
@@ -398,6 +454,30 @@ void ImGuiManager::DrawPerformanceOverlay()
       FormatProcessorStat(text, System::GetCPUThreadUsage(), System::GetCPUThreadAverageTime());
       DRAW_LINE(fixed_font, text, IM_COL32(255, 255, 255, 255));
 
+      if (System::GetSleepOvershootTime() > 0.0f)
+      {
+        text.fmt("Pacing: {:.2f}ms overshoot", System::GetSleepOvershootTime());
+        DRAW_LINE(fixed_font, text, IM_COL32(255, 255, 255, 255));
+      }
+
+      if (System::GetSlowFrameCount() > 0)
+      {
+        text.fmt("Stalls: {} (", System::GetSlowFrameCount());
+        first = true;
+        for (u32 i = 0; i < static_cast<u32>(System::FramePhase::Count); i++)
+        {
+          const System::FramePhase phase = static_cast<System::FramePhase>(i);
+          const u32 count = System::GetSlowFrameCountForPhase(phase);
+          if (count == 0)
+            continue;
+
+          text.append_fmt("{}{} {}", first ? "" : ", ", System::GetFramePhaseName(phase), count);
+          first = false;
+        }
+        text.append(")");
+        DRAW_LINE(fixed_font, text, IM_COL32(255, 200, 100, 255));
+      }
+
       if (g_gpu->GetSWThread())
       {
         text.assign("SW: ");
@@ -405,14 +485,33 @@ void ImGuiManager::DrawPerformanceOverlay()
         DRAW_LINE(fixed_font, text, IM_COL32(255, 255, 255, 255));
       }
 
-#if 0
       {
-        AudioStream* stream = g_spu.GetOutputStream();
+        AudioStream* stream = SPU::GetOutputStream();
         const u32 frames = stream->GetBufferedFramesRelaxed();
-        text.fmt("Audio: {:<4u}f/{:<3u}ms", frames, AudioStream::GetMSForBufferSize(stream->GetSampleRate(), frames));
+        text.fmt("Audio: {:<4}f/{:<3}ms ({} underruns, {} overruns)", frames,
+                 AudioStream::GetMSForBufferSize(stream->GetSampleRate(), frames), stream->GetUnderrunCount(),
+                 stream->GetOverrunCount());
+        DRAW_LINE(fixed_font, text, IM_COL32(255, 255, 255, 255));
+
+        text.fmt("Jitter: {:.2f}ms avg {:.2f}ms max Target: {:<3}ms", stream->GetAverageCallbackJitterMS(),
+                 stream->GetMaximumCallbackJitterMS(),
+                 AudioStream::GetMSForBufferSize(stream->GetSampleRate(), stream->GetTargetBufferSize()));
         DRAW_LINE(fixed_font, text, IM_COL32(255, 255, 255, 255));
+
+        u32 total_occupancy_samples = 0;
+        for (u32 i = 0; i < AudioStream::NUM_OCCUPANCY_BUCKETS; i++)
+          total_occupancy_samples += stream->GetOccupancyBucketCount(i);
+        if (total_occupancy_samples > 0)
+        {
+          text.assign("Occupancy: ");
+          for (u32 i = 0; i < AudioStream::NUM_OCCUPANCY_BUCKETS; i++)
+          {
+            text.append_fmt("{}{}", (i == 0) ? "" : "/",
+                            (stream->GetOccupancyBucketCount(i) * 100) / total_occupancy_samples);
+          }
+          DRAW_LINE(fixed_font, text, IM_COL32(255, 255, 255, 255));
+        }
       }
-#endif
     }
 
     if (g_settings.display_show_gpu && g_gpu_device->IsGPUTimingEnabled())
@@ -420,6 +519,19 @@ void ImGuiManager::DrawPerformanceOverlay()
       text.assign("GPU: ");
       FormatProcessorStat(text, System::GetGPUUsage(), System::GetGPUAverageTime());
       DRAW_LINE(fixed_font, text, IM_COL32(255, 255, 255, 255));
+
+      text.fmt("Draw: {:.2f}ms VRAM: {:.2f}ms Present: {:.2f}ms",
+               System::GetGPUStageAverageTime(static_cast<u32>(GPUDevice::GPUTimingStage::Draw)),
+               System::GetGPUStageAverageTime(static_cast<u32>(GPUDevice::GPUTimingStage::VRAMUpdate)),
+               System::GetGPUStageAverageTime(static_cast<u32>(GPUDevice::GPUTimingStage::Present)));
+      DRAW_LINE(fixed_font, text, IM_COL32(255, 255, 255, 255));
+    }
+
+    if (g_settings.display_show_latency && System::GetAverageInputLatency() > 0.0f)
+    {
+      text.fmt("Input: {:.2f}ms | {:.2f}ms | {:.2f}ms", System::GetMinimumInputLatency(),
+               System::GetAverageInputLatency(), System::GetMaximumInputLatency());
+      DRAW_LINE(fixed_font, text, IM_COL32(255, 255, 255, 255));
     }
 
     if (g_settings.display_show_status_indicators)
@@ -492,6 +604,56 @@ void ImGuiManager::DrawPerformanceOverlay()
       ImGui::PopStyleVar(5);
       ImGui::PopStyleColor(3);
     }
+
+    if (g_settings.display_show_profiler)
+    {
+      constexpr u32 num_events = static_cast<u32>(PerformanceProfiler::Event::Count);
+      const float plot_height = 35.0f * scale;
+      const float event_height = (fixed_font->FontSize * 2.0f) + plot_height + (spacing * 3.0f);
+      const ImVec2 window_size(210.0f * scale, (event_height * static_cast<float>(num_events)) + spacing);
+      const float window_y =
+        position_y + (g_settings.display_show_frame_times ? ((50.0f * scale) + spacing) : 0.0f);
+      ImGui::SetNextWindowSize(window_size);
+      ImGui::SetNextWindowPos(ImVec2(ImGui::GetIO().DisplaySize.x - margin - window_size.x, window_y));
+      ImGui::PushStyleColor(ImGuiCol_WindowBg, ImVec4(0.0f, 0.0f, 0.0f, 0.25f));
+      ImGui::PushStyleColor(ImGuiCol_FrameBg, ImVec4(0.0f, 0.0f, 0.0f, 0.0f));
+      ImGui::PushStyleColor(ImGuiCol_PlotHistogram, ImVec4(1.0f, 1.0f, 1.0f, 1.0f));
+      ImGui::PushStyleVar(ImGuiStyleVar_WindowRounding, 0.0f);
+      ImGui::PushStyleVar(ImGuiStyleVar_WindowPadding, ImVec2(spacing, spacing));
+      ImGui::PushStyleVar(ImGuiStyleVar_WindowBorderSize, 0.0f);
+      if (ImGui::Begin("##profiler", nullptr, ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoInputs))
+      {
+        ImGui::PushFont(fixed_font);
+
+        for (u32 i = 0; i < num_events; i++)
+        {
+          const PerformanceProfiler::Event event = static_cast<PerformanceProfiler::Event>(i);
+          const PerformanceProfiler::EventStats& stats = PerformanceProfiler::GetEventStats(event);
+
+          text.fmt("{} ({} calls)", PerformanceProfiler::GetEventName(event), stats.last_count);
+          ImGui::TextUnformatted(text.c_str(), text.end_ptr());
+          text.fmt("{:.2f}ms | {:.2f}ms | {:.2f}ms", stats.last_ms, stats.avg_ms, stats.max_ms);
+          ImGui::TextUnformatted(text.c_str(), text.end_ptr());
+
+          ImGui::PushID(static_cast<int>(i));
+          ImGui::PlotHistogram("##profiler_hist", stats.history_ms.data(), PerformanceProfiler::HISTORY_SIZE,
+                               static_cast<int>(PerformanceProfiler::GetHistoryPosition()), nullptr, 0.0f,
+                               std::max(stats.max_ms, 1.0f), ImVec2(window_size.x - (spacing * 2.0f), plot_height));
+          ImGui::PopID();
+        }
+
+        if (PerformanceProfiler::IsTracing())
+        {
+          text.assign(ICON_FA_CIRCLE " Recording trace");
+          ImGui::TextUnformatted(text.c_str(), text.end_ptr());
+        }
+
+        ImGui::PopFont();
+      }
+      ImGui::End();
+      ImGui::PopStyleVar(3);
+      ImGui::PopStyleColor(3);
+    }
   }
   else if (g_settings.display_show_status_indicators && state == System::State::Paused &&
            !FullscreenUI::HasActiveWindow())
@@ -0,0 +1,336 @@
+// SPDX-FileCopyrightText: 2019-2023 Connor McLaughlin <stenzek@gmail.com>
+// SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
+
+#include "input_replay.h"
+#include "bus.h"
+#include "controller.h"
+#include "settings.h"
+#include "system.h"
+
+#include "common/file_system.h"
+#include "common/log.h"
+
+#include "xxhash.h"
+
+#include <cstring>
+
+Log_SetChannel(InputReplay);
+
+namespace InputReplay {
+
+static constexpr u32 FILE_SIGNATURE = 0x52495344; // 'DSIR'
+static constexpr u32 FILE_VERSION = 1;
+
+/// How often the guest RAM hash is embedded in the stream. Frequent enough to localize a
+/// divergence, cheap enough (~1ms per 2MB hash) to not distort fast-forward runs.
+static constexpr u32 DEFAULT_HASH_INTERVAL = 60;
+
+static constexpr u8 PAD_TYPE_NONE = 0xFF;
+
+enum FrameFlags : u8
+{
+  FRAME_FLAG_RAM_HASH = (1 << 0),
+};
+
+namespace {
+struct FileHeader
+{
+  u32 signature;
+  u32 version;
+  u32 hash_interval;
+  u32 serial_length; // followed by serial bytes
+};
+} // namespace
+
+static bool RecordFrame();
+static bool PlayFrame();
+
+static std::FILE* s_file = nullptr;
+static bool s_recording = false;
+static bool s_playing = false;
+static u32 s_hash_interval = DEFAULT_HASH_INTERVAL;
+static u32 s_frame_count = 0;
+static u32 s_hash_mismatches = 0;
+
+} // namespace InputReplay
+
+bool InputReplay::IsRecording()
+{
+  return s_recording;
+}
+
+bool InputReplay::IsPlaying()
+{
+  return s_playing;
+}
+
+bool InputReplay::StartRecording(const char* path)
+{
+  Stop();
+
+  if (!System::IsValid())
+  {
+    Log_ErrorPrint("Cannot start input recording without a running system.");
+    return false;
+  }
+  else if (g_settings.runahead_frames > 0)
+  {
+    // Runahead replays frames internally, which would interleave duplicate records into the
+    // stream. Mutually exclusive rather than trying to untangle the two.
+    Log_ErrorPrint("Input recording is incompatible with runahead, disable it first.");
+    return false;
+  }
+
+  s_file = FileSystem::OpenCFile(path, "wb");
+  if (!s_file)
+  {
+    Log_ErrorFmt("Failed to open '{}' for input recording.", path);
+    return false;
+  }
+
+  const std::string& serial = System::GetGameSerial();
+  const FileHeader header = {FILE_SIGNATURE, FILE_VERSION, DEFAULT_HASH_INTERVAL,
+                             static_cast<u32>(serial.length())};
+  if (std::fwrite(&header, sizeof(header), 1, s_file) != 1 ||
+      (!serial.empty() && std::fwrite(serial.data(), serial.length(), 1, s_file) != 1))
+  {
+    Log_ErrorFmt("Failed to write input recording header to '{}'.", path);
+    std::fclose(s_file);
+    s_file = nullptr;
+    return false;
+  }
+
+  s_hash_interval = DEFAULT_HASH_INTERVAL;
+  s_frame_count = 0;
+  s_hash_mismatches = 0;
+  s_recording = true;
+  Log_InfoFmt("Started input recording to '{}'.", path);
+  return true;
+}
+
+bool InputReplay::StartPlayback(const char* path)
+{
+  Stop();
+
+  if (!System::IsValid())
+  {
+    Log_ErrorPrint("Cannot start input playback without a running system.");
+    return false;
+  }
+  else if (g_settings.runahead_frames > 0)
+  {
+    Log_ErrorPrint("Input playback is incompatible with runahead, disable it first.");
+    return false;
+  }
+
+  s_file = FileSystem::OpenCFile(path, "rb");
+  if (!s_file)
+  {
+    Log_ErrorFmt("Failed to open '{}' for input playback.", path);
+    return false;
+  }
+
+  FileHeader header;
+  if (std::fread(&header, sizeof(header), 1, s_file) != 1 || header.signature != FILE_SIGNATURE ||
+      header.version != FILE_VERSION || header.hash_interval == 0)
+  {
+    Log_ErrorFmt("'{}' is not a valid input recording.", path);
+    std::fclose(s_file);
+    s_file = nullptr;
+    return false;
+  }
+
+  std::string serial;
+  serial.resize(header.serial_length);
+  if (!serial.empty() && std::fread(serial.data(), serial.length(), 1, s_file) != 1)
+  {
+    Log_ErrorFmt("Failed to read serial from '{}'.", path);
+    std::fclose(s_file);
+    s_file = nullptr;
+    return false;
+  }
+
+  // A mismatched game can still be replayed, but the inputs are meaningless and the hash guard
+  // will fire immediately, so make the cause obvious up front.
+  if (serial != System::GetGameSerial())
+  {
+    Log_WarningFmt("Input recording was made with serial '{}', but '{}' is running. Expect divergence.", serial,
+                   System::GetGameSerial());
+  }
+
+  s_hash_interval = header.hash_interval;
+  s_frame_count = 0;
+  s_hash_mismatches = 0;
+  s_playing = true;
+  Log_InfoFmt("Started input playback from '{}'.", path);
+  return true;
+}
+
+void InputReplay::Stop()
+{
+  if (!s_file)
+    return;
+
+  if (s_recording)
+  {
+    if (std::fflush(s_file) != 0)
+      Log_ErrorPrint("Failed to flush input recording.");
+    Log_InfoFmt("Stopped input recording after {} frames.", s_frame_count);
+  }
+  else
+  {
+    Log_InfoFmt("Stopped input playback after {} frames ({} hash mismatches).", s_frame_count, s_hash_mismatches);
+  }
+
+  std::fclose(s_file);
+  s_file = nullptr;
+  s_recording = false;
+  s_playing = false;
+}
+
+void InputReplay::ProcessFrame()
+{
+  if (!s_file)
+    return;
+
+  const bool okay = s_recording ? RecordFrame() : PlayFrame();
+  if (okay)
+    s_frame_count++;
+  else
+    Stop();
+}
+
+bool InputReplay::RecordFrame()
+{
+  const bool hash_frame = (s_frame_count % s_hash_interval) == 0;
+  const u8 flags = hash_frame ? FRAME_FLAG_RAM_HASH : 0u;
+  if (std::fwrite(&flags, sizeof(flags), 1, s_file) != 1)
+  {
+    Log_ErrorPrint("Failed to write to input recording.");
+    return false;
+  }
+
+  if (hash_frame)
+  {
+    const u64 hash = XXH3_64bits(Bus::g_ram, Bus::g_ram_size);
+    if (std::fwrite(&hash, sizeof(hash), 1, s_file) != 1)
+    {
+      Log_ErrorPrint("Failed to write to input recording.");
+      return false;
+    }
+  }
+
+  for (u32 i = 0; i < NUM_CONTROLLER_AND_CARD_PORTS; i++)
+  {
+    Controller* const controller = System::GetController(i);
+    if (!controller)
+    {
+      const u8 type = PAD_TYPE_NONE;
+      if (std::fwrite(&type, sizeof(type), 1, s_file) != 1)
+      {
+        Log_ErrorPrint("Failed to write to input recording.");
+        return false;
+      }
+
+      continue;
+    }
+
+    const Controller::ControllerInfo* cinfo = Controller::GetControllerInfo(controller->GetType());
+    DebugAssert(cinfo);
+
+    const u8 type = static_cast<u8>(controller->GetType());
+    const u8 num_binds = static_cast<u8>(cinfo->bindings.size());
+    if (std::fwrite(&type, sizeof(type), 1, s_file) != 1 ||
+        std::fwrite(&num_binds, sizeof(num_binds), 1, s_file) != 1)
+    {
+      Log_ErrorPrint("Failed to write to input recording.");
+      return false;
+    }
+
+    for (const Controller::ControllerBindingInfo& bi : cinfo->bindings)
+    {
+      const float value = controller->GetBindState(bi.bind_index);
+      if (std::fwrite(&value, sizeof(value), 1, s_file) != 1)
+      {
+        Log_ErrorPrint("Failed to write to input recording.");
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+bool InputReplay::PlayFrame()
+{
+  u8 flags;
+  if (std::fread(&flags, sizeof(flags), 1, s_file) != 1)
+  {
+    Log_InfoPrint("Reached the end of the input recording.");
+    return false;
+  }
+
+  if (flags & FRAME_FLAG_RAM_HASH)
+  {
+    u64 expected_hash;
+    if (std::fread(&expected_hash, sizeof(expected_hash), 1, s_file) != 1)
+    {
+      Log_ErrorPrint("Input recording is truncated.");
+      return false;
+    }
+
+    const u64 hash = XXH3_64bits(Bus::g_ram, Bus::g_ram_size);
+    if (hash != expected_hash)
+    {
+      // Keep playing; the remaining inputs are still a useful approximation, and the count is
+      // reported when playback stops.
+      if (s_hash_mismatches++ == 0)
+        Log_WarningFmt("RAM hash mismatch at frame {}, replay has diverged.", s_frame_count);
+    }
+  }
+
+  for (u32 i = 0; i < NUM_CONTROLLER_AND_CARD_PORTS; i++)
+  {
+    u8 type;
+    if (std::fread(&type, sizeof(type), 1, s_file) != 1)
+    {
+      Log_ErrorPrint("Input recording is truncated.");
+      return false;
+    }
+
+    if (type == PAD_TYPE_NONE)
+      continue;
+
+    u8 num_binds;
+    if (std::fread(&num_binds, sizeof(num_binds), 1, s_file) != 1)
+    {
+      Log_ErrorPrint("Input recording is truncated.");
+      return false;
+    }
+
+    Controller* const controller = System::GetController(i);
+    const Controller::ControllerInfo* cinfo =
+      (type < static_cast<u8>(ControllerType::Count)) ?
+        Controller::GetControllerInfo(static_cast<ControllerType>(type)) :
+        nullptr;
+    const bool type_matches = (controller && cinfo && controller->GetType() == cinfo->type &&
+                               cinfo->bindings.size() == num_binds);
+    if (!type_matches && s_frame_count == 0)
+      Log_WarningFmt("Controller in port {} does not match the recording, its inputs will be dropped.", i + 1u);
+
+    for (u32 j = 0; j < num_binds; j++)
+    {
+      float value;
+      if (std::fread(&value, sizeof(value), 1, s_file) != 1)
+      {
+        Log_ErrorPrint("Input recording is truncated.");
+        return false;
+      }
+
+      if (type_matches)
+        controller->SetBindState(cinfo->bindings[j].bind_index, value);
+    }
+  }
+
+  return true;
+}
@@ -0,0 +1,29 @@
+// SPDX-FileCopyrightText: 2019-2023 Connor McLaughlin <stenzek@gmail.com>
+// SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
+
+#pragma once
+
+#include "types.h"
+
+/// Deterministic input recording/replay. Captures the bind state of every connected pad once per
+/// frame into a compact stream, together with a periodic hash of guest RAM as a determinism guard.
+/// Replay drives the controllers directly from the file, so combined with the headless regtest
+/// runner it gives reproducible runs at full fast-forward speed.
+namespace InputReplay {
+
+/// Starts recording pad input for the running system to the specified file.
+bool StartRecording(const char* path);
+
+/// Starts replaying a previously-recorded input stream, overriding host input.
+bool StartPlayback(const char* path);
+
+/// Stops any active recording or playback, flushing and closing the file.
+void Stop();
+
+bool IsRecording();
+bool IsPlaying();
+
+/// Called once per frame from FrameDone(), after host input has been polled.
+void ProcessFrame();
+
+} // namespace InputReplay
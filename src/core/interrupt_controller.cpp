@@ -17,6 +17,10 @@ static void UpdateCPUInterruptRequest();
 static u32 s_interrupt_status_register = 0;
 static u32 s_interrupt_mask_register = DEFAULT_INTERRUPT_MASK;
 
+// Cached composite state of the masked IRQ line, so transitions (rather than every
+// request/acknowledge) are the only thing propagated into the CPU's cause register.
+static u32 s_irq_line_state = 0;
+
 } // namespace InterruptController
 
 void InterruptController::Initialize()
@@ -30,6 +34,7 @@ void InterruptController::Reset()
 {
   s_interrupt_status_register = 0;
   s_interrupt_mask_register = DEFAULT_INTERRUPT_MASK;
+  s_irq_line_state = 0;
 }
 
 bool InterruptController::DoState(StateWrapper& sw)
@@ -37,6 +42,10 @@ bool InterruptController::DoState(StateWrapper& sw)
   sw.Do(&s_interrupt_status_register);
   sw.Do(&s_interrupt_mask_register);
 
+  // The CPU-side cause bit is restored with the CPU state, only the cached line state
+  // needs recomputing here.
+  s_irq_line_state = BoolToUInt32((s_interrupt_status_register & s_interrupt_mask_register) != 0);
+
   return !sw.HasError();
 }
 
@@ -48,6 +57,9 @@ bool InterruptController::GetIRQLineState()
 void InterruptController::InterruptRequest(IRQ irq)
 {
   const u32 bit = (u32(1) << static_cast<u32>(irq));
+  if (s_interrupt_status_register & bit)
+    return;
+
   s_interrupt_status_register |= bit;
   UpdateCPUInterruptRequest();
 }
@@ -99,7 +111,12 @@ void InterruptController::WriteRegister(u32 offset, u32 value)
 void InterruptController::UpdateCPUInterruptRequest()
 {
   // external interrupts set bit 10 only?
-  if ((s_interrupt_status_register & s_interrupt_mask_register) != 0)
+  const u32 line_state = BoolToUInt32((s_interrupt_status_register & s_interrupt_mask_register) != 0);
+  if (line_state == s_irq_line_state)
+    return;
+
+  s_irq_line_state = line_state;
+  if (line_state != 0)
     CPU::SetExternalInterrupt(2);
   else
     CPU::ClearExternalInterrupt(2);
@@ -13,6 +13,7 @@
 
 #include "common/bitfield.h"
 #include "common/fifo_queue.h"
+#include "common/intrin.h"
 #include "common/log.h"
 
 #include "imgui.h"
@@ -781,13 +782,96 @@ void MDEC::IDCT(s16* blk)
 
 void MDEC::IDCT_New(s16* blk)
 {
+#if defined(CPU_ARCH_SSE) || defined(CPU_ARCH_NEON)
+  // Both passes are 8x8 matrix multiplies against the prescaled table, so each output row can be
+  // built from eight broadcast-multiply-accumulates over the table rows. The (sum + 0xfff) /
+  // 0x2000 rounding uses a sign-corrected arithmetic shift to match the scalar division exactly;
+  // the intermediate sums fit s32 since coefficients are clamped to 10 bits and the prescaled
+  // table to 13.
+  alignas(16) s16 scale8[64];
+  alignas(16) s16 temp[64];
+
+#if defined(CPU_ARCH_SSE)
+  for (u32 i = 0; i < 64; i += 8)
+  {
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&s_scale_table[i]));
+    const __m128i adj = _mm_and_si128(_mm_srai_epi16(v, 15), _mm_set1_epi16(7));
+    _mm_store_si128(reinterpret_cast<__m128i*>(&scale8[i]), _mm_srai_epi16(_mm_add_epi16(v, adj), 3));
+  }
+
+  for (u32 pass = 0; pass < 2; pass++)
+  {
+    const s16* in = (pass == 0) ? blk : temp;
+    s16* out = (pass == 0) ? temp : blk;
+    for (u32 y = 0; y < 8; y++)
+    {
+      __m128i sum_lo = _mm_setzero_si128();
+      __m128i sum_hi = _mm_setzero_si128();
+      for (u32 z = 0; z < 8; z++)
+      {
+        const __m128i coeff = _mm_set1_epi16(in[y + z * 8]);
+        const __m128i row = _mm_load_si128(reinterpret_cast<const __m128i*>(&scale8[z * 8]));
+        const __m128i prod_lo = _mm_mullo_epi16(coeff, row);
+        const __m128i prod_hi = _mm_mulhi_epi16(coeff, row);
+        sum_lo = _mm_add_epi32(sum_lo, _mm_unpacklo_epi16(prod_lo, prod_hi));
+        sum_hi = _mm_add_epi32(sum_hi, _mm_unpackhi_epi16(prod_lo, prod_hi));
+      }
+
+      sum_lo = _mm_add_epi32(sum_lo, _mm_set1_epi32(0xfff));
+      sum_hi = _mm_add_epi32(sum_hi, _mm_set1_epi32(0xfff));
+      sum_lo =
+        _mm_srai_epi32(_mm_add_epi32(sum_lo, _mm_and_si128(_mm_srai_epi32(sum_lo, 31), _mm_set1_epi32(0x1fff))), 13);
+      sum_hi =
+        _mm_srai_epi32(_mm_add_epi32(sum_hi, _mm_and_si128(_mm_srai_epi32(sum_hi, 31), _mm_set1_epi32(0x1fff))), 13);
+
+      __m128i result = _mm_packs_epi32(sum_lo, sum_hi);
+      if (pass == 1)
+        result = _mm_min_epi16(_mm_max_epi16(result, _mm_set1_epi16(-128)), _mm_set1_epi16(127));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(&out[y * 8]), result);
+    }
+  }
+#else // CPU_ARCH_NEON
+  for (u32 i = 0; i < 64; i += 8)
+  {
+    const int16x8_t v = vld1q_s16(&s_scale_table[i]);
+    const int16x8_t adj = vandq_s16(vshrq_n_s16(v, 15), vdupq_n_s16(7));
+    vst1q_s16(&scale8[i], vshrq_n_s16(vaddq_s16(v, adj), 3));
+  }
+
+  for (u32 pass = 0; pass < 2; pass++)
+  {
+    const s16* in = (pass == 0) ? blk : temp;
+    s16* out = (pass == 0) ? temp : blk;
+    for (u32 y = 0; y < 8; y++)
+    {
+      int32x4_t sum_lo = vdupq_n_s32(0);
+      int32x4_t sum_hi = vdupq_n_s32(0);
+      for (u32 z = 0; z < 8; z++)
+      {
+        const int16x4_t coeff = vdup_n_s16(in[y + z * 8]);
+        const int16x8_t row = vld1q_s16(&scale8[z * 8]);
+        sum_lo = vmlal_s16(sum_lo, vget_low_s16(row), coeff);
+        sum_hi = vmlal_s16(sum_hi, vget_high_s16(row), coeff);
+      }
+
+      sum_lo = vaddq_s32(sum_lo, vdupq_n_s32(0xfff));
+      sum_hi = vaddq_s32(sum_hi, vdupq_n_s32(0xfff));
+      sum_lo = vshrq_n_s32(vaddq_s32(sum_lo, vandq_s32(vshrq_n_s32(sum_lo, 31), vdupq_n_s32(0x1fff))), 13);
+      sum_hi = vshrq_n_s32(vaddq_s32(sum_hi, vandq_s32(vshrq_n_s32(sum_hi, 31), vdupq_n_s32(0x1fff))), 13);
+
+      int16x8_t result = vcombine_s16(vqmovn_s32(sum_lo), vqmovn_s32(sum_hi));
+      if (pass == 1)
+        result = vminq_s16(vmaxq_s16(result, vdupq_n_s16(-128)), vdupq_n_s16(127));
+      vst1q_s16(&out[y * 8], result);
+    }
+  }
+#endif
+#else
   std::array<s32, 64> temp;
   for (u32 x = 0; x < 8; x++)
   {
     for (u32 y = 0; y < 8; y++)
     {
-      // TODO: We could alter zigzag and invert scale_table to get these in row-major order,
-      // in which case we could do optimize this to a vector multiply.
       s32 sum = 0;
       for (u32 z = 0; z < 8; z++)
         sum += s32(blk[y + z * 8]) * s32(s_scale_table[x + z * 8] / 8);
@@ -804,6 +888,7 @@ void MDEC::IDCT_New(s16* blk)
       blk[x + y * 8] = static_cast<s16>(std::clamp<s32>((sum + 0xfff) / 0x2000, -128, 127));
     }
   }
+#endif
 }
 
 void MDEC::IDCT_Old(s16* blk)
@@ -837,6 +922,95 @@ void MDEC::yuv_to_rgb(u32 xx, u32 yy, const std::array<s16, 64>& Crblk, const st
                       const std::array<s16, 64>& Yblk)
 {
   const s16 addval = s_status.data_output_signed ? 0 : 0x80;
+#if defined(CPU_ARCH_SSE)
+  // The chroma-derived terms only depend on the four chroma samples covering the row, so they are
+  // computed four wide in float (truncating conversion matches the scalar casts), duplicated
+  // across the luma pairs, then the add/clamp/pack runs eight wide. The u16 components are
+  // zero-extended and OR'd together, so sign bits from negative components bleed into the upper
+  // bytes exactly like the scalar packing did.
+  for (u32 y = 0; y < 8; y++)
+  {
+    const u32 chroma_base = (xx / 2) + (((y + yy) / 2) * 8);
+    const __m128i cr4 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(&Crblk[chroma_base]));
+    const __m128i cb4 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(&Cbblk[chroma_base]));
+    const __m128 crf = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(cr4, cr4), 16));
+    const __m128 cbf = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(cb4, cb4), 16));
+
+    const __m128i r4 = _mm_cvttps_epi32(_mm_mul_ps(crf, _mm_set1_ps(1.402f)));
+    const __m128i b4 = _mm_cvttps_epi32(_mm_mul_ps(cbf, _mm_set1_ps(1.772f)));
+    const __m128i g4 =
+      _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(cbf, _mm_set1_ps(-0.3437f)), _mm_mul_ps(crf, _mm_set1_ps(-0.7143f))));
+
+    const __m128i r4_16 = _mm_packs_epi32(r4, r4);
+    const __m128i g4_16 = _mm_packs_epi32(g4, g4);
+    const __m128i b4_16 = _mm_packs_epi32(b4, b4);
+    const __m128i r8 = _mm_unpacklo_epi16(r4_16, r4_16);
+    const __m128i g8 = _mm_unpacklo_epi16(g4_16, g4_16);
+    const __m128i b8 = _mm_unpacklo_epi16(b4_16, b4_16);
+
+    const __m128i y8 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Yblk[y * 8]));
+    const __m128i min_val = _mm_set1_epi16(-128);
+    const __m128i max_val = _mm_set1_epi16(127);
+    const __m128i add_val = _mm_set1_epi16(addval);
+    const __m128i rr = _mm_add_epi16(_mm_min_epi16(_mm_max_epi16(_mm_add_epi16(y8, r8), min_val), max_val), add_val);
+    const __m128i gg = _mm_add_epi16(_mm_min_epi16(_mm_max_epi16(_mm_add_epi16(y8, g8), min_val), max_val), add_val);
+    const __m128i bb = _mm_add_epi16(_mm_min_epi16(_mm_max_epi16(_mm_add_epi16(y8, b8), min_val), max_val), add_val);
+
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i out_lo =
+      _mm_or_si128(_mm_unpacklo_epi16(rr, zero), _mm_or_si128(_mm_slli_epi32(_mm_unpacklo_epi16(gg, zero), 8),
+                                                              _mm_slli_epi32(_mm_unpacklo_epi16(bb, zero), 16)));
+    const __m128i out_hi =
+      _mm_or_si128(_mm_unpackhi_epi16(rr, zero), _mm_or_si128(_mm_slli_epi32(_mm_unpackhi_epi16(gg, zero), 8),
+                                                              _mm_slli_epi32(_mm_unpackhi_epi16(bb, zero), 16)));
+
+    u32* out_row = &s_block_rgb[xx + ((y + yy) * 16)];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out_row), out_lo);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out_row + 4), out_hi);
+  }
+#elif defined(CPU_ARCH_NEON)
+  // See the SSE path above; identical structure, with truncating float->int conversions matching
+  // the scalar casts.
+  for (u32 y = 0; y < 8; y++)
+  {
+    const u32 chroma_base = (xx / 2) + (((y + yy) / 2) * 8);
+    const float32x4_t crf = vcvtq_f32_s32(vmovl_s16(vld1_s16(&Crblk[chroma_base])));
+    const float32x4_t cbf = vcvtq_f32_s32(vmovl_s16(vld1_s16(&Cbblk[chroma_base])));
+
+    const int32x4_t r4 = vcvtq_s32_f32(vmulq_n_f32(crf, 1.402f));
+    const int32x4_t b4 = vcvtq_s32_f32(vmulq_n_f32(cbf, 1.772f));
+    const int32x4_t g4 = vcvtq_s32_f32(vaddq_f32(vmulq_n_f32(cbf, -0.3437f), vmulq_n_f32(crf, -0.7143f)));
+
+    const int16x4x2_t r_zip = vzip_s16(vqmovn_s32(r4), vqmovn_s32(r4));
+    const int16x4x2_t g_zip = vzip_s16(vqmovn_s32(g4), vqmovn_s32(g4));
+    const int16x4x2_t b_zip = vzip_s16(vqmovn_s32(b4), vqmovn_s32(b4));
+    const int16x8_t r8 = vcombine_s16(r_zip.val[0], r_zip.val[1]);
+    const int16x8_t g8 = vcombine_s16(g_zip.val[0], g_zip.val[1]);
+    const int16x8_t b8 = vcombine_s16(b_zip.val[0], b_zip.val[1]);
+
+    const int16x8_t y8 = vld1q_s16(&Yblk[y * 8]);
+    const int16x8_t min_val = vdupq_n_s16(-128);
+    const int16x8_t max_val = vdupq_n_s16(127);
+    const int16x8_t add_val = vdupq_n_s16(addval);
+    const uint16x8_t rr =
+      vreinterpretq_u16_s16(vaddq_s16(vminq_s16(vmaxq_s16(vaddq_s16(y8, r8), min_val), max_val), add_val));
+    const uint16x8_t gg =
+      vreinterpretq_u16_s16(vaddq_s16(vminq_s16(vmaxq_s16(vaddq_s16(y8, g8), min_val), max_val), add_val));
+    const uint16x8_t bb =
+      vreinterpretq_u16_s16(vaddq_s16(vminq_s16(vmaxq_s16(vaddq_s16(y8, b8), min_val), max_val), add_val));
+
+    const uint32x4_t out_lo =
+      vorrq_u32(vmovl_u16(vget_low_u16(rr)), vorrq_u32(vshlq_n_u32(vmovl_u16(vget_low_u16(gg)), 8),
+                                                       vshlq_n_u32(vmovl_u16(vget_low_u16(bb)), 16)));
+    const uint32x4_t out_hi =
+      vorrq_u32(vmovl_u16(vget_high_u16(rr)), vorrq_u32(vshlq_n_u32(vmovl_u16(vget_high_u16(gg)), 8),
+                                                        vshlq_n_u32(vmovl_u16(vget_high_u16(bb)), 16)));
+
+    u32* out_row = &s_block_rgb[xx + ((y + yy) * 16)];
+    vst1q_u32(out_row, out_lo);
+    vst1q_u32(out_row + 4, out_hi);
+  }
+#else
   for (u32 y = 0; y < 8; y++)
   {
     for (u32 x = 0; x < 8; x++)
@@ -858,6 +1032,7 @@ void MDEC::yuv_to_rgb(u32 xx, u32 yy, const std::array<s16, 64>& Crblk, const st
                                                 (ZeroExtend32(static_cast<u16>(B)) << 16);
     }
   }
+#endif
 }
 
 void MDEC::y_to_mono(const std::array<s16, 64>& Yblk)
@@ -18,9 +18,65 @@
 #include "IconsFontAwesome5.h"
 
 #include <cstdio>
+#include <mutex>
+#include <vector>
 
 Log_SetChannel(MemoryCard);
 
+namespace {
+struct CachedCardImage
+{
+  std::string filename;
+  std::time_t modified_time;
+  std::unique_ptr<MemoryCardImage::DataArray> data;
+};
+} // namespace
+
+// Images reused across game switches and disc swaps, keyed on filename+mtime. Sized for both
+// slots' current and previous cards; anything beyond that is evicted oldest-first.
+static constexpr u32 MAX_CACHED_CARD_IMAGES = 4;
+static std::mutex s_cached_images_mutex;
+static std::vector<CachedCardImage> s_cached_images;
+
+static bool LookupCachedImage(const std::string& filename, std::time_t modified_time, MemoryCardImage::DataArray* data)
+{
+  std::unique_lock lock(s_cached_images_mutex);
+  for (const CachedCardImage& entry : s_cached_images)
+  {
+    if (entry.filename == filename)
+    {
+      if (entry.modified_time != modified_time)
+        return false;
+
+      *data = *entry.data;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+static void UpdateCachedImage(const std::string& filename, std::time_t modified_time,
+                              const MemoryCardImage::DataArray& data)
+{
+  std::unique_lock lock(s_cached_images_mutex);
+  for (CachedCardImage& entry : s_cached_images)
+  {
+    if (entry.filename == filename)
+    {
+      entry.modified_time = modified_time;
+      *entry.data = data;
+      return;
+    }
+  }
+
+  if (s_cached_images.size() >= MAX_CACHED_CARD_IMAGES)
+    s_cached_images.erase(s_cached_images.begin());
+
+  s_cached_images.push_back(
+    CachedCardImage{filename, modified_time, std::make_unique<MemoryCardImage::DataArray>(data)});
+}
+
 MemoryCard::MemoryCard()
 {
   m_FLAG.no_write_yet = true;
@@ -33,7 +89,21 @@ MemoryCard::MemoryCard()
 
 MemoryCard::~MemoryCard()
 {
+  EnsureDataLoaded();
   SaveIfChanged(false);
+  WaitForSaveCompletion();
+}
+
+const MemoryCardImage::DataArray& MemoryCard::GetData() const
+{
+  const_cast<MemoryCard*>(this)->EnsureDataLoaded();
+  return m_data;
+}
+
+MemoryCardImage::DataArray& MemoryCard::GetData()
+{
+  EnsureDataLoaded();
+  return m_data;
 }
 
 std::string MemoryCard::SanitizeGameTitleForFileName(const std::string_view& name)
@@ -64,6 +134,8 @@ void MemoryCard::Reset()
 
 bool MemoryCard::DoState(StateWrapper& sw)
 {
+  EnsureDataLoaded();
+
   if (sw.IsReading())
     SaveIfChanged(true);
 
@@ -76,6 +148,11 @@ bool MemoryCard::DoState(StateWrapper& sw)
   sw.Do(&m_data);
   sw.Do(&m_changed);
 
+  // The dirty block mask isn't serialized; after a load we no longer know which blocks match the
+  // file on disk, so flush everything if anything changed.
+  if (sw.IsReading())
+    m_dirty_blocks = m_changed ? ((1u << MemoryCardImage::NUM_BLOCKS) - 1u) : 0;
+
   return !sw.HasError();
 }
 
@@ -90,6 +167,8 @@ void MemoryCard::ResetTransferState()
 
 bool MemoryCard::Transfer(const u8 data_in, u8* data_out)
 {
+  EnsureDataLoaded();
+
   bool ack = false;
 #ifdef _DEBUG
   const State old_state = m_state;
@@ -188,7 +267,11 @@ bool MemoryCard::Transfer(const u8 data_in, u8* data_out)
       }
 
       const u32 offset = ZeroExtend32(m_address) * MemoryCardImage::FRAME_SIZE + m_sector_offset;
-      m_changed |= (m_data[offset] != data_in);
+      if (m_data[offset] != data_in)
+      {
+        m_changed = true;
+        m_dirty_blocks |= (1u << (offset / MemoryCardImage::BLOCK_SIZE));
+      }
       m_data[offset] = data_in;
 
       *data_out = m_last_byte;
@@ -282,21 +365,49 @@ std::unique_ptr<MemoryCard> MemoryCard::Open(std::string_view filename)
 {
   std::unique_ptr<MemoryCard> mc = std::make_unique<MemoryCard>();
   mc->m_filename = filename;
-  if (!mc->LoadFromFile())
+
+  // Disc swaps and game switches reopen the same images; reuse the bytes already in memory when
+  // the file hasn't changed instead of re-reading and re-parsing it on the CPU thread.
+  FILESYSTEM_STAT_DATA sd;
+  const std::time_t modified_time = FileSystem::StatFile(mc->m_filename.c_str(), &sd) ? sd.ModificationTime : 0;
+  if (modified_time != 0 && LookupCachedImage(mc->m_filename, modified_time, &mc->m_data))
   {
-    Log_InfoPrintf("Memory card at '%s' could not be read, formatting.", mc->m_filename.c_str());
-    Host::AddFormattedOSDMessage(5.0f, TRANSLATE("OSDMessage", "Memory card at '%s' could not be read, formatting."),
-                                 mc->m_filename.c_str());
-    mc->Format();
+    Log_DevPrintf("Reusing cached memory card image for '%s'", mc->m_filename.c_str());
+    return mc;
   }
 
+  // Otherwise read it in the background; consecutive opens (the two slots) overlap, and the
+  // result is joined on first access to the data.
+  mc->m_load_thread = std::thread([mc = mc.get(), modified_time]() {
+    mc->m_load_result = mc->LoadFromFile();
+    if (mc->m_load_result)
+      UpdateCachedImage(mc->m_filename, modified_time, mc->m_data);
+  });
+
   return mc;
 }
 
+void MemoryCard::EnsureDataLoaded()
+{
+  if (!m_load_thread.joinable())
+    return;
+
+  m_load_thread.join();
+  if (!m_load_result)
+  {
+    Log_InfoPrintf("Memory card at '%s' could not be read, formatting.", m_filename.c_str());
+    Host::AddFormattedOSDMessage(5.0f, TRANSLATE("OSDMessage", "Memory card at '%s' could not be read, formatting."),
+                                 m_filename.c_str());
+    Format();
+  }
+}
+
 void MemoryCard::Format()
 {
+  EnsureDataLoaded();
   MemoryCardImage::Format(&m_data);
   m_changed = true;
+  m_dirty_blocks = (1u << MemoryCardImage::NUM_BLOCKS) - 1u;
 }
 
 bool MemoryCard::LoadFromFile()
@@ -311,11 +422,19 @@ bool MemoryCard::SaveIfChanged(bool display_osd_message)
   if (!m_changed)
     return true;
 
+  EnsureDataLoaded();
+
+  const u32 dirty_blocks = m_dirty_blocks;
   m_changed = false;
+  m_dirty_blocks = 0;
 
   if (m_filename.empty())
     return false;
 
+  // Only one write per card can be in flight, otherwise the atomic renames could land out of
+  // order and replace a newer image with an older one.
+  WaitForSaveCompletion();
+
   std::string osd_key;
   std::string display_name;
   if (display_osd_message)
@@ -324,29 +443,51 @@ bool MemoryCard::SaveIfChanged(bool display_osd_message)
     display_name = FileSystem::GetDisplayNameFromPath(m_filename);
   }
 
-  if (!MemoryCardImage::SaveToFile(m_data, m_filename.c_str()))
-  {
-    if (display_osd_message)
-    {
-      Host::AddIconOSDMessage(
-        std::move(osd_key), ICON_FA_SD_CARD,
-        fmt::format(TRANSLATE_FS("OSDMessage", "Failed to save memory card to '{}'."), Path::GetFileName(display_name)),
-        20.0f);
-    }
+  // Snapshot the image and write it out on a background thread, so card flushes during gameplay
+  // don't stall the emulation thread on slow storage. Only the blocks which actually changed get
+  // rewritten; full rewrites go to a temporary file which is atomically renamed over the old card,
+  // so a crash mid-write leaves the previous image intact.
+  std::unique_ptr<MemoryCardImage::DataArray> data = std::make_unique<MemoryCardImage::DataArray>(m_data);
+  m_save_thread = std::thread(
+    [dirty_blocks](std::unique_ptr<MemoryCardImage::DataArray> data, std::string filename, std::string osd_key,
+                   std::string display_name, bool display_osd_message) {
+      if (!MemoryCardImage::SaveBlocksToFile(*data, dirty_blocks, filename.c_str()))
+      {
+        if (display_osd_message)
+        {
+          Host::AddIconOSDMessage(std::move(osd_key), ICON_FA_SD_CARD,
+                                  fmt::format(TRANSLATE_FS("OSDMessage", "Failed to save memory card to '{}'."),
+                                              Path::GetFileName(display_name)),
+                                  20.0f);
+        }
 
-    return false;
-  }
+        return;
+      }
 
-  if (display_osd_message)
-  {
-    Host::AddIconOSDMessage(
-      std::move(osd_key), ICON_FA_SD_CARD,
-      fmt::format(TRANSLATE_FS("OSDMessage", "Saved memory card to '{}'."), Path::GetFileName(display_name)), 5.0f);
-  }
+      // keep the cached copy current, so a later reopen of this card doesn't hit the disk
+      FILESYSTEM_STAT_DATA sd;
+      if (FileSystem::StatFile(filename.c_str(), &sd))
+        UpdateCachedImage(filename, sd.ModificationTime, *data);
+
+      if (display_osd_message)
+      {
+        Host::AddIconOSDMessage(
+          std::move(osd_key), ICON_FA_SD_CARD,
+          fmt::format(TRANSLATE_FS("OSDMessage", "Saved memory card to '{}'."), Path::GetFileName(display_name)),
+          5.0f);
+      }
+    },
+    std::move(data), m_filename, std::move(osd_key), std::move(display_name), display_osd_message);
 
   return true;
 }
 
+void MemoryCard::WaitForSaveCompletion()
+{
+  if (m_save_thread.joinable())
+    m_save_thread.join();
+}
+
 void MemoryCard::QueueFileSave()
 {
   // skip if the event is already pending, or we don't have a backing file
@@ -9,6 +9,7 @@
 #include <memory>
 #include <string>
 #include <string_view>
+#include <thread>
 
 class TimingEvent;
 
@@ -25,8 +26,8 @@ public:
   static std::unique_ptr<MemoryCard> Create();
   static std::unique_ptr<MemoryCard> Open(std::string_view filename);
 
-  const MemoryCardImage::DataArray& GetData() const { return m_data; }
-  MemoryCardImage::DataArray& GetData() { return m_data; }
+  const MemoryCardImage::DataArray& GetData() const;
+  MemoryCardImage::DataArray& GetData();
   const std::string& GetFilename() const { return m_filename; }
   void SetFilename(std::string filename) { m_filename = std::move(filename); }
 
@@ -84,8 +85,10 @@ private:
   static TickCount GetSaveDelayInTicks();
 
   bool LoadFromFile();
+  void EnsureDataLoaded();
   bool SaveIfChanged(bool display_osd_message);
   void QueueFileSave();
+  void WaitForSaveCompletion();
 
   std::unique_ptr<TimingEvent> m_save_event;
 
@@ -97,7 +100,17 @@ private:
   u8 m_last_byte = 0;
   bool m_changed = false;
 
+  // bit N set = block N differs from what's on disk, so flushes only rewrite what changed
+  u32 m_dirty_blocks = 0;
+
   MemoryCardImage::DataArray m_data{};
 
   std::string m_filename;
+
+  // in-flight background write of the card image, at most one per card
+  std::thread m_save_thread;
+
+  // in-flight background read of the card image, joined on first data access
+  std::thread m_load_thread;
+  bool m_load_result = true;
 };
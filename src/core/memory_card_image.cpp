@@ -138,6 +138,42 @@ bool MemoryCardImage::SaveToFile(const DataArray& data, const char* filename)
   return true;
 }
 
+bool MemoryCardImage::SaveBlocksToFile(const DataArray& data, u32 dirty_block_mask, const char* filename)
+{
+  // If everything changed anyway, go through the atomic temp-file-and-rename path.
+  if (dirty_block_mask == ((1u << NUM_BLOCKS) - 1u))
+    return SaveToFile(data, filename);
+
+  std::unique_ptr<ByteStream> stream =
+    ByteStream::OpenFile(filename, BYTESTREAM_OPEN_READ | BYTESTREAM_OPEN_WRITE | BYTESTREAM_OPEN_SEEKABLE);
+  if (!stream || stream->GetSize() != DATA_SIZE)
+  {
+    // No existing image to patch, write the whole thing out.
+    return SaveToFile(data, filename);
+  }
+
+  for (u32 i = 0; i < NUM_BLOCKS; i++)
+  {
+    if (!(dirty_block_mask & (1u << i)))
+      continue;
+
+    if (!stream->SeekAbsolute(i * BLOCK_SIZE) || !stream->Write2(&data[i * BLOCK_SIZE], BLOCK_SIZE))
+    {
+      Log_ErrorFmt("Failed to write block {} to '{}'", i, filename);
+      return false;
+    }
+  }
+
+  if (!stream->Flush())
+  {
+    Log_ErrorFmt("Failed to flush '{}'", filename);
+    return false;
+  }
+
+  Log_VerboseFmt("Updated blocks 0x{:04X} in '{}'", dirty_block_mask, filename);
+  return true;
+}
+
 bool MemoryCardImage::IsValid(const DataArray& data)
 {
   // TODO: Check checksum?
@@ -28,6 +28,10 @@ using DataArray = std::array<u8, DATA_SIZE>;
 bool LoadFromFile(DataArray* data, const char* filename);
 bool SaveToFile(const DataArray& data, const char* filename);
 
+/// Rewrites only the blocks set in dirty_block_mask (bit N = block N) in an existing image file.
+/// Falls back to writing the whole image if the file is missing or the wrong size.
+bool SaveBlocksToFile(const DataArray& data, u32 dirty_block_mask, const char* filename);
+
 void Format(DataArray* data);
 
 struct IconFrame
@@ -886,11 +886,20 @@ void Pad::DoACK()
     InterruptController::InterruptRequest(InterruptController::IRQ::IRQ7);
   }
 
-  EndTransfer();
-  UpdateJoyStat();
-
   if (CanTransfer())
+  {
+    // The next TX byte is already queued, which is the usual case in the middle of a controller
+    // poll. Go straight into the next transfer so the event is rescheduled in place, instead of
+    // deactivating it here and reactivating it in BeginTransfer().
+    s_state = State::Idle;
+    UpdateJoyStat();
     BeginTransfer();
+  }
+  else
+  {
+    EndTransfer();
+    UpdateJoyStat();
+  }
 }
 
 void Pad::EndTransfer()
@@ -8,6 +8,8 @@
 #include "common/string_util.h"
 #include "cpu_core.h"
 #include "settings.h"
+
+#include <algorithm>
 Log_SetChannel(PCDrv);
 
 static constexpr u32 MAX_FILES = 100;
@@ -219,24 +221,27 @@ bool PCDrv::HandleSyscall(u32 instruction_bits, CPU::Registers& regs)
 
       const u32 count = regs.a2;
       u32 dstaddr = regs.a3;
-      for (u32 i = 0; i < count; i++)
+      u32 remaining = count;
+      u8 chunk[512];
+      while (remaining > 0)
       {
-        // Certainly less than optimal, but it's not like you're going to be reading megabytes of data here.
-        u8 val;
-        if (std::fread(&val, 1, 1, fp) != 1)
+        const u32 size = std::min<u32>(remaining, sizeof(chunk));
+        const size_t bytes_read = std::fread(chunk, 1, size, fp);
+        if (bytes_read != size)
         {
-          // Does not stop at EOF according to psx-spx.
           if (std::ferror(fp) != 0)
           {
             RETURN_ERROR();
             return true;
           }
 
-          val = 0;
+          // Does not stop at EOF according to psx-spx.
+          std::memset(chunk + bytes_read, 0, size - static_cast<u32>(bytes_read));
         }
 
-        CPU::SafeWriteMemoryByte(dstaddr, val);
-        dstaddr++;
+        CPU::SafeWriteMemoryBytes(dstaddr, chunk, size);
+        dstaddr += size;
+        remaining -= size;
       }
 
       regs.v0 = 0;
@@ -258,20 +263,21 @@ bool PCDrv::HandleSyscall(u32 instruction_bits, CPU::Registers& regs)
       const u32 count = regs.a2;
       u32 srcaddr = regs.a3;
       u32 written = 0;
-      for (u32 i = 0; i < count; i++)
+      u8 chunk[512];
+      while (written < count)
       {
-        u8 val;
-        if (!CPU::SafeReadMemoryByte(srcaddr, &val))
+        const u32 size = std::min<u32>(count - written, sizeof(chunk));
+        if (!CPU::SafeReadMemoryBytes(srcaddr, chunk, size))
           break;
 
-        if (std::fwrite(&val, 1, 1, fp) != 1)
+        if (std::fwrite(chunk, size, 1, fp) != 1)
         {
           RETURN_ERROR();
           return true;
         }
 
-        srcaddr++;
-        written++;
+        srcaddr += size;
+        written += size;
       }
 
       regs.v0 = 0;
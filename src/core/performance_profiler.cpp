@@ -0,0 +1,207 @@
+// SPDX-FileCopyrightText: 2019-2023 Connor McLaughlin <stenzek@gmail.com>
+// SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
+
+#include "performance_profiler.h"
+#include "settings.h"
+
+#include "util/imgui_manager.h"
+
+#include "common/assert.h"
+#include "common/file_system.h"
+#include "common/log.h"
+#include "common/path.h"
+
+#include "fmt/chrono.h"
+#include "fmt/format.h"
+
+#include <ctime>
+#include <mutex>
+#include <vector>
+
+Log_SetChannel(PerformanceProfiler);
+
+namespace PerformanceProfiler {
+static constexpr u32 NUM_EVENTS = static_cast<u32>(Event::Count);
+static constexpr u32 MAX_SCOPE_DEPTH = 16;
+
+struct ScopeStackEntry
+{
+  Event event;
+  Common::Timer::Value start;
+  u64 child_time;
+};
+
+struct TraceEvent
+{
+  Event event;
+  Common::Timer::Value start;
+  u64 duration;
+};
+
+// current-frame accumulators, reset by EndFrame()
+static std::array<u64, NUM_EVENTS> s_frame_ticks{};
+static std::array<u32, NUM_EVENTS> s_frame_counts{};
+static std::array<EventStats, NUM_EVENTS> s_stats;
+static u32 s_history_position = 0;
+
+static thread_local ScopeStackEntry s_scope_stack[MAX_SCOPE_DEPTH];
+static thread_local u32 s_scope_depth = 0;
+
+static std::mutex s_trace_mutex;
+static std::vector<TraceEvent> s_trace_events;
+static std::string s_trace_path;
+static Common::Timer::Value s_trace_start;
+static bool s_trace_active = false;
+} // namespace PerformanceProfiler
+
+const char* PerformanceProfiler::GetEventName(Event event)
+{
+  static constexpr std::array<const char*, NUM_EVENTS> names = {
+    {"CPU Execute", "GPU Commands", "SPU Execute", "DMA Transfer", "Present"}};
+  return names[static_cast<u32>(event)];
+}
+
+const PerformanceProfiler::EventStats& PerformanceProfiler::GetEventStats(Event event)
+{
+  return s_stats[static_cast<u32>(event)];
+}
+
+u32 PerformanceProfiler::GetHistoryPosition()
+{
+  return s_history_position;
+}
+
+void PerformanceProfiler::Internal::BeginScope(Event event)
+{
+  DebugAssert(s_scope_depth < MAX_SCOPE_DEPTH);
+  ScopeStackEntry& entry = s_scope_stack[s_scope_depth++];
+  entry.event = event;
+  entry.start = Common::Timer::GetCurrentValue();
+  entry.child_time = 0;
+}
+
+void PerformanceProfiler::Internal::EndScope()
+{
+  const Common::Timer::Value now = Common::Timer::GetCurrentValue();
+  const ScopeStackEntry& entry = s_scope_stack[--s_scope_depth];
+  const u64 elapsed = now - entry.start;
+
+  // exclusive time: children have already subtracted themselves from us
+  s_frame_ticks[static_cast<u32>(entry.event)] += elapsed - entry.child_time;
+  s_frame_counts[static_cast<u32>(entry.event)]++;
+  if (s_scope_depth > 0)
+    s_scope_stack[s_scope_depth - 1].child_time += elapsed;
+
+  if (s_trace_active)
+  {
+    std::unique_lock lock(s_trace_mutex);
+    if (s_trace_active)
+      s_trace_events.push_back({entry.event, entry.start, elapsed});
+  }
+}
+
+void PerformanceProfiler::Reset()
+{
+  s_frame_ticks.fill(0);
+  s_frame_counts.fill(0);
+  s_stats = {};
+  s_history_position = 0;
+}
+
+void PerformanceProfiler::EndFrame()
+{
+  for (u32 i = 0; i < NUM_EVENTS; i++)
+  {
+    EventStats& stats = s_stats[i];
+    const float ms = static_cast<float>(Common::Timer::ConvertValueToMilliseconds(s_frame_ticks[i]));
+    stats.history_ms[s_history_position] = ms;
+    stats.last_ms = ms;
+    stats.last_count = s_frame_counts[i];
+
+    float sum = 0.0f;
+    float max = 0.0f;
+    for (const float value : stats.history_ms)
+    {
+      sum += value;
+      max = std::max(max, value);
+    }
+    stats.avg_ms = sum / static_cast<float>(HISTORY_SIZE);
+    stats.max_ms = max;
+
+    s_frame_ticks[i] = 0;
+    s_frame_counts[i] = 0;
+  }
+
+  s_history_position = (s_history_position + 1) % HISTORY_SIZE;
+}
+
+bool PerformanceProfiler::StartTrace(std::string path)
+{
+  std::unique_lock lock(s_trace_mutex);
+  if (s_trace_active)
+    return false;
+
+  s_trace_path = std::move(path);
+  s_trace_events.clear();
+  s_trace_events.reserve(1024 * 1024);
+  s_trace_start = Common::Timer::GetCurrentValue();
+  s_trace_active = true;
+  Log_InfoPrintf("Started profiler trace to '%s'", s_trace_path.c_str());
+  return true;
+}
+
+bool PerformanceProfiler::StopTrace()
+{
+  std::unique_lock lock(s_trace_mutex);
+  if (!s_trace_active)
+    return false;
+
+  s_trace_active = false;
+
+  // chrome://tracing "complete" events, timestamps in microseconds
+  std::string json;
+  json.reserve(s_trace_events.size() * 80 + 64);
+  json.append("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+  for (size_t i = 0; i < s_trace_events.size(); i++)
+  {
+    const TraceEvent& te = s_trace_events[i];
+    fmt::format_to(std::back_inserter(json), "{}{{\"name\":\"{}\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":{:.3f},\"dur\":{:.3f}}}",
+                   (i > 0) ? "," : "", GetEventName(te.event),
+                   Common::Timer::ConvertValueToSeconds(te.start - s_trace_start) * 1000000.0,
+                   Common::Timer::ConvertValueToSeconds(te.duration) * 1000000.0);
+  }
+  json.append("]}");
+
+  const bool result = FileSystem::WriteStringToFile(s_trace_path.c_str(), json);
+  if (result)
+    Log_InfoPrintf("Wrote profiler trace with %zu events to '%s'", s_trace_events.size(), s_trace_path.c_str());
+  else
+    Log_ErrorPrintf("Failed to write profiler trace to '%s'", s_trace_path.c_str());
+
+  s_trace_events = {};
+  return result;
+}
+
+bool PerformanceProfiler::IsTracing()
+{
+  return s_trace_active;
+}
+
+void PerformanceProfiler::ToggleTrace()
+{
+  if (!s_trace_active)
+  {
+    std::string path(Path::Combine(
+      EmuFolders::DataRoot, fmt::format("profiler-trace-{:%Y-%m-%d-%H-%M-%S}.json", fmt::localtime(std::time(nullptr)))));
+    if (StartTrace(path))
+      Host::AddOSDMessage(fmt::format("Recording profiler trace to '{}'.", Path::GetFileName(path)), 5.0f);
+  }
+  else
+  {
+    const std::string filename(Path::GetFileName(s_trace_path));
+    if (StopTrace())
+      Host::AddOSDMessage(fmt::format("Wrote profiler trace to '{}'.", filename), 5.0f);
+    else
+      Host::AddOSDMessage("Failed to write profiler trace.", 10.0f);
+  }
+}
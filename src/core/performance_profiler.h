@@ -0,0 +1,77 @@
+// SPDX-FileCopyrightText: 2019-2023 Connor McLaughlin <stenzek@gmail.com>
+// SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
+
+#pragma once
+
+#include "types.h"
+
+#include "common/timer.h"
+
+#include <array>
+#include <string>
+
+/// Lightweight always-compiled-in profiler for the main emulation subsystems. Scopes accumulate
+/// exclusive time (child scopes are subtracted from their parent), EndFrame() folds the totals
+/// into a per-event frame history for the overlay, and traces can be captured to a
+/// chrome://tracing-compatible JSON file for offline analysis.
+namespace PerformanceProfiler {
+enum class Event : u32
+{
+  CPUExecute,
+  GPUCommands,
+  SPUExecute,
+  DMATransfer,
+  Present,
+  Count
+};
+
+/// Number of frames of history kept for the overlay plots.
+static constexpr u32 HISTORY_SIZE = 128;
+
+struct EventStats
+{
+  std::array<float, HISTORY_SIZE> history_ms{};
+  float last_ms = 0.0f;
+  float avg_ms = 0.0f;
+  float max_ms = 0.0f;
+  u32 last_count = 0;
+};
+
+const char* GetEventName(Event event);
+
+/// Returns the accumulated statistics for an event. Only valid on the CPU thread.
+const EventStats& GetEventStats(Event event);
+
+/// Returns the ring write position for the frame history, i.e. the values_offset for plots.
+u32 GetHistoryPosition();
+
+/// Clears accumulated statistics and history, called on system boot.
+void Reset();
+
+/// Folds the current frame's samples into the history. Called once per emulated frame.
+void EndFrame();
+
+/// Starts recording scopes to an in-memory trace, dumped as chrome://tracing JSON on stop.
+bool StartTrace(std::string path);
+
+/// Stops a running trace and writes it out. Returns false if the file could not be written.
+bool StopTrace();
+
+bool IsTracing();
+
+/// Hotkey helper; starts a trace with a timestamped filename, or stops and writes the active one.
+void ToggleTrace();
+
+namespace Internal {
+void BeginScope(Event event);
+void EndScope();
+} // namespace Internal
+
+/// Accumulates the time between construction and destruction against the given event.
+class Scope
+{
+public:
+  ALWAYS_INLINE Scope(Event event) { Internal::BeginScope(event); }
+  ALWAYS_INLINE ~Scope() { Internal::EndScope(); }
+};
+} // namespace PerformanceProfiler
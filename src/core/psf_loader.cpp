@@ -7,14 +7,56 @@
 #include "common/file_system.h"
 #include "common/log.h"
 #include "common/path.h"
+#include "common/thread_pool.h"
 #include "system.h"
 #include "zlib.h"
 #include <cctype>
 #include <cstring>
+#include <memory>
+#include <mutex>
 Log_SetChannel(PSFLoader);
 
 namespace PSFLoader {
 
+namespace {
+struct CachedFile
+{
+  std::shared_ptr<const File> file;
+  std::time_t modification_time;
+};
+} // namespace
+
+// The same psflib is referenced by every track of a minipsf set, so parsed (and inflated) files
+// are cached across loads, keyed by path and validated against the modification time. Guarded
+// because Prefetch() fills the cache from a worker thread.
+static std::mutex s_file_cache_mutex;
+static std::map<std::string, CachedFile> s_file_cache;
+
+static std::shared_ptr<const File> LoadFile(const char* path)
+{
+  FILESYSTEM_STAT_DATA sd;
+  const bool have_stat = FileSystem::StatFile(path, &sd);
+  if (have_stat)
+  {
+    std::unique_lock lock(s_file_cache_mutex);
+    const auto it = s_file_cache.find(path);
+    if (it != s_file_cache.end() && it->second.modification_time == sd.ModificationTime)
+      return it->second.file;
+  }
+
+  std::shared_ptr<File> file = std::make_shared<File>();
+  if (!file->Load(path))
+    return {};
+
+  if (have_stat)
+  {
+    std::unique_lock lock(s_file_cache_mutex);
+    s_file_cache[path] = CachedFile{file, sd.ModificationTime};
+  }
+
+  return file;
+}
+
 std::optional<std::string> File::GetTagString(const char* tag_name) const
 {
   auto it = m_tags.find(tag_name);
@@ -175,15 +217,15 @@ static bool LoadLibraryPSF(const char* path, bool use_pc_sp, u32 depth = 0)
     return false;
   }
 
-  File file;
-  if (!file.Load(path))
+  const std::shared_ptr<const File> file = LoadFile(path);
+  if (!file)
   {
     Log_ErrorPrintf("Failed to load main PSF '%s'", path);
     return false;
   }
 
   // load the main parent library - this has to be done first so the specified PSF takes precedence
-  std::optional<std::string> lib_name(file.GetTagString("_lib"));
+  std::optional<std::string> lib_name(file->GetTagString("_lib"));
   if (lib_name.has_value())
   {
     const std::string lib_path(Path::BuildRelativePath(path, lib_name.value()));
@@ -203,7 +245,7 @@ static bool LoadLibraryPSF(const char* path, bool use_pc_sp, u32 depth = 0)
   }
 
   // apply the main psf
-  if (!System::InjectEXEFromBuffer(file.GetProgramData().data(), static_cast<u32>(file.GetProgramData().size()),
+  if (!System::InjectEXEFromBuffer(file->GetProgramData().data(), static_cast<u32>(file->GetProgramData().size()),
                                    use_pc_sp))
   {
     Log_ErrorPrintf("Failed to parse EXE from PSF '%s'", path);
@@ -214,7 +256,7 @@ static bool LoadLibraryPSF(const char* path, bool use_pc_sp, u32 depth = 0)
   u32 lib_counter = 2;
   for (;;)
   {
-    lib_name = file.GetTagString(TinyString::from_fmt("_lib{}", lib_counter++));
+    lib_name = file->GetTagString(TinyString::from_fmt("_lib{}", lib_counter++));
     if (!lib_name.has_value())
       break;
 
@@ -236,4 +278,30 @@ bool Load(const char* path)
   return LoadLibraryPSF(path, true);
 }
 
+static void PrefetchPSF(const std::string& path, u32 depth)
+{
+  if (depth >= 10)
+    return;
+
+  const std::shared_ptr<const File> file = LoadFile(path.c_str());
+  if (!file)
+    return;
+
+  std::optional<std::string> lib_name(file->GetTagString("_lib"));
+  u32 lib_counter = 2;
+  while (lib_name.has_value())
+  {
+    PrefetchPSF(Path::BuildRelativePath(path, lib_name.value()), depth + 1);
+    lib_name = file->GetTagString(TinyString::from_fmt("_lib{}", lib_counter++));
+  }
+}
+
+void Prefetch(const char* path)
+{
+  // Warms the cache for the next queued track while the current one plays. The track file itself
+  // is small; the win is pulling the read and inflation of its psflib chain off the boot path.
+  Threading::ThreadPool::GetInstance().QueueTask([path = std::string(path)]() { PrefetchPSF(path, 0); },
+                                                 Threading::ThreadPool::Priority::Low);
+}
+
 } // namespace PSFLoader
\ No newline at end of file
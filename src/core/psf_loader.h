@@ -55,4 +55,9 @@ private:
 
 bool Load(const char* path);
 
+/// Asynchronously loads the specified PSF and its library chain into the file cache, so a
+/// subsequent Load() doesn't touch the disk. Intended for queued playback: prefetch the next
+/// track while the current one plays.
+void Prefetch(const char* path);
+
 } // namespace PSFLoader
\ No newline at end of file
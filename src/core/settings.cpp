@@ -170,6 +170,9 @@ void Settings::Load(SettingsInterface& si)
   cpu_recompiler_memory_exceptions = si.GetBoolValue("CPU", "RecompilerMemoryExceptions", false);
   cpu_recompiler_block_linking = si.GetBoolValue("CPU", "RecompilerBlockLinking", true);
   cpu_recompiler_icache = si.GetBoolValue("CPU", "RecompilerICache", false);
+  cpu_recompiler_async_compile = si.GetBoolValue("CPU", "RecompilerAsyncCompilation", false);
+  cpu_cached_interpreter_superblocks = si.GetBoolValue("CPU", "CachedInterpreterSuperblocks", false);
+  cpu_idle_loop_detection = si.GetBoolValue("CPU", "IdleLoopDetection", false);
   cpu_fastmem_mode = ParseCPUFastmemMode(
                        si.GetStringValue("CPU", "FastmemMode", GetCPUFastmemModeName(DEFAULT_CPU_FASTMEM_MODE)).c_str())
                        .value_or(DEFAULT_CPU_FASTMEM_MODE);
@@ -178,6 +181,7 @@ void Settings::Load(SettingsInterface& si)
                    .value_or(DEFAULT_GPU_RENDERER);
   gpu_adapter = si.GetStringValue("GPU", "Adapter", "");
   gpu_resolution_scale = static_cast<u32>(si.GetIntValue("GPU", "ResolutionScale", 1));
+  gpu_dynamic_resolution_scale = si.GetBoolValue("GPU", "DynamicResolutionScale", false);
   gpu_multisamples = static_cast<u32>(si.GetIntValue("GPU", "Multisamples", 1));
   gpu_use_debug_device = si.GetBoolValue("GPU", "UseDebugDevice", false);
   gpu_disable_shader_cache = si.GetBoolValue("GPU", "DisableShaderCache", false);
@@ -185,8 +189,10 @@ void Settings::Load(SettingsInterface& si)
   gpu_disable_framebuffer_fetch = si.GetBoolValue("GPU", "DisableFramebufferFetch", false);
   gpu_per_sample_shading = si.GetBoolValue("GPU", "PerSampleShading", false);
   gpu_use_thread = si.GetBoolValue("GPU", "UseThread", true);
+  gpu_sw_parallel_rasterization = si.GetBoolValue("GPU", "SWParallelRasterization", false);
   gpu_use_software_renderer_for_readbacks = si.GetBoolValue("GPU", "UseSoftwareRendererForReadbacks", false);
   gpu_threaded_presentation = si.GetBoolValue("GPU", "ThreadedPresentation", true);
+  gpu_max_queued_frames = si.GetUIntValue("GPU", "MaxQueuedFrames", 0u);
   gpu_true_color = si.GetBoolValue("GPU", "TrueColor", true);
   gpu_scaled_dithering = si.GetBoolValue("GPU", "ScaledDithering", true);
   gpu_texture_filter =
@@ -206,12 +212,14 @@ void Settings::Load(SettingsInterface& si)
   gpu_force_ntsc_timings = si.GetBoolValue("GPU", "ForceNTSCTimings", false);
   gpu_widescreen_hack = si.GetBoolValue("GPU", "WidescreenHack", false);
   gpu_24bit_chroma_smoothing = si.GetBoolValue("GPU", "ChromaSmoothing24Bit", false);
+  gpu_motion_adaptive_deinterlacing = si.GetBoolValue("GPU", "MotionAdaptiveDeinterlacing", false);
   gpu_pgxp_enable = si.GetBoolValue("GPU", "PGXPEnable", false);
   gpu_pgxp_culling = si.GetBoolValue("GPU", "PGXPCulling", true);
   gpu_pgxp_texture_correction = si.GetBoolValue("GPU", "PGXPTextureCorrection", true);
   gpu_pgxp_color_correction = si.GetBoolValue("GPU", "PGXPColorCorrection", false);
   gpu_pgxp_vertex_cache = si.GetBoolValue("GPU", "PGXPVertexCache", false);
   gpu_pgxp_cpu = si.GetBoolValue("GPU", "PGXPCPU", false);
+  gpu_pgxp_vertex_only = si.GetBoolValue("GPU", "PGXPVertexOnly", false);
   gpu_pgxp_preserve_proj_fp = si.GetBoolValue("GPU", "PGXPPreserveProjFP", false);
   gpu_pgxp_tolerance = si.GetFloatValue("GPU", "PGXPTolerance", -1.0f);
   gpu_pgxp_depth_buffer = si.GetBoolValue("GPU", "PGXPDepthBuffer", false);
@@ -248,6 +256,8 @@ void Settings::Load(SettingsInterface& si)
   display_show_cpu = si.GetBoolValue("Display", "ShowCPU", false);
   display_show_gpu = si.GetBoolValue("Display", "ShowGPU", false);
   display_show_frame_times = si.GetBoolValue("Display", "ShowFrameTimes", false);
+  display_show_profiler = si.GetBoolValue("Display", "ShowProfiler", false);
+  display_show_latency = si.GetBoolValue("Display", "ShowInputLatency", false);
   display_show_status_indicators = si.GetBoolValue("Display", "ShowStatusIndicators", true);
   display_show_inputs = si.GetBoolValue("Display", "ShowInputs", false);
   display_show_enhancements = si.GetBoolValue("Display", "ShowEnhancements", false);
@@ -266,6 +276,8 @@ void Settings::Load(SettingsInterface& si)
       .value_or(DEFAULT_CDROM_MECHACON_VERSION);
   cdrom_region_check = si.GetBoolValue("CDROM", "RegionCheck", false);
   cdrom_load_image_to_ram = si.GetBoolValue("CDROM", "LoadImageToRAM", false);
+  cdrom_precache_in_background = si.GetBoolValue("CDROM", "PrecacheInBackground", false);
+  cdrom_precache_size_limit_mb = static_cast<u16>(si.GetUIntValue("CDROM", "PrecacheSizeLimitMB", 0u));
   cdrom_load_image_patches = si.GetBoolValue("CDROM", "LoadImagePatches", false);
   cdrom_mute_cd_audio = si.GetBoolValue("CDROM", "MuteCDAudio", false);
   cdrom_read_speedup = si.GetIntValue("CDROM", "ReadSpeedup", 1);
@@ -282,6 +294,7 @@ void Settings::Load(SettingsInterface& si)
       .value_or(DEFAULT_AUDIO_STRETCH_MODE);
   audio_output_latency_ms = si.GetUIntValue("Audio", "OutputLatencyMS", DEFAULT_AUDIO_OUTPUT_LATENCY_MS);
   audio_buffer_ms = si.GetUIntValue("Audio", "BufferMS", DEFAULT_AUDIO_BUFFER_MS);
+  audio_adaptive_buffer_size = si.GetBoolValue("Audio", "AdaptiveBufferSize", false);
   audio_output_volume = si.GetUIntValue("Audio", "OutputVolume", 100);
   audio_fast_forward_volume = si.GetUIntValue("Audio", "FastForwardVolume", 100);
 
@@ -300,6 +313,7 @@ void Settings::Load(SettingsInterface& si)
 
   bios_tty_logging = si.GetBoolValue("BIOS", "TTYLogging", false);
   bios_patch_fast_boot = si.GetBoolValue("BIOS", "PatchFastBoot", DEFAULT_FAST_BOOT_VALUE);
+  bios_hle_memory_functions = si.GetBoolValue("BIOS", "HLEMemoryFunctions", false);
 
   multitap_mode =
     ParseMultitapModeName(
@@ -360,6 +374,7 @@ void Settings::Load(SettingsInterface& si)
                 .value_or(DEFAULT_LOG_LEVEL);
   log_filter = si.GetStringValue("Logging", "LogFilter", "");
   log_timestamps = si.GetBoolValue("Logging", "LogTimestamps", true);
+  log_async = si.GetBoolValue("Logging", "LogAsync", false);
   log_to_console = si.GetBoolValue("Logging", "LogToConsole", DEFAULT_LOG_TO_CONSOLE);
   log_to_debug = si.GetBoolValue("Logging", "LogToDebug", false);
   log_to_window = si.GetBoolValue("Logging", "LogToWindow", false);
@@ -376,6 +391,8 @@ void Settings::Load(SettingsInterface& si)
   debugging.show_timers_state = si.GetBoolValue("Debug", "ShowTimersState");
   debugging.show_mdec_state = si.GetBoolValue("Debug", "ShowMDECState");
   debugging.show_dma_state = si.GetBoolValue("Debug", "ShowDMAState");
+  debugging.show_code_cache_state = si.GetBoolValue("Debug", "ShowCodeCacheState");
+  debugging.show_memory_state = si.GetBoolValue("Debug", "ShowMemoryState");
 
   texture_replacements.enable_vram_write_replacements =
     si.GetBoolValue("TextureReplacements", "EnableVRAMWriteReplacements", false);
@@ -431,11 +448,15 @@ void Settings::Save(SettingsInterface& si) const
   si.SetBoolValue("CPU", "RecompilerMemoryExceptions", cpu_recompiler_memory_exceptions);
   si.SetBoolValue("CPU", "RecompilerBlockLinking", cpu_recompiler_block_linking);
   si.SetBoolValue("CPU", "RecompilerICache", cpu_recompiler_icache);
+  si.SetBoolValue("CPU", "RecompilerAsyncCompilation", cpu_recompiler_async_compile);
+  si.SetBoolValue("CPU", "CachedInterpreterSuperblocks", cpu_cached_interpreter_superblocks);
+  si.SetBoolValue("CPU", "IdleLoopDetection", cpu_idle_loop_detection);
   si.SetStringValue("CPU", "FastmemMode", GetCPUFastmemModeName(cpu_fastmem_mode));
 
   si.SetStringValue("GPU", "Renderer", GetRendererName(gpu_renderer));
   si.SetStringValue("GPU", "Adapter", gpu_adapter.c_str());
   si.SetIntValue("GPU", "ResolutionScale", static_cast<long>(gpu_resolution_scale));
+  si.SetBoolValue("GPU", "DynamicResolutionScale", gpu_dynamic_resolution_scale);
   si.SetIntValue("GPU", "Multisamples", static_cast<long>(gpu_multisamples));
   si.SetBoolValue("GPU", "UseDebugDevice", gpu_use_debug_device);
   si.SetBoolValue("GPU", "DisableShaderCache", gpu_disable_shader_cache);
@@ -443,7 +464,9 @@ void Settings::Save(SettingsInterface& si) const
   si.SetBoolValue("GPU", "DisableFramebufferFetch", gpu_disable_framebuffer_fetch);
   si.SetBoolValue("GPU", "PerSampleShading", gpu_per_sample_shading);
   si.SetBoolValue("GPU", "UseThread", gpu_use_thread);
+  si.SetBoolValue("GPU", "SWParallelRasterization", gpu_sw_parallel_rasterization);
   si.SetBoolValue("GPU", "ThreadedPresentation", gpu_threaded_presentation);
+  si.SetUIntValue("GPU", "MaxQueuedFrames", gpu_max_queued_frames);
   si.SetBoolValue("GPU", "UseSoftwareRendererForReadbacks", gpu_use_software_renderer_for_readbacks);
   si.SetBoolValue("GPU", "TrueColor", gpu_true_color);
   si.SetBoolValue("GPU", "ScaledDithering", gpu_scaled_dithering);
@@ -455,12 +478,14 @@ void Settings::Save(SettingsInterface& si) const
   si.SetBoolValue("GPU", "ForceNTSCTimings", gpu_force_ntsc_timings);
   si.SetBoolValue("GPU", "WidescreenHack", gpu_widescreen_hack);
   si.SetBoolValue("GPU", "ChromaSmoothing24Bit", gpu_24bit_chroma_smoothing);
+  si.SetBoolValue("GPU", "MotionAdaptiveDeinterlacing", gpu_motion_adaptive_deinterlacing);
   si.SetBoolValue("GPU", "PGXPEnable", gpu_pgxp_enable);
   si.SetBoolValue("GPU", "PGXPCulling", gpu_pgxp_culling);
   si.SetBoolValue("GPU", "PGXPTextureCorrection", gpu_pgxp_texture_correction);
   si.SetBoolValue("GPU", "PGXPColorCorrection", gpu_pgxp_color_correction);
   si.SetBoolValue("GPU", "PGXPVertexCache", gpu_pgxp_vertex_cache);
   si.SetBoolValue("GPU", "PGXPCPU", gpu_pgxp_cpu);
+  si.SetBoolValue("GPU", "PGXPVertexOnly", gpu_pgxp_vertex_only);
   si.SetBoolValue("GPU", "PGXPPreserveProjFP", gpu_pgxp_preserve_proj_fp);
   si.SetFloatValue("GPU", "PGXPTolerance", gpu_pgxp_tolerance);
   si.SetBoolValue("GPU", "PGXPDepthBuffer", gpu_pgxp_depth_buffer);
@@ -484,6 +509,8 @@ void Settings::Save(SettingsInterface& si) const
   si.SetBoolValue("Display", "ShowCPU", display_show_cpu);
   si.SetBoolValue("Display", "ShowGPU", display_show_gpu);
   si.SetBoolValue("Display", "ShowFrameTimes", display_show_frame_times);
+  si.SetBoolValue("Display", "ShowProfiler", display_show_profiler);
+  si.SetBoolValue("Display", "ShowInputLatency", display_show_latency);
   si.SetBoolValue("Display", "ShowStatusIndicators", display_show_status_indicators);
   si.SetBoolValue("Display", "ShowInputs", display_show_inputs);
   si.SetBoolValue("Display", "ShowEnhancements", display_show_enhancements);
@@ -498,6 +525,8 @@ void Settings::Save(SettingsInterface& si) const
   si.SetStringValue("CDROM", "MechaconVersion", GetCDROMMechVersionName(cdrom_mechacon_version));
   si.SetBoolValue("CDROM", "RegionCheck", cdrom_region_check);
   si.SetBoolValue("CDROM", "LoadImageToRAM", cdrom_load_image_to_ram);
+  si.SetBoolValue("CDROM", "PrecacheInBackground", cdrom_precache_in_background);
+  si.SetUIntValue("CDROM", "PrecacheSizeLimitMB", cdrom_precache_size_limit_mb);
   si.SetBoolValue("CDROM", "LoadImagePatches", cdrom_load_image_patches);
   si.SetBoolValue("CDROM", "MuteCDAudio", cdrom_mute_cd_audio);
   si.SetIntValue("CDROM", "ReadSpeedup", cdrom_read_speedup);
@@ -508,6 +537,7 @@ void Settings::Save(SettingsInterface& si) const
   si.SetStringValue("Audio", "OutputDevice", audio_output_device.c_str());
   si.SetStringValue("Audio", "StretchMode", AudioStream::GetStretchModeName(audio_stretch_mode));
   si.SetUIntValue("Audio", "BufferMS", audio_buffer_ms);
+  si.SetBoolValue("Audio", "AdaptiveBufferSize", audio_adaptive_buffer_size);
   si.SetUIntValue("Audio", "OutputLatencyMS", audio_output_latency_ms);
   si.SetUIntValue("Audio", "OutputVolume", audio_output_volume);
   si.SetUIntValue("Audio", "FastForwardVolume", audio_fast_forward_volume);
@@ -526,6 +556,7 @@ void Settings::Save(SettingsInterface& si) const
 
   si.SetBoolValue("BIOS", "TTYLogging", bios_tty_logging);
   si.SetBoolValue("BIOS", "PatchFastBoot", bios_patch_fast_boot);
+  si.SetBoolValue("BIOS", "HLEMemoryFunctions", bios_hle_memory_functions);
 
   for (u32 i = 0; i < NUM_CONTROLLER_AND_CARD_PORTS; i++)
     si.SetStringValue(Controller::GetSettingsSection(i).c_str(), "Type", GetControllerTypeName(controller_types[i]));
@@ -563,6 +594,7 @@ void Settings::Save(SettingsInterface& si) const
   si.SetStringValue("Logging", "LogLevel", GetLogLevelName(log_level));
   si.SetStringValue("Logging", "LogFilter", log_filter.c_str());
   si.SetBoolValue("Logging", "LogTimestamps", log_timestamps);
+  si.SetBoolValue("Logging", "LogAsync", log_async);
   si.SetBoolValue("Logging", "LogToConsole", log_to_console);
   si.SetBoolValue("Logging", "LogToDebug", log_to_debug);
   si.SetBoolValue("Logging", "LogToWindow", log_to_window);
@@ -577,6 +609,8 @@ void Settings::Save(SettingsInterface& si) const
   si.SetBoolValue("Debug", "ShowTimersState", debugging.show_timers_state);
   si.SetBoolValue("Debug", "ShowMDECState", debugging.show_mdec_state);
   si.SetBoolValue("Debug", "ShowDMAState", debugging.show_dma_state);
+  si.SetBoolValue("Debug", "ShowCodeCacheState", debugging.show_code_cache_state);
+  si.SetBoolValue("Debug", "ShowMemoryState", debugging.show_memory_state);
 
   si.SetBoolValue("TextureReplacements", "EnableVRAMWriteReplacements",
                   texture_replacements.enable_vram_write_replacements);
@@ -609,6 +643,7 @@ void Settings::FixIncompatibleSettings(bool display_osd_messages)
     g_settings.gpu_widescreen_hack = false;
     g_settings.gpu_pgxp_enable = false;
     g_settings.gpu_24bit_chroma_smoothing = false;
+    g_settings.gpu_motion_adaptive_deinterlacing = false;
     g_settings.cdrom_read_speedup = 1;
     g_settings.cdrom_seek_speedup = 1;
     g_settings.cdrom_mute_cd_audio = false;
@@ -616,6 +651,7 @@ void Settings::FixIncompatibleSettings(bool display_osd_messages)
     g_settings.use_old_mdec_routines = false;
     g_settings.pcdrv_enable = false;
     g_settings.bios_patch_fast_boot = false;
+    g_settings.bios_hle_memory_functions = false;
   }
 
   if (g_settings.pcdrv_enable && g_settings.pcdrv_root.empty())
@@ -703,6 +739,8 @@ void Settings::FixIncompatibleSettings(bool display_osd_messages)
     g_settings.debugging.show_timers_state = false;
     g_settings.debugging.show_mdec_state = false;
     g_settings.debugging.show_dma_state = false;
+    g_settings.debugging.show_code_cache_state = false;
+    g_settings.debugging.show_memory_state = false;
     g_settings.debugging.dump_cpu_to_vram_copies = false;
     g_settings.debugging.dump_vram_to_cpu_copies = false;
   }
@@ -724,6 +762,8 @@ void Settings::UpdateLogSettings()
   {
     Log::SetFileOutputParams(false, nullptr);
   }
+
+  Log::SetAsyncOutputParams(log_async);
 }
 
 void Settings::SetDefaultControllerConfig(SettingsInterface& si)
@@ -1561,6 +1601,7 @@ bool EmuFolders::EnsureFoldersExist()
   result = FileSystem::EnsureDirectoryExists(Dumps.c_str(), false) && result;
   result = FileSystem::EnsureDirectoryExists(Path::Combine(Dumps, "audio").c_str(), false) && result;
   result = FileSystem::EnsureDirectoryExists(Path::Combine(Dumps, "textures").c_str(), false) && result;
+  result = FileSystem::EnsureDirectoryExists(Path::Combine(Dumps, "video").c_str(), false) && result;
   result = FileSystem::EnsureDirectoryExists(GameSettings.c_str(), false) && result;
   result = FileSystem::EnsureDirectoryExists(InputProfiles.c_str(), false) && result;
   result = FileSystem::EnsureDirectoryExists(MemoryCards.c_str(), false) && result;
@@ -64,6 +64,9 @@ struct Settings
   bool cpu_recompiler_memory_exceptions = false;
   bool cpu_recompiler_block_linking = true;
   bool cpu_recompiler_icache = false;
+  bool cpu_recompiler_async_compile = false;
+  bool cpu_cached_interpreter_superblocks = false;
+  bool cpu_idle_loop_detection = false;
   CPUFastmemMode cpu_fastmem_mode = DEFAULT_CPU_FASTMEM_MODE;
 
   float emulation_speed = 1.0f;
@@ -94,10 +97,13 @@ struct Settings
   GPURenderer gpu_renderer = DEFAULT_GPU_RENDERER;
   std::string gpu_adapter;
   u32 gpu_resolution_scale = 1;
+  bool gpu_dynamic_resolution_scale = false;
   u32 gpu_multisamples = 1;
   bool gpu_use_thread = true;
+  bool gpu_sw_parallel_rasterization = false;
   bool gpu_use_software_renderer_for_readbacks = false;
   bool gpu_threaded_presentation = true;
+  u32 gpu_max_queued_frames = 0;
   bool gpu_use_debug_device = false;
   bool gpu_disable_shader_cache = false;
   bool gpu_disable_dual_source_blend = false;
@@ -118,6 +124,7 @@ struct Settings
   bool gpu_pgxp_color_correction = false;
   bool gpu_pgxp_vertex_cache = false;
   bool gpu_pgxp_cpu = false;
+  bool gpu_pgxp_vertex_only = false;
   bool gpu_pgxp_preserve_proj_fp = false;
   bool gpu_pgxp_depth_buffer = false;
   DisplayCropMode display_crop_mode = DEFAULT_DISPLAY_CROP_MODE;
@@ -132,6 +139,7 @@ struct Settings
   s8 display_line_end_offset = 0;
   bool display_force_4_3_for_24bit = false;
   bool gpu_24bit_chroma_smoothing = false;
+  bool gpu_motion_adaptive_deinterlacing = false;
   bool display_show_osd_messages = true;
   bool display_show_fps = false;
   bool display_show_speed = false;
@@ -139,6 +147,8 @@ struct Settings
   bool display_show_cpu = false;
   bool display_show_gpu = false;
   bool display_show_frame_times = false;
+  bool display_show_profiler = false;
+  bool display_show_latency = false;
   bool display_show_status_indicators = true;
   bool display_show_inputs = false;
   bool display_show_enhancements = false;
@@ -155,6 +165,8 @@ struct Settings
   CDROMMechaconVersion cdrom_mechacon_version = DEFAULT_CDROM_MECHACON_VERSION;
   bool cdrom_region_check = false;
   bool cdrom_load_image_to_ram = false;
+  bool cdrom_precache_in_background = false;
+  u16 cdrom_precache_size_limit_mb = 0;
   bool cdrom_load_image_patches = false;
   bool cdrom_mute_cd_audio = false;
   u32 cdrom_read_speedup = 1;
@@ -166,6 +178,7 @@ struct Settings
   std::string audio_output_device;
   u32 audio_output_latency_ms = DEFAULT_AUDIO_OUTPUT_LATENCY_MS;
   u32 audio_buffer_ms = DEFAULT_AUDIO_BUFFER_MS;
+  bool audio_adaptive_buffer_size = false;
   u32 audio_output_volume = 100;
   u32 audio_fast_forward_volume = 100;
   bool audio_output_muted = false;
@@ -211,6 +224,8 @@ struct Settings
     mutable bool show_timers_state = false;
     mutable bool show_mdec_state = false;
     mutable bool show_dma_state = false;
+    mutable bool show_code_cache_state = false;
+    mutable bool show_memory_state = false;
   } debugging;
 
   // texture replacements
@@ -234,6 +249,7 @@ struct Settings
 
   bool bios_tty_logging = false;
   bool bios_patch_fast_boot = DEFAULT_FAST_BOOT_VALUE;
+  bool bios_hle_memory_functions = false;
   bool enable_8mb_ram = false;
 
   std::array<ControllerType, NUM_CONTROLLER_AND_CARD_PORTS> controller_types{};
@@ -251,6 +267,7 @@ struct Settings
   LOGLEVEL log_level = DEFAULT_LOG_LEVEL;
   std::string log_filter;
   bool log_timestamps = true;
+  bool log_async = false;
   bool log_to_console = DEFAULT_LOG_TO_CONSOLE;
   bool log_to_debug = false;
   bool log_to_window = false;
@@ -266,6 +283,10 @@ struct Settings
 
   ALWAYS_INLINE bool UsingPGXPDepthBuffer() const { return gpu_pgxp_enable && gpu_pgxp_depth_buffer; }
   ALWAYS_INLINE bool UsingPGXPCPUMode() const { return gpu_pgxp_enable && gpu_pgxp_cpu; }
+  ALWAYS_INLINE bool UsingPGXPVertexOnlyMode() const
+  {
+    return gpu_pgxp_enable && gpu_pgxp_vertex_only && !gpu_pgxp_cpu;
+  }
   ALWAYS_INLINE float GetPGXPDepthClearThreshold() const
   {
     return gpu_pgxp_depth_clear_threshold * GPU_PGXP_DEPTH_THRESHOLD_SCALE;
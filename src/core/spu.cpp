@@ -7,6 +7,7 @@
 #include "host.h"
 #include "imgui.h"
 #include "interrupt_controller.h"
+#include "performance_profiler.h"
 #include "system.h"
 
 #include "util/audio_stream.h"
@@ -330,7 +331,11 @@ static void WriteToCaptureBuffer(u32 index, s16 value);
 static void IncrementCaptureBufferPosition();
 
 static void ReadADPCMBlock(u16 address, ADPCMBlock* block);
-static std::tuple<s32, s32> SampleVoice(u32 voice_index);
+static void CachedDecodeBlock(Voice& voice, const ADPCMBlock& block);
+static std::tuple<s32, s32> SampleVoice(u32 voice_index, s32 pitch_mod_volume, s32 noise_level);
+static void ProcessKeyOnOff();
+static void GenerateFrame(s16* output_frame);
+static void GenerateFrames(s16* output_frame, u32 num_frames);
 
 static void UpdateNoise();
 
@@ -402,6 +407,26 @@ static s32 s_reverb_resample_buffer_position = 0;
 
 static std::array<Voice, NUM_VOICES> s_voices{};
 
+// Direct-mapped cache of decoded ADPCM blocks, so looping instrument samples don't redo the
+// filter arithmetic on every pass. Entries are validated by comparing the raw block bytes and the
+// incoming filter history - the exact decode inputs - so stale entries can never produce wrong
+// samples and no invalidation on RAM writes is required.
+enum : u32
+{
+  ADPCM_DECODE_CACHE_SIZE = 2048
+};
+
+struct ADPCMDecodeCacheEntry
+{
+  ADPCMBlock block;
+  std::array<s16, 2> in_history;
+  std::array<s16, 2> out_history;
+  std::array<s16, NUM_SAMPLES_PER_ADPCM_BLOCK> samples;
+  bool valid;
+};
+
+static std::array<ADPCMDecodeCacheEntry, ADPCM_DECODE_CACHE_SIZE> s_adpcm_decode_cache{};
+
 static InlineFIFOQueue<u16, FIFO_SIZE_IN_HALFWORDS> s_transfer_fifo;
 
 static std::array<u8, RAM_SIZE> s_ram{};
@@ -445,6 +470,7 @@ void SPU::CreateOutputStream()
   }
 
   s_audio_stream->SetOutputVolume(System::GetAudioOutputVolume());
+  s_audio_stream->SetAdaptiveBufferSizing(g_settings.audio_adaptive_buffer_size);
   s_audio_stream->SetPaused(System::IsPaused());
 }
 
@@ -1452,6 +1478,10 @@ void SPU::DMAWrite(const u32* words, u32 word_count)
   UpdateTransferEvent();
 }
 
+// Moving sample generation to a worker thread (as the GPU backend does) has been considered and
+// rejected for now: generation can raise the IRQ9 interrupt, pops CD audio frames out of the
+// CDROM state machine mid-slice, and reverb writes back to SPU RAM which transfers/DMA read, so
+// every register poll and RAM access would become a drain point and serialize the thread anyway.
 void SPU::GeneratePendingSamples()
 {
   if (s_transfer_event->IsActive())
@@ -1815,6 +1845,33 @@ void SPU::Voice::DecodeBlock(const ADPCMBlock& block)
   current_block_flags.bits = block.flags.bits;
 }
 
+ALWAYS_INLINE_RELEASE void SPU::CachedDecodeBlock(Voice& voice, const ADPCMBlock& block)
+{
+  ADPCMDecodeCacheEntry& entry = s_adpcm_decode_cache[voice.current_address % ADPCM_DECODE_CACHE_SIZE];
+  if (entry.valid && std::memcmp(&entry.block, &block, sizeof(block)) == 0 &&
+      entry.in_history == voice.adpcm_last_samples)
+  {
+    // store samples needed for interpolation
+    auto& cbs = voice.current_block_samples;
+    cbs[2] = cbs[NUM_SAMPLES_FROM_LAST_ADPCM_BLOCK + NUM_SAMPLES_PER_ADPCM_BLOCK - 1];
+    cbs[1] = cbs[NUM_SAMPLES_FROM_LAST_ADPCM_BLOCK + NUM_SAMPLES_PER_ADPCM_BLOCK - 2];
+    cbs[0] = cbs[NUM_SAMPLES_FROM_LAST_ADPCM_BLOCK + NUM_SAMPLES_PER_ADPCM_BLOCK - 3];
+
+    std::memcpy(&cbs[NUM_SAMPLES_FROM_LAST_ADPCM_BLOCK], entry.samples.data(), sizeof(entry.samples));
+    voice.adpcm_last_samples = entry.out_history;
+    voice.current_block_flags.bits = block.flags.bits;
+    return;
+  }
+
+  std::memcpy(&entry.block, &block, sizeof(block));
+  entry.in_history = voice.adpcm_last_samples;
+  voice.DecodeBlock(block);
+  std::memcpy(entry.samples.data(), &voice.current_block_samples[NUM_SAMPLES_FROM_LAST_ADPCM_BLOCK],
+              sizeof(entry.samples));
+  entry.out_history = voice.adpcm_last_samples;
+  entry.valid = true;
+}
+
 s32 SPU::Voice::Interpolate() const
 {
   static constexpr std::array<s16, 0x200> gauss = {{
@@ -1921,7 +1978,7 @@ void SPU::ReadADPCMBlock(u16 address, ADPCMBlock* block)
   }
 }
 
-ALWAYS_INLINE_RELEASE std::tuple<s32, s32> SPU::SampleVoice(u32 voice_index)
+ALWAYS_INLINE_RELEASE std::tuple<s32, s32> SPU::SampleVoice(u32 voice_index, s32 pitch_mod_volume, s32 noise_level)
 {
   Voice& voice = s_voices[voice_index];
   if (!voice.IsOn() && !s_SPUCNT.irq9_enable)
@@ -1943,7 +2000,7 @@ ALWAYS_INLINE_RELEASE std::tuple<s32, s32> SPU::SampleVoice(u32 voice_index)
   {
     ADPCMBlock block;
     ReadADPCMBlock(voice.current_address, &block);
-    voice.DecodeBlock(block);
+    CachedDecodeBlock(voice, block);
     voice.has_samples = true;
 
     if (voice.current_block_flags.loop_start && !voice.ignore_loop_address)
@@ -1960,7 +2017,7 @@ ALWAYS_INLINE_RELEASE std::tuple<s32, s32> SPU::SampleVoice(u32 voice_index)
     // interpolate/sample and apply ADSR volume
     s32 sample;
     if (IsVoiceNoiseEnabled(voice_index))
-      sample = GetVoiceNoiseLevel();
+      sample = noise_level;
     else
       sample = voice.Interpolate();
 
@@ -1980,7 +2037,7 @@ ALWAYS_INLINE_RELEASE std::tuple<s32, s32> SPU::SampleVoice(u32 voice_index)
   u16 step = voice.regs.adpcm_sample_rate;
   if (IsPitchModulationEnabled(voice_index))
   {
-    const s32 factor = std::clamp<s32>(s_voices[voice_index - 1].last_volume, -0x8000, 0x7FFF) + 0x8000;
+    const s32 factor = std::clamp<s32>(pitch_mod_volume, -0x8000, 0x7FFF) + 0x8000;
     step = Truncate16(static_cast<u32>((SignExtend32(step) * factor) >> 15));
   }
   step = std::min<u16>(step, 0x3FFF);
@@ -2251,64 +2308,171 @@ void SPU::ProcessReverb(s16 left_in, s16 right_in, s32* left_out, s32* right_out
 #endif
 }
 
-void SPU::Execute(void* param, TickCount ticks, TickCount ticks_late)
+ALWAYS_INLINE_RELEASE void SPU::ProcessKeyOnOff()
 {
-  u32 remaining_frames;
-  if (g_settings.cpu_overclock_active)
+  u32 key_off_register = s_key_off_register;
+  s_key_off_register = 0;
+
+  u32 key_on_register = s_key_on_register;
+  s_key_on_register = 0;
+
+  for (u32 voice = 0; voice < NUM_VOICES; voice++)
   {
-    // (X * D) / N / 768 -> (X * D) / (N * 768)
-    const u64 num = (static_cast<u64>(ticks) * g_settings.cpu_overclock_denominator) + static_cast<u32>(s_ticks_carry);
-    remaining_frames = static_cast<u32>(num / s_cpu_tick_divider);
-    s_ticks_carry = static_cast<TickCount>(num % s_cpu_tick_divider);
+    if (key_off_register & 1u)
+      s_voices[voice].KeyOff();
+    key_off_register >>= 1;
+
+    if (key_on_register & 1u)
+    {
+      s_endx_register &= ~(1u << voice);
+      s_voices[voice].KeyOn();
+    }
+    key_on_register >>= 1;
   }
-  else
+}
+
+ALWAYS_INLINE_RELEASE void SPU::GenerateFrame(s16* output_frame)
+{
+  s32 left_sum = 0;
+  s32 right_sum = 0;
+  s32 reverb_in_left = 0;
+  s32 reverb_in_right = 0;
+
+  const s32 noise_level = GetVoiceNoiseLevel();
+  u32 reverb_on_register = s_reverb_on_register;
+
+  for (u32 voice = 0; voice < NUM_VOICES; voice++)
   {
-    remaining_frames = static_cast<u32>((ticks + s_ticks_carry) / SYSCLK_TICKS_PER_SPU_TICK);
-    s_ticks_carry = (ticks + s_ticks_carry) % SYSCLK_TICKS_PER_SPU_TICK;
+    const auto [left, right] = SampleVoice(voice, (voice > 0) ? s_voices[voice - 1].last_volume : 0, noise_level);
+    left_sum += left;
+    right_sum += right;
+
+    if (reverb_on_register & 1u)
+    {
+      reverb_in_left += left;
+      reverb_in_right += right;
+    }
+    reverb_on_register >>= 1;
   }
 
-  AudioStream* output_stream = s_audio_output_muted ? s_null_audio_stream.get() : s_audio_stream.get();
+  if (!s_SPUCNT.mute_n)
+  {
+    left_sum = 0;
+    right_sum = 0;
+  }
 
-  while (remaining_frames > 0)
+  // Update noise once per frame.
+  UpdateNoise();
+
+  // Mix in CD audio.
+  const auto [cd_audio_left, cd_audio_right] = CDROM::GetAudioFrame();
+  if (s_SPUCNT.cd_audio_enable)
   {
-    s16* output_frame_start;
-    u32 output_frame_space = remaining_frames;
-    output_stream->BeginWrite(&output_frame_start, &output_frame_space);
+    const s32 cd_audio_volume_left = ApplyVolume(s32(cd_audio_left), s_cd_audio_volume_left);
+    const s32 cd_audio_volume_right = ApplyVolume(s32(cd_audio_right), s_cd_audio_volume_right);
 
-    s16* output_frame = output_frame_start;
-    const u32 frames_in_this_batch = std::min(remaining_frames, output_frame_space);
-    for (u32 i = 0; i < frames_in_this_batch; i++)
+    left_sum += cd_audio_volume_left;
+    right_sum += cd_audio_volume_right;
+
+    if (s_SPUCNT.cd_audio_reverb)
+    {
+      reverb_in_left += cd_audio_volume_left;
+      reverb_in_right += cd_audio_volume_right;
+    }
+  }
+
+  // Compute reverb.
+  s32 reverb_out_left, reverb_out_right;
+  ProcessReverb(static_cast<s16>(Clamp16(reverb_in_left)), static_cast<s16>(Clamp16(reverb_in_right)),
+                &reverb_out_left, &reverb_out_right);
+
+  // Mix in reverb.
+  left_sum += reverb_out_left;
+  right_sum += reverb_out_right;
+
+  // Apply main volume after clamping. A maximum volume should not overflow here because both are 16-bit values.
+  output_frame[0] = static_cast<s16>(ApplyVolume(Clamp16(left_sum), s_main_volume_left.current_level));
+  output_frame[1] = static_cast<s16>(ApplyVolume(Clamp16(right_sum), s_main_volume_right.current_level));
+  s_main_volume_left.Tick();
+  s_main_volume_right.Tick();
+
+  // Write to capture buffers.
+  WriteToCaptureBuffer(0, cd_audio_left);
+  WriteToCaptureBuffer(1, cd_audio_right);
+  WriteToCaptureBuffer(2, static_cast<s16>(Clamp16(s_voices[1].last_volume)));
+  WriteToCaptureBuffer(3, static_cast<s16>(Clamp16(s_voices[3].last_volume)));
+  IncrementCaptureBufferPosition();
+}
+
+void SPU::GenerateFrames(s16* output_frame, u32 num_frames)
+{
+  // Voice-major block mixing for when the IRQ is disabled. Each voice renders a whole block of
+  // frames before moving to the next, which keeps its decode/interpolation/envelope state hot
+  // instead of touching all 24 voices for every output frame. The pitch modulation chain and the
+  // voice 1/3 capture buffers need per-frame volumes, so those are carried in small block arrays.
+  enum : u32
+  {
+    BLOCK_SIZE = 32
+  };
+
+  while (num_frames > 0)
+  {
+    const u32 count = std::min(num_frames, static_cast<u32>(BLOCK_SIZE));
+
+    // Voices read the noise level as of frame entry, and it advances once per frame.
+    s32 noise_levels[BLOCK_SIZE];
+    for (u32 i = 0; i < count; i++)
     {
-      s32 left_sum = 0;
-      s32 right_sum = 0;
-      s32 reverb_in_left = 0;
-      s32 reverb_in_right = 0;
+      noise_levels[i] = GetVoiceNoiseLevel();
+      UpdateNoise();
+    }
+
+    s32 left_sums[BLOCK_SIZE] = {};
+    s32 right_sums[BLOCK_SIZE] = {};
+    s32 reverb_in_left[BLOCK_SIZE] = {};
+    s32 reverb_in_right[BLOCK_SIZE] = {};
+    s32 voice_volumes[2][BLOCK_SIZE] = {};
+    s32 capture_volumes[2][BLOCK_SIZE];
+    s32* prev_volumes = voice_volumes[0];
+    s32* current_volumes = voice_volumes[1];
 
-      u32 reverb_on_register = s_reverb_on_register;
+    u32 reverb_on_register = s_reverb_on_register;
+    for (u32 voice_index = 0; voice_index < NUM_VOICES; voice_index++)
+    {
+      const Voice& voice = s_voices[voice_index];
+      const bool reverb_enable = ConvertToBoolUnchecked(reverb_on_register & 1u);
+      reverb_on_register >>= 1;
 
-      for (u32 voice = 0; voice < NUM_VOICES; voice++)
+      for (u32 i = 0; i < count; i++)
       {
-        const auto [left, right] = SampleVoice(voice);
-        left_sum += left;
-        right_sum += right;
+        const auto [left, right] = SampleVoice(voice_index, prev_volumes[i], noise_levels[i]);
+        current_volumes[i] = voice.last_volume;
+        left_sums[i] += left;
+        right_sums[i] += right;
 
-        if (reverb_on_register & 1u)
+        if (reverb_enable)
         {
-          reverb_in_left += left;
-          reverb_in_right += right;
+          reverb_in_left[i] += left;
+          reverb_in_right[i] += right;
         }
-        reverb_on_register >>= 1;
       }
 
+      if (voice_index == 1 || voice_index == 3)
+        std::memcpy(capture_volumes[voice_index >> 1], current_volumes, sizeof(s32) * count);
+
+      std::swap(prev_volumes, current_volumes);
+    }
+
+    for (u32 i = 0; i < count; i++)
+    {
+      s32 left_sum = left_sums[i];
+      s32 right_sum = right_sums[i];
       if (!s_SPUCNT.mute_n)
       {
         left_sum = 0;
         right_sum = 0;
       }
 
-      // Update noise once per frame.
-      UpdateNoise();
-
       // Mix in CD audio.
       const auto [cd_audio_left, cd_audio_right] = CDROM::GetAudioFrame();
       if (s_SPUCNT.cd_audio_enable)
@@ -2321,14 +2485,14 @@ void SPU::Execute(void* param, TickCount ticks, TickCount ticks_late)
 
         if (s_SPUCNT.cd_audio_reverb)
         {
-          reverb_in_left += cd_audio_volume_left;
-          reverb_in_right += cd_audio_volume_right;
+          reverb_in_left[i] += cd_audio_volume_left;
+          reverb_in_right[i] += cd_audio_volume_right;
         }
       }
 
       // Compute reverb.
       s32 reverb_out_left, reverb_out_right;
-      ProcessReverb(static_cast<s16>(Clamp16(reverb_in_left)), static_cast<s16>(Clamp16(reverb_in_right)),
+      ProcessReverb(static_cast<s16>(Clamp16(reverb_in_left[i])), static_cast<s16>(Clamp16(reverb_in_right[i])),
                     &reverb_out_left, &reverb_out_right);
 
       // Mix in reverb.
@@ -2344,34 +2508,69 @@ void SPU::Execute(void* param, TickCount ticks, TickCount ticks_late)
       // Write to capture buffers.
       WriteToCaptureBuffer(0, cd_audio_left);
       WriteToCaptureBuffer(1, cd_audio_right);
-      WriteToCaptureBuffer(2, static_cast<s16>(Clamp16(s_voices[1].last_volume)));
-      WriteToCaptureBuffer(3, static_cast<s16>(Clamp16(s_voices[3].last_volume)));
+      WriteToCaptureBuffer(2, static_cast<s16>(Clamp16(capture_volumes[0][i])));
+      WriteToCaptureBuffer(3, static_cast<s16>(Clamp16(capture_volumes[1][i])));
       IncrementCaptureBufferPosition();
+    }
 
-      // Key off/on voices after the first frame.
-      if (i == 0 && (s_key_off_register != 0 || s_key_on_register != 0))
-      {
-        u32 key_off_register = s_key_off_register;
-        s_key_off_register = 0;
+    num_frames -= count;
+  }
+}
 
-        u32 key_on_register = s_key_on_register;
-        s_key_on_register = 0;
+void SPU::Execute(void* param, TickCount ticks, TickCount ticks_late)
+{
+  PerformanceProfiler::Scope profiler_scope(PerformanceProfiler::Event::SPUExecute);
 
-        for (u32 voice = 0; voice < NUM_VOICES; voice++)
-        {
-          if (key_off_register & 1u)
-            s_voices[voice].KeyOff();
-          key_off_register >>= 1;
+  u32 remaining_frames;
+  if (g_settings.cpu_overclock_active)
+  {
+    // (X * D) / N / 768 -> (X * D) / (N * 768)
+    const u64 num = (static_cast<u64>(ticks) * g_settings.cpu_overclock_denominator) + static_cast<u32>(s_ticks_carry);
+    remaining_frames = static_cast<u32>(num / s_cpu_tick_divider);
+    s_ticks_carry = static_cast<TickCount>(num % s_cpu_tick_divider);
+  }
+  else
+  {
+    remaining_frames = static_cast<u32>((ticks + s_ticks_carry) / SYSCLK_TICKS_PER_SPU_TICK);
+    s_ticks_carry = (ticks + s_ticks_carry) % SYSCLK_TICKS_PER_SPU_TICK;
+  }
 
-          if (key_on_register & 1u)
-          {
-            s_endx_register &= ~(1u << voice);
-            s_voices[voice].KeyOn();
-          }
-          key_on_register >>= 1;
-        }
+  AudioStream* output_stream = s_audio_output_muted ? s_null_audio_stream.get() : s_audio_stream.get();
+
+  while (remaining_frames > 0)
+  {
+    s16* output_frame_start;
+    u32 output_frame_space = remaining_frames;
+    output_stream->BeginWrite(&output_frame_start, &output_frame_space);
+
+    s16* output_frame = output_frame_start;
+    const u32 frames_in_this_batch = std::min(remaining_frames, output_frame_space);
+    u32 batch_frames_remaining = frames_in_this_batch;
+
+    // Key off/on is applied between the first and second frames of a slice.
+    if (batch_frames_remaining > 0 && (s_key_off_register != 0 || s_key_on_register != 0))
+    {
+      GenerateFrame(output_frame);
+      output_frame += 2;
+      batch_frames_remaining--;
+      ProcessKeyOnOff();
+    }
+
+    if (s_SPUCNT.irq9_enable)
+    {
+      // IRQs can be triggered by any voice fetch, so stay on the precise frame-at-a-time path.
+      while (batch_frames_remaining > 0)
+      {
+        GenerateFrame(output_frame);
+        output_frame += 2;
+        batch_frames_remaining--;
       }
     }
+    else if (batch_frames_remaining > 0)
+    {
+      GenerateFrames(output_frame, batch_frames_remaining);
+      output_frame += batch_frames_remaining * 2;
+    }
 
     if (s_dump_writer)
       s_dump_writer->WriteFrames(output_frame_start, frames_in_this_batch);
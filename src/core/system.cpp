@@ -20,12 +20,14 @@
 #include "host.h"
 #include "host_interface_progress_callback.h"
 #include "imgui_overlays.h"
+#include "input_replay.h"
 #include "interrupt_controller.h"
 #include "mdec.h"
 #include "memory_card.h"
 #include "multitap.h"
 #include "pad.h"
 #include "pcdrv.h"
+#include "performance_profiler.h"
 #include "cpu_pgxp.h"
 #include "psf_loader.h"
 #include "save_state_version.h"
@@ -45,11 +47,15 @@
 #include "util/postprocessing.h"
 #include "util/state_wrapper.h"
 
+#include "common/crash_handler.h"
 #include "common/error.h"
 #include "common/file_system.h"
+#include "common/intrin.h"
 #include "common/log.h"
+#include "common/memory_tracker.h"
 #include "common/path.h"
 #include "common/string_util.h"
+#include "common/thread_pool.h"
 #include "common/threading.h"
 
 #include "fmt/chrono.h"
@@ -57,6 +63,7 @@
 #include "imgui.h"
 #include "xxhash.h"
 
+#include <atomic>
 #include <cctype>
 #include <cinttypes>
 #include <cmath>
@@ -105,15 +112,29 @@ static void InternalReset();
 static void ClearRunningGame();
 static void DestroySystem();
 static std::string GetMediaPathFromSaveState(const char* path);
-static bool DoState(StateWrapper& sw, GPUTexture** host_texture, bool update_display, bool is_memory_state);
+static bool CompressAndWriteSaveState(std::string filename, std::unique_ptr<GrowableMemoryByteStream> buffer);
+static void JoinSaveStateThread();
+static bool DoState(StateWrapper& sw, GPUTexture** host_texture, u64* host_texture_id, bool update_display,
+                    bool is_memory_state, bool skip_ram = false);
 static bool CreateGPU(GPURenderer renderer, bool is_switching);
 static bool SaveUndoLoadState();
 
 /// Throttles the system, i.e. sleeps until it's time to execute the next frame.
 static void Throttle();
 
+/// Tags the phase the emulation loop is currently in, closing out the previous phase's segment.
+static void SetFramePhase(FramePhase phase);
+
+/// Refines the sync-to-host-refresh speed from measured present intervals, compensating for the
+/// reported refresh rate being rounded (e.g. a 59.94Hz display reported as 60Hz).
+static void UpdateHostRefreshRateMeasurement();
+
 static void SetRewinding(bool enabled);
 static bool SaveRewindState();
+static void UpdateRewindMemoryTracking();
+static void EncodeRewindDelta(const u8* new_state, u32 new_size, const u8* old_state, u32 old_size,
+                              GrowableMemoryByteStream* delta);
+static void ApplyRewindDelta(GrowableMemoryByteStream* state, GrowableMemoryByteStream* delta);
 static void DoRewind();
 
 static void SaveRunaheadState();
@@ -131,6 +152,10 @@ static void UpdateSessionTime(const std::string& prev_serial);
 
 static void SetTimerResolutionIncreased(bool enabled);
 
+static void CrashContextLogCallback(void* pUserParam, const char* channelName, const char* functionName,
+                                    LOGLEVEL level, std::string_view message);
+static size_t WriteCrashContext(const void* exception_pc, char* buffer, size_t buffer_size);
+
 #ifdef ENABLE_DISCORD_PRESENCE
 static void InitializeDiscordPresence();
 static void ShutdownDiscordPresence();
@@ -145,6 +170,18 @@ static std::unique_ptr<INISettingsInterface> s_game_settings_interface;
 static std::unique_ptr<INISettingsInterface> s_input_settings_interface;
 static std::string s_input_profile_name;
 
+// Modification times of the parsed per-game/input profile INIs, so re-applying settings for the
+// same game can reuse the parsed copy instead of re-reading the file.
+static std::time_t s_game_settings_ini_modified_time = 0;
+static std::time_t s_input_profile_ini_modified_time = 0;
+
+// Ring of recent log lines included in crash reports. Written lock-free from whichever thread
+// logs - a torn line in a crash report is acceptable, taking a lock in the crash path is not.
+static constexpr u32 CRASH_CONTEXT_LOG_LINES = 32;
+static constexpr u32 CRASH_CONTEXT_LOG_LINE_LENGTH = 160;
+static char s_crash_context_log_ring[CRASH_CONTEXT_LOG_LINES][CRASH_CONTEXT_LOG_LINE_LENGTH];
+static std::atomic<u32> s_crash_context_log_pos{0};
+
 static System::State s_state = System::State::Shutdown;
 static std::atomic_bool s_startup_cancelled{false};
 static bool s_keep_gpu_device_on_shutdown = false;
@@ -168,6 +205,11 @@ static float s_throttle_frequency = 60.0f;
 static float s_target_speed = 1.0f;
 static Common::Timer::Value s_frame_period = 0;
 static Common::Timer::Value s_next_frame_time = 0;
+
+// Tracks how late the host wakes us up from a timed sleep, so the throttler can stop sleeping
+// that much earlier and spin the remainder off instead.
+static Common::Timer::Value s_sleep_overshoot = 0;
+
 static bool s_last_frame_skipped = false;
 
 static bool s_system_executing = false;
@@ -179,6 +221,13 @@ static bool s_throttler_enabled = true;
 static bool s_display_all_frames = true;
 static bool s_syncing_to_host = false;
 
+// Present interval measurement for sync-to-host-refresh, only active when presentation is paced
+// by vsync (i.e. the sleep throttler is disabled).
+static constexpr u32 HOST_REFRESH_MEASUREMENT_PRESENTS = 180;
+static Common::Timer::Value s_last_present_time = 0;
+static Common::Timer::Value s_accumulated_present_interval = 0;
+static u32 s_accumulated_present_count = 0;
+
 static float s_average_frame_time_accumulator = 0.0f;
 static float s_minimum_frame_time_accumulator = 0.0f;
 static float s_maximum_frame_time_accumulator = 0.0f;
@@ -196,6 +245,20 @@ static float s_sw_thread_time = 0.0f;
 static float s_average_gpu_time = 0.0f;
 static float s_accumulated_gpu_time = 0.0f;
 static float s_gpu_usage = 0.0f;
+static std::array<float, static_cast<size_t>(GPUDevice::GPUTimingStage::MaxCount)> s_average_stage_gpu_time = {};
+static std::array<float, static_cast<size_t>(GPUDevice::GPUTimingStage::MaxCount)> s_accumulated_stage_gpu_time = {};
+
+// Input-to-present latency probe. The newest input timestamp is latched when a frame finishes
+// executing, and measured against the wall clock when that frame is handed off for presentation.
+static Common::Timer::Value s_frame_input_timestamp = 0;
+static Common::Timer::Value s_consumed_input_timestamp = 0;
+static float s_input_latency_accumulator = 0.0f;
+static float s_minimum_input_latency_accumulator = 0.0f;
+static float s_maximum_input_latency_accumulator = 0.0f;
+static u32 s_input_latency_samples = 0;
+static float s_average_input_latency = 0.0f;
+static float s_minimum_input_latency = 0.0f;
+static float s_maximum_input_latency = 0.0f;
 static System::FrameTimeHistory s_frame_time_history;
 static u32 s_frame_time_history_pos = 0;
 static u32 s_last_frame_number = 0;
@@ -208,14 +271,33 @@ static Common::Timer s_fps_timer;
 static Common::Timer s_frame_timer;
 static Threading::ThreadHandle s_cpu_thread_handle;
 
+// Stall attribution. One relaxed store per phase transition keeps the current phase visible to
+// anything sampling the thread from outside (watchdogs, debuggers); the per-phase durations are
+// accumulated on the emulation thread itself, so slow frames can be attributed exactly rather
+// than statistically.
+static constexpr float SLOW_FRAME_TIME_THRESHOLD_MS = 100.0f;
+static std::atomic<System::FramePhase> s_current_frame_phase{System::FramePhase::CPUExecution};
+static Common::Timer::Value s_frame_phase_start_time = 0;
+static std::array<Common::Timer::Value, static_cast<size_t>(System::FramePhase::Count)> s_frame_phase_durations = {};
+static u32 s_slow_frame_count = 0;
+static std::array<u32, static_cast<size_t>(System::FramePhase::Count)> s_slow_frame_phase_counts = {};
+
 static std::unique_ptr<CheatList> s_cheat_list;
 
 // temporary save state, created when loading, used to undo load state
 static std::unique_ptr<ByteStream> m_undo_load_state;
 
+// background writer for compressed save states, joined before the next save/load
+static std::thread s_save_state_thread;
+
 static bool s_memory_saves_enabled = false;
 
 static std::deque<System::MemorySaveState> s_rewind_states;
+
+// rewind slots only hold sparse XOR deltas; this is the full reconstruction of the newest state
+// in the chain, with a scratch buffer for serializing the next state before encoding
+static std::unique_ptr<GrowableMemoryByteStream> s_rewind_base_state;
+static std::unique_ptr<GrowableMemoryByteStream> s_rewind_scratch_state;
 static s32 s_rewind_load_frequency = -1;
 static s32 s_rewind_load_counter = -1;
 static s32 s_rewind_save_frequency = -1;
@@ -223,10 +305,19 @@ static s32 s_rewind_save_counter = -1;
 static bool s_rewinding_first_save = false;
 
 static std::deque<System::MemorySaveState> s_runahead_states;
+
+// runahead tracks RAM with dirty pages instead of serializing it; this shadow copy holds the
+// contents of the newest saved state so undo buffers can capture pre-frame page contents
+static std::unique_ptr<u8[]> s_runahead_ram_shadow;
 static bool s_runahead_replay_pending = false;
 static u32 s_runahead_frames = 0;
 static u32 s_runahead_replay_frames = 0;
 
+// snapshot of the post-boot machine state (taken after the fast boot patch and EXE injection),
+// used by ResetSystem() as a warm-reset fast path instead of replaying the BIOS boot sequence
+static System::MemorySaveState s_warm_reset_state;
+static bool s_warm_reset_state_valid = false;
+
 // Used to track play time. We use a monotonic timer here, in case of clock changes.
 static u64 s_session_start_time = 0;
 
@@ -239,13 +330,78 @@ static TinyString GetTimestampStringForFileName()
   return TinyString::from_fmt("{:%Y-%m-%d_%H-%M-%S}", fmt::localtime(std::time(nullptr)));
 }
 
+void System::CrashContextLogCallback(void* pUserParam, const char* channelName, const char* functionName,
+                                     LOGLEVEL level, std::string_view message)
+{
+  if (level > LOGLEVEL_INFO)
+    return;
+
+  const u32 slot = s_crash_context_log_pos.fetch_add(1, std::memory_order_relaxed) % CRASH_CONTEXT_LOG_LINES;
+  std::snprintf(s_crash_context_log_ring[slot], CRASH_CONTEXT_LOG_LINE_LENGTH, "%s: %.*s", channelName,
+                static_cast<int>(message.size()), message.data());
+}
+
+static void AppendCrashContext(char* buffer, size_t buffer_size, size_t& pos, const char* format, ...)
+{
+  if (pos >= (buffer_size - 1))
+    return;
+
+  std::va_list ap;
+  va_start(ap, format);
+  const int written = std::vsnprintf(buffer + pos, buffer_size - pos, format, ap);
+  va_end(ap);
+
+  if (written > 0)
+    pos = std::min(pos + static_cast<size_t>(written), buffer_size - 1);
+}
+
+size_t System::WriteCrashContext(const void* exception_pc, char* buffer, size_t buffer_size)
+{
+  size_t pos = 0;
+  AppendCrashContext(buffer, buffer_size, pos, "\nEmulation context:\n");
+  AppendCrashContext(buffer, buffer_size, pos, "  Guest PC: 0x%08X, frame %u (internal %u)\n", CPU::g_state.pc,
+                     s_frame_number, s_internal_frame_number);
+
+  u32 guest_pc, guest_size;
+  if (exception_pc && CPU::CodeCache::GetBlockInfoForHostAddress(exception_pc, &guest_pc, &guest_size))
+  {
+    AppendCrashContext(buffer, buffer_size, pos,
+                       "  Faulting address %p is recompiled code for guest block 0x%08X (%u instructions)\n",
+                       exception_pc, guest_pc, guest_size);
+  }
+
+  AppendCrashContext(buffer, buffer_size, pos, "  VPS: %.2f FPS: %.2f Frame Time: %.2fms Blocks Compiled: %u\n",
+                     s_vps, s_fps, s_average_frame_time, CPU::CodeCache::GetTotalBlocksCompiled());
+
+  AppendCrashContext(buffer, buffer_size, pos, "Recent log output:\n");
+  const u32 end = s_crash_context_log_pos.load(std::memory_order_relaxed);
+  const u32 start = (end > CRASH_CONTEXT_LOG_LINES) ? (end - CRASH_CONTEXT_LOG_LINES) : 0;
+  for (u32 i = start; i < end; i++)
+  {
+    const char* line = s_crash_context_log_ring[i % CRASH_CONTEXT_LOG_LINES];
+    if (line[0] != '\0')
+      AppendCrashContext(buffer, buffer_size, pos, "  %s\n", line);
+  }
+
+  return pos;
+}
+
 void System::Internal::ProcessStartup()
 {
+  // One process hosts exactly one emulated machine. That assumption is load-bearing: the fastmem
+  // arena lives at a fixed address with a process-wide fault handler, and machine state (CPU's
+  // g_state, Bus RAM, the GPU) is namespace-scope for the recompiler's benefit. Embedders that
+  // want N instances should run N processes; immutable data (BIOS, game database cache, shader
+  // caches) is file-backed and shared between them by the OS page cache.
   if (!Bus::AllocateMemory())
     Panic("Failed to allocate memory for emulated bus.");
 
   CPU::CodeCache::ProcessStartup();
 
+  // Crash reports carry the JIT/performance context and recent log output with them.
+  CrashHandler::SetContextCallback(&WriteCrashContext);
+  Log::RegisterCallback(&CrashContextLogCallback, nullptr);
+
   // This will call back to Host::LoadSettings() -> ReloadSources().
   LoadSettings(false);
 
@@ -272,8 +428,13 @@ void System::Internal::ProcessShutdown()
 
   InputManager::CloseSources();
 
+  CrashHandler::SetContextCallback(nullptr);
+  Log::UnregisterCallback(&CrashContextLogCallback, nullptr);
+
   CPU::CodeCache::ProcessShutdown();
   Bus::ReleaseMemory();
+
+  MemoryTracker::LogStatistics();
 }
 
 void System::Internal::IdlePollUpdate()
@@ -492,6 +653,40 @@ float System::GetGPUAverageTime()
 {
   return s_average_gpu_time;
 }
+float System::GetSleepOvershootTime()
+{
+  return static_cast<float>(Common::Timer::ConvertValueToMilliseconds(s_sleep_overshoot));
+}
+const char* System::GetFramePhaseName(FramePhase phase)
+{
+  static constexpr std::array<const char*, static_cast<size_t>(FramePhase::Count)> names = {
+    {"CPU", "Completion", "Present", "Throttle", "Host"}};
+  return names[static_cast<size_t>(phase)];
+}
+u32 System::GetSlowFrameCount()
+{
+  return s_slow_frame_count;
+}
+u32 System::GetSlowFrameCountForPhase(FramePhase phase)
+{
+  return s_slow_frame_phase_counts[static_cast<size_t>(phase)];
+}
+float System::GetAverageInputLatency()
+{
+  return s_average_input_latency;
+}
+float System::GetMinimumInputLatency()
+{
+  return s_minimum_input_latency;
+}
+float System::GetMaximumInputLatency()
+{
+  return s_maximum_input_latency;
+}
+float System::GetGPUStageAverageTime(u32 stage)
+{
+  return s_average_stage_gpu_time[stage];
+}
 const System::FrameTimeHistory& System::GetFrameTimeHistory()
 {
   return s_frame_time_history;
@@ -887,7 +1082,7 @@ bool System::RecreateGPU(GPURenderer renderer, bool force_recreate_device, bool
   // save current state
   std::unique_ptr<ByteStream> state_stream = ByteStream::CreateGrowableMemoryStream();
   StateWrapper sw(state_stream.get(), StateWrapper::Mode::Write, SAVE_STATE_VERSION);
-  const bool state_valid = g_gpu->DoState(sw, nullptr, false) && TimingEvents::DoState(sw);
+  const bool state_valid = g_gpu->DoState(sw, nullptr, nullptr, false) && TimingEvents::DoState(sw);
   if (!state_valid)
     Log_ErrorPrintf("Failed to save old GPU state when switching renderers");
 
@@ -910,7 +1105,7 @@ bool System::RecreateGPU(GPURenderer renderer, bool force_recreate_device, bool
     state_stream->SeekAbsolute(0);
     sw.SetMode(StateWrapper::Mode::Read);
     g_gpu->RestoreDeviceContext();
-    g_gpu->DoState(sw, nullptr, update_display);
+    g_gpu->DoState(sw, nullptr, nullptr, update_display);
     TimingEvents::DoState(sw);
   }
 
@@ -999,17 +1194,32 @@ bool System::ReloadGameSettings(bool display_osd_messages)
 bool System::UpdateGameSettingsLayer()
 {
   std::unique_ptr<INISettingsInterface> new_interface;
+  bool reuse_game_interface = false;
   if (g_settings.apply_game_settings && !s_running_game_serial.empty())
   {
     std::string filename(GetGameSettingsPath(s_running_game_serial));
-    if (FileSystem::FileExists(filename.c_str()))
+    FILESYSTEM_STAT_DATA sd;
+    if (FileSystem::StatFile(filename.c_str(), &sd))
     {
-      Log_InfoPrintf("Loading game settings from '%s'...", filename.c_str());
-      new_interface = std::make_unique<INISettingsInterface>(std::move(filename));
-      if (!new_interface->Load())
+      if (s_game_settings_interface && s_game_settings_interface->GetFileName() == filename &&
+          s_game_settings_ini_modified_time == sd.ModificationTime)
+      {
+        // Same file, unchanged on disk; keep the parsed copy instead of re-reading the INI.
+        reuse_game_interface = true;
+      }
+      else
       {
-        Log_ErrorPrintf("Failed to parse game settings ini '%s'", new_interface->GetFileName().c_str());
-        new_interface.reset();
+        Log_InfoPrintf("Loading game settings from '%s'...", filename.c_str());
+        new_interface = std::make_unique<INISettingsInterface>(std::move(filename));
+        if (!new_interface->Load())
+        {
+          Log_ErrorPrintf("Failed to parse game settings ini '%s'", new_interface->GetFileName().c_str());
+          new_interface.reset();
+        }
+        else
+        {
+          s_game_settings_ini_modified_time = sd.ModificationTime;
+        }
       }
     }
     else
@@ -1020,34 +1230,56 @@ bool System::UpdateGameSettingsLayer()
 
   std::string input_profile_name;
   bool use_game_settings_for_controller = false;
-  if (new_interface)
+  INISettingsInterface* game_interface = reuse_game_interface ? s_game_settings_interface.get() : new_interface.get();
+  if (game_interface)
   {
-    new_interface->GetBoolValue("ControllerPorts", "UseGameSettingsForController", &use_game_settings_for_controller);
+    game_interface->GetBoolValue("ControllerPorts", "UseGameSettingsForController", &use_game_settings_for_controller);
     if (!use_game_settings_for_controller)
-      new_interface->GetStringValue("ControllerPorts", "InputProfileName", &input_profile_name);
+      game_interface->GetStringValue("ControllerPorts", "InputProfileName", &input_profile_name);
   }
 
-  if (!s_game_settings_interface && !new_interface && s_input_profile_name == input_profile_name)
+  // Nothing changed? Callers skip the full settings reload.
+  if ((reuse_game_interface || (!s_game_settings_interface && !new_interface)) &&
+      s_input_profile_name == input_profile_name)
+  {
     return false;
+  }
 
-  Host::Internal::SetGameSettingsLayer(new_interface.get());
-  s_game_settings_interface = std::move(new_interface);
+  if (!reuse_game_interface)
+  {
+    Host::Internal::SetGameSettingsLayer(new_interface.get());
+    s_game_settings_interface = std::move(new_interface);
+  }
 
   std::unique_ptr<INISettingsInterface> input_interface;
+  bool reuse_input_interface = false;
   if (!use_game_settings_for_controller)
   {
     if (!input_profile_name.empty())
     {
-      const std::string filename(GetInputProfilePath(input_profile_name));
-      if (FileSystem::FileExists(filename.c_str()))
+      std::string filename(GetInputProfilePath(input_profile_name));
+      FILESYSTEM_STAT_DATA sd;
+      if (FileSystem::StatFile(filename.c_str(), &sd))
       {
-        Log_InfoPrintf("Loading input profile from '%s'...", filename.c_str());
-        input_interface = std::make_unique<INISettingsInterface>(std::move(filename));
-        if (!input_interface->Load())
+        if (s_input_settings_interface && s_input_settings_interface->GetFileName() == filename &&
+            s_input_profile_ini_modified_time == sd.ModificationTime)
         {
-          Log_ErrorPrintf("Failed to parse input profile ini '%s'", input_interface->GetFileName().c_str());
-          input_interface.reset();
-          input_profile_name = {};
+          reuse_input_interface = true;
+        }
+        else
+        {
+          Log_InfoPrintf("Loading input profile from '%s'...", filename.c_str());
+          input_interface = std::make_unique<INISettingsInterface>(std::move(filename));
+          if (!input_interface->Load())
+          {
+            Log_ErrorPrintf("Failed to parse input profile ini '%s'", input_interface->GetFileName().c_str());
+            input_interface.reset();
+            input_profile_name = {};
+          }
+          else
+          {
+            s_input_profile_ini_modified_time = sd.ModificationTime;
+          }
         }
       }
       else
@@ -1057,8 +1289,11 @@ bool System::UpdateGameSettingsLayer()
       }
     }
 
-    Host::Internal::SetInputSettingsLayer(input_interface ? input_interface.get() :
-                                                            Host::Internal::GetBaseSettingsLayer());
+    if (!reuse_input_interface)
+    {
+      Host::Internal::SetInputSettingsLayer(input_interface ? input_interface.get() :
+                                                              Host::Internal::GetBaseSettingsLayer());
+    }
   }
   else
   {
@@ -1066,7 +1301,8 @@ bool System::UpdateGameSettingsLayer()
     Host::Internal::SetInputSettingsLayer(s_game_settings_interface.get());
   }
 
-  s_input_settings_interface = std::move(input_interface);
+  if (!reuse_input_interface)
+    s_input_settings_interface = std::move(input_interface);
   s_input_profile_name = std::move(input_profile_name);
   return true;
 }
@@ -1082,7 +1318,14 @@ void System::ResetSystem()
   if (Achievements::ResetHardcoreMode())
     ApplySettings(false);
 
-  InternalReset();
+  // Warm path: restore the post-boot snapshot instead of resetting every subsystem and
+  // replaying the BIOS boot sequence, making reset-to-title effectively instant. Falls back to
+  // a cold reset when the snapshot was dropped (settings/media change) or fails to apply.
+  if (s_warm_reset_state_valid && LoadMemoryState(s_warm_reset_state))
+    Achievements::ResetClient();
+  else
+    InternalReset();
+
   ResetPerformanceCounters();
   ResetThrottler();
   Host::AddOSDMessage(TRANSLATE_STR("OSDMessage", "System reset."));
@@ -1143,6 +1386,9 @@ bool System::LoadState(const char* filename)
     return false;
   }
 
+  // make sure any in-flight save has hit the disk before we read it back
+  JoinSaveStateThread();
+
   Common::Timer load_timer;
 
   std::unique_ptr<ByteStream> stream = ByteStream::OpenFile(filename, BYTESTREAM_OPEN_READ | BYTESTREAM_OPEN_STREAMED);
@@ -1178,8 +1424,68 @@ bool System::LoadState(const char* filename)
   return true;
 }
 
+void System::JoinSaveStateThread()
+{
+  if (s_save_state_thread.joinable())
+    s_save_state_thread.join();
+}
+
+// Serialization has to happen on the CPU thread while emulation is paused, but zstd compression
+// and disk I/O don't, so compressed saves hand the serialized buffer off to this worker.
+bool System::CompressAndWriteSaveState(std::string filename, std::unique_ptr<GrowableMemoryByteStream> buffer)
+{
+  // The buffer holds a complete uncompressed state; recompress the data section and fix the
+  // header up to match what the synchronous path would have produced.
+  SAVE_STATE_HEADER header;
+  std::memcpy(&header, buffer->GetMemoryPointer(), sizeof(header));
+  DebugAssert(header.data_compression_type == SAVE_STATE_HEADER::COMPRESSION_TYPE_NONE);
+
+  std::unique_ptr<ByteStream> stream =
+    ByteStream::OpenFile(filename.c_str(), BYTESTREAM_OPEN_CREATE | BYTESTREAM_OPEN_WRITE | BYTESTREAM_OPEN_TRUNCATE |
+                                             BYTESTREAM_OPEN_ATOMIC_UPDATE | BYTESTREAM_OPEN_STREAMED);
+  if (!stream)
+  {
+    Host::ReportFormattedErrorAsync(TRANSLATE("OSDMessage", "Save State"),
+                                    TRANSLATE("OSDMessage", "Saving state to '%s' failed."), filename.c_str());
+    return false;
+  }
+
+  bool result = stream->Write2(buffer->GetMemoryPointer(), header.offset_to_data);
+  if (result)
+  {
+    std::unique_ptr<ByteStream> cstream(ByteStream::CreateZstdCompressStream(stream.get(), 0));
+    result = cstream->Write2(buffer->GetMemoryPointer() + header.offset_to_data, header.data_uncompressed_size) &&
+             cstream->Commit();
+  }
+
+  if (result)
+  {
+    header.data_compression_type = SAVE_STATE_HEADER::COMPRESSION_TYPE_ZSTD;
+    header.data_compressed_size = static_cast<u32>(stream->GetPosition() - header.offset_to_data);
+    result = stream->SeekAbsolute(0) && stream->Write2(&header, sizeof(header));
+  }
+
+  if (!result)
+  {
+    Host::ReportFormattedErrorAsync(TRANSLATE("OSDMessage", "Save State"),
+                                    TRANSLATE("OSDMessage", "Saving state to '%s' failed."), filename.c_str());
+    stream->Discard();
+    return false;
+  }
+
+  stream->Commit();
+
+  const std::string display_name(FileSystem::GetDisplayNameFromPath(filename));
+  Host::AddIconOSDMessage(
+    "save_state", ICON_FA_SAVE,
+    fmt::format(TRANSLATE_FS("OSDMessage", "State saved to '{}'."), Path::GetFileName(display_name)), 5.0f);
+  return true;
+}
+
 bool System::SaveState(const char* filename, bool backup_existing_save)
 {
+  JoinSaveStateThread();
+
   if (backup_existing_save && FileSystem::FileExists(filename))
   {
     const std::string backup_filename(Path::ReplaceExtension(filename, "bak"));
@@ -1189,6 +1495,24 @@ bool System::SaveState(const char* filename, bool backup_existing_save)
 
   Common::Timer save_timer;
 
+  if (g_settings.compress_save_states)
+  {
+    // serialize uncompressed into memory, then compress and write off-thread
+    Log_InfoPrintf("Saving state to '%s' in the background...", filename);
+
+    std::unique_ptr<GrowableMemoryByteStream> buffer = ByteStream::CreateGrowableMemoryStream();
+    if (!SaveStateToStream(buffer.get(), 256, SAVE_STATE_HEADER::COMPRESSION_TYPE_NONE))
+    {
+      Host::ReportFormattedErrorAsync(TRANSLATE("OSDMessage", "Save State"),
+                                      TRANSLATE("OSDMessage", "Saving state to '%s' failed."), filename);
+      return false;
+    }
+
+    s_save_state_thread = std::thread(&CompressAndWriteSaveState, std::string(filename), std::move(buffer));
+    Log_VerbosePrintf("Serializing state took %.2f msec", save_timer.GetTimeMilliseconds());
+    return true;
+  }
+
   std::unique_ptr<ByteStream> stream =
     ByteStream::OpenFile(filename, BYTESTREAM_OPEN_CREATE | BYTESTREAM_OPEN_WRITE | BYTESTREAM_OPEN_TRUNCATE |
                                      BYTESTREAM_OPEN_ATOMIC_UPDATE | BYTESTREAM_OPEN_STREAMED);
@@ -1198,9 +1522,7 @@ bool System::SaveState(const char* filename, bool backup_existing_save)
   Log_InfoPrintf("Saving state to '%s'...", filename);
 
   const u32 screenshot_size = 256;
-  const bool result = SaveStateToStream(stream.get(), screenshot_size,
-                                        g_settings.compress_save_states ? SAVE_STATE_HEADER::COMPRESSION_TYPE_ZSTD :
-                                                                          SAVE_STATE_HEADER::COMPRESSION_TYPE_NONE);
+  const bool result = SaveStateToStream(stream.get(), screenshot_size, SAVE_STATE_HEADER::COMPRESSION_TYPE_NONE);
   if (!result)
   {
     Host::ReportFormattedErrorAsync(TRANSLATE("OSDMessage", "Save State"),
@@ -1386,8 +1708,19 @@ bool System::BootSystem(SystemBootParameters parameters)
     }
   }
 
-  // Load BIOS image.
-  if (!LoadBIOS(parameters.override_bios))
+  // Load the BIOS image on the thread pool while the components come up. Both steps depend on the
+  // per-game settings applied above (BIOS selection on the auto-detected region, component setup
+  // on e.g. the renderer), but not on each other: LoadBIOS() only touches the BIOS area of the
+  // memory map, which Bus::Initialize() leaves alone. Component setup dominates boot time because
+  // of GPU device/shader cache creation, so the BIOS read is effectively free.
+  bool bios_loaded = false;
+  Threading::TaskGroup bios_load_group;
+  bios_load_group.QueueTask([&bios_loaded, &parameters]() { bios_loaded = LoadBIOS(parameters.override_bios); });
+
+  // Component setup.
+  const bool components_initialized = Initialize(parameters.force_software_renderer);
+  bios_load_group.Wait();
+  if (!components_initialized)
   {
     s_state = State::Shutdown;
     ClearRunningGame();
@@ -1395,12 +1728,10 @@ bool System::BootSystem(SystemBootParameters parameters)
     return false;
   }
 
-  // Component setup.
-  if (!Initialize(parameters.force_software_renderer))
+  // BIOS load failure has to tear the components back down again.
+  if (!bios_loaded)
   {
-    s_state = State::Shutdown;
-    ClearRunningGame();
-    Host::OnSystemDestroyed();
+    DestroySystem();
     return false;
   }
 
@@ -1447,6 +1778,11 @@ bool System::BootSystem(SystemBootParameters parameters)
   s_state = State::Running;
   SPU::GetOutputStream()->SetPaused(false);
 
+  // Snapshot the post-boot state (fast boot patch and EXE injection included) so that
+  // ResetSystem() can restore it instantly instead of replaying the BIOS boot sequence. The
+  // BIOS/EXE images stay resident for the lifetime of the system, so this is all a reset needs.
+  s_warm_reset_state_valid = SaveMemoryState(&s_warm_reset_state);
+
   FullscreenUI::OnSystemStarted();
 
   if (g_settings.inhibit_screensaver)
@@ -1505,6 +1841,7 @@ bool System::Initialize(bool force_software_renderer)
   s_throttle_frequency = 60.0f;
   s_frame_period = 0;
   s_next_frame_time = 0;
+  s_sleep_overshoot = 0;
   s_turbo_enabled = false;
   s_fast_forward_enabled = false;
 
@@ -1529,6 +1866,17 @@ bool System::Initialize(bool force_software_renderer)
   s_average_gpu_time = 0.0f;
   s_accumulated_gpu_time = 0.0f;
   s_gpu_usage = 0.0f;
+  s_average_stage_gpu_time.fill(0.0f);
+  s_accumulated_stage_gpu_time.fill(0.0f);
+  s_frame_input_timestamp = 0;
+  s_consumed_input_timestamp = 0;
+  s_input_latency_accumulator = 0.0f;
+  s_minimum_input_latency_accumulator = 0.0f;
+  s_maximum_input_latency_accumulator = 0.0f;
+  s_input_latency_samples = 0;
+  s_average_input_latency = 0.0f;
+  s_minimum_input_latency = 0.0f;
+  s_maximum_input_latency = 0.0f;
   s_last_frame_number = 0;
   s_last_internal_frame_number = 0;
   s_last_global_tick_counter = 0;
@@ -1538,6 +1886,10 @@ bool System::Initialize(bool force_software_renderer)
   s_frame_timer.Reset();
   s_frame_time_history.fill(0.0f);
   s_frame_time_history_pos = 0;
+  s_frame_phase_durations = {};
+  s_frame_phase_start_time = Common::Timer::GetCurrentValue();
+  s_slow_frame_count = 0;
+  s_slow_frame_phase_counts = {};
 
   TimingEvents::Initialize();
 
@@ -1636,6 +1988,10 @@ void System::DestroySystem()
   if (s_state == State::Shutdown)
     return;
 
+  JoinSaveStateThread();
+
+  InputReplay::Stop();
+
   Host::ClearOSDMessages();
 
   PostProcessing::Shutdown();
@@ -1732,6 +2088,15 @@ bool System::FastForwardToFirstFrame()
   return (s_internal_frame_number != current_internal_frame_number);
 }
 
+void System::SetFramePhase(FramePhase phase)
+{
+  const Common::Timer::Value now = Common::Timer::GetCurrentValue();
+  s_frame_phase_durations[static_cast<size_t>(s_current_frame_phase.load(std::memory_order_relaxed))] +=
+    now - s_frame_phase_start_time;
+  s_frame_phase_start_time = now;
+  s_current_frame_phase.store(phase, std::memory_order_relaxed);
+}
+
 void System::Execute()
 {
   for (;;)
@@ -1741,6 +2106,7 @@ void System::Execute()
       case State::Running:
       {
         s_system_executing = true;
+        SetFramePhase(FramePhase::CPUExecution);
 
         // TODO: Purge reset/restore
         g_gpu->RestoreDeviceContext();
@@ -1771,6 +2137,12 @@ void System::Execute()
 void System::FrameDone()
 {
   s_frame_number++;
+  PerformanceProfiler::EndFrame();
+  SetFramePhase(FramePhase::FrameCompletion);
+
+  // Latch the newest input event the frame which just finished could have observed. Input is only
+  // polled on this thread, so anything newer arrives after this point and belongs to a later frame.
+  s_frame_input_timestamp = InputManager::GetLastEventTimestamp();
 
   // Vertex buffer is shared, need to flush what we have.
   g_gpu->FlushRender();
@@ -1779,6 +2151,12 @@ void System::FrameDone()
   // TODO: when running ahead, we can skip this (and the flush above)
   SPU::GeneratePendingSamples();
 
+  // Publish any blocks the background compiler finished this frame, and warm up the code cache
+  // from the persistent block list.
+  CPU::CodeCache::ProcessAsyncCompilationResults();
+  CPU::CodeCache::PrecompileWarmBlocks();
+  CPU::CodeCache::RelayoutHotBlocks();
+
   if (s_cheat_list)
     s_cheat_list->Apply();
 
@@ -1816,6 +2194,7 @@ void System::FrameDone()
       // For runahead, poll input early, that way we can use the remainder of this frame to replay.
       // *technically* this means higher input latency (by less than a frame), but runahead itself
       // counter-acts that.
+      SetFramePhase(FramePhase::HostPoll);
       Host::PumpMessagesOnCPUThread();
       InputManager::PollSources();
       g_gpu->RestoreDeviceContext();
@@ -1826,6 +2205,8 @@ void System::FrameDone()
         CPU::ExitExecution();
         return;
       }
+
+      SetFramePhase(FramePhase::FrameCompletion);
     }
 
     if (DoRunahead())
@@ -1837,6 +2218,8 @@ void System::FrameDone()
     SaveRunaheadState();
   }
 
+  SetFramePhase(FramePhase::Present);
+
   const Common::Timer::Value current_time = Common::Timer::GetCurrentValue();
   if (current_time < s_next_frame_time || s_display_all_frames || s_last_frame_skipped)
   {
@@ -1849,13 +2232,19 @@ void System::FrameDone()
   }
 
   if (s_throttler_enabled && !IsExecutionInterrupted())
+  {
+    SetFramePhase(FramePhase::Throttle);
     Throttle();
+  }
 
   // Input poll already done above
   if (s_runahead_frames == 0)
   {
+    // Settings reloads and other host requests land here.
+    SetFramePhase(FramePhase::HostPoll);
     Host::PumpMessagesOnCPUThread();
     InputManager::PollSources();
+    InputReplay::ProcessFrame();
 
     if (IsExecutionInterrupted())
     {
@@ -1916,11 +2305,29 @@ void System::Throttle()
     return;
   }
 
-  // Use a spinwait if we undersleep for all platforms except android.. don't want to burn battery.
-  // Linux also seems to do a much better job of waking up at the requested time.
-#if !defined(__linux__) && !defined(__ANDROID__)
-  Common::Timer::SleepUntil(s_next_frame_time, g_settings.display_all_frames);
+#ifndef __ANDROID__
+  // Sleep to short of the deadline by however much the host has been overshooting our wakeups,
+  // then spin the remainder off. The estimate attacks to the worst observed case and decays
+  // slowly, so it sits near the high percentiles of recent wakeups rather than the average,
+  // keeping the spin window as small as the kernel's timer slack actually requires.
+  const Common::Timer::Value max_overshoot = s_frame_period / 2;
+  const Common::Timer::Value sleep_until = s_next_frame_time - std::min(s_sleep_overshoot, max_overshoot);
+  if (sleep_until > current_time)
+  {
+    Common::Timer::SleepUntil(sleep_until, false);
+
+    current_time = Common::Timer::GetCurrentValue();
+    const Common::Timer::Value overshoot = (current_time > sleep_until) ? (current_time - sleep_until) : 0;
+    if (overshoot >= s_sleep_overshoot)
+      s_sleep_overshoot = std::min(overshoot, max_overshoot);
+    else
+      s_sleep_overshoot -= (s_sleep_overshoot >> 7);
+  }
+
+  while (Common::Timer::GetCurrentValue() < s_next_frame_time)
+    SpinPause();
 #else
+  // Don't want to burn battery spinning on Android.
   Common::Timer::SleepUntil(s_next_frame_time, false);
 #endif
 
@@ -1934,6 +2341,64 @@ void System::Throttle()
   s_next_frame_time += s_frame_period;
 }
 
+bool System::WillSkipPresentingCurrentFrame()
+{
+  // Mirrors the presentation decision in FrameDone(). Time is monotonic, so if the deadline has
+  // already passed here, FrameDone() will also see it as passed and skip the present; the reverse
+  // misprediction only costs a display update which doesn't end up being shown.
+  return (!s_display_all_frames && !s_last_frame_skipped && Common::Timer::GetCurrentValue() >= s_next_frame_time);
+}
+
+void System::UpdateHostRefreshRateMeasurement()
+{
+  // Only meaningful when presents are paced by vsync; with the sleep throttler active, the
+  // interval between presents reflects our own timer, not the display.
+  if (!s_syncing_to_host || s_throttler_enabled)
+    return;
+
+  const Common::Timer::Value now = Common::Timer::GetCurrentValue();
+  const Common::Timer::Value last = std::exchange(s_last_present_time, now);
+  if (last == 0)
+    return;
+
+  // Reject missed vblanks and spuriously-fast presents, otherwise a single compositor hiccup
+  // would skew the estimate for the whole measurement window.
+  const Common::Timer::Value interval = now - last;
+  if (interval < (s_frame_period / 2) || interval > (s_frame_period + (s_frame_period / 2)))
+    return;
+
+  s_accumulated_present_interval += interval;
+  if (++s_accumulated_present_count < HOST_REFRESH_MEASUREMENT_PRESENTS)
+    return;
+
+  const double mean_interval = Common::Timer::ConvertValueToSeconds(s_accumulated_present_interval) /
+                               static_cast<double>(s_accumulated_present_count);
+  s_accumulated_present_interval = 0;
+  s_accumulated_present_count = 0;
+
+  const float measured_rate = static_cast<float>(1.0 / mean_interval);
+  const float ratio = measured_rate / GetThrottleFrequency();
+  if (ratio < 0.95f || ratio > 1.05f)
+    return;
+
+  // Ignore sub-0.02% deltas, that's measurement noise rather than drift.
+  if (std::abs(ratio - s_target_speed) < 0.0002f)
+    return;
+
+  Log_DevPrintf("Measured host refresh rate %fhz (ratio %f), adjusting speed from %f", measured_rate, ratio,
+                s_target_speed);
+
+  const float old_target_speed = s_target_speed;
+  s_target_speed = ratio;
+
+  AudioStream* stream = SPU::GetOutputStream();
+  stream->SetNominalRate(s_target_speed);
+  if (old_target_speed < s_target_speed)
+    stream->UpdateTargetTempo(s_target_speed);
+
+  UpdateThrottlePeriod();
+}
+
 void System::SingleStepCPU()
 {
   s_frame_timer.Reset();
@@ -2043,10 +2508,27 @@ bool System::CreateGPU(GPURenderer renderer, bool is_switching)
     }
   }
 
+  // The renderer compiled its full pipeline set above; flush the driver pipeline cache now so the
+  // warm cache survives even if this session ends uncleanly.
+  g_gpu_device->FlushPipelineCache();
+
   return true;
 }
 
-bool System::DoState(StateWrapper& sw, GPUTexture** host_texture, bool update_display, bool is_memory_state)
+// Subsystem sections gained byte sizes in version 62, so readers can seek over sections and
+// tolerate trailing fields added by later versions. Older states only have bare markers.
+ALWAYS_INLINE static bool BeginStateSection(StateWrapper& sw, const char* marker)
+{
+  return (sw.GetVersion() >= 62) ? sw.BeginSection(marker) : sw.DoMarker(marker);
+}
+
+ALWAYS_INLINE static bool EndStateSection(StateWrapper& sw)
+{
+  return (sw.GetVersion() >= 62) ? sw.EndSection() : !sw.HasError();
+}
+
+bool System::DoState(StateWrapper& sw, GPUTexture** host_texture, u64* host_texture_id, bool update_display,
+                     bool is_memory_state, bool skip_ram /* = false */)
 {
   if (!sw.DoMarker("System"))
     return false;
@@ -2072,7 +2554,7 @@ bool System::DoState(StateWrapper& sw, GPUTexture** host_texture, bool update_di
     }
   }
 
-  if (!sw.DoMarker("CPU") || !CPU::DoState(sw))
+  if (!BeginStateSection(sw, "CPU") || !CPU::DoState(sw) || !EndStateSection(sw))
     return false;
 
   if (sw.IsReading())
@@ -2088,41 +2570,42 @@ bool System::DoState(StateWrapper& sw, GPUTexture** host_texture, bool update_di
   if (sw.IsReading() && g_settings.gpu_pgxp_enable && !is_memory_state)
     CPU::PGXP::Reset();
 
-  if (!sw.DoMarker("Bus") || !Bus::DoState(sw))
+  if (!BeginStateSection(sw, "Bus") || !Bus::DoState(sw, skip_ram) || !EndStateSection(sw))
     return false;
 
-  if (!sw.DoMarker("DMA") || !DMA::DoState(sw))
+  if (!BeginStateSection(sw, "DMA") || !DMA::DoState(sw) || !EndStateSection(sw))
     return false;
 
-  if (!sw.DoMarker("InterruptController") || !InterruptController::DoState(sw))
+  if (!BeginStateSection(sw, "InterruptController") || !InterruptController::DoState(sw) || !EndStateSection(sw))
     return false;
 
   g_gpu->RestoreDeviceContext();
-  if (!sw.DoMarker("GPU") || !g_gpu->DoState(sw, host_texture, update_display))
+  if (!BeginStateSection(sw, "GPU") || !g_gpu->DoState(sw, host_texture, host_texture_id, update_display) ||
+      !EndStateSection(sw))
     return false;
 
-  if (!sw.DoMarker("CDROM") || !CDROM::DoState(sw))
+  if (!BeginStateSection(sw, "CDROM") || !CDROM::DoState(sw) || !EndStateSection(sw))
     return false;
 
-  if (!sw.DoMarker("Pad") || !Pad::DoState(sw, is_memory_state))
+  if (!BeginStateSection(sw, "Pad") || !Pad::DoState(sw, is_memory_state) || !EndStateSection(sw))
     return false;
 
-  if (!sw.DoMarker("Timers") || !Timers::DoState(sw))
+  if (!BeginStateSection(sw, "Timers") || !Timers::DoState(sw) || !EndStateSection(sw))
     return false;
 
-  if (!sw.DoMarker("SPU") || !SPU::DoState(sw))
+  if (!BeginStateSection(sw, "SPU") || !SPU::DoState(sw) || !EndStateSection(sw))
     return false;
 
-  if (!sw.DoMarker("MDEC") || !MDEC::DoState(sw))
+  if (!BeginStateSection(sw, "MDEC") || !MDEC::DoState(sw) || !EndStateSection(sw))
     return false;
 
-  if (!sw.DoMarker("SIO") || !SIO::DoState(sw))
+  if (!BeginStateSection(sw, "SIO") || !SIO::DoState(sw) || !EndStateSection(sw))
     return false;
 
-  if (!sw.DoMarker("Events") || !TimingEvents::DoState(sw))
+  if (!BeginStateSection(sw, "Events") || !TimingEvents::DoState(sw) || !EndStateSection(sw))
     return false;
 
-  if (!sw.DoMarker("Overclock"))
+  if (!BeginStateSection(sw, "Overclock"))
     return false;
 
   bool cpu_overclock_active = g_settings.cpu_overclock_active;
@@ -2132,6 +2615,9 @@ bool System::DoState(StateWrapper& sw, GPUTexture** host_texture, bool update_di
   sw.Do(&cpu_overclock_numerator);
   sw.Do(&cpu_overclock_denominator);
 
+  if (!EndStateSection(sw))
+    return false;
+
   if (sw.IsReading() && (cpu_overclock_active != g_settings.cpu_overclock_active ||
                          (cpu_overclock_active && (g_settings.cpu_overclock_numerator != cpu_overclock_numerator ||
                                                    g_settings.cpu_overclock_denominator != cpu_overclock_denominator))))
@@ -2149,10 +2635,10 @@ bool System::DoState(StateWrapper& sw, GPUTexture** host_texture, bool update_di
   {
     if (sw.GetVersion() >= 56)
     {
-      if (!sw.DoMarker("Cheevos"))
+      if (!BeginStateSection(sw, "Cheevos"))
         return false;
 
-      if (!Achievements::DoState(sw))
+      if (!Achievements::DoState(sw) || !EndStateSection(sw))
         return false;
     }
     else
@@ -2373,14 +2859,14 @@ bool System::LoadStateFromStream(ByteStream* state, bool update_display, bool ig
   if (header.data_compression_type == SAVE_STATE_HEADER::COMPRESSION_TYPE_NONE)
   {
     StateWrapper sw(state, StateWrapper::Mode::Read, header.version);
-    if (!DoState(sw, nullptr, update_display, false))
+    if (!DoState(sw, nullptr, nullptr, update_display, false))
       return false;
   }
   else if (header.data_compression_type == SAVE_STATE_HEADER::COMPRESSION_TYPE_ZSTD)
   {
     std::unique_ptr<ByteStream> dstream(ByteStream::CreateZstdDecompressStream(state, header.data_compressed_size));
     StateWrapper sw(dstream.get(), StateWrapper::Mode::Read, header.version);
-    if (!DoState(sw, nullptr, update_display, false))
+    if (!DoState(sw, nullptr, nullptr, update_display, false))
       return false;
   }
   else
@@ -2485,14 +2971,14 @@ bool System::SaveStateToStream(ByteStream* state, u32 screenshot_size /* = 256 *
     if (compression_method == SAVE_STATE_HEADER::COMPRESSION_TYPE_NONE)
     {
       StateWrapper sw(state, StateWrapper::Mode::Write, SAVE_STATE_VERSION);
-      result = DoState(sw, nullptr, false, false);
+      result = DoState(sw, nullptr, nullptr, false, false);
       header.data_uncompressed_size = static_cast<u32>(state->GetPosition() - header.offset_to_data);
     }
     else if (compression_method == SAVE_STATE_HEADER::COMPRESSION_TYPE_ZSTD)
     {
       std::unique_ptr<ByteStream> cstream(ByteStream::CreateZstdCompressStream(state, 0));
       StateWrapper sw(cstream.get(), StateWrapper::Mode::Write, SAVE_STATE_VERSION);
-      result = DoState(sw, nullptr, false, false) && cstream->Commit();
+      result = DoState(sw, nullptr, nullptr, false, false) && cstream->Commit();
       header.data_uncompressed_size = static_cast<u32>(cstream->GetPosition());
       header.data_compressed_size = static_cast<u32>(state->GetPosition() - header.offset_to_data);
     }
@@ -2520,6 +3006,31 @@ float System::GetTargetSpeed()
 void System::UpdatePerformanceCounters()
 {
   const float frame_time = static_cast<float>(s_frame_timer.GetTimeMillisecondsAndReset());
+
+  // Close out the frame's last phase segment, and attribute the frame if it stalled.
+  SetFramePhase(FramePhase::CPUExecution);
+  if (frame_time >= SLOW_FRAME_TIME_THRESHOLD_MS) [[unlikely]]
+  {
+    size_t dominant = 0;
+    for (size_t i = 1; i < s_frame_phase_durations.size(); i++)
+    {
+      if (s_frame_phase_durations[i] > s_frame_phase_durations[dominant])
+        dominant = i;
+    }
+
+    s_slow_frame_count++;
+    s_slow_frame_phase_counts[dominant]++;
+    Log_PerfFmt("Frame {} took {:.1f} ms: cpu {:.1f} ms, completion {:.1f} ms, present {:.1f} ms, throttle {:.1f} ms, "
+                "host {:.1f} ms",
+                s_frame_number, frame_time,
+                Common::Timer::ConvertValueToMilliseconds(s_frame_phase_durations[0]),
+                Common::Timer::ConvertValueToMilliseconds(s_frame_phase_durations[1]),
+                Common::Timer::ConvertValueToMilliseconds(s_frame_phase_durations[2]),
+                Common::Timer::ConvertValueToMilliseconds(s_frame_phase_durations[3]),
+                Common::Timer::ConvertValueToMilliseconds(s_frame_phase_durations[4]));
+  }
+  s_frame_phase_durations = {};
+
   s_minimum_frame_time_accumulator =
     (s_minimum_frame_time_accumulator == 0.0f) ? frame_time : std::min(s_minimum_frame_time_accumulator, frame_time);
   s_average_frame_time_accumulator += frame_time;
@@ -2576,10 +3087,28 @@ void System::UpdatePerformanceCounters()
   {
     s_average_gpu_time = s_accumulated_gpu_time / static_cast<float>(std::max(s_presents_since_last_update, 1u));
     s_gpu_usage = s_accumulated_gpu_time / (time * 10.0f);
+    for (size_t i = 0; i < s_accumulated_stage_gpu_time.size(); i++)
+    {
+      s_average_stage_gpu_time[i] =
+        s_accumulated_stage_gpu_time[i] / static_cast<float>(std::max(s_presents_since_last_update, 1u));
+    }
+
+    if (g_settings.gpu_dynamic_resolution_scale)
+      g_gpu->UpdateDynamicResolutionScale(s_average_gpu_time);
   }
   s_accumulated_gpu_time = 0.0f;
+  s_accumulated_stage_gpu_time.fill(0.0f);
   s_presents_since_last_update = 0;
 
+  if (s_input_latency_samples > 0)
+  {
+    s_minimum_input_latency = std::exchange(s_minimum_input_latency_accumulator, 0.0f);
+    s_average_input_latency =
+      std::exchange(s_input_latency_accumulator, 0.0f) / static_cast<float>(s_input_latency_samples);
+    s_maximum_input_latency = std::exchange(s_maximum_input_latency_accumulator, 0.0f);
+    s_input_latency_samples = 0;
+  }
+
   Log_VerbosePrintf("FPS: %.2f VPS: %.2f CPU: %.2f GPU: %.2f Average: %.2fms Min: %.2fms Max: %.2f ms", s_fps, s_vps,
                     s_cpu_thread_usage, s_gpu_usage, s_average_frame_time, s_minimum_frame_time, s_maximum_frame_time);
 
@@ -2600,8 +3129,16 @@ void System::ResetPerformanceCounters()
   s_average_frame_time_accumulator = 0.0f;
   s_minimum_frame_time_accumulator = 0.0f;
   s_maximum_frame_time_accumulator = 0.0f;
+  s_input_latency_accumulator = 0.0f;
+  s_minimum_input_latency_accumulator = 0.0f;
+  s_maximum_input_latency_accumulator = 0.0f;
+  s_input_latency_samples = 0;
   s_frame_timer.Reset();
   s_fps_timer.Reset();
+  // the first frame after a pause shouldn't be attributed as a stall
+  s_frame_phase_durations = {};
+  s_frame_phase_start_time = Common::Timer::GetCurrentValue();
+  PerformanceProfiler::Reset();
   ResetThrottler();
 }
 
@@ -2637,6 +3174,11 @@ void System::UpdateSpeedLimiterState()
     s_throttler_enabled = false;
   }
 
+  // Restart the present interval measurement, the reported rate may have changed.
+  s_last_present_time = 0;
+  s_accumulated_present_interval = 0;
+  s_accumulated_present_count = 0;
+
   Log_VerbosePrintf("Target speed: %f%%", s_target_speed * 100.0f);
 
   if (IsValid())
@@ -2646,8 +3188,9 @@ void System::UpdateSpeedLimiterState()
     stream->SetOutputVolume(GetAudioOutputVolume());
 
     // Adjust nominal rate when resampling, or syncing to host.
-    const bool rate_adjust =
-      (s_syncing_to_host || g_settings.audio_stretch_mode == AudioStretchMode::Resample) && s_target_speed > 0.0f;
+    const bool rate_adjust = (s_syncing_to_host || g_settings.audio_stretch_mode == AudioStretchMode::Resample ||
+                              g_settings.audio_stretch_mode == AudioStretchMode::PolyphaseResample) &&
+                             s_target_speed > 0.0f;
     stream->SetNominalRate(rate_adjust ? s_target_speed : 1.0f);
 
     if (old_target_speed < s_target_speed)
@@ -2677,6 +3220,7 @@ void System::UpdateDisplaySync()
 
   g_gpu_device->SetDisplayMaxFPS(max_display_fps);
   g_gpu_device->SetVSync(video_sync_enabled);
+  g_gpu_device->SetMaxQueuedFrames(g_settings.gpu_max_queued_frames);
 }
 
 bool System::ShouldUseVSync()
@@ -2783,6 +3327,50 @@ void System::DoToggleCheats()
     10.0f);
 }
 
+// Returns a pointer into RAM (through the unprotected mirror) when the given guest address range
+// lies wholly within it, otherwise null. Callers writing through it must invalidate the code
+// cache afterwards; per-word SafeWriteMemoryWord() with its address translation is the fallback.
+static u8* GetDirectRAMWritePointer(u32 address, u32 size)
+{
+  const PhysicalMemoryAddress paddr = address & CPU::PHYSICAL_MEMORY_ADDRESS_MASK;
+  if (paddr >= Bus::RAM_MIRROR_END || ((paddr & Bus::g_ram_mask) + size) > Bus::g_ram_size)
+    return nullptr;
+
+  return &Bus::g_unprotected_ram[paddr & Bus::g_ram_mask];
+}
+
+static void BulkZeroGuestMemory(u32 address, u32 num_words)
+{
+  if (u8* const ram = GetDirectRAMWritePointer(address, num_words * 4))
+  {
+    std::memset(ram, 0, num_words * 4);
+    CPU::CodeCache::InvalidateAllRAMBlocks();
+    return;
+  }
+
+  for (u32 i = 0; i < num_words; i++)
+  {
+    CPU::SafeWriteMemoryWord(address, 0);
+    address += sizeof(u32);
+  }
+}
+
+static void BulkWriteGuestMemory(u32 address, const u32* words, u32 num_words)
+{
+  if (u8* const ram = GetDirectRAMWritePointer(address, num_words * 4))
+  {
+    std::memcpy(ram, words, num_words * 4);
+    CPU::CodeCache::InvalidateAllRAMBlocks();
+    return;
+  }
+
+  for (u32 i = 0; i < num_words; i++)
+  {
+    CPU::SafeWriteMemoryWord(address, words[i]);
+    address += sizeof(u32);
+  }
+}
+
 static bool LoadEXEToRAM(const char* filename, bool patch_bios)
 {
   std::FILE* fp = FileSystem::OpenCFile(filename, "rb");
@@ -2805,32 +3393,34 @@ static bool LoadEXEToRAM(const char* filename, bool patch_bios)
   }
 
   if (header.memfill_size > 0)
-  {
-    const u32 words_to_write = header.memfill_size / 4;
-    u32 address = header.memfill_start & ~UINT32_C(3);
-    for (u32 i = 0; i < words_to_write; i++)
-    {
-      CPU::SafeWriteMemoryWord(address, 0);
-      address += sizeof(u32);
-    }
-  }
+    BulkZeroGuestMemory(header.memfill_start & ~UINT32_C(3), header.memfill_size / 4);
 
   const u32 file_data_size = std::min<u32>(file_size - sizeof(BIOS::PSEXEHeader), header.file_size);
   if (file_data_size >= 4)
   {
-    std::vector<u32> data_words((file_data_size + 3) / 4);
-    if (std::fread(data_words.data(), file_data_size, 1, fp) != 1)
+    const u32 num_words = file_data_size / 4;
+
+    // Stream straight into RAM when the target is wholly within it, skipping the bounce buffer.
+    if (u8* const ram = GetDirectRAMWritePointer(header.load_address, num_words * 4))
     {
-      std::fclose(fp);
-      return false;
-    }
+      if (std::fread(ram, num_words * 4, 1, fp) != 1)
+      {
+        std::fclose(fp);
+        return false;
+      }
 
-    const u32 num_words = file_data_size / 4;
-    u32 address = header.load_address;
-    for (u32 i = 0; i < num_words; i++)
+      CPU::CodeCache::InvalidateAllRAMBlocks();
+    }
+    else
     {
-      CPU::SafeWriteMemoryWord(address, data_words[i]);
-      address += sizeof(u32);
+      std::vector<u32> data_words((file_data_size + 3) / 4);
+      if (std::fread(data_words.data(), file_data_size, 1, fp) != 1)
+      {
+        std::fclose(fp);
+        return false;
+      }
+
+      BulkWriteGuestMemory(header.load_address, data_words.data(), num_words);
     }
   }
 
@@ -2873,32 +3463,17 @@ bool System::InjectEXEFromBuffer(const void* buffer, u32 buffer_size, bool patch
     return false;
 
   if (header.memfill_size > 0)
-  {
-    const u32 words_to_write = header.memfill_size / 4;
-    u32 address = header.memfill_start & ~UINT32_C(3);
-    for (u32 i = 0; i < words_to_write; i++)
-    {
-      CPU::SafeWriteMemoryWord(address, 0);
-      address += sizeof(u32);
-    }
-  }
+    BulkZeroGuestMemory(header.memfill_start & ~UINT32_C(3), header.memfill_size / 4);
 
   const u32 file_data_size = std::min<u32>(file_size - sizeof(BIOS::PSEXEHeader), header.file_size);
   if (file_data_size >= 4)
   {
-    std::vector<u32> data_words((file_data_size + 3) / 4);
-    if ((buffer_end - buffer_ptr) < file_data_size)
+    if (static_cast<u32>(buffer_end - buffer_ptr) < file_data_size)
       return false;
 
+    std::vector<u32> data_words((file_data_size + 3) / 4);
     std::memcpy(data_words.data(), buffer_ptr, file_data_size);
-
-    const u32 num_words = file_data_size / 4;
-    u32 address = header.load_address;
-    for (u32 i = 0; i < num_words; i++)
-    {
-      CPU::SafeWriteMemoryWord(address, data_words[i]);
-      address += sizeof(u32);
-    }
+    BulkWriteGuestMemory(header.load_address, data_words.data(), file_data_size / 4);
   }
 
   // patch the BIOS to jump to the executable directly
@@ -3382,7 +3957,10 @@ void System::UpdateRunningGame(const char* path, CDImage* image, bool booting)
     LoadCheatListFromGameTitle();
 
   if (s_running_game_serial != prev_serial)
+  {
     UpdateSessionTime(prev_serial);
+    CPU::CodeCache::GameSerialChanged(s_running_game_serial);
+  }
 
   SaveStateSelectorUI::RefreshList();
 
@@ -3574,6 +4152,8 @@ void System::CheckForSettingsChanges(const Settings& old_settings)
     }
     if (g_settings.audio_stretch_mode != old_settings.audio_stretch_mode)
       SPU::GetOutputStream()->SetStretchMode(g_settings.audio_stretch_mode);
+    if (g_settings.audio_adaptive_buffer_size != old_settings.audio_adaptive_buffer_size)
+      SPU::GetOutputStream()->SetAdaptiveBufferSizing(g_settings.audio_adaptive_buffer_size);
     if (g_settings.audio_buffer_ms != old_settings.audio_buffer_ms ||
         g_settings.audio_output_latency_ms != old_settings.audio_output_latency_ms ||
         g_settings.audio_stretch_mode != old_settings.audio_stretch_mode)
@@ -3605,7 +4185,11 @@ void System::CheckForSettingsChanges(const Settings& old_settings)
         (g_settings.cpu_recompiler_memory_exceptions != old_settings.cpu_recompiler_memory_exceptions ||
          g_settings.cpu_recompiler_block_linking != old_settings.cpu_recompiler_block_linking ||
          g_settings.cpu_recompiler_icache != old_settings.cpu_recompiler_icache ||
-         g_settings.bios_tty_logging != old_settings.bios_tty_logging))
+         g_settings.cpu_recompiler_async_compile != old_settings.cpu_recompiler_async_compile ||
+         g_settings.cpu_idle_loop_detection != old_settings.cpu_idle_loop_detection ||
+         g_settings.cpu_overclock_active != old_settings.cpu_overclock_active ||
+         g_settings.bios_tty_logging != old_settings.bios_tty_logging ||
+         g_settings.bios_hle_memory_functions != old_settings.bios_hle_memory_functions))
     {
       Host::AddIconOSDMessage("CPUFlushAllBlocks", ICON_FA_MICROCHIP,
                               TRANSLATE_STR("OSDMessage", "Recompiler options changed, flushing all blocks."),
@@ -3620,6 +4204,7 @@ void System::CheckForSettingsChanges(const Settings& old_settings)
     SPU::GetOutputStream()->SetOutputVolume(GetAudioOutputVolume());
 
     if (g_settings.gpu_resolution_scale != old_settings.gpu_resolution_scale ||
+        g_settings.gpu_dynamic_resolution_scale != old_settings.gpu_dynamic_resolution_scale ||
         g_settings.gpu_multisamples != old_settings.gpu_multisamples ||
         g_settings.gpu_per_sample_shading != old_settings.gpu_per_sample_shading ||
         g_settings.gpu_use_thread != old_settings.gpu_use_thread ||
@@ -3667,7 +4252,8 @@ void System::CheckForSettingsChanges(const Settings& old_settings)
     if (g_settings.gpu_pgxp_enable != old_settings.gpu_pgxp_enable ||
         (g_settings.gpu_pgxp_enable && (g_settings.gpu_pgxp_culling != old_settings.gpu_pgxp_culling ||
                                         g_settings.gpu_pgxp_vertex_cache != old_settings.gpu_pgxp_vertex_cache ||
-                                        g_settings.gpu_pgxp_cpu != old_settings.gpu_pgxp_cpu)))
+                                        g_settings.gpu_pgxp_cpu != old_settings.gpu_pgxp_cpu ||
+                                        g_settings.gpu_pgxp_vertex_only != old_settings.gpu_pgxp_vertex_only)))
     {
       if (old_settings.gpu_pgxp_enable)
         CPU::PGXP::Shutdown();
@@ -3783,15 +4369,46 @@ void System::CheckForSettingsChanges(const Settings& old_settings)
 
 void System::CalculateRewindMemoryUsage(u32 num_saves, u64* ram_usage, u64* vram_usage)
 {
-  *ram_usage = MAX_SAVE_STATE_SIZE * static_cast<u64>(num_saves);
+  // rewind slots hold sparse XOR deltas rather than full snapshots; frame-to-frame churn is
+  // typically a few percent of the state, so budget a sixteenth per slot plus the two full
+  // reconstruction buffers
+  *ram_usage = ((MAX_SAVE_STATE_SIZE / 16) * static_cast<u64>(num_saves)) + (MAX_SAVE_STATE_SIZE * 2);
   *vram_usage = (VRAM_WIDTH * VRAM_HEIGHT * 4) * static_cast<u64>(std::max(g_settings.gpu_resolution_scale, 1u)) *
                 static_cast<u64>(g_settings.gpu_multisamples) * static_cast<u64>(num_saves);
 }
 
 void System::ClearMemorySaveStates()
 {
+  // Anything that invalidates rewind/runahead snapshots (media change, settings apply, GPU
+  // recreation) also invalidates the warm-reset baseline; the next reset falls back to cold.
+  s_warm_reset_state = {};
+  s_warm_reset_state_valid = false;
+
   s_rewind_states.clear();
   s_runahead_states.clear();
+  s_rewind_base_state.reset();
+  s_rewind_scratch_state.reset();
+
+  Bus::StopSnapshotDirtyTracking();
+  s_runahead_ram_shadow.reset();
+
+  UpdateRewindMemoryTracking();
+}
+
+void System::UpdateRewindMemoryTracking()
+{
+  if (!MemoryTracker::IsEnabled())
+    return;
+
+  size_t total = 0;
+  for (const MemorySaveState& mss : s_rewind_states)
+    total += mss.state_stream ? static_cast<size_t>(mss.state_stream->GetSize()) : 0;
+  if (s_rewind_base_state)
+    total += static_cast<size_t>(s_rewind_base_state->GetSize());
+  if (s_rewind_scratch_state)
+    total += static_cast<size_t>(s_rewind_scratch_state->GetSize());
+
+  MemoryTracker::SetAllocation(MemoryTracker::Tag::Rewind, total);
 }
 
 void System::UpdateMemorySaveStateSettings()
@@ -3826,13 +4443,14 @@ void System::UpdateMemorySaveStateSettings()
     Log_InfoPrintf("Runahead is active with %u frames", s_runahead_frames);
 }
 
-bool System::LoadMemoryState(const MemorySaveState& mss)
+bool System::LoadMemoryState(const MemorySaveState& mss, bool skip_ram /* = false */)
 {
   mss.state_stream->SeekAbsolute(0);
 
   StateWrapper sw(mss.state_stream.get(), StateWrapper::Mode::Read, SAVE_STATE_VERSION);
   GPUTexture* host_texture = mss.vram_texture.get();
-  if (!DoState(sw, &host_texture, true, true))
+  u64 host_texture_id = mss.vram_snapshot_id;
+  if (!DoState(sw, &host_texture, &host_texture_id, true, true, skip_ram))
   {
     Host::ReportErrorAsync("Error", "Failed to load memory save state, resetting.");
     InternalReset();
@@ -3842,7 +4460,7 @@ bool System::LoadMemoryState(const MemorySaveState& mss)
   return true;
 }
 
-bool System::SaveMemoryState(MemorySaveState* mss)
+bool System::SaveMemoryState(MemorySaveState* mss, bool skip_ram /* = false */)
 {
   if (!mss->state_stream)
     mss->state_stream = std::make_unique<GrowableMemoryByteStream>(nullptr, MAX_SAVE_STATE_SIZE);
@@ -3851,7 +4469,7 @@ bool System::SaveMemoryState(MemorySaveState* mss)
 
   GPUTexture* host_texture = mss->vram_texture.release();
   StateWrapper sw(mss->state_stream.get(), StateWrapper::Mode::Write, SAVE_STATE_VERSION);
-  if (!DoState(sw, &host_texture, false, true))
+  if (!DoState(sw, &host_texture, &mss->vram_snapshot_id, false, true, skip_ram))
   {
     Log_ErrorPrint("Failed to create rewind state.");
     delete host_texture;
@@ -3862,6 +4480,110 @@ bool System::SaveMemoryState(MemorySaveState* mss)
   return true;
 }
 
+// Rewind slots store sparse XOR deltas against the neighbouring state in the chain instead of
+// full snapshots. XOR is its own inverse, so applying a slot's delta to the reconstruction
+// buffer steps it across that slot in either direction. Blocks are compared at 64-byte
+// granularity and only differing runs are written out.
+void System::EncodeRewindDelta(const u8* new_state, u32 new_size, const u8* old_state, u32 old_size,
+                               GrowableMemoryByteStream* delta)
+{
+  static constexpr u32 BLOCK_SIZE = 64;
+
+  delta->SeekAbsolute(0);
+  delta->Write(&new_size, sizeof(new_size));
+  delta->Write(&old_size, sizeof(old_size));
+
+  const u32 compare_size = std::min(new_size, old_size);
+  const u32 total_size = std::max(new_size, old_size);
+
+  const auto emit_range = [&](u32 start, u32 end) {
+    const u32 length = end - start;
+    delta->Write(&start, sizeof(start));
+    delta->Write(&length, sizeof(length));
+
+    u32 pos = start;
+    while (pos < end)
+    {
+      u8 buf[BLOCK_SIZE];
+      const u32 len = std::min(end - pos, BLOCK_SIZE);
+      for (u32 i = 0; i < len; i++)
+      {
+        const u32 offset = pos + i;
+        buf[i] = ((offset < new_size) ? new_state[offset] : u8(0)) ^ ((offset < old_size) ? old_state[offset] : u8(0));
+      }
+      delta->Write(buf, len);
+      pos += len;
+    }
+  };
+
+  u32 range_start = 0;
+  bool in_range = false;
+  u32 offset = 0;
+  while (offset < total_size)
+  {
+    const u32 len = std::min(total_size - offset, BLOCK_SIZE);
+    const bool changed =
+      ((offset + len) > compare_size) || (std::memcmp(&new_state[offset], &old_state[offset], len) != 0);
+    if (changed && !in_range)
+    {
+      range_start = offset;
+      in_range = true;
+    }
+    else if (!changed && in_range)
+    {
+      emit_range(range_start, offset);
+      in_range = false;
+    }
+
+    offset += len;
+  }
+  if (in_range)
+    emit_range(range_start, total_size);
+
+  delta->Resize(static_cast<u32>(delta->GetPosition()));
+}
+
+void System::ApplyRewindDelta(GrowableMemoryByteStream* state, GrowableMemoryByteStream* delta)
+{
+  delta->SeekAbsolute(0);
+
+  u32 size_a, size_b;
+  delta->Read(&size_a, sizeof(size_a));
+  delta->Read(&size_b, sizeof(size_b));
+
+  // deltas are symmetric, so the target size is whichever of the pair the buffer isn't at
+  const u32 old_size = static_cast<u32>(state->GetSize());
+  const u32 new_size = (old_size == size_a) ? size_b : size_a;
+  if (new_size > old_size)
+  {
+    state->Resize(new_size);
+    std::memset(state->GetMemoryPointer() + old_size, 0, new_size - old_size);
+  }
+
+  u8* const mem = state->GetMemoryPointer();
+  while (delta->GetPosition() < delta->GetSize())
+  {
+    u32 range_offset, range_length;
+    delta->Read(&range_offset, sizeof(range_offset));
+    delta->Read(&range_length, sizeof(range_length));
+
+    u32 pos = range_offset;
+    const u32 end = range_offset + range_length;
+    while (pos < end)
+    {
+      u8 buf[64];
+      const u32 len = std::min(end - pos, static_cast<u32>(sizeof(buf)));
+      delta->Read(buf, len);
+      for (u32 i = 0; i < len; i++)
+        mem[pos + i] ^= buf[i];
+      pos += len;
+    }
+  }
+
+  if (new_size < old_size)
+    state->Resize(new_size);
+}
+
 bool System::SaveRewindState()
 {
 #ifdef PROFILE_MEMORY_SAVE_STATES
@@ -3877,10 +4599,38 @@ bool System::SaveRewindState()
     s_rewind_states.pop_front();
   }
 
-  if (!SaveMemoryState(&mss))
+  // serialize the full state into the scratch buffer, the slot itself only stores the delta
+  if (!s_rewind_scratch_state)
+    s_rewind_scratch_state = std::make_unique<GrowableMemoryByteStream>(nullptr, MAX_SAVE_STATE_SIZE);
+  else
+    s_rewind_scratch_state->SeekAbsolute(0);
+
+  GPUTexture* host_texture = mss.vram_texture.release();
+  StateWrapper sw(s_rewind_scratch_state.get(), StateWrapper::Mode::Write, SAVE_STATE_VERSION);
+  if (!DoState(sw, &host_texture, &mss.vram_snapshot_id, false, true))
+  {
+    Log_ErrorPrint("Failed to create rewind state.");
+    delete host_texture;
     return false;
+  }
+
+  mss.vram_texture.reset(host_texture);
+  s_rewind_scratch_state->Resize(static_cast<u32>(s_rewind_scratch_state->GetPosition()));
+
+  if (!mss.state_stream)
+    mss.state_stream = std::make_unique<GrowableMemoryByteStream>(nullptr, 0);
+  if (!s_rewind_base_state)
+    s_rewind_base_state = std::make_unique<GrowableMemoryByteStream>(nullptr, 0);
+
+  EncodeRewindDelta(s_rewind_scratch_state->GetMemoryPointer(), static_cast<u32>(s_rewind_scratch_state->GetSize()),
+                    s_rewind_base_state->GetMemoryPointer(), static_cast<u32>(s_rewind_base_state->GetSize()),
+                    mss.state_stream.get());
+
+  // the fresh serialization becomes the new reconstruction buffer
+  std::swap(s_rewind_base_state, s_rewind_scratch_state);
 
   s_rewind_states.push_back(std::move(mss));
+  UpdateRewindMemoryTracking();
 
 #ifdef PROFILE_MEMORY_SAVE_STATES
   Log_DevPrintf("Saved rewind state (%" PRIu64 " bytes, took %.4f ms)", s_rewind_states.back().state_stream->GetSize(),
@@ -3894,7 +4644,9 @@ bool System::LoadRewindState(u32 skip_saves /*= 0*/, bool consume_state /*=true
 {
   while (skip_saves > 0 && !s_rewind_states.empty())
   {
-    g_gpu_device->RecycleTexture(std::move(s_rewind_states.front().vram_texture));
+    // step the reconstruction buffer back across the skipped slot
+    ApplyRewindDelta(s_rewind_base_state.get(), s_rewind_states.back().state_stream.get());
+    g_gpu_device->RecycleTexture(std::move(s_rewind_states.back().vram_texture));
     s_rewind_states.pop_back();
     skip_saves--;
   }
@@ -3906,11 +4658,25 @@ bool System::LoadRewindState(u32 skip_saves /*= 0*/, bool consume_state /*=true
   Common::Timer load_timer;
 #endif
 
-  if (!LoadMemoryState(s_rewind_states.back()))
+  // the back of the chain is always fully reconstructed in s_rewind_base_state
+  s_rewind_base_state->SeekAbsolute(0);
+  StateWrapper sw(s_rewind_base_state.get(), StateWrapper::Mode::Read, SAVE_STATE_VERSION);
+  GPUTexture* host_texture = s_rewind_states.back().vram_texture.get();
+  u64 host_texture_id = s_rewind_states.back().vram_snapshot_id;
+  if (!DoState(sw, &host_texture, &host_texture_id, true, true))
+  {
+    Host::ReportErrorAsync("Error", "Failed to load memory save state, resetting.");
+    InternalReset();
     return false;
+  }
 
   if (consume_state)
+  {
+    ApplyRewindDelta(s_rewind_base_state.get(), s_rewind_states.back().state_stream.get());
     s_rewind_states.pop_back();
+  }
+
+  UpdateRewindMemoryTracking();
 
 #ifdef PROFILE_MEMORY_SAVE_STATES
   Log_DevPrintf("Rewind load took %.4f ms", load_timer.GetTimeMilliseconds());
@@ -3980,7 +4746,28 @@ void System::SaveRunaheadState()
     s_runahead_states.pop_front();
   }
 
-  if (!SaveMemoryState(&mss))
+  // RAM isn't serialized for runahead states; the undo buffer captures the pre-frame contents of
+  // everything this frame wrote, from the shadow copy of the previous state
+  mss.ram_undo_pages.clear();
+  if (!s_runahead_ram_shadow)
+  {
+    s_runahead_ram_shadow = std::make_unique<u8[]>(Bus::RAM_8MB_SIZE);
+    std::memcpy(s_runahead_ram_shadow.get(), Bus::g_ram, Bus::g_ram_size);
+    Bus::StartSnapshotDirtyTracking();
+  }
+  else
+  {
+    Bus::GetAndClearSnapshotDirtyPages(&mss.ram_undo_pages);
+    mss.ram_undo_data.resize(mss.ram_undo_pages.size() * HOST_PAGE_SIZE);
+    for (size_t i = 0; i < mss.ram_undo_pages.size(); i++)
+    {
+      u8* const shadow_page = &s_runahead_ram_shadow[mss.ram_undo_pages[i] * HOST_PAGE_SIZE];
+      std::memcpy(&mss.ram_undo_data[i * HOST_PAGE_SIZE], shadow_page, HOST_PAGE_SIZE);
+      std::memcpy(shadow_page, &Bus::g_ram[mss.ram_undo_pages[i] * HOST_PAGE_SIZE], HOST_PAGE_SIZE);
+    }
+  }
+
+  if (!SaveMemoryState(&mss, true))
   {
     Log_ErrorPrint("Failed to save runahead state.");
     return;
@@ -4004,9 +4791,31 @@ bool System::DoRunahead()
 
     // we need to replay and catch up - load the state,
     s_runahead_replay_pending = false;
-    if (s_runahead_states.empty() || !LoadMemoryState(s_runahead_states.front()))
+    if (s_runahead_states.empty())
+      return false;
+
+    // roll RAM back to the front state: the shadow holds the newest saved state's contents for
+    // anything the current (partial) frame wrote, and each state's undo buffer steps one frame
+    // further back. tracking is suspended so the copies don't fault.
+    std::vector<u32> dirty_pages;
+    Bus::GetAndClearSnapshotDirtyPages(&dirty_pages);
+    Bus::StopSnapshotDirtyTracking();
+    for (const u32 page : dirty_pages)
+      std::memcpy(&Bus::g_ram[page * HOST_PAGE_SIZE], &s_runahead_ram_shadow[page * HOST_PAGE_SIZE], HOST_PAGE_SIZE);
+    for (size_t i = s_runahead_states.size(); i > 1;)
+    {
+      const MemorySaveState& mss = s_runahead_states[--i];
+      for (size_t j = 0; j < mss.ram_undo_pages.size(); j++)
+      {
+        std::memcpy(&Bus::g_ram[mss.ram_undo_pages[j] * HOST_PAGE_SIZE], &mss.ram_undo_data[j * HOST_PAGE_SIZE],
+                    HOST_PAGE_SIZE);
+      }
+    }
+
+    if (!LoadMemoryState(s_runahead_states.front(), true))
     {
       s_runahead_states.clear();
+      s_runahead_ram_shadow.reset();
       return false;
     }
 
@@ -4016,6 +4825,10 @@ bool System::DoRunahead()
     // and throw away all the states, forcing us to catch up below
     s_runahead_states.clear();
 
+    // restart tracking from the rolled-back RAM contents
+    std::memcpy(s_runahead_ram_shadow.get(), Bus::g_ram, Bus::g_ram_size);
+    Bus::StartSnapshotDirtyTracking();
+
     // run the frames with no audio
     SPU::SetAudioOutputMuted(true);
 
@@ -4210,6 +5023,55 @@ void System::StopDumpingAudio()
   Host::AddOSDMessage(TRANSLATE_STR("OSDMessage", "Stopped dumping audio."), 5.0f);
 }
 
+bool System::IsCapturingVideo()
+{
+  return (g_gpu && g_gpu->IsVideoCaptureActive());
+}
+
+bool System::StartCapturingVideo(const char* filename /* = nullptr */)
+{
+  if (!System::IsValid())
+    return false;
+
+  std::string auto_filename;
+  if (!filename)
+  {
+    const auto& serial = System::GetGameSerial();
+    if (serial.empty())
+    {
+      auto_filename = Path::Combine(
+        EmuFolders::Dumps, fmt::format("video" FS_OSPATH_SEPARATOR_STR "{}.avi", GetTimestampStringForFileName()));
+    }
+    else
+    {
+      auto_filename = Path::Combine(EmuFolders::Dumps, fmt::format("video" FS_OSPATH_SEPARATOR_STR "{}_{}.avi", serial,
+                                                                   GetTimestampStringForFileName()));
+    }
+
+    filename = auto_filename.c_str();
+  }
+
+  if (g_gpu->StartVideoCapture(filename))
+  {
+    Host::AddFormattedOSDMessage(5.0f, TRANSLATE("OSDMessage", "Started capturing video to '%s'."), filename);
+    return true;
+  }
+  else
+  {
+    Host::AddFormattedOSDMessage(10.0f, TRANSLATE("OSDMessage", "Failed to start capturing video to '%s'."), filename);
+    return false;
+  }
+}
+
+void System::StopCapturingVideo()
+{
+  if (!IsCapturingVideo())
+    return;
+
+  g_gpu->StopVideoCapture();
+  Host::AddOSDMessage(TRANSLATE_STR("OSDMessage", "Stopped capturing video."), 5.0f);
+}
+
 bool System::SaveScreenshot(const char* filename /* = nullptr */, bool full_resolution /* = true */,
                             bool apply_aspect_ratio /* = true */, bool compress_on_thread /* = true */)
 {
@@ -4667,10 +5529,16 @@ void System::HostDisplayResized()
 
 bool System::PresentDisplay(bool allow_skip_present)
 {
+  PerformanceProfiler::Scope profiler_scope(PerformanceProfiler::Event::Present);
+
   const bool skip_present = allow_skip_present && g_gpu_device->ShouldSkipDisplayingFrame();
 
   Host::BeginPresentFrame();
 
+  // Kick any deferred display captures whose readback has become cheap.
+  if (g_gpu)
+    g_gpu->ProcessQueuedCaptures();
+
   // acquire for IO.MousePos.
   std::atomic_thread_fence(std::memory_order_acquire);
 
@@ -4690,18 +5558,53 @@ bool System::PresentDisplay(bool allow_skip_present)
 
   bool do_present;
   if (g_gpu && !skip_present)
+  {
     do_present = g_gpu->PresentDisplay();
+  }
   else
-    do_present = g_gpu_device->BeginPresent(skip_present);
+  {
+    // Present-on-change for the fullscreen UI: when the ImGui layer is all that's on screen and
+    // its draw data is identical to the last presented frame, skip re-recording and re-presenting
+    // entirely, so idle menus don't keep the GPU awake.
+    static u64 s_last_draw_data_hash = 0;
+    bool skip = skip_present;
+    if (!skip && !g_gpu)
+    {
+      const u64 hash = ImGuiManager::CalculateDrawDataHash();
+      skip = (hash == s_last_draw_data_hash);
+      s_last_draw_data_hash = hash;
+    }
+
+    do_present = g_gpu_device->BeginPresent(skip);
+  }
 
   if (do_present)
   {
     g_gpu_device->RenderImGui();
     g_gpu_device->EndPresent();
+    UpdateHostRefreshRateMeasurement();
+
+    // Each input event is only measured once, against the first present which could reflect it.
+    if (s_frame_input_timestamp != s_consumed_input_timestamp)
+    {
+      const float latency = static_cast<float>(
+        Common::Timer::ConvertValueToMilliseconds(Common::Timer::GetCurrentValue() - s_frame_input_timestamp));
+      s_minimum_input_latency_accumulator =
+        (s_input_latency_samples == 0) ? latency : std::min(s_minimum_input_latency_accumulator, latency);
+      s_input_latency_accumulator += latency;
+      s_maximum_input_latency_accumulator = std::max(s_maximum_input_latency_accumulator, latency);
+      s_input_latency_samples++;
+      s_consumed_input_timestamp = s_frame_input_timestamp;
+    }
 
     if (g_gpu_device->IsGPUTimingEnabled())
     {
       s_accumulated_gpu_time += g_gpu_device->GetAndResetAccumulatedGPUTime();
+      for (size_t i = 0; i < s_accumulated_stage_gpu_time.size(); i++)
+      {
+        s_accumulated_stage_gpu_time[i] +=
+          g_gpu_device->GetAndResetAccumulatedStageGPUTime(static_cast<GPUDevice::GPUTimingStage>(i));
+      }
       s_presents_since_last_update++;
     }
   }
@@ -4796,13 +5699,15 @@ void System::UpdateDiscordPresence()
   rp.largeImageText = "DuckStation PS1/PSX Emulator";
   rp.startTimestamp = std::time(nullptr);
   rp.details = "No Game Running";
+  std::string details_string;
   if (IsValidOrInitializing())
   {
     // Use disc set name if it's not a custom title.
     if (s_running_game_entry && !s_running_game_entry->disc_set_name.empty() &&
         s_running_game_title == s_running_game_entry->title)
     {
-      rp.details = s_running_game_entry->disc_set_name.c_str();
+      details_string = s_running_game_entry->disc_set_name;
+      rp.details = details_string.c_str();
     }
     else
     {
@@ -213,6 +213,18 @@ const BIOS::Hash& GetBIOSHash();
 static constexpr u32 NUM_FRAME_TIME_SAMPLES = 150;
 using FrameTimeHistory = std::array<float, NUM_FRAME_TIME_SAMPLES>;
 
+/// Stall attribution. The emulation loop tags which phase of the frame it is currently in, and
+/// frames exceeding the slow-frame threshold are attributed to the phase that dominated them.
+enum class FramePhase : u8
+{
+  CPUExecution,
+  FrameCompletion,
+  Present,
+  Throttle,
+  HostPoll,
+  Count
+};
+
 float GetFPS();
 float GetVPS();
 float GetEmulationSpeed();
@@ -226,6 +238,19 @@ float GetSWThreadUsage();
 float GetSWThreadAverageTime();
 float GetGPUUsage();
 float GetGPUAverageTime();
+float GetSleepOvershootTime();
+const char* GetFramePhaseName(FramePhase phase);
+u32 GetSlowFrameCount();
+u32 GetSlowFrameCountForPhase(FramePhase phase);
+
+/// Input-to-present latency over the last update period, measured from the host timestamp of the
+/// newest input event observed by a frame to the point that frame was submitted for presentation.
+float GetAverageInputLatency();
+float GetMinimumInputLatency();
+float GetMaximumInputLatency();
+
+/// Returns the average GPU time for a single timing stage (GPUDevice::GPUTimingStage).
+float GetGPUStageAverageTime(u32 stage);
 const FrameTimeHistory& GetFrameTimeHistory();
 u32 GetFrameTimeHistoryPos();
 
@@ -253,9 +278,17 @@ struct MemorySaveState
 {
   std::unique_ptr<GPUTexture> vram_texture;
   std::unique_ptr<GrowableMemoryByteStream> state_stream;
+
+  // id of the VRAM snapshot held in vram_texture, used by the hardware renderers to copy only
+  // the VRAM regions modified since the slot was last written; 0 means unknown/full copy
+  u64 vram_snapshot_id = 0;
+
+  // runahead-only: contents of the RAM pages this frame wrote, from before the frame ran
+  std::vector<u32> ram_undo_pages;
+  std::vector<u8> ram_undo_data;
 };
-bool SaveMemoryState(MemorySaveState* mss);
-bool LoadMemoryState(const MemorySaveState& mss);
+bool SaveMemoryState(MemorySaveState* mss, bool skip_ram = false);
+bool LoadMemoryState(const MemorySaveState& mss, bool skip_ram = false);
 bool LoadStateFromStream(ByteStream* stream, bool update_display, bool ignore_media = false);
 bool SaveStateToStream(ByteStream* state, u32 screenshot_size = 256, u32 compression_method = 0,
                        bool ignore_media = false);
@@ -415,6 +448,16 @@ bool StartDumpingAudio(const char* filename = nullptr);
 /// Stops dumping audio to file if it has been started.
 void StopDumpingAudio();
 
+/// Returns true if presented frames are currently being captured to a video file.
+bool IsCapturingVideo();
+
+/// Starts capturing presented frames to an MJPEG AVI file. If no file name is provided, one will be
+/// generated automatically. Audio is not muxed; dump it alongside with StartDumpingAudio().
+bool StartCapturingVideo(const char* filename = nullptr);
+
+/// Stops capturing video to file if it has been started.
+void StopCapturingVideo();
+
 /// Saves a screenshot to the specified file. IF no file name is provided, one will be generated automatically.
 bool SaveScreenshot(const char* filename = nullptr, bool full_resolution = true, bool apply_aspect_ratio = true,
                     bool compress_on_thread = true);
@@ -469,6 +512,10 @@ void HostDisplayResized();
 bool PresentDisplay(bool allow_skip_present);
 void InvalidateDisplay();
 
+/// Returns true if the frame currently being generated will not be presented, in which case the
+/// display update can be elided entirely.
+bool WillSkipPresentingCurrentFrame();
+
 //////////////////////////////////////////////////////////////////////////
 // Memory Save States (Rewind and Runahead)
 //////////////////////////////////////////////////////////////////////////
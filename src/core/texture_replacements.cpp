@@ -6,9 +6,11 @@
 #include "settings.h"
 
 #include "common/bitutils.h"
+#include "common/byte_stream.h"
 #include "common/file_system.h"
 #include "common/log.h"
 #include "common/path.h"
+#include "common/pixel_convert.h"
 #include "common/string_util.h"
 #include "common/timer.h"
 
@@ -18,27 +20,24 @@
 #include "xxh_x86dispatch.h"
 #endif
 
+#include <atomic>
+#include <chrono>
 #include <cinttypes>
 
 Log_SetChannel(TextureReplacements);
 
 TextureReplacements g_texture_replacements;
 
-static constexpr u32 VRAMRGBA5551ToRGBA8888(u16 color)
-{
-  u8 r = Truncate8(color & 31);
-  u8 g = Truncate8((color >> 5) & 31);
-  u8 b = Truncate8((color >> 10) & 31);
-  u8 a = Truncate8((color >> 15) & 1);
-
-  // 00012345 -> 1234545
-  b = (b << 3) | (b & 0b111);
-  g = (g << 3) | (g & 0b111);
-  r = (r << 3) | (r & 0b111);
-  a = a ? 255 : 0;
-
-  return ZeroExtend32(r) | (ZeroExtend32(g) << 8) | (ZeroExtend32(b) << 16) | (ZeroExtend32(a) << 24);
-}
+// Single-file texture pack: header, then an index of hash/name/offset records, then
+// zstd-compressed blobs of the original image files. Lookup is one index probe and one
+// sequential read instead of thousands of per-file opens.
+static constexpr u32 TEXTURE_PACK_SIGNATURE = 0x50545344; // DSTP
+static constexpr u32 TEXTURE_PACK_VERSION = 1;
+static constexpr int TEXTURE_PACK_COMPRESSION_LEVEL = 6;
+
+// Upper bound on raw VRAM writes waiting for the dumper thread, so a burst (e.g. an FMV) can't
+// balloon memory while the PNG encoder catches up.
+static constexpr size_t MAX_QUEUED_VRAM_WRITE_DUMPS = 32;
 
 std::string TextureReplacementHash::ToString() const
 {
@@ -75,56 +74,233 @@ void TextureReplacements::SetGameID(std::string game_id)
 
 const TextureReplacementTexture* TextureReplacements::GetVRAMWriteReplacement(u32 width, u32 height, const void* pixels)
 {
+  // don't pay for hashing when the game has no replacements at all
+  if (m_vram_write_replacements.empty())
+    return nullptr;
+
+  // the hash covers the write's dimensions (different size means different input length), so a
+  // write whose size appears nowhere in the index can never match - reject it before hashing
+  if (m_replacement_dimensions_valid &&
+      m_replacement_dimensions.find((ZeroExtend64(width) << 32) | ZeroExtend64(height)) ==
+        m_replacement_dimensions.end())
+  {
+    return nullptr;
+  }
+
   const TextureReplacementHash hash = GetVRAMWriteHash(width, height, pixels);
 
   const auto it = m_vram_write_replacements.find(hash);
   if (it == m_vram_write_replacements.end())
     return nullptr;
 
-  return LoadTexture(it->second);
+  // With preloading enabled everything is resident, so hand the texture straight over. Otherwise
+  // stream it: if the decode hasn't finished yet, queue it and let this write through unreplaced -
+  // games re-upload their textures constantly, so the next write of the same data picks it up,
+  // and the GPU thread never stalls on disk or PNG decode.
+  if (g_settings.texture_replacements.preload_textures)
+    return LoadTexture(it->second);
+
+  {
+    std::unique_lock lock(m_texture_cache_mutex);
+    const auto cache_it = m_texture_cache.find(it->second);
+    if (cache_it != m_texture_cache.end())
+      return cache_it->second.IsValid() ? &cache_it->second : nullptr;
+  }
+
+  QueueTextureLoad(it->second);
+  return nullptr;
 }
 
 void TextureReplacements::DumpVRAMWrite(u32 width, u32 height, const void* pixels)
 {
-  std::string filename = GetVRAMWriteDumpFilename(width, height, pixels);
-  if (filename.empty())
+  if (m_game_id.empty())
     return;
 
-  Common::RGBA8Image image;
-  image.SetSize(width, height);
+  const TextureReplacementHash hash = GetVRAMWriteHash(width, height, pixels);
 
-  const u16* src_pixels = reinterpret_cast<const u16*>(pixels);
+  std::unique_lock lock(m_dumper_mutex);
 
-  for (u32 y = 0; y < height; y++)
+  // Deduplicating here means repeated uploads of the same data only ever pay for the hash;
+  // writes that made it to disk in previous sessions get filtered by the dumper thread instead.
+  if (!m_dumped_hashes.insert(hash).second)
+    return;
+
+  if (m_dumper_queue.size() >= MAX_QUEUED_VRAM_WRITE_DUMPS)
   {
-    for (u32 x = 0; x < width; x++)
-    {
-      image.SetPixel(x, y, VRAMRGBA5551ToRGBA8888(*src_pixels));
-      src_pixels++;
-    }
+    // drop the oldest entry, and forget its hash so the next upload of that data gets dumped
+    Log_DevPrintf("VRAM write dump queue is full, dropping oldest entry");
+    m_dumped_hashes.erase(m_dumper_queue.front().hash);
+    m_dumper_queue.pop_front();
   }
 
-  if (g_settings.texture_replacements.dump_vram_write_force_alpha_channel)
+  VRAMWriteDump dump;
+  dump.hash = hash;
+  dump.width = width;
+  dump.height = height;
+  const u16* src_pixels = static_cast<const u16*>(pixels);
+  dump.pixels.assign(src_pixels, src_pixels + (width * height));
+  m_dumper_queue.push_back(std::move(dump));
+
+  if (!m_dumper_thread.joinable())
   {
-    for (u32 y = 0; y < height; y++)
-    {
-      for (u32 x = 0; x < width; x++)
-        image.SetPixel(x, y, image.GetPixel(x, y) | 0xFF000000u);
-    }
+    m_dumper_shutdown = false;
+    m_dumper_thread = std::thread(&TextureReplacements::DumperThreadEntryPoint, this);
   }
 
-  Log_InfoPrintf("Dumping %ux%u VRAM write to '%s'", width, height, filename.c_str());
-  if (!image.SaveToFile(filename.c_str()))
-    Log_ErrorPrintf("Failed to dump %ux%u VRAM write to '%s'", width, height, filename.c_str());
+  m_dumper_wake_cv.notify_one();
 }
 
 void TextureReplacements::Shutdown()
 {
+  StopLoaderThread();
+  StopDumperThread();
+
+  m_dumped_hashes.clear();
   m_texture_cache.clear();
   m_vram_write_replacements.clear();
+  m_pack_entries.clear();
+  m_pack_stream.reset();
   m_game_id.clear();
 }
 
+void TextureReplacements::QueueTextureLoad(std::string filename)
+{
+  std::unique_lock lock(m_loader_mutex);
+  if (!m_loader_queued.insert(filename).second)
+    return;
+
+  m_loader_queue.push_back(std::move(filename));
+
+  if (!m_loader_thread.joinable())
+  {
+    m_loader_shutdown = false;
+    m_loader_thread = std::thread(&TextureReplacements::LoaderThreadEntryPoint, this);
+  }
+
+  m_loader_wake_cv.notify_one();
+}
+
+void TextureReplacements::StopLoaderThread()
+{
+  {
+    std::unique_lock lock(m_loader_mutex);
+    if (!m_loader_thread.joinable())
+      return;
+
+    m_loader_shutdown = true;
+    m_loader_queue.clear();
+    m_loader_queued.clear();
+    m_loader_wake_cv.notify_one();
+  }
+
+  m_loader_thread.join();
+}
+
+void TextureReplacements::LoaderThreadEntryPoint()
+{
+  std::unique_lock lock(m_loader_mutex);
+  for (;;)
+  {
+    if (m_loader_queue.empty())
+    {
+      if (m_loader_shutdown)
+        break;
+
+      m_loader_wake_cv.wait(lock);
+      continue;
+    }
+
+    std::string filename = std::move(m_loader_queue.front());
+    m_loader_queue.pop_front();
+    lock.unlock();
+
+    // Failed decodes get cached as empty images, so a bad file doesn't get requeued every time
+    // the same VRAM write comes around.
+    Common::RGBA8Image image;
+    if (!ReadReplacementImage(filename, &image))
+      Log_ErrorPrintf("Failed to load '%s'", filename.c_str());
+    else
+      Log_DevPrintf("Loaded '%s': %ux%u", filename.c_str(), image.GetWidth(), image.GetHeight());
+
+    {
+      std::unique_lock cache_lock(m_texture_cache_mutex);
+      m_texture_cache[filename] = std::move(image);
+    }
+
+    lock.lock();
+  }
+}
+
+void TextureReplacements::StopDumperThread()
+{
+  {
+    std::unique_lock lock(m_dumper_mutex);
+    if (!m_dumper_thread.joinable())
+      return;
+
+    // unlike the loader, the queue is left intact so pending dumps still make it to disk
+    m_dumper_shutdown = true;
+    m_dumper_wake_cv.notify_one();
+  }
+
+  m_dumper_thread.join();
+}
+
+void TextureReplacements::DumperThreadEntryPoint()
+{
+  std::unique_lock lock(m_dumper_mutex);
+  for (;;)
+  {
+    if (m_dumper_queue.empty())
+    {
+      if (m_dumper_shutdown)
+        break;
+
+      m_dumper_wake_cv.wait(lock);
+      continue;
+    }
+
+    VRAMWriteDump dump = std::move(m_dumper_queue.front());
+    m_dumper_queue.pop_front();
+    lock.unlock();
+
+    WriteVRAMWriteDump(dump);
+
+    lock.lock();
+  }
+}
+
+void TextureReplacements::WriteVRAMWriteDump(const VRAMWriteDump& dump)
+{
+  std::string filename = GetVRAMWriteDumpFilename(dump.hash, dump.width, dump.height);
+  if (filename.empty())
+    return;
+
+  Common::RGBA8Image image;
+  image.SetSize(dump.width, dump.height);
+
+  const u16* src_pixels = dump.pixels.data();
+
+  for (u32 y = 0; y < dump.height; y++)
+  {
+    PixelConvert::VRAM5551RowToRGBA8888<false>(&image.GetPixels()[y * dump.width], src_pixels, dump.width);
+    src_pixels += dump.width;
+  }
+
+  if (g_settings.texture_replacements.dump_vram_write_force_alpha_channel)
+  {
+    for (u32 y = 0; y < dump.height; y++)
+    {
+      for (u32 x = 0; x < dump.width; x++)
+        image.SetPixel(x, y, image.GetPixel(x, y) | 0xFF000000u);
+    }
+  }
+
+  Log_InfoPrintf("Dumping %ux%u VRAM write to '%s'", dump.width, dump.height, filename.c_str());
+  if (!image.SaveToFile(filename.c_str()))
+    Log_ErrorPrintf("Failed to dump %ux%u VRAM write to '%s'", dump.width, dump.height, filename.c_str());
+}
+
 std::string TextureReplacements::GetSourceDirectory() const
 {
   return Path::Combine(EmuFolders::Textures, m_game_id);
@@ -135,24 +311,37 @@ std::string TextureReplacements::GetDumpDirectory() const
   return Path::Combine(EmuFolders::Dumps, Path::Combine("textures", m_game_id));
 }
 
+std::string TextureReplacements::GetPackFilename() const
+{
+  return Path::Combine(EmuFolders::Textures, fmt::format("{}.texpack", m_game_id));
+}
+
 TextureReplacementHash TextureReplacements::GetVRAMWriteHash(u32 width, u32 height, const void* pixels) const
 {
   XXH128_hash_t hash = XXH3_128bits(pixels, width * height * sizeof(u16));
   return {hash.low64, hash.high64};
 }
 
-std::string TextureReplacements::GetVRAMWriteDumpFilename(u32 width, u32 height, const void* pixels) const
+std::string TextureReplacements::GetVRAMWriteDumpFilename(const TextureReplacementHash& hash, u32 width,
+                                                          u32 height) const
 {
   if (m_game_id.empty())
     return {};
 
-  const TextureReplacementHash hash = GetVRAMWriteHash(width, height, pixels);
+  // the dimensions in the name feed the lookup prefilter when the dump is used as a replacement
   const std::string dump_directory(GetDumpDirectory());
-  std::string filename(Path::Combine(dump_directory, fmt::format("vram-write-{}.png", hash.ToString())));
+  std::string filename(
+    Path::Combine(dump_directory, fmt::format("vram-write-{}x{}-{}.png", width, height, hash.ToString())));
 
   if (FileSystem::FileExists(filename.c_str()))
     return {};
 
+  // don't re-dump writes that already exist under the old dimension-less name
+  const std::string legacy_filename(
+    Path::Combine(dump_directory, fmt::format("vram-write-{}.png", hash.ToString())));
+  if (FileSystem::FileExists(legacy_filename.c_str()))
+    return {};
+
   if (!FileSystem::EnsureDirectoryExists(dump_directory.c_str(), false))
     return {};
 
@@ -161,10 +350,25 @@ std::string TextureReplacements::GetVRAMWriteDumpFilename(u32 width, u32 height,
 
 void TextureReplacements::Reload()
 {
+  StopLoaderThread();
+
+  // drains any pending dumps; the dumper thread reads m_game_id, so it can't run across a change.
+  // already-written files are skipped by the filename check, so clearing the session set is safe.
+  StopDumperThread();
+  m_dumped_hashes.clear();
+
   m_vram_write_replacements.clear();
+  m_replacement_dimensions.clear();
+  m_replacement_dimensions_valid = true;
+  m_pack_entries.clear();
+  m_pack_stream.reset();
 
   if (g_settings.texture_replacements.AnyReplacementsEnabled())
+  {
+    // loose files are scanned first, so they take priority over pack contents
     FindTextures(GetSourceDirectory());
+    LoadPackIndex();
+  }
 
   if (g_settings.texture_replacements.preload_textures)
     PreloadTextures();
@@ -174,6 +378,7 @@ void TextureReplacements::Reload()
 
 void TextureReplacements::PurgeUnreferencedTexturesFromCache()
 {
+  std::unique_lock lock(m_texture_cache_mutex);
   TextureCache old_map = std::move(m_texture_cache);
   for (const auto& it : m_vram_write_replacements)
   {
@@ -188,7 +393,8 @@ void TextureReplacements::PurgeUnreferencedTexturesFromCache()
 
 bool TextureReplacements::ParseReplacementFilename(const std::string& filename,
                                                    TextureReplacementHash* replacement_hash,
-                                                   ReplacmentType* replacement_type)
+                                                   ReplacmentType* replacement_type, u32* replacement_width,
+                                                   u32* replacement_height)
 {
   const char* extension = std::strrchr(filename.c_str(), '.');
   const char* title = std::strrchr(filename.c_str(), '/');
@@ -198,10 +404,11 @@ bool TextureReplacements::ParseReplacementFilename(const std::string& filename,
     title = title2;
 #endif
 
-  if (!title || !extension)
+  if (!extension)
     return false;
 
-  title++;
+  // pack entry names are stored without a path
+  title = title ? (title + 1) : filename.c_str();
 
   const char* hashpart;
 
@@ -215,7 +422,29 @@ bool TextureReplacements::ParseReplacementFilename(const std::string& filename,
     return false;
   }
 
-  if (!replacement_hash->ParseString(std::string_view(hashpart, static_cast<size_t>(extension - hashpart))))
+  // new-style dumps prefix the hash with the source write's dimensions, e.g. vram-write-320x240-<hash>.
+  // old dimension-less names still load, they just can't feed the lookup prefilter.
+  std::string_view hashview(hashpart, static_cast<size_t>(extension - hashpart));
+  *replacement_width = 0;
+  *replacement_height = 0;
+  if (hashview.length() > 32)
+  {
+    const size_t sep = hashview.find('-');
+    const size_t xpos = hashview.find('x');
+    if (sep == std::string_view::npos || xpos == std::string_view::npos || xpos > sep)
+      return false;
+
+    const std::optional<u32> width = StringUtil::FromChars<u32>(hashview.substr(0, xpos));
+    const std::optional<u32> height = StringUtil::FromChars<u32>(hashview.substr(xpos + 1, sep - xpos - 1));
+    if (!width.has_value() || width.value() == 0 || !height.has_value() || height.value() == 0)
+      return false;
+
+    *replacement_width = width.value();
+    *replacement_height = height.value();
+    hashview = hashview.substr(sep + 1);
+  }
+
+  if (!replacement_hash->ParseString(hashview))
     return false;
 
   extension++;
@@ -236,7 +465,8 @@ bool TextureReplacements::ParseReplacementFilename(const std::string& filename,
 void TextureReplacements::FindTextures(const std::string& dir)
 {
   FileSystem::FindResultsArray files;
-  FileSystem::FindFiles(dir.c_str(), "*", FILESYSTEM_FIND_FILES | FILESYSTEM_FIND_RECURSIVE, &files);
+  FileSystem::FindFiles(dir.c_str(), "*", FILESYSTEM_FIND_FILES | FILESYSTEM_FIND_RECURSIVE | FILESYSTEM_FIND_PARALLEL,
+                        &files);
 
   for (FILESYSTEM_FIND_DATA& fd : files)
   {
@@ -245,7 +475,8 @@ void TextureReplacements::FindTextures(const std::string& dir)
 
     TextureReplacementHash hash;
     ReplacmentType type;
-    if (!ParseReplacementFilename(fd.FileName, &hash, &type))
+    u32 write_width, write_height;
+    if (!ParseReplacementFilename(fd.FileName, &hash, &type, &write_width, &write_height))
       continue;
 
     switch (type)
@@ -259,6 +490,11 @@ void TextureReplacements::FindTextures(const std::string& dir)
           continue;
         }
 
+        if (write_width > 0 && write_height > 0)
+          m_replacement_dimensions.insert((ZeroExtend64(write_width) << 32) | ZeroExtend64(write_height));
+        else
+          m_replacement_dimensions_valid = false;
+
         m_vram_write_replacements.emplace(hash, std::move(fd.FileName));
       }
       break;
@@ -268,21 +504,223 @@ void TextureReplacements::FindTextures(const std::string& dir)
   Log_InfoPrintf("Found %zu replacement VRAM writes for '%s'", m_vram_write_replacements.size(), m_game_id.c_str());
 }
 
+void TextureReplacements::LoadPackIndex()
+{
+  const std::string pack_filename = GetPackFilename();
+  std::unique_ptr<ByteStream> stream =
+    ByteStream::OpenFile(pack_filename.c_str(), BYTESTREAM_OPEN_READ | BYTESTREAM_OPEN_SEEKABLE);
+  if (!stream)
+    return;
+
+  u32 signature, version, num_entries;
+  if (!stream->ReadU32(&signature) || !stream->ReadU32(&version) || !stream->ReadU32(&num_entries) ||
+      signature != TEXTURE_PACK_SIGNATURE || version != TEXTURE_PACK_VERSION)
+  {
+    Log_ErrorPrintf("Pack file '%s' is corrupted or has an unsupported version", pack_filename.c_str());
+    return;
+  }
+
+  u32 num_loaded = 0;
+  for (u32 i = 0; i < num_entries; i++)
+  {
+    TextureReplacementHash hash;
+    u8 type;
+    std::string name;
+    PackEntry entry;
+    if (!stream->ReadU64(&hash.low) || !stream->ReadU64(&hash.high) || !stream->ReadU8(&type) ||
+        !stream->ReadSizePrefixedString(&name) || !stream->ReadU64(&entry.data_offset) ||
+        !stream->ReadU32(&entry.compressed_size) || !stream->ReadU32(&entry.uncompressed_size) ||
+        type != static_cast<u8>(ReplacmentType::VRAMWrite))
+    {
+      Log_ErrorPrintf("Pack file '%s' has a corrupted index", pack_filename.c_str());
+      m_pack_entries.clear();
+      return;
+    }
+
+    // loose files were indexed first and win over the pack
+    if (m_vram_write_replacements.find(hash) != m_vram_write_replacements.end())
+      continue;
+
+    // entry names round-trip the dump filename, so the prefilter dimensions come back out of them
+    TextureReplacementHash name_hash;
+    ReplacmentType name_type;
+    u32 write_width, write_height;
+    if (ParseReplacementFilename(name, &name_hash, &name_type, &write_width, &write_height) && write_width > 0 &&
+        write_height > 0)
+    {
+      m_replacement_dimensions.insert((ZeroExtend64(write_width) << 32) | ZeroExtend64(write_height));
+    }
+    else
+    {
+      m_replacement_dimensions_valid = false;
+    }
+
+    m_pack_entries.emplace(name, entry);
+    m_vram_write_replacements.emplace(hash, std::move(name));
+    num_loaded++;
+  }
+
+  m_pack_stream = std::move(stream);
+  Log_InfoPrintf("Loaded %u of %u entries from pack '%s'", num_loaded, num_entries, pack_filename.c_str());
+}
+
+bool TextureReplacements::ReadReplacementImage(const std::string& filename, TextureReplacementTexture* image)
+{
+  const auto pack_it = m_pack_entries.find(filename);
+  if (pack_it == m_pack_entries.end())
+    return image->LoadFromFile(filename.c_str());
+
+  const PackEntry& entry = pack_it->second;
+  std::vector<u8> buffer(entry.uncompressed_size);
+  {
+    std::unique_lock lock(m_pack_mutex);
+    if (!m_pack_stream || !m_pack_stream->SeekAbsolute(entry.data_offset))
+      return false;
+
+    const std::unique_ptr<ByteStream> dstream =
+      ByteStream::CreateZstdDecompressStream(m_pack_stream.get(), entry.compressed_size);
+    if (!dstream->Read2(buffer.data(), entry.uncompressed_size))
+    {
+      Log_ErrorPrintf("Failed to decompress '%s' from pack", filename.c_str());
+      return false;
+    }
+  }
+
+  return image->LoadFromBuffer(filename.c_str(), buffer.data(), buffer.size());
+}
+
+bool TextureReplacements::CompilePackFile()
+{
+  if (m_game_id.empty())
+    return false;
+
+  struct PendingEntry
+  {
+    TextureReplacementHash hash;
+    ReplacmentType type;
+    std::string path;
+    std::string name;
+  };
+
+  std::vector<PendingEntry> pending;
+  {
+    FileSystem::FindResultsArray files;
+    FileSystem::FindFiles(GetSourceDirectory().c_str(), "*",
+                          FILESYSTEM_FIND_FILES | FILESYSTEM_FIND_RECURSIVE | FILESYSTEM_FIND_PARALLEL, &files);
+    for (FILESYSTEM_FIND_DATA& fd : files)
+    {
+      TextureReplacementHash hash;
+      ReplacmentType type;
+      u32 write_width, write_height;
+      if ((fd.Attributes & FILESYSTEM_FILE_ATTRIBUTE_DIRECTORY) ||
+          !ParseReplacementFilename(fd.FileName, &hash, &type, &write_width, &write_height))
+      {
+        continue;
+      }
+
+      std::string name(Path::GetFileName(fd.FileName));
+      pending.push_back({hash, type, std::move(fd.FileName), std::move(name)});
+    }
+  }
+
+  if (pending.empty())
+  {
+    Log_ErrorPrintf("No loose replacement files found for '%s'", m_game_id.c_str());
+    return false;
+  }
+
+  const std::string pack_filename = GetPackFilename();
+  std::unique_ptr<ByteStream> stream =
+    ByteStream::OpenFile(pack_filename.c_str(), BYTESTREAM_OPEN_CREATE | BYTESTREAM_OPEN_TRUNCATE |
+                                                  BYTESTREAM_OPEN_WRITE | BYTESTREAM_OPEN_SEEKABLE |
+                                                  BYTESTREAM_OPEN_ATOMIC_UPDATE);
+  if (!stream)
+  {
+    Log_ErrorPrintf("Failed to open '%s' for writing", pack_filename.c_str());
+    return false;
+  }
+
+  // the index is written twice: once to reserve its space, and again with real offsets once the
+  // blobs have been laid down behind it
+  std::vector<PackEntry> entries(pending.size());
+  const auto write_index = [&stream, &pending, &entries]() {
+    bool result = stream->WriteU32(TEXTURE_PACK_SIGNATURE) && stream->WriteU32(TEXTURE_PACK_VERSION) &&
+                  stream->WriteU32(static_cast<u32>(pending.size()));
+    for (size_t i = 0; i < pending.size(); i++)
+    {
+      result = result && stream->WriteU64(pending[i].hash.low) && stream->WriteU64(pending[i].hash.high) &&
+               stream->WriteU8(static_cast<u8>(pending[i].type)) && stream->WriteSizePrefixedString(pending[i].name) &&
+               stream->WriteU64(entries[i].data_offset) && stream->WriteU32(entries[i].compressed_size) &&
+               stream->WriteU32(entries[i].uncompressed_size);
+    }
+    return result;
+  };
+
+  if (!write_index())
+  {
+    stream->Discard();
+    return false;
+  }
+
+  for (size_t i = 0; i < pending.size(); i++)
+  {
+    const std::optional<std::vector<u8>> data = FileSystem::ReadBinaryFile(pending[i].path.c_str());
+    if (!data.has_value())
+    {
+      Log_ErrorPrintf("Failed to read '%s'", pending[i].path.c_str());
+      stream->Discard();
+      return false;
+    }
+
+    entries[i].data_offset = stream->GetPosition();
+    entries[i].uncompressed_size = static_cast<u32>(data->size());
+
+    {
+      const std::unique_ptr<ByteStream> cstream =
+        ByteStream::CreateZstdCompressStream(stream.get(), TEXTURE_PACK_COMPRESSION_LEVEL);
+      if (!cstream->Write2(data->data(), static_cast<u32>(data->size())))
+      {
+        Log_ErrorPrintf("Failed to compress '%s' into pack", pending[i].path.c_str());
+        stream->Discard();
+        return false;
+      }
+
+      // destruction flushes the frame to the underlying stream
+    }
+
+    entries[i].compressed_size = static_cast<u32>(stream->GetPosition() - entries[i].data_offset);
+  }
+
+  if (!stream->SeekAbsolute(0) || !write_index() || !stream->Commit())
+  {
+    stream->Discard();
+    return false;
+  }
+
+  Log_InfoPrintf("Compiled %zu replacements into '%s'", pending.size(), pack_filename.c_str());
+  return true;
+}
+
 const TextureReplacementTexture* TextureReplacements::LoadTexture(const std::string& filename)
 {
-  auto it = m_texture_cache.find(filename);
-  if (it != m_texture_cache.end())
-    return &it->second;
+  {
+    std::unique_lock lock(m_texture_cache_mutex);
+    auto it = m_texture_cache.find(filename);
+    if (it != m_texture_cache.end())
+      return it->second.IsValid() ? &it->second : nullptr;
+  }
 
   Common::RGBA8Image image;
-  if (!image.LoadFromFile(filename.c_str()))
+  if (!ReadReplacementImage(filename, &image))
   {
     Log_ErrorPrintf("Failed to load '%s'", filename.c_str());
     return nullptr;
   }
 
   Log_InfoPrintf("Loaded '%s': %ux%u", filename.c_str(), image.GetWidth(), image.GetHeight());
-  it = m_texture_cache.emplace(filename, std::move(image)).first;
+
+  std::unique_lock lock(m_texture_cache_mutex);
+  const auto it = m_texture_cache.emplace(filename, std::move(image)).first;
   return &it->second;
 }
 
@@ -290,25 +728,49 @@ void TextureReplacements::PreloadTextures()
 {
   static constexpr float UPDATE_INTERVAL = 1.0f;
 
-  Common::Timer last_update_time;
-  u32 num_textures_loaded = 0;
   const u32 total_textures = static_cast<u32>(m_vram_write_replacements.size());
+  if (total_textures == 0)
+    return;
 
-#define UPDATE_PROGRESS()                                                                                              \
-  if (last_update_time.GetTimeSeconds() >= UPDATE_INTERVAL)                                                            \
-  {                                                                                                                    \
-    Host::DisplayLoadingScreen("Preloading replacement textures...", 0, static_cast<int>(total_textures),              \
-                               static_cast<int>(num_textures_loaded));                                                 \
-    last_update_time.Reset();                                                                                          \
+  // the time here is all PNG decode, so fan it out over a pool of workers
+  std::vector<const std::string*> filenames;
+  filenames.reserve(total_textures);
+  for (const auto& it : m_vram_write_replacements)
+    filenames.push_back(&it.second);
+
+  const u32 num_threads = std::min(std::max(std::thread::hardware_concurrency(), 1u), total_textures);
+  std::atomic<u32> next_texture{0};
+  std::atomic<u32> num_textures_loaded{0};
+  std::vector<std::thread> workers;
+  workers.reserve(num_threads);
+  for (u32 i = 0; i < num_threads; i++)
+  {
+    workers.emplace_back([this, &filenames, &next_texture, &num_textures_loaded]() {
+      for (;;)
+      {
+        const u32 index = next_texture.fetch_add(1, std::memory_order_acq_rel);
+        if (index >= static_cast<u32>(filenames.size()))
+          break;
+
+        LoadTexture(*filenames[index]);
+        num_textures_loaded.fetch_add(1, std::memory_order_acq_rel);
+      }
+    });
   }
 
-  for (const auto& it : m_vram_write_replacements)
+  Common::Timer last_update_time;
+  while (num_textures_loaded.load(std::memory_order_acquire) < total_textures)
   {
-    UPDATE_PROGRESS();
+    if (last_update_time.GetTimeSeconds() >= UPDATE_INTERVAL)
+    {
+      Host::DisplayLoadingScreen("Preloading replacement textures...", 0, static_cast<int>(total_textures),
+                                 static_cast<int>(num_textures_loaded.load(std::memory_order_acquire)));
+      last_update_time.Reset();
+    }
 
-    LoadTexture(it.second);
-    num_textures_loaded++;
+    std::this_thread::sleep_for(std::chrono::milliseconds(25));
   }
 
-#undef UPDATE_PROGRESS
+  for (std::thread& thread : workers)
+    thread.join();
 }
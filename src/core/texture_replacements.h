@@ -5,9 +5,15 @@
 #include "common/hash_combine.h"
 #include "common/image.h"
 #include "types.h"
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 struct TextureReplacementHash
@@ -36,6 +42,8 @@ struct hash<TextureReplacementHash>
 };
 } // namespace std
 
+class ByteStream;
+
 using TextureReplacementTexture = Common::RGBA8Image;
 
 class TextureReplacements
@@ -54,6 +62,10 @@ public:
 
   void Reload();
 
+  /// Bundles the loose replacement files for the current game into a single pack file, which is
+  /// preferred over per-file scanning on subsequent loads.
+  bool CompilePackFile();
+
   const TextureReplacementTexture* GetVRAMWriteReplacement(u32 width, u32 height, const void* pixels);
   void DumpVRAMWrite(u32 width, u32 height, const void* pixels);
 
@@ -68,26 +80,84 @@ private:
   using VRAMWriteReplacementMap = std::unordered_map<TextureReplacementHash, std::string>;
   using TextureCache = std::unordered_map<std::string, TextureReplacementTexture>;
 
+  struct PackEntry
+  {
+    u64 data_offset;
+    u32 compressed_size;
+    u32 uncompressed_size;
+  };
+  using PackEntryMap = std::unordered_map<std::string, PackEntry>;
+
+  struct VRAMWriteDump
+  {
+    TextureReplacementHash hash;
+    u32 width;
+    u32 height;
+    std::vector<u16> pixels;
+  };
+
   static bool ParseReplacementFilename(const std::string& filename, TextureReplacementHash* replacement_hash,
-                                       ReplacmentType* replacement_type);
+                                       ReplacmentType* replacement_type, u32* replacement_width,
+                                       u32* replacement_height);
 
   std::string GetSourceDirectory() const;
   std::string GetDumpDirectory() const;
 
   TextureReplacementHash GetVRAMWriteHash(u32 width, u32 height, const void* pixels) const;
-  std::string GetVRAMWriteDumpFilename(u32 width, u32 height, const void* pixels) const;
+  std::string GetVRAMWriteDumpFilename(const TextureReplacementHash& hash, u32 width, u32 height) const;
 
   void FindTextures(const std::string& dir);
 
+  std::string GetPackFilename() const;
+  void LoadPackIndex();
+  bool ReadReplacementImage(const std::string& filename, TextureReplacementTexture* image);
+
   const TextureReplacementTexture* LoadTexture(const std::string& filename);
   void PreloadTextures();
   void PurgeUnreferencedTexturesFromCache();
 
+  void QueueTextureLoad(std::string filename);
+  void StopLoaderThread();
+  void LoaderThreadEntryPoint();
+
+  void StopDumperThread();
+  void DumperThreadEntryPoint();
+  void WriteVRAMWriteDump(const VRAMWriteDump& dump);
+
   std::string m_game_id;
 
+  // written by the loader thread in streaming mode, so all access goes through the lock
+  std::mutex m_texture_cache_mutex;
   TextureCache m_texture_cache;
 
   VRAMWriteReplacementMap m_vram_write_replacements;
+
+  // source write dimensions for everything in the index, used to reject writes without hashing
+  // them. old-style dimension-less filenames disable the prefilter for the whole index.
+  std::unordered_set<u64> m_replacement_dimensions;
+  bool m_replacement_dimensions_valid = true;
+
+  // single-file replacement pack, read by both the CPU thread and the loader thread
+  std::mutex m_pack_mutex;
+  std::unique_ptr<ByteStream> m_pack_stream;
+  PackEntryMap m_pack_entries;
+
+  // background decoder for streaming mode, started on the first queued load
+  std::thread m_loader_thread;
+  std::mutex m_loader_mutex;
+  std::condition_variable m_loader_wake_cv;
+  std::deque<std::string> m_loader_queue;
+  std::unordered_set<std::string> m_loader_queued;
+  bool m_loader_shutdown = false;
+
+  // background PNG writer for dump mode, started on the first queued dump; the emulation thread
+  // only pays for the hash and a pixel copy
+  std::thread m_dumper_thread;
+  std::mutex m_dumper_mutex;
+  std::condition_variable m_dumper_wake_cv;
+  std::deque<VRAMWriteDump> m_dumper_queue;
+  std::unordered_set<TextureReplacementHash> m_dumped_hashes;
+  bool m_dumper_shutdown = false;
 };
 
 extern TextureReplacements g_texture_replacements;
\ No newline at end of file
@@ -25,6 +25,12 @@ namespace {
 
 static constexpr u32 NUM_TIMERS = 3;
 
+// Scheduling interval when no sysclk-driven timer has an IRQ edge armed. Counters run in
+// arrears and are materialized on register access via InvokeEarly(), so the event only has
+// to fire often enough to keep the accumulated tick counts well away from overflow, even
+// with heavy underclocks.
+static constexpr TickCount LAZY_SYSCLK_TICKS = 1 << 27;
+
 enum class SyncMode : u8
 {
   PauseOnGate = 0,
@@ -437,7 +443,7 @@ void Timers::UpdateIRQ(u32 index)
 
 TickCount Timers::GetTicksUntilNextInterrupt()
 {
-  TickCount min_ticks = System::GetMaxSliceTicks();
+  TickCount min_ticks = std::numeric_limits<TickCount>::max();
   for (u32 i = 0; i < NUM_TIMERS; i++)
   {
     const CounterState& cs = s_states[i];
@@ -466,6 +472,10 @@ TickCount Timers::GetTicksUntilNextInterrupt()
     }
   }
 
+  // Nothing armed - only tick the counters to stop them falling too far behind.
+  if (min_ticks == std::numeric_limits<TickCount>::max())
+    return LAZY_SYSCLK_TICKS;
+
   return System::ScaleTicksToOverclock(std::max<TickCount>(1, min_ticks));
 }
 
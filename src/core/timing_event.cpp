@@ -12,8 +12,13 @@ Log_SetChannel(TimingEvents);
 
 namespace TimingEvents {
 
+// Active events, as a binary min-heap keyed on downcount. The flat array keeps the per-tick
+// downcount walk cache-friendly, and reschedules are O(log n) sifts instead of a list walk.
+static std::vector<TimingEvent*> s_event_heap;
+
+// Cached s_event_heap.front(), so the recompiler dispatcher can read the next event's downcount
+// with a plain load through GetHeadEventPtr() regardless of heap storage reallocation.
 static TimingEvent* s_active_events_head;
-static TimingEvent* s_active_events_tail;
 static TimingEvent* s_current_event = nullptr;
 static u32 s_active_event_count = 0;
 static u32 s_global_tick_counter = 0;
@@ -50,6 +55,9 @@ std::unique_ptr<TimingEvent> CreateTimingEvent(std::string name, TickCount perio
   return event;
 }
 
+// The downcount is the guaranteed-safe execution slice: compiled code can accumulate this many
+// pending ticks before events must run. Block exits that elide the test (forward links under
+// overclock batching) can overshoot it by a bounded amount, which RunEvents() handles as lateness.
 void UpdateCPUDowncount()
 {
   const u32 event_downcount = s_active_events_head->GetDowncount();
@@ -61,206 +69,130 @@ TimingEvent** GetHeadEventPtr()
   return &s_active_events_head;
 }
 
-static void SortEvent(TimingEvent* event)
+/// Refreshes the cached heap root, and updates the CPU downcount if the next event changed.
+ALWAYS_INLINE_RELEASE static void UpdateHeadEvent()
 {
+  TimingEvent* const new_head = s_event_heap.empty() ? nullptr : s_event_heap.front();
+  if (s_active_events_head == new_head)
+    return;
+
+  s_active_events_head = new_head;
+  if (new_head)
+    UpdateCPUDowncount();
+}
+
+static void HeapSiftUp(u32 index)
+{
+  TimingEvent* const event = s_event_heap[index];
   const TickCount event_downcount = event->m_downcount;
 
-  if (event->prev && event->prev->m_downcount > event_downcount)
+  while (index > 0)
   {
-    // move backwards
-    TimingEvent* current = event->prev;
-    while (current && current->m_downcount > event_downcount)
-      current = current->prev;
-
-    // unlink
-    if (event->prev)
-      event->prev->next = event->next;
-    else
-      s_active_events_head = event->next;
-    if (event->next)
-      event->next->prev = event->prev;
-    else
-      s_active_events_tail = event->prev;
-
-    // insert after current
-    if (current)
-    {
-      event->next = current->next;
-      if (current->next)
-        current->next->prev = event;
-      else
-        s_active_events_tail = event;
-
-      event->prev = current;
-      current->next = event;
-    }
-    else
-    {
-      // insert at front
-      DebugAssert(s_active_events_head);
-      s_active_events_head->prev = event;
-      event->prev = nullptr;
-      event->next = s_active_events_head;
-      s_active_events_head = event;
-      UpdateCPUDowncount();
-    }
+    const u32 parent_index = (index - 1) / 2;
+    TimingEvent* const parent = s_event_heap[parent_index];
+    if (parent->m_downcount <= event_downcount)
+      break;
+
+    s_event_heap[index] = parent;
+    parent->heap_index = index;
+    index = parent_index;
   }
-  else if (event->next && event_downcount > event->next->m_downcount)
-  {
-    // move forwards
-    TimingEvent* current = event->next;
-    while (current && event_downcount > current->m_downcount)
-      current = current->next;
 
-    // unlink
-    if (event->prev)
-    {
-      event->prev->next = event->next;
-    }
-    else
-    {
-      s_active_events_head = event->next;
-      UpdateCPUDowncount();
-    }
-    if (event->next)
-      event->next->prev = event->prev;
-    else
-      s_active_events_tail = event->prev;
+  s_event_heap[index] = event;
+  event->heap_index = index;
+}
 
-    // insert before current
-    if (current)
-    {
-      event->next = current;
-      event->prev = current->prev;
+static void HeapSiftDown(u32 index)
+{
+  TimingEvent* const event = s_event_heap[index];
+  const TickCount event_downcount = event->m_downcount;
+  const u32 size = static_cast<u32>(s_event_heap.size());
 
-      if (current->prev)
-      {
-        current->prev->next = event;
-      }
-      else
-      {
-        s_active_events_head = event;
-        UpdateCPUDowncount();
-      }
+  for (;;)
+  {
+    u32 child_index = (index * 2) + 1;
+    if (child_index >= size)
+      break;
 
-      current->prev = event;
-    }
-    else
+    if ((child_index + 1) < size &&
+        s_event_heap[child_index + 1]->m_downcount < s_event_heap[child_index]->m_downcount)
     {
-      // insert at back
-      DebugAssert(s_active_events_tail);
-      s_active_events_tail->next = event;
-      event->next = nullptr;
-      event->prev = s_active_events_tail;
-      s_active_events_tail = event;
+      child_index++;
     }
+
+    if (s_event_heap[child_index]->m_downcount >= event_downcount)
+      break;
+
+    s_event_heap[index] = s_event_heap[child_index];
+    s_event_heap[index]->heap_index = index;
+    index = child_index;
   }
+
+  s_event_heap[index] = event;
+  event->heap_index = index;
+}
+
+static void SortEvent(TimingEvent* event)
+{
+  const u32 index = event->heap_index;
+  DebugAssert(index < s_event_heap.size() && s_event_heap[index] == event);
+
+  HeapSiftUp(index);
+  if (event->heap_index == index)
+    HeapSiftDown(index);
+
+  UpdateHeadEvent();
 }
 
 static void AddActiveEvent(TimingEvent* event)
 {
-  DebugAssert(!event->prev && !event->next);
+  DebugAssert(event->heap_index == TimingEvent::INVALID_HEAP_INDEX);
   s_active_event_count++;
 
-  TimingEvent* current = nullptr;
-  TimingEvent* next = s_active_events_head;
-  while (next && event->m_downcount > next->m_downcount)
-  {
-    current = next;
-    next = next->next;
-  }
+  event->heap_index = static_cast<u32>(s_event_heap.size());
+  s_event_heap.push_back(event);
+  HeapSiftUp(event->heap_index);
 
-  if (!next)
-  {
-    // new tail
-    event->prev = s_active_events_tail;
-    if (s_active_events_tail)
-    {
-      s_active_events_tail->next = event;
-      s_active_events_tail = event;
-    }
-    else
-    {
-      // first event
-      s_active_events_tail = event;
-      s_active_events_head = event;
-      UpdateCPUDowncount();
-    }
-  }
-  else if (!current)
-  {
-    // new head
-    event->next = s_active_events_head;
-    s_active_events_head->prev = event;
-    s_active_events_head = event;
-    UpdateCPUDowncount();
-  }
-  else
-  {
-    // inbetween current < event > next
-    event->prev = current;
-    event->next = next;
-    current->next = event;
-    next->prev = event;
-  }
+  UpdateHeadEvent();
 }
 
 static void RemoveActiveEvent(TimingEvent* event)
 {
-  DebugAssert(s_active_event_count > 0);
+  const u32 index = event->heap_index;
+  DebugAssert(s_active_event_count > 0 && index < s_event_heap.size() && s_event_heap[index] == event);
 
-  if (event->next)
-  {
-    event->next->prev = event->prev;
-  }
-  else
-  {
-    s_active_events_tail = event->prev;
-  }
+  event->heap_index = TimingEvent::INVALID_HEAP_INDEX;
+  s_active_event_count--;
 
-  if (event->prev)
-  {
-    event->prev->next = event->next;
-  }
-  else
+  TimingEvent* const last = s_event_heap.back();
+  s_event_heap.pop_back();
+  if (last != event)
   {
-    s_active_events_head = event->next;
-    if (s_active_events_head)
-      UpdateCPUDowncount();
+    // move the last event into the hole, then sift it to its correct position
+    s_event_heap[index] = last;
+    last->heap_index = index;
+    HeapSiftUp(index);
+    if (last->heap_index == index)
+      HeapSiftDown(index);
   }
 
-  event->prev = nullptr;
-  event->next = nullptr;
-
-  s_active_event_count--;
+  UpdateHeadEvent();
 }
 
 static void SortEvents()
 {
-  std::vector<TimingEvent*> events;
-  events.reserve(s_active_event_count);
-
-  TimingEvent* next = s_active_events_head;
-  while (next)
-  {
-    TimingEvent* current = next;
-    events.push_back(current);
-    next = current->next;
-    current->prev = nullptr;
-    current->next = nullptr;
-  }
+  // Downcounts were rewritten wholesale (e.g. by a state load), rebuild the heap bottom-up.
+  for (u32 i = static_cast<u32>(s_event_heap.size()) / 2; i > 0;)
+    HeapSiftDown(--i);
 
-  s_active_events_head = nullptr;
-  s_active_events_tail = nullptr;
-  s_active_event_count = 0;
-
-  for (TimingEvent* event : events)
-    AddActiveEvent(event);
+  s_active_events_head = s_event_heap.empty() ? nullptr : s_event_heap.front();
+  if (s_active_events_head)
+    UpdateCPUDowncount();
 }
 
 static TimingEvent* FindActiveEvent(const char* name)
 {
-  for (TimingEvent* event = s_active_events_head; event; event = event->next)
+  for (TimingEvent* event : s_event_heap)
   {
     if (event->GetName().compare(name) == 0)
       return event;
@@ -302,7 +234,8 @@ void RunEvents()
 
         // Apply downcount to all events.
         // This will result in a negative downcount for those events which are late.
-        for (TimingEvent* event = s_active_events_head; event; event = event->next)
+        // Shifting every key by the same amount preserves the heap order.
+        for (TimingEvent* event : s_event_heap)
         {
           event->m_downcount -= time;
           event->m_time_since_last_run += time;
@@ -311,7 +244,6 @@ void RunEvents()
         // Now we can actually run the callbacks.
         while (s_active_events_head->m_downcount <= 0)
         {
-          // move it to the end, since that'll likely be its new position
           TimingEvent* event = s_active_events_head;
           s_current_event = event;
 
@@ -392,7 +324,7 @@ bool DoState(StateWrapper& sw)
 
     sw.Do(&s_active_event_count);
 
-    for (TimingEvent* event = s_active_events_head; event; event = event->next)
+    for (TimingEvent* event : s_event_heap)
     {
       sw.Do(&event->m_name);
       sw.Do(&event->m_downcount);
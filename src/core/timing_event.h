@@ -63,8 +63,10 @@ public:
   void SetInterval(TickCount interval) { m_interval = interval; }
   void SetPeriod(TickCount period) { m_period = period; }
 
-  TimingEvent* prev = nullptr;
-  TimingEvent* next = nullptr;
+  static constexpr u32 INVALID_HEAP_INDEX = 0xFFFFFFFFu;
+
+  // Index of this event in the active event heap, maintained by TimingEvents.
+  u32 heap_index = INVALID_HEAP_INDEX;
 
   TimingEventCallback m_callback;
   void* m_callback_param;
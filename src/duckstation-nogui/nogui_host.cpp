@@ -14,8 +14,10 @@
 #include "core/host.h"
 #include "core/imgui_overlays.h"
 #include "core/settings.h"
+#include "core/spu.h"
 #include "core/system.h"
 
+#include "util/audio_stream.h"
 #include "util/gpu_device.h"
 #include "util/imgui_manager.h"
 #include "util/ini_settings_interface.h"
@@ -26,15 +28,19 @@
 #include "imgui_internal.h"
 #include "imgui_stdlib.h"
 
+#include "common/align.h"
 #include "common/assert.h"
 #include "common/byte_stream.h"
 #include "common/crash_handler.h"
 #include "common/file_system.h"
 #include "common/log.h"
+#include "common/memmap.h"
+#include "common/mpsc_function_queue.h"
 #include "common/path.h"
 #include "common/string_util.h"
 #include "common/threading.h"
 
+#include <atomic>
 #include <cinttypes>
 #include <cmath>
 #include <condition_variable>
@@ -87,6 +93,38 @@ static void UpdateWindowTitle(const std::string& game_title);
 static void CancelAsyncOp();
 static void StartAsyncOp(std::function<void(ProgressCallback*)> callback);
 static void AsyncOpThreadEntryPoint(std::function<void(ProgressCallback*)> callback);
+
+// Shared-memory A/V output for external frontends (-shmout). The region starts with the header
+// below; a consumer opens the region by name, validates magic/version, and then:
+//  - Video: read video_sequence, copy the frame and metadata, and re-read the sequence. The writer
+//    bumps it to an odd value before updating and to an even value afterwards, so the copy is
+//    consistent once the same even value is seen on both reads. Pixels are tightly-packed top-down
+//    RGBA8, video_width x video_height, starting at video_offset.
+//  - Audio: audio_write_cursor counts interleaved frames written since startup. A consumer keeps
+//    its own read cursor and copies from (cursor % audio_ring_frames) onwards; samples are raw
+//    signed 16-bit at audio_sample_rate, taken before any stretching or resampling.
+struct SharedMemoryOutputHeader
+{
+  u32 magic; // SHM_OUTPUT_MAGIC, written last during setup
+  u32 version;
+  u32 header_size;
+  u32 video_offset;
+  u32 video_buffer_size;
+  u32 audio_offset;
+  u32 audio_ring_frames;
+  u32 audio_sample_rate;
+  u32 audio_channels;
+  std::atomic<u32> video_sequence;
+  u32 video_width;
+  u32 video_height;
+  std::atomic<u64> audio_write_cursor;
+};
+static_assert(std::atomic<u32>::is_always_lock_free && std::atomic<u64>::is_always_lock_free);
+
+static bool InitializeSharedMemoryOutput();
+static void ShutdownSharedMemoryOutput();
+static void UpdateSharedMemoryOutputFrame();
+static void SharedMemoryOutputAudioTap(const AudioStream::SampleType* frames, u32 num_frames, void* userdata);
 } // namespace NoGUIHost
 
 //////////////////////////////////////////////////////////////////////////
@@ -103,13 +141,27 @@ static std::atomic_bool s_running{false};
 static std::mutex s_cpu_thread_events_mutex;
 static std::condition_variable s_cpu_thread_event_done;
 static std::condition_variable s_cpu_thread_event_posted;
-static std::deque<std::pair<std::function<void()>, bool>> s_cpu_thread_events;
-static u32 s_blocking_cpu_events_pending = 0; // TODO: Token system would work better here.
+
+// Producers push without taking the mutex; it is only grabbed for the wakeup/completion
+// condition variables. The consumer side always polls with a timeout, so a racing push
+// can never be lost, just delayed by at most one poll interval.
+static MPSCFunctionQueue<256> s_cpu_thread_events;
 
 static std::mutex s_async_op_mutex;
 static std::thread s_async_op_thread;
 static FullscreenUI::ProgressCallback* s_async_op_progress = nullptr;
 
+static constexpr u32 SHM_OUTPUT_MAGIC = 0x56415344; // 'DSAV'
+static constexpr u32 SHM_OUTPUT_VERSION = 1;
+static constexpr u32 SHM_OUTPUT_MAX_VIDEO_WIDTH = 3840;
+static constexpr u32 SHM_OUTPUT_MAX_VIDEO_HEIGHT = 2160;
+static constexpr u32 SHM_OUTPUT_AUDIO_RING_FRAMES = 32768; // pow2, ~0.74 seconds at 44.1kHz
+
+static std::string s_shm_output_name;
+static void* s_shm_output_handle = nullptr;
+static NoGUIHost::SharedMemoryOutputHeader* s_shm_output = nullptr;
+static size_t s_shm_output_size = 0;
+
 //////////////////////////////////////////////////////////////////////////
 // Initialization/Shutdown
 //////////////////////////////////////////////////////////////////////////
@@ -299,7 +351,18 @@ void Host::ReportErrorAsync(const std::string_view& title, const std::string_vie
     Log_ErrorPrintf("ReportErrorAsync: %.*s", static_cast<int>(message.size()), message.data());
   }
 
-  g_nogui_window->ReportError(title, message);
+  // The fullscreen UI can surface this as an overlay without stopping the world; otherwise, hand
+  // the popup off to the platform message loop. Either way the calling thread (usually the CPU
+  // thread) never blocks on a modal, which matters for transient warnings mid-game.
+  if (FullscreenUI::IsInitialized())
+  {
+    Host::AddOSDMessage(title.empty() ? std::string(message) : fmt::format("{}: {}", title, message),
+                        Host::OSD_CRITICAL_ERROR_DURATION);
+    return;
+  }
+
+  g_nogui_window->ExecuteInMessageLoop(
+    [title = std::string(title), message = std::string(message)]() { g_nogui_window->ReportError(title, message); });
 }
 
 bool Host::ConfirmMessage(const std::string_view& title, const std::string_view& message)
@@ -314,6 +377,8 @@ bool Host::ConfirmMessage(const std::string_view& title, const std::string_view&
     Log_ErrorPrintf("ConfirmMessage: %.*s", static_cast<int>(message.size()), message.data());
   }
 
+  // This one genuinely needs an answer before the caller can proceed, so it stays synchronous;
+  // the calling thread blocking on the modal is the pause.
   return g_nogui_window->ConfirmMessage(title, message);
 }
 
@@ -584,39 +649,142 @@ void NoGUIHost::ProcessCPUThreadPlatformMessages()
 
 void NoGUIHost::ProcessCPUThreadEvents(bool block)
 {
-  std::unique_lock lock(s_cpu_thread_events_mutex);
-
   for (;;)
   {
-    if (s_cpu_thread_events.empty())
+    if (s_cpu_thread_events.IsEmpty())
     {
       if (!block || !s_running.load(std::memory_order_acquire))
         return;
 
       // we still need to keep polling the controllers when we're paused
+      std::unique_lock lock(s_cpu_thread_events_mutex);
       do
       {
         ProcessCPUThreadPlatformMessages();
         InputManager::PollSources();
       } while (!s_cpu_thread_event_posted.wait_for(lock, CPU_THREAD_POLL_INTERVAL,
-                                                   []() { return !s_cpu_thread_events.empty(); }));
+                                                   []() { return !s_cpu_thread_events.IsEmpty(); }));
     }
 
     // return after processing all events if we had one
     block = false;
+    s_cpu_thread_events.RunOne();
+  }
+}
 
-    auto event = std::move(s_cpu_thread_events.front());
-    s_cpu_thread_events.pop_front();
-    lock.unlock();
-    event.first();
-    lock.lock();
+bool NoGUIHost::InitializeSharedMemoryOutput()
+{
+  const u32 header_size = Common::AlignUpPow2(static_cast<u32>(sizeof(SharedMemoryOutputHeader)), 4096u);
+  const u32 video_buffer_size = SHM_OUTPUT_MAX_VIDEO_WIDTH * SHM_OUTPUT_MAX_VIDEO_HEIGHT * static_cast<u32>(sizeof(u32));
+  const u32 audio_buffer_size =
+    SHM_OUTPUT_AUDIO_RING_FRAMES * AudioStream::MAX_CHANNELS * static_cast<u32>(sizeof(AudioStream::SampleType));
+  const size_t size = header_size + video_buffer_size + audio_buffer_size;
 
-    if (event.second)
-    {
-      s_blocking_cpu_events_pending--;
-      s_cpu_thread_event_done.notify_one();
-    }
+  s_shm_output_handle = MemMap::CreateNamedSharedMemory(s_shm_output_name.c_str(), size);
+  if (!s_shm_output_handle)
+  {
+    Log_ErrorPrintf("Failed to create shared memory output region '%s'", s_shm_output_name.c_str());
+    return false;
+  }
+
+  void* base = MemMap::MapSharedMemory(s_shm_output_handle, 0, nullptr, size, PageProtect::ReadWrite);
+  if (!base)
+  {
+    Log_ErrorPrintf("Failed to map shared memory output region '%s'", s_shm_output_name.c_str());
+    MemMap::DestroySharedMemory(s_shm_output_handle);
+    MemMap::DeleteNamedSharedMemory(s_shm_output_name.c_str());
+    s_shm_output_handle = nullptr;
+    return false;
+  }
+
+  s_shm_output = new (base) SharedMemoryOutputHeader();
+  s_shm_output_size = size;
+  s_shm_output->version = SHM_OUTPUT_VERSION;
+  s_shm_output->header_size = header_size;
+  s_shm_output->video_offset = header_size;
+  s_shm_output->video_buffer_size = video_buffer_size;
+  s_shm_output->audio_offset = header_size + video_buffer_size;
+  s_shm_output->audio_ring_frames = SHM_OUTPUT_AUDIO_RING_FRAMES;
+  s_shm_output->audio_sample_rate = SPU::SAMPLE_RATE;
+  s_shm_output->audio_channels = AudioStream::MAX_CHANNELS;
+
+  // magic last, so a consumer polling for the region doesn't see a half-filled header
+  std::atomic_thread_fence(std::memory_order_release);
+  s_shm_output->magic = SHM_OUTPUT_MAGIC;
+
+  AudioStream::SetFrameTap(&SharedMemoryOutputAudioTap, nullptr);
+  Log_InfoPrintf("Shared memory output active in region '%s' (%zu bytes)", s_shm_output_name.c_str(), size);
+  return true;
+}
+
+void NoGUIHost::ShutdownSharedMemoryOutput()
+{
+  if (!s_shm_output)
+    return;
+
+  AudioStream::SetFrameTap(nullptr, nullptr);
+  s_shm_output->magic = 0;
+  MemMap::UnmapSharedMemory(s_shm_output, s_shm_output_size);
+  MemMap::DestroySharedMemory(s_shm_output_handle);
+  MemMap::DeleteNamedSharedMemory(s_shm_output_name.c_str());
+  s_shm_output = nullptr;
+  s_shm_output_handle = nullptr;
+}
+
+void NoGUIHost::SharedMemoryOutputAudioTap(const AudioStream::SampleType* frames, u32 num_frames, void* userdata)
+{
+  SharedMemoryOutputHeader* const hdr = s_shm_output;
+  if (!hdr || num_frames == 0)
+    return;
+
+  const u32 channels = hdr->audio_channels;
+  AudioStream::SampleType* const ring =
+    reinterpret_cast<AudioStream::SampleType*>(reinterpret_cast<u8*>(hdr) + hdr->audio_offset);
+  const u64 cursor = hdr->audio_write_cursor.load(std::memory_order_relaxed);
+  const u32 start = static_cast<u32>(cursor % SHM_OUTPUT_AUDIO_RING_FRAMES);
+  const u32 first = std::min(num_frames, SHM_OUTPUT_AUDIO_RING_FRAMES - start);
+  std::memcpy(&ring[start * channels], frames, first * channels * sizeof(AudioStream::SampleType));
+  if (first < num_frames)
+  {
+    std::memcpy(ring, &frames[first * channels], (num_frames - first) * channels * sizeof(AudioStream::SampleType));
+  }
+  hdr->audio_write_cursor.store(cursor + num_frames, std::memory_order_release);
+}
+
+void NoGUIHost::UpdateSharedMemoryOutputFrame()
+{
+  if (!System::IsRunning() || !g_gpu_device || !g_gpu_device->HasSurface())
+    return;
+
+  const u32 width = std::min(static_cast<u32>(g_gpu_device->GetWindowWidth()), SHM_OUTPUT_MAX_VIDEO_WIDTH);
+  const u32 height = std::min(static_cast<u32>(g_gpu_device->GetWindowHeight()), SHM_OUTPUT_MAX_VIDEO_HEIGHT);
+  if (width == 0 || height == 0)
+    return;
+
+  // Not zero-copy: the device classes have no exportable image support, so the frame is read back
+  // and copied into the region. Reuses its buffer across frames, only ever called on this thread.
+  static std::vector<u32> pixels;
+  u32 stride;
+  GPUTexture::Format format;
+  const Common::Rectangle<s32> draw_rect = g_gpu->CalculateDrawRect(static_cast<s32>(width), static_cast<s32>(height));
+  if (!g_gpu->RenderScreenshotToBuffer(width, height, draw_rect, true, &pixels, &stride, &format) ||
+      !GPUTexture::ConvertTextureDataToRGBA8(width, height, pixels, stride, format))
+  {
+    return;
   }
+
+  if (g_gpu_device->UsesLowerLeftOrigin())
+    GPUTexture::FlipTextureDataRGBA8(width, height, pixels, stride);
+
+  SharedMemoryOutputHeader* const hdr = s_shm_output;
+  u8* const video = reinterpret_cast<u8*>(hdr) + hdr->video_offset;
+  const u32 copy_stride = width * static_cast<u32>(sizeof(u32));
+  hdr->video_sequence.fetch_add(1, std::memory_order_acq_rel); // odd - update in progress
+  hdr->video_width = width;
+  hdr->video_height = height;
+  for (u32 y = 0; y < height; y++)
+    std::memcpy(video + (y * copy_stride), reinterpret_cast<const u8*>(pixels.data()) + (y * stride), copy_stride);
+  hdr->video_sequence.fetch_add(1, std::memory_order_release); // even - consistent
 }
 
 void NoGUIHost::CPUThreadEntryPoint()
@@ -626,6 +794,9 @@ void NoGUIHost::CPUThreadEntryPoint()
   // input source setup must happen on emu thread
   System::Internal::ProcessStartup();
 
+  if (!s_shm_output_name.empty() && !InitializeSharedMemoryOutput())
+    g_nogui_window->ReportError("Error", "Failed to create shared memory output region.");
+
   // start the fullscreen UI and get it going
   if (Host::CreateGPUDevice(Settings::GetRenderAPIForRenderer(g_settings.gpu_renderer)) && FullscreenUI::Initialize())
   {
@@ -647,6 +818,7 @@ void NoGUIHost::CPUThreadEntryPoint()
 
   if (System::IsValid())
     System::ShutdownSystem(false);
+  ShutdownSharedMemoryOutput();
   Host::ReleaseGPUDevice();
   Host::ReleaseRenderWindow();
 
@@ -666,8 +838,9 @@ void NoGUIHost::CPUThreadMainLoop()
 
     Host::PumpMessagesOnCPUThread();
     System::Internal::IdlePollUpdate();
-    System::PresentDisplay(false);
-    if (!g_gpu_device->IsVsyncEnabled())
+    // A skipped (unchanged) present doesn't block on vsync, so throttle manually in that case.
+    const bool presented = System::PresentDisplay(false);
+    if (!presented || !g_gpu_device->IsVsyncEnabled())
       g_gpu_device->ThrottlePresentation();
   }
 }
@@ -749,7 +922,8 @@ void Host::RequestResizeHostDisplay(s32 width, s32 height)
 
 void Host::OpenURL(const std::string_view& url)
 {
-  g_nogui_window->OpenURL(url);
+  // Launching a browser can take a while on some platforms, keep it off the CPU thread.
+  g_nogui_window->ExecuteInMessageLoop([url = std::string(url)]() { g_nogui_window->OpenURL(url); });
 }
 
 bool Host::CopyTextToClipboard(const std::string_view& text)
@@ -798,6 +972,8 @@ void Host::PumpMessagesOnCPUThread()
 {
   NoGUIHost::ProcessCPUThreadPlatformMessages();
   NoGUIHost::ProcessCPUThreadEvents(false);
+  if (s_shm_output)
+    NoGUIHost::UpdateSharedMemoryOutputFrame();
 }
 
 std::unique_ptr<NoGUIPlatform> NoGUIHost::CreatePlatform()
@@ -843,11 +1019,25 @@ void NoGUIHost::UpdateWindowTitle(const std::string& game_title)
 
 void Host::RunOnCPUThread(std::function<void()> function, bool block /* = false */)
 {
+  if (!block)
+  {
+    s_cpu_thread_events.Push(std::move(function));
+    s_cpu_thread_event_posted.notify_one();
+    return;
+  }
+
+  bool done = false;
+  s_cpu_thread_events.Push([func = std::move(function), &done]() {
+    func();
+
+    std::unique_lock lock(s_cpu_thread_events_mutex);
+    done = true;
+    s_cpu_thread_event_done.notify_all();
+  });
+
   std::unique_lock lock(s_cpu_thread_events_mutex);
-  s_cpu_thread_events.emplace_back(std::move(function), block);
   s_cpu_thread_event_posted.notify_one();
-  if (block)
-    s_cpu_thread_event_done.wait(lock, []() { return s_blocking_cpu_events_pending == 0; });
+  s_cpu_thread_event_done.wait(lock, [&done]() { return done; });
 }
 
 void NoGUIHost::StartAsyncOp(std::function<void(ProgressCallback*)> callback)
@@ -1023,6 +1213,8 @@ void NoGUIHost::PrintCommandLineHelp(const char* progname)
   std::fprintf(stderr, "  -portable: Forces \"portable mode\", data in same directory.\n");
   std::fprintf(stderr, "  -settings <filename>: Loads a custom settings configuration from the\n"
                        "    specified filename. Default settings applied if file not found.\n");
+  std::fprintf(stderr, "  -shmout <name>: Exports video frames and audio to a shared memory\n"
+                       "    region with the specified name, for embedding into other frontends.\n");
   std::fprintf(stderr, "  -earlyconsole: Creates console as early as possible, for logging.\n");
   std::fprintf(stderr, "  --: Signals that no more arguments will follow and the remaining\n"
                        "    parameters make up the filename. Use when the filename contains\n"
@@ -1144,6 +1336,12 @@ bool NoGUIHost::ParseCommandLineParametersAndInitializeConfig(int argc, char* ar
         Log_InfoPrintf("Command Line: Overriding settings filename: %s", settings_filename.c_str());
         continue;
       }
+      else if (CHECK_ARG_PARAM("-shmout"))
+      {
+        s_shm_output_name = argv[++i];
+        Log_InfoPrintf("Command Line: Using shared memory output region '%s'.", s_shm_output_name.c_str());
+        continue;
+      }
       else if (CHECK_ARG("-earlyconsole"))
       {
         InitializeEarlyConsole();
@@ -1244,6 +1442,7 @@ int main(int argc, char* argv[])
   NoGUIHost::StopCPUThread();
 
   // Ensure log is flushed.
+  Log::SetAsyncOutputParams(false);
   Log::SetFileOutputParams(false, nullptr);
 
   s_base_settings_interface.reset();
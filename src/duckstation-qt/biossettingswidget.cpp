@@ -21,12 +21,17 @@ BIOSSettingsWidget::BIOSSettingsWidget(SettingsWindow* dialog, QWidget* parent)
 
   SettingWidgetBinder::BindWidgetToBoolSetting(sif, m_ui.enableTTYLogging, "BIOS", "TTYLogging", false);
   SettingWidgetBinder::BindWidgetToBoolSetting(sif, m_ui.fastBoot, "BIOS", "PatchFastBoot", false);
+  SettingWidgetBinder::BindWidgetToBoolSetting(sif, m_ui.hleMemoryFunctions, "BIOS", "HLEMemoryFunctions", false);
 
   dialog->registerWidgetHelp(m_ui.fastBoot, tr("Fast Boot"), tr("Unchecked"),
                              tr("Patches the BIOS to skip the console's boot animation. Does not work with all games, "
                                 "but usually safe to enable."));
   dialog->registerWidgetHelp(m_ui.enableTTYLogging, tr("Enable TTY Logging"), tr("Unchecked"),
                              tr("Logs BIOS calls to printf(). Not all games contain debugging messages."));
+  dialog->registerWidgetHelp(
+    m_ui.hleMemoryFunctions, tr("Fast Kernel Memory Functions (Hack)"), tr("Unchecked"),
+    tr("Executes the BIOS kernel's memcpy/memset/strcmp routines natively instead of emulating them, reducing load "
+       "times in games that stream data through the kernel. May affect timing, leave disabled unless needed."));
 
   connect(m_ui.imageNTSCJ, QOverload<int>::of(&QComboBox::currentIndexChanged), [this](int index) {
     if (m_dialog->isPerGameSettings() && index == 0)
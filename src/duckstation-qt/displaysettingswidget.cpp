@@ -142,6 +142,14 @@ DisplaySettingsWidget::DisplaySettingsWidget(SettingsWindow* dialog, QWidget* pa
 #else
   m_ui.blitSwapChain->setEnabled(false);
 #endif
+
+  SettingWidgetBinder::BindWidgetToBoolSetting(sif, m_ui.preferMailboxPresentation, "Display",
+                                               "PreferMailboxPresentation", false);
+  dialog->registerWidgetHelp(
+    m_ui.preferMailboxPresentation, tr("Prefer Mailbox Presentation"), tr("Unchecked"),
+    tr("Presents frames without tearing when VSync is disabled, at the cost of up to one frame of "
+       "additional latency. Leave unchecked for the lowest input lag, e.g. on competitive setups "
+       "where tearing is acceptable."));
 }
 
 DisplaySettingsWidget::~DisplaySettingsWidget() = default;
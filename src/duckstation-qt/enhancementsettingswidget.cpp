@@ -27,6 +27,8 @@ EnhancementSettingsWidget::EnhancementSettingsWidget(SettingsWindow* dialog, QWi
   SettingWidgetBinder::BindWidgetToBoolSetting(sif, m_ui.forceNTSCTimings, "GPU", "ForceNTSCTimings", false);
   SettingWidgetBinder::BindWidgetToBoolSetting(sif, m_ui.force43For24Bit, "Display", "Force4_3For24Bit", false);
   SettingWidgetBinder::BindWidgetToBoolSetting(sif, m_ui.chromaSmoothingFor24Bit, "GPU", "ChromaSmoothing24Bit", false);
+  SettingWidgetBinder::BindWidgetToBoolSetting(sif, m_ui.motionAdaptiveDeinterlacing, "GPU",
+                                               "MotionAdaptiveDeinterlacing", false);
   SettingWidgetBinder::BindWidgetToEnumSetting(sif, m_ui.textureFiltering, "GPU", "TextureFilter",
                                                &Settings::ParseTextureFilterName, &Settings::GetTextureFilterName,
                                                Settings::DEFAULT_GPU_TEXTURE_FILTER);
@@ -41,6 +43,7 @@ EnhancementSettingsWidget::EnhancementSettingsWidget(SettingsWindow* dialog, QWi
   SettingWidgetBinder::BindWidgetToBoolSetting(sif, m_ui.pgxpDepthBuffer, "GPU", "PGXPDepthBuffer", false);
   SettingWidgetBinder::BindWidgetToBoolSetting(sif, m_ui.pgxpPreserveProjPrecision, "GPU", "PGXPPreserveProjFP", false);
   SettingWidgetBinder::BindWidgetToBoolSetting(sif, m_ui.pgxpCPU, "GPU", "PGXPCPU", false);
+  SettingWidgetBinder::BindWidgetToBoolSetting(sif, m_ui.pgxpVertexOnly, "GPU", "PGXPVertexOnly", false);
 
   connect(m_ui.resolutionScale, QOverload<int>::of(&QComboBox::currentIndexChanged), this,
           &EnhancementSettingsWidget::updateScaledDitheringEnabled);
@@ -96,6 +99,10 @@ EnhancementSettingsWidget::EnhancementSettingsWidget(SettingsWindow* dialog, QWi
   dialog->registerWidgetHelp(m_ui.chromaSmoothingFor24Bit, tr("Chroma Smoothing For 24-Bit Display"), tr("Unchecked"),
                              tr("Smooths out blockyness between colour transitions in 24-bit content, usually FMVs. "
                                 "Only applies to the hardware renderers."));
+  dialog->registerWidgetHelp(m_ui.motionAdaptiveDeinterlacing, tr("Motion Adaptive Deinterlacing"), tr("Unchecked"),
+                             tr("Replaces stale field lines with a vertical blend where motion is detected between "
+                                "fields, keeping full weave detail in static areas. Only applies to games which "
+                                "render interlaced, and only to the hardware renderers."));
   dialog->registerWidgetHelp(
     m_ui.textureFiltering, tr("Texture Filtering"),
     QString::fromUtf8(Settings::GetTextureFilterDisplayName(GPUTextureFilter::Nearest)),
@@ -136,6 +143,10 @@ EnhancementSettingsWidget::EnhancementSettingsWidget(SettingsWindow* dialog, QWi
   dialog->registerWidgetHelp(m_ui.pgxpCPU, tr("CPU Mode (Very Slow)"), tr("Unchecked"),
                              tr("Uses PGXP for all instructions, not just memory operations. Required for PGXP to "
                                 "correct wobble in some games, but has a very high performance cost."));
+  dialog->registerWidgetHelp(m_ui.pgxpVertexOnly, tr("Vertex-Only Mode (Faster)"), tr("Unchecked"),
+                             tr("Tracks precision only on the GTE-to-memory path, reducing the PGXP overhead on slower "
+                                "devices. Precision is lost when geometry is copied through CPU registers, so some "
+                                "games will show more wobble than full PGXP. Has no effect when CPU Mode is enabled."));
 }
 
 EnhancementSettingsWidget::~EnhancementSettingsWidget() = default;
@@ -198,4 +209,5 @@ void EnhancementSettingsWidget::updatePGXPSettingsEnabled()
   m_ui.pgxpDepthBuffer->setEnabled(enabled);
   m_ui.pgxpPreserveProjPrecision->setEnabled(enabled);
   m_ui.pgxpCPU->setEnabled(enabled);
+  m_ui.pgxpVertexOnly->setEnabled(enabled);
 }
@@ -191,25 +191,15 @@ void GameListModel::loadOrGenerateCover(const GameList::Entry* ge)
 
 void GameListModel::invalidateCoverForPath(const std::string& path)
 {
-  // This isn't ideal, but not sure how else we can get the row, when it might change while scanning...
-  auto lock = GameList::GetLock();
-  const u32 count = GameList::GetEntryCount();
-  std::optional<u32> row;
-  for (u32 i = 0; i < count; i++)
-  {
-    if (GameList::GetEntryByIndex(i)->path == path)
-    {
-      row = i;
-      break;
-    }
-  }
-  if (!row.has_value())
+  // Only updated on the UI thread, so no lock needed.
+  const auto it = m_path_row_map.find(path);
+  if (it == m_path_row_map.end())
   {
     // Game removed?
     return;
   }
 
-  const QModelIndex mi(index(static_cast<int>(row.value()), Column_Cover));
+  const QModelIndex mi(index(static_cast<int>(it->second), Column_Cover));
   emit dataChanged(mi, mi, {Qt::DecorationRole});
 }
 
@@ -233,7 +223,8 @@ int GameListModel::rowCount(const QModelIndex& parent) const
   if (parent.isValid())
     return 0;
 
-  return static_cast<int>(GameList::GetEntryCount());
+  // Uses the count from the last refresh, so the view doesn't see rows it hasn't been notified about.
+  return static_cast<int>(m_row_count);
 }
 
 int GameListModel::columnCount(const QModelIndex& parent) const
@@ -435,8 +426,53 @@ QVariant GameListModel::headerData(int section, Qt::Orientation orientation, int
 
 void GameListModel::refresh()
 {
-  beginResetModel();
-  endResetModel();
+  const auto lock = GameList::GetLock();
+  const u32 count = GameList::GetEntryCount();
+  if (count < m_row_count)
+  {
+    // List was rebuilt (e.g. the start of a scan), we can't map the old rows to the new ones.
+    beginResetModel();
+    m_row_count = count;
+    updateRowCaches(0);
+    endResetModel();
+    return;
+  }
+
+  if (count > m_row_count)
+  {
+    // Scanning only ever appends entries, so fold the new rows in without resetting the view.
+    const u32 first_new_row = m_row_count;
+    beginInsertRows(QModelIndex(), static_cast<int>(first_new_row), static_cast<int>(count - 1));
+    m_row_count = count;
+    updateRowCaches(first_new_row);
+    endInsertRows();
+    return;
+  }
+
+  // Same rows, but the fields themselves (e.g. play time) may have changed.
+  if (count > 0)
+  {
+    updateRowCaches(0);
+    emit dataChanged(index(0, 0), index(static_cast<int>(count - 1), Column_Count - 1));
+  }
+}
+
+void GameListModel::updateRowCaches(u32 first_row)
+{
+  // Caller must hold the game list lock.
+  if (first_row == 0)
+  {
+    m_title_cache.clear();
+    m_path_row_map.clear();
+  }
+
+  m_title_cache.reserve(m_row_count);
+  for (u32 row = first_row; row < m_row_count; row++)
+  {
+    const GameList::Entry* ge = GameList::GetEntryByIndex(row);
+    m_title_cache.push_back(QString::fromStdString(ge->title));
+    m_path_row_map[ge->path] = row;
+  }
 }
 
 bool GameListModel::titlesLessThan(int left_row, int right_row) const
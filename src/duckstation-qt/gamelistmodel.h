@@ -15,6 +15,7 @@
 #include <algorithm>
 #include <array>
 #include <optional>
+#include <vector>
 
 class GameListModel final : public QAbstractTableModel
 {
@@ -55,6 +56,9 @@ public:
 
   ALWAYS_INLINE const QString& getColumnDisplayName(int column) { return m_column_display_names[column]; }
 
+  /// Returns the cached title for the given row, so the proxy model can filter without allocating per-row.
+  ALWAYS_INLINE const QString& getTitleForRow(int row) const { return m_title_cache[row]; }
+
   void refresh();
   void reloadThemeSpecificImages();
 
@@ -82,6 +86,7 @@ private:
   void setColumnDisplayNames();
   void loadOrGenerateCover(const GameList::Entry* ge);
   void invalidateCoverForPath(const std::string& path);
+  void updateRowCaches(u32 first_row);
 
   float m_cover_scale = 0.0f;
   bool m_show_titles_for_covers = false;
@@ -94,5 +99,9 @@ private:
   QPixmap m_placeholder_pixmap;
   QPixmap m_loading_pixmap;
 
+  u32 m_row_count = 0;
+  std::vector<QString> m_title_cache;
+  PreferUnorderedStringMap<u32> m_path_row_map;
+
   mutable LRUCache<std::string, QPixmap> m_cover_pixmap_cache;
 };
\ No newline at end of file
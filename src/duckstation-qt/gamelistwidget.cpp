@@ -56,7 +56,7 @@ public:
 
   bool filterAcceptsRow(int source_row, const QModelIndex& source_parent) const override
   {
-    if (m_filter_type != GameList::EntryType::Count || m_filter_region != DiscRegion::Count || !m_filter_name.isEmpty())
+    if (m_filter_type != GameList::EntryType::Count || m_filter_region != DiscRegion::Count)
     {
       const auto lock = GameList::GetLock();
       const GameList::Entry* entry = GameList::GetEntryByIndex(source_row);
@@ -64,11 +64,13 @@ public:
         return false;
       if (m_filter_region != DiscRegion::Count && entry->region != m_filter_region)
         return false;
-      if (!m_filter_name.isEmpty() &&
-          !QString::fromStdString(entry->title).contains(m_filter_name, Qt::CaseInsensitive))
-        return false;
     }
 
+    // Titles are cached in the model, so searching doesn't allocate for every row.
+    if (!m_filter_name.isEmpty() &&
+        !m_model->getTitleForRow(source_row).contains(m_filter_name, Qt::CaseInsensitive))
+      return false;
+
     return QSortFilterProxyModel::filterAcceptsRow(source_row, source_parent);
   }
 
@@ -4,11 +4,17 @@
 #include "gamesummarywidget.h"
 #include "qthost.h"
 #include "qtprogresscallback.h"
+#include "qtutils.h"
 #include "settingswindow.h"
 
 #include "core/game_database.h"
 #include "core/game_list.h"
+#include "core/settings.h"
 
+#include "util/ini_settings_interface.h"
+
+#include "common/file_system.h"
+#include "common/path.h"
 #include "common/string_util.h"
 
 #include "fmt/format.h"
@@ -63,17 +69,17 @@ void GameSummaryWidget::populateUi(const std::string& path, const std::string& s
 
   if (entry)
   {
-    m_ui.title->setText(QString::fromStdString(entry->title));
+    m_ui.title->setText(QtUtils::StringViewToQString(entry->title));
     m_ui.compatibility->setCurrentIndex(static_cast<int>(entry->compatibility));
-    m_ui.genre->setText(entry->genre.empty() ? tr("Unknown") : QString::fromStdString(entry->genre));
+    m_ui.genre->setText(entry->genre.empty() ? tr("Unknown") : QtUtils::StringViewToQString(entry->genre));
     if (!entry->developer.empty() && !entry->publisher.empty() && entry->developer != entry->publisher)
       m_ui.developer->setText(tr("%1 (Published by %2)")
-                                .arg(QString::fromStdString(entry->developer))
-                                .arg(QString::fromStdString(entry->publisher)));
+                                .arg(QtUtils::StringViewToQString(entry->developer))
+                                .arg(QtUtils::StringViewToQString(entry->publisher)));
     else if (!entry->developer.empty())
-      m_ui.developer->setText(QString::fromStdString(entry->developer));
+      m_ui.developer->setText(QtUtils::StringViewToQString(entry->developer));
     else if (!entry->publisher.empty())
-      m_ui.developer->setText(tr("Published by %1").arg(QString::fromStdString(entry->publisher)));
+      m_ui.developer->setText(tr("Published by %1").arg(QtUtils::StringViewToQString(entry->publisher)));
     else
       m_ui.developer->setText(tr("Unknown"));
 
@@ -232,26 +238,78 @@ void GameSummaryWidget::onComputeHashClicked()
   std::vector<CDImageHasher::Hash> track_hashes;
   track_hashes.reserve(image->GetTrackCount());
 
-  // Calculate hashes
-  bool calculate_hash_success = true;
-  for (u8 track = 1; track <= image->GetTrackCount(); track++)
+  // Hashing a multi-gigabyte image takes a while, so remember the result keyed on the file
+  // identity; re-verifying an unchanged image then only reads the cache.
+  INISettingsInterface hash_cache(Path::Combine(EmuFolders::Cache, "track_hashes.ini"));
+  hash_cache.Load();
+
+  FILESYSTEM_STAT_DATA sd = {};
+  std::string file_size_str;
+  std::string file_mtime_str;
+  if (FileSystem::StatFile(m_path.c_str(), &sd))
   {
-    progress_callback.SetProgressValue(track - 1);
-    progress_callback.PushState();
+    file_size_str = fmt::format("{}", sd.Size);
+    file_mtime_str = fmt::format("{}", static_cast<s64>(sd.ModificationTime));
+  }
 
-    CDImageHasher::Hash hash;
-    if (!CDImageHasher::GetTrackHash(image.get(), track, &hash, &progress_callback))
+  bool calculate_hash_success =
+    (!file_size_str.empty() && hash_cache.GetStringValue(m_path.c_str(), "Size") == file_size_str &&
+     hash_cache.GetStringValue(m_path.c_str(), "ModificationTime") == file_mtime_str &&
+     hash_cache.GetUIntValue(m_path.c_str(), "TrackCount", 0u) == image->GetTrackCount());
+  if (calculate_hash_success)
+  {
+    for (u8 track = 1; track <= image->GetTrackCount(); track++)
     {
-      progress_callback.PopState();
-      calculate_hash_success = false;
-      break;
+      const std::optional<CDImageHasher::Hash> hash = CDImageHasher::HashFromString(
+        hash_cache.GetStringValue(m_path.c_str(), fmt::format("Track{}", track).c_str()));
+      if (!hash.has_value())
+      {
+        calculate_hash_success = false;
+        track_hashes.clear();
+        break;
+      }
+
+      track_hashes.push_back(hash.value());
+      m_ui.tracks->item(track - 1, 4)->setText(QString::fromStdString(CDImageHasher::HashToString(hash.value())));
     }
-    track_hashes.emplace_back(hash);
+  }
 
-    QTableWidgetItem* item = m_ui.tracks->item(track - 1, 4);
-    item->setText(QString::fromStdString(CDImageHasher::HashToString(hash)));
+  if (!calculate_hash_success)
+  {
+    // Calculate hashes
+    calculate_hash_success = true;
+    for (u8 track = 1; track <= image->GetTrackCount(); track++)
+    {
+      progress_callback.SetProgressValue(track - 1);
+      progress_callback.PushState();
 
-    progress_callback.PopState();
+      CDImageHasher::Hash hash;
+      if (!CDImageHasher::GetTrackHash(image.get(), track, &hash, &progress_callback))
+      {
+        progress_callback.PopState();
+        calculate_hash_success = false;
+        break;
+      }
+      track_hashes.emplace_back(hash);
+
+      QTableWidgetItem* item = m_ui.tracks->item(track - 1, 4);
+      item->setText(QString::fromStdString(CDImageHasher::HashToString(hash)));
+
+      progress_callback.PopState();
+    }
+
+    if (calculate_hash_success && !file_size_str.empty())
+    {
+      hash_cache.SetStringValue(m_path.c_str(), "Size", file_size_str.c_str());
+      hash_cache.SetStringValue(m_path.c_str(), "ModificationTime", file_mtime_str.c_str());
+      hash_cache.SetUIntValue(m_path.c_str(), "TrackCount", image->GetTrackCount());
+      for (u8 track = 1; track <= image->GetTrackCount(); track++)
+      {
+        hash_cache.SetStringValue(m_path.c_str(), fmt::format("Track{}", track).c_str(),
+                                  CDImageHasher::HashToString(track_hashes[track - 1]).c_str());
+      }
+      hash_cache.Save();
+    }
   }
 
   // Verify hashes against gamedb
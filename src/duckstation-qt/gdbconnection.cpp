@@ -24,6 +24,9 @@ GDBConnection::GDBConnection(GDBServer* parent, intptr_t descriptor) : QTcpSocke
 
   Log_InfoPrintf("(%" PRIdPTR ") Client connected", m_descriptor);
 
+  // A fresh connection starts in ack mode with all-stop semantics until renegotiated.
+  GDBProtocol::Reset();
+
   m_seen_resume = System::IsPaused();
   g_emu_thread->setSystemPaused(true);
 }
@@ -60,6 +63,14 @@ void GDBConnection::receivedData()
       else if (GDBProtocol::IsPacketComplete(m_readBuffer))
       {
         Log_DebugPrintf("(%" PRIdPTR ") > %s", m_descriptor, m_readBuffer.c_str());
+
+        // vCont resume/suspend involves the emulation thread, which the protocol handler can't
+        // touch; forward it before generating the reply.
+        if (GDBProtocol::IsPacketVContResume(m_readBuffer))
+          g_emu_thread->setSystemPaused(false);
+        else if (GDBProtocol::IsPacketVContSuspend(m_readBuffer))
+          g_emu_thread->setSystemPaused(true);
+
         writePacket(GDBProtocol::ProcessPacket(m_readBuffer));
         m_readBuffer.erase();
       }
@@ -77,8 +88,16 @@ void GDBConnection::onEmulationPaused()
   if (m_seen_resume)
   {
     m_seen_resume = false;
-    // Generate a stop reply packet, insert '?' command to generate it.
-    writePacket(GDBProtocol::ProcessPacket("$?#3f"));
+    if (GDBProtocol::IsNonStopMode())
+    {
+      // Asynchronous stop notification; GDB drains the stopped-thread list with vStopped.
+      writePacket(GDBProtocol::CreateStopNotification());
+    }
+    else
+    {
+      // Generate a stop reply packet, insert '?' command to generate it.
+      writePacket(GDBProtocol::ProcessPacket("$?#3f"));
+    }
   }
 }
 
@@ -86,11 +105,16 @@ void GDBConnection::onEmulationResumed()
 {
   m_seen_resume = true;
   // Send ack, in case GDB sent a continue request.
-  writePacket("+");
+  if (!GDBProtocol::IsNoAckMode())
+    writePacket("+");
 }
 
 void GDBConnection::writePacket(std::string_view packet)
 {
+  // No-ack mode replies to unhandled input with nothing at all.
+  if (packet.empty())
+    return;
+
   Log_DebugPrintf("(%" PRIdPTR ") < %.*s", m_descriptor, static_cast<int>(packet.length()), packet.data());
   if (write(packet.data(), packet.length()) == -1)
   {
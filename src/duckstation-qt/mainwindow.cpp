@@ -2122,6 +2122,8 @@ void MainWindow::connectSignals()
                                                false);
   SettingWidgetBinder::BindWidgetToBoolSetting(nullptr, m_ui.actionDebugShowMDECState, "Debug", "ShowMDECState", false);
   SettingWidgetBinder::BindWidgetToBoolSetting(nullptr, m_ui.actionDebugShowDMAState, "Debug", "ShowDMAState", false);
+  SettingWidgetBinder::BindWidgetToBoolSetting(nullptr, m_ui.actionDebugShowCodeCacheState, "Debug",
+                                               "ShowCodeCacheState", false);
 
   for (u32 i = 0; GeneralSettingsWidget::THEME_NAMES[i]; i++)
   {
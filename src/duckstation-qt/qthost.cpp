@@ -1352,8 +1352,9 @@ void EmuThread::run()
       System::Internal::IdlePollUpdate();
       if (g_gpu_device)
       {
-        System::PresentDisplay(false);
-        if (!g_gpu_device->IsVsyncEnabled())
+        // A skipped (unchanged) present doesn't block on vsync, so throttle manually in that case.
+        const bool presented = System::PresentDisplay(false);
+        if (!presented || !g_gpu_device->IsVsyncEnabled())
           g_gpu_device->ThrottlePresentation();
       }
     }
@@ -1593,9 +1594,20 @@ void QtHost::SaveSettings()
   AssertMsg(!g_emu_thread->isOnThread(), "Saving should happen on the UI thread.");
 
   {
+    // Serialize the INI under the lock, but do the disk write with it released, so that a slow write
+    // doesn't stall the emulation thread's settings reads mid-frame.
+    std::string settings_data;
     auto lock = Host::GetSettingsLock();
-    if (!s_base_settings_interface->Save())
+    if (s_base_settings_interface->SaveToString(&settings_data))
+    {
+      lock.unlock();
+      if (!INISettingsInterface::WriteSerializedToFile(s_base_settings_interface->GetFileName(), settings_data))
+        Log_ErrorPrintf("Failed to save settings.");
+    }
+    else
+    {
       Log_ErrorPrintf("Failed to save settings.");
+    }
   }
 
   s_settings_save_timer->deleteLater();
@@ -2103,6 +2115,7 @@ shutdown_and_exit:
   }
 
   // Ensure log is flushed.
+  Log::SetAsyncOutputParams(false);
   Log::SetFileOutputParams(false, nullptr);
 
   return result;
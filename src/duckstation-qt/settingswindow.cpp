@@ -506,7 +506,7 @@ void SettingsWindow::openGamePropertiesDialog(const std::string& path, const std
     }
   }
 
-  const std::string& real_serial = dentry ? dentry->serial : serial;
+  const std::string real_serial(dentry ? std::string_view(dentry->serial) : std::string_view(serial));
   std::string ini_filename = System::GetGameSettingsPath(real_serial);
   std::unique_ptr<INISettingsInterface> sif = std::make_unique<INISettingsInterface>(std::move(ini_filename));
   if (FileSystem::FileExists(sif->GetFileName().c_str()))
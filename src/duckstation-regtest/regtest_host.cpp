@@ -2,10 +2,14 @@
 // SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
 
 #include "core/achievements.h"
+#include "core/cpu_code_cache.h"
 #include "core/game_list.h"
 #include "core/gpu.h"
 #include "core/host.h"
+#include "core/input_replay.h"
+#include "core/performance_profiler.h"
 #include "core/system.h"
+#include "core/timing_event.h"
 
 #include "scmversion/scmversion.h"
 
@@ -21,9 +25,27 @@
 #include "common/memory_settings_interface.h"
 #include "common/path.h"
 #include "common/string_util.h"
+#include "common/timer.h"
 
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cinttypes>
 #include <csignal>
 #include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+#define POPEN _popen
+#define PCLOSE _pclose
+#else
+#define POPEN popen
+#define PCLOSE pclose
+#endif
 
 Log_SetChannel(RegTestHost);
 
@@ -36,6 +58,10 @@ static void InitializeEarlyConsole();
 static void HookSignals();
 static bool SetFolders();
 static std::string GetFrameDumpFilename(u32 frame);
+static void UpdateBenchmarkStats();
+static bool WriteBenchmarkResults();
+static bool RunGPUTraceReplay();
+static bool RunBatchMode(const char* progname);
 } // namespace RegTestHost
 
 static std::unique_ptr<MemorySettingsInterface> s_base_settings_interface;
@@ -44,6 +70,28 @@ static u32 s_frames_to_run = 60 * 60;
 static u32 s_frame_dump_interval = 0;
 static std::string s_dump_base_directory;
 static std::string s_dump_game_directory;
+static std::string s_input_record_path;
+static std::string s_input_replay_path;
+static std::string s_gpu_trace_record_path;
+static std::string s_gpu_trace_replay_path;
+static std::string s_renderer_name;
+static u32 s_frame_hash_interval = 0;
+static std::vector<std::pair<u32, u64>> s_frame_hashes;
+static u64 s_final_vram_hash = 0;
+
+static std::string s_batch_manifest_path;
+static std::string s_batch_output;
+static u32 s_batch_parallelism = 0;
+
+static bool s_benchmark_mode = false;
+static std::string s_benchmark_output;
+static std::string s_benchmark_game_serial;
+static std::string s_benchmark_game_title;
+static Common::Timer::Value s_benchmark_last_frame_time = 0;
+static u32 s_benchmark_last_tick_count = 0;
+static u64 s_benchmark_guest_ticks = 0;
+static std::vector<float> s_benchmark_frame_times_ms;
+static std::array<double, static_cast<size_t>(PerformanceProfiler::Event::Count)> s_benchmark_event_totals_ms = {};
 
 bool RegTestHost::SetFolders()
 {
@@ -254,6 +302,9 @@ void Host::OnGameChanged(const std::string& disc_path, const std::string& game_s
   Log_InfoPrintf("Game Serial: %s", game_serial.c_str());
   Log_InfoPrintf("Game Name: %s", game_name.c_str());
 
+  s_benchmark_game_serial = game_serial;
+  s_benchmark_game_title = game_name;
+
   if (!s_dump_base_directory.empty())
   {
     s_dump_game_directory = Path::Combine(s_dump_base_directory, game_name);
@@ -270,9 +321,326 @@ void Host::OnGameChanged(const std::string& disc_path, const std::string& game_s
 
 void Host::PumpMessagesOnCPUThread()
 {
+  if (s_benchmark_mode)
+    RegTestHost::UpdateBenchmarkStats();
+
+  if (s_frame_hash_interval > 0)
+  {
+    const u32 frame = System::GetFrameNumber();
+    if ((frame % s_frame_hash_interval) == 0)
+      s_frame_hashes.emplace_back(frame, g_gpu->HashVRAM());
+  }
+
   s_frames_to_run--;
   if (s_frames_to_run == 0)
+  {
+    if (s_frame_hash_interval > 0)
+      s_final_vram_hash = g_gpu->HashVRAM();
+
     System::ShutdownSystem(false);
+  }
+}
+
+void RegTestHost::UpdateBenchmarkStats()
+{
+  const Common::Timer::Value now = Common::Timer::GetCurrentValue();
+  const u32 ticks = TimingEvents::GetGlobalTickCounter();
+
+  // Skip the first frame, since it includes boot/state load time.
+  if (s_benchmark_last_frame_time != 0)
+  {
+    s_benchmark_frame_times_ms.push_back(
+      static_cast<float>(Common::Timer::ConvertValueToMilliseconds(now - s_benchmark_last_frame_time)));
+    s_benchmark_guest_ticks += ticks - s_benchmark_last_tick_count;
+
+    for (size_t i = 0; i < s_benchmark_event_totals_ms.size(); i++)
+    {
+      s_benchmark_event_totals_ms[i] +=
+        PerformanceProfiler::GetEventStats(static_cast<PerformanceProfiler::Event>(i)).last_ms;
+    }
+  }
+
+  s_benchmark_last_frame_time = now;
+  s_benchmark_last_tick_count = ticks;
+}
+
+bool RegTestHost::WriteBenchmarkResults()
+{
+  const size_t num_frames = s_benchmark_frame_times_ms.size();
+  if (num_frames == 0)
+  {
+    Log_ErrorPrint("No frames were timed, not writing benchmark results.");
+    return false;
+  }
+
+  std::vector<float> sorted_times(s_benchmark_frame_times_ms);
+  std::sort(sorted_times.begin(), sorted_times.end());
+
+  const auto percentile = [&sorted_times](double p) {
+    return sorted_times[static_cast<size_t>(p * static_cast<double>(sorted_times.size() - 1))];
+  };
+
+  double total_time_ms = 0.0;
+  for (const float ft : s_benchmark_frame_times_ms)
+    total_time_ms += ft;
+
+  const double wall_seconds = total_time_ms / 1000.0;
+
+  std::string json;
+  fmt::format_to(std::back_inserter(json),
+                 "{{\n"
+                 "  \"game_serial\": \"{}\",\n"
+                 "  \"game_title\": \"{}\",\n"
+                 "  \"frames\": {},\n"
+                 "  \"wall_time_seconds\": {:.3f},\n"
+                 "  \"frames_per_second\": {:.2f},\n"
+                 "  \"guest_cycles\": {},\n"
+                 "  \"guest_cycles_per_second\": {:.0f},\n"
+                 "  \"blocks_compiled\": {},\n"
+                 "  \"frame_time_ms\": {{\n"
+                 "    \"mean\": {:.4f},\n"
+                 "    \"min\": {:.4f},\n"
+                 "    \"max\": {:.4f},\n"
+                 "    \"p50\": {:.4f},\n"
+                 "    \"p90\": {:.4f},\n"
+                 "    \"p95\": {:.4f},\n"
+                 "    \"p99\": {:.4f}\n"
+                 "  }},\n"
+                 "  \"subsystem_time_ms\": {{\n",
+                 s_benchmark_game_serial, s_benchmark_game_title, num_frames, wall_seconds,
+                 static_cast<double>(num_frames) / wall_seconds, s_benchmark_guest_ticks,
+                 static_cast<double>(s_benchmark_guest_ticks) / wall_seconds, CPU::CodeCache::GetTotalBlocksCompiled(),
+                 total_time_ms / static_cast<double>(num_frames), sorted_times.front(), sorted_times.back(),
+                 percentile(0.5), percentile(0.9), percentile(0.95), percentile(0.99));
+
+  for (size_t i = 0; i < s_benchmark_event_totals_ms.size(); i++)
+  {
+    fmt::format_to(std::back_inserter(json), "    \"{}\": {{ \"total\": {:.3f}, \"mean\": {:.4f} }}{}\n",
+                   PerformanceProfiler::GetEventName(static_cast<PerformanceProfiler::Event>(i)),
+                   s_benchmark_event_totals_ms[i], s_benchmark_event_totals_ms[i] / static_cast<double>(num_frames),
+                   (i == (s_benchmark_event_totals_ms.size() - 1)) ? "" : ",");
+  }
+
+  json.append("  }");
+
+  if (!s_frame_hashes.empty())
+  {
+    json.append(",\n  \"frame_hashes\": [\n");
+    for (size_t i = 0; i < s_frame_hashes.size(); i++)
+    {
+      fmt::format_to(std::back_inserter(json), "    {{ \"frame\": {}, \"hash\": \"{:016x}\" }}{}\n",
+                     s_frame_hashes[i].first, s_frame_hashes[i].second,
+                     (i == (s_frame_hashes.size() - 1)) ? "" : ",");
+    }
+    fmt::format_to(std::back_inserter(json), "  ],\n  \"final_vram_hash\": \"{:016x}\"", s_final_vram_hash);
+  }
+
+  json.append("\n}\n");
+
+  if (s_benchmark_output.empty() || s_benchmark_output == "-")
+  {
+    std::fputs(json.c_str(), stdout);
+    return true;
+  }
+
+  if (!FileSystem::WriteStringToFile(s_benchmark_output.c_str(), json))
+  {
+    Log_ErrorPrintf("Failed to write benchmark results to '%s'.", s_benchmark_output.c_str());
+    return false;
+  }
+
+  Log_InfoPrintf("Wrote benchmark results to '%s'.", s_benchmark_output.c_str());
+  return true;
+}
+
+bool RegTestHost::RunGPUTraceReplay()
+{
+  std::vector<float> frame_times_ms;
+  if (!g_gpu->ReplayTrace(s_gpu_trace_replay_path.c_str(), &frame_times_ms))
+    return false;
+
+  const size_t num_frames = frame_times_ms.size();
+  if (num_frames == 0)
+  {
+    Log_ErrorPrint("Trace contained no frames, not writing replay results.");
+    return false;
+  }
+
+  std::vector<float> sorted_times(frame_times_ms);
+  std::sort(sorted_times.begin(), sorted_times.end());
+
+  const auto percentile = [&sorted_times](double p) {
+    return sorted_times[static_cast<size_t>(p * static_cast<double>(sorted_times.size() - 1))];
+  };
+
+  double total_time_ms = 0.0;
+  for (const float ft : frame_times_ms)
+    total_time_ms += ft;
+
+  std::printf("gpu_replay: %zu frames in %.3f seconds (%.2f FPS)\n", num_frames, total_time_ms / 1000.0,
+              static_cast<double>(num_frames) / (total_time_ms / 1000.0));
+  std::printf("gpu_replay: frame_time_ms mean=%.4f min=%.4f max=%.4f p50=%.4f p90=%.4f p95=%.4f p99=%.4f\n",
+              total_time_ms / static_cast<double>(num_frames), sorted_times.front(), sorted_times.back(),
+              percentile(0.5), percentile(0.9), percentile(0.95), percentile(0.99));
+  return true;
+}
+
+bool RegTestHost::RunBatchMode(const char* progname)
+{
+  struct BatchEntry
+  {
+    std::string path;
+    u32 frames;
+    std::string save_state;
+    int exit_code = -1;
+    std::string report;
+  };
+
+  std::optional<std::string> manifest = FileSystem::ReadFileToString(s_batch_manifest_path.c_str());
+  if (!manifest.has_value())
+  {
+    Log_ErrorPrintf("Failed to read batch manifest '%s'.", s_batch_manifest_path.c_str());
+    return false;
+  }
+
+  // One entry per line: image<TAB>frames[<TAB>savestate]. Blank lines and # comments are skipped.
+  std::vector<BatchEntry> entries;
+  for (const std::string_view& line : StringUtil::SplitString(*manifest, '\n'))
+  {
+    const std::string_view trimmed = StringUtil::StripWhitespace(line);
+    if (trimmed.empty() || trimmed[0] == '#')
+      continue;
+
+    const std::vector<std::string_view> fields = StringUtil::SplitString(trimmed, '\t');
+    if (fields.size() < 2)
+    {
+      Log_ErrorPrintf("Malformed manifest line: '%.*s'", static_cast<int>(trimmed.size()), trimmed.data());
+      return false;
+    }
+
+    const std::optional<u32> frames = StringUtil::FromChars<u32>(fields[1]);
+    if (!frames.has_value() || frames.value() == 0)
+    {
+      Log_ErrorPrintf("Invalid frame count in manifest line: '%.*s'", static_cast<int>(trimmed.size()),
+                      trimmed.data());
+      return false;
+    }
+
+    BatchEntry& entry = entries.emplace_back();
+    entry.path = fields[0];
+    entry.frames = frames.value();
+    if (fields.size() >= 3)
+      entry.save_state = fields[2];
+  }
+
+  if (entries.empty())
+  {
+    Log_ErrorPrintf("Batch manifest '%s' contains no entries.", s_batch_manifest_path.c_str());
+    return false;
+  }
+
+  const u32 num_workers =
+    std::min(static_cast<u32>(entries.size()),
+             (s_batch_parallelism > 0) ? s_batch_parallelism : std::max(std::thread::hardware_concurrency(), 1u));
+  Log_InfoPrintf("Running %zu titles across %u processes...", entries.size(), num_workers);
+
+  // Each child is a normal single-title invocation of ourselves, writing its benchmark report to a
+  // temporary file which the parent merges afterwards. The core is single-instance, so fan-out has
+  // to happen at process granularity.
+  std::atomic<size_t> next_entry{0};
+  const auto worker = [&entries, &next_entry, progname]() {
+    for (;;)
+    {
+      const size_t index = next_entry.fetch_add(1);
+      if (index >= entries.size())
+        break;
+
+      BatchEntry& entry = entries[index];
+      const std::string report_path = fmt::format("{}.result{}.tmp", s_batch_manifest_path, index);
+
+      std::string command = fmt::format("\"{}\" -frames {} -benchmark \"{}\"", progname, entry.frames, report_path);
+      if (!entry.save_state.empty())
+        fmt::format_to(std::back_inserter(command), " -savestate \"{}\"", entry.save_state);
+      if (!s_renderer_name.empty())
+        fmt::format_to(std::back_inserter(command), " -renderer {}", s_renderer_name);
+      if (s_frame_hash_interval > 0)
+        fmt::format_to(std::back_inserter(command), " -framehashinterval {}", s_frame_hash_interval);
+      fmt::format_to(std::back_inserter(command), " -- \"{}\" 2>&1", entry.path);
+
+      std::FILE* pipe = POPEN(command.c_str(), "r");
+      if (!pipe)
+      {
+        Log_ErrorPrintf("Failed to spawn child for '%s'.", entry.path.c_str());
+        continue;
+      }
+
+      // Drain child output so it can't block on a full pipe; we only keep the report file.
+      char buffer[512];
+      while (std::fgets(buffer, sizeof(buffer), pipe))
+        ;
+
+      entry.exit_code = PCLOSE(pipe);
+
+      std::optional<std::string> report = FileSystem::ReadFileToString(report_path.c_str());
+      if (report.has_value())
+      {
+        entry.report = std::move(report.value());
+        FileSystem::DeleteFile(report_path.c_str());
+      }
+
+      Log_InfoPrintf("[%zu/%zu] '%s' exited with code %d.", index + 1, entries.size(), entry.path.c_str(),
+                     entry.exit_code);
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(num_workers);
+  for (u32 i = 0; i < num_workers; i++)
+    threads.emplace_back(worker);
+  for (std::thread& thread : threads)
+    thread.join();
+
+  const auto escape = [](const std::string& str) {
+    std::string ret;
+    ret.reserve(str.size());
+    for (const char ch : str)
+    {
+      if (ch == '\\' || ch == '"')
+        ret.push_back('\\');
+      ret.push_back(ch);
+    }
+    return ret;
+  };
+
+  std::string json = "{\n  \"results\": [\n";
+  bool all_succeeded = true;
+  for (size_t i = 0; i < entries.size(); i++)
+  {
+    const BatchEntry& entry = entries[i];
+    all_succeeded &= (entry.exit_code == 0 && !entry.report.empty());
+
+    fmt::format_to(std::back_inserter(json), "    {{ \"path\": \"{}\", \"exit_code\": {}, \"report\": {} }}{}\n",
+                   escape(entry.path), entry.exit_code,
+                   entry.report.empty() ? std::string("null") : std::string(StringUtil::StripWhitespace(entry.report)),
+                   (i == (entries.size() - 1)) ? "" : ",");
+  }
+  json.append("  ]\n}\n");
+
+  if (s_batch_output.empty() || s_batch_output == "-")
+  {
+    std::fputs(json.c_str(), stdout);
+  }
+  else if (!FileSystem::WriteStringToFile(s_batch_output.c_str(), json))
+  {
+    Log_ErrorPrintf("Failed to write batch results to '%s'.", s_batch_output.c_str());
+    return false;
+  }
+  else
+  {
+    Log_InfoPrintf("Wrote batch results to '%s'.", s_batch_output.c_str());
+  }
+
+  return all_succeeded;
 }
 
 void Host::RunOnCPUThread(std::function<void()> function, bool block /* = false */)
@@ -324,7 +692,7 @@ void Host::BeginPresentFrame()
   if (s_frame_dump_interval > 0 && (s_frame_dump_interval == 1 || (frame % s_frame_dump_interval) == 0))
   {
     std::string dump_filename(RegTestHost::GetFrameDumpFilename(frame));
-    g_gpu->WriteDisplayTextureToFile(std::move(dump_filename));
+    g_gpu->QueueDisplayCapture(std::move(dump_filename));
   }
 }
 
@@ -455,6 +823,29 @@ void RegTestHost::PrintCommandLineHelp(const char* progname)
   std::fprintf(stderr, "  -dumpdir: Set frame dump base directory (will be dumped to basedir/gametitle).\n");
   std::fprintf(stderr, "  -dumpinterval: Dumps every N frames.\n");
   std::fprintf(stderr, "  -frames: Sets the number of frames to execute.\n");
+  std::fprintf(stderr, "  -benchmark <file>: Runs as fast as possible and writes machine-readable timing\n"
+                       "    results (ms/frame percentiles, guest cycles/sec, per-subsystem times) to the\n"
+                       "    specified JSON file, or stdout if '-' is given.\n");
+  std::fprintf(stderr, "  -inputrecord <file>: Records pad input and periodic RAM hashes to the\n"
+                       "    specified file for later replay.\n");
+  std::fprintf(stderr, "  -inputreplay <file>: Replays a previously-recorded input file, verifying\n"
+                       "    determinism against the embedded RAM hashes.\n");
+  std::fprintf(stderr, "  -gputrace <file>: Records all GP0/GP1 commands to the specified trace file\n"
+                       "    for later replay against any renderer.\n");
+  std::fprintf(stderr, "  -gpureplay <file>: Replays a previously-recorded GPU trace at uncapped\n"
+                       "    speed instead of executing the game, and prints per-frame timing. Combine\n"
+                       "    with -renderer to benchmark different backends with the same workload.\n");
+  std::fprintf(stderr, "  -framehashinterval <n>: Hashes VRAM every N frames, plus once at exit. Hashes\n"
+                       "    are included in the -benchmark report, or printed to stdout otherwise.\n");
+  std::fprintf(stderr, "  -batch <manifest>: Runs every title in the manifest instead of booting a\n"
+                       "    single image. Each line is image<TAB>frames[<TAB>savestate]. Titles are\n"
+                       "    fanned out across child processes and the per-title benchmark reports are\n"
+                       "    merged into one JSON document.\n");
+  std::fprintf(stderr, "  -batchoutput <file>: Writes the merged batch report to the specified file,\n"
+                       "    or stdout if '-' or unspecified.\n");
+  std::fprintf(stderr, "  -parallel <n>: Sets the number of concurrent batch processes. Defaults to\n"
+                       "    the host core count.\n");
+  std::fprintf(stderr, "  -savestate <file>: Loads the specified save state after booting.\n");
   std::fprintf(stderr, "  -log <level>: Sets the log level. Defaults to verbose.\n");
   std::fprintf(stderr, "  -renderer <renderer>: Sets the graphics renderer. Default to software.\n");
   std::fprintf(stderr, "  --: Signals that no more arguments will follow and the remaining\n"
@@ -524,6 +915,69 @@ bool RegTestHost::ParseCommandLineParameters(int argc, char* argv[], std::option
 
         continue;
       }
+      else if (CHECK_ARG_PARAM("-benchmark"))
+      {
+        s_benchmark_mode = true;
+        s_benchmark_output = argv[++i];
+        continue;
+      }
+      else if (CHECK_ARG_PARAM("-inputrecord"))
+      {
+        s_input_record_path = argv[++i];
+        continue;
+      }
+      else if (CHECK_ARG_PARAM("-inputreplay"))
+      {
+        s_input_replay_path = argv[++i];
+        continue;
+      }
+      else if (CHECK_ARG_PARAM("-gputrace"))
+      {
+        s_gpu_trace_record_path = argv[++i];
+        continue;
+      }
+      else if (CHECK_ARG_PARAM("-gpureplay"))
+      {
+        s_gpu_trace_replay_path = argv[++i];
+        continue;
+      }
+      else if (CHECK_ARG_PARAM("-framehashinterval"))
+      {
+        s_frame_hash_interval = StringUtil::FromChars<u32>(argv[++i]).value_or(0);
+        if (s_frame_hash_interval == 0)
+        {
+          Log_ErrorPrintf("Invalid frame hash interval specified: %s", argv[i]);
+          return false;
+        }
+
+        continue;
+      }
+      else if (CHECK_ARG_PARAM("-batch"))
+      {
+        s_batch_manifest_path = argv[++i];
+        continue;
+      }
+      else if (CHECK_ARG_PARAM("-batchoutput"))
+      {
+        s_batch_output = argv[++i];
+        continue;
+      }
+      else if (CHECK_ARG_PARAM("-parallel"))
+      {
+        s_batch_parallelism = StringUtil::FromChars<u32>(argv[++i]).value_or(0);
+        if (s_batch_parallelism == 0)
+        {
+          Log_ErrorPrintf("Invalid parallelism specified: %s", argv[i]);
+          return false;
+        }
+
+        continue;
+      }
+      else if (CHECK_ARG_PARAM("-savestate"))
+      {
+        AutoBoot(autoboot)->save_state = argv[++i];
+        continue;
+      }
       else if (CHECK_ARG_PARAM("-log"))
       {
         std::optional<LOGLEVEL> level = Settings::ParseLogLevelName(argv[++i]);
@@ -546,7 +1000,8 @@ bool RegTestHost::ParseCommandLineParameters(int argc, char* argv[], std::option
           return false;
         }
 
-        s_base_settings_interface->SetStringValue("GPU", "Renderer", Settings::GetRendererName(renderer.value()));
+        s_renderer_name = Settings::GetRendererName(renderer.value());
+        s_base_settings_interface->SetStringValue("GPU", "Renderer", s_renderer_name.c_str());
         continue;
       }
       else if (CHECK_ARG("--"))
@@ -588,6 +1043,10 @@ int main(int argc, char* argv[])
   if (!RegTestHost::ParseCommandLineParameters(argc, argv, autoboot))
     return EXIT_FAILURE;
 
+  // Batch mode never boots in this process; it only dispatches children and merges their reports.
+  if (!s_batch_manifest_path.empty())
+    return RegTestHost::RunBatchMode(argv[0]) ? 0 : EXIT_FAILURE;
+
   if (!autoboot || autoboot->filename.empty())
   {
     Log_ErrorPrintf("No boot path specified.");
@@ -616,8 +1075,37 @@ int main(int argc, char* argv[])
     Log_InfoPrintf("Dumping every %dth frame to '%s'.", s_frame_dump_interval, s_dump_base_directory.c_str());
   }
 
-  Log_InfoPrintf("Running for %d frames...", s_frames_to_run);
-  System::Execute();
+  if (!s_input_record_path.empty() && !InputReplay::StartRecording(s_input_record_path.c_str()))
+    goto cleanup;
+  if (!s_input_replay_path.empty() && !InputReplay::StartPlayback(s_input_replay_path.c_str()))
+    goto cleanup;
+
+  if (!s_gpu_trace_record_path.empty() && !g_gpu->StartTraceRecording(s_gpu_trace_record_path.c_str()))
+    goto cleanup;
+
+  if (!s_gpu_trace_replay_path.empty())
+  {
+    if (!RegTestHost::RunGPUTraceReplay())
+      goto cleanup;
+  }
+  else
+  {
+    if (s_benchmark_mode)
+      s_benchmark_frame_times_ms.reserve(s_frames_to_run);
+
+    Log_InfoPrintf("Running for %d frames...", s_frames_to_run);
+    System::Execute();
+
+    if (s_benchmark_mode && !RegTestHost::WriteBenchmarkResults())
+      goto cleanup;
+
+    if (!s_benchmark_mode && !s_frame_hashes.empty())
+    {
+      for (const auto& [frame, hash] : s_frame_hashes)
+        std::printf("frame_hash: %u %016" PRIx64 "\n", frame, hash);
+      std::printf("final_vram_hash: %016" PRIx64 "\n", s_final_vram_hash);
+    }
+  }
 
   Log_InfoPrintf("Exiting with success.");
   result = 0;
@@ -30,6 +30,15 @@ AudioStream::~AudioStream()
   DestroyBuffer();
 }
 
+static AudioStream::FrameTap s_frame_tap = nullptr;
+static void* s_frame_tap_userdata = nullptr;
+
+void AudioStream::SetFrameTap(FrameTap tap, void* userdata)
+{
+  s_frame_tap = tap;
+  s_frame_tap_userdata = userdata;
+}
+
 std::unique_ptr<AudioStream> AudioStream::CreateNullStream(u32 sample_rate, u32 channels, u32 buffer_ms)
 {
   std::unique_ptr<AudioStream> stream(new AudioStream(sample_rate, channels, buffer_ms, AudioStretchMode::Off));
@@ -54,10 +63,11 @@ u32 AudioStream::GetMSForBufferSize(u32 sample_rate, u32 buffer_size)
   return (buffer_size * 1000u) / sample_rate;
 }
 
-static constexpr const std::array s_stretch_mode_names = {"None", "Resample", "TimeStretch"};
+static constexpr const std::array s_stretch_mode_names = {"None", "Resample", "TimeStretch", "PolyphaseResample"};
 static constexpr const std::array s_stretch_mode_display_names = {TRANSLATE_NOOP("AudioStream", "None"),
                                                                   TRANSLATE_NOOP("AudioStream", "Resampling"),
-                                                                  TRANSLATE_NOOP("AudioStream", "Time Stretching")};
+                                                                  TRANSLATE_NOOP("AudioStream", "Time Stretching"),
+                                                                  TRANSLATE_NOOP("AudioStream", "Polyphase Resampling")};
 
 const char* AudioStream::GetStretchModeName(AudioStretchMode mode)
 {
@@ -92,6 +102,25 @@ u32 AudioStream::GetBufferedFramesRelaxed() const
 void AudioStream::ReadFrames(s16* bData, u32 nFrames)
 {
   const u32 available_frames = GetBufferedFramesRelaxed();
+
+  const u32 bucket = std::min((available_frames * NUM_OCCUPANCY_BUCKETS) / m_buffer_size, NUM_OCCUPANCY_BUCKETS - 1);
+  m_occupancy_histogram[bucket].fetch_add(1, std::memory_order_relaxed);
+
+  // Compare the interval since the last callback with the playback duration of the frames that
+  // callback consumed; on a well-behaved device the two match.
+  const u64 now = Common::Timer::GetCurrentValue();
+  if (m_last_callback_time != 0 && m_last_callback_frames > 0)
+  {
+    const float interval = static_cast<float>(Common::Timer::ConvertValueToMilliseconds(now - m_last_callback_time));
+    const float expected = (static_cast<float>(m_last_callback_frames) * 1000.0f) / static_cast<float>(m_sample_rate);
+    const float jitter = std::abs(interval - expected);
+    const float average = m_average_callback_jitter_ms.load(std::memory_order_relaxed);
+    m_average_callback_jitter_ms.store(average + ((jitter - average) / 32.0f), std::memory_order_relaxed);
+    if (jitter > m_maximum_callback_jitter_ms.load(std::memory_order_relaxed))
+      m_maximum_callback_jitter_ms.store(jitter, std::memory_order_relaxed);
+  }
+  m_last_callback_time = now;
+  m_last_callback_frames = nFrames;
   u32 frames_to_read = nFrames;
   u32 silence_frames = 0;
 
@@ -117,6 +146,7 @@ void AudioStream::ReadFrames(s16* bData, u32 nFrames)
     silence_frames = frames_to_read - available_frames;
     frames_to_read = available_frames;
     m_filling = true;
+    m_underrun_count.fetch_add(1, std::memory_order_relaxed);
 
     if (m_stretch_mode == AudioStretchMode::TimeStretch)
       StretchUnderrun();
@@ -147,10 +177,12 @@ void AudioStream::ReadFrames(s16* bData, u32 nFrames)
     }
 
     m_rpos.store(rpos, std::memory_order_release);
+    m_frames_read.fetch_add(frames_to_read, std::memory_order_relaxed);
   }
 
   if (silence_frames > 0)
   {
+    m_frames_silenced.fetch_add(silence_frames, std::memory_order_relaxed);
     if (frames_to_read > 0)
     {
       // super basic resampler - spread the input samples evenly across the output samples. will sound like ass and have
@@ -196,6 +228,8 @@ void AudioStream::InternalWriteFrames(s32* bData, u32 nSamples)
     else
     {
       Log_DebugPrintf("Buffer overrun, chunk dropped");
+      m_frames_dropped.fetch_add(nSamples, std::memory_order_relaxed);
+      m_overrun_count.fetch_add(1, std::memory_order_relaxed);
       return;
     }
   }
@@ -224,6 +258,7 @@ void AudioStream::InternalWriteFrames(s32* bData, u32 nSamples)
   }
 
   m_wpos.store(wpos, std::memory_order_release);
+  m_frames_written.fetch_add(nSamples, std::memory_order_relaxed);
 }
 
 void AudioStream::BaseInitialize()
@@ -239,6 +274,7 @@ void AudioStream::AllocateBuffer()
     (m_stretch_mode == AudioStretchMode::TimeStretch) ? 16 : ((m_stretch_mode == AudioStretchMode::Off) ? 1 : 2);
   m_buffer_size = GetAlignedBufferSize(((m_buffer_ms * multplier) * m_sample_rate) / 1000);
   m_target_buffer_size = GetAlignedBufferSize((m_sample_rate * m_buffer_ms) / 1000u);
+  m_base_target_buffer_size = m_target_buffer_size;
   m_buffer = std::unique_ptr<s32[]>(new s32[m_buffer_size]);
   Log_DevPrintf("Allocated buffer of %u frames for buffer of %u ms [stretch %s, target size %u].", m_buffer_size,
                 m_buffer_ms, GetStretchModeName(m_stretch_mode), m_target_buffer_size);
@@ -254,13 +290,19 @@ void AudioStream::DestroyBuffer()
 
 void AudioStream::EmptyBuffer()
 {
-  if (m_stretch_mode != AudioStretchMode::Off)
+  if (m_soundtouch)
   {
     m_soundtouch->clear();
     if (m_stretch_mode == AudioStretchMode::TimeStretch)
       m_soundtouch->setTempo(m_nominal_rate);
   }
 
+  if (m_polyphase_input)
+  {
+    std::memset(m_polyphase_input.get(), 0, sizeof(float) * (POLYPHASE_TAPS + static_cast<u32>(CHUNK_SIZE)) * 2);
+    m_polyphase_position = 0;
+  }
+
   m_wpos.store(m_rpos.load(std::memory_order_acquire), std::memory_order_release);
 }
 
@@ -336,6 +378,13 @@ void AudioStream::WriteFrames(const SampleType* frames, u32 num_frames)
 
 void AudioStream::EndWrite(u32 num_frames)
 {
+  // tap before the mute check, so out-of-process consumers still get audio when local output is off
+  if (s_frame_tap)
+  {
+    s_frame_tap(reinterpret_cast<const SampleType*>(&m_staging_buffer[m_staging_buffer_pos]), num_frames,
+                s_frame_tap_userdata);
+  }
+
   // don't bother committing anything when muted
   if (m_volume == 0)
     return;
@@ -347,7 +396,9 @@ void AudioStream::EndWrite(u32 num_frames)
 
   m_staging_buffer_pos = 0;
 
-  if (m_stretch_mode != AudioStretchMode::Off)
+  if (m_stretch_mode == AudioStretchMode::PolyphaseResample)
+    PolyphaseWrite();
+  else if (m_stretch_mode != AudioStretchMode::Off)
     StretchWrite();
   else
     InternalWriteFrames(m_staging_buffer.data(), CHUNK_SIZE);
@@ -498,6 +549,13 @@ void AudioStream::StretchAllocate()
   if (m_stretch_mode == AudioStretchMode::Off)
     return;
 
+  if (m_stretch_mode == AudioStretchMode::PolyphaseResample)
+  {
+    PolyphaseAllocate();
+    m_staging_buffer_pos = 0;
+    return;
+  }
+
   m_soundtouch = std::make_unique<soundtouch::SoundTouch>();
   m_soundtouch->setSampleRate(m_sample_rate);
   m_soundtouch->setChannels(m_channels);
@@ -527,6 +585,8 @@ void AudioStream::StretchAllocate()
 void AudioStream::StretchDestroy()
 {
   m_soundtouch.reset();
+  m_polyphase_filter.reset();
+  m_polyphase_input.reset();
 }
 
 void AudioStream::StretchWrite()
@@ -546,6 +606,112 @@ void AudioStream::StretchWrite()
     UpdateStretchTempo();
 }
 
+void AudioStream::PolyphaseAllocate()
+{
+  // Blackman-windowed sinc bank. The cutoff leaves enough transition-band headroom that the small
+  // rate swings from sync-to-host never need a rebuild, and each phase is normalized to unity gain.
+  static constexpr float CUTOFF = 0.85f;
+  static constexpr float PI = 3.14159265358979323846f;
+
+  m_polyphase_filter = std::make_unique<float[]>(POLYPHASE_PHASES * POLYPHASE_TAPS * 2);
+  m_polyphase_input = std::make_unique<float[]>((POLYPHASE_TAPS + static_cast<u32>(CHUNK_SIZE)) * 2);
+  std::memset(m_polyphase_input.get(), 0, sizeof(float) * (POLYPHASE_TAPS + static_cast<u32>(CHUNK_SIZE)) * 2);
+  m_polyphase_position = 0;
+
+  for (u32 phase = 0; phase < POLYPHASE_PHASES; phase++)
+  {
+    const float offset = static_cast<float>(phase) / static_cast<float>(POLYPHASE_PHASES);
+    float coefficients[POLYPHASE_TAPS];
+    float sum = 0.0f;
+    for (u32 tap = 0; tap < POLYPHASE_TAPS; tap++)
+    {
+      const float x = static_cast<float>(static_cast<s32>(tap) - static_cast<s32>((POLYPHASE_TAPS / 2) - 1)) - offset;
+      const float sinc = (x == 0.0f) ? CUTOFF : (std::sin(CUTOFF * PI * x) / (PI * x));
+      const float window_pos = (x + static_cast<float>(POLYPHASE_TAPS / 2)) / static_cast<float>(POLYPHASE_TAPS);
+      const float window =
+        0.42f - (0.5f * std::cos(2.0f * PI * window_pos)) + (0.08f * std::cos(4.0f * PI * window_pos));
+      coefficients[tap] = sinc * window;
+      sum += coefficients[tap];
+    }
+
+    // duplicate each coefficient so the kernel multiplies interleaved stereo directly
+    float* out = &m_polyphase_filter[phase * POLYPHASE_TAPS * 2];
+    for (u32 tap = 0; tap < POLYPHASE_TAPS; tap++)
+    {
+      const float c = coefficients[tap] / sum;
+      out[(tap * 2) + 0] = c;
+      out[(tap * 2) + 1] = c;
+    }
+  }
+}
+
+void AudioStream::PolyphaseWrite()
+{
+  // append the new chunk after the history frames carried over from the previous call
+  S16ChunkToFloat(m_staging_buffer.data(), &m_polyphase_input[POLYPHASE_TAPS * 2]);
+
+  const u64 step = std::max<u64>(static_cast<u64>(static_cast<double>(m_nominal_rate) * 4294967296.0), 1);
+  const float* input = m_polyphase_input.get();
+  alignas(16) std::array<s32, CHUNK_SIZE> output;
+  u32 output_pos = 0;
+
+  u64 position = m_polyphase_position;
+  while ((position >> 32) < CHUNK_SIZE)
+  {
+    const u32 index = static_cast<u32>(position >> 32);
+    const u32 phase = static_cast<u32>(position >> 24) & (POLYPHASE_PHASES - 1);
+    const float* in = &input[index * 2];
+    const float* coefficients = &m_polyphase_filter[phase * POLYPHASE_TAPS * 2];
+
+#if defined(CPU_ARCH_NEON)
+    float32x4_t acc = vmulq_f32(vld1q_f32(in), vld1q_f32(coefficients));
+    acc = vmlaq_f32(acc, vld1q_f32(in + 4), vld1q_f32(coefficients + 4));
+    acc = vmlaq_f32(acc, vld1q_f32(in + 8), vld1q_f32(coefficients + 8));
+    acc = vmlaq_f32(acc, vld1q_f32(in + 12), vld1q_f32(coefficients + 12));
+    float32x2_t sum = vadd_f32(vget_low_f32(acc), vget_high_f32(acc));
+    sum = vmul_f32(sum, vdup_n_f32(FLOAT_TO_S16));
+    const int32x2_t iv = vcvt_s32_f32(sum);
+    const int16x4_t sv = vqmovn_s32(vcombine_s32(iv, iv));
+    output[output_pos++] = vget_lane_s32(vreinterpret_s32_s16(sv), 0);
+#elif defined(CPU_ARCH_SSE)
+    __m128 acc = _mm_mul_ps(_mm_loadu_ps(in), _mm_load_ps(coefficients));
+    acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(in + 4), _mm_load_ps(coefficients + 4)));
+    acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(in + 8), _mm_load_ps(coefficients + 8)));
+    acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(in + 12), _mm_load_ps(coefficients + 12)));
+    acc = _mm_add_ps(acc, _mm_movehl_ps(acc, acc));
+    const __m128i iv = _mm_cvtps_epi32(_mm_mul_ps(acc, _mm_set1_ps(FLOAT_TO_S16)));
+    output[output_pos++] = _mm_cvtsi128_si32(_mm_packs_epi32(iv, iv));
+#else
+    float left = 0.0f;
+    float right = 0.0f;
+    for (u32 tap = 0; tap < POLYPHASE_TAPS; tap++)
+    {
+      left += in[(tap * 2) + 0] * coefficients[(tap * 2) + 0];
+      right += in[(tap * 2) + 1] * coefficients[(tap * 2) + 1];
+    }
+    const s16 ileft = static_cast<s16>(std::clamp(left * FLOAT_TO_S16, -32768.0f, 32767.0f));
+    const s16 iright = static_cast<s16>(std::clamp(right * FLOAT_TO_S16, -32768.0f, 32767.0f));
+    output[output_pos++] = (static_cast<u32>(ileft) & 0xFFFFu) | (static_cast<u32>(iright) << 16);
+#endif
+
+    if (output_pos == CHUNK_SIZE)
+    {
+      InternalWriteFrames(output.data(), CHUNK_SIZE);
+      output_pos = 0;
+    }
+
+    position += step;
+  }
+
+  m_polyphase_position = position - (static_cast<u64>(CHUNK_SIZE) << 32);
+
+  if (output_pos > 0)
+    InternalWriteFrames(output.data(), output_pos);
+
+  // carry the tail of the input window over as history for the next chunk
+  std::memcpy(&m_polyphase_input[0], &m_polyphase_input[CHUNK_SIZE * 2], sizeof(float) * POLYPHASE_TAPS * 2);
+}
+
 float AudioStream::AddAndGetAverageTempo(float val)
 {
   if (m_stretch_reset >= STRETCH_RESET_THRESHOLD)
@@ -567,8 +733,53 @@ float AudioStream::AddAndGetAverageTempo(float val)
   return (sum != 0.0f) ? sum : 1.0f;
 }
 
+void AudioStream::SetAdaptiveBufferSizing(bool enabled)
+{
+  if (m_adaptive_buffer_sizing == enabled)
+    return;
+
+  m_adaptive_buffer_sizing = enabled;
+  m_adaptive_update_counter = 0;
+  if (!enabled && m_base_target_buffer_size != 0)
+    m_target_buffer_size = m_base_target_buffer_size;
+}
+
+void AudioStream::UpdateAdaptiveBufferSize()
+{
+  if ((++m_adaptive_update_counter) < ADAPTIVE_UPDATE_INTERVAL)
+    return;
+
+  m_adaptive_update_counter = 0;
+
+  // Size the pacing target to the measured callback jitter: steady devices get half the configured
+  // buffer, erratic ones (e.g. USB audio) get extra margin on top, up to twice the configured size.
+  // Step one chunk at a time so the stretcher can follow without audible jumps.
+  const float jitter_ms = m_average_callback_jitter_ms.load(std::memory_order_relaxed);
+  const u32 jitter_frames =
+    GetAlignedBufferSize(static_cast<u32>((jitter_ms * static_cast<float>(m_sample_rate)) / 1000.0f));
+  const u32 max_size = std::min(m_base_target_buffer_size * 2, m_buffer_size / 2);
+  const u32 desired =
+    std::clamp((m_base_target_buffer_size / 2) + (jitter_frames * 2), m_base_target_buffer_size / 2, max_size);
+
+  u32 new_size = m_target_buffer_size;
+  if (desired > new_size)
+    new_size = std::min(new_size + CHUNK_SIZE, desired);
+  else if (desired < new_size)
+    new_size = std::max(new_size - CHUNK_SIZE, desired);
+
+  if (new_size != m_target_buffer_size)
+  {
+    Log_DevPrintf("Adaptive buffer target %u -> %u frames (%.2fms average jitter)", m_target_buffer_size, new_size,
+                  jitter_ms);
+    m_target_buffer_size = new_size;
+  }
+}
+
 void AudioStream::UpdateStretchTempo()
 {
+  if (m_adaptive_buffer_sizing)
+    UpdateAdaptiveBufferSize();
+
   static constexpr float MIN_TEMPO = 0.05f;
   static constexpr float MAX_TEMPO = 50.0f;
 
@@ -670,6 +881,7 @@ void AudioStream::StretchOverrun()
 {
   // Produced more frames than can fit in the buffer.
   m_stretch_reset++;
+  m_overrun_count.fetch_add(1, std::memory_order_relaxed);
 
   // Drop two packets to give the time stretcher a bit more time to slow things down.
   const u32 discard = CHUNK_SIZE * 2;
@@ -24,6 +24,7 @@ enum class AudioStretchMode : u8
   Off,
   Resample,
   TimeStretch,
+  PolyphaseResample,
   Count
 };
 
@@ -59,6 +60,41 @@ public:
 
   u32 GetBufferedFramesRelaxed() const;
 
+  /// Telemetry for underrun diagnosis. The cursors are monotonic frame counts updated with relaxed
+  /// ordering, so a pair of reads from another thread can be momentarily out of sync.
+  ALWAYS_INLINE u64 GetFramesWritten() const { return m_frames_written.load(std::memory_order_relaxed); }
+  ALWAYS_INLINE u64 GetFramesRead() const { return m_frames_read.load(std::memory_order_relaxed); }
+  ALWAYS_INLINE u64 GetFramesSilenced() const { return m_frames_silenced.load(std::memory_order_relaxed); }
+  ALWAYS_INLINE u64 GetFramesDropped() const { return m_frames_dropped.load(std::memory_order_relaxed); }
+  ALWAYS_INLINE u32 GetUnderrunCount() const { return m_underrun_count.load(std::memory_order_relaxed); }
+  ALWAYS_INLINE u32 GetOverrunCount() const { return m_overrun_count.load(std::memory_order_relaxed); }
+
+  /// Buffer occupancy histogram, sampled at the start of each output callback. Bucket i counts
+  /// callbacks which found between i/N and (i+1)/N of the buffer filled.
+  static constexpr u32 NUM_OCCUPANCY_BUCKETS = 8;
+  ALWAYS_INLINE u32 GetOccupancyBucketCount(u32 bucket) const
+  {
+    return m_occupancy_histogram[bucket].load(std::memory_order_relaxed);
+  }
+
+  /// Callback timing jitter: deviation of the interval between output callbacks from the duration
+  /// of audio the previous callback consumed. Average is exponentially smoothed, maximum is since
+  /// stream creation.
+  ALWAYS_INLINE float GetAverageCallbackJitterMS() const
+  {
+    return m_average_callback_jitter_ms.load(std::memory_order_relaxed);
+  }
+  ALWAYS_INLINE float GetMaximumCallbackJitterMS() const
+  {
+    return m_maximum_callback_jitter_ms.load(std::memory_order_relaxed);
+  }
+
+  /// Enables adaptive target buffer sizing. The pacing target grows towards twice the configured
+  /// size when callback timing is erratic, and shrinks back towards half of it when the device
+  /// delivers steady callbacks. Only effective with time stretching, which is what paces against
+  /// the target.
+  void SetAdaptiveBufferSizing(bool enabled);
+
   /// Temporarily pauses the stream, preventing it from requesting data.
   virtual void SetPaused(bool paused);
 
@@ -77,6 +113,12 @@ public:
 
   void SetStretchMode(AudioStretchMode mode);
 
+  /// Installs a process-wide tap which receives raw interleaved frames as they are written, before
+  /// any stretching or resampling, regardless of which stream they are written to. Invoked on the
+  /// writing (CPU) thread. Used by frontends which export audio out-of-process. Pass null to remove.
+  using FrameTap = void (*)(const SampleType* frames, u32 num_frames, void* userdata);
+  static void SetFrameTap(FrameTap tap, void* userdata);
+
   static std::unique_ptr<AudioStream> CreateNullStream(u32 sample_rate, u32 channels, u32 buffer_ms);
 
 #ifdef ENABLE_CUBEB
@@ -112,7 +154,10 @@ private:
     AVERAGING_BUFFER_SIZE = 256,
     AVERAGING_WINDOW = 50,
     STRETCH_RESET_THRESHOLD = 5,
+    ADAPTIVE_UPDATE_INTERVAL = 512,
     TARGET_IPS = 691,
+    POLYPHASE_TAPS = 8,
+    POLYPHASE_PHASES = 256,
   };
 
   void AllocateBuffer();
@@ -126,8 +171,12 @@ private:
   void StretchUnderrun();
   void StretchOverrun();
 
+  void PolyphaseAllocate();
+  void PolyphaseWrite();
+
   float AddAndGetAverageTempo(float val);
   void UpdateStretchTempo();
+  void UpdateAdaptiveBufferSize();
 
   u32 m_buffer_size = 0;
   std::unique_ptr<s32[]> m_buffer;
@@ -135,9 +184,33 @@ private:
   std::atomic<u32> m_rpos{0};
   std::atomic<u32> m_wpos{0};
 
+  std::atomic<u64> m_frames_written{0};
+  std::atomic<u64> m_frames_read{0};
+  std::atomic<u64> m_frames_silenced{0};
+  std::atomic<u64> m_frames_dropped{0};
+  std::atomic<u32> m_underrun_count{0};
+  std::atomic<u32> m_overrun_count{0};
+
+  std::array<std::atomic<u32>, NUM_OCCUPANCY_BUCKETS> m_occupancy_histogram = {};
+  std::atomic<float> m_average_callback_jitter_ms{0.0f};
+  std::atomic<float> m_maximum_callback_jitter_ms{0.0f};
+
+  // callback thread only
+  u64 m_last_callback_time = 0;
+  u32 m_last_callback_frames = 0;
+
   std::unique_ptr<soundtouch::SoundTouch> m_soundtouch;
 
+  // polyphase filter bank (coefficients duplicated for interleaved stereo), and the input window
+  // with the last POLYPHASE_TAPS frames of the previous chunk carried over as history
+  std::unique_ptr<float[]> m_polyphase_filter;
+  std::unique_ptr<float[]> m_polyphase_input;
+  u64 m_polyphase_position = 0; // 32.32 fixed-point input cursor
+
   u32 m_target_buffer_size = 0;
+  u32 m_base_target_buffer_size = 0;
+  u32 m_adaptive_update_counter = 0;
+  bool m_adaptive_buffer_sizing = false;
   u32 m_stretch_reset = STRETCH_RESET_THRESHOLD;
 
   u32 m_stretch_ok_count = 0;
@@ -0,0 +1,257 @@
+// SPDX-FileCopyrightText: 2019-2024 Connor McLaughlin <stenzek@gmail.com>
+// SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
+
+#include "avi_writer.h"
+#include "common/file_system.h"
+#include "common/log.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+Log_SetChannel(AVIWriter);
+
+namespace {
+#pragma pack(push, 1)
+struct AVI_HEADERS
+{
+  u32 riff_id; // RIFF
+  u32 riff_size;
+  u32 avi_id; // "AVI "
+
+  u32 hdrl_list_id; // LIST
+  u32 hdrl_list_size;
+  u32 hdrl_id; // hdrl
+
+  struct MainHeader
+  {
+    u32 chunk_id; // avih
+    u32 chunk_size;
+    u32 microsec_per_frame;
+    u32 max_bytes_per_sec;
+    u32 padding_granularity;
+    u32 flags;
+    u32 total_frames;
+    u32 initial_frames;
+    u32 streams;
+    u32 suggested_buffer_size;
+    u32 width;
+    u32 height;
+    u32 reserved[4];
+  } main_header;
+
+  u32 strl_list_id; // LIST
+  u32 strl_list_size;
+  u32 strl_id; // strl
+
+  struct StreamHeader
+  {
+    u32 chunk_id; // strh
+    u32 chunk_size;
+    u32 fcc_type;    // vids
+    u32 fcc_handler; // MJPG
+    u32 flags;
+    u16 priority;
+    u16 language;
+    u32 initial_frames;
+    u32 scale;
+    u32 rate;
+    u32 start;
+    u32 length;
+    u32 suggested_buffer_size;
+    u32 quality;
+    u32 sample_size;
+    s16 frame_left;
+    s16 frame_top;
+    s16 frame_right;
+    s16 frame_bottom;
+  } stream_header;
+
+  struct StreamFormat
+  {
+    u32 chunk_id; // strf
+    u32 chunk_size;
+    u32 size; // BITMAPINFOHEADER
+    s32 width;
+    s32 height;
+    u16 planes;
+    u16 bit_count;
+    u32 compression; // MJPG
+    u32 size_image;
+    s32 x_pels_per_meter;
+    s32 y_pels_per_meter;
+    u32 clr_used;
+    u32 clr_important;
+  } stream_format;
+
+  u32 movi_list_id; // LIST
+  u32 movi_list_size;
+  u32 movi_id; // movi
+};
+#pragma pack(pop)
+} // namespace
+
+AVIWriter::AVIWriter() = default;
+
+AVIWriter::~AVIWriter()
+{
+  if (IsOpen())
+    Close();
+}
+
+bool AVIWriter::Open(const char* filename, u32 width, u32 height, float frame_rate)
+{
+  if (IsOpen())
+    Close();
+
+  if (width == 0 || height == 0 || frame_rate <= 0.0f)
+    return false;
+
+  m_file = FileSystem::OpenCFile(filename, "wb");
+  if (!m_file)
+    return false;
+
+  m_width = width;
+  m_height = height;
+
+  // Express the frame rate as a rational with a fixed denominator, which keeps
+  // non-integer rates such as NTSC's 59.94Hz accurate.
+  m_scale = 10000;
+  m_rate = static_cast<u32>(std::lround(static_cast<double>(frame_rate) * static_cast<double>(m_scale)));
+
+  if (!WriteHeaders())
+  {
+    Log_ErrorPrintf("Failed to write headers to file");
+    std::fclose(m_file);
+    m_file = nullptr;
+    m_width = 0;
+    m_height = 0;
+    m_rate = 0;
+    m_scale = 0;
+    return false;
+  }
+
+  return true;
+}
+
+void AVIWriter::Close()
+{
+  if (!IsOpen())
+    return;
+
+  m_index_written = true;
+  if (!WriteIndex() || std::fseek(m_file, 0, SEEK_SET) != 0 || !WriteHeaders())
+    Log_ErrorPrintf("Failed to re-write headers on file, file may be unplayable");
+
+  std::fclose(m_file);
+  m_file = nullptr;
+  m_width = 0;
+  m_height = 0;
+  m_rate = 0;
+  m_scale = 0;
+  m_largest_frame_size = 0;
+  m_movi_data_size = 0;
+  m_index_written = false;
+  m_frame_index.clear();
+}
+
+bool AVIWriter::WriteFrame(const void* jpeg_data, u32 jpeg_size)
+{
+  const long chunk_offset = std::ftell(m_file);
+  const u32 chunk_header[2] = {0x63643030, jpeg_size}; // 00dc
+  if (chunk_offset < 0 || std::fwrite(chunk_header, sizeof(chunk_header), 1, m_file) != 1 ||
+      (jpeg_size > 0 && std::fwrite(jpeg_data, jpeg_size, 1, m_file) != 1))
+  {
+    return false;
+  }
+
+  // Chunks are word-aligned.
+  const u8 pad = 0;
+  if ((jpeg_size & 1u) && std::fwrite(&pad, sizeof(pad), 1, m_file) != 1)
+    return false;
+
+  IndexEntry entry;
+  entry.chunk_offset = static_cast<u32>(static_cast<size_t>(chunk_offset) - offsetof(AVI_HEADERS, movi_id));
+  entry.chunk_size = jpeg_size;
+  m_frame_index.push_back(entry);
+
+  m_movi_data_size += sizeof(chunk_header) + jpeg_size + (jpeg_size & 1u);
+  m_largest_frame_size = std::max(m_largest_frame_size, jpeg_size);
+  return true;
+}
+
+bool AVIWriter::WriteHeaders()
+{
+  const u32 num_frames = GetNumFrames();
+
+  AVI_HEADERS headers = {};
+  headers.riff_id = 0x46464952; // RIFF
+  headers.riff_size = (sizeof(AVI_HEADERS) - 8) + m_movi_data_size +
+                      (m_index_written ? (8 + (num_frames * sizeof(u32) * 4)) : 0);
+  headers.avi_id = 0x20495641; // "AVI "
+
+  headers.hdrl_list_id = 0x5453494c; // LIST
+  headers.hdrl_list_size =
+    static_cast<u32>(offsetof(AVI_HEADERS, movi_list_id) - offsetof(AVI_HEADERS, hdrl_id));
+  headers.hdrl_id = 0x6c726468; // hdrl
+
+  headers.main_header.chunk_id = 0x68697661; // avih
+  headers.main_header.chunk_size = sizeof(headers.main_header) - 8;
+  headers.main_header.microsec_per_frame =
+    static_cast<u32>((static_cast<u64>(m_scale) * 1000000ULL) / std::max<u32>(m_rate, 1));
+  headers.main_header.flags = 0x10; // AVIF_HASINDEX
+  headers.main_header.total_frames = num_frames;
+  headers.main_header.streams = 1;
+  headers.main_header.suggested_buffer_size = m_largest_frame_size;
+  headers.main_header.width = m_width;
+  headers.main_header.height = m_height;
+
+  headers.strl_list_id = 0x5453494c; // LIST
+  headers.strl_list_size =
+    static_cast<u32>(offsetof(AVI_HEADERS, movi_list_id) - offsetof(AVI_HEADERS, strl_id));
+  headers.strl_id = 0x6c727473; // strl
+
+  headers.stream_header.chunk_id = 0x68727473; // strh
+  headers.stream_header.chunk_size = sizeof(headers.stream_header) - 8;
+  headers.stream_header.fcc_type = 0x73646976;    // vids
+  headers.stream_header.fcc_handler = 0x47504a4d; // MJPG
+  headers.stream_header.scale = m_scale;
+  headers.stream_header.rate = m_rate;
+  headers.stream_header.length = num_frames;
+  headers.stream_header.suggested_buffer_size = m_largest_frame_size;
+  headers.stream_header.quality = 0xFFFFFFFFu;
+  headers.stream_header.frame_right = static_cast<s16>(m_width);
+  headers.stream_header.frame_bottom = static_cast<s16>(m_height);
+
+  headers.stream_format.chunk_id = 0x66727473; // strf
+  headers.stream_format.chunk_size = sizeof(headers.stream_format) - 8;
+  headers.stream_format.size = sizeof(headers.stream_format) - 8;
+  headers.stream_format.width = static_cast<s32>(m_width);
+  headers.stream_format.height = static_cast<s32>(m_height);
+  headers.stream_format.planes = 1;
+  headers.stream_format.bit_count = 24;
+  headers.stream_format.compression = 0x47504a4d; // MJPG
+  headers.stream_format.size_image = m_width * m_height * 3;
+
+  headers.movi_list_id = 0x5453494c; // LIST
+  headers.movi_list_size = 4 + m_movi_data_size;
+  headers.movi_id = 0x69766f6d; // movi
+
+  return (std::fwrite(&headers, sizeof(headers), 1, m_file) == 1);
+}
+
+bool AVIWriter::WriteIndex()
+{
+  const u32 chunk_header[2] = {0x31786469, static_cast<u32>(m_frame_index.size() * sizeof(u32) * 4)}; // idx1
+  if (std::fwrite(chunk_header, sizeof(chunk_header), 1, m_file) != 1)
+    return false;
+
+  for (const IndexEntry& entry : m_frame_index)
+  {
+    const u32 index_entry[4] = {0x63643030, 0x10, entry.chunk_offset, entry.chunk_size}; // 00dc, AVIIF_KEYFRAME
+    if (std::fwrite(index_entry, sizeof(index_entry), 1, m_file) != 1)
+      return false;
+  }
+
+  return true;
+}
@@ -0,0 +1,47 @@
+// SPDX-FileCopyrightText: 2019-2024 Connor McLaughlin <stenzek@gmail.com>
+// SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
+
+#pragma once
+#include "common/types.h"
+#include <cstdio>
+#include <vector>
+
+/// Writes an MJPEG-compressed video stream to an AVI container. Frames are expected to be
+/// pre-compressed JPEG images, one per call to WriteFrame(). The frame index and header
+/// sizes are patched when the file is closed.
+class AVIWriter
+{
+public:
+  AVIWriter();
+  ~AVIWriter();
+
+  ALWAYS_INLINE u32 GetWidth() const { return m_width; }
+  ALWAYS_INLINE u32 GetHeight() const { return m_height; }
+  ALWAYS_INLINE u32 GetNumFrames() const { return static_cast<u32>(m_frame_index.size()); }
+  ALWAYS_INLINE bool IsOpen() const { return (m_file != nullptr); }
+
+  bool Open(const char* filename, u32 width, u32 height, float frame_rate);
+  void Close();
+
+  bool WriteFrame(const void* jpeg_data, u32 jpeg_size);
+
+private:
+  struct IndexEntry
+  {
+    u32 chunk_offset;
+    u32 chunk_size;
+  };
+
+  bool WriteHeaders();
+  bool WriteIndex();
+
+  std::FILE* m_file = nullptr;
+  u32 m_width = 0;
+  u32 m_height = 0;
+  u32 m_rate = 0;
+  u32 m_scale = 0;
+  u32 m_largest_frame_size = 0;
+  u32 m_movi_data_size = 0;
+  bool m_index_written = false;
+  std::vector<IndexEntry> m_frame_index;
+};
@@ -391,6 +391,8 @@ void CDImage::ClearTOC()
   m_lba_count = 0;
   m_indices.clear();
   m_tracks.clear();
+  m_subq_cache.clear();
+  m_subq_cache_valid.clear();
   m_current_index = nullptr;
   m_position_in_index = 0;
   m_position_in_track = 0;
@@ -402,6 +404,8 @@ void CDImage::CopyTOC(const CDImage* image)
   m_lba_count = image->m_lba_count;
   decltype(m_indices)().swap(m_indices);
   decltype(m_tracks)().swap(m_tracks);
+  decltype(m_subq_cache)().swap(m_subq_cache);
+  decltype(m_subq_cache_valid)().swap(m_subq_cache_valid);
   m_indices.reserve(image->m_indices.size());
   m_tracks.reserve(image->m_tracks.size());
 
@@ -466,6 +470,22 @@ bool CDImage::GenerateSubChannelQ(SubChannelQ* subq, LBA lba)
 
 void CDImage::GenerateSubChannelQ(SubChannelQ* subq, const Index& index, u32 index_offset)
 {
+  if (m_subq_cache.empty() && !m_indices.empty())
+  {
+    const Index& last_index = m_indices.back();
+    const u32 sector_count = last_index.start_lba_on_disc + last_index.length;
+    m_subq_cache.resize(sector_count);
+    m_subq_cache_valid.resize(sector_count, false);
+  }
+
+  const LBA lba = index.start_lba_on_disc + index_offset;
+  const bool cacheable = (lba < m_subq_cache.size());
+  if (cacheable && m_subq_cache_valid[lba])
+  {
+    *subq = m_subq_cache[lba];
+    return;
+  }
+
   subq->control_bits = index.control.bits;
   subq->track_number_bcd = (index.track_number <= m_tracks.size() ? BinaryToBCD(static_cast<u8>(index.track_number)) :
                                                                     static_cast<u8>(index.track_number));
@@ -490,6 +510,12 @@ void CDImage::GenerateSubChannelQ(SubChannelQ* subq, const Index& index, u32 ind
   const Position absolute_position = Position::FromLBA(index.start_lba_on_disc + index_offset);
   std::tie(subq->absolute_minute_bcd, subq->absolute_second_bcd, subq->absolute_frame_bcd) = absolute_position.ToBCD();
   subq->crc = SubChannelQ::ComputeCRC(subq->data);
+
+  if (cacheable)
+  {
+    m_subq_cache[lba] = *subq;
+    m_subq_cache_valid[lba] = true;
+  }
 }
 
 void CDImage::AddLeadOutIndex()
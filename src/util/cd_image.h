@@ -350,6 +350,11 @@ protected:
   std::vector<Track> m_tracks;
   std::vector<Index> m_indices;
 
+  // Lazily-filled per-LBA sub-channel Q cache. The generated data for a given position never
+  // changes for an image, so the BCD/CRC math only runs the first time a sector is visited.
+  std::vector<SubChannelQ> m_subq_cache;
+  std::vector<bool> m_subq_cache_valid;
+
 private:
   // Position on disc.
   LBA m_position_on_disc = 0;
@@ -7,8 +7,11 @@
 #include "common/error.h"
 #include "common/file_system.h"
 #include "common/log.h"
+#include "common/memmap.h"
 
+#include <algorithm>
 #include <cerrno>
+#include <cstring>
 
 Log_SetChannel(CDImageBin);
 
@@ -29,9 +32,20 @@ protected:
   bool ReadSectorFromIndex(void* buffer, const Index& index, LBA lba_in_index) override;
 
 private:
+  enum : u32
+  {
+    // Prefetch window when reading through a mapping, in sectors.
+    MAP_PREFETCH_SECTORS = 128
+  };
+
   std::FILE* m_fp = nullptr;
   u64 m_file_position = 0;
 
+  // Memory-mapped view of the file, preferred over stdio when the mapping succeeds.
+  u8* m_mmap_base = nullptr;
+  size_t m_mmap_size = 0;
+  u64 m_mmap_prefetch_end = 0;
+
   CDSubChannelReplacement m_sbi;
 };
 
@@ -41,6 +55,8 @@ CDImageBin::CDImageBin() = default;
 
 CDImageBin::~CDImageBin()
 {
+  if (m_mmap_base)
+    MemMap::UnmapFile(m_mmap_base, m_mmap_size);
   if (m_fp)
     std::fclose(m_fp);
 }
@@ -66,6 +82,13 @@ bool CDImageBin::Open(const char* filename, Error* error)
 
   m_lba_count = file_size / track_sector_size;
 
+  // Prefer a read-only mapping; sector reads become pointer arithmetic, and the page cache is
+  // shared with other processes rather than duplicated in stdio buffers. Fall back to stdio when
+  // mapping is unsupported or fails (e.g. network filesystems which refuse mmap).
+  m_mmap_base = static_cast<u8*>(MemMap::MapFile(filename, &m_mmap_size));
+  if (m_mmap_base)
+    Log_DevPrintf("Mapped '%s' (%zu bytes) for direct sector access", filename, m_mmap_size);
+
   SubChannelQ::Control control = {};
   TrackMode mode = TrackMode::Mode2Raw;
   control.data = mode != TrackMode::Audio;
@@ -127,6 +150,21 @@ bool CDImageBin::HasNonStandardSubchannel() const
 bool CDImageBin::ReadSectorFromIndex(void* buffer, const Index& index, LBA lba_in_index)
 {
   const u64 file_position = index.file_offset + (static_cast<u64>(lba_in_index) * index.file_sector_size);
+  if (m_mmap_base && (file_position + index.file_sector_size) <= m_mmap_size)
+  {
+    // hint the next window in when we run past the last one, so linear streaming stays ahead of us
+    if ((file_position + index.file_sector_size) > m_mmap_prefetch_end)
+    {
+      const u64 prefetch_size =
+        std::min(static_cast<u64>(MAP_PREFETCH_SECTORS) * index.file_sector_size, m_mmap_size - file_position);
+      MemMap::PrefetchMappedFile(m_mmap_base, static_cast<size_t>(file_position), static_cast<size_t>(prefetch_size));
+      m_mmap_prefetch_end = file_position + prefetch_size;
+    }
+
+    std::memcpy(buffer, &m_mmap_base[file_position], index.file_sector_size);
+    return true;
+  }
+
   if (m_file_position != file_position)
   {
     if (std::fseek(m_fp, static_cast<long>(file_position), SEEK_SET) != 0)
@@ -12,6 +12,7 @@
 #include "common/heap_array.h"
 #include "common/intrin.h"
 #include "common/log.h"
+#include "common/lru_cache.h"
 #include "common/path.h"
 #include "common/string_util.h"
 
@@ -21,11 +22,13 @@
 
 #include <algorithm>
 #include <cerrno>
+#include <condition_variable>
 #include <cstdio>
 #include <cstring>
 #include <limits>
 #include <mutex>
 #include <optional>
+#include <thread>
 
 Log_SetChannel(CDImageCHD);
 
@@ -76,20 +79,40 @@ private:
   static constexpr u32 CHD_CD_SECTOR_DATA_SIZE = 2352 + 96;
   static constexpr u32 CHD_CD_TRACK_ALIGNMENT = 4;
   static constexpr u32 MAX_PARENTS = 32; // Surely someone wouldn't be insane enough to go beyond this...
+  static constexpr u32 HUNK_CACHE_SIZE = 8 * 1024 * 1024; // decoded hunks kept around for seek-heavy games
+  static constexpr u32 NUM_SPECULATIVE_HUNKS = 2;         // decoded ahead of the read position by the worker
+
+  using HunkData = DynamicHeapArray<u8, 16>;
 
   chd_file* OpenCHD(std::string_view filename, FileSystem::ManagedCFilePtr fp, Error* error, u32 recursion_level);
   bool UpdateHunkBuffer(const Index& index, LBA lba_in_index, u32& hunk_offset);
+  bool DecodeHunk(u32 hunk_index, u8* buffer);
+  void StopDecodeThread();
+  void DecodeThreadEntryPoint();
 
   static void CopyAndSwap(void* dst_ptr, const u8* src_ptr);
 
   chd_file* m_chd = nullptr;
   u32 m_hunk_size = 0;
   u32 m_sectors_per_hunk = 0;
+  u32 m_hunk_count = 0;
 
   DynamicHeapArray<u8, 16> m_hunk_buffer;
   u32 m_current_hunk_index = static_cast<u32>(-1);
   bool m_precached = false;
 
+  // libchdr handles are not thread-safe, so decompression takes m_chd_mutex; the decoded hunk
+  // cache has its own lock since it's shared between the reader and the speculative worker.
+  std::mutex m_chd_mutex;
+  std::mutex m_cache_mutex;
+  LRUCache<u32, HunkData> m_hunk_cache;
+
+  std::thread m_decode_thread;
+  std::condition_variable m_decode_cv;
+  u32 m_decode_next_hunk = static_cast<u32>(-1);
+  u32 m_decode_remaining = 0;
+  bool m_decode_shutdown = false;
+
   CDSubChannelReplacement m_sbi;
 };
 } // namespace
@@ -98,6 +121,8 @@ CDImageCHD::CDImageCHD() = default;
 
 CDImageCHD::~CDImageCHD()
 {
+  StopDecodeThread();
+
   if (m_chd)
     chd_close(m_chd);
 }
@@ -260,7 +285,10 @@ bool CDImageCHD::Open(const char* filename, Error* error)
   }
 
   m_sectors_per_hunk = m_hunk_size / CHD_CD_SECTOR_DATA_SIZE;
+  m_hunk_count = header->hunkcount;
   m_hunk_buffer.resize(m_hunk_size);
+  m_hunk_cache.SetMaxCapacity(std::max<u32>(HUNK_CACHE_SIZE / m_hunk_size, 1));
+  m_decode_thread = std::thread(&CDImageCHD::DecodeThreadEntryPoint, this);
   m_filename = filename;
 
   u32 disc_lba = 0;
@@ -464,8 +492,11 @@ CDImage::PrecacheResult CDImageCHD::Precache(ProgressCallback* progress)
     static_cast<ProgressCallback*>(param)->SetProgressValue(std::min<u32>(percent, 100));
   };
 
-  if (chd_precache_progress(m_chd, callback, progress) != CHDERR_NONE)
-    return CDImage::PrecacheResult::ReadError;
+  {
+    const std::unique_lock chd_lock(m_chd_mutex);
+    if (chd_precache_progress(m_chd, callback, progress) != CHDERR_NONE)
+      return CDImage::PrecacheResult::ReadError;
+  }
 
   m_precached = true;
   return CDImage::PrecacheResult::Success;
@@ -557,20 +588,105 @@ ALWAYS_INLINE_RELEASE bool CDImageCHD::UpdateHunkBuffer(const Index& index, LBA
   if (m_current_hunk_index == hunk_index)
     return true;
 
-  const chd_error err = chd_read(m_chd, hunk_index, m_hunk_buffer.data());
-  if (err != CHDERR_NONE)
+  bool cache_hit;
   {
-    Log_ErrorFmt("chd_read({}) failed: %s", hunk_index, chd_error_string(err));
+    std::unique_lock cache_lock(m_cache_mutex);
+    const HunkData* cached = m_hunk_cache.Lookup(hunk_index);
+    cache_hit = (cached != nullptr);
+    if (cache_hit)
+      std::memcpy(m_hunk_buffer.data(), cached->data(), m_hunk_size);
+  }
 
-    // data might have been partially written
-    m_current_hunk_index = static_cast<u32>(-1);
-    return false;
+  if (!cache_hit)
+  {
+    if (!DecodeHunk(hunk_index, m_hunk_buffer.data()))
+    {
+      // data might have been partially written
+      m_current_hunk_index = static_cast<u32>(-1);
+      return false;
+    }
+
+    std::unique_lock cache_lock(m_cache_mutex);
+    m_hunk_cache.Insert(hunk_index, HunkData(m_hunk_buffer.data(), m_hunk_size));
   }
 
   m_current_hunk_index = hunk_index;
+
+  // let the worker decode ahead of us, so the next hunks are ready when the stream reaches them
+  if ((hunk_index + 1) < m_hunk_count)
+  {
+    {
+      std::unique_lock cache_lock(m_cache_mutex);
+      m_decode_next_hunk = hunk_index + 1;
+      m_decode_remaining = NUM_SPECULATIVE_HUNKS;
+    }
+    m_decode_cv.notify_one();
+  }
+
+  return true;
+}
+
+bool CDImageCHD::DecodeHunk(u32 hunk_index, u8* buffer)
+{
+  const std::unique_lock chd_lock(m_chd_mutex);
+  const chd_error err = chd_read(m_chd, hunk_index, buffer);
+  if (err != CHDERR_NONE)
+  {
+    Log_ErrorFmt("chd_read({}) failed: {}", hunk_index, chd_error_string(err));
+    return false;
+  }
+
   return true;
 }
 
+void CDImageCHD::StopDecodeThread()
+{
+  if (!m_decode_thread.joinable())
+    return;
+
+  {
+    std::unique_lock cache_lock(m_cache_mutex);
+    m_decode_shutdown = true;
+    m_decode_cv.notify_one();
+  }
+
+  m_decode_thread.join();
+}
+
+void CDImageCHD::DecodeThreadEntryPoint()
+{
+  HunkData buffer(m_hunk_size);
+
+  std::unique_lock lock(m_cache_mutex);
+  for (;;)
+  {
+    m_decode_cv.wait(lock, [this]() { return (m_decode_shutdown || m_decode_remaining > 0); });
+    if (m_decode_shutdown)
+      break;
+
+    const u32 hunk_index = m_decode_next_hunk;
+    if (hunk_index >= m_hunk_count)
+    {
+      m_decode_remaining = 0;
+      continue;
+    }
+
+    m_decode_next_hunk++;
+    m_decode_remaining--;
+    if (m_hunk_cache.Lookup(hunk_index))
+      continue;
+
+    lock.unlock();
+    const bool result = DecodeHunk(hunk_index, buffer.data());
+    lock.lock();
+
+    if (result)
+      m_hunk_cache.Insert(hunk_index, HunkData(buffer.data(), m_hunk_size));
+    else
+      m_decode_remaining = 0;
+  }
+}
+
 std::unique_ptr<CDImage> CDImage::OpenCHDImage(const char* filename, Error* error)
 {
   std::unique_ptr<CDImageCHD> image = std::make_unique<CDImageCHD>();
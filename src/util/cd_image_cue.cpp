@@ -14,9 +14,11 @@
 #include "fmt/format.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cerrno>
 #include <cinttypes>
 #include <map>
+#include <thread>
 
 Log_SetChannel(CDImageCueSheet);
 
@@ -39,9 +41,11 @@ protected:
 private:
   struct TrackFile
   {
-    std::string filename;
+    std::string filename;      // name as referenced by the cuesheet, used for de-duplication
+    std::string full_filename; // resolved path, opened lazily for everything but the first file
     std::FILE* file;
     u64 file_position;
+    u64 file_size;
   };
 
   std::vector<TrackFile> m_files;
@@ -54,7 +58,10 @@ CDImageCueSheet::CDImageCueSheet() = default;
 
 CDImageCueSheet::~CDImageCueSheet()
 {
-  std::for_each(m_files.begin(), m_files.end(), [](TrackFile& t) { std::fclose(t.file); });
+  std::for_each(m_files.begin(), m_files.end(), [](TrackFile& t) {
+    if (t.file)
+      std::fclose(t.file);
+  });
 }
 
 bool CDImageCueSheet::OpenAndParse(const char* filename, Error* error)
@@ -80,6 +87,88 @@ bool CDImageCueSheet::OpenAndParse(const char* filename, Error* error)
 
   m_filename = filename;
 
+  // Collect the unique files referenced by the tracks, in first-use order.
+  std::vector<std::string> file_names;
+  for (u32 track_num = 1; track_num <= CueParser::MAX_TRACK_NUMBER; track_num++)
+  {
+    const CueParser::Track* track = parser.GetTrack(track_num);
+    if (!track)
+      break;
+
+    if (std::find(file_names.begin(), file_names.end(), track->file) == file_names.end())
+      file_names.emplace_back(track->file);
+  }
+
+  // Probe the referenced files up front: the layout only needs their sizes, so a stat suffices,
+  // and everything except the first file is opened on first read instead. Multi-bin images
+  // reference 30+ files and each probe can be a round trip on network storage, so fan them out.
+  struct ProbeResult
+  {
+    std::string full_filename;
+    s64 size = -1;
+  };
+  std::vector<ProbeResult> probes(file_names.size());
+  const auto probe_file = [this, filename, &file_names, &probes](size_t i) {
+    ProbeResult& res = probes[i];
+    const std::string& track_filename = file_names[i];
+    std::string full_filename(!Path::IsAbsolute(track_filename) ? Path::BuildRelativePath(m_filename, track_filename) :
+                                                                  track_filename);
+
+    FILESYSTEM_STAT_DATA sd;
+    if (FileSystem::StatFile(full_filename.c_str(), &sd))
+    {
+      res.full_filename = std::move(full_filename);
+      res.size = sd.Size;
+      return;
+    }
+
+    if (i == 0)
+    {
+      // many users have bad cuesheets, or they're renamed the files without updating the cuesheet.
+      // so, try searching for a bin with the same name as the cue, but only for the first referenced file.
+      std::string alternative_filename(Path::ReplaceExtension(filename, "bin"));
+      if (FileSystem::StatFile(alternative_filename.c_str(), &sd))
+      {
+        Log_WarningPrintf("Your cue sheet references an invalid file '%s', but this was found at '%s' instead.",
+                          track_filename.c_str(), alternative_filename.c_str());
+        res.full_filename = std::move(alternative_filename);
+        res.size = sd.Size;
+        return;
+      }
+    }
+
+    res.full_filename = std::move(full_filename);
+  };
+
+  if (file_names.size() > 1)
+  {
+    const u32 num_threads =
+      std::min(std::max(std::thread::hardware_concurrency(), 1u), static_cast<u32>(file_names.size()));
+    std::atomic<size_t> next_file{0};
+    std::vector<std::thread> workers;
+    workers.reserve(num_threads);
+    for (u32 i = 0; i < num_threads; i++)
+    {
+      workers.emplace_back([&file_names, &next_file, &probe_file]() {
+        for (;;)
+        {
+          const size_t index = next_file.fetch_add(1, std::memory_order_acq_rel);
+          if (index >= file_names.size())
+            break;
+
+          probe_file(index);
+        }
+      });
+    }
+
+    for (std::thread& thread : workers)
+      thread.join();
+  }
+  else if (!file_names.empty())
+  {
+    probe_file(0);
+  }
+
   u32 disc_lba = 0;
 
   // for each track..
@@ -101,34 +190,38 @@ bool CDImageCueSheet::OpenAndParse(const char* filename, Error* error)
     }
     if (track_file_index == m_files.size())
     {
-      const std::string track_full_filename(
-        !Path::IsAbsolute(track_filename) ? Path::BuildRelativePath(m_filename, track_filename) : track_filename);
-      Error track_error;
-      std::FILE* track_fp = FileSystem::OpenCFile(track_full_filename.c_str(), "rb", &track_error);
-      if (!track_fp && track_file_index == 0)
+      ProbeResult& probe =
+        probes[static_cast<size_t>(std::find(file_names.begin(), file_names.end(), track_filename) -
+                                   file_names.begin())];
+      if (probe.size < 0)
       {
-        // many users have bad cuesheets, or they're renamed the files without updating the cuesheet.
-        // so, try searching for a bin with the same name as the cue, but only for the first referenced file.
-        const std::string alternative_filename(Path::ReplaceExtension(filename, "bin"));
-        track_fp = FileSystem::OpenCFile(alternative_filename.c_str(), "rb");
-        if (track_fp)
-        {
-          Log_WarningPrintf("Your cue sheet references an invalid file '%s', but this was found at '%s' instead.",
-                            track_filename.c_str(), alternative_filename.c_str());
-        }
+        Log_ErrorPrintf("Failed to open track filename '%s' (from '%s' and '%s')", probe.full_filename.c_str(),
+                        track_filename.c_str(), filename);
+        Error::SetString(error, fmt::format("Failed to open track filename '{}' (from '{}' and '{}')",
+                                            probe.full_filename, track_filename, filename));
+        return false;
       }
 
-      if (!track_fp)
+      // The first file is (nearly always) the data track and gets read immediately, so open it
+      // here where failures can still be reported. Audio track files wait until first access.
+      std::FILE* track_fp = nullptr;
+      if (track_file_index == 0)
       {
-        Log_ErrorPrintf("Failed to open track filename '%s' (from '%s' and '%s'): %s", track_full_filename.c_str(),
-                        track_filename.c_str(), filename, track_error.GetDescription().c_str());
-        Error::SetString(error,
-                         fmt::format("Failed to open track filename '{}' (from '{}' and '{}'): {}", track_full_filename,
-                                     track_filename, filename, track_error.GetDescription()));
-        return false;
+        Error track_error;
+        track_fp = FileSystem::OpenCFile(probe.full_filename.c_str(), "rb", &track_error);
+        if (!track_fp)
+        {
+          Log_ErrorPrintf("Failed to open track filename '%s' (from '%s' and '%s'): %s", probe.full_filename.c_str(),
+                          track_filename.c_str(), filename, track_error.GetDescription().c_str());
+          Error::SetString(error,
+                           fmt::format("Failed to open track filename '{}' (from '{}' and '{}'): {}",
+                                       probe.full_filename, track_filename, filename, track_error.GetDescription()));
+          return false;
+        }
       }
 
-      m_files.push_back(TrackFile{std::move(track_filename), track_fp, 0});
+      m_files.push_back(TrackFile{std::move(track_filename), std::move(probe.full_filename), track_fp, 0,
+                                  static_cast<u64>(probe.size)});
     }
 
     // data type determines the sector size
@@ -146,11 +239,7 @@ bool CDImageCueSheet::OpenAndParse(const char* filename, Error* error)
     LBA track_length;
     if (!track->length.has_value())
     {
-      FileSystem::FSeek64(m_files[track_file_index].file, 0, SEEK_END);
-      u64 file_size = static_cast<u64>(FileSystem::FTell64(m_files[track_file_index].file));
-      FileSystem::FSeek64(m_files[track_file_index].file, 0, SEEK_SET);
-
-      file_size /= track_sector_size;
+      u64 file_size = m_files[track_file_index].file_size / track_sector_size;
       if (track_start >= file_size)
       {
         Log_ErrorPrintf("Failed to open track %u in '%s': track start is out of range (%u vs %" PRIu64 ")", track_num,
@@ -320,6 +409,17 @@ bool CDImageCueSheet::ReadSectorFromIndex(void* buffer, const Index& index, LBA
   DebugAssert(index.file_index < m_files.size());
 
   TrackFile& tf = m_files[index.file_index];
+  if (!tf.file) [[unlikely]]
+  {
+    // audio track files are only probed at parse time, and get opened on first access
+    tf.file = FileSystem::OpenCFile(tf.full_filename.c_str(), "rb");
+    if (!tf.file)
+    {
+      Log_ErrorPrintf("Failed to open deferred track file '%s': errno %d", tf.full_filename.c_str(), errno);
+      return false;
+    }
+  }
+
   const u64 file_position = index.file_offset + (static_cast<u64>(lba_in_index) * index.file_sector_size);
   if (tf.file_position != file_position)
   {
@@ -62,11 +62,17 @@ private:
     u8 sense[20];
   };
 
-  static void FillSPTD(SPTDBuffer* sptd, u32 sector_number, bool include_subq, void* buffer);
+  static void FillSPTD(SPTDBuffer* sptd, u32 sector_number, u32 sector_count, bool include_subq, void* buffer);
 
   bool ReadSectorToBuffer(u64 offset);
+  bool ReadChunkFromDevice(u64 offset, u32 sector_count);
+  bool ExtractSectorFromChunk(u64 offset);
   bool DetermineReadMode();
 
+  // Deeper device-side readahead than the async reader's window: one command fetches a run of
+  // sectors, so the drive's command latency is paid once per window instead of per sector.
+  static constexpr u32 READAHEAD_SECTORS = 16;
+
   HANDLE m_hDevice = INVALID_HANDLE_VALUE;
 
   u64 m_buffer_offset = ~static_cast<u64>(0);
@@ -74,6 +80,12 @@ private:
   bool m_use_sptd = true;
   bool m_read_subcode = false;
 
+  u64 m_chunk_offset = ~static_cast<u64>(0);
+  u32 m_chunk_valid_sectors = 0;
+  u32 m_chunk_frame_size = 0;
+  bool m_chunk_has_raw_subcode = false;
+  std::vector<u8> m_chunk_buffer;
+
   std::array<u8, CD_RAW_SECTOR_WITH_SUBCODE_SIZE> m_buffer;
   std::array<u8, ALL_SUBCODE_SIZE> m_deinterleaved_subcode;
   std::array<u8, SUBCHANNEL_BYTES_PER_FRAME> m_subq;
@@ -253,6 +265,9 @@ bool CDImageDeviceWin32::Open(const char* filename, Error* error)
     return false;
   }
 
+  // sized for the worst case (raw reads always return the full interleaved subcode)
+  m_chunk_buffer.resize(READAHEAD_SECTORS * CD_RAW_SECTOR_WITH_SUBCODE_SIZE);
+
   return Seek(1, Position{0, 0, 0});
 }
 
@@ -288,7 +303,8 @@ bool CDImageDeviceWin32::ReadSectorFromIndex(void* buffer, const Index& index, L
   return true;
 }
 
-void CDImageDeviceWin32::FillSPTD(SPTDBuffer* sptd, u32 sector_number, bool include_subq, void* buffer)
+void CDImageDeviceWin32::FillSPTD(SPTDBuffer* sptd, u32 sector_number, u32 sector_count, bool include_subq,
+                                  void* buffer)
 {
   std::memset(sptd, 0, sizeof(SPTDBuffer));
 
@@ -296,7 +312,8 @@ void CDImageDeviceWin32::FillSPTD(SPTDBuffer* sptd, u32 sector_number, bool incl
   sptd->cmd.CdbLength = 12;
   sptd->cmd.SenseInfoLength = sizeof(sptd->sense);
   sptd->cmd.DataIn = SCSI_IOCTL_DATA_IN;
-  sptd->cmd.DataTransferLength = include_subq ? (RAW_SECTOR_SIZE + SUBCHANNEL_BYTES_PER_FRAME) : RAW_SECTOR_SIZE;
+  sptd->cmd.DataTransferLength =
+    (include_subq ? (RAW_SECTOR_SIZE + SUBCHANNEL_BYTES_PER_FRAME) : RAW_SECTOR_SIZE) * sector_count;
   sptd->cmd.TimeOutValue = 10;
   sptd->cmd.SenseInfoOffset = offsetof(SPTDBuffer, sense);
   sptd->cmd.DataBuffer = buffer;
@@ -307,9 +324,9 @@ void CDImageDeviceWin32::FillSPTD(SPTDBuffer* sptd, u32 sector_number, bool incl
   sptd->cmd.Cdb[3] = Truncate8(sector_number >> 16);
   sptd->cmd.Cdb[4] = Truncate8(sector_number >> 8);
   sptd->cmd.Cdb[5] = Truncate8(sector_number);
-  sptd->cmd.Cdb[6] = 0x00; // Transfer Count
-  sptd->cmd.Cdb[7] = 0x00;
-  sptd->cmd.Cdb[8] = 0x01;
+  sptd->cmd.Cdb[6] = Truncate8(sector_count >> 16); // Transfer Count
+  sptd->cmd.Cdb[7] = Truncate8(sector_count >> 8);
+  sptd->cmd.Cdb[8] = Truncate8(sector_count);
   sptd->cmd.Cdb[9] = (1 << 7) |                                     // include sync
                      (0b11 << 5) |                                  // include header codes
                      (1 << 4) |                                     // include user data
@@ -320,12 +337,34 @@ void CDImageDeviceWin32::FillSPTD(SPTDBuffer* sptd, u32 sector_number, bool incl
 
 bool CDImageDeviceWin32::ReadSectorToBuffer(u64 offset)
 {
+  if (!ExtractSectorFromChunk(offset))
+  {
+    // A single marginal sector shouldn't take the whole window down with it, so drop back to a
+    // lone-sector read before giving up. We only get here from the async readahead thread, so the
+    // retry cost is invisible to the emulated pickup.
+    if (!ReadChunkFromDevice(offset, READAHEAD_SECTORS) && !ReadChunkFromDevice(offset, 1))
+      return false;
+
+    if (!ExtractSectorFromChunk(offset))
+      return false;
+  }
+
+  m_buffer_offset = offset;
+  return true;
+}
+
+bool CDImageDeviceWin32::ReadChunkFromDevice(u64 offset, u32 sector_count)
+{
+  m_chunk_offset = ~static_cast<u64>(0);
+  m_chunk_valid_sectors = 0;
+
   if (m_use_sptd)
   {
     const u32 sector_number = static_cast<u32>(offset / 2048);
+    const u32 frame_size = m_read_subcode ? (RAW_SECTOR_SIZE + SUBCHANNEL_BYTES_PER_FRAME) : RAW_SECTOR_SIZE;
 
     SPTDBuffer sptd = {};
-    FillSPTD(&sptd, sector_number, m_read_subcode, m_buffer.data());
+    FillSPTD(&sptd, sector_number, sector_count, m_read_subcode, m_chunk_buffer.data());
 
     const u32 expected_bytes = sptd.cmd.DataTransferLength;
     DWORD bytes_returned;
@@ -333,43 +372,88 @@ bool CDImageDeviceWin32::ReadSectorToBuffer(u64 offset)
                          &bytes_returned, nullptr) &&
         sptd.cmd.ScsiStatus == 0x00)
     {
-      Log_ErrorPrintf("DeviceIoControl(IOCTL_SCSI_PASS_THROUGH_DIRECT) for offset %" PRIu64
-                      " failed: %08X Status 0x%02X",
-                      offset, GetLastError(), sptd.cmd.ScsiStatus);
+      if (sector_count > 1)
+      {
+        Log_DevPrintf("DeviceIoControl(IOCTL_SCSI_PASS_THROUGH_DIRECT) for %u sectors at offset %" PRIu64
+                      " failed: %08X Status 0x%02X, retrying single sector",
+                      sector_count, offset, GetLastError(), sptd.cmd.ScsiStatus);
+      }
+      else
+      {
+        Log_ErrorPrintf("DeviceIoControl(IOCTL_SCSI_PASS_THROUGH_DIRECT) for offset %" PRIu64
+                        " failed: %08X Status 0x%02X",
+                        offset, GetLastError(), sptd.cmd.ScsiStatus);
+      }
       return false;
     }
 
     if (sptd.cmd.DataTransferLength != expected_bytes)
       Log_WarningPrintf("Only read %u of %u bytes", static_cast<u32>(sptd.cmd.DataTransferLength), expected_bytes);
 
-    if (m_read_subcode)
-      std::memcpy(m_subq.data(), &m_buffer[RAW_SECTOR_SIZE], SUBCHANNEL_BYTES_PER_FRAME);
+    m_chunk_frame_size = frame_size;
+    m_chunk_has_raw_subcode = false;
   }
   else
   {
     RAW_READ_INFO rri;
     rri.DiskOffset.QuadPart = offset;
-    rri.SectorCount = 1;
+    rri.SectorCount = sector_count;
     rri.TrackMode = RawWithSubCode;
 
+    const u32 expected_bytes = CD_RAW_SECTOR_WITH_SUBCODE_SIZE * sector_count;
     DWORD bytes_returned;
-    if (!DeviceIoControl(m_hDevice, IOCTL_CDROM_RAW_READ, &rri, sizeof(rri), m_buffer.data(),
-                         static_cast<DWORD>(m_buffer.size()), &bytes_returned, nullptr))
+    if (!DeviceIoControl(m_hDevice, IOCTL_CDROM_RAW_READ, &rri, sizeof(rri), m_chunk_buffer.data(),
+                         static_cast<DWORD>(m_chunk_buffer.size()), &bytes_returned, nullptr))
     {
-      Log_ErrorPrintf("DeviceIoControl(IOCTL_CDROM_RAW_READ) for offset %" PRIu64 " failed: %08X", offset,
-                      GetLastError());
+      if (sector_count > 1)
+      {
+        Log_DevPrintf("DeviceIoControl(IOCTL_CDROM_RAW_READ) for %u sectors at offset %" PRIu64
+                      " failed: %08X, retrying single sector",
+                      sector_count, offset, GetLastError());
+      }
+      else
+      {
+        Log_ErrorPrintf("DeviceIoControl(IOCTL_CDROM_RAW_READ) for offset %" PRIu64 " failed: %08X", offset,
+                        GetLastError());
+      }
       return false;
     }
 
-    if (bytes_returned != m_buffer.size())
-      Log_WarningPrintf("Only read %u of %u bytes", bytes_returned, static_cast<unsigned>(m_buffer.size()));
+    if (bytes_returned != expected_bytes)
+      Log_WarningPrintf("Only read %u of %u bytes", bytes_returned, expected_bytes);
+
+    m_chunk_frame_size = CD_RAW_SECTOR_WITH_SUBCODE_SIZE;
+    m_chunk_has_raw_subcode = true;
+  }
+
+  m_chunk_offset = offset;
+  m_chunk_valid_sectors = sector_count;
+  return true;
+}
 
+bool CDImageDeviceWin32::ExtractSectorFromChunk(u64 offset)
+{
+  if (m_chunk_offset == ~static_cast<u64>(0) || offset < m_chunk_offset)
+    return false;
+
+  const u64 sector_index = (offset - m_chunk_offset) / 2048;
+  if (sector_index >= m_chunk_valid_sectors)
+    return false;
+
+  const u8* frame = &m_chunk_buffer[sector_index * m_chunk_frame_size];
+  std::memcpy(m_buffer.data(), frame, RAW_SECTOR_SIZE);
+
+  if (m_chunk_has_raw_subcode)
+  {
     // P, Q, ...
-    DeinterleaveSubcode(&m_buffer[RAW_SECTOR_SIZE], m_deinterleaved_subcode.data());
+    DeinterleaveSubcode(frame + RAW_SECTOR_SIZE, m_deinterleaved_subcode.data());
     std::memcpy(m_subq.data(), &m_deinterleaved_subcode[SUBCHANNEL_BYTES_PER_FRAME], SUBCHANNEL_BYTES_PER_FRAME);
   }
+  else if (m_read_subcode)
+  {
+    std::memcpy(m_subq.data(), frame + RAW_SECTOR_SIZE, SUBCHANNEL_BYTES_PER_FRAME);
+  }
 
-  m_buffer_offset = offset;
   return true;
 }
 
@@ -412,7 +496,7 @@ bool CDImageDeviceWin32::DetermineReadMode()
                 bytes_returned);
 
   SPTDBuffer sptd = {};
-  FillSPTD(&sptd, 0, true, m_buffer.data());
+  FillSPTD(&sptd, 0, 1, true, m_buffer.data());
 
   if (DeviceIoControl(m_hDevice, IOCTL_SCSI_PASS_THROUGH_DIRECT, &sptd, sizeof(sptd), &sptd, sizeof(sptd),
                       &bytes_returned, nullptr) &&
@@ -437,7 +521,7 @@ bool CDImageDeviceWin32::DetermineReadMode()
   }
 
   // try without subcode
-  FillSPTD(&sptd, 0, false, m_buffer.data());
+  FillSPTD(&sptd, 0, 1, false, m_buffer.data());
   if (DeviceIoControl(m_hDevice, IOCTL_SCSI_PASS_THROUGH_DIRECT, &sptd, sizeof(sptd), &sptd, sizeof(sptd),
                       &bytes_returned, nullptr) &&
       sptd.cmd.ScsiStatus == 0x00)
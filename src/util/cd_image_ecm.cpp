@@ -6,7 +6,9 @@
 #include "common/assert.h"
 #include "common/error.h"
 #include "common/file_system.h"
+#include "common/heap_array.h"
 #include "common/log.h"
+#include "common/lru_cache.h"
 #include <array>
 #include <cerrno>
 #include <map>
@@ -211,10 +213,18 @@ private:
 
   using DataMap = std::map<u32, SectorEntry>;
 
+  // Decoded sectors kept around for seek-heavy games; regenerating ECC/EDC every time a game
+  // jumps back to a previously-read sector is far more expensive than the copy.
+  static constexpr u32 SECTOR_CACHE_SIZE = 4 * 1024 * 1024;
+
+  using SectorData = DynamicHeapArray<u8, 16>;
+
   DataMap m_data_map;
   std::vector<u8> m_chunk_buffer;
   u32 m_chunk_start = 0;
 
+  LRUCache<u32, SectorData> m_sector_cache;
+
   CDSubChannelReplacement m_sbi;
 };
 
@@ -407,6 +417,7 @@ bool CDImageEcm::Open(const char* filename, Error* error)
   m_sbi.LoadFromImagePath(filename);
 
   m_chunk_buffer.reserve(RAW_SECTOR_SIZE * 2);
+  m_sector_cache.SetMaxCapacity(SECTOR_CACHE_SIZE / RAW_SECTOR_SIZE);
   return Seek(1, Position{0, 0, 0});
 }
 
@@ -531,8 +542,21 @@ bool CDImageEcm::ReadSectorFromIndex(void* buffer, const Index& index, LBA lba_i
 
   if (file_start < m_chunk_start || file_end > (m_chunk_start + m_chunk_buffer.size()))
   {
+    // The chunk buffer covers sequential streaming; the cache covers jumps back to sectors we
+    // already decoded.
+    if (const SectorData* cached = m_sector_cache.Lookup(file_start))
+    {
+      std::memcpy(buffer, cached->data(), RAW_SECTOR_SIZE);
+      return true;
+    }
+
     if (!ReadChunks(file_start, RAW_SECTOR_SIZE))
       return false;
+
+    DebugAssert(file_start >= m_chunk_start && file_end <= (m_chunk_start + m_chunk_buffer.size()));
+
+    const size_t chunk_offset = static_cast<size_t>(file_start - m_chunk_start);
+    m_sector_cache.Insert(file_start, SectorData(&m_chunk_buffer[chunk_offset], RAW_SECTOR_SIZE));
   }
 
   DebugAssert(file_start >= m_chunk_start && file_end <= (m_chunk_start + m_chunk_buffer.size()));
@@ -10,6 +10,7 @@
 #include "common/log.h"
 #include "common/path.h"
 #include "common/string_util.h"
+#include "common/thread_pool.h"
 
 #include "zlib.h"
 
@@ -17,6 +18,7 @@
 #include <cstdio>
 #include <cstring>
 #include <map>
+#include <memory>
 #include <string>
 #include <variant>
 #include <vector>
@@ -153,6 +155,27 @@ private:
     u16 size;
   };
 
+  // Everything parsed out of one disc's ISO header. All discs are parsed up-front at open, so
+  // switching discs in a multi-disc image doesn't re-read the megabyte-sized block table.
+  struct DiscInfo
+  {
+    std::array<BlockInfo, BLOCK_TABLE_NUM_ENTRIES> blockinfo_table;
+    std::array<TOCEntry, TOC_NUM_ENTRIES> toc;
+  };
+
+  // Decompressed blocks are cached by the absolute file offset of the compressed block, which is
+  // unique across discs, so the cache survives disc switches.
+  struct CachedBlock
+  {
+    u32 file_offset = 0;
+    u64 last_use = 0;
+    bool valid = false;
+    std::array<u8, DECOMPRESSED_BLOCK_SIZE> data;
+  };
+
+  static constexpr u32 BLOCK_CACHE_SIZE = 32;  // ~1.2MB of decompressed blocks
+  static constexpr u32 READAHEAD_BLOCKS = 4;   // span inflated per cache miss
+
 #if _DEBUG
   static void PrintPBPHeaderInfo(const PBPHeader& pbp_header);
   static void PrintSFOHeaderInfo(const SFOHeader& sfo_header);
@@ -167,11 +190,15 @@ private:
 
   bool IsValidEboot(Error* error);
 
-  bool InitDecompressionStream();
-  bool DecompressBlock(const BlockInfo& block_info);
+  static bool InflateBlock(const u8* compressed_data, u32 compressed_size, u8* decompressed_data);
 
+  bool ParseDiscInfo(u32 index, Error* error);
   bool OpenDisc(u32 index, Error* error);
 
+  const u8* LookupCachedBlock(u32 file_offset);
+  CachedBlock* AllocateCacheSlot(u32 file_offset);
+  const u8* FillBlockCache(u32 requested_block);
+
   static const std::string* LookupStringSFOTableEntry(const char* key, const SFOTable& table);
 
   FILE* m_file = nullptr;
@@ -183,18 +210,14 @@ private:
 
   // Absolute offsets to ISO headers, size is the number of discs in the file
   std::vector<u32> m_disc_offsets;
+  std::vector<std::unique_ptr<DiscInfo>> m_disc_infos;
   u32 m_current_disc = 0;
-
-  // Absolute offsets and sizes of blocks in m_file
-  std::array<BlockInfo, BLOCK_TABLE_NUM_ENTRIES> m_blockinfo_table;
-
-  std::array<TOCEntry, TOC_NUM_ENTRIES> m_toc;
+  const DiscInfo* m_current_disc_info = nullptr;
 
   u32 m_current_block = static_cast<u32>(-1);
-  std::array<u8, DECOMPRESSED_BLOCK_SIZE> m_decompressed_block;
-  std::vector<u8> m_compressed_block;
-
-  z_stream m_inflate_stream;
+  const u8* m_current_block_data = nullptr;
+  std::array<CachedBlock, BLOCK_CACHE_SIZE> m_block_cache;
+  u64 m_block_cache_counter = 0;
 
   CDSubChannelReplacement m_sbi;
 };
@@ -204,8 +227,6 @@ CDImagePBP::~CDImagePBP()
 {
   if (m_file)
     fclose(m_file);
-
-  inflateEnd(&m_inflate_stream);
 }
 
 bool CDImagePBP::LoadPBPHeader()
@@ -502,25 +523,26 @@ bool CDImagePBP::Open(const char* filename, Error* error)
     m_disc_offsets.push_back(m_pbp_header.data_psar_offset);
   }
 
+  // Preparse every disc's ISO header now, so switching discs later doesn't stall on re-reading
+  // the TOC and block table.
+  m_disc_infos.resize(m_disc_offsets.size());
+  for (u32 i = 0; i < static_cast<u32>(m_disc_offsets.size()); i++)
+  {
+    if (!ParseDiscInfo(i, (i == 0) ? error : nullptr))
+    {
+      if (i == 0)
+        return false;
+
+      Log_WarningPrintf("Failed to parse disc %u, it will not be openable", i + 1);
+    }
+  }
+
   // Default to first disc for now
   return OpenDisc(0, error);
 }
 
-bool CDImagePBP::OpenDisc(u32 index, Error* error)
+bool CDImagePBP::ParseDiscInfo(u32 index, Error* error)
 {
-  if (index >= m_disc_offsets.size())
-  {
-    Log_ErrorPrintf("File does not contain disc %u", index + 1);
-    Error::SetString(error, fmt::format("File does not contain disc {}", index + 1));
-    return false;
-  }
-
-  m_current_block = static_cast<u32>(-1);
-  m_blockinfo_table.fill({});
-  m_toc.fill({});
-  m_decompressed_block.fill(0x00);
-  m_compressed_block.clear();
-
   // Go to ISO header
   const u32 iso_header_start = m_disc_offsets[index];
   if (FileSystem::FSeek64(m_file, iso_header_start, SEEK_SET) != 0)
@@ -551,13 +573,15 @@ bool CDImagePBP::OpenDisc(u32 index, Error* error)
     return false;
   }
 
+  std::unique_ptr<DiscInfo> di = std::make_unique<DiscInfo>();
+
   // Read in the TOC
   if (FileSystem::FSeek64(m_file, iso_header_start + 0x800, SEEK_SET) != 0)
     return false;
 
   for (u32 i = 0; i < TOC_NUM_ENTRIES; i++)
   {
-    if (std::fread(&m_toc[i], sizeof(m_toc[i]), 1, m_file) != 1)
+    if (std::fread(&di->toc[i], sizeof(di->toc[i]), 1, m_file) != 1)
       return false;
   }
 
@@ -583,26 +607,52 @@ bool CDImagePBP::OpenDisc(u32 index, Error* error)
       return false;
 
     // Only store absolute file offset into a BlockInfo if this is a valid block
-    m_blockinfo_table[i] = {(bte.size != 0) ? (iso_header_start + iso_offset + bte.offset) : 0, bte.size};
+    di->blockinfo_table[i] = {(bte.size != 0) ? (iso_header_start + iso_offset + bte.offset) : 0, bte.size};
 
-    // printf("Block %u, file offset %u, size %u\n", i, m_blockinfo_table[i].offset, m_blockinfo_table[i].size);
+    // printf("Block %u, file offset %u, size %u\n", i, di->blockinfo_table[i].offset, di->blockinfo_table[i].size);
   }
 
   // iso_header_start + 0x12D4, 0x12D6, 0x12D8 supposedly contain data on block size, num clusters, and num blocks
   // Might be useful for error checking, but probably not that important as of now
 
+  m_disc_infos[index] = std::move(di);
+  return true;
+}
+
+bool CDImagePBP::OpenDisc(u32 index, Error* error)
+{
+  if (index >= m_disc_offsets.size())
+  {
+    Log_ErrorPrintf("File does not contain disc %u", index + 1);
+    Error::SetString(error, fmt::format("File does not contain disc {}", index + 1));
+    return false;
+  }
+
+  const DiscInfo* di = m_disc_infos[index].get();
+  if (!di)
+  {
+    Log_ErrorPrintf("Disc %u could not be parsed", index + 1);
+    Error::SetString(error, fmt::format("Disc {} could not be parsed", index + 1));
+    return false;
+  }
+
+  // The block cache deliberately carries over; blocks are keyed by file offset, so the previous
+  // disc's blocks simply age out.
+  m_current_block = static_cast<u32>(-1);
+  m_current_block_data = nullptr;
+
   // Ignore track types for first three TOC entries, these don't seem to be consistent, but check that the points are
-  // valid. Not sure what m_toc[0].userdata_start.s encodes on homebrew EBOOTs though, so ignore that
-  if (m_toc[0].point != 0xA0 || m_toc[1].point != 0xA1 || m_toc[2].point != 0xA2)
+  // valid. Not sure what toc[0].userdata_start.s encodes on homebrew EBOOTs though, so ignore that
+  if (di->toc[0].point != 0xA0 || di->toc[1].point != 0xA1 || di->toc[2].point != 0xA2)
   {
     Log_ErrorPrint("Invalid points on information tracks");
     return false;
   }
 
-  const u8 first_track = PackedBCDToBinary(m_toc[0].userdata_start.m);
-  const u8 last_track = PackedBCDToBinary(m_toc[1].userdata_start.m);
+  const u8 first_track = PackedBCDToBinary(di->toc[0].userdata_start.m);
+  const u8 last_track = PackedBCDToBinary(di->toc[1].userdata_start.m);
   const LBA sectors_on_file =
-    Position::FromBCD(m_toc[2].userdata_start.m, m_toc[2].userdata_start.s, m_toc[2].userdata_start.f).ToLBA();
+    Position::FromBCD(di->toc[2].userdata_start.m, di->toc[2].userdata_start.s, di->toc[2].userdata_start.f).ToLBA();
 
   if (first_track != 1 || last_track < first_track)
   {
@@ -621,7 +671,7 @@ bool CDImagePBP::OpenDisc(u32 index, Error* error)
   for (u32 curr_track = 1; curr_track <= last_track; curr_track++)
   {
     // Load in all the user stuff to m_tracks and m_indices
-    const TOCEntry& t = m_toc[static_cast<size_t>(curr_track) + 2];
+    const TOCEntry& t = di->toc[static_cast<size_t>(curr_track) + 2];
     const u8 track_num = PackedBCDToBinary(t.point);
     if (track_num != curr_track)
       Log_WarningPrintf("Mismatched TOC track number, expected %u but got %u", static_cast<u32>(curr_track), track_num);
@@ -710,7 +760,7 @@ bool CDImagePBP::OpenDisc(u32 index, Error* error)
     }
     else
     {
-      const TOCEntry& next_track = m_toc[static_cast<size_t>(curr_track) + 3];
+      const TOCEntry& next_track = di->toc[static_cast<size_t>(curr_track) + 3];
       const LBA next_track_start =
         Position::FromBCD(next_track.pregap_start.m, next_track.pregap_start.s, next_track.pregap_start.f).ToLBA();
       const u8 next_track_num = PackedBCDToBinary(next_track.point);
@@ -733,13 +783,6 @@ bool CDImagePBP::OpenDisc(u32 index, Error* error)
 
   AddLeadOutIndex();
 
-  // Initialize zlib stream
-  if (!InitDecompressionStream())
-  {
-    Log_ErrorPrint("Failed to initialize zlib decompression stream");
-    return false;
-  }
-
   if (m_disc_offsets.size() > 1)
   {
     const std::string offset_path = fmt::format("{}_{}.pbp", Path::StripExtension(m_filename), index + 1);
@@ -751,6 +794,7 @@ bool CDImagePBP::OpenDisc(u32 index, Error* error)
   }
 
   m_current_disc = index;
+  m_current_disc_info = di;
   return Seek(1, Position{0, 0, 0});
 }
 
@@ -767,52 +811,168 @@ const std::string* CDImagePBP::LookupStringSFOTableEntry(const char* key, const
   return &std::get<std::string>(data_value);
 }
 
-bool CDImagePBP::InitDecompressionStream()
+bool CDImagePBP::InflateBlock(const u8* compressed_data, u32 compressed_size, u8* decompressed_data)
 {
-  m_inflate_stream = {};
-  m_inflate_stream.next_in = Z_NULL;
-  m_inflate_stream.avail_in = 0;
-  m_inflate_stream.zalloc = Z_NULL;
-  m_inflate_stream.zfree = Z_NULL;
-  m_inflate_stream.opaque = Z_NULL;
+  z_stream strm = {};
+  strm.next_in = const_cast<Bytef*>(compressed_data);
+  strm.avail_in = compressed_size;
+  strm.next_out = decompressed_data;
+  strm.avail_out = DECOMPRESSED_BLOCK_SIZE;
+
+  if (inflateInit2(&strm, -MAX_WBITS) != Z_OK)
+    return false;
+
+  const int err = inflate(&strm, Z_FINISH);
+  inflateEnd(&strm);
+  if (err != Z_STREAM_END)
+  {
+    Log_ErrorPrintf("Inflate error %d", err);
+    return false;
+  }
 
-  int ret = inflateInit2(&m_inflate_stream, -MAX_WBITS);
-  return ret == Z_OK;
+  return true;
 }
 
-bool CDImagePBP::DecompressBlock(const BlockInfo& block_info)
+const u8* CDImagePBP::LookupCachedBlock(u32 file_offset)
 {
-  if (FileSystem::FSeek64(m_file, block_info.offset, SEEK_SET) != 0)
-    return false;
+  for (CachedBlock& cb : m_block_cache)
+  {
+    if (cb.valid && cb.file_offset == file_offset)
+    {
+      cb.last_use = ++m_block_cache_counter;
+      return cb.data.data();
+    }
+  }
 
-  // Compression level 0 has compressed size == decompressed size.
-  if (block_info.size == m_decompressed_block.size())
+  return nullptr;
+}
+
+CDImagePBP::CachedBlock* CDImagePBP::AllocateCacheSlot(u32 file_offset)
+{
+  CachedBlock* slot = &m_block_cache[0];
+  for (CachedBlock& cb : m_block_cache)
   {
-    return (std::fread(m_decompressed_block.data(), sizeof(u8), m_decompressed_block.size(), m_file) ==
-            m_decompressed_block.size());
+    if (cb.last_use < slot->last_use)
+      slot = &cb;
   }
 
-  m_compressed_block.resize(block_info.size);
+  slot->file_offset = file_offset;
+  slot->last_use = ++m_block_cache_counter;
+  slot->valid = false;
+  return slot;
+}
 
-  if (std::fread(m_compressed_block.data(), sizeof(u8), m_compressed_block.size(), m_file) != m_compressed_block.size())
-    return false;
+const u8* CDImagePBP::FillBlockCache(u32 requested_block)
+{
+  // Extend the span over the readahead window while the following blocks are valid and not cached
+  // yet, reading each block's compressed data sequentially, then inflate the whole span in
+  // parallel on the thread pool. Sequential streaming pays one batched decompression per
+  // READAHEAD_BLOCKS blocks instead of a synchronous inflate per block.
+  struct PendingBlock
+  {
+    CachedBlock* slot = nullptr;
+    std::vector<u8> compressed_data; // empty for stored (level 0) blocks
+    bool result = false;
+  };
 
-  m_inflate_stream.next_in = m_compressed_block.data();
-  m_inflate_stream.avail_in = static_cast<uInt>(m_compressed_block.size());
-  m_inflate_stream.next_out = m_decompressed_block.data();
-  m_inflate_stream.avail_out = static_cast<uInt>(m_decompressed_block.size());
+  std::array<PendingBlock, READAHEAD_BLOCKS> pending;
+  u32 num_blocks = 0;
+  u32 num_tasks = 0;
 
-  if (inflateReset(&m_inflate_stream) != Z_OK)
-    return false;
+  for (u32 i = 0; i < READAHEAD_BLOCKS; i++)
+  {
+    const u32 block = requested_block + i;
+    if (block >= BLOCK_TABLE_NUM_ENTRIES)
+      break;
 
-  int err = inflate(&m_inflate_stream, Z_FINISH);
-  if (err != Z_STREAM_END)
+    const BlockInfo& bi = m_current_disc_info->blockinfo_table[block];
+    if (bi.size == 0 || (i > 0 && LookupCachedBlock(bi.offset)))
+      break;
+
+    if (FileSystem::FSeek64(m_file, bi.offset, SEEK_SET) != 0)
+    {
+      if (i == 0)
+        return nullptr;
+
+      break;
+    }
+
+    PendingBlock& pb = pending[num_blocks];
+    pb.slot = AllocateCacheSlot(bi.offset);
+
+    // Compression level 0 has compressed size == decompressed size.
+    if (bi.size == DECOMPRESSED_BLOCK_SIZE)
+    {
+      if (std::fread(pb.slot->data.data(), sizeof(u8), pb.slot->data.size(), m_file) != pb.slot->data.size())
+      {
+        if (i == 0)
+          return nullptr;
+
+        break;
+      }
+
+      pb.result = true;
+      num_blocks++;
+      continue;
+    }
+
+    pb.compressed_data.resize(bi.size);
+    if (std::fread(pb.compressed_data.data(), sizeof(u8), pb.compressed_data.size(), m_file) !=
+        pb.compressed_data.size())
+    {
+      if (i == 0)
+        return nullptr;
+
+      break;
+    }
+
+    num_blocks++;
+    num_tasks++;
+  }
+
+  // Not worth a round-trip through the pool for a single block. Join on the group rather than
+  // draining the whole pool, we're on the sector-read hot path and can't wait for other
+  // subsystems' tasks.
+  Threading::TaskGroup task_group;
+  for (u32 i = 0; i < num_blocks; i++)
   {
-    Log_ErrorPrintf("Inflate error %d", err);
-    return false;
+    PendingBlock& pb = pending[i];
+    if (pb.compressed_data.empty())
+      continue;
+
+    if (num_tasks == 1)
+    {
+      pb.result = InflateBlock(pb.compressed_data.data(), static_cast<u32>(pb.compressed_data.size()),
+                               pb.slot->data.data());
+    }
+    else
+    {
+      task_group.QueueTask([&pb]() {
+        pb.result = InflateBlock(pb.compressed_data.data(), static_cast<u32>(pb.compressed_data.size()),
+                                 pb.slot->data.data());
+      });
+    }
   }
 
-  return true;
+  if (num_tasks > 1)
+    task_group.Wait();
+
+  const u8* ret = nullptr;
+  for (u32 i = 0; i < num_blocks; i++)
+  {
+    PendingBlock& pb = pending[i];
+    if (!pb.result)
+    {
+      Log_ErrorPrintf("Failed to decompress block at offset %u", pb.slot->file_offset);
+      continue;
+    }
+
+    pb.slot->valid = true;
+    if (i == 0)
+      ret = pb.slot->data.data();
+  }
+
+  return ret;
 }
 
 bool CDImagePBP::ReadSubChannelQ(SubChannelQ* subq, const Index& index, LBA lba_in_index)
@@ -834,7 +994,7 @@ bool CDImagePBP::ReadSectorFromIndex(void* buffer, const Index& index, LBA lba_i
   const u32 offset_in_block = offset_in_file % DECOMPRESSED_BLOCK_SIZE;
   const u32 requested_block = offset_in_file / DECOMPRESSED_BLOCK_SIZE;
 
-  BlockInfo& bi = m_blockinfo_table[requested_block];
+  const BlockInfo& bi = m_current_disc_info->blockinfo_table[requested_block];
 
   if (bi.size == 0)
   {
@@ -842,13 +1002,20 @@ bool CDImagePBP::ReadSectorFromIndex(void* buffer, const Index& index, LBA lba_i
     return false;
   }
 
-  if (m_current_block != requested_block && !DecompressBlock(bi))
+  if (m_current_block != requested_block)
   {
-    Log_ErrorPrintf("Failed to decompress block %u", requested_block);
-    return false;
+    const u8* block_data = LookupCachedBlock(bi.offset);
+    if (!block_data && !(block_data = FillBlockCache(requested_block)))
+    {
+      Log_ErrorPrintf("Failed to decompress block %u", requested_block);
+      return false;
+    }
+
+    m_current_block = requested_block;
+    m_current_block_data = block_data;
   }
 
-  std::memcpy(buffer, &m_decompressed_block[offset_in_block], RAW_SECTOR_SIZE);
+  std::memcpy(buffer, &m_current_block_data[offset_in_block], RAW_SECTOR_SIZE);
   return true;
 }
 
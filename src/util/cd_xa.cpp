@@ -4,6 +4,8 @@
 #include "cd_xa.h"
 #include "cd_image.h"
 
+#include "common/intrin.h"
+
 #include <algorithm>
 #include <array>
 
@@ -34,7 +36,56 @@ ALWAYS_INLINE_RELEASE static void DecodeXA_ADPCMChunk(const u8* chunk_ptr, s16*
       IS_STEREO ? &samples[(block / 2) * (WORDS_PER_BLOCK * 2) + (block % 2)] : &samples[block * WORDS_PER_BLOCK];
     constexpr u32 out_samples_increment = IS_STEREO ? 2 : 1;
 
-    for (u32 word = 0; word < 28; word++)
+    // Extract and scale all 28 samples for this block up front; only the filter recurrence below
+    // has to run serially, since it carries the previous two samples per channel.
+    s16 block_samples[WORDS_PER_BLOCK];
+
+#if defined(CPU_ARCH_SSE)
+    {
+      const __m128i value_mask = _mm_set1_epi32(IS_8BIT ? 0xFF : 0x0F);
+      const __m128i extract_count = _mm_cvtsi32_si128(static_cast<int>(block * (IS_8BIT ? 8 : 4)));
+      const __m128i shift_count = _mm_cvtsi32_si128(shift);
+      for (u32 word = 0; word < 24; word += 8)
+      {
+        const __m128i w0 = _mm_srl_epi32(
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(&words_ptr[word * sizeof(u32)])), extract_count);
+        const __m128i w1 = _mm_srl_epi32(
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(&words_ptr[(word + 4) * sizeof(u32)])), extract_count);
+        const __m128i packed = _mm_packs_epi32(_mm_and_si128(w0, value_mask), _mm_and_si128(w1, value_mask));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(&block_samples[word]),
+                         _mm_sra_epi16(_mm_slli_epi16(packed, 12), shift_count));
+      }
+
+      const __m128i w0 =
+        _mm_srl_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&words_ptr[24 * sizeof(u32)])), extract_count);
+      const __m128i packed = _mm_packs_epi32(_mm_and_si128(w0, value_mask), _mm_setzero_si128());
+      _mm_storel_epi64(reinterpret_cast<__m128i*>(&block_samples[24]),
+                       _mm_sra_epi16(_mm_slli_epi16(packed, 12), shift_count));
+    }
+#elif defined(CPU_ARCH_NEON)
+    {
+      const uint32x4_t value_mask = vdupq_n_u32(IS_8BIT ? 0xFF : 0x0F);
+      const int32x4_t extract_count = vdupq_n_s32(-static_cast<s32>(block * (IS_8BIT ? 8 : 4)));
+      const int16x8_t shift_count = vdupq_n_s16(-static_cast<s16>(shift));
+      for (u32 word = 0; word < 24; word += 8)
+      {
+        const uint32x4_t w0 =
+          vandq_u32(vshlq_u32(vld1q_u32(reinterpret_cast<const u32*>(&words_ptr[word * sizeof(u32)])), extract_count),
+                    value_mask);
+        const uint32x4_t w1 = vandq_u32(
+          vshlq_u32(vld1q_u32(reinterpret_cast<const u32*>(&words_ptr[(word + 4) * sizeof(u32)])), extract_count),
+          value_mask);
+        const int16x8_t packed = vreinterpretq_s16_u16(vcombine_u16(vmovn_u32(w0), vmovn_u32(w1)));
+        vst1q_s16(&block_samples[word], vshlq_s16(vshlq_n_s16(packed, 12), shift_count));
+      }
+
+      const uint32x4_t w0 = vandq_u32(
+        vshlq_u32(vld1q_u32(reinterpret_cast<const u32*>(&words_ptr[24 * sizeof(u32)])), extract_count), value_mask);
+      const int16x4_t packed = vreinterpret_s16_u16(vmovn_u32(w0));
+      vst1_s16(&block_samples[24], vshl_s16(vshl_n_s16(packed, 12), vget_low_s16(shift_count)));
+    }
+#else
+    for (u32 word = 0; word < WORDS_PER_BLOCK; word++)
     {
       // NOTE: assumes LE
       u32 word_data;
@@ -42,11 +93,16 @@ ALWAYS_INLINE_RELEASE static void DecodeXA_ADPCMChunk(const u8* chunk_ptr, s16*
 
       // extract nibble from block
       const u32 nibble = IS_8BIT ? ((word_data >> (block * 8)) & 0xFF) : ((word_data >> (block * 4)) & 0x0F);
-      const s16 sample = static_cast<s16>(Truncate16(nibble << 12)) >> shift;
+      block_samples[word] = static_cast<s16>(Truncate16(nibble << 12)) >> shift;
+    }
+#endif
 
+    s32* prev = IS_STEREO ? &last_samples[(block & 1) * 2] : last_samples;
+    for (u32 word = 0; word < WORDS_PER_BLOCK; word++)
+    {
       // mix in previous values
-      s32* prev = IS_STEREO ? &last_samples[(block & 1) * 2] : last_samples;
-      const s32 interp_sample = s32(sample) + ((prev[0] * filter_pos) + (prev[1] * filter_neg) + 32) / 64;
+      const s32 interp_sample =
+        s32(block_samples[word]) + ((prev[0] * filter_pos) + (prev[1] * filter_neg) + 32) / 64;
 
       // update previous values
       prev[1] = prev[0];
@@ -182,6 +182,7 @@ void D3D11Device::SetFeatures(FeatureMask disabled_features)
   m_features.gpu_timing = true;
   m_features.shader_cache = true;
   m_features.pipeline_cache = false;
+  m_features.parallel_pipeline_compilation = false;
 }
 
 bool D3D11Device::CreateSwapChain()
@@ -590,6 +591,10 @@ bool D3D11Device::GetHostRefreshRate(float* refresh_rate)
 void D3D11Device::SetVSync(bool enabled)
 {
   m_vsync_enabled = enabled;
+
+  // On the flip model, an unsynchronized present without ALLOW_TEARING gives mailbox-style queued
+  // flips instead of tearing. Re-read the preference here so it can be toggled at runtime.
+  m_prefer_mailbox_presentation = Host::GetBoolSettingValue("Display", "PreferMailboxPresentation", false);
 }
 
 bool D3D11Device::BeginPresent(bool skip_present)
@@ -639,7 +644,7 @@ void D3D11Device::EndPresent()
   if (!m_vsync_enabled && m_gpu_timing_enabled)
     PopTimestampQuery();
 
-  if (!m_vsync_enabled && m_using_allow_tearing)
+  if (!m_vsync_enabled && m_using_allow_tearing && !m_prefer_mailbox_presentation)
     m_swap_chain->Present(0, DXGI_PRESENT_ALLOW_TEARING);
   else
     m_swap_chain->Present(BoolToUInt32(m_vsync_enabled), 0);
@@ -168,6 +168,7 @@ private:
   u32 m_readback_staging_texture_height = 0;
 
   bool m_allow_tearing_supported = false;
+  bool m_prefer_mailbox_presentation = false;
   bool m_using_flip_model_swap_chain = true;
   bool m_using_allow_tearing = false;
   bool m_is_exclusive_fullscreen = false;
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
 
 #include "d3d11_stream_buffer.h"
+#include "gpu_device.h"
 
 #include "common/align.h"
 #include "common/assert.h"
@@ -78,6 +79,10 @@ D3D11StreamBuffer::MappingResult D3D11StreamBuffer::Map(ID3D11DeviceContext1* co
   if ((m_position + min_size) >= m_size || !m_use_map_no_overwrite)
   {
     // wrap around
+    // DISCARD maps get renamed by the driver rather than blocking, so this only counts as a wrap,
+    // not a stall. Don't count anything when NO_OVERWRITE is unusable, since every map discards.
+    if (m_use_map_no_overwrite)
+      GPUDevice::CountStreamBufferWrap();
     m_position = 0;
   }
 
@@ -99,4 +104,5 @@ void D3D11StreamBuffer::Unmap(ID3D11DeviceContext1* context, u32 used_size)
 {
   context->Unmap(m_buffer.Get(), 0);
   m_position += used_size;
+  GPUDevice::CountBytesStreamed(used_size);
 }
@@ -398,10 +398,19 @@ void D3D12Device::MoveToNextCommandList()
     HRESULT hr = m_timestamp_query_buffer->Map(0, &read_range, &map);
     if (SUCCEEDED(hr))
     {
-      u64 timestamps[2];
-      std::memcpy(timestamps, static_cast<const u8*>(map) + offset, sizeof(timestamps));
+      // layout is [start, marker0..markerN-1, end], so the timestamps come back in draw order
+      const u32 num_timestamps = res.num_stage_markers + 2;
+      u64 timestamps[NUM_TIMESTAMP_QUERIES_PER_CMDLIST];
+      std::memcpy(timestamps, static_cast<const u8*>(map) + offset, sizeof(u64) * num_timestamps);
       m_accumulated_gpu_time +=
-        static_cast<float>(static_cast<double>(timestamps[1] - timestamps[0]) / m_timestamp_frequency);
+        static_cast<float>(static_cast<double>(timestamps[num_timestamps - 1] - timestamps[0]) /
+                           m_timestamp_frequency);
+
+      for (u32 i = 0; i < (res.num_stage_markers + 1); i++)
+      {
+        m_accumulated_stage_gpu_time[static_cast<size_t>(res.interval_stages[i])] +=
+          static_cast<float>(static_cast<double>(timestamps[i + 1] - timestamps[i]) / m_timestamp_frequency);
+      }
 
       const D3D12_RANGE write_range = {};
       m_timestamp_query_buffer->Unmap(0, &write_range);
@@ -413,6 +422,8 @@ void D3D12Device::MoveToNextCommandList()
   }
 
   res.has_timestamp_query = m_gpu_timing_enabled;
+  res.num_stage_markers = 0;
+  res.interval_stages[0] = m_current_timing_stage;
   if (m_gpu_timing_enabled)
   {
     res.command_lists[1]->EndQuery(m_timestamp_query_heap.Get(), D3D12_QUERY_TYPE_TIMESTAMP,
@@ -505,12 +516,13 @@ void D3D12Device::SubmitCommandList(bool wait_for_completion)
 
   if (res.has_timestamp_query)
   {
-    // write the timestamp back at the end of the cmdlist
+    // write the timestamp back at the end of the cmdlist, after any stage markers
     res.command_lists[1]->EndQuery(m_timestamp_query_heap.Get(), D3D12_QUERY_TYPE_TIMESTAMP,
-                                   (m_current_command_list * NUM_TIMESTAMP_QUERIES_PER_CMDLIST) + 1);
+                                   (m_current_command_list * NUM_TIMESTAMP_QUERIES_PER_CMDLIST) + 1 +
+                                     res.num_stage_markers);
     res.command_lists[1]->ResolveQueryData(m_timestamp_query_heap.Get(), D3D12_QUERY_TYPE_TIMESTAMP,
                                            m_current_command_list * NUM_TIMESTAMP_QUERIES_PER_CMDLIST,
-                                           NUM_TIMESTAMP_QUERIES_PER_CMDLIST, m_timestamp_query_buffer.Get(),
+                                           res.num_stage_markers + 2, m_timestamp_query_buffer.Get(),
                                            m_current_command_list * (sizeof(u64) * NUM_TIMESTAMP_QUERIES_PER_CMDLIST));
   }
 
@@ -670,6 +682,35 @@ float D3D12Device::GetAndResetAccumulatedGPUTime()
   return time;
 }
 
+float D3D12Device::GetAndResetAccumulatedStageGPUTime(GPUTimingStage stage)
+{
+  const float time = m_accumulated_stage_gpu_time[static_cast<size_t>(stage)];
+  m_accumulated_stage_gpu_time[static_cast<size_t>(stage)] = 0.0f;
+  return time;
+}
+
+void D3D12Device::SetGPUTimingStage(GPUTimingStage stage)
+{
+  if (stage == m_current_timing_stage)
+    return;
+
+  // Track the active stage even when disabled, so the first command list after enabling
+  // attributes its work correctly.
+  m_current_timing_stage = stage;
+  if (!m_gpu_timing_enabled)
+    return;
+
+  CommandList& res = m_command_lists[m_current_command_list];
+  if (!res.has_timestamp_query || res.num_stage_markers == MAX_TIMESTAMP_STAGE_MARKERS)
+    return;
+
+  res.command_lists[1]->EndQuery(m_timestamp_query_heap.Get(), D3D12_QUERY_TYPE_TIMESTAMP,
+                                 (m_current_command_list * NUM_TIMESTAMP_QUERIES_PER_CMDLIST) + 1 +
+                                   res.num_stage_markers);
+  res.num_stage_markers++;
+  res.interval_stages[res.num_stage_markers] = stage;
+}
+
 bool D3D12Device::SetGPUTimingEnabled(bool enabled)
 {
   m_gpu_timing_enabled = enabled && m_features.gpu_timing;
@@ -1053,6 +1094,10 @@ std::string D3D12Device::GetDriverInfo() const
 void D3D12Device::SetVSync(bool enabled)
 {
   m_vsync_enabled = enabled;
+
+  // On the flip model, an unsynchronized present without ALLOW_TEARING gives mailbox-style queued
+  // flips instead of tearing. Re-read the preference here so it can be toggled at runtime.
+  m_prefer_mailbox_presentation = Host::GetBoolSettingValue("Display", "PreferMailboxPresentation", false);
 }
 
 bool D3D12Device::BeginPresent(bool frame_skip)
@@ -1100,14 +1145,27 @@ void D3D12Device::EndPresent()
   D3D12Texture::TransitionSubresourceToState(cmdlist, swap_chain_buf.first.Get(), 0, D3D12_RESOURCE_STATE_RENDER_TARGET,
                                              D3D12_RESOURCE_STATE_PRESENT);
 
+  const u64 presented_fence_value = m_command_lists[m_current_command_list].fence_counter;
   SubmitCommandList(false);
 
-  if (!m_vsync_enabled && m_using_allow_tearing)
+  if (!m_vsync_enabled && m_using_allow_tearing && !m_prefer_mailbox_presentation)
     m_swap_chain->Present(0, DXGI_PRESENT_ALLOW_TEARING);
   else
     m_swap_chain->Present(static_cast<UINT>(m_vsync_enabled), 0);
 
   TrimTexturePool();
+
+  // If the user has requested a lower queue depth than the command list rotation gives us, wait
+  // for the presents before the last N to reach the GPU before returning to emulation.
+  if (m_max_queued_frames > 0)
+  {
+    m_present_fence_values[m_present_fence_value_pos] = presented_fence_value;
+    const u32 wait_pos = (m_present_fence_value_pos + NUM_COMMAND_LISTS -
+                          std::min<u32>(m_max_queued_frames, NUM_COMMAND_LISTS - 1)) %
+                         NUM_COMMAND_LISTS;
+    m_present_fence_value_pos = (m_present_fence_value_pos + 1) % NUM_COMMAND_LISTS;
+    WaitForFence(m_present_fence_values[wait_pos]);
+  }
 }
 
 #ifdef _DEBUG
@@ -1188,6 +1246,9 @@ void D3D12Device::SetFeatures(FeatureMask disabled_features)
   m_features.shader_cache = true;
   m_features.pipeline_cache = true;
 
+  // Both the device and pipeline libraries are free-threaded.
+  m_features.parallel_pipeline_compilation = true;
+
   BOOL allow_tearing_supported = false;
   HRESULT hr = m_dxgi_factory->CheckFeatureSupport(DXGI_FEATURE_PRESENT_ALLOW_TEARING, &allow_tearing_supported,
                                                    sizeof(allow_tearing_supported));
@@ -1795,6 +1856,7 @@ bool D3D12Device::IsRenderTargetBound(const GPUTexture* tex) const
 
 void D3D12Device::InvalidateCachedState()
 {
+  m_srv_group_cache.clear();
   m_dirty_flags = ALL_DIRTY_STATE;
   m_in_render_pass = false;
   m_current_pipeline = nullptr;
@@ -2000,6 +2062,64 @@ void D3D12Device::PreDrawCheck()
     BeginRenderPass();
 }
 
+bool D3D12Device::GetTextureGroupDescriptors(D3D12DescriptorHandle* gpu_handle, u32 num_textures)
+{
+  SRVGroupKey key;
+  D3D12_CPU_DESCRIPTOR_HANDLE src_handles[MAX_TEXTURE_SAMPLERS];
+  UINT src_sizes[MAX_TEXTURE_SAMPLERS];
+  for (u32 i = 0; i < num_textures; i++)
+  {
+    const D3D12DescriptorHandle& handle =
+      m_current_textures[i] ? m_current_textures[i]->GetSRVDescriptor() : m_null_srv_descriptor;
+    key.idx[i] = handle.index;
+    src_handles[i] = handle;
+    src_sizes[i] = 1;
+  }
+  for (u32 i = num_textures; i < MAX_TEXTURE_SAMPLERS; i++)
+    key.idx[i] = D3D12DescriptorHandle::INVALID_INDEX;
+
+  const auto it = m_srv_group_cache.find(key);
+  if (it != m_srv_group_cache.end())
+  {
+    *gpu_handle = it->second;
+    return true;
+  }
+
+  D3D12DescriptorAllocator& allocator = m_command_lists[m_current_command_list].descriptor_allocator;
+  if (!allocator.Allocate(num_textures, gpu_handle))
+    return false;
+
+  if (num_textures == 1)
+  {
+    m_device->CopyDescriptorsSimple(1, *gpu_handle, src_handles[0], D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+  }
+  else
+  {
+    m_device->CopyDescriptors(1, &gpu_handle->cpu_handle, &num_textures, num_textures, src_handles, src_sizes,
+                              D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+  }
+
+  m_srv_group_cache.emplace(key, *gpu_handle);
+  return true;
+}
+
+void D3D12Device::PurgeSRVGroups(const D3D12DescriptorHandle& handle)
+{
+  if (handle.index == D3D12DescriptorHandle::INVALID_INDEX)
+    return;
+
+  for (auto it = m_srv_group_cache.begin(); it != m_srv_group_cache.end();)
+  {
+    bool references_handle = false;
+    for (u32 i = 0; i < MAX_TEXTURE_SAMPLERS; i++)
+      references_handle |= (it->first.idx[i] == handle.index);
+    if (references_handle)
+      it = m_srv_group_cache.erase(it);
+    else
+      ++it;
+  }
+}
+
 void D3D12Device::UpdateRootSignature()
 {
   GetCommandList()->SetGraphicsRootSignature(m_root_signatures[static_cast<u8>(m_current_pipeline_layout)].Get());
@@ -2019,30 +2139,10 @@ bool D3D12Device::UpdateParametersForLayout(u32 dirty)
   constexpr u32 num_textures = GetActiveTexturesForLayout(layout);
   if (dirty & DIRTY_FLAG_TEXTURES && num_textures > 0)
   {
-    D3D12DescriptorAllocator& allocator = m_command_lists[m_current_command_list].descriptor_allocator;
     D3D12DescriptorHandle gpu_handle;
-    if (!allocator.Allocate(num_textures, &gpu_handle))
+    if (!GetTextureGroupDescriptors(&gpu_handle, num_textures))
       return false;
 
-    if constexpr (num_textures == 1)
-    {
-      m_device->CopyDescriptorsSimple(
-        1, gpu_handle, m_current_textures[0] ? m_current_textures[0]->GetSRVDescriptor() : m_null_srv_descriptor,
-        D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-    }
-    else
-    {
-      D3D12_CPU_DESCRIPTOR_HANDLE src_handles[MAX_TEXTURE_SAMPLERS];
-      UINT src_sizes[MAX_TEXTURE_SAMPLERS];
-      for (u32 i = 0; i < num_textures; i++)
-      {
-        src_handles[i] = m_current_textures[i] ? m_current_textures[i]->GetSRVDescriptor() : m_null_srv_descriptor;
-        src_sizes[i] = 1;
-      }
-      m_device->CopyDescriptors(1, &gpu_handle.cpu_handle, &num_textures, num_textures, src_handles, src_sizes,
-                                D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-    }
-
     cmdlist->SetGraphicsRootDescriptorTable(0, gpu_handle);
   }
 
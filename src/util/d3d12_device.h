@@ -47,8 +47,9 @@ public:
   {
     NUM_COMMAND_LISTS = 3,
 
-    /// Start/End timestamp queries.
-    NUM_TIMESTAMP_QUERIES_PER_CMDLIST = 2,
+    /// Start/end timestamp queries, with the remainder available for stage boundary markers.
+    NUM_TIMESTAMP_QUERIES_PER_CMDLIST = 16,
+    MAX_TIMESTAMP_STAGE_MARKERS = NUM_TIMESTAMP_QUERIES_PER_CMDLIST - 2,
   };
 
 public:
@@ -113,6 +114,8 @@ public:
 
   bool SetGPUTimingEnabled(bool enabled) override;
   float GetAndResetAccumulatedGPUTime() override;
+  void SetGPUTimingStage(GPUTimingStage stage) override;
+  float GetAndResetAccumulatedStageGPUTime(GPUTimingStage stage) override;
 
   void SetVSync(bool enabled) override;
 
@@ -205,10 +208,31 @@ private:
     bool init_list_used = false;
     bool needs_fence_wait = false;
     bool has_timestamp_query = false;
+    u32 num_stage_markers = 0;
+    std::array<GPUTimingStage, MAX_TIMESTAMP_STAGE_MARKERS + 1> interval_stages{};
   };
 
   using SamplerMap = std::unordered_map<u64, D3D12DescriptorHandle>;
 
+  struct SRVGroupKey
+  {
+    u32 idx[MAX_TEXTURE_SAMPLERS];
+
+    ALWAYS_INLINE bool operator==(const SRVGroupKey& rhs) const { return (std::memcmp(idx, rhs.idx, sizeof(idx)) == 0); }
+    ALWAYS_INLINE bool operator!=(const SRVGroupKey& rhs) const { return (std::memcmp(idx, rhs.idx, sizeof(idx)) != 0); }
+  };
+
+  struct SRVGroupKeyHash
+  {
+    ALWAYS_INLINE std::size_t operator()(const SRVGroupKey& key) const
+    {
+      size_t seed = 0;
+      for (u32 i : key.idx)
+        hash_combine(seed, i);
+      return seed;
+    }
+  };
+
   static void GetAdapterAndModeList(AdapterAndModeList* ret, IDXGIFactory5* factory);
 
   void SetFeatures(FeatureMask disabled_features);
@@ -262,6 +286,9 @@ private:
   bool UpdateParametersForLayout(u32 dirty);
   bool UpdateRootParameters(u32 dirty);
 
+  bool GetTextureGroupDescriptors(D3D12DescriptorHandle* gpu_handle, u32 num_textures);
+  void PurgeSRVGroups(const D3D12DescriptorHandle& handle);
+
   // Ends a render pass if we're currently in one.
   // When Bind() is next called, the pass will be restarted.
   void BeginRenderPass();
@@ -281,6 +308,8 @@ private:
 
   std::array<CommandList, NUM_COMMAND_LISTS> m_command_lists;
   u32 m_current_command_list = NUM_COMMAND_LISTS - 1;
+  std::array<u64, NUM_COMMAND_LISTS> m_present_fence_values = {};
+  u32 m_present_fence_value_pos = 0;
   D3D_FEATURE_LEVEL m_feature_level = D3D_FEATURE_LEVEL_11_0;
 
   ComPtr<IDXGIFactory5> m_dxgi_factory;
@@ -288,6 +317,7 @@ private:
   std::vector<std::pair<ComPtr<ID3D12Resource>, D3D12DescriptorHandle>> m_swap_chain_buffers;
   u32 m_current_swap_chain_buffer = 0;
   bool m_allow_tearing_supported = false;
+  bool m_prefer_mailbox_presentation = false;
   bool m_using_allow_tearing = false;
   bool m_is_exclusive_fullscreen = false;
 
@@ -303,6 +333,8 @@ private:
   ComPtr<D3D12MA::Allocation> m_timestamp_query_allocation;
   double m_timestamp_frequency = 0.0;
   float m_accumulated_gpu_time = 0.0f;
+  GPUTimingStage m_current_timing_stage = GPUTimingStage::Other;
+  std::array<float, static_cast<size_t>(GPUTimingStage::MaxCount)> m_accumulated_stage_gpu_time = {};
 
   std::deque<std::pair<u64, std::pair<D3D12MA::Allocation*, ID3D12Object*>>> m_cleanup_resources;
   std::deque<std::pair<u64, std::pair<D3D12DescriptorHeapManager*, D3D12DescriptorHandle>>> m_cleanup_descriptors;
@@ -320,6 +352,10 @@ private:
   SamplerMap m_sampler_map;
   ComPtr<ID3D12PipelineLibrary> m_pipeline_library;
 
+  // Caches texture SRV groups copied into the current command list's shader-visible heap, so draws
+  // which rebind a previously-seen texture set reuse the table instead of re-copying descriptors.
+  std::unordered_map<SRVGroupKey, D3D12DescriptorHandle, SRVGroupKeyHash> m_srv_group_cache;
+
   ComPtr<D3D12MA::Allocation> m_download_buffer_allocation;
   ComPtr<ID3D12Resource> m_download_buffer;
   u32 m_download_buffer_size = 0;
@@ -3,6 +3,7 @@
 
 #include "d3d12_stream_buffer.h"
 #include "d3d12_device.h"
+#include "gpu_device.h"
 
 #include "common/align.h"
 #include "common/assert.h"
@@ -96,6 +97,7 @@ bool D3D12StreamBuffer::ReserveMemory(u32 num_bytes, u32 alignment)
       // Reset offset to zero, since we're allocating behind the gpu now
       m_current_offset = 0;
       m_current_space = m_current_gpu_position;
+      GPUDevice::CountStreamBufferWrap();
       return true;
     }
   }
@@ -126,6 +128,7 @@ bool D3D12StreamBuffer::ReserveMemory(u32 num_bytes, u32 alignment)
   // We tried everything we could, and still couldn't get anything. This means that too much space
   // in the buffer is being used by the command buffer currently being recorded. Therefore, the
   // only option is to execute it, and wait until it's done.
+  GPUDevice::CountStreamBufferStall();
   return false;
 }
 
@@ -135,6 +138,7 @@ void D3D12StreamBuffer::CommitMemory(u32 final_num_bytes)
   DebugAssert(final_num_bytes <= m_current_space);
   m_current_offset += final_num_bytes;
   m_current_space -= final_num_bytes;
+  GPUDevice::CountBytesStreamed(final_num_bytes);
 }
 
 void D3D12StreamBuffer::Destroy(bool defer)
@@ -263,6 +267,7 @@ bool D3D12StreamBuffer::WaitForClearSpace(u32 num_bytes)
     return false;
 
   // Wait until this fence is signaled. This will fire the callback, updating the GPU position.
+  GPUDevice::CountStreamBufferStall();
   D3D12Device::GetInstance().WaitForFence(iter->first);
   m_tracked_fences.erase(m_tracked_fences.begin(), m_current_offset == iter->second ? m_tracked_fences.end() : ++iter);
   m_current_offset = new_offset;
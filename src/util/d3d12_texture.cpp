@@ -273,6 +273,7 @@ void D3D12Texture::Destroy(bool defer)
 {
   D3D12Device& dev = D3D12Device::GetInstance();
   dev.UnbindTexture(this);
+  dev.PurgeSRVGroups(m_srv_descriptor);
 
   if (defer)
   {
@@ -333,6 +333,16 @@ void GPUDevice::OpenShaderCache(const std::string_view& base_path, u32 version)
     m_shader_cache.Open(std::string_view(), version);
   }
 
+  if (m_features.shader_cache)
+  {
+    // Precompiled shaders shipped with the program, if present. Only used as a read source, runtime
+    // compiles still land in the user's cache. The files use the same format as the user cache, so
+    // an archive is produced by warming a cache and copying it into the resources directory.
+    const std::string shipped_filename = Path::Combine(EmuFolders::Resources, GetShaderCacheBaseName("shaders"));
+    if (m_shipped_shader_cache.OpenReadOnly(shipped_filename.c_str(), version))
+      Log_InfoPrintf("Using precompiled shader cache at '%s'.", shipped_filename.c_str());
+  }
+
   s_pipeline_cache_path = {};
   if (m_features.pipeline_cache && !base_path.empty())
   {
@@ -348,27 +358,31 @@ void GPUDevice::OpenShaderCache(const std::string_view& base_path, u32 version)
 void GPUDevice::CloseShaderCache()
 {
   m_shader_cache.Close();
+  m_shipped_shader_cache.Close();
+  FlushPipelineCache();
+  s_pipeline_cache_path = {};
+}
 
-  if (!s_pipeline_cache_path.empty())
-  {
-    DynamicHeapArray<u8> data;
-    if (GetPipelineCacheData(&data))
-    {
-      // Save disk writes if it hasn't changed, think of the poor SSDs.
-      FILESYSTEM_STAT_DATA sd;
-      if (!FileSystem::StatFile(s_pipeline_cache_path.c_str(), &sd) || sd.Size != static_cast<s64>(data.size()))
-      {
-        Log_InfoPrintf("Writing %zu bytes to '%s'", data.size(), s_pipeline_cache_path.c_str());
-        if (!FileSystem::WriteBinaryFile(s_pipeline_cache_path.c_str(), data.data(), data.size()))
-          Log_ErrorPrintf("Failed to write pipeline cache to '%s'", s_pipeline_cache_path.c_str());
-      }
-      else
-      {
-        Log_InfoPrintf("Skipping updating pipeline cache '%s' due to no changes.", s_pipeline_cache_path.c_str());
-      }
-    }
+void GPUDevice::FlushPipelineCache()
+{
+  if (s_pipeline_cache_path.empty())
+    return;
+
+  DynamicHeapArray<u8> data;
+  if (!GetPipelineCacheData(&data))
+    return;
 
-    s_pipeline_cache_path = {};
+  // Save disk writes if it hasn't changed, think of the poor SSDs.
+  FILESYSTEM_STAT_DATA sd;
+  if (!FileSystem::StatFile(s_pipeline_cache_path.c_str(), &sd) || sd.Size != static_cast<s64>(data.size()))
+  {
+    Log_InfoPrintf("Writing %zu bytes to '%s'", data.size(), s_pipeline_cache_path.c_str());
+    if (!FileSystem::WriteBinaryFile(s_pipeline_cache_path.c_str(), data.data(), data.size()))
+      Log_ErrorPrintf("Failed to write pipeline cache to '%s'", s_pipeline_cache_path.c_str());
+  }
+  else
+  {
+    Log_InfoPrintf("Skipping updating pipeline cache '%s' due to no changes.", s_pipeline_cache_path.c_str());
   }
 }
 
@@ -610,15 +624,15 @@ std::unique_ptr<GPUShader> GPUDevice::CreateShader(GPUShaderStage stage, const s
                                                    const char* entry_point /* = "main" */)
 {
   std::unique_ptr<GPUShader> shader;
-  if (!m_shader_cache.IsOpen())
+  if (!m_shader_cache.IsOpen() && !m_shipped_shader_cache.IsOpen())
   {
     shader = CreateShaderFromSource(stage, source, entry_point, nullptr);
     return shader;
   }
 
-  const GPUShaderCache::CacheIndexKey key = m_shader_cache.GetCacheKey(stage, source, entry_point);
+  const GPUShaderCache::CacheIndexKey key = GPUShaderCache::GetCacheKey(stage, source, entry_point);
   DynamicHeapArray<u8> binary;
-  if (m_shader_cache.Lookup(key, &binary))
+  if (m_shader_cache.IsOpen() && m_shader_cache.Lookup(key, &binary))
   {
     shader = CreateShaderFromBinary(stage, binary);
     if (shader)
@@ -628,6 +642,21 @@ std::unique_ptr<GPUShader> GPUDevice::CreateShader(GPUShaderStage stage, const s
     m_shader_cache.Clear();
   }
 
+  // Check for a precompiled shader shipped in resources before invoking the compiler.
+  if (m_shipped_shader_cache.IsOpen() && m_shipped_shader_cache.Lookup(key, &binary))
+  {
+    shader = CreateShaderFromBinary(stage, binary);
+    if (shader)
+    {
+      // Copy it across to the user's cache, so later runs don't need the shipped archive.
+      if (m_shader_cache.IsOpen())
+        m_shader_cache.Insert(key, binary.data(), static_cast<u32>(binary.size()));
+      return shader;
+    }
+
+    Log_WarningPrintf("Precompiled shader was rejected, compiling at runtime.");
+  }
+
   shader = CreateShaderFromSource(stage, source, entry_point, &binary);
   if (!shader)
     return shader;
@@ -903,6 +932,24 @@ float GPUDevice::GetAndResetAccumulatedGPUTime()
   return 0.0f;
 }
 
+void GPUDevice::SetGPUTimingStage(GPUTimingStage stage)
+{
+}
+
+float GPUDevice::GetAndResetAccumulatedStageGPUTime(GPUTimingStage stage)
+{
+  return 0.0f;
+}
+
+GPUDevice::StreamBufferStats GPUDevice::s_stream_buffer_stats = {};
+
+GPUDevice::StreamBufferStats GPUDevice::GetAndResetStreamBufferStats()
+{
+  const StreamBufferStats ret = s_stream_buffer_stats;
+  s_stream_buffer_stats = {};
+  return ret;
+}
+
 std::unique_ptr<GPUDevice> GPUDevice::CreateDeviceForAPI(RenderAPI api)
 {
   switch (api)
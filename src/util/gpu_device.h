@@ -451,6 +451,7 @@ public:
     bool gpu_timing : 1;
     bool shader_cache : 1;
     bool pipeline_cache : 1;
+    bool parallel_pipeline_compilation : 1;
   };
 
   struct AdapterAndModeList
@@ -626,6 +627,17 @@ public:
   ALWAYS_INLINE bool IsVsyncEnabled() const { return m_vsync_enabled; }
   virtual void SetVSync(bool enabled) = 0;
 
+  /// Limits the number of presented frames the GPU can queue up behind the one currently being
+  /// recorded. Lower values reduce input latency at the cost of CPU/GPU overlap, zero leaves the
+  /// queue depth up to the backend.
+  ALWAYS_INLINE u32 GetMaxQueuedFrames() const { return m_max_queued_frames; }
+  ALWAYS_INLINE void SetMaxQueuedFrames(u32 max_queued_frames) { m_max_queued_frames = max_queued_frames; }
+
+  /// Writes the driver pipeline cache out to disk if it has changed. Called implicitly on
+  /// shutdown, but can be called after up-front pipeline compilation so a later crash does not
+  /// throw the warm cache away.
+  void FlushPipelineCache();
+
   ALWAYS_INLINE bool IsDebugDevice() const { return m_debug_device; }
 
   bool UpdateImGuiFontTexture();
@@ -644,6 +656,41 @@ public:
   /// Returns the amount of GPU time utilized since the last time this method was called.
   virtual float GetAndResetAccumulatedGPUTime();
 
+  /// Stages which GPU time can be attributed to when timing is enabled. Boundaries are marked by
+  /// the caller; all work recorded after a boundary is attributed to that stage.
+  enum class GPUTimingStage : u8
+  {
+    Other,
+    Draw,
+    VRAMUpdate,
+    Present,
+    MaxCount
+  };
+
+  /// Marks the start of a timing stage in the current command stream. No-op if the backend does
+  /// not support timestamps mid-command-buffer, or GPU timing is disabled.
+  virtual void SetGPUTimingStage(GPUTimingStage stage);
+
+  /// Returns the GPU time attributed to the given stage since the last time this method was called.
+  virtual float GetAndResetAccumulatedStageGPUTime(GPUTimingStage stage);
+
+  /// Streaming-buffer telemetry. The ring staging implementations are backend-specific, tied to
+  /// each API's fencing and mapping primitives, but they all share the same failure mode: an
+  /// allocation wraps onto in-flight data and the CPU has to wait for the GPU to retire it. The
+  /// backends feed these counters from their stall paths; the renderer drains them once per frame
+  /// so undersized buffers show up in the log instead of as unexplained frame time.
+  struct StreamBufferStats
+  {
+    u32 buffer_stalls; // allocations that had to wait for in-flight GPU work to retire
+    u32 buffer_wraps;  // allocations that wrapped back around to the start of a ring
+    u64 bytes_streamed;
+  };
+
+  static StreamBufferStats GetAndResetStreamBufferStats();
+  ALWAYS_INLINE static void CountStreamBufferStall() { s_stream_buffer_stats.buffer_stalls++; }
+  ALWAYS_INLINE static void CountStreamBufferWrap() { s_stream_buffer_stats.buffer_wraps++; }
+  ALWAYS_INLINE static void CountBytesStreamed(u32 bytes) { s_stream_buffer_stats.bytes_streamed += bytes; }
+
 protected:
   virtual bool CreateDevice(const std::string_view& adapter, bool threaded_presentation,
                             FeatureMask disabled_features) = 0;
@@ -669,6 +716,7 @@ protected:
   WindowInfo m_window_info;
 
   GPUShaderCache m_shader_cache;
+  GPUShaderCache m_shipped_shader_cache;
 
   std::unique_ptr<GPUSampler> m_nearest_sampler;
   std::unique_ptr<GPUSampler> m_linear_sampler;
@@ -676,6 +724,9 @@ protected:
 private:
   static constexpr u32 POOL_PURGE_DELAY = 60;
 
+  // Only ever touched from the GPU thread, so plain counters suffice.
+  static StreamBufferStats s_stream_buffer_stats;
+
   struct TexturePoolKey
   {
     u16 width;
@@ -719,6 +770,7 @@ private:
   float m_display_frame_interval = 0.0f;
 
 protected:
+  u32 m_max_queued_frames = 0;
   bool m_gpu_timing_enabled = false;
   bool m_vsync_enabled = false;
   bool m_debug_device = false;
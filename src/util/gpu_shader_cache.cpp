@@ -4,6 +4,7 @@
 #include "gpu_shader_cache.h"
 #include "gpu_device.h"
 
+#include "common/assert.h"
 #include "common/file_system.h"
 #include "common/heap_array.h"
 #include "common/log.h"
@@ -60,6 +61,7 @@ bool GPUShaderCache::Open(const std::string_view& base_filename, u32 version)
 {
   m_base_filename = base_filename;
   m_version = version;
+  m_read_only = false;
 
   if (base_filename.empty())
     return true;
@@ -69,6 +71,23 @@ bool GPUShaderCache::Open(const std::string_view& base_filename, u32 version)
   return ReadExisting(index_filename, blob_filename);
 }
 
+bool GPUShaderCache::OpenReadOnly(const std::string_view& base_filename, u32 version)
+{
+  m_base_filename = base_filename;
+  m_version = version;
+  m_read_only = true;
+
+  if (base_filename.empty())
+    return false;
+
+  const std::string index_filename = fmt::format("{}.idx", m_base_filename);
+  const std::string blob_filename = fmt::format("{}.bin", m_base_filename);
+  if (!FileSystem::FileExists(index_filename.c_str()))
+    return false;
+
+  return ReadExisting(index_filename, blob_filename);
+}
+
 bool GPUShaderCache::Create()
 {
   const std::string index_filename = fmt::format("{}.idx", m_base_filename);
@@ -92,7 +111,7 @@ void GPUShaderCache::Close()
 
 void GPUShaderCache::Clear()
 {
-  if (!IsOpen())
+  if (!IsOpen() || m_read_only)
     return;
 
   Close();
@@ -148,12 +167,12 @@ bool GPUShaderCache::CreateNew(const std::string& index_filename, const std::str
 
 bool GPUShaderCache::ReadExisting(const std::string& index_filename, const std::string& blob_filename)
 {
-  m_index_file = FileSystem::OpenCFile(index_filename.c_str(), "r+b");
+  m_index_file = FileSystem::OpenCFile(index_filename.c_str(), m_read_only ? "rb" : "r+b");
   if (!m_index_file)
   {
     // special case here: when there's a sharing violation (i.e. two instances running),
     // we don't want to blow away the cache. so just continue without a cache.
-    if (errno == EACCES)
+    if (!m_read_only && errno == EACCES)
     {
       Log_WarningPrintf("Failed to open shader cache index with EACCES, are you running two instances?");
       return true;
@@ -171,7 +190,7 @@ bool GPUShaderCache::ReadExisting(const std::string& index_filename, const std::
     return false;
   }
 
-  m_blob_file = FileSystem::OpenCFile(blob_filename.c_str(), "a+b");
+  m_blob_file = FileSystem::OpenCFile(blob_filename.c_str(), m_read_only ? "rb" : "a+b");
   if (!m_blob_file)
   {
     Log_ErrorPrintf("Blob file '%s' is missing", blob_filename.c_str());
@@ -277,6 +296,8 @@ bool GPUShaderCache::Lookup(const CacheIndexKey& key, ShaderBinary* binary)
 
 bool GPUShaderCache::Insert(const CacheIndexKey& key, const void* data, u32 data_size)
 {
+  DebugAssert(!m_read_only);
+
   DynamicHeapArray<u8> compress_buffer(ZSTD_compressBound(data_size));
   const size_t compress_result = ZSTD_compress(compress_buffer.data(), compress_buffer.size(), data, data_size, 0);
   if (ZSTD_isError(compress_result))
@@ -47,6 +47,11 @@ public:
   bool IsOpen() const { return (m_index_file != nullptr); }
 
   bool Open(const std::string_view& base_filename, u32 version);
+
+  /// Opens an existing cache without write access, e.g. a precompiled cache shipped with the program.
+  /// Fails silently when the files are missing, so it can be probed unconditionally.
+  bool OpenReadOnly(const std::string_view& base_filename, u32 version);
+
   bool Create();
   void Close();
 
@@ -77,4 +82,5 @@ private:
 
   std::FILE* m_index_file = nullptr;
   std::FILE* m_blob_file = nullptr;
+  bool m_read_only = false;
 };
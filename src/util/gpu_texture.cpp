@@ -6,6 +6,8 @@
 
 #include "common/bitutils.h"
 #include "common/log.h"
+#include "common/memory_tracker.h"
+#include "common/pixel_convert.h"
 #include "common/string_util.h"
 
 Log_SetChannel(GPUTexture);
@@ -16,9 +18,26 @@ GPUTexture::GPUTexture(u16 width, u16 height, u8 layers, u8 levels, u8 samples,
   : m_width(width), m_height(height), m_layers(layers), m_levels(levels), m_samples(samples), m_type(type),
     m_format(format)
 {
+  MemoryTracker::TrackAllocation(MemoryTracker::Tag::GPUTexture, EstimateVRAMUsage());
 }
 
-GPUTexture::~GPUTexture() = default;
+GPUTexture::~GPUTexture()
+{
+  // Textures released through ClearBaseProperties() were already untracked, and estimate zero here.
+  MemoryTracker::TrackFree(MemoryTracker::Tag::GPUTexture, EstimateVRAMUsage());
+}
+
+u32 GPUTexture::EstimateVRAMUsage() const
+{
+  u32 size = static_cast<u32>(m_width) * static_cast<u32>(m_height) * static_cast<u32>(m_samples) *
+             GetPixelSize(m_format);
+
+  // full mip chain converges to 4/3 of the base level
+  if (m_levels > 1)
+    size += size / 3;
+
+  return size * static_cast<u32>(m_layers);
+}
 
 const char* GPUTexture::GetFormatName(Format format)
 {
@@ -50,6 +69,8 @@ const char* GPUTexture::GetFormatName(Format format)
 
 void GPUTexture::ClearBaseProperties()
 {
+  MemoryTracker::TrackFree(MemoryTracker::Tag::GPUTexture, EstimateVRAMUsage());
+
   m_width = 0;
   m_height = 0;
   m_layers = 0;
@@ -151,8 +172,7 @@ bool GPUTexture::ConvertTextureDataToRGBA8(u32 width, u32 height, std::vector<u3
       for (u32 y = 0; y < height; y++)
       {
         u32* pixels = reinterpret_cast<u32*>(reinterpret_cast<u8*>(texture_data.data()) + (y * texture_data_stride));
-        for (u32 x = 0; x < width; x++)
-          pixels[x] = (pixels[x] & 0xFF00FF00) | ((pixels[x] & 0xFF) << 16) | ((pixels[x] >> 16) & 0xFF);
+        PixelConvert::SwapRedBlueRow(pixels, width);
       }
 
       return true;
@@ -168,20 +188,7 @@ bool GPUTexture::ConvertTextureDataToRGBA8(u32 width, u32 height, std::vector<u3
       for (u32 y = 0; y < height; y++)
       {
         const u8* pixels_in = reinterpret_cast<u8*>(texture_data.data()) + (y * texture_data_stride);
-        u32* pixels_out = &temp[y * width];
-
-        for (u32 x = 0; x < width; x++)
-        {
-          // RGB565 -> RGBA8
-          u16 pixel_in;
-          std::memcpy(&pixel_in, pixels_in, sizeof(u16));
-          pixels_in += sizeof(u16);
-          const u8 r5 = Truncate8(pixel_in >> 11);
-          const u8 g6 = Truncate8((pixel_in >> 5) & 0x3F);
-          const u8 b5 = Truncate8(pixel_in & 0x1F);
-          *(pixels_out++) = ZeroExtend32((r5 << 3) | (r5 & 7)) | (ZeroExtend32((g6 << 2) | (g6 & 3)) << 8) |
-                            (ZeroExtend32((b5 << 3) | (b5 & 7)) << 16) | (0xFF000000u);
-        }
+        PixelConvert::RGB565RowToRGBA8888(&temp[y * width], reinterpret_cast<const u16*>(pixels_in), width);
       }
 
       texture_data = std::move(temp);
@@ -196,21 +203,7 @@ bool GPUTexture::ConvertTextureDataToRGBA8(u32 width, u32 height, std::vector<u3
       for (u32 y = 0; y < height; y++)
       {
         const u8* pixels_in = reinterpret_cast<u8*>(texture_data.data()) + (y * texture_data_stride);
-        u32* pixels_out = &temp[y * width];
-
-        for (u32 x = 0; x < width; x++)
-        {
-          // RGBA5551 -> RGBA8
-          u16 pixel_in;
-          std::memcpy(&pixel_in, pixels_in, sizeof(u16));
-          pixels_in += sizeof(u16);
-          const u8 a1 = Truncate8(pixel_in >> 15);
-          const u8 r5 = Truncate8((pixel_in >> 10) & 0x1F);
-          const u8 g6 = Truncate8((pixel_in >> 5) & 0x1F);
-          const u8 b5 = Truncate8(pixel_in & 0x1F);
-          *(pixels_out++) = ZeroExtend32((r5 << 3) | (r5 & 7)) | (ZeroExtend32((g6 << 3) | (g6 & 7)) << 8) |
-                            (ZeroExtend32((b5 << 3) | (b5 & 7)) << 16) | (a1 ? 0xFF000000u : 0u);
-        }
+        PixelConvert::RGBA5551RowToRGBA8888(&temp[y * width], reinterpret_cast<const u16*>(pixels_in), width);
       }
 
       texture_data = std::move(temp);
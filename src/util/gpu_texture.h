@@ -90,6 +90,9 @@ public:
   ALWAYS_INLINE u32 GetMipWidth(u32 level) const { return std::max<u32>(m_width >> level, 1u); }
   ALWAYS_INLINE u32 GetMipHeight(u32 level) const { return std::max<u32>(m_height >> level, 1u); }
 
+  /// Approximate VRAM footprint of this texture, ignoring any backend padding/alignment.
+  u32 EstimateVRAMUsage() const;
+
   ALWAYS_INLINE State GetState() const { return m_state; }
   ALWAYS_INLINE void SetState(State state) { m_state = state; }
   ALWAYS_INLINE bool IsDirty() const { return (m_state == State::Dirty); }
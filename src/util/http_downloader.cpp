@@ -4,13 +4,33 @@
 #include "http_downloader.h"
 
 #include "common/assert.h"
+#include "common/file_system.h"
 #include "common/log.h"
+#include "common/path.h"
 #include "common/progress_callback.h"
 #include "common/string_util.h"
 #include "common/timer.h"
 
+#include "fmt/format.h"
+#include "xxhash.h"
+
 Log_SetChannel(HTTPDownloader);
 
+namespace {
+#pragma pack(push, 1)
+struct CACHE_ENTRY_HEADER
+{
+  u32 signature; // CACHE_ENTRY_SIGNATURE
+  u32 content_type_length;
+  u32 etag_length;
+  u32 last_modified_length;
+  u32 data_length;
+};
+#pragma pack(pop)
+} // namespace
+
+static constexpr u32 CACHE_ENTRY_SIGNATURE = 0x43444548; // 'HEDC'
+
 static constexpr float DEFAULT_TIMEOUT_IN_SECONDS = 30;
 static constexpr u32 DEFAULT_MAX_ACTIVE_REQUESTS = 4;
 
@@ -35,6 +55,17 @@ void HTTPDownloader::SetMaxActiveRequests(u32 max_active_requests)
   m_max_active_requests = max_active_requests;
 }
 
+void HTTPDownloader::SetCacheDirectory(std::string directory)
+{
+  if (!directory.empty() && !FileSystem::EnsureDirectoryExists(directory.c_str(), false))
+  {
+    Log_ErrorFmt("Failed to create cache directory '{}', disabling cache", directory);
+    directory = {};
+  }
+
+  m_cache_directory = std::move(directory);
+}
+
 void HTTPDownloader::CreateRequest(std::string url, Request::Callback callback, ProgressCallback* progress)
 {
   Request* req = InternalCreateRequest();
@@ -45,6 +76,31 @@ void HTTPDownloader::CreateRequest(std::string url, Request::Callback callback,
   req->progress = progress;
   req->start_time = Common::Timer::GetCurrentValue();
 
+  if (!m_cache_directory.empty())
+    req->validate_cache = LoadCacheValidators(req);
+
+  std::unique_lock<std::mutex> lock(m_pending_http_request_lock);
+  if (LockedGetActiveRequestCount() < m_max_active_requests)
+  {
+    if (!StartRequest(req))
+      return;
+  }
+
+  LockedAddRequest(req);
+}
+
+void HTTPDownloader::CreateRangeRequest(std::string url, u64 start_offset, Request::Callback callback,
+                                        ProgressCallback* progress)
+{
+  Request* req = InternalCreateRequest();
+  req->parent = this;
+  req->type = Request::Type::Get;
+  req->url = std::move(url);
+  req->callback = std::move(callback);
+  req->progress = progress;
+  req->resume_offset = start_offset;
+  req->start_time = Common::Timer::GetCurrentValue();
+
   std::unique_lock<std::mutex> lock(m_pending_http_request_lock);
   if (LockedGetActiveRequestCount() < m_max_active_requests)
   {
@@ -159,6 +215,8 @@ void HTTPDownloader::LockedPollRequests(std::unique_lock<std::mutex>& lock)
 
     // run callback with lock unheld
     lock.unlock();
+    if (!m_cache_directory.empty() && req->type == Request::Type::Get && req->resume_offset == 0)
+      ApplyCacheToCompletedRequest(req);
     req->callback(req->status_code, req->content_type, std::move(req->data));
     CloseRequest(req);
     lock.lock();
@@ -230,6 +288,120 @@ bool HTTPDownloader::HasAnyRequests()
   return !m_pending_http_requests.empty();
 }
 
+std::string HTTPDownloader::GetCacheEntryPath(const std::string& url) const
+{
+  return Path::Combine(m_cache_directory, fmt::format("{:016X}.bin", XXH3_64bits(url.data(), url.length())));
+}
+
+bool HTTPDownloader::LoadCacheValidators(Request* request) const
+{
+  auto fp = FileSystem::OpenManagedCFile(GetCacheEntryPath(request->url).c_str(), "rb");
+  if (!fp)
+    return false;
+
+  CACHE_ENTRY_HEADER header;
+  if (std::fread(&header, sizeof(header), 1, fp.get()) != 1 || header.signature != CACHE_ENTRY_SIGNATURE ||
+      (header.etag_length == 0 && header.last_modified_length == 0))
+  {
+    return false;
+  }
+
+  if (std::fseek(fp.get(), static_cast<long>(header.content_type_length), SEEK_CUR) != 0)
+    return false;
+
+  request->if_none_match.resize(header.etag_length);
+  request->if_modified_since.resize(header.last_modified_length);
+  if ((header.etag_length > 0 &&
+       std::fread(request->if_none_match.data(), header.etag_length, 1, fp.get()) != 1) ||
+      (header.last_modified_length > 0 &&
+       std::fread(request->if_modified_since.data(), header.last_modified_length, 1, fp.get()) != 1))
+  {
+    request->if_none_match = {};
+    request->if_modified_since = {};
+    return false;
+  }
+
+  return true;
+}
+
+bool HTTPDownloader::LoadCacheEntry(const std::string& url, std::string* content_type, Request::Data* data) const
+{
+  auto fp = FileSystem::OpenManagedCFile(GetCacheEntryPath(url).c_str(), "rb");
+  if (!fp)
+    return false;
+
+  CACHE_ENTRY_HEADER header;
+  if (std::fread(&header, sizeof(header), 1, fp.get()) != 1 || header.signature != CACHE_ENTRY_SIGNATURE)
+    return false;
+
+  content_type->resize(header.content_type_length);
+  if (header.content_type_length > 0 &&
+      std::fread(content_type->data(), header.content_type_length, 1, fp.get()) != 1)
+  {
+    return false;
+  }
+
+  if (std::fseek(fp.get(), static_cast<long>(header.etag_length + header.last_modified_length), SEEK_CUR) != 0)
+    return false;
+
+  data->resize(header.data_length);
+  return (header.data_length == 0 || std::fread(data->data(), header.data_length, 1, fp.get()) == 1);
+}
+
+void HTTPDownloader::StoreCacheEntry(const Request* request) const
+{
+  const std::string path = GetCacheEntryPath(request->url);
+  auto fp = FileSystem::OpenManagedCFile(path.c_str(), "wb");
+  if (!fp)
+  {
+    Log_ErrorFmt("Failed to open cache entry '{}' for writing", path);
+    return;
+  }
+
+  CACHE_ENTRY_HEADER header = {};
+  header.signature = CACHE_ENTRY_SIGNATURE;
+  header.content_type_length = static_cast<u32>(request->content_type.length());
+  header.etag_length = static_cast<u32>(request->response_etag.length());
+  header.last_modified_length = static_cast<u32>(request->response_last_modified.length());
+  header.data_length = static_cast<u32>(request->data.size());
+
+  if (std::fwrite(&header, sizeof(header), 1, fp.get()) != 1 ||
+      (header.content_type_length > 0 &&
+       std::fwrite(request->content_type.data(), header.content_type_length, 1, fp.get()) != 1) ||
+      (header.etag_length > 0 && std::fwrite(request->response_etag.data(), header.etag_length, 1, fp.get()) != 1) ||
+      (header.last_modified_length > 0 &&
+       std::fwrite(request->response_last_modified.data(), header.last_modified_length, 1, fp.get()) != 1) ||
+      (header.data_length > 0 && std::fwrite(request->data.data(), header.data_length, 1, fp.get()) != 1))
+  {
+    Log_ErrorFmt("Failed to write cache entry '{}'", path);
+    fp.reset();
+    FileSystem::DeleteFile(path.c_str());
+  }
+}
+
+void HTTPDownloader::ApplyCacheToCompletedRequest(Request* request) const
+{
+  if (request->status_code == HTTP_STATUS_NOT_MODIFIED && request->validate_cache)
+  {
+    // Server says our copy is still fresh, serve it from disk as if it was a full response.
+    std::string content_type;
+    Request::Data data;
+    if (LoadCacheEntry(request->url, &content_type, &data))
+    {
+      Log_VerboseFmt("Serving '{}' from cache ({} bytes)", request->url, data.size());
+      request->status_code = HTTP_STATUS_OK;
+      request->content_type = std::move(content_type);
+      request->data = std::move(data);
+    }
+  }
+  else if (request->status_code == HTTP_STATUS_OK &&
+           (!request->response_etag.empty() || !request->response_last_modified.empty()))
+  {
+    // Only responses carrying a validator are cached, we have no way to revalidate the rest.
+    StoreCacheEntry(request);
+  }
+}
+
 std::string HTTPDownloader::URLEncode(const std::string_view& str)
 {
   std::string ret;
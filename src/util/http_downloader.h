@@ -23,7 +23,9 @@ public:
     HTTP_STATUS_CANCELLED = -3,
     HTTP_STATUS_TIMEOUT = -2,
     HTTP_STATUS_ERROR = -1,
-    HTTP_STATUS_OK = 200
+    HTTP_STATUS_OK = 200,
+    HTTP_STATUS_PARTIAL_CONTENT = 206,
+    HTTP_STATUS_NOT_MODIFIED = 304
   };
 
   struct Request
@@ -52,12 +54,18 @@ public:
     std::string url;
     std::string post_data;
     std::string content_type;
+    std::string if_none_match;          // request: cached ETag, sent as If-None-Match
+    std::string if_modified_since;      // request: cached date, sent as If-Modified-Since
+    std::string response_etag;          // response: ETag header, if present
+    std::string response_last_modified; // response: Last-Modified header, if present
     Data data;
     u64 start_time;
+    u64 resume_offset = 0;
     s32 status_code = 0;
     u32 content_length = 0;
     u32 last_progress_update = 0;
     Type type = Type::Get;
+    bool validate_cache = false;
     std::atomic<State> state{State::Pending};
   };
 
@@ -72,9 +80,20 @@ public:
   void SetTimeout(float timeout);
   void SetMaxActiveRequests(u32 max_active_requests);
 
+  /// Enables the on-disk response cache for GET requests, rooted at the specified directory.
+  /// Cached responses are revalidated with the server via If-None-Match/If-Modified-Since and
+  /// served from disk on 304, so repeated fetches only pay for a header exchange.
+  void SetCacheDirectory(std::string directory);
+
   void CreateRequest(std::string url, Request::Callback callback, ProgressCallback* progress = nullptr);
   void CreatePostRequest(std::string url, std::string post_data, Request::Callback callback,
                          ProgressCallback* progress = nullptr);
+
+  /// Issues a GET request for the byte range starting at the specified offset, for resuming
+  /// interrupted large transfers. Servers honoring the range return 206 Partial Content with
+  /// only the remaining data; range requests bypass the response cache.
+  void CreateRangeRequest(std::string url, u64 start_offset, Request::Callback callback,
+                          ProgressCallback* progress = nullptr);
   void PollRequests();
   void WaitForAllRequests();
   bool HasAnyRequests();
@@ -97,4 +116,13 @@ protected:
 
   std::mutex m_pending_http_request_lock;
   std::vector<Request*> m_pending_http_requests;
+
+private:
+  std::string GetCacheEntryPath(const std::string& url) const;
+  bool LoadCacheValidators(Request* request) const;
+  bool LoadCacheEntry(const std::string& url, std::string* content_type, Request::Data* data) const;
+  void StoreCacheEntry(const Request* request) const;
+  void ApplyCacheToCompletedRequest(Request* request) const;
+
+  std::string m_cache_directory;
 };
@@ -8,6 +8,8 @@
 #include "common/string_util.h"
 #include "common/timer.h"
 
+#include "fmt/format.h"
+
 #include <algorithm>
 #include <functional>
 #include <pthread.h>
@@ -65,6 +67,10 @@ bool HTTPDownloaderCurl::Initialize(std::string user_agent)
     return false;
   }
 
+  // Multiplex concurrent requests to the same host over a single HTTP/2 connection where the
+  // server supports it, instead of opening one connection per request.
+  curl_multi_setopt(m_multi_handle, CURLMOPT_PIPELINING, static_cast<long>(CURLPIPE_MULTIPLEX));
+
   m_user_agent = std::move(user_agent);
   return true;
 }
@@ -89,6 +95,25 @@ size_t HTTPDownloaderCurl::WriteCallback(char* ptr, size_t size, size_t nmemb, v
   return nmemb;
 }
 
+size_t HTTPDownloaderCurl::HeaderCallback(char* ptr, size_t size, size_t nmemb, void* userdata)
+{
+  Request* req = static_cast<Request*>(userdata);
+  const size_t transfer_size = size * nmemb;
+  const std::string_view header = StringUtil::StripWhitespace(std::string_view(ptr, transfer_size));
+  const std::string_view::size_type colon_pos = header.find(':');
+  if (colon_pos != std::string_view::npos)
+  {
+    const std::string_view name = header.substr(0, colon_pos);
+    const std::string_view value = StringUtil::StripWhitespace(header.substr(colon_pos + 1));
+    if (StringUtil::EqualNoCase(name, "etag"))
+      req->response_etag = value;
+    else if (StringUtil::EqualNoCase(name, "last-modified"))
+      req->response_last_modified = value;
+  }
+
+  return transfer_size;
+}
+
 HTTPDownloader::Request* HTTPDownloaderCurl::InternalCreateRequest()
 {
   Request* req = new Request();
@@ -172,6 +197,29 @@ bool HTTPDownloaderCurl::StartRequest(HTTPDownloader::Request* request)
   curl_easy_setopt(req->handle, CURLOPT_NOSIGNAL, 1L);
   curl_easy_setopt(req->handle, CURLOPT_PRIVATE, req);
   curl_easy_setopt(req->handle, CURLOPT_FOLLOWLOCATION, 1L);
+  curl_easy_setopt(req->handle, CURLOPT_HEADERFUNCTION, &HTTPDownloaderCurl::HeaderCallback);
+  curl_easy_setopt(req->handle, CURLOPT_HEADERDATA, req);
+
+  // Prefer HTTP/2 over TLS, and wait for an existing connection to the host to become
+  // multiplexable rather than opening another one.
+  curl_easy_setopt(req->handle, CURLOPT_HTTP_VERSION, static_cast<long>(CURL_HTTP_VERSION_2TLS));
+  curl_easy_setopt(req->handle, CURLOPT_PIPEWAIT, 1L);
+
+  if (req->resume_offset > 0)
+    curl_easy_setopt(req->handle, CURLOPT_RESUME_FROM_LARGE, static_cast<curl_off_t>(req->resume_offset));
+
+  if (!req->if_none_match.empty())
+  {
+    req->request_headers =
+      curl_slist_append(req->request_headers, fmt::format("If-None-Match: {}", req->if_none_match).c_str());
+  }
+  if (!req->if_modified_since.empty())
+  {
+    req->request_headers =
+      curl_slist_append(req->request_headers, fmt::format("If-Modified-Since: {}", req->if_modified_since).c_str());
+  }
+  if (req->request_headers)
+    curl_easy_setopt(req->handle, CURLOPT_HTTPHEADER, req->request_headers);
 
   if (request->type == Request::Type::Post)
   {
@@ -189,6 +237,8 @@ bool HTTPDownloaderCurl::StartRequest(HTTPDownloader::Request* request)
     Log_ErrorFmt("curl_multi_add_handle() returned {}", static_cast<int>(err));
     req->callback(HTTP_STATUS_ERROR, std::string(), req->data);
     curl_easy_cleanup(req->handle);
+    if (req->request_headers)
+      curl_slist_free_all(req->request_headers);
     delete req;
     return false;
   }
@@ -202,5 +252,7 @@ void HTTPDownloaderCurl::CloseRequest(HTTPDownloader::Request* request)
   DebugAssert(req->handle);
   curl_multi_remove_handle(m_multi_handle, req->handle);
   curl_easy_cleanup(req->handle);
+  if (req->request_headers)
+    curl_slist_free_all(req->request_headers);
   delete req;
 }
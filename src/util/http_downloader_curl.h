@@ -27,9 +27,11 @@ private:
   struct Request : HTTPDownloader::Request
   {
     CURL* handle = nullptr;
+    curl_slist* request_headers = nullptr;
   };
 
   static size_t WriteCallback(char* ptr, size_t size, size_t nmemb, void* userdata);
+  static size_t HeaderCallback(char* ptr, size_t size, size_t nmemb, void* userdata);
 
   CURLM* m_multi_handle = nullptr;
   std::string m_user_agent;
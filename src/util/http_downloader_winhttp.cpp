@@ -8,6 +8,8 @@
 #include "common/string_util.h"
 #include "common/timer.h"
 
+#include "fmt/format.h"
+
 #include <algorithm>
 
 Log_SetChannel(HTTPDownloader);
@@ -46,6 +48,14 @@ bool HTTPDownloaderWinHttp::Initialize(std::string user_agent)
     return false;
   }
 
+#ifdef WINHTTP_OPTION_ENABLE_HTTP_PROTOCOL
+  // Multiplex concurrent requests to the same host over one HTTP/2 connection where the server
+  // supports it. Only available on Windows 10 and later, failure just means HTTP/1.1.
+  DWORD protocols = WINHTTP_PROTOCOL_FLAG_HTTP2;
+  if (!WinHttpSetOption(m_hSession, WINHTTP_OPTION_ENABLE_HTTP_PROTOCOL, &protocols, sizeof(protocols)))
+    Log_WarningPrintf("WinHttpSetOption() for HTTP/2 failed: %u", GetLastError());
+#endif
+
   const DWORD notification_flags = WINHTTP_CALLBACK_FLAG_ALL_COMPLETIONS | WINHTTP_CALLBACK_FLAG_REQUEST_ERROR |
                                    WINHTTP_CALLBACK_FLAG_HANDLES | WINHTTP_CALLBACK_FLAG_SECURE_FAILURE;
   if (WinHttpSetStatusCallback(m_hSession, HTTPStatusCallback, notification_flags, NULL) ==
@@ -131,19 +141,9 @@ void CALLBACK HTTPDownloaderWinHttp::HTTPStatusCallback(HINTERNET hRequest, DWOR
         req->content_length = 0;
       }
 
-      DWORD content_type_length = 0;
-      if (!WinHttpQueryHeaders(hRequest, WINHTTP_QUERY_CONTENT_TYPE, WINHTTP_HEADER_NAME_BY_INDEX,
-                               WINHTTP_NO_OUTPUT_BUFFER, &content_type_length, WINHTTP_NO_HEADER_INDEX) &&
-          GetLastError() == ERROR_INSUFFICIENT_BUFFER && content_type_length >= sizeof(content_type_length))
-      {
-        std::wstring content_type_wstring;
-        content_type_wstring.resize((content_type_length / sizeof(wchar_t)) - 1);
-        if (WinHttpQueryHeaders(hRequest, WINHTTP_QUERY_CONTENT_TYPE, WINHTTP_HEADER_NAME_BY_INDEX,
-                                content_type_wstring.data(), &content_type_length, WINHTTP_NO_HEADER_INDEX))
-        {
-          req->content_type = StringUtil::WideStringToUTF8String(content_type_wstring);
-        }
-      }
+      req->content_type = QueryHeaderString(hRequest, WINHTTP_QUERY_CONTENT_TYPE);
+      req->response_etag = QueryHeaderString(hRequest, WINHTTP_QUERY_ETAG);
+      req->response_last_modified = QueryHeaderString(hRequest, WINHTTP_QUERY_LAST_MODIFIED);
 
       Log_DevPrintf("Status code %d, content-length is %u", req->status_code, req->content_length);
       req->data.reserve(req->content_length);
@@ -209,6 +209,27 @@ void CALLBACK HTTPDownloaderWinHttp::HTTPStatusCallback(HINTERNET hRequest, DWOR
   }
 }
 
+std::string HTTPDownloaderWinHttp::QueryHeaderString(HINTERNET hRequest, DWORD dwInfoLevel)
+{
+  DWORD buffer_length = 0;
+  if (WinHttpQueryHeaders(hRequest, dwInfoLevel, WINHTTP_HEADER_NAME_BY_INDEX, WINHTTP_NO_OUTPUT_BUFFER,
+                          &buffer_length, WINHTTP_NO_HEADER_INDEX) ||
+      GetLastError() != ERROR_INSUFFICIENT_BUFFER || buffer_length < sizeof(wchar_t))
+  {
+    return {};
+  }
+
+  std::wstring value;
+  value.resize((buffer_length / sizeof(wchar_t)) - 1);
+  if (!WinHttpQueryHeaders(hRequest, dwInfoLevel, WINHTTP_HEADER_NAME_BY_INDEX, value.data(), &buffer_length,
+                           WINHTTP_NO_HEADER_INDEX))
+  {
+    return {};
+  }
+
+  return StringUtil::WideStringToUTF8String(value);
+}
+
 HTTPDownloader::Request* HTTPDownloaderWinHttp::InternalCreateRequest()
 {
   Request* req = new Request();
@@ -277,8 +298,26 @@ bool HTTPDownloaderWinHttp::StartRequest(HTTPDownloader::Request* request)
   }
   else
   {
-    result = WinHttpSendRequest(req->hRequest, WINHTTP_NO_ADDITIONAL_HEADERS, 0, WINHTTP_NO_REQUEST_DATA, 0, 0,
-                                reinterpret_cast<DWORD_PTR>(req));
+    std::string additional_headers;
+    if (req->resume_offset > 0)
+      additional_headers += fmt::format("Range: bytes={}-\r\n", req->resume_offset);
+    if (!req->if_none_match.empty())
+      additional_headers += fmt::format("If-None-Match: {}\r\n", req->if_none_match);
+    if (!req->if_modified_since.empty())
+      additional_headers += fmt::format("If-Modified-Since: {}\r\n", req->if_modified_since);
+
+    if (additional_headers.empty())
+    {
+      result = WinHttpSendRequest(req->hRequest, WINHTTP_NO_ADDITIONAL_HEADERS, 0, WINHTTP_NO_REQUEST_DATA, 0, 0,
+                                  reinterpret_cast<DWORD_PTR>(req));
+    }
+    else
+    {
+      const std::wstring additional_headers_wide(StringUtil::UTF8StringToWideString(additional_headers));
+      result = WinHttpSendRequest(req->hRequest, additional_headers_wide.c_str(),
+                                  static_cast<DWORD>(additional_headers_wide.size()), WINHTTP_NO_REQUEST_DATA, 0, 0,
+                                  reinterpret_cast<DWORD_PTR>(req));
+    }
   }
 
   if (!result && GetLastError() != ERROR_IO_PENDING)
@@ -33,6 +33,7 @@ private:
 
   static void CALLBACK HTTPStatusCallback(HINTERNET hInternet, DWORD_PTR dwContext, DWORD dwInternetStatus,
                                           LPVOID lpvStatusInformation, DWORD dwStatusInformationLength);
+  static std::string QueryHeaderString(HINTERNET hRequest, DWORD dwInfoLevel);
 
   HINTERNET m_hSession = NULL;
 };
@@ -13,6 +13,7 @@
 #include "common/lru_cache.h"
 #include "common/path.h"
 #include "common/string_util.h"
+#include "common/thread_pool.h"
 #include "common/threading.h"
 #include "common/timer.h"
 #include "core/host.h"
@@ -20,6 +21,7 @@
 #include "gpu_device.h"
 #include "imgui_internal.h"
 #include "imgui_stdlib.h"
+#include "xxhash.h"
 
 #include <array>
 #include <cmath>
@@ -27,6 +29,7 @@
 #include <deque>
 #include <mutex>
 #include <thread>
+#include <unordered_map>
 #include <variant>
 
 Log_SetChannel(ImGuiFullscreen);
@@ -37,6 +40,12 @@ using MessageDialogCallbackVariant = std::variant<InfoMessageDialogCallback, Con
 static std::optional<Common::RGBA8Image> LoadTextureImage(const char* path);
 static std::shared_ptr<GPUTexture> UploadTexture(const char* path, const Common::RGBA8Image& image);
 static void TextureLoaderThread();
+static void PackAtlasImage(std::string name, const Common::RGBA8Image& image);
+static bool FindAtlasSpace(u32 width, u32 height, u32* out_page, u32* out_x, u32* out_y);
+static void ResetAtlasPage(u32 page_index);
+static std::string GetThumbnailCachePath(const std::string& thumbnail_directory, const std::string& path);
+static std::optional<Common::RGBA8Image> LoadAtlasImage(const std::string& thumbnail_directory,
+                                                        const std::string& path);
 
 static void DrawFileSelector();
 static void DrawChoiceDialog();
@@ -87,8 +96,52 @@ static std::atomic_bool s_texture_load_thread_quit{false};
 static std::mutex s_texture_load_mutex;
 static std::condition_variable s_texture_load_cv;
 static std::deque<std::string> s_texture_load_queue;
+static std::deque<std::string> s_atlas_load_queue;
 static std::deque<std::pair<std::string, Common::RGBA8Image>> s_texture_upload_queue;
+static std::deque<std::pair<std::string, Common::RGBA8Image>> s_atlas_upload_queue;
 static std::thread s_texture_load_thread;
+static std::string s_texture_thumbnail_directory; // guarded by s_texture_load_mutex
+
+// Dynamic shelf-packed atlas for covers and icons. Images are downscaled to at most
+// ATLAS_MAX_IMAGE_SIZE on the loader thread, then packed into shared pages so the game grid
+// renders from a handful of texture bindings. When every page is full, the least-recently-used
+// page that wasn't touched this frame is dropped wholesale and its images reload on demand.
+namespace {
+struct AtlasPage
+{
+  struct Shelf
+  {
+    u32 y;
+    u32 height;
+    u32 used_width;
+  };
+
+  std::shared_ptr<GPUTexture> texture;
+  std::vector<Shelf> shelves;
+  u32 used_height = 0;
+  s32 last_used_frame = 0;
+};
+
+struct AtlasImageEntry
+{
+  AtlasImage image;
+  u32 page = INVALID_ATLAS_PAGE;
+  s32 last_used_frame = 0;
+
+  // images too large for a page get their own texture instead
+  std::shared_ptr<GPUTexture> standalone_texture;
+
+  static constexpr u32 INVALID_ATLAS_PAGE = 0xFFFFFFFFu;
+};
+} // namespace
+
+static constexpr u32 ATLAS_PAGE_SIZE = 2048;
+static constexpr u32 ATLAS_MAX_IMAGE_SIZE = 256;
+static constexpr u32 ATLAS_IMAGE_PADDING = 1;
+static constexpr u32 MAX_ATLAS_PAGES = 8;
+
+static std::vector<AtlasPage> s_atlas_pages;
+static std::unordered_map<std::string, AtlasImageEntry> s_atlas_images;
 
 static bool s_choice_dialog_open = false;
 static bool s_choice_dialog_checkable = false;
@@ -219,6 +272,9 @@ void ImGuiFullscreen::Shutdown()
   }
 
   s_texture_upload_queue.clear();
+  s_atlas_upload_queue.clear();
+  s_atlas_images.clear();
+  s_atlas_pages.clear();
   s_placeholder_texture.reset();
   g_standard_font = nullptr;
   g_medium_font = nullptr;
@@ -307,6 +363,34 @@ std::shared_ptr<GPUTexture> ImGuiFullscreen::LoadTexture(const std::string_view&
   return s_placeholder_texture;
 }
 
+std::vector<std::shared_ptr<GPUTexture>> ImGuiFullscreen::LoadTextures(std::span<const std::string_view> paths)
+{
+  // Decodes run in parallel on the pool; uploads stay on the calling thread, since they need the
+  // GPU device context. Without this, startup serializes every image decode back-to-back.
+  std::vector<std::string> path_strs;
+  path_strs.reserve(paths.size());
+  for (const std::string_view& path : paths)
+    path_strs.emplace_back(path);
+
+  std::vector<std::optional<Common::RGBA8Image>> images(paths.size());
+  Threading::TaskGroup task_group;
+  for (size_t i = 0; i < paths.size(); i++)
+    task_group.QueueTask([&path_strs, &images, i]() { images[i] = LoadTextureImage(path_strs[i].c_str()); });
+  task_group.Wait();
+
+  std::vector<std::shared_ptr<GPUTexture>> ret;
+  ret.reserve(paths.size());
+  for (size_t i = 0; i < paths.size(); i++)
+  {
+    std::shared_ptr<GPUTexture> tex;
+    if (images[i].has_value())
+      tex = UploadTexture(path_strs[i].c_str(), images[i].value());
+    ret.push_back(tex ? std::move(tex) : s_placeholder_texture);
+  }
+
+  return ret;
+}
+
 GPUTexture* ImGuiFullscreen::GetCachedTexture(const std::string_view& name)
 {
   std::shared_ptr<GPUTexture>* tex_ptr = s_texture_cache.Lookup(name);
@@ -336,8 +420,39 @@ GPUTexture* ImGuiFullscreen::GetCachedTextureAsync(const std::string_view& name)
   return tex_ptr->get();
 }
 
+void ImGuiFullscreen::SetTextureThumbnailCacheDirectory(std::string path)
+{
+  if (!path.empty() && !FileSystem::EnsureDirectoryExists(path.c_str(), false))
+  {
+    Log_ErrorPrintf("Failed to create thumbnail cache directory '%s', thumbnails will not be cached", path.c_str());
+    path = {};
+  }
+
+  std::unique_lock lock(s_texture_load_mutex);
+  s_texture_thumbnail_directory = std::move(path);
+}
+
+std::string ImGuiFullscreen::GetThumbnailCachePath(const std::string& thumbnail_directory, const std::string& path)
+{
+  return Path::Combine(thumbnail_directory, fmt::format("{:016X}.png", XXH3_64bits(path.data(), path.size())));
+}
+
 bool ImGuiFullscreen::InvalidateCachedTexture(const std::string& path)
 {
+  s_atlas_images.erase(path);
+
+  std::string thumbnail_directory;
+  {
+    std::unique_lock lock(s_texture_load_mutex);
+    thumbnail_directory = s_texture_thumbnail_directory;
+  }
+  if (!thumbnail_directory.empty())
+  {
+    const std::string thumbnail_path(GetThumbnailCachePath(thumbnail_directory, path));
+    if (FileSystem::FileExists(thumbnail_path.c_str()))
+      FileSystem::DeleteFile(thumbnail_path.c_str());
+  }
+
   return s_texture_cache.Remove(path);
 }
 
@@ -356,6 +471,234 @@ void ImGuiFullscreen::UploadAsyncTextures()
 
     lock.lock();
   }
+
+  while (!s_atlas_upload_queue.empty())
+  {
+    std::pair<std::string, Common::RGBA8Image> it(std::move(s_atlas_upload_queue.front()));
+    s_atlas_upload_queue.pop_front();
+    lock.unlock();
+
+    PackAtlasImage(std::move(it.first), it.second);
+
+    lock.lock();
+  }
+
+  // drop queued atlas loads which scrolled out of view before the loader thread reached them,
+  // they'll requeue if/when they come back into view
+  const s32 min_visible_frame = ImGui::GetFrameCount() - 1;
+  for (auto qit = s_atlas_load_queue.begin(); qit != s_atlas_load_queue.end();)
+  {
+    const auto iit = s_atlas_images.find(*qit);
+    if (iit == s_atlas_images.end() || iit->second.last_used_frame < min_visible_frame)
+    {
+      if (iit != s_atlas_images.end())
+        s_atlas_images.erase(iit);
+      qit = s_atlas_load_queue.erase(qit);
+    }
+    else
+    {
+      ++qit;
+    }
+  }
+}
+
+ImGuiFullscreen::AtlasImage ImGuiFullscreen::GetCachedAtlasImageAsync(const std::string_view& name)
+{
+  std::string key(name);
+  const auto it = s_atlas_images.find(key);
+  if (it != s_atlas_images.end())
+  {
+    it->second.last_used_frame = ImGui::GetFrameCount();
+    if (it->second.page != AtlasImageEntry::INVALID_ATLAS_PAGE)
+      s_atlas_pages[it->second.page].last_used_frame = it->second.last_used_frame;
+    return it->second.image;
+  }
+
+  // show the placeholder until the loader thread gets to it
+  AtlasImageEntry entry;
+  entry.image.texture = s_placeholder_texture.get();
+  entry.image.width = static_cast<u16>(s_placeholder_texture->GetWidth());
+  entry.image.height = static_cast<u16>(s_placeholder_texture->GetHeight());
+  entry.last_used_frame = ImGui::GetFrameCount();
+  const AtlasImage ret = entry.image;
+  s_atlas_images.emplace(std::move(key), std::move(entry));
+
+  std::unique_lock lock(s_texture_load_mutex);
+  s_atlas_load_queue.emplace_back(name);
+  s_texture_load_cv.notify_one();
+  return ret;
+}
+
+bool ImGuiFullscreen::FindAtlasSpace(u32 width, u32 height, u32* out_page, u32* out_x, u32* out_y)
+{
+  for (u32 page_index = 0; page_index < static_cast<u32>(s_atlas_pages.size()); page_index++)
+  {
+    AtlasPage& page = s_atlas_pages[page_index];
+    for (AtlasPage::Shelf& shelf : page.shelves)
+    {
+      if (height > shelf.height || (shelf.used_width + width) > ATLAS_PAGE_SIZE)
+        continue;
+
+      *out_page = page_index;
+      *out_x = shelf.used_width;
+      *out_y = shelf.y;
+      shelf.used_width += width;
+      return true;
+    }
+
+    if ((page.used_height + height) <= ATLAS_PAGE_SIZE)
+    {
+      *out_page = page_index;
+      *out_x = 0;
+      *out_y = page.used_height;
+      page.shelves.push_back({page.used_height, height, width});
+      page.used_height += height;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void ImGuiFullscreen::ResetAtlasPage(u32 page_index)
+{
+  for (auto it = s_atlas_images.begin(); it != s_atlas_images.end();)
+  {
+    if (it->second.page == page_index)
+      it = s_atlas_images.erase(it);
+    else
+      ++it;
+  }
+
+  AtlasPage& page = s_atlas_pages[page_index];
+  page.shelves.clear();
+  page.used_height = 0;
+  page.last_used_frame = ImGui::GetFrameCount();
+}
+
+void ImGuiFullscreen::PackAtlasImage(std::string name, const Common::RGBA8Image& image)
+{
+  const auto it = s_atlas_images.find(name);
+  if (it == s_atlas_images.end())
+  {
+    // invalidated while the decode was in flight
+    return;
+  }
+
+  AtlasImageEntry& entry = it->second;
+
+  const u32 padded_width = image.GetWidth() + (ATLAS_IMAGE_PADDING * 2);
+  const u32 padded_height = image.GetHeight() + (ATLAS_IMAGE_PADDING * 2);
+  if (padded_width > ATLAS_PAGE_SIZE || padded_height > ATLAS_PAGE_SIZE)
+  {
+    if (std::shared_ptr<GPUTexture> tex = UploadTexture(name.c_str(), image))
+    {
+      entry.standalone_texture = std::move(tex);
+      entry.image.texture = entry.standalone_texture.get();
+      entry.image.uv0 = ImVec2(0.0f, 0.0f);
+      entry.image.uv1 = ImVec2(1.0f, 1.0f);
+      entry.image.width = static_cast<u16>(image.GetWidth());
+      entry.image.height = static_cast<u16>(image.GetHeight());
+    }
+
+    return;
+  }
+
+  u32 page_index, x, y;
+  while (!FindAtlasSpace(padded_width, padded_height, &page_index, &x, &y))
+  {
+    if (s_atlas_pages.size() < MAX_ATLAS_PAGES)
+    {
+      std::unique_ptr<GPUTexture> tex = g_gpu_device->FetchTexture(
+        ATLAS_PAGE_SIZE, ATLAS_PAGE_SIZE, 1, 1, 1, GPUTexture::Type::Texture, GPUTexture::Format::RGBA8, nullptr, 0);
+      if (tex)
+      {
+        AtlasPage page;
+        page.texture = std::shared_ptr<GPUTexture>(tex.release(), GPUDevice::PooledTextureDeleter());
+        page.last_used_frame = ImGui::GetFrameCount();
+        s_atlas_pages.push_back(std::move(page));
+        continue;
+      }
+    }
+
+    // drop the least-recently-used page, unless it was drawn from this frame
+    u32 evict_index = 0;
+    for (u32 i = 1; i < static_cast<u32>(s_atlas_pages.size()); i++)
+    {
+      if (s_atlas_pages[i].last_used_frame < s_atlas_pages[evict_index].last_used_frame)
+        evict_index = i;
+    }
+
+    if (s_atlas_pages.empty() || s_atlas_pages[evict_index].last_used_frame >= ImGui::GetFrameCount())
+    {
+      Log_WarningPrintf("No atlas space for %ux%u image '%s', leaving placeholder", image.GetWidth(),
+                        image.GetHeight(), name.c_str());
+      return;
+    }
+
+    ResetAtlasPage(evict_index);
+  }
+
+  AtlasPage& page = s_atlas_pages[page_index];
+  if (!page.texture->Update(x + ATLAS_IMAGE_PADDING, y + ATLAS_IMAGE_PADDING, image.GetWidth(), image.GetHeight(),
+                            image.GetPixels(), image.GetPitch()))
+  {
+    Log_ErrorPrintf("Failed to upload %ux%u image '%s' to atlas", image.GetWidth(), image.GetHeight(), name.c_str());
+    return;
+  }
+
+  constexpr float inv_page_size = 1.0f / static_cast<float>(ATLAS_PAGE_SIZE);
+  entry.page = page_index;
+  entry.image.texture = page.texture.get();
+  entry.image.uv0 = ImVec2(static_cast<float>(x + ATLAS_IMAGE_PADDING) * inv_page_size,
+                           static_cast<float>(y + ATLAS_IMAGE_PADDING) * inv_page_size);
+  entry.image.uv1 = ImVec2(static_cast<float>(x + ATLAS_IMAGE_PADDING + image.GetWidth()) * inv_page_size,
+                           static_cast<float>(y + ATLAS_IMAGE_PADDING + image.GetHeight()) * inv_page_size);
+  entry.image.width = static_cast<u16>(image.GetWidth());
+  entry.image.height = static_cast<u16>(image.GetHeight());
+  page.last_used_frame = ImGui::GetFrameCount();
+}
+
+std::optional<Common::RGBA8Image> ImGuiFullscreen::LoadAtlasImage(const std::string& thumbnail_directory,
+                                                                 const std::string& path)
+{
+  FILESYSTEM_STAT_DATA source_sd;
+  if (!FileSystem::StatFile(path.c_str(), &source_sd))
+    return std::nullopt;
+
+  std::string thumbnail_path;
+  if (!thumbnail_directory.empty())
+  {
+    thumbnail_path = GetThumbnailCachePath(thumbnail_directory, path);
+
+    // steady state: read the pre-sized thumbnail instead of decoding the full image
+    FILESYSTEM_STAT_DATA thumbnail_sd;
+    if (FileSystem::StatFile(thumbnail_path.c_str(), &thumbnail_sd) &&
+        thumbnail_sd.ModificationTime >= source_sd.ModificationTime)
+    {
+      std::optional<Common::RGBA8Image> image(LoadTextureImage(thumbnail_path.c_str()));
+      if (image && image->IsValid())
+        return image;
+    }
+  }
+
+  std::optional<Common::RGBA8Image> image(LoadTextureImage(path.c_str()));
+  if (!image || !image->IsValid())
+    return std::nullopt;
+
+  // downscale here rather than on the render thread, the atlas only needs grid-cell size
+  const u32 max_dim = std::max(image->GetWidth(), image->GetHeight());
+  if (max_dim > ATLAS_MAX_IMAGE_SIZE)
+  {
+    const float scale = static_cast<float>(ATLAS_MAX_IMAGE_SIZE) / static_cast<float>(max_dim);
+    image->Resize(std::max(1u, static_cast<u32>(static_cast<float>(image->GetWidth()) * scale)),
+                  std::max(1u, static_cast<u32>(static_cast<float>(image->GetHeight()) * scale)));
+
+    if (!thumbnail_path.empty() && !image->SaveToFile(thumbnail_path.c_str()))
+      Log_WarningPrintf("Failed to write thumbnail '%s'", thumbnail_path.c_str());
+  }
+
+  return image;
 }
 
 void ImGuiFullscreen::TextureLoaderThread()
@@ -367,7 +710,8 @@ void ImGuiFullscreen::TextureLoaderThread()
   for (;;)
   {
     s_texture_load_cv.wait(lock, []() {
-      return (s_texture_load_thread_quit.load(std::memory_order_acquire) || !s_texture_load_queue.empty());
+      return (s_texture_load_thread_quit.load(std::memory_order_acquire) || !s_texture_load_queue.empty() ||
+              !s_atlas_load_queue.empty());
     });
 
     if (s_texture_load_thread_quit.load(std::memory_order_acquire))
@@ -386,9 +730,24 @@ void ImGuiFullscreen::TextureLoaderThread()
       if (image)
         s_texture_upload_queue.emplace_back(std::move(path), std::move(image.value()));
     }
+
+    while (!s_atlas_load_queue.empty())
+    {
+      std::string path(std::move(s_atlas_load_queue.front()));
+      s_atlas_load_queue.pop_front();
+
+      const std::string thumbnail_directory(s_texture_thumbnail_directory);
+      lock.unlock();
+      std::optional<Common::RGBA8Image> image(LoadAtlasImage(thumbnail_directory, path));
+      lock.lock();
+
+      if (image && image->IsValid())
+        s_atlas_upload_queue.emplace_back(std::move(path), std::move(image.value()));
+    }
   }
 
   s_texture_load_queue.clear();
+  s_atlas_load_queue.clear();
 }
 
 bool ImGuiFullscreen::UpdateLayoutScale()
@@ -12,6 +12,7 @@
 #include <functional>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -135,11 +136,36 @@ void Shutdown();
 /// Texture cache.
 const std::shared_ptr<GPUTexture>& GetPlaceholderTexture();
 std::shared_ptr<GPUTexture> LoadTexture(const std::string_view& path);
+
+/// Batch-loads multiple textures, decoding the images in parallel on the thread pool. Failed
+/// entries get the placeholder texture, same as LoadTexture().
+std::vector<std::shared_ptr<GPUTexture>> LoadTextures(std::span<const std::string_view> paths);
 GPUTexture* GetCachedTexture(const std::string_view& name);
 GPUTexture* GetCachedTextureAsync(const std::string_view& name);
 bool InvalidateCachedTexture(const std::string& path);
 void UploadAsyncTextures();
 
+/// Sub-rectangle of a dynamic atlas page. Many images share one texture, so runs of them draw as
+/// a single ImGui command instead of one binding per image.
+struct AtlasImage
+{
+  GPUTexture* texture = nullptr;
+  ImVec2 uv0{0.0f, 0.0f};
+  ImVec2 uv1{1.0f, 1.0f};
+  u16 width = 0;
+  u16 height = 0;
+
+  ALWAYS_INLINE ImVec2 GetSize() const { return ImVec2(static_cast<float>(width), static_cast<float>(height)); }
+};
+
+/// Looks up an image in the dynamic atlas, asynchronously decoding, downscaling and packing it on
+/// a miss. Returns the placeholder texture (full UV range) until the image is resident.
+AtlasImage GetCachedAtlasImageAsync(const std::string_view& name);
+
+/// Sets the directory used to persist downscaled copies of atlas images. When set, the loader
+/// thread reads/writes pre-sized thumbnails there instead of decoding full-size images each run.
+void SetTextureThumbnailCacheDirectory(std::string path);
+
 void BeginLayout();
 void EndLayout();
 
@@ -19,6 +19,7 @@
 #include "fmt/format.h"
 #include "imgui.h"
 #include "imgui_internal.h"
+#include "xxhash.h"
 
 #include <atomic>
 #include <chrono>
@@ -52,6 +53,13 @@ struct OSDMessage
   float duration;
   float target_y;
   float last_y;
+
+  // Cached wrapped-text measurement. Re-measuring every visible message every frame adds up
+  // during bursts, and the result only changes when the text, scale or window width do. A zero
+  // wrap width marks the cache stale.
+  ImVec2 text_size = ImVec2(0.0f, 0.0f);
+  float text_wrap_width = 0.0f;
+  float text_font_size = 0.0f;
 };
 
 } // namespace
@@ -288,6 +296,28 @@ void ImGuiManager::NewFrame()
   s_imgui_wants_mouse.store(io.WantCaptureMouse, std::memory_order_release);
 }
 
+u64 ImGuiManager::CalculateDrawDataHash()
+{
+  // Safe to call ahead of RenderImGui(); ImGui::Render() rebuilds the same draw data when it is
+  // called again for the actual draw.
+  ImGui::Render();
+
+  const ImDrawData* draw_data = ImGui::GetDrawData();
+
+  u64 hash = static_cast<u64>(draw_data->CmdListsCount);
+  for (int i = 0; i < draw_data->CmdListsCount; i++)
+  {
+    // ImDrawCmd is zero-initialized by ImGui, so hashing the padding bytes is fine. Texture IDs
+    // and callback pointers are stable for identical frames.
+    const ImDrawList* cmd_list = draw_data->CmdLists[i];
+    hash = XXH3_64bits_withSeed(cmd_list->VtxBuffer.Data, static_cast<u32>(cmd_list->VtxBuffer.Size) * sizeof(ImDrawVert), hash);
+    hash = XXH3_64bits_withSeed(cmd_list->IdxBuffer.Data, static_cast<u32>(cmd_list->IdxBuffer.Size) * sizeof(ImDrawIdx), hash);
+    hash = XXH3_64bits_withSeed(cmd_list->CmdBuffer.Data, static_cast<u32>(cmd_list->CmdBuffer.Size) * sizeof(ImDrawCmd), hash);
+  }
+
+  return hash;
+}
+
 void ImGuiManager::SetStyle()
 {
   ImGuiStyle& style = ImGui::GetStyle();
@@ -752,13 +782,16 @@ void ImGuiManager::AcquirePendingOSDMessages(Common::Timer::Value current_time)
   if (s_osd_posted_messages.empty())
     return;
 
-  std::unique_lock lock(s_osd_messages_lock);
-  for (;;)
+  // Take the whole posted list in one go, so producers only ever contend on a deque swap rather
+  // than the keyed merge below.
+  std::deque<OSDMessage> posted_messages;
   {
-    if (s_osd_posted_messages.empty())
-      break;
+    std::unique_lock lock(s_osd_messages_lock);
+    posted_messages.swap(s_osd_posted_messages);
+  }
 
-    OSDMessage& new_msg = s_osd_posted_messages.front();
+  for (OSDMessage& new_msg : posted_messages)
+  {
     std::deque<OSDMessage>::iterator iter;
     if (!new_msg.key.empty() && (iter = std::find_if(s_osd_active_messages.begin(), s_osd_active_messages.end(),
                                                      [&new_msg](const OSDMessage& other) {
@@ -766,6 +799,7 @@ void ImGuiManager::AcquirePendingOSDMessages(Common::Timer::Value current_time)
                                                      })) != s_osd_active_messages.end())
     {
       iter->text = std::move(new_msg.text);
+      iter->text_wrap_width = 0.0f;
       iter->duration = new_msg.duration;
 
       // Don't fade it in again
@@ -778,8 +812,6 @@ void ImGuiManager::AcquirePendingOSDMessages(Common::Timer::Value current_time)
       s_osd_active_messages.push_back(std::move(new_msg));
     }
 
-    s_osd_posted_messages.pop_front();
-
     static constexpr size_t MAX_ACTIVE_OSD_MESSAGES = 512;
     if (s_osd_active_messages.size() > MAX_ACTIVE_OSD_MESSAGES)
       s_osd_active_messages.pop_front();
@@ -851,8 +883,14 @@ void ImGuiManager::DrawOSDMessages(Common::Timer::Value current_time)
       break;
 
     const ImVec2 pos(position_x, actual_y);
-    const ImVec2 text_size(font->CalcTextSizeA(font->FontSize, max_width, max_width, msg.text.c_str(),
-                                               msg.text.c_str() + msg.text.length()));
+    if (msg.text_wrap_width != max_width || msg.text_font_size != font->FontSize)
+    {
+      msg.text_size = font->CalcTextSizeA(font->FontSize, max_width, max_width, msg.text.c_str(),
+                                          msg.text.c_str() + msg.text.length());
+      msg.text_wrap_width = max_width;
+      msg.text_font_size = font->FontSize;
+    }
+    const ImVec2 text_size = msg.text_size;
     const ImVec2 size(text_size.x + padding * 2.0f, text_size.y + padding * 2.0f);
     const ImVec4 text_rect(pos.x + padding, pos.y + padding, pos.x + size.x - padding, pos.y + size.y - padding);
 
@@ -40,6 +40,11 @@ void UpdateScale();
 /// Call at the beginning of the frame to set up ImGui state.
 void NewFrame();
 
+/// Finalizes the current frame's draw data and returns a hash of it. Used for present-on-change:
+/// when the hash matches the previous frame, the ImGui layer is static and re-recording and
+/// re-presenting it can be skipped entirely.
+u64 CalculateDrawDataHash();
+
 /// Renders any on-screen display elements.
 void RenderOSDMessages();
 
@@ -65,39 +65,47 @@ bool INISettingsInterface::Load()
 }
 
 bool INISettingsInterface::Save()
+{
+  std::string data;
+  if (!SaveToString(&data))
+    return false;
+
+  return WriteSerializedToFile(m_filename, data);
+}
+
+bool INISettingsInterface::SaveToString(std::string* out_data)
 {
   if (m_filename.empty())
     return false;
 
   std::unique_lock lock(s_ini_load_save_mutex);
-  std::string temp_filename(GetTemporaryFileName(m_filename));
-  SI_Error err = SI_FAIL;
-  std::FILE* fp = FileSystem::OpenCFile(temp_filename.c_str(), "wb");
-  if (fp)
+  if (m_ini.Save(*out_data, false) != SI_OK)
   {
-    err = m_ini.SaveFile(fp, false);
-    std::fclose(fp);
+    Log_WarningPrintf("Failed to serialize settings for '%s'.", m_filename.c_str());
+    return false;
+  }
 
-    if (err != SI_OK)
-    {
-      // remove temporary file
-      FileSystem::DeleteFile(temp_filename.c_str());
-    }
-    else if (!FileSystem::RenamePath(temp_filename.c_str(), m_filename.c_str()))
-    {
-      Log_ErrorPrintf("Failed to rename '%s' to '%s'", temp_filename.c_str(), m_filename.c_str());
-      FileSystem::DeleteFile(temp_filename.c_str());
-      return false;
-    }
+  m_dirty = false;
+  return true;
+}
+
+bool INISettingsInterface::WriteSerializedToFile(const std::string& filename, const std::string& data)
+{
+  std::string temp_filename(GetTemporaryFileName(filename));
+  if (!FileSystem::WriteBinaryFile(temp_filename.c_str(), data.data(), data.size()))
+  {
+    Log_WarningPrintf("Failed to save settings to '%s'.", filename.c_str());
+    FileSystem::DeleteFile(temp_filename.c_str());
+    return false;
   }
 
-  if (err != SI_OK)
+  if (!FileSystem::RenamePath(temp_filename.c_str(), filename.c_str()))
   {
-    Log_WarningPrintf("Failed to save settings to '%s'.", m_filename.c_str());
+    Log_ErrorPrintf("Failed to rename '%s' to '%s'", temp_filename.c_str(), filename.c_str());
+    FileSystem::DeleteFile(temp_filename.c_str());
     return false;
   }
 
-  m_dirty = false;
   return true;
 }
 
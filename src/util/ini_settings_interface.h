@@ -21,6 +21,13 @@ public:
   bool Load();
   bool Save() override;
 
+  /// Serializes the INI data to a string without touching the disk. Pair with WriteSerializedToFile() to
+  /// perform the file write outside of any lock guarding this interface.
+  bool SaveToString(std::string* out_data);
+
+  /// Atomically writes data previously produced by SaveToString() to the given file.
+  static bool WriteSerializedToFile(const std::string& filename, const std::string& data);
+
   void Clear() override;
 
   bool GetIntValue(const char* section, const char* key, s32* value) const override;
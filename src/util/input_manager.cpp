@@ -18,12 +18,12 @@
 
 #include "fmt/core.h"
 
+#include <algorithm>
 #include <array>
 #include <atomic>
 #include <memory>
 #include <mutex>
 #include <sstream>
-#include <unordered_map>
 #include <variant>
 #include <vector>
 
@@ -135,9 +135,31 @@ static void UpdateInputSourceState(SettingsInterface& si, std::unique_lock<std::
 // Local Variables
 // ------------------------------------------------------------------------
 
-// This is a multimap containing any binds related to the specified key.
-using BindingMap = std::unordered_multimap<InputBindingKey, std::shared_ptr<InputBinding>, InputBindingKeyHash>;
+// This is a multimap containing any binds related to the specified key. It is stored as a
+// flat array sorted by key, so per-event lookups are a binary search over contiguous memory
+// instead of chasing unordered_multimap nodes. It is only rebuilt (and re-sorted) by
+// ReloadBindings().
+using BindingMapEntry = std::pair<InputBindingKey, std::shared_ptr<InputBinding>>;
+using BindingMap = std::vector<BindingMapEntry>;
 using VibrationBindingArray = std::vector<PadVibrationBinding>;
+
+namespace {
+struct BindingMapEntryLess
+{
+  ALWAYS_INLINE bool operator()(const BindingMapEntry& lhs, const BindingMapEntry& rhs) const
+  {
+    return (lhs.first.bits < rhs.first.bits);
+  }
+  ALWAYS_INLINE bool operator()(const BindingMapEntry& lhs, InputBindingKey rhs) const
+  {
+    return (lhs.first.bits < rhs.bits);
+  }
+  ALWAYS_INLINE bool operator()(InputBindingKey lhs, const BindingMapEntry& rhs) const
+  {
+    return (lhs.bits < rhs.first.bits);
+  }
+};
+} // namespace
 static BindingMap s_binding_map;
 static VibrationBindingArray s_pad_vibration_array;
 static std::mutex s_binding_map_write_lock;
@@ -154,6 +176,14 @@ static std::array<std::array<MacroButton, InputManager::NUM_MACRO_BUTTONS_PER_CO
                   NUM_CONTROLLER_AND_CARD_PORTS>
   s_macro_buttons;
 
+// (pad, index) of macro buttons currently held with a turbo frequency. Keeping the active set
+// explicit means the per-frame update only touches macros that are actually running, and gets
+// skipped entirely when none are.
+static std::vector<std::pair<u32, u32>> s_active_macro_buttons;
+
+// Timestamp of the last event which fired a binding, for the latency probe.
+static std::atomic<u64> s_last_event_timestamp{0};
+
 // ------------------------------------------------------------------------
 // Hotkeys
 // ------------------------------------------------------------------------
@@ -523,9 +553,9 @@ void InputManager::AddBinding(const std::string_view& binding, const InputEventH
   if (!ibinding)
     return;
 
-  // plop it in the input map for all the keys
+  // plop it in the input map for all the keys, gets sorted once the reload finishes
   for (u32 i = 0; i < ibinding->num_keys; i++)
-    s_binding_map.emplace(ibinding->keys[i].MaskDirection(), ibinding);
+    s_binding_map.emplace_back(ibinding->keys[i].MaskDirection(), ibinding);
 }
 
 void InputManager::AddVibrationBinding(u32 pad_index, const InputBindingKey* motor_0_binding,
@@ -931,7 +961,7 @@ void InputManager::AddPadBindings(SettingsInterface& si, const std::string& sect
 bool InputManager::HasAnyBindingsForKey(InputBindingKey key)
 {
   std::unique_lock lock(s_binding_map_write_lock);
-  return (s_binding_map.find(key.MaskDirection()) != s_binding_map.end());
+  return std::binary_search(s_binding_map.begin(), s_binding_map.end(), key.MaskDirection(), BindingMapEntryLess());
 }
 
 bool InputManager::HasAnyBindingsForSource(InputBindingKey key)
@@ -962,15 +992,23 @@ bool InputManager::InvokeEvents(InputBindingKey key, float value, GenericInputBi
 
   // If imgui ate the event, don't fire our handlers.
   const bool skip_button_handlers = PreprocessEvent(key, value, generic_key);
-  return ProcessEvent(key, value, skip_button_handlers);
+  const bool processed = ProcessEvent(key, value, skip_button_handlers);
+  if (processed)
+    s_last_event_timestamp.store(Common::Timer::GetCurrentValue(), std::memory_order_release);
+  return processed;
+}
+
+u64 InputManager::GetLastEventTimestamp()
+{
+  return s_last_event_timestamp.load(std::memory_order_acquire);
 }
 
 bool InputManager::ProcessEvent(InputBindingKey key, float value, bool skip_button_handlers)
 {
   // find all the bindings associated with this key
   const InputBindingKey masked_key = key.MaskDirection();
-  const auto range = s_binding_map.equal_range(masked_key);
-  if (range.first == s_binding_map.end())
+  const auto range = std::equal_range(s_binding_map.begin(), s_binding_map.end(), masked_key, BindingMapEntryLess());
+  if (range.first == range.second)
     return false;
 
   // Now we can actually fire/activate bindings.
@@ -1040,7 +1078,8 @@ bool InputManager::ProcessEvent(InputBindingKey key, float value, bool skip_butt
           // they could still activate and take precedence over us, so we leave them alone.
           for (u32 j = 0; j < binding->num_keys; j++)
           {
-            const auto range2 = s_binding_map.equal_range(binding->keys[j].MaskDirection());
+            const auto range2 = std::equal_range(s_binding_map.begin(), s_binding_map.end(),
+                                                 binding->keys[j].MaskDirection(), BindingMapEntryLess());
             for (auto it2 = range2.first; it2 != range2.second; ++it2)
             {
               InputBinding* other_binding = it2->second.get();
@@ -1582,6 +1621,7 @@ void InputManager::LoadMacroButtonConfig(SettingsInterface& si, const std::strin
                                          const Controller::ControllerInfo* cinfo)
 {
   s_macro_buttons[pad] = {};
+  std::erase_if(s_active_macro_buttons, [pad](const std::pair<u32, u32>& it) { return (it.first == pad); });
   if (cinfo->bindings.empty())
     return;
 
@@ -1637,6 +1677,24 @@ void InputManager::SetMacroButtonState(u32 pad, u32 index, bool state)
 
   mb.toggle_counter = mb.toggle_frequency;
   mb.trigger_state = state;
+
+  if (mb.toggle_frequency != 0)
+  {
+    const std::pair<u32, u32> entry(pad, index);
+    if (state)
+    {
+      if (std::find(s_active_macro_buttons.begin(), s_active_macro_buttons.end(), entry) ==
+          s_active_macro_buttons.end())
+      {
+        s_active_macro_buttons.push_back(entry);
+      }
+    }
+    else
+    {
+      std::erase(s_active_macro_buttons, entry);
+    }
+  }
+
   if (mb.toggle_state != state)
   {
     mb.toggle_state = state;
@@ -1657,22 +1715,17 @@ void InputManager::ApplyMacroButton(u32 pad, const MacroButton& mb)
 
 void InputManager::UpdateMacroButtons()
 {
-  for (u32 pad = 0; pad < NUM_CONTROLLER_AND_CARD_PORTS; pad++)
+  for (const auto& [pad, index] : s_active_macro_buttons)
   {
-    for (u32 index = 0; index < NUM_MACRO_BUTTONS_PER_CONTROLLER; index++)
-    {
-      MacroButton& mb = s_macro_buttons[pad][index];
-      if (!mb.trigger_state || mb.toggle_frequency == 0)
-        continue;
+    MacroButton& mb = s_macro_buttons[pad][index];
 
-      mb.toggle_counter--;
-      if (mb.toggle_counter > 0)
-        continue;
+    mb.toggle_counter--;
+    if (mb.toggle_counter > 0)
+      continue;
 
-      mb.toggle_counter = mb.toggle_frequency;
-      mb.toggle_state = !mb.toggle_state;
-      ApplyMacroButton(pad, mb);
-    }
+    mb.toggle_counter = mb.toggle_frequency;
+    mb.toggle_state = !mb.toggle_state;
+    ApplyMacroButton(pad, mb);
   }
 }
 
@@ -1747,6 +1800,9 @@ void InputManager::ReloadBindings(SettingsInterface& si, SettingsInterface& bind
     LoadMacroButtonConfig(binding_si, section, pad, cinfo);
   }
 
+  // Sort the flat map now that all the bindings have been added, lookups binary search it.
+  std::sort(s_binding_map.begin(), s_binding_map.end(), BindingMapEntryLess());
+
   for (u32 axis = 0; axis < static_cast<u32>(InputPointerAxis::Count); axis++)
   {
     // From lilypad: 1 mouse pixel = 1/8th way down.
@@ -1959,7 +2015,8 @@ void InputManager::PollSources()
 
   if (System::GetState() == System::State::Running)
   {
-    UpdateMacroButtons();
+    if (!s_active_macro_buttons.empty())
+      UpdateMacroButtons();
     if (!s_pad_vibration_array.empty())
       UpdateContinuedVibration();
   }
@@ -292,6 +292,10 @@ void AddVibrationBinding(u32 pad_index, const InputBindingKey* motor_0_binding,
 /// Returns true if anything was bound to this key, otherwise false.
 bool InvokeEvents(InputBindingKey key, float value, GenericInputBinding generic_key = GenericInputBinding::Unknown);
 
+/// Returns the host timestamp (Common::Timer value) of the most recent event which fired a binding.
+/// Used by the input-to-present latency probe in the performance overlay.
+u64 GetLastEventTimestamp();
+
 /// Clears internal state for any binds with a matching source/index.
 void ClearBindStateFromSource(InputBindingKey key);
 
@@ -7,6 +7,7 @@
 #include "common/assert.h"
 #include "common/log.h"
 #include "common/memmap.h"
+#include "common/memory_tracker.h"
 
 #include <algorithm>
 
@@ -93,6 +94,7 @@ bool JitCodeBuffer::Allocate(u32 size /* = 64 * 1024 * 1024 */, u32 far_code_siz
 
   m_old_protection = 0;
   m_owns_buffer = true;
+  MemoryTracker::TrackAllocation(MemoryTracker::Tag::JITCode, m_total_size);
   return true;
 }
 
@@ -200,11 +202,15 @@ bool JitCodeBuffer::Initialize(void* buffer, u32 size, u32 far_code_size /* = 0
 
   m_guard_size = guard_size;
   m_owns_buffer = false;
+  MemoryTracker::TrackAllocation(MemoryTracker::Tag::JITCode, m_total_size);
   return true;
 }
 
 void JitCodeBuffer::Destroy()
 {
+  if (m_code_ptr)
+    MemoryTracker::TrackFree(MemoryTracker::Tag::JITCode, m_total_size);
+
   if (m_owns_buffer)
   {
 #if defined(_WIN32)
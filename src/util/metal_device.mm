@@ -223,6 +223,7 @@ void MetalDevice::SetFeatures(FeatureMask disabled_features)
   m_features.partial_msaa_resolve = false;
   m_features.shader_cache = true;
   m_features.pipeline_cache = false;
+  m_features.parallel_pipeline_compilation = false;
 }
 
 bool MetalDevice::LoadShaders()
@@ -2045,6 +2046,7 @@ void MetalDevice::CommandBufferCompletedOffThread(id<MTLCommandBuffer> buffer, u
   std::unique_lock lock(m_fence_mutex);
   m_completed_fence_counter.store(std::max(m_completed_fence_counter.load(std::memory_order_acquire), fence_counter),
                                   std::memory_order_release);
+  m_fence_cv.notify_all();
 
   if (m_gpu_timing_enabled)
   {
@@ -2104,14 +2106,11 @@ void MetalDevice::WaitForFenceCounter(u64 counter)
   if (m_completed_fence_counter.load(std::memory_order_relaxed) >= counter)
     return;
 
-  // TODO: There has to be a better way to do this..
+  // Sleep until the completion handler signals our counter, instead of spinning.
   std::unique_lock lock(m_fence_mutex);
-  while (m_completed_fence_counter.load(std::memory_order_acquire) < counter)
-  {
-    lock.unlock();
-    pthread_yield_np();
-    lock.lock();
-  }
+  m_fence_cv.wait(lock,
+                  [this, counter]() { return (m_completed_fence_counter.load(std::memory_order_acquire) >= counter); });
+  lock.unlock();
 
   CleanupObjects();
 }
@@ -534,6 +534,9 @@ bool OpenGLDevice::CheckFeatures(bool* buggy_pbo, FeatureMask disabled_features)
                       "startup will be slow due to compiling shaders.");
   }
 
+  // GL contexts are single-threaded.
+  m_features.parallel_pipeline_compilation = false;
+
   return true;
 }
 
@@ -797,6 +800,10 @@ bool OpenGLDevice::BeginPresent(bool skip_present)
 
 void OpenGLDevice::EndPresent()
 {
+  // SwapBuffers() can block for the remainder of the vblank period when vsync is on. Unlike
+  // Vulkan, presentation can't be moved to a worker thread here without making the context
+  // current on it, which would mean rendering the frame to an offscreen target and handing it
+  // over with sync objects - the blocking has to be accepted, or vsync disabled.
   DebugAssert(m_current_fbo == 0);
 
   if (m_gpu_timing_enabled)
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
 
 #include "opengl_stream_buffer.h"
+#include "gpu_device.h"
 
 #include "common/align.h"
 #include "common/assert.h"
@@ -60,6 +61,7 @@ public:
 
     glBindBuffer(m_target, m_buffer_id);
     glBufferSubData(m_target, 0, used_size, m_cpu_buffer);
+    GPUDevice::CountBytesStreamed(used_size);
     return 0;
   }
 
@@ -114,6 +116,7 @@ public:
 
     glBindBuffer(m_target, m_buffer_id);
     glBufferData(m_target, used_size, m_cpu_buffer, GL_STREAM_DRAW);
+    GPUDevice::CountBytesStreamed(used_size);
     return 0;
   }
 
@@ -188,7 +191,13 @@ protected:
 
   ALWAYS_INLINE void WaitForSync(GLsync& sync)
   {
-    glClientWaitSync(sync, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+    // Probe with a zero timeout first, so only genuine waits (the ring has caught up to the GPU)
+    // get counted as stalls.
+    if (glClientWaitSync(sync, GL_SYNC_FLUSH_COMMANDS_BIT, 0) == GL_TIMEOUT_EXPIRED)
+    {
+      GPUDevice::CountStreamBufferStall();
+      glClientWaitSync(sync, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+    }
     glDeleteSync(sync);
     sync = nullptr;
   }
@@ -214,6 +223,8 @@ protected:
     // wrap-around?
     if ((m_position + size) > m_size)
     {
+      GPUDevice::CountStreamBufferWrap();
+
       // current position ... buffer end
       AddSyncsForOffset(m_size);
 
@@ -280,6 +291,7 @@ public:
 
     const u32 prev_position = m_position;
     m_position += used_size;
+    GPUDevice::CountBytesStreamed(used_size);
     return prev_position;
   }
 
@@ -323,6 +335,70 @@ private:
   bool m_coherent;
 };
 
+// Uses glMapBufferRange() with unsynchronized mapping and manual fencing, for drivers without
+// buffer_storage. Avoids both the client-side copy of BufferSubData and the orphaning stalls of
+// BufferData, at the cost of a map/unmap call per allocation.
+class MapBufferRangeStreamBuffer final : public SyncingStreamBuffer
+{
+public:
+  MappingResult Map(u32 alignment, u32 min_size) override
+  {
+    if (m_position > 0)
+      m_position = Common::AlignUp(m_position, alignment);
+
+    AllocateSpace(min_size);
+    DebugAssert((m_position + min_size) <= (m_available_block_index * m_bytes_per_block));
+
+    Bind();
+    u8* mapped_ptr = static_cast<u8*>(
+      glMapBufferRange(m_target, m_position, min_size,
+                       GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_FLUSH_EXPLICIT_BIT));
+    AssertMsg(mapped_ptr, "Buffer range was mapped");
+
+    return MappingResult{static_cast<void*>(mapped_ptr), m_position, m_position / alignment, min_size / alignment};
+  }
+
+  u32 Unmap(u32 used_size) override
+  {
+    DebugAssert((m_position + used_size) <= m_size);
+
+    Bind();
+    if (used_size > 0)
+      glFlushMappedBufferRange(m_target, 0, used_size);
+    glUnmapBuffer(m_target);
+
+    const u32 prev_position = m_position;
+    m_position += used_size;
+    GPUDevice::CountBytesStreamed(used_size);
+    return prev_position;
+  }
+
+  static std::unique_ptr<OpenGLStreamBuffer> Create(GLenum target, u32 size)
+  {
+    glGetError();
+
+    GLuint buffer_id;
+    glGenBuffers(1, &buffer_id);
+    glBindBuffer(target, buffer_id);
+    glBufferData(target, size, nullptr, GL_STREAM_DRAW);
+
+    GLenum err = glGetError();
+    if (err != GL_NO_ERROR)
+    {
+      glBindBuffer(target, 0);
+      glDeleteBuffers(1, &buffer_id);
+      return {};
+    }
+
+    return std::unique_ptr<OpenGLStreamBuffer>(new MapBufferRangeStreamBuffer(target, buffer_id, size));
+  }
+
+private:
+  MapBufferRangeStreamBuffer(GLenum target, GLuint buffer_id, u32 size) : SyncingStreamBuffer(target, buffer_id, size)
+  {
+  }
+};
+
 } // namespace
 
 std::unique_ptr<OpenGLStreamBuffer> OpenGLStreamBuffer::Create(GLenum target, u32 size)
@@ -335,6 +411,15 @@ std::unique_ptr<OpenGLStreamBuffer> OpenGLStreamBuffer::Create(GLenum target, u3
       return buf;
   }
 
+  // No persistent mapping, but we can still stream into the buffer with manual fencing, which
+  // avoids the full-buffer orphaning stall below. Needs ARB_sync for the fences.
+  if (GLAD_GL_VERSION_3_2 || GLAD_GL_ES_VERSION_3_0 || GLAD_GL_ARB_sync)
+  {
+    buf = MapBufferRangeStreamBuffer::Create(target, size);
+    if (buf)
+      return buf;
+  }
+
   // BufferSubData is slower on all drivers except NVIDIA...
 #if 0
   const char* vendor = reinterpret_cast<const char*>(glGetString(GL_VENDOR));
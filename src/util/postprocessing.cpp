@@ -579,6 +579,10 @@ bool PostProcessing::ReloadShaders()
 
   decltype(s_stages)().swap(s_stages);
   DestroyTextures();
+
+  // The user may have edited includes, so don't reuse any parsed modules.
+  ReShadeFXShader::ClearModuleCache();
+
   LoadStages();
 
   Host::AddIconOSDMessage("PostProcessing", ICON_FA_PAINT_ROLLER,
@@ -12,8 +12,10 @@
 #include "common/assert.h"
 #include "common/error.h"
 #include "common/file_system.h"
+#include "common/hash_combine.h"
 #include "common/image.h"
 #include "common/log.h"
+#include "common/md5_digest.h"
 #include "common/path.h"
 #include "common/string_util.h"
 
@@ -27,13 +29,48 @@
 #include <cctype>
 #include <cmath>
 #include <cstring>
+#include <mutex>
 #include <sstream>
+#include <unordered_map>
 
 Log_SetChannel(ReShadeFXShader);
 
 static constexpr s32 DEFAULT_BUFFER_WIDTH = 3840;
 static constexpr s32 DEFAULT_BUFFER_HEIGHT = 2160;
 
+namespace {
+struct ModuleCacheKey
+{
+  u32 api;
+  u32 source_length;
+  s32 buffer_width;
+  s32 buffer_height;
+  u8 source_hash[16];
+
+  bool operator==(const ModuleCacheKey& key) const { return (std::memcmp(this, &key, sizeof(key)) == 0); }
+};
+
+struct ModuleCacheKeyHash
+{
+  std::size_t operator()(const ModuleCacheKey& key) const noexcept
+  {
+    std::size_t h = 0;
+    u64 hash_low, hash_high;
+    std::memcpy(&hash_low, &key.source_hash[0], sizeof(hash_low));
+    std::memcpy(&hash_high, &key.source_hash[8], sizeof(hash_high));
+    hash_combine(h, key.api, key.source_length, key.buffer_width, key.buffer_height, hash_low, hash_high);
+    return h;
+  }
+};
+} // namespace
+
+// Preprocessing/parsing/codegen only depends on the source and the key fields, so modules are reused
+// across renderer restarts and resolution changes for the lifetime of the process. The mutex is needed
+// because the settings UI parses configs on a different thread to the GPU thread.
+static constexpr size_t MODULE_CACHE_MAX_SIZE = 32;
+static std::unordered_map<ModuleCacheKey, reshadefx::module, ModuleCacheKeyHash> s_module_cache;
+static std::mutex s_module_cache_mutex;
+
 static RenderAPI GetRenderAPI()
 {
   return g_gpu_device ? g_gpu_device->GetRenderAPI() : RenderAPI::D3D11;
@@ -368,6 +405,26 @@ bool PostProcessing::ReShadeFXShader::IsValid() const
 bool PostProcessing::ReShadeFXShader::CreateModule(s32 buffer_width, s32 buffer_height, reshadefx::module* mod,
                                                    std::string code, Error* error)
 {
+  ModuleCacheKey cache_key = {};
+  cache_key.api = static_cast<u32>(GetRenderAPI());
+  cache_key.source_length = static_cast<u32>(code.length());
+  cache_key.buffer_width = buffer_width;
+  cache_key.buffer_height = buffer_height;
+
+  MD5Digest digest;
+  digest.Update(code.data(), static_cast<u32>(code.length()));
+  digest.Final(cache_key.source_hash);
+
+  {
+    std::unique_lock lock(s_module_cache_mutex);
+    const auto it = s_module_cache.find(cache_key);
+    if (it != s_module_cache.end())
+    {
+      *mod = it->second;
+      return true;
+    }
+  }
+
   reshadefx::preprocessor pp;
   pp.set_include_callbacks(PreprocessorFileExistsCallback, PreprocessorReadFileCallback);
 
@@ -433,9 +490,20 @@ bool PostProcessing::ReShadeFXShader::CreateModule(s32 buffer_width, s32 buffer_
   cg->write_result(*mod);
 
   // FileSystem::WriteBinaryFile("D:\\out.txt", mod->code.data(), mod->code.size());
+
+  std::unique_lock lock(s_module_cache_mutex);
+  if (s_module_cache.size() >= MODULE_CACHE_MAX_SIZE)
+    s_module_cache.clear();
+  s_module_cache.emplace(cache_key, *mod);
   return true;
 }
 
+void PostProcessing::ReShadeFXShader::ClearModuleCache()
+{
+  std::unique_lock lock(s_module_cache_mutex);
+  s_module_cache.clear();
+}
+
 static bool HasAnnotationWithName(const reshadefx::uniform_info& uniform, const std::string_view& annotation_name)
 {
   for (const reshadefx::annotation& an : uniform.annotations)
@@ -293,14 +293,34 @@ void SDLInputSource::ShutdownSubsystem()
 
 void SDLInputSource::PollEvents()
 {
+  // SDL_PollEvent() pumps the event queue on every call, which adds up when this runs once per frame
+  // at fast-forward rates. Pump once, then drain the queue in batches.
+  SDL_PumpEvents();
+
+  SDL_Event events[64];
   for (;;)
   {
-    SDL_Event ev;
-    if (SDL_PollEvent(&ev))
-      ProcessSDLEvent(&ev);
-    else
+    const int count = SDL_PeepEvents(events, static_cast<int>(std::size(events)), SDL_GETEVENT, SDL_FIRSTEVENT,
+                                     SDL_LASTEVENT);
+    if (count <= 0)
+      break;
+
+    for (int i = 0; i < count; i++)
+      ProcessSDLEvent(&events[i]);
+
+    if (count < static_cast<int>(std::size(events)))
       break;
   }
+
+  // Flush any coalesced rumble changes, at most one device write per pad per poll.
+  for (ControllerData& cd : m_controllers)
+  {
+    if (cd.rumble_update_pending)
+    {
+      cd.rumble_update_pending = false;
+      SendRumbleUpdate(&cd);
+    }
+  }
 }
 
 std::vector<std::pair<std::string, std::string>> SDLInputSource::EnumerateDevices()
@@ -955,7 +975,7 @@ void SDLInputSource::UpdateMotorState(InputBindingKey key, float intensity)
     return;
 
   it->rumble_intensity[key.data] = static_cast<u16>(intensity * 65535.0f);
-  SendRumbleUpdate(&(*it));
+  it->rumble_update_pending = true;
 }
 
 void SDLInputSource::UpdateMotorState(InputBindingKey large_key, InputBindingKey small_key, float large_intensity,
@@ -976,7 +996,7 @@ void SDLInputSource::UpdateMotorState(InputBindingKey large_key, InputBindingKey
 
   it->rumble_intensity[large_key.data] = static_cast<u16>(large_intensity * 65535.0f);
   it->rumble_intensity[small_key.data] = static_cast<u16>(small_intensity * 65535.0f);
-  SendRumbleUpdate(&(*it));
+  it->rumble_update_pending = true;
 }
 
 void SDLInputSource::SendRumbleUpdate(ControllerData* cd)
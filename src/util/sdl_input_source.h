@@ -56,6 +56,10 @@ private:
     int player_id;
     bool use_game_controller_rumble;
 
+    // Rumble writes can block for milliseconds on wireless pads, so intensity changes are
+    // coalesced here and flushed once per poll instead of being sent mid-frame.
+    bool rumble_update_pending;
+
     // Used to disable Joystick controls that are used in GameController inputs so we don't get double events
     std::vector<bool> joy_button_used_in_gc;
     std::vector<bool> joy_axis_used_in_gc;
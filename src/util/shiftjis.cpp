@@ -1332,6 +1332,38 @@ static const unsigned char shiftJIS_convTable[25088] = {
 
 // https://github.com/bucanero/apollo-ps3/commit/b8e52b021239d40f2ba6945d7352345f4457b7b7
 
+// Returns the length of the leading run of bytes which convert to themselves: plain ASCII,
+// excluding 0x5C, 0x7E and 0x7F which Shift-JIS maps to the yen sign, overline and a space.
+// Most title text is entirely such bytes, so this lets the converters skip the table walk for
+// the common case. Checks eight bytes at a time using the usual SWAR zero-byte trick.
+static std::size_t identityRunLength(const char* data, std::size_t len)
+{
+  std::size_t i = 0;
+  while ((i + 8) <= len)
+  {
+    std::uint64_t chunk;
+    std::memcpy(&chunk, data + i, 8);
+
+    const std::uint64_t x5c = chunk ^ UINT64_C(0x5C5C5C5C5C5C5C5C);
+    const std::uint64_t has_5c = (x5c - UINT64_C(0x0101010101010101)) & ~x5c;
+    const std::uint64_t x7ef = (chunk | UINT64_C(0x0101010101010101)) ^ UINT64_C(0x7F7F7F7F7F7F7F7F);
+    const std::uint64_t has_7ef = (x7ef - UINT64_C(0x0101010101010101)) & ~x7ef;
+    if (((chunk | has_5c | has_7ef) & UINT64_C(0x8080808080808080)) != 0)
+      break;
+
+    i += 8;
+  }
+
+  for (; i < len; i++)
+  {
+    const std::uint8_t c = static_cast<std::uint8_t>(data[i]);
+    if (c >= 0x7E || c == 0x5C)
+      break;
+  }
+
+  return i;
+}
+
 void sjis2ascii(char* bData)
 {
   std::uint16_t ch;
@@ -1340,6 +1372,19 @@ void sjis2ascii(char* bData)
 
   for (i = 0; i < len; i += 2)
   {
+    // Skip over runs of plain ASCII without going through the punctuation switch below. The run
+    // is truncated to an even length so the two-bytes-per-step decode stays aligned.
+    const int run = static_cast<int>(identityRunLength(&bData[i], static_cast<std::size_t>(len - i))) & ~1;
+    if (run > 0)
+    {
+      if (i != j)
+        std::memmove(&bData[j], &bData[i], static_cast<std::size_t>(run));
+      i += run;
+      j += run;
+      if (i >= len)
+        break;
+    }
+
     ch = (static_cast<std::uint8_t>(bData[i]) << 8) | static_cast<std::uint8_t>(bData[i + 1]);
 
     // 'A' .. 'Z'
@@ -1545,6 +1590,18 @@ char* sjis2utf8(char* input)
 
   while (indexInput < len)
   {
+    // Bytes which convert to themselves (nearly everything in a typical title) can be copied
+    // straight across without the table lookups.
+    const size_t run = identityRunLength(&input[indexInput], len - indexInput);
+    if (run > 0)
+    {
+      std::memcpy(&output[indexOutput], &input[indexInput], run);
+      indexInput += run;
+      indexOutput += run;
+      if (indexInput >= len)
+        break;
+    }
+
     char arraySection = ((uint8_t)input[indexInput]) >> 4;
 
     size_t arrayOffset;
@@ -92,3 +92,59 @@ bool StateWrapper::DoMarker(const char* marker)
 
   return false;
 }
+
+bool StateWrapper::BeginSection(const char* marker)
+{
+  if (!DoMarker(marker))
+    return false;
+
+  u32 size = 0;
+  Do(&size);
+  if (m_error)
+    return false;
+
+  if (m_mode == Mode::Write)
+  {
+    // size gets patched in by EndSection
+    m_section_size_offset = m_stream->GetPosition();
+  }
+  else
+  {
+    m_section_end_offset = m_stream->GetPosition() + size;
+  }
+
+  return true;
+}
+
+bool StateWrapper::EndSection()
+{
+  if (m_error)
+    return false;
+
+  if (m_mode == Mode::Write)
+  {
+    const u64 end_offset = m_stream->GetPosition();
+    const u32 size = static_cast<u32>(end_offset - m_section_size_offset);
+    m_error |= !(m_stream->SeekAbsolute(m_section_size_offset - sizeof(u32)) &&
+                 m_stream->Write2(&size, sizeof(size)) && m_stream->SeekAbsolute(end_offset));
+    return !m_error;
+  }
+
+  // tolerate sections which gained trailing fields after this reader's version
+  if (m_stream->GetPosition() != m_section_end_offset)
+    m_error |= !m_stream->SeekAbsolute(m_section_end_offset);
+
+  return !m_error;
+}
+
+bool StateWrapper::SkipSection()
+{
+  if (m_mode != Mode::Read)
+  {
+    m_error = true;
+    return false;
+  }
+
+  m_error |= !m_stream->SeekAbsolute(m_section_end_offset);
+  return !m_error;
+}
@@ -180,6 +180,14 @@ public:
 
   bool DoMarker(const char* marker);
 
+  /// Chunked sections: a marker followed by a 32-bit byte size, so readers can seek over
+  /// subsystems without deserializing them. Requires a seekable stream. Sections don't nest.
+  bool BeginSection(const char* marker);
+  bool EndSection();
+
+  /// Skips the remainder of the section most recently opened with BeginSection.
+  bool SkipSection();
+
   template<typename T>
   void DoEx(T* data, u32 version_introduced, T default_value)
   {
@@ -209,4 +217,8 @@ private:
   Mode m_mode;
   u32 m_version;
   bool m_error = false;
+
+  // current section bookkeeping: size field position on write, end position on read
+  u64 m_section_size_offset = 0;
+  u64 m_section_end_offset = 0;
 };
@@ -797,8 +797,12 @@ bool VulkanDevice::CreatePersistentDescriptorPool()
 
   if (m_features.gpu_timing)
   {
-    const VkQueryPoolCreateInfo query_create_info = {
-      VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO, nullptr, 0, VK_QUERY_TYPE_TIMESTAMP, NUM_COMMAND_BUFFERS * 4, 0};
+    const VkQueryPoolCreateInfo query_create_info = {VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,
+                                                     nullptr,
+                                                     0,
+                                                     VK_QUERY_TYPE_TIMESTAMP,
+                                                     NUM_COMMAND_BUFFERS * NUM_TIMESTAMP_QUERIES_PER_CMDBUFFER,
+                                                     0};
     res = vkCreateQueryPool(m_device, &query_create_info, nullptr, &m_timestamp_query_pool);
     if (res != VK_SUCCESS)
     {
@@ -838,6 +842,24 @@ size_t VulkanDevice::RenderPassCacheKeyHash::operator()(const RenderPassCacheKey
     return XXH32(&rhs, sizeof(rhs), 0x1337);
 }
 
+bool VulkanDevice::MultiTextureDescriptorSetKey::operator==(const MultiTextureDescriptorSetKey& rhs) const
+{
+  return (std::memcmp(this, &rhs, sizeof(*this)) == 0);
+}
+
+bool VulkanDevice::MultiTextureDescriptorSetKey::operator!=(const MultiTextureDescriptorSetKey& rhs) const
+{
+  return (std::memcmp(this, &rhs, sizeof(*this)) != 0);
+}
+
+size_t VulkanDevice::MultiTextureDescriptorSetKeyHash::operator()(const MultiTextureDescriptorSetKey& rhs) const
+{
+  if constexpr (sizeof(void*) == 8)
+    return XXH3_64bits(&rhs, sizeof(rhs));
+  else
+    return XXH32(&rhs, sizeof(rhs), 0x1337);
+}
+
 VkRenderPass VulkanDevice::GetRenderPass(const GPUPipeline::GraphicsConfig& config)
 {
   RenderPassCacheKey key;
@@ -869,6 +891,9 @@ VkRenderPass VulkanDevice::GetRenderPass(const GPUPipeline::GraphicsConfig& conf
 
   key.samples = static_cast<u8>(config.samples);
 
+  // This variant can be called from worker threads during parallel pipeline compilation, so the
+  // cache needs locking. The other variants are only ever used from the GPU thread.
+  const std::unique_lock lock(m_render_pass_cache_mutex);
   const auto it = m_render_pass_cache.find(key);
   return (it != m_render_pass_cache.end()) ? it->second : CreateCachedRenderPass(key);
 }
@@ -1039,6 +1064,34 @@ float VulkanDevice::GetAndResetAccumulatedGPUTime()
   return time;
 }
 
+float VulkanDevice::GetAndResetAccumulatedStageGPUTime(GPUTimingStage stage)
+{
+  const float time = m_accumulated_stage_gpu_time[static_cast<size_t>(stage)];
+  m_accumulated_stage_gpu_time[static_cast<size_t>(stage)] = 0.0f;
+  return time;
+}
+
+void VulkanDevice::SetGPUTimingStage(GPUTimingStage stage)
+{
+  if (stage == m_current_timing_stage)
+    return;
+
+  // Track the active stage even when disabled, so the first command buffer after enabling
+  // attributes its work correctly.
+  m_current_timing_stage = stage;
+  if (!m_gpu_timing_enabled)
+    return;
+
+  CommandBuffer& resources = m_frame_resources[m_current_frame];
+  if (!resources.timestamp_written || resources.num_stage_markers == MAX_TIMESTAMP_STAGE_MARKERS)
+    return;
+
+  vkCmdWriteTimestamp(m_current_command_buffer, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, m_timestamp_query_pool,
+                      (m_current_frame * NUM_TIMESTAMP_QUERIES_PER_CMDBUFFER) + 1 + resources.num_stage_markers);
+  resources.num_stage_markers++;
+  resources.interval_stages[resources.num_stage_markers] = stage;
+}
+
 bool VulkanDevice::SetGPUTimingEnabled(bool enabled)
 {
   m_gpu_timing_enabled = enabled && m_features.gpu_timing;
@@ -1068,19 +1121,27 @@ void VulkanDevice::WaitForCommandBufferCompletion(u32 index)
 
     if (m_gpu_timing_enabled && resources.timestamp_written)
     {
-      std::array<u64, 2> timestamps;
-      res =
-        vkGetQueryPoolResults(m_device, m_timestamp_query_pool, index * 2, static_cast<u32>(timestamps.size()),
-                              sizeof(u64) * timestamps.size(), timestamps.data(), sizeof(u64), VK_QUERY_RESULT_64_BIT);
+      // layout is [start, marker0..markerN-1, end], so the timestamps come back in draw order
+      const u32 num_timestamps = resources.num_stage_markers + 2;
+      std::array<u64, NUM_TIMESTAMP_QUERIES_PER_CMDBUFFER> timestamps;
+      res = vkGetQueryPoolResults(m_device, m_timestamp_query_pool,
+                                  cleanup_index * NUM_TIMESTAMP_QUERIES_PER_CMDBUFFER, num_timestamps,
+                                  sizeof(u64) * num_timestamps, timestamps.data(), sizeof(u64), VK_QUERY_RESULT_64_BIT);
       if (res == VK_SUCCESS)
       {
         // if we didn't write the timestamp at the start of the cmdbuffer (just enabled timing), the first TS will be
         // zero
         if (timestamps[0] > 0 && m_gpu_timing_enabled)
         {
-          const double ns_diff =
-            (timestamps[1] - timestamps[0]) * static_cast<double>(m_device_properties.limits.timestampPeriod);
-          m_accumulated_gpu_time += static_cast<float>(ns_diff / 1000000.0);
+          const double ns_to_ms = static_cast<double>(m_device_properties.limits.timestampPeriod) / 1000000.0;
+          m_accumulated_gpu_time +=
+            static_cast<float>(static_cast<double>(timestamps[num_timestamps - 1] - timestamps[0]) * ns_to_ms);
+
+          for (u32 i = 0; i < (resources.num_stage_markers + 1); i++)
+          {
+            m_accumulated_stage_gpu_time[static_cast<size_t>(resources.interval_stages[i])] +=
+              static_cast<float>(static_cast<double>(timestamps[i + 1] - timestamps[i]) * ns_to_ms);
+          }
         }
       }
       else
@@ -1126,7 +1187,7 @@ void VulkanDevice::SubmitCommandBuffer(VulkanSwapChain* present_swap_chain /* =
   if (m_gpu_timing_enabled && resources.timestamp_written)
   {
     vkCmdWriteTimestamp(m_current_command_buffer, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, m_timestamp_query_pool,
-                        m_current_frame * 2 + 1);
+                        (m_current_frame * NUM_TIMESTAMP_QUERIES_PER_CMDBUFFER) + 1 + resources.num_stage_markers);
   }
 
   res = vkEndCommandBuffer(resources.command_buffers[1]);
@@ -1321,14 +1382,17 @@ void VulkanDevice::BeginCommandBuffer(u32 index)
 
   if (m_gpu_timing_enabled)
   {
-    vkCmdResetQueryPool(resources.command_buffers[1], m_timestamp_query_pool, index * 2, 2);
+    vkCmdResetQueryPool(resources.command_buffers[1], m_timestamp_query_pool,
+                        index * NUM_TIMESTAMP_QUERIES_PER_CMDBUFFER, NUM_TIMESTAMP_QUERIES_PER_CMDBUFFER);
     vkCmdWriteTimestamp(resources.command_buffers[1], VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, m_timestamp_query_pool,
-                        index * 2);
+                        index * NUM_TIMESTAMP_QUERIES_PER_CMDBUFFER);
   }
 
   resources.fence_counter = m_next_fence_counter++;
   resources.init_buffer_used = false;
   resources.timestamp_written = m_gpu_timing_enabled;
+  resources.num_stage_markers = 0;
+  resources.interval_stages[0] = m_current_timing_stage;
 
   m_current_frame = index;
   m_current_command_buffer = resources.command_buffers[1];
@@ -1425,6 +1489,18 @@ void VulkanDevice::DeferPersistentDescriptorSetDestruction(VkDescriptorSet objec
   m_cleanup_objects.emplace_back(GetCurrentFenceCounter(), [this, object]() { FreePersistentDescriptorSet(object); });
 }
 
+void VulkanDevice::DeferSemaphoreDestruction(VkSemaphore object)
+{
+  m_cleanup_objects.emplace_back(GetCurrentFenceCounter(),
+                                 [this, object]() { vkDestroySemaphore(m_device, object, nullptr); });
+}
+
+void VulkanDevice::DeferSwapChainDestruction(VkSwapchainKHR object)
+{
+  m_cleanup_objects.emplace_back(GetCurrentFenceCounter(),
+                                 [this, object]() { vkDestroySwapchainKHR(m_device, object, nullptr); });
+}
+
 VKAPI_ATTR VkBool32 VKAPI_CALL DebugMessengerCallback(VkDebugUtilsMessageSeverityFlagBitsEXT severity,
                                                       VkDebugUtilsMessageTypeFlagsEXT messageType,
                                                       const VkDebugUtilsMessengerCallbackDataEXT* pCallbackData,
@@ -2102,8 +2178,10 @@ void VulkanDevice::ResizeWindow(s32 new_window_width, s32 new_window_height, flo
     return;
   }
 
-  // make sure previous frames are presented
-  WaitForGPUIdle();
+  // The old swapchain is handed to vkCreateSwapchainKHR as oldSwapchain and its resources are
+  // retired through the deferred cleanup list, so no device drain is needed here - just make sure
+  // the previous present has been submitted. Emulation keeps running during the transition.
+  WaitForPresentComplete();
 
   if (!m_swap_chain->ResizeSwapChain(new_window_width, new_window_height, new_window_scale))
   {
@@ -2154,11 +2232,17 @@ std::string VulkanDevice::GetDriverInfo() const
 
 void VulkanDevice::SetVSync(bool enabled)
 {
-  if (!m_swap_chain || m_vsync_enabled == enabled)
+  if (!m_swap_chain)
+  {
+    m_vsync_enabled = enabled;
     return;
+  }
 
-  // This swap chain should not be used by the current buffer, thus safe to destroy.
-  WaitForGPUIdle();
+  // Even when the vsync flag didn't change, the present mode preference might have - the swap
+  // chain re-selects and only recreates when the effective mode differs. Same deal as
+  // ResizeWindow() for the recreation itself: the old swapchain is retired through oldSwapchain
+  // and the deferred cleanup list, only the in-flight present needs to be waited for.
+  WaitForPresentComplete();
   if (!m_swap_chain->SetVSync(enabled))
   {
     // Try switching back to the old mode..
@@ -2248,10 +2332,23 @@ void VulkanDevice::EndPresent()
   VulkanTexture::TransitionSubresourcesToLayout(cmdbuf, m_swap_chain->GetCurrentImage(), GPUTexture::Type::RenderTarget,
                                                 0, 1, 0, 1, VulkanTexture::Layout::ColorAttachment,
                                                 VulkanTexture::Layout::PresentSrc);
+  const u64 presented_fence_counter = GetCurrentFenceCounter();
   SubmitCommandBuffer(m_swap_chain.get(), !m_swap_chain->IsPresentModeSynchronizing());
   MoveToNextCommandBuffer();
   InvalidateCachedState();
   TrimTexturePool();
+
+  // If the user has requested a lower queue depth than the command buffer rotation gives us, wait
+  // for the presents before the last N to reach the GPU before returning to emulation.
+  if (m_max_queued_frames > 0)
+  {
+    m_present_fence_counters[m_present_fence_counter_pos] = presented_fence_counter;
+    const u32 wait_pos = (m_present_fence_counter_pos + NUM_COMMAND_BUFFERS -
+                          std::min<u32>(m_max_queued_frames, NUM_COMMAND_BUFFERS - 1)) %
+                         NUM_COMMAND_BUFFERS;
+    m_present_fence_counter_pos = (m_present_fence_counter_pos + 1) % NUM_COMMAND_BUFFERS;
+    WaitForFenceCounter(m_present_fence_counters[wait_pos]);
+  }
 }
 
 #ifdef _DEBUG
@@ -2372,6 +2469,10 @@ bool VulkanDevice::CheckFeatures(FeatureMask disabled_features)
   m_features.shader_cache = true;
   m_features.pipeline_cache = true;
 
+  // Pipeline creation only touches the (locked) render pass cache and the internally-synchronized
+  // VkPipelineCache, so it can be fanned out across threads.
+  m_features.parallel_pipeline_compilation = true;
+
   return true;
 }
 
@@ -2782,6 +2883,10 @@ bool VulkanDevice::CreatePersistentDescriptorSets()
 
 void VulkanDevice::DestroyPersistentDescriptorSets()
 {
+  for (const auto& it : m_multi_texture_ds_cache)
+    FreePersistentDescriptorSet(it.second);
+  m_multi_texture_ds_cache.clear();
+
   if (m_ubo_descriptor_set != VK_NULL_HANDLE)
     FreePersistentDescriptorSet(m_ubo_descriptor_set);
 }
@@ -3330,6 +3435,67 @@ void VulkanDevice::PreDrawCheck()
     BeginRenderPass();
 }
 
+VkDescriptorSet VulkanDevice::GetMultiTextureDescriptorSet()
+{
+  MultiTextureDescriptorSetKey key;
+  for (u32 i = 0; i < MAX_TEXTURE_SAMPLERS; i++)
+  {
+    DebugAssert(m_current_textures[i] && m_current_samplers[i] != VK_NULL_HANDLE);
+    key.views[i] = m_current_textures[i]->GetView();
+    key.samplers[i] = m_current_samplers[i];
+  }
+
+  const auto it = m_multi_texture_ds_cache.find(key);
+  if (it != m_multi_texture_ds_cache.end())
+    return it->second;
+
+  bool persistent = true;
+  VkDescriptorSet ds = AllocatePersistentDescriptorSet(m_multi_texture_ds_layout);
+  if (ds == VK_NULL_HANDLE)
+  {
+    // Global pool is exhausted, fall back to a transient set for this draw.
+    ds = AllocateDescriptorSet(m_multi_texture_ds_layout);
+    if (ds == VK_NULL_HANDLE)
+      return VK_NULL_HANDLE;
+
+    persistent = false;
+  }
+
+  Vulkan::DescriptorSetUpdateBuilder dsub;
+  for (u32 i = 0; i < MAX_TEXTURE_SAMPLERS; i++)
+  {
+    dsub.AddCombinedImageSamplerDescriptorWrite(ds, i, key.views[i], key.samplers[i],
+                                                VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+  }
+  dsub.Update(m_device, false);
+
+  if (persistent)
+    m_multi_texture_ds_cache.emplace(key, ds);
+
+  return ds;
+}
+
+void VulkanDevice::PurgeMultiTextureDescriptorSets(VkImageView view, bool defer)
+{
+  for (auto it = m_multi_texture_ds_cache.begin(); it != m_multi_texture_ds_cache.end();)
+  {
+    bool references_view = false;
+    for (u32 i = 0; i < MAX_TEXTURE_SAMPLERS; i++)
+      references_view |= (it->first.views[i] == view);
+    if (!references_view)
+    {
+      ++it;
+      continue;
+    }
+
+    if (defer)
+      DeferPersistentDescriptorSetDestruction(it->second);
+    else
+      FreePersistentDescriptorSet(it->second);
+    it = m_multi_texture_ds_cache.erase(it);
+  }
+}
+
 template<GPUPipeline::Layout layout>
 bool VulkanDevice::UpdateDescriptorSetsForLayout(bool new_layout, bool new_dynamic_offsets)
 {
@@ -3360,10 +3526,10 @@ bool VulkanDevice::UpdateDescriptorSetsForLayout(bool new_layout, bool new_dynam
   else if constexpr (layout == GPUPipeline::Layout::MultiTextureAndUBO ||
                      layout == GPUPipeline::Layout::MultiTextureAndPushConstants)
   {
-    Vulkan::DescriptorSetUpdateBuilder dsub;
-
     if (m_optional_extensions.vk_khr_push_descriptor)
     {
+      Vulkan::DescriptorSetUpdateBuilder dsub;
+
       for (u32 i = 0; i < MAX_TEXTURE_SAMPLERS; i++)
       {
         DebugAssert(m_current_textures[i] && m_current_samplers[i] != VK_NULL_HANDLE);
@@ -3379,20 +3545,11 @@ bool VulkanDevice::UpdateDescriptorSetsForLayout(bool new_layout, bool new_dynam
     }
     else
     {
-      VkDescriptorSet tds = AllocateDescriptorSet(m_multi_texture_ds_layout);
+      const VkDescriptorSet tds = GetMultiTextureDescriptorSet();
       if (tds == VK_NULL_HANDLE)
         return false;
 
       ds[num_ds++] = tds;
-
-      for (u32 i = 0; i < MAX_TEXTURE_SAMPLERS; i++)
-      {
-        DebugAssert(m_current_textures[i] && m_current_samplers[i] != VK_NULL_HANDLE);
-        dsub.AddCombinedImageSamplerDescriptorWrite(tds, i, m_current_textures[i]->GetView(), m_current_samplers[i],
-                                                    VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
-      }
-
-      dsub.Update(m_device, false);
     }
   }
 
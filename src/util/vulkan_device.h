@@ -36,6 +36,10 @@ public:
   enum : u32
   {
     NUM_COMMAND_BUFFERS = 3,
+
+    // One start and one end timestamp, with the remainder available for stage boundary markers.
+    NUM_TIMESTAMP_QUERIES_PER_CMDBUFFER = 16,
+    MAX_TIMESTAMP_STAGE_MARKERS = NUM_TIMESTAMP_QUERIES_PER_CMDBUFFER - 2,
   };
 
   struct OptionalExtensions
@@ -115,6 +119,8 @@ public:
 
   bool SetGPUTimingEnabled(bool enabled) override;
   float GetAndResetAccumulatedGPUTime() override;
+  void SetGPUTimingStage(GPUTimingStage stage) override;
+  float GetAndResetAccumulatedStageGPUTime(GPUTimingStage stage) override;
 
   void SetVSync(bool enabled) override;
 
@@ -197,6 +203,8 @@ public:
   void DeferPipelineDestruction(VkPipeline object);
   void DeferBufferViewDestruction(VkBufferView object);
   void DeferPersistentDescriptorSetDestruction(VkDescriptorSet object);
+  void DeferSemaphoreDestruction(VkSemaphore object);
+  void DeferSwapChainDestruction(VkSwapchainKHR object);
 
   // Wait for a fence to be completed.
   // Also invokes callbacks for completion.
@@ -212,6 +220,9 @@ public:
   void UnbindTexture(VulkanTexture* tex);
   void UnbindTextureBuffer(VulkanTextureBuffer* buf);
 
+  /// Frees any cached multi-texture descriptor sets which reference the given view.
+  void PurgeMultiTextureDescriptorSets(VkImageView view, bool defer);
+
 protected:
   bool CreateDevice(const std::string_view& adapter, bool threaded_presentation,
                     FeatureMask disabled_features) override;
@@ -260,6 +271,20 @@ private:
     size_t operator()(const RenderPassCacheKey& rhs) const;
   };
 
+  struct MultiTextureDescriptorSetKey
+  {
+    VkImageView views[MAX_TEXTURE_SAMPLERS];
+    VkSampler samplers[MAX_TEXTURE_SAMPLERS];
+
+    bool operator==(const MultiTextureDescriptorSetKey& rhs) const;
+    bool operator!=(const MultiTextureDescriptorSetKey& rhs) const;
+  };
+
+  struct MultiTextureDescriptorSetKeyHash
+  {
+    size_t operator()(const MultiTextureDescriptorSetKey& rhs) const;
+  };
+
   struct CommandBuffer
   {
     // [0] - Init (upload) command buffer, [1] - draw command buffer
@@ -271,6 +296,8 @@ private:
     bool init_buffer_used = false;
     bool needs_fence_wait = false;
     bool timestamp_written = false;
+    u32 num_stage_markers = 0;
+    std::array<GPUTimingStage, MAX_TIMESTAMP_STAGE_MARKERS + 1> interval_stages{};
   };
 
   using CleanupObjectFunction = void (*)(VulkanDevice& dev, void* obj);
@@ -343,6 +370,7 @@ private:
   template<GPUPipeline::Layout layout>
   bool UpdateDescriptorSetsForLayout(bool new_layout, bool new_dynamic_offsets);
   bool UpdateDescriptorSets(u32 dirty);
+  VkDescriptorSet GetMultiTextureDescriptorSet();
 
   // Ends a render pass if we're currently in one.
   // When Bind() is next called, the pass will be restarted.
@@ -381,6 +409,8 @@ private:
 
   VkQueryPool m_timestamp_query_pool = VK_NULL_HANDLE;
   float m_accumulated_gpu_time = 0.0f;
+  GPUTimingStage m_current_timing_stage = GPUTimingStage::Other;
+  std::array<float, static_cast<size_t>(GPUTimingStage::MaxCount)> m_accumulated_stage_gpu_time = {};
 
   std::array<CommandBuffer, NUM_COMMAND_BUFFERS> m_frame_resources;
   std::deque<std::pair<u64, std::function<void()>>> m_cleanup_objects; // [fence_counter, callback]
@@ -388,6 +418,9 @@ private:
   u64 m_completed_fence_counter = 0;
   u32 m_current_frame = 0;
 
+  std::array<u64, NUM_COMMAND_BUFFERS> m_present_fence_counters = {};
+  u32 m_present_fence_counter_pos = 0;
+
   std::atomic_bool m_last_submit_failed{false};
   std::atomic_bool m_last_present_failed{false};
   std::atomic_bool m_present_done{true};
@@ -405,7 +438,13 @@ private:
 
   QueuedPresent m_queued_present = {};
 
+  // Protected by a mutex because pipelines can be compiled off-thread, and pipeline creation needs render passes.
+  std::mutex m_render_pass_cache_mutex;
   std::unordered_map<RenderPassCacheKey, VkRenderPass, RenderPassCacheKeyHash> m_render_pass_cache;
+
+  // Cached multi-texture descriptor sets, only used when VK_KHR_push_descriptor is unsupported.
+  std::unordered_map<MultiTextureDescriptorSetKey, VkDescriptorSet, MultiTextureDescriptorSetKeyHash>
+    m_multi_texture_ds_cache;
   GPUFramebufferManager<VkFramebuffer, CreateFramebuffer, DestroyFramebuffer> m_framebuffer_manager;
   VkPipelineCache m_pipeline_cache = VK_NULL_HANDLE;
 
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
 
 #include "vulkan_stream_buffer.h"
+#include "gpu_device.h"
 #include "vulkan_builders.h"
 #include "vulkan_device.h"
 
@@ -144,6 +145,7 @@ bool VulkanStreamBuffer::ReserveMemory(u32 num_bytes, u32 alignment)
       // Reset offset to zero, since we're allocating behind the gpu now
       m_current_offset = 0;
       m_current_space = m_current_gpu_position - 1;
+      GPUDevice::CountStreamBufferWrap();
       return true;
     }
   }
@@ -174,6 +176,7 @@ bool VulkanStreamBuffer::ReserveMemory(u32 num_bytes, u32 alignment)
   // We tried everything we could, and still couldn't get anything. This means that too much space
   // in the buffer is being used by the command buffer currently being recorded. Therefore, the
   // only option is to execute it, and wait until it's done.
+  GPUDevice::CountStreamBufferStall();
   return false;
 }
 
@@ -187,6 +190,7 @@ void VulkanStreamBuffer::CommitMemory(u32 final_num_bytes)
 
   m_current_offset += final_num_bytes;
   m_current_space -= final_num_bytes;
+  GPUDevice::CountBytesStreamed(final_num_bytes);
   UpdateCurrentFencePosition();
 }
 
@@ -301,6 +305,7 @@ bool VulkanStreamBuffer::WaitForClearSpace(u32 num_bytes)
     return false;
 
   // Wait until this fence is signaled. This will fire the callback, updating the GPU position.
+  GPUDevice::CountStreamBufferStall();
   VulkanDevice::GetInstance().WaitForFenceCounter(iter->first);
   m_tracked_fences.erase(m_tracked_fences.begin(), m_current_offset == iter->second ? m_tracked_fences.end() : ++iter);
   m_current_offset = new_offset;
@@ -5,6 +5,8 @@
 #include "vulkan_builders.h"
 #include "vulkan_device.h"
 
+#include "core/host.h" // TODO: Remove me
+
 #include "common/assert.h"
 #include "common/log.h"
 
@@ -293,8 +295,11 @@ std::optional<VkPresentModeKHR> VulkanSwapChain::SelectPresentMode(VkSurfaceKHR
     return it != present_modes.end();
   };
 
-  // Use preferred mode if available.
-  const VkPresentModeKHR preferred_mode = GetPreferredPresentModeForVsyncMode(vsync);
+  // Use preferred mode if available. When running unsynchronized, the user can trade the tearing
+  // of immediate mode for up to a frame of latency by preferring mailbox instead.
+  VkPresentModeKHR preferred_mode = GetPreferredPresentModeForVsyncMode(vsync);
+  if (!vsync && Host::GetBoolSettingValue("Display", "PreferMailboxPresentation", false))
+    preferred_mode = VK_PRESENT_MODE_MAILBOX_KHR;
   VkPresentModeKHR selected_mode;
   if (CheckForMode(preferred_mode))
   {
@@ -305,6 +310,11 @@ std::optional<VkPresentModeKHR> VulkanSwapChain::SelectPresentMode(VkSurfaceKHR
     // Prefer mailbox over fifo for adaptive vsync/no-vsync.
     selected_mode = VK_PRESENT_MODE_MAILBOX_KHR;
   }
+  else if (!vsync && CheckForMode(VK_PRESENT_MODE_IMMEDIATE_KHR))
+  {
+    // Otherwise fall back to immediate, still unsynchronized.
+    selected_mode = VK_PRESENT_MODE_IMMEDIATE_KHR;
+  }
   else if (vsync /*vsync != VsyncMode::Off*/ && CheckForMode(VK_PRESENT_MODE_FIFO_KHR))
   {
     // Fallback to FIFO if we're using any kind of vsync.
@@ -453,18 +463,21 @@ bool VulkanSwapChain::CreateSwapChain()
 #endif
 
   res = vkCreateSwapchainKHR(dev.GetVulkanDevice(), &swap_chain_info, nullptr, &m_swap_chain);
+
+  // The old swap chain is retired by the create call regardless of whether it succeeded, but the
+  // presentation engine can still be displaying its images, so destruction goes through the
+  // deferred cleanup list rather than draining the device.
+  if (old_swap_chain != VK_NULL_HANDLE)
+    dev.DeferSwapChainDestruction(old_swap_chain);
+
   if (res != VK_SUCCESS)
   {
     LOG_VULKAN_ERROR(res, "vkCreateSwapchainKHR failed: ");
     return false;
   }
 
-  // Now destroy the old swap chain, since it's been recreated.
-  // We can do this immediately since all work should have been completed before calling resize.
-  if (old_swap_chain != VK_NULL_HANDLE)
-    vkDestroySwapchainKHR(dev.GetVulkanDevice(), old_swap_chain, nullptr);
-
   m_format = surface_format->format;
+  m_present_mode = present_mode.value();
   m_window_info.surface_width = std::max(1u, size.width);
   m_window_info.surface_height = std::max(1u, size.height);
   m_window_info.surface_format = VulkanDevice::GetFormatForVkFormat(surface_format->format);
@@ -557,34 +570,52 @@ bool VulkanSwapChain::CreateSwapChain()
   return true;
 }
 
-void VulkanSwapChain::DestroySwapChainImages()
+void VulkanSwapChain::DestroySwapChainImages(bool defer_destruction)
 {
   VulkanDevice& dev = VulkanDevice::GetInstance();
   for (const auto& it : m_images)
   {
-    // don't defer view destruction, images are no longer valid
-    vkDestroyFramebuffer(dev.GetVulkanDevice(), it.framebuffer, nullptr);
-    vkDestroyImageView(dev.GetVulkanDevice(), it.view, nullptr);
+    if (defer_destruction)
+    {
+      dev.DeferFramebufferDestruction(it.framebuffer);
+      dev.DeferImageViewDestruction(it.view);
+    }
+    else
+    {
+      vkDestroyFramebuffer(dev.GetVulkanDevice(), it.framebuffer, nullptr);
+      vkDestroyImageView(dev.GetVulkanDevice(), it.view, nullptr);
+    }
   }
   m_images.clear();
   for (auto& it : m_semaphores)
   {
-    vkDestroySemaphore(dev.GetVulkanDevice(), it.rendering_finished_semaphore, nullptr);
-    vkDestroySemaphore(dev.GetVulkanDevice(), it.available_semaphore, nullptr);
+    if (defer_destruction)
+    {
+      dev.DeferSemaphoreDestruction(it.rendering_finished_semaphore);
+      dev.DeferSemaphoreDestruction(it.available_semaphore);
+    }
+    else
+    {
+      vkDestroySemaphore(dev.GetVulkanDevice(), it.rendering_finished_semaphore, nullptr);
+      vkDestroySemaphore(dev.GetVulkanDevice(), it.available_semaphore, nullptr);
+    }
   }
   m_semaphores.clear();
 
   m_image_acquire_result.reset();
 }
 
-void VulkanSwapChain::DestroySwapChain()
+void VulkanSwapChain::DestroySwapChain(bool defer_destruction)
 {
-  DestroySwapChainImages();
+  DestroySwapChainImages(defer_destruction);
 
   if (m_swap_chain == VK_NULL_HANDLE)
     return;
 
-  vkDestroySwapchainKHR(VulkanDevice::GetInstance().GetVulkanDevice(), m_swap_chain, nullptr);
+  if (defer_destruction)
+    VulkanDevice::GetInstance().DeferSwapChainDestruction(m_swap_chain);
+  else
+    vkDestroySwapchainKHR(VulkanDevice::GetInstance().GetVulkanDevice(), m_swap_chain, nullptr);
   m_swap_chain = VK_NULL_HANDLE;
   m_window_info.surface_width = 0;
   m_window_info.surface_height = 0;
@@ -612,7 +643,9 @@ void VulkanSwapChain::ReleaseCurrentImage()
 
 bool VulkanSwapChain::ResizeSwapChain(u32 new_width, u32 new_height, float new_scale)
 {
-  DestroySwapChainImages();
+  // In-flight frames may still be rendering to the old images, let the deferred cleanup list
+  // reclaim them once the GPU is done. The old swapchain itself is retired via oldSwapchain.
+  DestroySwapChainImages(true);
 
   if (new_width != 0 && new_height != 0)
   {
@@ -633,14 +666,19 @@ bool VulkanSwapChain::ResizeSwapChain(u32 new_width, u32 new_height, float new_s
 
 bool VulkanSwapChain::SetVSync(bool mode)
 {
-  if (m_vsync_mode == mode)
-    return true;
+  // The effective present mode depends on both the vsync flag and the user's present mode
+  // preference, so re-select and only recreate when it actually changes.
+  const std::optional<VkPresentModeKHR> new_present_mode = SelectPresentMode(m_surface, mode);
+  if (!new_present_mode.has_value())
+    return false;
 
   m_vsync_mode = mode;
+  if (m_swap_chain != VK_NULL_HANDLE && new_present_mode.value() == m_present_mode)
+    return true;
 
   // Recreate the swap chain with the new present mode.
   Log_VerbosePrintf("Recreating swap chain to change present mode.");
-  DestroySwapChainImages();
+  DestroySwapChainImages(true);
   if (!CreateSwapChain())
   {
     DestroySwapChain();
@@ -654,7 +692,12 @@ bool VulkanSwapChain::RecreateSurface(const WindowInfo& new_wi)
 {
   VulkanDevice& dev = VulkanDevice::GetInstance();
 
-  // Destroy the old swap chain, images, and surface.
+  // Destroy the old swap chain, images, and surface. The swap chain has to be destroyed before
+  // the surface it was created from (VUID-vkDestroySurfaceKHR-surface-01266), and oldSwapchain
+  // can't be reused across a surface change, so wait for the GPU to go idle and drop everything
+  // immediately rather than deferring it past the surface. This is a rare recovery path, the
+  // stall doesn't matter.
+  dev.WaitForGPUIdle();
   DestroySwapChain();
   DestroySurface();
 
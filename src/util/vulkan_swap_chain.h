@@ -80,10 +80,14 @@ private:
   static std::optional<VkPresentModeKHR> SelectPresentMode(VkSurfaceKHR surface, bool vsync);
 
   bool CreateSwapChain();
-  void DestroySwapChain();
+  void DestroySwapChain(bool defer_destruction = false);
 
   bool SetupSwapChainImages();
-  void DestroySwapChainImages();
+
+  // When defer_destruction is set, the views/framebuffers/semaphores are handed to the device's
+  // deferred cleanup list instead of being destroyed immediately, so in-flight frames which still
+  // reference them don't require a device drain.
+  void DestroySwapChainImages(bool defer_destruction = false);
 
   void DestroySurface();
 
@@ -109,6 +113,7 @@ private:
   std::vector<ImageSemaphores> m_semaphores;
 
   VkFormat m_format = VK_FORMAT_UNDEFINED;
+  VkPresentModeKHR m_present_mode = VK_PRESENT_MODE_FIFO_KHR;
   bool m_vsync_mode = false;
   u32 m_current_image = 0;
   u32 m_current_semaphore = 0;
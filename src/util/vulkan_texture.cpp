@@ -194,6 +194,7 @@ void VulkanTexture::Destroy(bool defer)
 
   if (m_view != VK_NULL_HANDLE)
   {
+    dev.PurgeMultiTextureDescriptorSets(m_view, defer);
     if (defer)
       VulkanDevice::GetInstance().DeferImageViewDestruction(m_view);
     else
@@ -4,6 +4,12 @@
 #include "wav_writer.h"
 #include "common/file_system.h"
 #include "common/log.h"
+#include "common/path.h"
+
+#include "fmt/format.h"
+
+#include <algorithm>
+
 Log_SetChannel(WAVWriter);
 
 namespace {
@@ -35,6 +41,9 @@ struct WAV_HEADER
 #pragma pack(pop)
 } // namespace
 
+// RIFF chunk sizes are 32-bit, leave some headroom below 4GB for the headers.
+static constexpr u32 MAX_DATA_SIZE = 0xFFF00000u;
+
 WAVWriter::WAVWriter() = default;
 
 WAVWriter::~WAVWriter()
@@ -52,12 +61,15 @@ bool WAVWriter::Open(const char* filename, u32 sample_rate, u32 num_channels)
   if (!m_file)
     return false;
 
+  m_filename = filename;
   m_sample_rate = sample_rate;
   m_num_channels = num_channels;
+  m_file_index = 1;
 
   if (!WriteHeader())
   {
     Log_ErrorPrintf("Failed to write header to file");
+    m_filename = {};
     m_sample_rate = 0;
     m_num_channels = 0;
     std::fclose(m_file);
@@ -65,6 +77,9 @@ bool WAVWriter::Open(const char* filename, u32 sample_rate, u32 num_channels)
     return false;
   }
 
+  m_shutdown = false;
+  m_open = true;
+  m_writer_thread = std::thread(&WAVWriter::WriterThreadEntryPoint, this);
   return true;
 }
 
@@ -73,29 +88,119 @@ void WAVWriter::Close()
   if (!IsOpen())
     return;
 
-  if (std::fseek(m_file, 0, SEEK_SET) != 0 || !WriteHeader())
-    Log_ErrorPrintf("Failed to re-write header on file, file may be unplayable");
+  {
+    std::unique_lock lock(m_buffer_mutex);
+    m_shutdown = true;
+    m_buffer_cv.notify_one();
+  }
+  m_writer_thread.join();
 
-  std::fclose(m_file);
-  m_file = nullptr;
+  if (m_file)
+  {
+    if (std::fseek(m_file, 0, SEEK_SET) != 0 || !WriteHeader())
+      Log_ErrorPrintf("Failed to re-write header on file, file may be unplayable");
+
+    std::fclose(m_file);
+    m_file = nullptr;
+  }
+
+  m_filename = {};
   m_sample_rate = 0;
   m_num_channels = 0;
   m_num_frames = 0;
+  m_file_frames = 0;
+  m_open = false;
+  m_pending_samples.clear();
+  m_writing_samples.clear();
 }
 
 void WAVWriter::WriteFrames(const s16* samples, u32 num_frames)
 {
-  const u32 num_frames_written =
-    static_cast<u32>(std::fwrite(samples, sizeof(s16) * m_num_channels, num_frames, m_file));
-  if (num_frames_written != num_frames)
-    Log_ErrorPrintf("Only wrote %u of %u frames to output file", num_frames_written, num_frames);
+  std::unique_lock lock(m_buffer_mutex);
+  m_pending_samples.insert(m_pending_samples.end(), samples, samples + (num_frames * m_num_channels));
+  m_num_frames += num_frames;
+  m_buffer_cv.notify_one();
+}
+
+void WAVWriter::WriterThreadEntryPoint()
+{
+  std::unique_lock lock(m_buffer_mutex);
+  for (;;)
+  {
+    m_buffer_cv.wait(lock, [this]() { return (m_shutdown || !m_pending_samples.empty()); });
+
+    if (!m_pending_samples.empty())
+    {
+      // Swap buffers, so the producer can keep appending while we hit the disk.
+      m_writing_samples.swap(m_pending_samples);
+
+      lock.unlock();
+      WriteBufferedFrames(m_writing_samples.data(), static_cast<u32>(m_writing_samples.size() / m_num_channels));
+      m_writing_samples.clear();
+      lock.lock();
+
+      // Drain anything that was queued while we were writing before honoring shutdown.
+      continue;
+    }
+
+    if (m_shutdown)
+      break;
+  }
+}
+
+void WAVWriter::WriteBufferedFrames(const s16* samples, u32 num_frames)
+{
+  const u32 max_file_frames = MAX_DATA_SIZE / (sizeof(SampleType) * m_num_channels);
+  while (num_frames > 0 && m_file)
+  {
+    if (m_file_frames >= max_file_frames && !OpenNextFile())
+      return;
+
+    const u32 this_write = std::min(num_frames, max_file_frames - m_file_frames);
+    const u32 frames_written =
+      static_cast<u32>(std::fwrite(samples, sizeof(SampleType) * m_num_channels, this_write, m_file));
+    m_file_frames += frames_written;
+    if (frames_written != this_write)
+    {
+      Log_ErrorPrintf("Only wrote %u of %u frames to output file", frames_written, this_write);
+      return;
+    }
+
+    samples += this_write * m_num_channels;
+    num_frames -= this_write;
+  }
+}
 
-  m_num_frames += num_frames_written;
+bool WAVWriter::OpenNextFile()
+{
+  // Finalize the current file, the data chunk is as large as RIFF allows.
+  if (std::fseek(m_file, 0, SEEK_SET) != 0 || !WriteHeader())
+    Log_ErrorPrintf("Failed to re-write header on file, file may be unplayable");
+  std::fclose(m_file);
+  m_file = nullptr;
+  m_file_frames = 0;
+  m_file_index++;
+
+  const std::string next_filename = fmt::format("{}_{}.wav", Path::StripExtension(m_filename), m_file_index);
+  m_file = FileSystem::OpenCFile(next_filename.c_str(), "wb");
+  if (!m_file || !WriteHeader())
+  {
+    Log_ErrorFmt("Failed to rotate capture to '{}', stopping write-out.", next_filename);
+    if (m_file)
+    {
+      std::fclose(m_file);
+      m_file = nullptr;
+    }
+    return false;
+  }
+
+  Log_InfoFmt("Rotated capture to '{}'.", next_filename);
+  return true;
 }
 
 bool WAVWriter::WriteHeader()
 {
-  const u32 data_size = sizeof(SampleType) * m_num_channels * m_num_frames;
+  const u32 data_size = sizeof(SampleType) * m_num_channels * m_file_frames;
 
   WAV_HEADER header = {};
   header.chunk_id = 0x46464952; // 0x52494646
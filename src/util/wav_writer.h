@@ -3,7 +3,12 @@
 
 #pragma once
 #include "common/types.h"
+#include <condition_variable>
 #include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
 
 class WAVWriter
 {
@@ -14,20 +19,37 @@ public:
   ALWAYS_INLINE u32 GetSampleRate() const { return m_sample_rate; }
   ALWAYS_INLINE u32 GetNumChannels() const { return m_num_channels; }
   ALWAYS_INLINE u32 GetNumFrames() const { return m_num_frames; }
-  ALWAYS_INLINE bool IsOpen() const { return (m_file != nullptr); }
+  ALWAYS_INLINE bool IsOpen() const { return m_open; }
 
   bool Open(const char* filename, u32 sample_rate, u32 num_channels);
   void Close();
 
+  /// Queues frames for the background writer thread; only briefly locks, never touches the disk.
   void WriteFrames(const s16* samples, u32 num_frames);
 
 private:
   using SampleType = s16;
 
   bool WriteHeader();
+  void WriterThreadEntryPoint();
+  void WriteBufferedFrames(const s16* samples, u32 num_frames);
+  bool OpenNextFile();
 
+  // Only touched by the writer thread while it is running.
   std::FILE* m_file = nullptr;
+  u32 m_file_frames = 0;
+  u32 m_file_index = 1;
+
+  std::string m_filename;
   u32 m_sample_rate = 0;
   u32 m_num_channels = 0;
   u32 m_num_frames = 0;
+  bool m_open = false;
+
+  std::thread m_writer_thread;
+  std::mutex m_buffer_mutex;
+  std::condition_variable m_buffer_cv;
+  std::vector<SampleType> m_pending_samples;
+  std::vector<SampleType> m_writing_samples;
+  bool m_shutdown = false;
 };